@@ -0,0 +1,145 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+#include "param_mmap.h"
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * Writes the pre-computed table of the base point to a table file
+ * (see param_table_serialize).
+ * @param path the file to be written
+ * @param param elliptic curve parameters (with a computed base_point_precomputed_table)
+ * @param type the scalar multiplication the table was computed for
+ * @return 1 on success, 0 otherwise
+ */
+int param_write_table_file( const char *path, const eccp_parameters_t *param, const param_table_type_t type ) {
+    size_t size = param_table_file_size( param, type );
+    uint8_t *buffer;
+    FILE *fp;
+    int result = 0;
+
+    if( size == 0 ) {
+        return 0;
+    }
+    buffer = malloc( size );
+    if( buffer == NULL ) {
+        return 0;
+    }
+    if( param_table_serialize( buffer, size, param, type ) == size ) {
+        fp = fopen( path, "wb" );
+        if( fp != NULL ) {
+            result = ( fwrite( buffer, 1, size, fp ) == size );
+            result &= ( fclose( fp ) == 0 );
+        }
+    }
+    free( buffer );
+    return result;
+}
+
+/**
+ * Maps a table file read-only (shared via the page cache), validates it, and
+ * attaches it as pre-computed table of the base point. A table file attached
+ * before is unmapped.
+ * @param param elliptic curve parameters (loaded by param_load)
+ * @param path the table file written by param_write_table_file
+ * @param constant_time if 1, the constant-time multiplication is selected (see param_table_attach)
+ * @return 1 if the table was attached, 0 otherwise (param is unchanged)
+ */
+int param_attach_table_mmap( eccp_parameters_t *param, const char *path, const int constant_time ) {
+    struct stat file_stat;
+    void *data;
+    int fd = open( path, O_RDONLY );
+
+    if( fd < 0 ) {
+        return 0;
+    }
+    if( ( fstat( fd, &file_stat ) != 0 ) || ( file_stat.st_size < (off_t)sizeof( param_table_header_t ) ) ) {
+        close( fd );
+        return 0;
+    }
+    data = mmap( NULL, (size_t)file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+    close( fd );
+    if( data == MAP_FAILED ) {
+        return 0;
+    }
+    if( param_table_attach( param, (const uint8_t *)data, (size_t)file_stat.st_size, constant_time ) == 0 ) {
+        munmap( data, (size_t)file_stat.st_size );
+        return 0;
+    }
+
+    // the previous table has been replaced, so its mapping is no longer used
+    if( param->base_point_table_mapping != NULL ) {
+        munmap( param->base_point_table_mapping, param->base_point_table_mapping_length );
+    }
+    param->base_point_table_mapping = data;
+    param->base_point_table_mapping_length = (size_t)file_stat.st_size;
+    return 1;
+}
+
+/**
+ * Unmaps the table file attached by param_attach_table_mmap. If the mapped
+ * table is still the pre-computed table of the base point, it is removed
+ * from param; a table attached afterwards (e.g., by a *_precompute function)
+ * is kept. Does nothing if no table file is mapped.
+ * @param param elliptic curve parameters
+ */
+void param_detach_table_mmap( eccp_parameters_t *param ) {
+    const uint8_t *data = (const uint8_t *)param->base_point_table_mapping;
+
+    if( data == NULL ) {
+        return;
+    }
+    if( (const uint8_t *)param->base_point_precomputed_table == data + sizeof( param_table_header_t ) ) {
+        param->base_point_precomputed_table = NULL;
+        param->base_point_precomputed_table_width = 0;
+        param->base_point_precomputed_table_blocks = 1;
+        param->eccp_mul_base_point = NULL;
+    }
+    munmap( param->base_point_table_mapping, param->base_point_table_mapping_length );
+    param->base_point_table_mapping = NULL;
+    param->base_point_table_mapping_length = 0;
+}
+
+#endif
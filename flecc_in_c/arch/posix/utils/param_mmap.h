@@ -0,0 +1,48 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+#ifndef PARAM_MMAP_H_
+#define PARAM_MMAP_H_
+
+#include "../../../types.h"
+#include "../../../utils/param_table.h"
+
+int param_write_table_file( const char *path, const eccp_parameters_t *param, const param_table_type_t type );
+int param_attach_table_mmap( eccp_parameters_t *param, const char *path, const int constant_time );
+void param_detach_table_mmap( eccp_parameters_t *param );
+
+#endif /* PARAM_MMAP_H_ */
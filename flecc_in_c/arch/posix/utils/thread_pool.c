@@ -0,0 +1,414 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#include "thread_pool.h"
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+#include <stdlib.h>
+#include "../../../gfp/gfp.h"
+#include "../../../utils/rand.h"
+#include "../../../protocols/protocols.h"
+
+/**
+ * Takes a task from the head of the own queue.
+ * @param worker the owner of the queue
+ * @param task the taken task
+ * @return 1 if a task was taken, 0 if the queue is empty
+ */
+static int flecc_worker_pop( flecc_worker_t *worker, flecc_task_t *task ) {
+    int taken = 0;
+
+    pthread_mutex_lock( &worker->lock );
+    if( worker->size > 0 ) {
+        *task = worker->queue[worker->head];
+        worker->head = ( worker->head + 1 ) % FLECC_POOL_QUEUE_SIZE;
+        worker->size--;
+        taken = 1;
+    }
+    pthread_mutex_unlock( &worker->lock );
+    return taken;
+}
+
+/**
+ * Takes a task from the tail of the queue of another worker.
+ * @param victim the worker to steal from
+ * @param task the stolen task
+ * @return 1 if a task was stolen, 0 if the queue is empty
+ */
+static int flecc_worker_steal( flecc_worker_t *victim, flecc_task_t *task ) {
+    int taken = 0;
+
+    pthread_mutex_lock( &victim->lock );
+    if( victim->size > 0 ) {
+        victim->size--;
+        *task = victim->queue[( victim->head + victim->size ) % FLECC_POOL_QUEUE_SIZE];
+        taken = 1;
+    }
+    pthread_mutex_unlock( &victim->lock );
+    return taken;
+}
+
+/**
+ * Appends a task to the tail of a queue.
+ * @param worker the owner of the queue
+ * @param task the task
+ * @return 1 if the task was queued, 0 if the queue is full
+ */
+static int flecc_worker_push( flecc_worker_t *worker, const flecc_task_t *task ) {
+    int queued = 0;
+
+    pthread_mutex_lock( &worker->lock );
+    if( worker->size < FLECC_POOL_QUEUE_SIZE ) {
+        worker->queue[( worker->head + worker->size ) % FLECC_POOL_QUEUE_SIZE] = *task;
+        worker->size++;
+        queued = 1;
+    }
+    pthread_mutex_unlock( &worker->lock );
+    return queued;
+}
+
+/**
+ * Takes a task from the own queue (index) or steals one from the other queues.
+ * @param pool the thread pool
+ * @param index the own queue (the search starts at this queue)
+ * @param task the taken task
+ * @return 1 if a task of the own queue was taken, 2 if a task was stolen, 0 if all queues are empty
+ */
+static int flecc_pool_take( flecc_pool_t *pool, const int index, flecc_task_t *task ) {
+    int i, taken = 0;
+
+    if( flecc_worker_pop( &pool->workers[index], task ) == 1 ) {
+        taken = 1;
+    }
+    for( i = 1; ( i < pool->queue_count ) && ( taken == 0 ); i++ ) {
+        if( flecc_worker_steal( &pool->workers[( index + i ) % pool->queue_count], task ) == 1 ) {
+            taken = 2;
+        }
+    }
+    if( taken != 0 ) {
+        pthread_mutex_lock( &pool->lock );
+        pool->queued--;
+        pthread_mutex_unlock( &pool->lock );
+    }
+    return taken;
+}
+
+/**
+ * Initializes a per-thread scratch context.
+ * @param scratch the scratch context
+ */
+static void flecc_scratch_init( flecc_scratch_t *scratch ) {
+    ecdsa_nonce_pool_init( &scratch->nonce_pool, scratch->nonces, FLECC_WORKER_NONCES, 0 );
+    scratch->nonce_param = NULL;
+}
+
+/**
+ * Refills the nonces of the scratch context for the sign jobs at the
+ * beginning of a task, so that their inversions are shared.
+ * @param scratch the scratch context
+ * @param task the task to be executed
+ */
+static void flecc_scratch_prepare( flecc_scratch_t *scratch, const flecc_task_t *task ) {
+    const eccp_parameters_t *param = NULL;
+    int i, signs = 0;
+
+    for( i = 0; i < task->count; i++ ) {
+        if( task->jobs[i].type == FLECC_JOB_SIGN ) {
+            if( ( param != NULL ) && ( param != task->jobs[i].param ) ) {
+                return;
+            }
+            param = task->jobs[i].param;
+            signs++;
+        }
+    }
+    if( signs == 0 ) {
+        return;
+    }
+    if( scratch->nonce_param != param ) {
+        // nonces of other parameters are useless (and must not be used)
+        ecdsa_nonce_pool_init( &scratch->nonce_pool, scratch->nonces, FLECC_WORKER_NONCES, 0 );
+        scratch->nonce_param = param;
+    }
+    if( (int)scratch->nonce_pool.count < signs ) {
+        ecdsa_nonce_pool_refill( &scratch->nonce_pool, signs - scratch->nonce_pool.count, param );
+    }
+}
+
+/**
+ * Executes a single job.
+ * @param job the job
+ * @param scratch the scratch context of the executing thread
+ */
+static void flecc_job_execute( flecc_job_t *job, flecc_scratch_t *scratch ) {
+    const eccp_parameters_t *param = job->param;
+
+    job->result = 1;
+    switch( job->type ) {
+    case FLECC_JOB_SIGN:
+        if( scratch->nonce_param != param ) {
+            ecdsa_sign( job->signature, job->hash, job->private_key, param );
+        } else {
+            ecdsa_sign_with_pool( job->signature, job->hash, job->private_key, &scratch->nonce_pool, param );
+        }
+        break;
+    case FLECC_JOB_VERIFY:
+        job->result = ecdsa_is_valid( job->signature, job->hash, job->public_key, param );
+        break;
+    case FLECC_JOB_KEYGEN:
+        gfp_rand( job->private_key, &param->order_n_data );
+        ecdh_phase_one( job->point, job->private_key, param );
+        break;
+    case FLECC_JOB_ECDH:
+        job->result = ecdh_phase_two_batch( job->point, job->private_key, job->public_key, 1, param );
+        break;
+    }
+}
+
+/**
+ * Executes all jobs of a task and signals the batch once it is completed.
+ * @param task the task
+ * @param scratch the scratch context of the executing thread
+ */
+static void flecc_task_execute( const flecc_task_t *task, flecc_scratch_t *scratch ) {
+    int i;
+
+    flecc_scratch_prepare( scratch, task );
+    for( i = 0; i < task->count; i++ ) {
+        flecc_job_execute( &task->jobs[i], scratch );
+    }
+
+    pthread_mutex_lock( &task->batch->lock );
+    task->batch->remaining -= task->count;
+    if( task->batch->remaining == 0 ) {
+        pthread_cond_broadcast( &task->batch->done );
+    }
+    pthread_mutex_unlock( &task->batch->lock );
+}
+
+/**
+ * The main loop of a worker thread: executes own and stolen tasks and
+ * sleeps while all queues are empty.
+ * @param argument the flecc_worker_t of the thread
+ * @return NULL
+ */
+static void *flecc_worker_run( void *argument ) {
+    flecc_worker_t *worker = (flecc_worker_t *)argument;
+    flecc_pool_t *pool = worker->pool;
+    int index = (int)( worker - pool->workers );
+    flecc_task_t task;
+
+    int taken;
+
+    while( 1 ) {
+        taken = flecc_pool_take( pool, index, &task );
+        if( taken != 0 ) {
+            flecc_task_execute( &task, &worker->scratch );
+            worker->executed++;
+            if( taken == 2 ) {
+                worker->stolen++;
+            }
+            continue;
+        }
+        pthread_mutex_lock( &pool->lock );
+        while( ( pool->queued == 0 ) && ( pool->shutdown == 0 ) ) {
+            pthread_cond_wait( &pool->work_available, &pool->lock );
+        }
+        if( ( pool->queued == 0 ) && ( pool->shutdown == 1 ) ) {
+            pthread_mutex_unlock( &pool->lock );
+            return NULL;
+        }
+        pthread_mutex_unlock( &pool->lock );
+    }
+}
+
+/**
+ * Starts a work-stealing thread pool. Each worker has its own queue and
+ * steals tasks from the other queues when its queue is empty. Without
+ * threads, the jobs are executed by flecc_batch_wait.
+ * @param pool the thread pool
+ * @param thread_count the number of worker threads (0 or more)
+ * @return 1 on success, 0 otherwise
+ */
+int flecc_pool_init( flecc_pool_t *pool, const int thread_count ) {
+    int i;
+
+    pool->thread_count = 0;
+    pool->queue_count = ( thread_count > 0 ) ? thread_count : 1;
+    pool->queued = 0;
+    pool->shutdown = 0;
+    pool->next_queue = 0;
+    pool->workers = malloc( sizeof( flecc_worker_t ) * pool->queue_count );
+    if( pool->workers == NULL ) {
+        return 0;
+    }
+    pthread_mutex_init( &pool->lock, NULL );
+    pthread_cond_init( &pool->work_available, NULL );
+    for( i = 0; i < pool->queue_count; i++ ) {
+        pool->workers[i].pool = pool;
+        pthread_mutex_init( &pool->workers[i].lock, NULL );
+        pool->workers[i].head = 0;
+        pool->workers[i].size = 0;
+        pool->workers[i].executed = 0;
+        pool->workers[i].stolen = 0;
+        flecc_scratch_init( &pool->workers[i].scratch );
+    }
+    for( i = 0; i < thread_count; i++ ) {
+        if( pthread_create( &pool->workers[i].thread, NULL, flecc_worker_run, &pool->workers[i] ) != 0 ) {
+            flecc_pool_destroy( pool );
+            return 0;
+        }
+        pool->thread_count++;
+    }
+    return 1;
+}
+
+/**
+ * Stops the worker threads (after the queued tasks are executed) and frees the pool.
+ * @param pool the thread pool
+ */
+void flecc_pool_destroy( flecc_pool_t *pool ) {
+    int i;
+
+    pthread_mutex_lock( &pool->lock );
+    pool->shutdown = 1;
+    pthread_cond_broadcast( &pool->work_available );
+    pthread_mutex_unlock( &pool->lock );
+
+    for( i = 0; i < pool->thread_count; i++ ) {
+        pthread_join( pool->workers[i].thread, NULL );
+    }
+    for( i = 0; i < pool->queue_count; i++ ) {
+        pthread_mutex_destroy( &pool->workers[i].lock );
+    }
+    pthread_cond_destroy( &pool->work_available );
+    pthread_mutex_destroy( &pool->lock );
+    free( pool->workers );
+    pool->workers = NULL;
+    pool->thread_count = 0;
+}
+
+/**
+ * Initializes an (empty) batch.
+ * @param batch the batch
+ */
+void flecc_batch_init( flecc_batch_t *batch ) {
+    pthread_mutex_init( &batch->lock, NULL );
+    pthread_cond_init( &batch->done, NULL );
+    batch->remaining = 0;
+}
+
+/**
+ * Submits jobs to the thread pool. The jobs are split into tasks of up to
+ * FLECC_BATCH_TASK_JOBS jobs, which are distributed round-robin over the
+ * queues of the workers. If all queues are full, the task is executed by
+ * the calling thread. The jobs must not be accessed before flecc_batch_wait.
+ * @param pool the thread pool
+ * @param batch the batch the jobs belong to (see flecc_batch_init)
+ * @param jobs the jobs
+ * @param count the number of jobs
+ */
+void flecc_batch_submit( flecc_pool_t *pool, flecc_batch_t *batch, flecc_job_t *jobs, const int count ) {
+    flecc_scratch_t scratch;
+    flecc_task_t task;
+    int offset, i, index, queued;
+
+    pthread_mutex_lock( &batch->lock );
+    batch->remaining += count;
+    pthread_mutex_unlock( &batch->lock );
+
+    flecc_scratch_init( &scratch );
+    task.batch = batch;
+    for( offset = 0; offset < count; offset += task.count ) {
+        task.jobs = jobs + offset;
+        task.count = ( count - offset < FLECC_BATCH_TASK_JOBS ) ? count - offset : FLECC_BATCH_TASK_JOBS;
+
+        pthread_mutex_lock( &pool->lock );
+        index = pool->next_queue;
+        pool->next_queue = ( index + 1 ) % pool->queue_count;
+        pthread_mutex_unlock( &pool->lock );
+
+        queued = 0;
+        for( i = 0; ( i < pool->queue_count ) && ( queued == 0 ); i++ ) {
+            queued = flecc_worker_push( &pool->workers[( index + i ) % pool->queue_count], &task );
+        }
+        if( queued == 1 ) {
+            pthread_mutex_lock( &pool->lock );
+            pool->queued++;
+            pthread_cond_signal( &pool->work_available );
+            pthread_mutex_unlock( &pool->lock );
+        } else {
+            flecc_task_execute( &task, &scratch );
+        }
+    }
+}
+
+/**
+ * Waits until all jobs of the batch are completed. The calling thread
+ * executes queued tasks (of any batch) while it waits.
+ * @param pool the thread pool
+ * @param batch the batch
+ */
+void flecc_batch_wait( flecc_pool_t *pool, flecc_batch_t *batch ) {
+    flecc_scratch_t scratch;
+    flecc_task_t task;
+    int remaining;
+
+    flecc_scratch_init( &scratch );
+    while( 1 ) {
+        pthread_mutex_lock( &batch->lock );
+        remaining = batch->remaining;
+        pthread_mutex_unlock( &batch->lock );
+        if( remaining == 0 ) {
+            return;
+        }
+        if( flecc_pool_take( pool, 0, &task ) == 0 ) {
+            break;
+        }
+        flecc_task_execute( &task, &scratch );
+    }
+
+    // the remaining tasks are executed by the workers
+    pthread_mutex_lock( &batch->lock );
+    while( batch->remaining > 0 ) {
+        pthread_cond_wait( &batch->done, &batch->lock );
+    }
+    pthread_mutex_unlock( &batch->lock );
+}
+
+#endif
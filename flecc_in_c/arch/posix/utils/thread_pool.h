@@ -0,0 +1,155 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+#include "../../../types.h"
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+#include <pthread.h>
+
+/** the number of jobs a submitted batch is split into per task (the unit of work stealing) */
+#define FLECC_BATCH_TASK_JOBS 4
+/** the maximum number of queued tasks per worker */
+#define FLECC_POOL_QUEUE_SIZE 256
+/** the number of nonces of the per-worker nonce pool used by FLECC_JOB_SIGN */
+#define FLECC_WORKER_NONCES 16
+
+/** the operation of a flecc_job_t */
+typedef enum _flecc_job_type_t_ {
+    /** ECDSA signature of hash with private_key (ecdsa_sign_with_pool) into signature */
+    FLECC_JOB_SIGN,
+    /** ECDSA verification of signature of hash with public_key; result is 1 if valid */
+    FLECC_JOB_VERIFY,
+    /** generates private_key and the corresponding point (not in Montgomery domain) */
+    FLECC_JOB_KEYGEN,
+    /** ECDH of private_key with public_key into point; result is 1 if public_key is valid */
+    FLECC_JOB_ECDH
+} flecc_job_type_t;
+
+/** A job executed by the thread pool. Unused fields of the job type may be NULL. */
+typedef struct _flecc_job_t_ {
+    /** the operation */
+    flecc_job_type_t type;
+    /** elliptic curve parameters (shared read-only between threads) */
+    const eccp_parameters_t *param;
+    /** the private key (written by FLECC_JOB_KEYGEN) */
+    uint_t *private_key;
+    /** the hash of the message (sign, verify) */
+    const uint_t *hash;
+    /** the public key of the signer (verify) or of the other party (ECDH), not in Montgomery domain */
+    const eccp_point_affine_t *public_key;
+    /** the signature (written by sign, read by verify) */
+    ecdsa_signature_t *signature;
+    /** the resulting point (keygen, ECDH) */
+    eccp_point_affine_t *point;
+    /** the result of verify and ECDH, 1 otherwise */
+    int result;
+} flecc_job_t;
+
+/** A set of jobs submitted with flecc_batch_submit and waited for with flecc_batch_wait */
+typedef struct _flecc_batch_t_ {
+    pthread_mutex_t lock;
+    pthread_cond_t done;
+    /** the number of submitted jobs not completed yet */
+    int remaining;
+} flecc_batch_t;
+
+/** A contiguous range of jobs of one batch */
+typedef struct _flecc_task_t_ {
+    flecc_job_t *jobs;
+    int count;
+    flecc_batch_t *batch;
+} flecc_task_t;
+
+/** Per-thread scratch context: nonce pool of the sign jobs */
+typedef struct _flecc_scratch_t_ {
+    ecdsa_nonce_pool_t nonce_pool;
+    ecdsa_nonce_t nonces[FLECC_WORKER_NONCES];
+    /** the parameters the nonces were generated for */
+    const eccp_parameters_t *nonce_param;
+} flecc_scratch_t;
+
+struct _flecc_pool_t_;
+
+/** A worker thread with its own task queue (deque) */
+typedef struct _flecc_worker_t_ {
+    pthread_t thread;
+    struct _flecc_pool_t_ *pool;
+    /** protects the queue */
+    pthread_mutex_t lock;
+    /** ring buffer of tasks; the owner takes from the head, thieves from the tail */
+    flecc_task_t queue[FLECC_POOL_QUEUE_SIZE];
+    int head;
+    int size;
+    flecc_scratch_t scratch;
+    /** statistics: the number of executed tasks */
+    uint_t executed;
+    /** statistics: the number of tasks stolen from other workers */
+    uint_t stolen;
+} flecc_worker_t;
+
+/** Work-stealing thread pool (see flecc_pool_init) */
+typedef struct _flecc_pool_t_ {
+    /** the workers (at least one queue even without threads) */
+    flecc_worker_t *workers;
+    /** the number of worker threads */
+    int thread_count;
+    /** the number of queues (max(thread_count, 1)) */
+    int queue_count;
+    /** protects queued, shutdown, and next_queue, signals work_available */
+    pthread_mutex_t lock;
+    pthread_cond_t work_available;
+    /** the number of queued tasks of all workers */
+    int queued;
+    int shutdown;
+    /** the queue the next submitted task is put into */
+    int next_queue;
+} flecc_pool_t;
+
+int flecc_pool_init( flecc_pool_t *pool, const int thread_count );
+void flecc_pool_destroy( flecc_pool_t *pool );
+void flecc_batch_init( flecc_batch_t *batch );
+void flecc_batch_submit( flecc_pool_t *pool, flecc_batch_t *batch, flecc_job_t *jobs, const int count );
+void flecc_batch_wait( flecc_pool_t *pool, flecc_batch_t *batch );
+
+#endif
+
+#endif /* THREAD_POOL_H_ */
@@ -0,0 +1,301 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#include "verify_queue.h"
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../../../bi/bi.h"
+#include "../../../protocols/ecdsa.h"
+
+/**
+ * @return the time of the monotonic clock in nanoseconds
+ */
+static ulong_t flecc_verify_now( void ) {
+    struct timespec now;
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    return (ulong_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+/**
+ * Waits on the submitted condition of the queue until the given point in
+ * time of the monotonic clock (or a signal).
+ * @param queue the queue (locked)
+ * @param until the time to wait for in nanoseconds (monotonic clock)
+ */
+static void flecc_verify_wait_until( flecc_verify_queue_t *queue, const ulong_t until ) {
+    struct timespec absolute;
+    ulong_t now = flecc_verify_now();
+    ulong_t wait;
+
+    if( until <= now ) {
+        return;
+    }
+    // the condition uses the realtime clock
+    wait = until - now;
+    clock_gettime( CLOCK_REALTIME, &absolute );
+    wait += absolute.tv_nsec;
+    absolute.tv_sec += wait / 1000000000;
+    absolute.tv_nsec = wait % 1000000000;
+    pthread_cond_timedwait( &queue->submitted, &queue->lock, &absolute );
+}
+
+/**
+ * The verification thread: waits until max_batch requests are pending or
+ * the oldest pending request reaches the deadline, verifies the batch with
+ * ecdsa_is_valid_batch, and completes the requests.
+ * @param argument the flecc_verify_queue_t
+ * @return NULL
+ */
+static void *flecc_verify_run( void *argument ) {
+    flecc_verify_queue_t *queue = (flecc_verify_queue_t *)argument;
+    flecc_verify_request_t *requests[FLECC_VERIFY_MAX_BATCH];
+    ecdsa_signature_t signatures[FLECC_VERIFY_MAX_BATCH];
+    gfp_t hashes[FLECC_VERIFY_MAX_BATCH];
+    eccp_point_affine_t public_keys[FLECC_VERIFY_MAX_BATCH];
+    int results[FLECC_VERIFY_MAX_BATCH];
+    flecc_verify_callback_t callbacks[FLECC_VERIFY_MAX_BATCH];
+    void *contexts[FLECC_VERIFY_MAX_BATCH];
+    int count, i;
+    ulong_t now;
+
+    pthread_mutex_lock( &queue->lock );
+    while( 1 ) {
+        while( ( queue->pending == 0 ) && ( queue->shutdown == 0 ) ) {
+            pthread_cond_wait( &queue->submitted, &queue->lock );
+        }
+        if( queue->pending == 0 ) {
+            break;
+        }
+        while( ( queue->pending < queue->max_batch ) && ( queue->shutdown == 0 )
+               && ( flecc_verify_now() < queue->head->submitted + queue->deadline ) ) {
+            flecc_verify_wait_until( queue, queue->head->submitted + queue->deadline );
+        }
+
+        for( count = 0; ( count < queue->max_batch ) && ( queue->head != NULL ); count++ ) {
+            requests[count] = queue->head;
+            queue->head = queue->head->next;
+        }
+        if( queue->head == NULL ) {
+            queue->tail = NULL;
+        }
+        queue->pending -= count;
+        pthread_mutex_unlock( &queue->lock );
+
+        for( i = 0; i < count; i++ ) {
+            signatures[i] = *requests[i]->signature;
+            bigint_copy_var( hashes[i], requests[i]->hash, queue->param->order_n_data.words );
+            public_keys[i] = *requests[i]->public_key;
+        }
+        ecdsa_is_valid_batch( results, signatures, (const gfp_t *)hashes, public_keys, count, queue->param );
+        now = flecc_verify_now();
+
+        // the requests are completed before any callback runs, a callback may free its request
+        pthread_mutex_lock( &queue->lock );
+        for( i = 0; i < count; i++ ) {
+            callbacks[i] = requests[i]->callback;
+            contexts[i] = requests[i]->context;
+            requests[i]->result = results[i];
+            queue->latencies[queue->requests % FLECC_VERIFY_LATENCY_SAMPLES] = now - requests[i]->submitted;
+            queue->requests++;
+            requests[i]->done = 1;
+        }
+        queue->batches++;
+        queue->last_completion = now;
+        pthread_cond_broadcast( &queue->completed );
+        pthread_mutex_unlock( &queue->lock );
+
+        for( i = 0; i < count; i++ ) {
+            if( callbacks[i] != NULL ) {
+                callbacks[i]( requests[i], contexts[i] );
+            }
+        }
+        pthread_mutex_lock( &queue->lock );
+    }
+    pthread_mutex_unlock( &queue->lock );
+    return NULL;
+}
+
+/**
+ * Starts a verification queue that coalesces single verifications of many
+ * threads into batches of up to max_batch requests. A batch is verified
+ * once it is full or its oldest request waited deadline_us microseconds.
+ * @param queue the queue
+ * @param param elliptic curve parameters of all requests (shared read-only)
+ * @param max_batch the maximum number of requests per batch (at most FLECC_VERIFY_MAX_BATCH)
+ * @param deadline_us the maximum time a request waits for further requests in microseconds
+ * @return 1 on success, 0 otherwise
+ */
+int flecc_verify_queue_init( flecc_verify_queue_t *queue, const eccp_parameters_t *param, const int max_batch, const int deadline_us ) {
+    if( ( max_batch < 1 ) || ( max_batch > FLECC_VERIFY_MAX_BATCH ) ) {
+        return 0;
+    }
+    queue->param = param;
+    queue->max_batch = max_batch;
+    queue->deadline = (ulong_t)deadline_us * 1000;
+    queue->head = NULL;
+    queue->tail = NULL;
+    queue->pending = 0;
+    queue->shutdown = 0;
+    queue->requests = 0;
+    queue->batches = 0;
+    queue->first_submission = 0;
+    queue->last_completion = 0;
+    pthread_mutex_init( &queue->lock, NULL );
+    pthread_cond_init( &queue->submitted, NULL );
+    pthread_cond_init( &queue->completed, NULL );
+    if( pthread_create( &queue->thread, NULL, flecc_verify_run, queue ) != 0 ) {
+        pthread_cond_destroy( &queue->completed );
+        pthread_cond_destroy( &queue->submitted );
+        pthread_mutex_destroy( &queue->lock );
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * Verifies the pending requests and stops the verification thread.
+ * @param queue the queue
+ */
+void flecc_verify_queue_destroy( flecc_verify_queue_t *queue ) {
+    pthread_mutex_lock( &queue->lock );
+    queue->shutdown = 1;
+    pthread_cond_signal( &queue->submitted );
+    pthread_mutex_unlock( &queue->lock );
+
+    pthread_join( queue->thread, NULL );
+    pthread_cond_destroy( &queue->completed );
+    pthread_cond_destroy( &queue->submitted );
+    pthread_mutex_destroy( &queue->lock );
+}
+
+/**
+ * Submits a single verification. The request (and the data it points to)
+ * must stay valid until it is completed (see flecc_verify_wait). If a callback
+ * is set, the request is completed before the callback is called and the queue
+ * does not touch the request afterwards, so the callback may free it (it must
+ * then not be freed elsewhere).
+ * @param queue the queue
+ * @param request the request (signature, hash, public_key, and optionally callback and context set)
+ */
+void flecc_verify_submit( flecc_verify_queue_t *queue, flecc_verify_request_t *request ) {
+    request->done = 0;
+    request->next = NULL;
+
+    pthread_mutex_lock( &queue->lock );
+    request->submitted = flecc_verify_now();
+    if( queue->first_submission == 0 ) {
+        queue->first_submission = request->submitted;
+    }
+    if( queue->tail == NULL ) {
+        queue->head = request;
+    } else {
+        queue->tail->next = request;
+    }
+    queue->tail = request;
+    queue->pending++;
+    // the verification thread only needs to wake up for the first or the completing request
+    if( ( queue->pending == 1 ) || ( queue->pending >= queue->max_batch ) ) {
+        pthread_cond_signal( &queue->submitted );
+    }
+    pthread_mutex_unlock( &queue->lock );
+}
+
+/**
+ * Waits until a request is completed.
+ * @param queue the queue
+ * @param request the submitted request
+ * @return 1 if the signature is valid, 0 otherwise
+ */
+int flecc_verify_wait( flecc_verify_queue_t *queue, flecc_verify_request_t *request ) {
+    pthread_mutex_lock( &queue->lock );
+    while( request->done == 0 ) {
+        pthread_cond_wait( &queue->completed, &queue->lock );
+    }
+    pthread_mutex_unlock( &queue->lock );
+    return request->result;
+}
+
+/**
+ * Compares two latencies (for qsort).
+ */
+static int flecc_verify_compare_latencies( const void *a, const void *b ) {
+    ulong_t x = *(const ulong_t *)a, y = *(const ulong_t *)b;
+    return ( x > y ) - ( x < y );
+}
+
+/**
+ * Computes the statistics of the completed requests. The latency
+ * percentiles consider the latest FLECC_VERIFY_LATENCY_SAMPLES requests.
+ * @param queue the queue
+ * @param stats the resulting statistics
+ */
+void flecc_verify_queue_stats( flecc_verify_queue_t *queue, flecc_verify_stats_t *stats ) {
+    static const flecc_verify_stats_t empty = { 0, 0, 0.0, 0.0, 0.0, 0.0 };
+    ulong_t *sorted;
+    int samples;
+
+    *stats = empty;
+    pthread_mutex_lock( &queue->lock );
+    stats->requests = queue->requests;
+    stats->batches = queue->batches;
+    samples = ( queue->requests < FLECC_VERIFY_LATENCY_SAMPLES ) ? (int)queue->requests : FLECC_VERIFY_LATENCY_SAMPLES;
+    sorted = malloc( sizeof( ulong_t ) * ( samples + 1 ) );
+    if( sorted != NULL ) {
+        memcpy( sorted, queue->latencies, sizeof( ulong_t ) * samples );
+    }
+    if( queue->last_completion > queue->first_submission ) {
+        stats->throughput = queue->requests * 1e9 / ( queue->last_completion - queue->first_submission );
+    }
+    pthread_mutex_unlock( &queue->lock );
+
+    if( stats->batches > 0 ) {
+        stats->average_batch_size = (double)stats->requests / stats->batches;
+    }
+    if( ( sorted != NULL ) && ( samples > 0 ) ) {
+        qsort( sorted, samples, sizeof( ulong_t ), flecc_verify_compare_latencies );
+        stats->p50_latency_us = sorted[samples / 2] * 1e-3;
+        stats->p99_latency_us = sorted[( samples * 99 ) / 100] * 1e-3;
+    }
+    free( sorted );
+}
+
+#endif
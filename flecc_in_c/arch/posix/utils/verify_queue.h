@@ -0,0 +1,132 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#ifndef VERIFY_QUEUE_H_
+#define VERIFY_QUEUE_H_
+
+#include "../../../types.h"
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+#include <pthread.h>
+
+/** the maximum number of requests verified together */
+#define FLECC_VERIFY_MAX_BATCH 64
+/** the number of latencies kept for flecc_verify_queue_stats */
+#define FLECC_VERIFY_LATENCY_SAMPLES 4096
+
+struct _flecc_verify_request_t_;
+/** function called by the verification thread once a request is completed (may free the request) */
+typedef void ( *flecc_verify_callback_t )( struct _flecc_verify_request_t_ *request, void *context );
+
+/** A single verification submitted with flecc_verify_submit */
+typedef struct _flecc_verify_request_t_ {
+    /** the signature to verify */
+    const ecdsa_signature_t *signature;
+    /** the hash of the message (smaller than param->order_n_data.prime) */
+    const uint_t *hash;
+    /** the public key (not in Montgomery domain) */
+    const eccp_point_affine_t *public_key;
+    /** called when the request is completed (optional, may be NULL) */
+    flecc_verify_callback_t callback;
+    /** passed to callback */
+    void *context;
+    /** 1 if the signature is valid, 0 otherwise (set on completion) */
+    int result;
+    /** set to 1 on completion (before callback is called) */
+    int done;
+    /** the time of the submission in nanoseconds */
+    ulong_t submitted;
+    /** the next pending request */
+    struct _flecc_verify_request_t_ *next;
+} flecc_verify_request_t;
+
+/** Statistics of a verification queue (see flecc_verify_queue_stats) */
+typedef struct _flecc_verify_stats_t_ {
+    /** the number of completed requests */
+    uint_t requests;
+    /** the number of verified batches */
+    uint_t batches;
+    /** the average number of requests per batch */
+    double average_batch_size;
+    /** the median latency (submission to completion) of the recent requests in microseconds */
+    double p50_latency_us;
+    /** the 99th percentile latency of the recent requests in microseconds */
+    double p99_latency_us;
+    /** completed requests per second between the first submission and the last completion */
+    double throughput;
+} flecc_verify_stats_t;
+
+/** Coalesces single verifications of many threads into batches (see flecc_verify_queue_init) */
+typedef struct _flecc_verify_queue_t_ {
+    /** elliptic curve parameters of all requests */
+    const eccp_parameters_t *param;
+    /** a batch is verified once it has this many requests ... */
+    int max_batch;
+    /** ... or its oldest request waited this long (in nanoseconds) */
+    ulong_t deadline;
+    pthread_t thread;
+    /** protects all following fields and the done flags of the requests */
+    pthread_mutex_t lock;
+    /** signaled on submission and shutdown */
+    pthread_cond_t submitted;
+    /** signaled when requests are completed */
+    pthread_cond_t completed;
+    /** the pending requests (oldest first) */
+    flecc_verify_request_t *head;
+    flecc_verify_request_t *tail;
+    int pending;
+    int shutdown;
+    /** statistics */
+    uint_t requests;
+    uint_t batches;
+    ulong_t first_submission;
+    ulong_t last_completion;
+    /** ring buffer of the latest latencies in nanoseconds */
+    ulong_t latencies[FLECC_VERIFY_LATENCY_SAMPLES];
+} flecc_verify_queue_t;
+
+int flecc_verify_queue_init( flecc_verify_queue_t *queue, const eccp_parameters_t *param, const int max_batch, const int deadline_us );
+void flecc_verify_queue_destroy( flecc_verify_queue_t *queue );
+void flecc_verify_submit( flecc_verify_queue_t *queue, flecc_verify_request_t *request );
+int flecc_verify_wait( flecc_verify_queue_t *queue, flecc_verify_request_t *request );
+void flecc_verify_queue_stats( flecc_verify_queue_t *queue, flecc_verify_stats_t *stats );
+
+#endif
+
+#endif /* VERIFY_QUEUE_H_ */
@@ -0,0 +1,380 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+#include "sha256_mb.h"
+
+#if HASH_SHA256_MB_AVAILABLE
+
+#include <cpuid.h>
+#include <immintrin.h>
+#include <stdlib.h>
+
+#define SHA256_MB_SSE2_TARGET __attribute__( ( target( "sse2" ) ) )
+#define SHA256_MB_AVX2_TARGET __attribute__( ( target( "avx2" ) ) )
+
+/** the SHA-256 round constants (sha2.c) */
+extern const uint32_t K256[64];
+
+/** 8 if AVX2 is available, 4 with SSE2 only, 0 if disabled; set once when the library is loaded */
+static int hash_sha256_mb_lane_count = 0;
+
+/** the block hashed by unused lanes (the result is discarded) */
+static const uint8_t hash_sha256_mb_idle_block[64] = {0};
+
+/** the working state of one lane (see hash_sha256_mb_chunk) */
+typedef struct _hash_sha256_mb_lane_t_ {
+    /** the next complete block of the message */
+    const uint8_t *data;
+    /** the number of complete blocks left in data */
+    int data_blocks;
+    /** the number of padded blocks left in tail */
+    int tail_blocks;
+    /** the index of tail_blocks' next block in tail */
+    int tail_next;
+    /** the index of the message in the chunk, -1 if the lane is unused */
+    int index;
+    /** the remaining bytes of the message with the padding and the length (1 or 2 blocks) */
+    uint8_t tail[128];
+} hash_sha256_mb_lane_t;
+
+/**
+ * Selects the number of lanes: AVX2 needs the CPUID flag (leaf 7, EBX bit 5)
+ * and the YMM state enabled by the operating system (OSXSAVE, XCR0 bits 1
+ * and 2). Runs before main, so that the value is read-only for all threads.
+ */
+static void __attribute__( ( constructor ) ) hash_sha256_mb_detect( void ) {
+    unsigned int eax, ebx, ecx, edx;
+    const char *env = getenv( HASH_SHA256_MB_ENV );
+    int lanes = 0;
+
+    if( __get_cpuid( 1, &eax, &ebx, &ecx, &edx ) == 0 || ( ( edx >> 26 ) & 1 ) == 0 ) {
+        return;
+    }
+    lanes = 4;
+    if( ( ( ecx >> 27 ) & 1 ) == 1 ) {
+        __asm__ volatile( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+        if( ( eax & 6 ) == 6 && __get_cpuid_count( 7, 0, &eax, &ebx, &ecx, &edx ) != 0 && ( ( ebx >> 5 ) & 1 ) == 1 ) {
+            lanes = 8;
+        }
+    }
+    if( env != NULL && env[0] == '0' ) {
+        lanes = 0;
+    } else if( env != NULL && env[0] == '4' ) {
+        lanes = 4;
+    }
+    hash_sha256_mb_lane_count = lanes;
+}
+
+/**
+ * Returns the number of messages hashed in parallel by hash_sha256_mb.
+ * @return 8 (AVX2), 4 (SSE2), or 0 if the multi-buffer code must not be used
+ */
+int hash_sha256_mb_lanes( void ) {
+    return hash_sha256_mb_lane_count;
+}
+
+/* the vector operations of the SSE2 (4 lanes) and AVX2 (8 lanes) implementation */
+#define SSE2_ADD( x, y ) _mm_add_epi32( x, y )
+#define SSE2_XOR( x, y ) _mm_xor_si128( x, y )
+#define SSE2_AND( x, y ) _mm_and_si128( x, y )
+#define SSE2_ANDNOT( x, y ) _mm_andnot_si128( x, y )
+#define SSE2_OR( x, y ) _mm_or_si128( x, y )
+#define SSE2_SRL( x, n ) _mm_srli_epi32( x, n )
+#define SSE2_SLL( x, n ) _mm_slli_epi32( x, n )
+#define SSE2_SET1( x ) _mm_set1_epi32( (int)( x ) )
+#define SSE2_LOAD( p ) _mm_loadu_si128( (const __m128i *)( p ) )
+#define SSE2_STORE( p, x ) _mm_storeu_si128( (__m128i *)( p ), x )
+
+#define AVX2_ADD( x, y ) _mm256_add_epi32( x, y )
+#define AVX2_XOR( x, y ) _mm256_xor_si256( x, y )
+#define AVX2_AND( x, y ) _mm256_and_si256( x, y )
+#define AVX2_ANDNOT( x, y ) _mm256_andnot_si256( x, y )
+#define AVX2_OR( x, y ) _mm256_or_si256( x, y )
+#define AVX2_SRL( x, n ) _mm256_srli_epi32( x, n )
+#define AVX2_SLL( x, n ) _mm256_slli_epi32( x, n )
+#define AVX2_SET1( x ) _mm256_set1_epi32( (int)( x ) )
+#define AVX2_LOAD( p ) _mm256_loadu_si256( (const __m256i *)( p ) )
+#define AVX2_STORE( p, x ) _mm256_storeu_si256( (__m256i *)( p ), x )
+
+#define MB_OP( isa, op ) isa##_##op
+
+#define MB_ROTATE( isa, x, n ) MB_OP( isa, OR )( MB_OP( isa, SRL )( x, n ), MB_OP( isa, SLL )( x, 32 - ( n ) ) )
+#define MB_XOR3( isa, x, y, z ) MB_OP( isa, XOR )( MB_OP( isa, XOR )( x, y ), z )
+
+#define MB_Sigma0( isa, x ) MB_XOR3( isa, MB_ROTATE( isa, x, 2 ), MB_ROTATE( isa, x, 13 ), MB_ROTATE( isa, x, 22 ) )
+#define MB_Sigma1( isa, x ) MB_XOR3( isa, MB_ROTATE( isa, x, 6 ), MB_ROTATE( isa, x, 11 ), MB_ROTATE( isa, x, 25 ) )
+#define MB_sigma0( isa, x ) MB_XOR3( isa, MB_ROTATE( isa, x, 7 ), MB_ROTATE( isa, x, 18 ), MB_OP( isa, SRL )( x, 3 ) )
+#define MB_sigma1( isa, x ) MB_XOR3( isa, MB_ROTATE( isa, x, 17 ), MB_ROTATE( isa, x, 19 ), MB_OP( isa, SRL )( x, 10 ) )
+
+#define MB_Ch( isa, x, y, z ) MB_OP( isa, XOR )( MB_OP( isa, AND )( x, y ), MB_OP( isa, ANDNOT )( x, z ) )
+#define MB_Maj( isa, x, y, z ) MB_OP( isa, XOR )( MB_OP( isa, AND )( MB_OP( isa, XOR )( x, y ), MB_OP( isa, XOR )( y, z ) ), y )
+
+/* message schedule: w[i] of rounds 16 to 63 replaces w[i - 16] */
+#define SHA256_MB_EXPAND( isa, i )                                                                   \
+    ( w[( i ) & 0xf] = MB_OP( isa, ADD )( MB_OP( isa, ADD )( w[( i ) & 0xf], w[( ( i ) + 9 ) & 0xf] ), \
+                                          MB_OP( isa, ADD )( MB_sigma0( isa, w[( ( i ) + 1 ) & 0xf] ),  \
+                                                             MB_sigma1( isa, w[( ( i ) + 14 ) & 0xf] ) ) ) )
+
+/* one round of all lanes; instead of moving the working variables, the callers rotate the arguments */
+#define SHA256_MB_ROUND( isa, a, b, c, d, e, f, g, h, i, wi )                                                  \
+    do {                                                                                                     \
+        T1 = MB_OP( isa, ADD )( MB_OP( isa, ADD )( h, MB_Sigma1( isa, e ) ),                                 \
+                                MB_OP( isa, ADD )( MB_Ch( isa, e, f, g ), MB_OP( isa, ADD )( MB_OP( isa, SET1 )( K256[i] ), wi ) ) ); \
+        d = MB_OP( isa, ADD )( d, T1 );                                                                      \
+        h = MB_OP( isa, ADD )( T1, MB_OP( isa, ADD )( MB_Sigma0( isa, a ), MB_Maj( isa, a, b, c ) ) );       \
+    } while( 0 )
+
+/* eight rounds, after which the working variables are in their original positions */
+#define SHA256_MB_ROUNDS_8( isa, i, W )                                              \
+    do {                                                                             \
+        SHA256_MB_ROUND( isa, a, b, c, d, e, f, g, h, ( i ) + 0, W( isa, ( i ) + 0 ) ); \
+        SHA256_MB_ROUND( isa, h, a, b, c, d, e, f, g, ( i ) + 1, W( isa, ( i ) + 1 ) ); \
+        SHA256_MB_ROUND( isa, g, h, a, b, c, d, e, f, ( i ) + 2, W( isa, ( i ) + 2 ) ); \
+        SHA256_MB_ROUND( isa, f, g, h, a, b, c, d, e, ( i ) + 3, W( isa, ( i ) + 3 ) ); \
+        SHA256_MB_ROUND( isa, e, f, g, h, a, b, c, d, ( i ) + 4, W( isa, ( i ) + 4 ) ); \
+        SHA256_MB_ROUND( isa, d, e, f, g, h, a, b, c, ( i ) + 5, W( isa, ( i ) + 5 ) ); \
+        SHA256_MB_ROUND( isa, c, d, e, f, g, h, a, b, ( i ) + 6, W( isa, ( i ) + 6 ) ); \
+        SHA256_MB_ROUND( isa, b, c, d, e, f, g, h, a, ( i ) + 7, W( isa, ( i ) + 7 ) ); \
+    } while( 0 )
+
+#define SHA256_MB_W_LOAD( isa, i ) w[i]
+
+/* the whole compression function: state[j][lane] += rounds( state[j][lane], words[..][lane] ) */
+#define SHA256_MB_PROCESS_BLOCK( isa, vector_t )                        \
+    do {                                                                \
+        vector_t a, b, c, d, e, f, g, h, T1, w[16];                     \
+        int i;                                                          \
+                                                                        \
+        for( i = 0; i < 16; i++ ) {                                     \
+            w[i] = MB_OP( isa, LOAD )( words[i] );                      \
+        }                                                               \
+        a = MB_OP( isa, LOAD )( state[0] );                             \
+        b = MB_OP( isa, LOAD )( state[1] );                             \
+        c = MB_OP( isa, LOAD )( state[2] );                             \
+        d = MB_OP( isa, LOAD )( state[3] );                             \
+        e = MB_OP( isa, LOAD )( state[4] );                             \
+        f = MB_OP( isa, LOAD )( state[5] );                             \
+        g = MB_OP( isa, LOAD )( state[6] );                             \
+        h = MB_OP( isa, LOAD )( state[7] );                             \
+                                                                        \
+        SHA256_MB_ROUNDS_8( isa, 0, SHA256_MB_W_LOAD );                 \
+        SHA256_MB_ROUNDS_8( isa, 8, SHA256_MB_W_LOAD );                 \
+        for( i = 16; i < 64; i += 8 ) {                                 \
+            SHA256_MB_ROUNDS_8( isa, i, SHA256_MB_EXPAND );             \
+        }                                                               \
+                                                                        \
+        MB_OP( isa, STORE )( state[0], MB_OP( isa, ADD )( a, MB_OP( isa, LOAD )( state[0] ) ) ); \
+        MB_OP( isa, STORE )( state[1], MB_OP( isa, ADD )( b, MB_OP( isa, LOAD )( state[1] ) ) ); \
+        MB_OP( isa, STORE )( state[2], MB_OP( isa, ADD )( c, MB_OP( isa, LOAD )( state[2] ) ) ); \
+        MB_OP( isa, STORE )( state[3], MB_OP( isa, ADD )( d, MB_OP( isa, LOAD )( state[3] ) ) ); \
+        MB_OP( isa, STORE )( state[4], MB_OP( isa, ADD )( e, MB_OP( isa, LOAD )( state[4] ) ) ); \
+        MB_OP( isa, STORE )( state[5], MB_OP( isa, ADD )( f, MB_OP( isa, LOAD )( state[5] ) ) ); \
+        MB_OP( isa, STORE )( state[6], MB_OP( isa, ADD )( g, MB_OP( isa, LOAD )( state[6] ) ) ); \
+        MB_OP( isa, STORE )( state[7], MB_OP( isa, ADD )( h, MB_OP( isa, LOAD )( state[7] ) ) ); \
+    } while( 0 )
+
+/**
+ * Processes one block per lane with four SSE2 lanes.
+ * @param state the transposed hash states (state[j][lane] is word j of the lane)
+ * @param words the transposed message blocks (words[i][lane] is word i of the lane's block)
+ */
+static SHA256_MB_SSE2_TARGET void hash_sha256_mb_process_sse2( uint32_t state[8][HASH_SHA256_MB_MAX_LANES],
+                                                               uint32_t words[16][HASH_SHA256_MB_MAX_LANES] ) {
+    SHA256_MB_PROCESS_BLOCK( SSE2, __m128i );
+}
+
+/**
+ * Processes one block per lane with eight AVX2 lanes (see hash_sha256_mb_process_sse2).
+ * @param state the transposed hash states
+ * @param words the transposed message blocks
+ */
+static SHA256_MB_AVX2_TARGET void hash_sha256_mb_process_avx2( uint32_t state[8][HASH_SHA256_MB_MAX_LANES],
+                                                               uint32_t words[16][HASH_SHA256_MB_MAX_LANES] ) {
+    SHA256_MB_PROCESS_BLOCK( AVX2, __m256i );
+}
+
+/**
+ * Starts hashing a message in a lane: copies the incomplete last block to
+ * the tail, appends the padding and the length, and sets the lane's state
+ * to the initialization vector.
+ * @param lane the lane
+ * @param state the transposed hash states
+ * @param lane_index the index of the lane (column of state)
+ * @param message the message
+ * @param length the length of message in bytes
+ * @param index the index of the message
+ */
+static void hash_sha256_mb_lane_start( hash_sha256_mb_lane_t *lane,
+                                       uint32_t state[8][HASH_SHA256_MB_MAX_LANES],
+                                       const int lane_index,
+                                       const uint8_t *message,
+                                       const int length,
+                                       const int index ) {
+    hash_sha224_256_t initial_state;
+    const int remaining = length & 63;
+    const uint64_t bits = (uint64_t)length << 3;
+    int i;
+
+    lane->data = message;
+    lane->data_blocks = length >> 6;
+    lane->tail_blocks = ( remaining < 56 ) ? 1 : 2;
+    lane->tail_next = 0;
+    lane->index = index;
+
+    for( i = 0; i < remaining; i++ ) {
+        lane->tail[i] = message[length - remaining + i];
+    }
+    lane->tail[remaining] = 0x80;
+    for( i = remaining + 1; i < lane->tail_blocks * 64 - 8; i++ ) {
+        lane->tail[i] = 0;
+    }
+    for( i = 0; i < 8; i++ ) {
+        lane->tail[lane->tail_blocks * 64 - 1 - i] = ( bits >> ( 8 * i ) ) & 0xFF;
+    }
+
+    hash_sha256_init( &initial_state );
+    for( i = 0; i < 8; i++ ) {
+        state[i][lane_index] = initial_state.hash[i];
+    }
+}
+
+/**
+ * Hashes up to HASH_SHA256_MB_CHUNK messages. The messages are sorted by
+ * length (longest first) and assigned to the lanes in this order; a lane
+ * that finishes its message takes the next one, so that lanes only idle
+ * at the end of the chunk, while the shortest messages are processed.
+ * @param digests the resulting states (count entries)
+ * @param messages the messages
+ * @param lengths the lengths of the messages in bytes
+ * @param count the number of messages (at most HASH_SHA256_MB_CHUNK)
+ */
+static void hash_sha256_mb_chunk( hash_sha224_256_t *digests, const uint8_t *const *messages, const int *lengths, const int count ) {
+    hash_sha256_mb_lane_t lanes[HASH_SHA256_MB_MAX_LANES];
+    uint32_t state[8][HASH_SHA256_MB_MAX_LANES];
+    uint32_t words[16][HASH_SHA256_MB_MAX_LANES];
+    int order[HASH_SHA256_MB_CHUNK];
+    const int lane_count = hash_sha256_mb_lane_count;
+    int i, j, l, next = 0, active = 0;
+    const uint8_t *block;
+
+    // insertion sort by descending length (count is small)
+    for( i = 0; i < count; i++ ) {
+        for( j = i; j > 0 && lengths[order[j - 1]] < lengths[i]; j-- ) {
+            order[j] = order[j - 1];
+        }
+        order[j] = i;
+    }
+
+    for( l = 0; l < lane_count; l++ ) {
+        lanes[l].index = -1;
+    }
+
+    for( ;; ) {
+        for( l = 0; l < lane_count; l++ ) {
+            if( lanes[l].index < 0 && next < count ) {
+                i = order[next++];
+                hash_sha256_mb_lane_start( &lanes[l], state, l, messages[i], lengths[i], i );
+                active++;
+            }
+        }
+        if( active == 0 ) {
+            break;
+        }
+
+        // transpose the next block of each lane into big-endian words
+        for( l = 0; l < lane_count; l++ ) {
+            if( lanes[l].index < 0 ) {
+                block = hash_sha256_mb_idle_block;
+            } else if( lanes[l].data_blocks > 0 ) {
+                block = lanes[l].data;
+            } else {
+                block = &lanes[l].tail[lanes[l].tail_next * 64];
+            }
+            for( i = 0; i < 16; i++ ) {
+                words[i][l] = ( (uint32_t)block[4 * i] << 24 ) | ( (uint32_t)block[4 * i + 1] << 16 )
+                              | ( (uint32_t)block[4 * i + 2] << 8 ) | (uint32_t)block[4 * i + 3];
+            }
+        }
+
+        if( lane_count == 8 ) {
+            hash_sha256_mb_process_avx2( state, words );
+        } else {
+            hash_sha256_mb_process_sse2( state, words );
+        }
+
+        for( l = 0; l < lane_count; l++ ) {
+            if( lanes[l].index < 0 ) {
+                continue;
+            }
+            if( lanes[l].data_blocks > 0 ) {
+                lanes[l].data += 64;
+                lanes[l].data_blocks--;
+                continue;
+            }
+            lanes[l].tail_next++;
+            if( --lanes[l].tail_blocks == 0 ) {
+                for( i = 0; i < 8; i++ ) {
+                    digests[lanes[l].index].hash[i] = state[i][l];
+                }
+                lanes[l].index = -1;
+                active--;
+            }
+        }
+    }
+}
+
+/**
+ * Hashes independent messages with SHA256, hash_sha256_mb_lanes() of them
+ * in parallel. Must only be called if hash_sha256_mb_lanes() is not 0.
+ * @param digests the resulting states (see hash_sha256_to_byte_array), count entries
+ * @param messages the messages
+ * @param lengths the lengths of the messages in bytes
+ * @param count the number of messages
+ */
+void hash_sha256_mb( hash_sha224_256_t *digests, const uint8_t *const *messages, const int *lengths, const int count ) {
+    int start, chunk;
+
+    for( start = 0; start < count; start += HASH_SHA256_MB_CHUNK ) {
+        chunk = count - start;
+        if( chunk > HASH_SHA256_MB_CHUNK ) {
+            chunk = HASH_SHA256_MB_CHUNK;
+        }
+        hash_sha256_mb_chunk( digests + start, messages + start, lengths + start, chunk );
+    }
+}
+
+#endif /* HASH_SHA256_MB_AVAILABLE */
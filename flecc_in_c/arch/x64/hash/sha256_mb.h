@@ -0,0 +1,62 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+#ifndef SHA256_MB_H_
+#define SHA256_MB_H_
+
+#include "../../../hash/sha2.h"
+
+/** 1 if the compiler can build the multi-buffer (SSE2/AVX2) SHA-256 functions */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define HASH_SHA256_MB_AVAILABLE 1
+#else
+#define HASH_SHA256_MB_AVAILABLE 0
+#endif
+
+/** the maximum number of messages hashed in parallel (one per 32-bit lane of an AVX2 register) */
+#define HASH_SHA256_MB_MAX_LANES 8
+/** the number of messages sorted by length at once by hash_sha256_mb (bounds the stack usage) */
+#define HASH_SHA256_MB_CHUNK 64
+/** environment variable that limits the number of lanes: 0 disables the multi-buffer code, 4 disables AVX2 */
+#define HASH_SHA256_MB_ENV "FLECC_SHA256_MB"
+
+#if HASH_SHA256_MB_AVAILABLE
+int hash_sha256_mb_lanes( void );
+void hash_sha256_mb( hash_sha224_256_t *digests, const uint8_t *const *messages, const int *lengths, const int count );
+#endif
+
+#endif /* SHA256_MB_H_ */
@@ -0,0 +1,274 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#include "sha_ni.h"
+
+#if HASH_SHA_NI_AVAILABLE
+
+#include <cpuid.h>
+#include <immintrin.h>
+#include <stdlib.h>
+
+#define SHA_NI_TARGET __attribute__( ( target( "sha,sse4.1,ssse3" ) ) )
+
+/** the SHA-256 round constants (sha2.c) */
+extern const uint32_t K256[64];
+
+/** 1 if the CPU supports the SHA extension; set once when the library is loaded and never changed */
+static int hash_sha_ni_supported = 0;
+
+/**
+ * Detects the SHA extension (CPUID leaf 7, EBX bit 29) and the needed SSSE3
+ * and SSE4.1 instructions (CPUID leaf 1, ECX bits 9 and 19). Runs before
+ * main, so that the flag is read-only for all threads.
+ */
+static void __attribute__( ( constructor ) ) hash_sha_ni_detect( void ) {
+    unsigned int eax, ebx, ecx, edx;
+    const char *env = getenv( HASH_SHA_NI_ENV );
+
+    if( ( env != NULL ) && ( env[0] == '0' ) ) {
+        return;
+    }
+    if( __get_cpuid( 1, &eax, &ebx, &ecx, &edx ) == 0 ) {
+        return;
+    }
+    if( ( ( ecx >> 9 ) & 1 ) == 0 || ( ( ecx >> 19 ) & 1 ) == 0 ) {
+        return;
+    }
+    if( __get_cpuid_count( 7, 0, &eax, &ebx, &ecx, &edx ) == 0 ) {
+        return;
+    }
+    hash_sha_ni_supported = ( ebx >> 29 ) & 1;
+}
+
+/**
+ * Returns 1 if the SHA extension block functions may be used.
+ * @return 1 if the CPU supports the SHA extension (and it is not disabled by HASH_SHA_NI_ENV), 0 otherwise
+ */
+int hash_sha_ni_is_supported( void ) {
+    return hash_sha_ni_supported;
+}
+
+/**
+ * Builds the padded final block(s) of SHA-1 and SHA-256 as bytes, which the
+ * block functions of the SHA extension process like the message blocks.
+ * @param block the resulting padded block(s), 128 bytes
+ * @param message the remaining message
+ * @param remaining_length the number of remaining bytes within message (less than 64)
+ * @param total_length the total number of bytes of the message
+ * @return the number of blocks (1 or 2)
+ */
+int hash_sha_ni_pad( uint8_t *block, const uint8_t *message, const int remaining_length, const int total_length ) {
+    uint32_t bits = ( (uint32_t)total_length ) * 8;
+    int blocks = ( remaining_length < 56 ) ? 1 : 2;
+    int i;
+
+    for( i = 0; i < remaining_length; i++ ) {
+        block[i] = message[i];
+    }
+    block[remaining_length] = 0x80;
+    for( i = remaining_length + 1; i < blocks * 64 - 4; i++ ) {
+        block[i] = 0;
+    }
+    block[blocks * 64 - 4] = bits >> 24;
+    block[blocks * 64 - 3] = ( bits >> 16 ) & 0xFF;
+    block[blocks * 64 - 2] = ( bits >> 8 ) & 0xFF;
+    block[blocks * 64 - 1] = bits & 0xFF;
+    return blocks;
+}
+
+/*
+ * Four SHA-1 rounds (group g of 20) of the message words cur = w[4g..4g+3].
+ * e_cur accumulates E for this group, e_next receives the state for the next
+ * group. The message schedule of the following groups is updated on the fly:
+ * next (sha1msg2), prev (sha1msg1), and next2 (xor).
+ */
+#define SHA1_NI_ROUNDS_4( g, cur, prev, next, next2, e_cur, e_next )             \
+    do {                                                                         \
+        if( ( g ) == 0 ) {                                                       \
+            e_cur = _mm_add_epi32( e_cur, cur );                                 \
+        } else {                                                                 \
+            e_cur = _mm_sha1nexte_epu32( e_cur, cur );                           \
+        }                                                                        \
+        e_next = abcd;                                                           \
+        if( ( g ) >= 3 && ( g ) <= 18 ) {                                        \
+            next = _mm_sha1msg2_epu32( next, cur );                              \
+        }                                                                        \
+        abcd = _mm_sha1rnds4_epu32( abcd, e_cur, ( g ) / 5 );                   \
+        if( ( g ) >= 1 && ( g ) <= 16 ) {                                        \
+            prev = _mm_sha1msg1_epu32( prev, cur );                              \
+        }                                                                        \
+        if( ( g ) >= 2 && ( g ) <= 17 ) {                                        \
+            next2 = _mm_xor_si128( next2, cur );                                 \
+        }                                                                        \
+    } while( 0 )
+
+/**
+ * Processes complete 512-bit blocks with the SHA-1 instructions of the SHA extension.
+ * @param state the hash state to update
+ * @param message blocks * 64 bytes
+ * @param blocks the number of blocks
+ */
+SHA_NI_TARGET void hash_sha1_ni_process_blocks( hash_sha1_t *state, const uint8_t *message, int blocks ) {
+    const __m128i mask = _mm_set_epi64x( 0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL );
+    __m128i abcd, abcd_save, e0, e0_save, e1;
+    __m128i m0, m1, m2, m3;
+
+    abcd = _mm_set_epi32( state->H0, state->H1, state->H2, state->H3 );
+    e0 = _mm_set_epi32( state->H4, 0, 0, 0 );
+
+    while( blocks-- > 0 ) {
+        abcd_save = abcd;
+        e0_save = e0;
+
+        m0 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)( message + 0 ) ), mask );
+        m1 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)( message + 16 ) ), mask );
+        m2 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)( message + 32 ) ), mask );
+        m3 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)( message + 48 ) ), mask );
+
+        SHA1_NI_ROUNDS_4( 0, m0, m3, m1, m2, e0, e1 );
+        SHA1_NI_ROUNDS_4( 1, m1, m0, m2, m3, e1, e0 );
+        SHA1_NI_ROUNDS_4( 2, m2, m1, m3, m0, e0, e1 );
+        SHA1_NI_ROUNDS_4( 3, m3, m2, m0, m1, e1, e0 );
+        SHA1_NI_ROUNDS_4( 4, m0, m3, m1, m2, e0, e1 );
+        SHA1_NI_ROUNDS_4( 5, m1, m0, m2, m3, e1, e0 );
+        SHA1_NI_ROUNDS_4( 6, m2, m1, m3, m0, e0, e1 );
+        SHA1_NI_ROUNDS_4( 7, m3, m2, m0, m1, e1, e0 );
+        SHA1_NI_ROUNDS_4( 8, m0, m3, m1, m2, e0, e1 );
+        SHA1_NI_ROUNDS_4( 9, m1, m0, m2, m3, e1, e0 );
+        SHA1_NI_ROUNDS_4( 10, m2, m1, m3, m0, e0, e1 );
+        SHA1_NI_ROUNDS_4( 11, m3, m2, m0, m1, e1, e0 );
+        SHA1_NI_ROUNDS_4( 12, m0, m3, m1, m2, e0, e1 );
+        SHA1_NI_ROUNDS_4( 13, m1, m0, m2, m3, e1, e0 );
+        SHA1_NI_ROUNDS_4( 14, m2, m1, m3, m0, e0, e1 );
+        SHA1_NI_ROUNDS_4( 15, m3, m2, m0, m1, e1, e0 );
+        SHA1_NI_ROUNDS_4( 16, m0, m3, m1, m2, e0, e1 );
+        SHA1_NI_ROUNDS_4( 17, m1, m0, m2, m3, e1, e0 );
+        SHA1_NI_ROUNDS_4( 18, m2, m1, m3, m0, e0, e1 );
+        SHA1_NI_ROUNDS_4( 19, m3, m2, m0, m1, e1, e0 );
+
+        e0 = _mm_sha1nexte_epu32( e0, e0_save );
+        abcd = _mm_add_epi32( abcd, abcd_save );
+        message += 64;
+    }
+
+    state->H0 = _mm_extract_epi32( abcd, 3 );
+    state->H1 = _mm_extract_epi32( abcd, 2 );
+    state->H2 = _mm_extract_epi32( abcd, 1 );
+    state->H3 = _mm_extract_epi32( abcd, 0 );
+    state->H4 = _mm_extract_epi32( e0, 3 );
+}
+
+/*
+ * Four SHA-256 rounds (group k of 16) of the message words cur = w[4k..4k+3].
+ * The message schedule of the following groups is updated on the fly:
+ * next (sha256msg2) and prev (sha256msg1).
+ */
+#define SHA256_NI_ROUNDS_4( k, cur, prev, next )                                    \
+    do {                                                                            \
+        msg = _mm_add_epi32( cur, _mm_loadu_si128( (const __m128i *)&K256[4 * ( k )] ) ); \
+        state1 = _mm_sha256rnds2_epu32( state1, state0, msg );                      \
+        if( ( k ) >= 3 && ( k ) <= 14 ) {                                          \
+            next = _mm_add_epi32( next, _mm_alignr_epi8( cur, prev, 4 ) );          \
+            next = _mm_sha256msg2_epu32( next, cur );                               \
+        }                                                                           \
+        msg = _mm_shuffle_epi32( msg, 0x0E );                                       \
+        state0 = _mm_sha256rnds2_epu32( state0, state1, msg );                      \
+        if( ( k ) >= 1 && ( k ) <= 12 ) {                                          \
+            prev = _mm_sha256msg1_epu32( prev, cur );                               \
+        }                                                                           \
+    } while( 0 )
+
+/**
+ * Processes complete 512-bit blocks with the SHA-256 instructions of the SHA extension.
+ * @param state the hash state to update (SHA-224 or SHA-256)
+ * @param message blocks * 64 bytes
+ * @param blocks the number of blocks
+ */
+SHA_NI_TARGET void hash_sha256_ni_process_blocks( hash_sha224_256_t *state, const uint8_t *message, int blocks ) {
+    const __m128i mask = _mm_set_epi64x( 0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL );
+    __m128i state0, state1, state0_save, state1_save, msg, temp;
+    __m128i m0, m1, m2, m3;
+
+    // the instructions expect the state as ABEF and CDGH
+    temp = _mm_shuffle_epi32( _mm_loadu_si128( (const __m128i *)&state->hash[0] ), 0xB1 ); // CDAB
+    state1 = _mm_shuffle_epi32( _mm_loadu_si128( (const __m128i *)&state->hash[4] ), 0x1B ); // EFGH
+    state0 = _mm_alignr_epi8( temp, state1, 8 );       // ABEF
+    state1 = _mm_blend_epi16( state1, temp, 0xF0 );    // CDGH
+
+    while( blocks-- > 0 ) {
+        state0_save = state0;
+        state1_save = state1;
+
+        m0 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)( message + 0 ) ), mask );
+        m1 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)( message + 16 ) ), mask );
+        m2 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)( message + 32 ) ), mask );
+        m3 = _mm_shuffle_epi8( _mm_loadu_si128( (const __m128i *)( message + 48 ) ), mask );
+
+        SHA256_NI_ROUNDS_4( 0, m0, m3, m1 );
+        SHA256_NI_ROUNDS_4( 1, m1, m0, m2 );
+        SHA256_NI_ROUNDS_4( 2, m2, m1, m3 );
+        SHA256_NI_ROUNDS_4( 3, m3, m2, m0 );
+        SHA256_NI_ROUNDS_4( 4, m0, m3, m1 );
+        SHA256_NI_ROUNDS_4( 5, m1, m0, m2 );
+        SHA256_NI_ROUNDS_4( 6, m2, m1, m3 );
+        SHA256_NI_ROUNDS_4( 7, m3, m2, m0 );
+        SHA256_NI_ROUNDS_4( 8, m0, m3, m1 );
+        SHA256_NI_ROUNDS_4( 9, m1, m0, m2 );
+        SHA256_NI_ROUNDS_4( 10, m2, m1, m3 );
+        SHA256_NI_ROUNDS_4( 11, m3, m2, m0 );
+        SHA256_NI_ROUNDS_4( 12, m0, m3, m1 );
+        SHA256_NI_ROUNDS_4( 13, m1, m0, m2 );
+        SHA256_NI_ROUNDS_4( 14, m2, m1, m3 );
+        SHA256_NI_ROUNDS_4( 15, m3, m2, m0 );
+
+        state0 = _mm_add_epi32( state0, state0_save );
+        state1 = _mm_add_epi32( state1, state1_save );
+        message += 64;
+    }
+
+    // back to ABCD and EFGH
+    temp = _mm_shuffle_epi32( state0, 0x1B );          // FEBA
+    state1 = _mm_shuffle_epi32( state1, 0xB1 );        // DCHG
+    state0 = _mm_blend_epi16( temp, state1, 0xF0 );    // DCBA
+    state1 = _mm_alignr_epi8( state1, temp, 8 );       // EFGH
+    _mm_storeu_si128( (__m128i *)&state->hash[0], state0 );
+    _mm_storeu_si128( (__m128i *)&state->hash[4], state1 );
+}
+
+#endif /* HASH_SHA_NI_AVAILABLE */
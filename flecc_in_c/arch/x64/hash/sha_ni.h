@@ -0,0 +1,62 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#ifndef SHA_NI_H_
+#define SHA_NI_H_
+
+#include "../../../hash/sha1.h"
+#include "../../../hash/sha2.h"
+
+/** 1 if the compiler can build the SHA extension (SHA-NI) block functions */
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define HASH_SHA_NI_AVAILABLE 1
+#else
+#define HASH_SHA_NI_AVAILABLE 0
+#endif
+
+/** environment variable that disables the SHA extension if set to 0 (e.g., to test the portable code) */
+#define HASH_SHA_NI_ENV "FLECC_SHA_NI"
+
+#if HASH_SHA_NI_AVAILABLE
+int hash_sha_ni_is_supported( void );
+int hash_sha_ni_pad( uint8_t *block, const uint8_t *message, const int remaining_length, const int total_length );
+void hash_sha1_ni_process_blocks( hash_sha1_t *state, const uint8_t *message, int blocks );
+void hash_sha256_ni_process_blocks( hash_sha224_256_t *state, const uint8_t *message, int blocks );
+#endif
+
+#endif /* SHA_NI_H_ */
@@ -39,8 +39,11 @@
 #define ECCP_H_
 
 #include "eccp_affine.h"
+#include "eccp_batch.h"
 #include "eccp_generic.h"
 #include "eccp_jacobian.h"
+#include "eccp_modified_jacobian.h"
+#include "eccp_packed.h"
 #include "eccp_std_projective.h"
 #include "eccp_protected.h"
 
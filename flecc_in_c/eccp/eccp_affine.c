@@ -71,6 +71,43 @@ int eccp_affine_point_is_valid( const eccp_point_affine_t *A, const eccp_paramet
     return gfp_is_equal(left, right);
 }
 
+/**
+ * Reconstructs a point from its x coordinate and the parity of its y
+ * coordinate (point decompression, SEC 1 Section 2.3.4).
+ * @param res the resulting point
+ * @param x the x coordinate (in the domain of param, i.e., Montgomery domain if used)
+ * @param y_odd 1 if the y coordinate (in normal domain) is odd, 0 if it is even
+ * @param param elliptic curve parameters
+ * @return 1 on success, 0 if there is no point with the given x coordinate
+ */
+int eccp_affine_point_decompress( eccp_point_affine_t *res, const gfp_t x, const int y_odd, const eccp_parameters_t *param ) {
+    gfp_t right, temp;
+
+    if( bigint_compare_var( x, param->prime_data.prime, param->prime_data.words ) >= 0 )
+        return 0;
+
+    gfp_square( temp, x );
+    gfp_multiply( right, x, temp );          /* x^3 */
+    gfp_multiply( temp, x, param->param_a ); /* a*x */
+    gfp_add( right, right, temp );           /* x^3 + a*x */
+    gfp_add( right, right, param->param_b ); /* x^3 + a*x + b */
+
+    if( gfp_mont_sqrt( res->y, right, &param->prime_data ) == 0 )
+        return 0;
+
+    if( param->prime_data.montgomery_domain == 1 ) {
+        gfp_montgomery_to_normal( temp, res->y, &param->prime_data );
+    } else {
+        gfp_copy( temp, res->y );
+    }
+    if( ( temp[0] & 1 ) != ( y_odd & 1 ) ) {
+        gfp_negate( res->y, res->y );
+    }
+    gfp_copy( res->x, x );
+    res->identity = 0;
+    return 1;
+}
+
 /**
  *  Compares the two given points for equality. (identity is smaller, then compare x and y coordinates)
  *  @param A
@@ -43,6 +43,7 @@
 int eccp_affine_point_is_valid( const eccp_point_affine_t *A, const eccp_parameters_t *param );
 int eccp_affine_point_compare( const eccp_point_affine_t *A, const eccp_point_affine_t *B, const eccp_parameters_t *param );
 void eccp_affine_point_copy( eccp_point_affine_t *dest, const eccp_point_affine_t *src, const eccp_parameters_t *param );
+int eccp_affine_point_decompress( eccp_point_affine_t *res, const gfp_t x, const int y_odd, const eccp_parameters_t *param );
 
 void eccp_affine_point_add( eccp_point_affine_t *res,
                             const eccp_point_affine_t *A,
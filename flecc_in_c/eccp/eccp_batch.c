@@ -0,0 +1,385 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+#include "eccp_batch.h"
+#include <stddef.h>
+#include "../bi/bi.h"
+#include "../gfp/gfp.h"
+#include "eccp_jacobian.h"
+
+/**
+ * Sets or clears bit index of a bitmap.
+ * @param bitmap the bitmap
+ * @param index the bit to set or clear
+ * @param value the new value of the bit (0 or 1)
+ */
+static void eccp_batch_bitmap_set( uint_t *bitmap, const int index, const int value ) {
+    uint_t mask = (uint_t)1 << ( index % BITS_PER_WORD );
+
+    if( value ) {
+        bitmap[index / BITS_PER_WORD] |= mask;
+    } else {
+        bitmap[index / BITS_PER_WORD] &= ~mask;
+    }
+}
+
+/**
+ * Initializes a batch of points within the given buffer. All points are set
+ * to the point at infinity.
+ * @param batch the batch to initialize
+ * @param buffer memory for the batch (ECCP_BATCH_BUFFER_WORDS( count, param->prime_data.words ) words)
+ * @param count the number of points in the batch
+ * @param param elliptic curve parameters
+ */
+void eccp_batch_init( eccp_point_batch_t *batch, uint_t *buffer, const int count, const eccp_parameters_t *param ) {
+    int array_words = ECCP_BATCH_ARRAY_WORDS( count, param->prime_data.words );
+    int i;
+
+    batch->count = count;
+    batch->words = param->prime_data.words;
+    batch->x = buffer;
+    batch->y = buffer + array_words;
+    batch->z = buffer + 2 * array_words;
+    batch->temp = buffer + 3 * array_words;
+    batch->identity = buffer + 4 * array_words;
+    bigint_clear_var( batch->identity, ECCP_BATCH_BITMAP_WORDS( count ) );
+    bigint_clear_var( batch->x, 3 * array_words );
+    for( i = 0; i < count; i++ ) {
+        eccp_batch_bitmap_set( batch->identity, i, 1 );
+    }
+}
+
+/**
+ * Returns 1 if the point index of the batch is the point at infinity.
+ * @param batch the batch of points
+ * @param index the index of the point
+ * @return 1 if the point is the point at infinity, 0 otherwise
+ */
+int eccp_batch_is_identity( const eccp_point_batch_t *batch, const int index ) {
+    return ( batch->identity[index / BITS_PER_WORD] >> ( index % BITS_PER_WORD ) ) & 1;
+}
+
+/**
+ * Copies a point of the batch to a Jacobian point.
+ * @param P the resulting point
+ * @param batch the batch of points
+ * @param index the index of the point
+ * @param param elliptic curve parameters
+ */
+void eccp_batch_get( eccp_point_projective_t *P, const eccp_point_batch_t *batch, const int index, const eccp_parameters_t *param ) {
+    int offset = index * batch->words;
+
+    bigint_copy_var( P->x, batch->x + offset, batch->words );
+    bigint_copy_var( P->y, batch->y + offset, batch->words );
+    bigint_copy_var( P->z, batch->z + offset, batch->words );
+    P->identity = eccp_batch_is_identity( batch, index );
+}
+
+/**
+ * Stores a Jacobian point within the batch.
+ * @param batch the batch of points
+ * @param index the index of the point
+ * @param P the point to store
+ * @param param elliptic curve parameters
+ */
+void eccp_batch_set( eccp_point_batch_t *batch, const int index, const eccp_point_projective_t *P, const eccp_parameters_t *param ) {
+    int offset = index * batch->words;
+
+    bigint_copy_var( batch->x + offset, P->x, batch->words );
+    bigint_copy_var( batch->y + offset, P->y, batch->words );
+    bigint_copy_var( batch->z + offset, P->z, batch->words );
+    eccp_batch_bitmap_set( batch->identity, index, P->identity );
+}
+
+/**
+ * Converts a point of the batch to affine coordinates (one inversion; use
+ * eccp_batch_normalize to convert all points with a single inversion).
+ * @param P the resulting point
+ * @param batch the batch of points
+ * @param index the index of the point
+ * @param param elliptic curve parameters
+ */
+void eccp_batch_get_affine( eccp_point_affine_t *P, const eccp_point_batch_t *batch, const int index, const eccp_parameters_t *param ) {
+    eccp_point_projective_t temp;
+
+    eccp_batch_get( &temp, batch, index, param );
+    eccp_jacobian_to_affine( P, &temp, param );
+}
+
+/**
+ * Stores an affine point within the batch (z = 1).
+ * @param batch the batch of points
+ * @param index the index of the point
+ * @param P the point to store
+ * @param param elliptic curve parameters
+ */
+void eccp_batch_set_affine( eccp_point_batch_t *batch, const int index, const eccp_point_affine_t *P, const eccp_parameters_t *param ) {
+    eccp_point_projective_t temp;
+
+    eccp_affine_to_jacobian( &temp, P, param );
+    eccp_batch_set( batch, index, &temp, param );
+}
+
+/**
+ * Adds two batches of points element-wise (res[i] = a[i] + b[i]). This is a
+ * convenience loop: each point is copied out of the batch and added with
+ * eccp_jacobian_point_add.
+ * @param res the resulting batch (may be a or b)
+ * @param a the first batch of summands
+ * @param b the second batch of summands
+ * @param param elliptic curve parameters
+ */
+void eccp_batch_add( eccp_point_batch_t *res, const eccp_point_batch_t *a, const eccp_point_batch_t *b, const eccp_parameters_t *param ) {
+    eccp_point_projective_t A, B;
+    int i;
+
+    for( i = 0; i < (int)res->count; i++ ) {
+        eccp_batch_get( &A, a, i, param );
+        eccp_batch_get( &B, b, i, param );
+        eccp_jacobian_point_add( &A, &A, &B, param );
+        eccp_batch_set( res, i, &A, param );
+    }
+}
+
+/**
+ * Doubles a batch of points element-wise (res[i] = 2 * a[i]). This is a
+ * convenience loop over eccp_jacobian_point_double.
+ * @param res the resulting batch (may be a)
+ * @param a the batch of points to double
+ * @param param elliptic curve parameters
+ */
+void eccp_batch_double( eccp_point_batch_t *res, const eccp_point_batch_t *a, const eccp_parameters_t *param ) {
+    eccp_point_projective_t A;
+    int i;
+
+    for( i = 0; i < (int)res->count; i++ ) {
+        eccp_batch_get( &A, a, i, param );
+        eccp_jacobian_point_double( &A, &A, param );
+        eccp_batch_set( res, i, &A, param );
+    }
+}
+
+/**
+ * Negates a batch of points element-wise (res[i] = -a[i]).
+ * @param res the resulting batch (may be a)
+ * @param a the batch of points to negate
+ * @param param elliptic curve parameters
+ */
+void eccp_batch_negate( eccp_point_batch_t *res, const eccp_point_batch_t *a, const eccp_parameters_t *param ) {
+    int words = param->prime_data.words;
+    int i;
+
+    for( i = 0; i < (int)res->count; i++ ) {
+        bigint_copy_var( res->x + i * words, a->x + i * words, words );
+        gfp_negate( res->y + i * words, a->y + i * words );
+        bigint_copy_var( res->z + i * words, a->z + i * words, words );
+        eccp_batch_bitmap_set( res->identity, i, eccp_batch_is_identity( a, i ) );
+    }
+}
+
+/**
+ * Converts all points of the batch to z = 1 (affine x and y) using a single
+ * inversion (Montgomery's simultaneous inversion). Points with z = 0 are set
+ * to the point at infinity.
+ * @param batch the batch of points
+ * @param param elliptic curve parameters
+ */
+void eccp_batch_normalize( eccp_point_batch_t *batch, const eccp_parameters_t *param ) {
+    int words = param->prime_data.words;
+    gfp_t product, inverse, z_inverse, z_inverse_squared;
+    int i;
+
+    // temp[i] = z[0] * ... * z[i] (points at infinity are skipped)
+    gfp_copy( product, param->prime_data.gfp_one );
+    for( i = 0; i < (int)batch->count; i++ ) {
+        if( gfp_is_zero( batch->z + i * words ) ) {
+            eccp_batch_bitmap_set( batch->identity, i, 1 );
+        }
+        if( !eccp_batch_is_identity( batch, i ) ) {
+            gfp_multiply( product, product, batch->z + i * words );
+        }
+        bigint_copy_var( batch->temp + i * words, product, words );
+    }
+
+    gfp_inverse( inverse, product );
+    for( i = (int)batch->count - 1; i >= 0; i-- ) {
+        if( eccp_batch_is_identity( batch, i ) ) {
+            continue;
+        }
+        // z[i]^-1 = (z[0] * ... * z[i])^-1 * (z[0] * ... * z[i-1])
+        if( i > 0 ) {
+            gfp_multiply( z_inverse, inverse, batch->temp + ( i - 1 ) * words );
+        } else {
+            gfp_copy( z_inverse, inverse );
+        }
+        gfp_multiply( inverse, inverse, batch->z + i * words );
+
+        gfp_square( z_inverse_squared, z_inverse );
+        gfp_multiply( batch->x + i * words, batch->x + i * words, z_inverse_squared );
+        gfp_multiply( batch->y + i * words, batch->y + i * words, z_inverse_squared );
+        gfp_multiply( batch->y + i * words, batch->y + i * words, z_inverse );
+        bigint_copy_var( batch->z + i * words, param->prime_data.gfp_one, words );
+    }
+}
+
+/**
+ * Checks whether the points of the batch are on the curve.
+ * @param valid bitmap of valid points (ECCP_BATCH_BITMAP_WORDS( count ) words; may be NULL)
+ * @param batch the batch of points
+ * @param param elliptic curve parameters
+ * @return 1 if all points are valid, 0 otherwise
+ */
+int eccp_batch_validate( uint_t *valid, const eccp_point_batch_t *batch, const eccp_parameters_t *param ) {
+    eccp_point_projective_t A;
+    int all_valid = 1;
+    int is_valid;
+    int i;
+
+    for( i = 0; i < (int)batch->count; i++ ) {
+        eccp_batch_get( &A, batch, i, param );
+        is_valid = eccp_jacobian_point_is_valid( &A, param );
+        all_valid &= is_valid;
+        if( valid != NULL ) {
+            eccp_batch_bitmap_set( valid, i, is_valid );
+        }
+    }
+    return all_valid;
+}
+
+/**
+ * Checks whether n*P is the point at infinity. Uses the plain double-and-add
+ * multiplication, because the protected multiplications (param->eccp_mul)
+ * treat a scalar of n-1 or n as a special case and return -P or O directly.
+ * @param P the point to check (in the domain of param)
+ * @param param elliptic curve parameters
+ * @return 1 if the order of P divides n, 0 otherwise
+ */
+static int eccp_affine_point_has_order_n( const eccp_point_affine_t *P, const eccp_parameters_t *param ) {
+    eccp_point_affine_t Q;
+
+    eccp_jacobian_point_multiply_L2R_DA( &Q, P, param->order_n_data.prime, param );
+    return Q.identity == 1;
+}
+
+/**
+ * Checks a set of public keys received from other parties (e.g., when a key
+ * directory is loaded). A point is valid if it is not the point at infinity,
+ * both coordinates are smaller than p and it satisfies the curve equation.
+ * The points are processed in chunks of ECCP_VALIDATE_BATCH_SIZE whose
+ * coordinates are stored as structure of arrays, so that each step of the
+ * curve equation y^2 = (x^2 + a)*x + b runs over all points of a chunk.
+ * @param valid bitmap of valid points (ECCP_BATCH_BITMAP_WORDS( count ) words, read with ECCP_BATCH_BITMAP_GET)
+ * @param points the points to check (in normal domain, as received)
+ * @param count the number of points
+ * @param check_order if 1, curves with cofactor h > 1 additionally check n*P == O
+ *        (one scalar multiplication per point; ignored for h == 1 since every point has order n)
+ * @param param elliptic curve parameters
+ * @return the number of valid points
+ */
+int eccp_affine_points_validate_batch( uint_t *valid,
+                                       const eccp_point_affine_t *points,
+                                       const int count,
+                                       const int check_order,
+                                       const eccp_parameters_t *param ) {
+    uint_t x[ECCP_VALIDATE_BATCH_SIZE * WORDS_PER_GFP];
+    uint_t y[ECCP_VALIDATE_BATCH_SIZE * WORDS_PER_GFP];
+    uint_t right[ECCP_VALIDATE_BATCH_SIZE * WORDS_PER_GFP];
+    uint_t left[ECCP_VALIDATE_BATCH_SIZE * WORDS_PER_GFP];
+    int in_range[ECCP_VALIDATE_BATCH_SIZE];
+    int words = param->prime_data.words;
+    eccp_point_affine_t P;
+    int valid_count = 0;
+    int offset, batch, i, is_valid;
+
+    for( offset = 0; offset < count; offset += batch ) {
+        batch = count - offset;
+        if( batch > ECCP_VALIDATE_BATCH_SIZE ) {
+            batch = ECCP_VALIDATE_BATCH_SIZE;
+        }
+
+        // points out of range are evaluated with x = y = 0 and masked afterwards
+        for( i = 0; i < batch; i++ ) {
+            in_range[i] = ( points[offset + i].identity == 0 )
+                          && ( bigint_compare_var( points[offset + i].x, param->prime_data.prime, words ) < 0 )
+                          && ( bigint_compare_var( points[offset + i].y, param->prime_data.prime, words ) < 0 );
+            if( in_range[i] ) {
+                bigint_copy_var( x + i * words, points[offset + i].x, words );
+                bigint_copy_var( y + i * words, points[offset + i].y, words );
+            } else {
+                bigint_clear_var( x + i * words, words );
+                bigint_clear_var( y + i * words, words );
+            }
+        }
+        if( param->prime_data.montgomery_domain == 1 ) {
+            for( i = 0; i < batch; i++ ) {
+                gfp_normal_to_montgomery( x + i * words, x + i * words, &param->prime_data );
+            }
+            for( i = 0; i < batch; i++ ) {
+                gfp_normal_to_montgomery( y + i * words, y + i * words, &param->prime_data );
+            }
+        }
+
+        for( i = 0; i < batch; i++ ) {
+            gfp_square( right + i * words, x + i * words );
+        }
+        for( i = 0; i < batch; i++ ) {
+            gfp_add( right + i * words, right + i * words, param->param_a );
+        }
+        for( i = 0; i < batch; i++ ) {
+            gfp_multiply( right + i * words, right + i * words, x + i * words );
+        }
+        for( i = 0; i < batch; i++ ) {
+            gfp_add( right + i * words, right + i * words, param->param_b );
+        }
+        for( i = 0; i < batch; i++ ) {
+            gfp_square( left + i * words, y + i * words );
+        }
+
+        for( i = 0; i < batch; i++ ) {
+            is_valid = in_range[i] && gfp_is_equal( left + i * words, right + i * words );
+            if( is_valid && check_order && ( param->h > 1 ) ) {
+                bigint_copy_var( P.x, x + i * words, words );
+                bigint_copy_var( P.y, y + i * words, words );
+                P.identity = 0;
+                is_valid = eccp_affine_point_has_order_n( &P, param );
+            }
+            eccp_batch_bitmap_set( valid, offset + i, is_valid );
+            valid_count += is_valid;
+        }
+    }
+    return valid_count;
+}
@@ -0,0 +1,73 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+#ifndef ECCP_BATCH_H_
+#define ECCP_BATCH_H_
+
+#include "../types.h"
+
+/** the number of words of one coordinate array */
+#define ECCP_BATCH_ARRAY_WORDS( count, words ) ( ( count ) * ( words ) )
+/** the number of words of the identity bitmap */
+#define ECCP_BATCH_BITMAP_WORDS( count ) ( ( ( count ) + BITS_PER_WORD - 1 ) / BITS_PER_WORD )
+/** the size of the buffer (in words) needed by eccp_batch_init */
+#define ECCP_BATCH_BUFFER_WORDS( count, words ) \
+    ( 4 * ECCP_BATCH_ARRAY_WORDS( count, words ) + ECCP_BATCH_BITMAP_WORDS( count ) )
+/** returns bit index of a bitmap (e.g., of eccp_affine_points_validate_batch) */
+#define ECCP_BATCH_BITMAP_GET( bitmap, index ) ( ( ( bitmap )[( index ) / BITS_PER_WORD] >> ( ( index ) % BITS_PER_WORD ) ) & 1 )
+/** the number of points checked at once by eccp_affine_points_validate_batch */
+#define ECCP_VALIDATE_BATCH_SIZE 16
+
+void eccp_batch_init( eccp_point_batch_t *batch, uint_t *buffer, const int count, const eccp_parameters_t *param );
+int eccp_batch_is_identity( const eccp_point_batch_t *batch, const int index );
+void eccp_batch_get( eccp_point_projective_t *P, const eccp_point_batch_t *batch, const int index, const eccp_parameters_t *param );
+void eccp_batch_set( eccp_point_batch_t *batch, const int index, const eccp_point_projective_t *P, const eccp_parameters_t *param );
+void eccp_batch_get_affine( eccp_point_affine_t *P, const eccp_point_batch_t *batch, const int index, const eccp_parameters_t *param );
+void eccp_batch_set_affine( eccp_point_batch_t *batch, const int index, const eccp_point_affine_t *P, const eccp_parameters_t *param );
+
+void eccp_batch_add( eccp_point_batch_t *res, const eccp_point_batch_t *a, const eccp_point_batch_t *b, const eccp_parameters_t *param );
+void eccp_batch_double( eccp_point_batch_t *res, const eccp_point_batch_t *a, const eccp_parameters_t *param );
+void eccp_batch_negate( eccp_point_batch_t *res, const eccp_point_batch_t *a, const eccp_parameters_t *param );
+void eccp_batch_normalize( eccp_point_batch_t *batch, const eccp_parameters_t *param );
+int eccp_batch_validate( uint_t *valid, const eccp_point_batch_t *batch, const eccp_parameters_t *param );
+int eccp_affine_points_validate_batch( uint_t *valid,
+                                       const eccp_point_affine_t *points,
+                                       const int count,
+                                       const int check_order,
+                                       const eccp_parameters_t *param );
+
+#endif /* ECCP_BATCH_H_ */
@@ -37,6 +37,9 @@
 
 #include "eccp_generic.h"
 #include "eccp_affine.h"
+#include "eccp_jacobian.h"
+#include "eccp_modified_jacobian.h"
+#include "eccp_protected.h"
 #include <stdlib.h> // for the definition of the NULL pointer
 
 /**
@@ -58,3 +61,129 @@ void eccp_generic_mul_wrapper( eccp_point_affine_t *result, const eccp_point_aff
         param->eccp_mul(result, P, scalar, param);
     }
 }
+
+/**
+ * Sets the storage of the fixed-point registry of param and clears all entries.
+ * @param param elliptic curve parameters
+ * @param entries the storage of the registry (capacity entries)
+ * @param capacity the maximum number of registered fixed points
+ */
+void eccp_fixed_point_registry_init( eccp_parameters_t *param, eccp_fixed_point_t *entries, const int capacity ) {
+    int i;
+    for( i = 0; i < capacity; i++ ) {
+        entries[i].table = NULL;
+    }
+    param->fixed_points = entries;
+    param->fixed_points_capacity = capacity;
+}
+
+/**
+ * Registers a fixed point (e.g., a long-lived public key or a secondary generator)
+ * and computes its comb table. Subsequent multiplications of the point via
+ * eccp_fixed_point_multiply are looked up by the returned handle.
+ * @param param elliptic curve parameters (with an initialized registry)
+ * @param point the fixed point (must not be the identity)
+ * @param table the destination of the comb table (JCB_COMB_BLOCKS_TBL_SIZE(width, blocks) points,
+ *        JCB_COMB_WOZ_TBL_SIZE(width) points if constant_time is set)
+ * @param width the comb width
+ * @param blocks the number of comb blocks (ignored if constant_time is set)
+ * @param constant_time if 1, a COMB_WOZ table is computed and the point is multiplied in
+ *        constant time (for secret scalars, e.g., ECDH with the point as static peer key)
+ * @return the handle of the registered point or -1 if the registry is full
+ */
+int eccp_fixed_point_register( eccp_parameters_t *param,
+                               const eccp_point_affine_t *point,
+                               eccp_point_affine_t *table,
+                               const int width,
+                               const int blocks,
+                               const int constant_time ) {
+    eccp_parameters_t fixed_param;
+    eccp_fixed_point_t *entry;
+    int handle;
+
+    if( point->identity == 1 ) {
+        return -1;
+    }
+    for( handle = 0; handle < (int)param->fixed_points_capacity; handle++ ) {
+        if( param->fixed_points[handle].table == NULL ) {
+            break;
+        }
+    }
+    if( handle == (int)param->fixed_points_capacity ) {
+        return -1;
+    }
+
+    // the comb pre-computation works on the base point of a copy of the parameters
+    fixed_param = *param;
+    eccp_affine_point_copy( &fixed_param.base_point, point, param );
+    fixed_param.base_point_precomputed_table_width = width;
+    if( constant_time ) {
+        fixed_param.base_point_precomputed_table_blocks = 1;
+        eccp_jacobian_point_multiply_COMB_WOZ_precompute( &fixed_param, table, 1 );
+    } else {
+        fixed_param.base_point_precomputed_table_blocks = blocks;
+        eccp_jacobian_point_multiply_COMB_precompute( &fixed_param, table );
+    }
+
+    entry = &param->fixed_points[handle];
+    eccp_affine_point_copy( &entry->point, point, param );
+    entry->table = table;
+    entry->width = width;
+    entry->blocks = JCB_COMB_BLOCKS( &fixed_param );
+    entry->constant_time = constant_time;
+    return handle;
+}
+
+/**
+ * Removes a fixed point from the registry. The handle may be re-used by
+ * subsequent calls to eccp_fixed_point_register.
+ * @param param elliptic curve parameters
+ * @param handle the handle returned by eccp_fixed_point_register
+ */
+void eccp_fixed_point_unregister( eccp_parameters_t *param, const int handle ) {
+    if( ( handle >= 0 ) && ( handle < (int)param->fixed_points_capacity ) ) {
+        param->fixed_points[handle].table = NULL;
+    }
+}
+
+/**
+ * Returns the point registered with the given handle.
+ * @param param elliptic curve parameters
+ * @param handle the handle returned by eccp_fixed_point_register
+ * @return the registered point or NULL if the handle is invalid
+ */
+const eccp_point_affine_t *eccp_fixed_point_get( const eccp_parameters_t *param, const int handle ) {
+    if( ( handle < 0 ) || ( handle >= (int)param->fixed_points_capacity ) || ( param->fixed_points[handle].table == NULL ) ) {
+        return NULL;
+    }
+    return &param->fixed_points[handle].point;
+}
+
+/**
+ * Multiplies a registered fixed point with a scalar using its comb table.
+ * @param result the resulting point
+ * @param handle the handle returned by eccp_fixed_point_register
+ * @param scalar the scalar to multiply with the fixed point
+ * @param param elliptic curve parameters
+ * @return 1 on success, 0 if the handle is invalid
+ */
+int eccp_fixed_point_multiply( eccp_point_affine_t *result, const int handle, const gfp_t scalar, const eccp_parameters_t *param ) {
+    eccp_point_projective_t result_projective;
+    const eccp_fixed_point_t *entry;
+
+    if( eccp_fixed_point_get( param, handle ) == NULL ) {
+        return 0;
+    }
+    entry = &param->fixed_points[handle];
+
+    if( entry->constant_time ) {
+        eccp_protected_point_multiply_COMB_WOZ_table( &result_projective, scalar, &entry->point, entry->table, entry->width, param );
+    } else if( eccp_modified_jacobian_is_preferable( param ) ) {
+        eccp_modified_jacobian_point_multiply_COMB_table( result, scalar, entry->table, entry->width, entry->blocks, param );
+        return 1;
+    } else {
+        eccp_jacobian_point_multiply_COMB_table( &result_projective, scalar, entry->table, entry->width, entry->blocks, param );
+    }
+    eccp_jacobian_to_affine( result, &result_projective, param );
+    return 1;
+}
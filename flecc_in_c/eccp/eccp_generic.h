@@ -43,4 +43,15 @@
 void eccp_generic_mul_wrapper( eccp_point_affine_t *result, const eccp_point_affine_t *P,
                                const gfp_t scalar, const eccp_parameters_t *param );
 
+void eccp_fixed_point_registry_init( eccp_parameters_t *param, eccp_fixed_point_t *entries, const int capacity );
+int eccp_fixed_point_register( eccp_parameters_t *param,
+                               const eccp_point_affine_t *point,
+                               eccp_point_affine_t *table,
+                               const int width,
+                               const int blocks,
+                               const int constant_time );
+void eccp_fixed_point_unregister( eccp_parameters_t *param, const int handle );
+const eccp_point_affine_t *eccp_fixed_point_get( const eccp_parameters_t *param, const int handle );
+int eccp_fixed_point_multiply( eccp_point_affine_t *result, const int handle, const gfp_t scalar, const eccp_parameters_t *param );
+
 #endif /* ECCP_GENERIC_H_ */
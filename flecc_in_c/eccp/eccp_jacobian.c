@@ -40,6 +40,11 @@
 #include "../bi/bi.h"
 #include "../utils/rand.h"
 #include "eccp_affine.h"
+#include "eccp_generic.h"
+#include "eccp_modified_jacobian.h"
+#include "eccp_packed.h"
+#include "eccp_protected.h"
+#include <stddef.h>
 
 /**
  * Tests if the given affine point fulfills the elliptic curve equation.
@@ -357,6 +362,28 @@ void eccp_jacobian_point_add_affine( eccp_point_projective_t *res,
                                      const eccp_point_projective_t *a,
                                      const eccp_point_affine_t *b,
                                      const eccp_parameters_t *param ) {
+    if( b->identity == 1 ) {
+        eccp_jacobian_point_copy( res, a, param );
+        return;
+    }
+    eccp_jacobian_point_add_affine_xy( res, a, b->x, b->y, param );
+}
+
+/**
+ * Add a Jacobian point and an affine point given by its coordinates, which
+ * only need to hold param->prime_data.words words each (e.g., an entry of a
+ * packed table, see eccp_packed.h).
+ * @param res the sum in Jacobian coordinates
+ * @param a projective Jacobian point
+ * @param bx x coordinate of the affine point (must not be the point at infinity)
+ * @param by y coordinate of the affine point
+ * @param param elliptic curve parameters
+ */
+void eccp_jacobian_point_add_affine_xy( eccp_point_projective_t *res,
+                                        const eccp_point_projective_t *a,
+                                        const uint_t *bx,
+                                        const uint_t *by,
+                                        const eccp_parameters_t *param ) {
     gfp_t T1;
     gfp_t T2;
     gfp_t T3;
@@ -364,18 +391,17 @@ void eccp_jacobian_point_add_affine( eccp_point_projective_t *res,
 
     /* if a is infinite, b is returned */
     if( a->identity == 1 ) {
-        eccp_affine_to_jacobian( res, b, param );
-        return;
-    }
-    if( b->identity == 1 ) {
-        eccp_jacobian_point_copy( res, a, param );
+        gfp_copy( res->x, bx );
+        gfp_copy( res->y, by );
+        gfp_copy( res->z, param->prime_data.gfp_one );
+        res->identity = 0;
         return;
     }
 
     gfp_square( T1, a->z );
     gfp_multiply( T2, a->z, T1 );
-    gfp_multiply( T3, b->x, T1 );
-    gfp_multiply( T1, b->y, T2 );
+    gfp_multiply( T3, bx, T1 );
+    gfp_multiply( T1, by, T2 );
     gfp_subtract( T3, T3, a->x );
     gfp_subtract( T1, T1, a->y );
 
@@ -526,72 +552,235 @@ void eccp_jacobian_point_multiply_L2R_NAF( eccp_point_affine_t *result, const ec
     eccp_jacobian_to_affine( result, &result_projective, param );
 }
 
+/**
+ * Computes k*P + l*Q with a single chain of doublings (Shamir's trick): per
+ * bit, one of P, Q or P+Q is added depending on the bits of both scalars.
+ * @param result the resulting point in Jacobian coordinates (not normalized)
+ * @param P the first point
+ * @param k the multiplicant of P
+ * @param Q the second point
+ * @param l the multiplicant of Q
+ * @param param elliptic curve parameters
+ *
+ * Hankerson Page 109 Algorithm 3.48 (with w = 1)
+ */
+void eccp_jacobian_point_multiply_shamir( eccp_point_projective_t *result,
+                                          const eccp_point_affine_t *P,
+                                          const gfp_t k,
+                                          const eccp_point_affine_t *Q,
+                                          const gfp_t l,
+                                          const eccp_parameters_t *param ) {
+    eccp_point_affine_t PQ;
+    int bit, msb_k, msb_l;
+
+    eccp_affine_point_add( &PQ, P, Q, param );
+
+    result->identity = 1;
+    msb_k = bigint_get_msb_var( k, param->order_n_data.words );
+    msb_l = bigint_get_msb_var( l, param->order_n_data.words );
+    bit = ( msb_k > msb_l ) ? msb_k : msb_l;
+    while( bit >= 0 ) {
+        eccp_jacobian_point_double( result, result, param );
+        if( bigint_test_bit_var( k, bit, param->order_n_data.words ) == 1 ) {
+            if( bigint_test_bit_var( l, bit, param->order_n_data.words ) == 1 ) {
+                eccp_jacobian_point_add_affine( result, result, &PQ, param );
+            } else {
+                eccp_jacobian_point_add_affine( result, result, P, param );
+            }
+        } else if( bigint_test_bit_var( l, bit, param->order_n_data.words ) == 1 ) {
+            eccp_jacobian_point_add_affine( result, result, Q, param );
+        }
+        bit--;
+    }
+}
+
 /**
  * Performs a point scalar multiplication with a fixed base point.
- * @param result the resulting point
+ * The comb table is split into base_point_precomputed_table_blocks blocks, which
+ * reduces the number of point doublings by the factor of blocks (Lim-Lee).
+ * @param result the resulting point in Jacobian coordinates (not normalized)
  * @param scalar the multiplicant
  * @param param elliptic curve parameters (includes pre-computation table)
  *
- * Hankerson Page 106 Algorithm 3.44
+ * Hankerson Page 106 Algorithm 3.44 (Lim-Lee variant with multiple tables)
  */
-void eccp_jacobian_point_multiply_COMB( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param ) {
-    int width = param->base_point_precomputed_table_width;
-    eccp_point_affine_t *table = param->base_point_precomputed_table;
-    eccp_point_projective_t result_projective;
-    int digit, j, j_cnt;
-    int comb_param_d = (param->order_n_data.bits - 1) / width + 1;  // same as ceil (bits / width)
-    result_projective.identity = 1;
+void eccp_jacobian_point_multiply_COMB_projective( eccp_point_projective_t *result, const gfp_t scalar, const eccp_parameters_t *param ) {
+    eccp_jacobian_point_multiply_COMB_table( result, scalar, param->base_point_precomputed_table,
+                                             param->base_point_precomputed_table_width, JCB_COMB_BLOCKS( param ), param );
+}
 
-    digit = comb_param_d - 1;
+/**
+ * Performs a point scalar multiplication with the given comb table of a fixed
+ * point (see eccp_jacobian_point_multiply_COMB_projective).
+ * @param result the resulting point in Jacobian coordinates (not normalized)
+ * @param scalar the multiplicant
+ * @param table the comb table of eccp_jacobian_point_multiply_COMB_precompute
+ * @param width the comb width of table
+ * @param blocks the number of comb blocks of table
+ * @param param elliptic curve parameters
+ */
+void eccp_jacobian_point_multiply_COMB_table( eccp_point_projective_t *result,
+                                              const gfp_t scalar,
+                                              const eccp_point_affine_t *table,
+                                              const int width,
+                                              const int blocks,
+                                              const eccp_parameters_t *param ) {
+    int tbl_size = JCB_COMB_TBL_SIZE( width );
+    int digit, block, j, j_cnt;
+    int comb_param_e = (param->order_n_data.bits - 1) / (width * blocks) + 1;  // same as ceil (bits / (width * blocks))
+    int comb_param_d = comb_param_e * blocks;
+    result->identity = 1;
+
+    digit = comb_param_e - 1;
     while(digit >= 0) {
-        eccp_jacobian_point_double(&result_projective, &result_projective, param);
-        j = 0;
-        for(j_cnt = 0; j_cnt < width; j_cnt++) {
-            j |= bigint_test_bit_var(scalar, comb_param_d*j_cnt + digit, param->order_n_data.words) << j_cnt;
-        }
+        eccp_jacobian_point_double(result, result, param);
+        for(block = 0; block < blocks; block++) {
+            j = 0;
+            for(j_cnt = 0; j_cnt < width; j_cnt++) {
+                j |= bigint_test_bit_var(scalar, comb_param_d*j_cnt + comb_param_e*block + digit, param->order_n_data.words) << j_cnt;
+            }
 
-        if(j > 0) {
-            eccp_jacobian_point_add_affine(&result_projective, &result_projective, &table[j-1], param);
+            if(j > 0) {
+                eccp_jacobian_point_add_affine(result, result, &table[block*tbl_size + j-1], param);
+            }
         }
         digit--;
     }
+}
+
+/**
+ * Performs a point scalar multiplication with a fixed base point
+ * (see eccp_jacobian_point_multiply_COMB_projective).
+ * @param result the resulting point
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters (includes pre-computation table)
+ */
+void eccp_jacobian_point_multiply_COMB( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param ) {
+    eccp_point_projective_t result_projective;
 
+    eccp_jacobian_point_multiply_COMB_projective(&result_projective, scalar, param);
     eccp_jacobian_to_affine(result, &result_projective, param);
 }
 
 /**
- * Initializes the pre-computation table for eccp_jacobian_point_multiply_COMB
- * @param param elliptic curve parameters
+ * Computes the pre-computation table for eccp_jacobian_point_multiply_COMB
+ * (or eccp_modified_jacobian_point_multiply_COMB if a is neither 0 nor -3)
+ * and sets it as base_point_precomputed_table.
+ * @param param elliptic curve parameters (with base_point_precomputed_table_width and _blocks)
+ * @param table_storage writable storage of JCB_COMB_BLOCKS_TBL_SIZE(width, blocks) points
  *
- * Hankerson Page 106 Algorithm 3.44
+ * Hankerson Page 106 Algorithm 3.44 (Lim-Lee variant with multiple tables)
  */
-void eccp_jacobian_point_multiply_COMB_precompute( eccp_parameters_t *param ) {
+void eccp_jacobian_point_multiply_COMB_precompute( eccp_parameters_t *param, eccp_point_affine_t *table_storage ) {
     int width = param->base_point_precomputed_table_width;
-    eccp_point_affine_t *table = param->base_point_precomputed_table;
-    int comb_param_d = (param->order_n_data.bits - 1) / width + 1;  // same as ceil (bits / width)
+    int blocks = JCB_COMB_BLOCKS( param );
+    int tbl_size = JCB_COMB_TBL_SIZE( width );
+    eccp_point_affine_t *table;
+    int comb_param_e = (param->order_n_data.bits - 1) / (width * blocks) + 1;  // same as ceil (bits / (width * blocks))
+    int comb_param_d = comb_param_e * blocks;
     eccp_point_projective_t temp;
-    int i,j;
-    
-    eccp_affine_to_jacobian(&temp, &param->base_point, param);
-    eccp_affine_point_copy(&table[0], &param->base_point, param);
-    
-    // compute necessary doubles
-    for(i = 1; i < width; i++) {
-        for(j = 0; j < comb_param_d; j++) {
-            eccp_jacobian_point_double(&temp, &temp, param);
+    int block,i,j;
+
+    for(block = 0; block < blocks; block++) {
+        table = &table_storage[block * tbl_size];
+        if(block == 0) {
+            eccp_affine_point_copy(&table[0], &param->base_point, param);
+        } else {
+            // the first entry of each block is 2^e times the first entry of the previous block
+            eccp_affine_to_jacobian(&temp, &table[-tbl_size], param);
+            for(j = 0; j < comb_param_e; j++) {
+                eccp_jacobian_point_double(&temp, &temp, param);
+            }
+            eccp_jacobian_to_affine(&table[0], &temp, param);
+        }
+        eccp_affine_to_jacobian(&temp, &table[0], param);
+
+        // compute necessary doubles
+        for(i = 1; i < width; i++) {
+            for(j = 0; j < comb_param_d; j++) {
+                eccp_jacobian_point_double(&temp, &temp, param);
+            }
+            eccp_jacobian_to_affine(&table[(1 << i) - 1], &temp, param);
+            for(j = 1 << i; j < (1 << (i + 1)) - 1; j++) {
+                eccp_affine_point_add(&table[j], &table[(1 << i) - 1], &table[j - (1 << i)], param);
+            }
         }
-        eccp_jacobian_to_affine(&table[(1 << i) - 1], &temp, param);
-        for(j = 1 << i; j < (1 << (i + 1)) - 1; j++) {
-            eccp_affine_point_add(&table[j], &table[(1 << i) - 1], &table[j - (1 << i)], param);
+    }
+    param->base_point_precomputed_table = table_storage;
+    if( eccp_modified_jacobian_is_preferable( param ) ) {
+        param->eccp_mul_base_point = &eccp_modified_jacobian_point_multiply_COMB;
+    } else {
+        param->eccp_mul_base_point = &eccp_jacobian_point_multiply_COMB;
+    }
+}
+
+/**
+ * Performs a point scalar multiplication with a fixed base point using the
+ * packed comb table (see eccp_jacobian_point_multiply_COMB_pack_table). Same
+ * algorithm as eccp_jacobian_point_multiply_COMB, but the table entries only
+ * occupy ECCP_PACKED_POINT_WORDS words, which reduces the cache footprint.
+ * @param result the resulting point
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters (includes the packed pre-computation table)
+ */
+void eccp_jacobian_point_multiply_COMB_packed( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param ) {
+    int width = param->base_point_precomputed_table_width;
+    int blocks = JCB_COMB_BLOCKS( param );
+    int tbl_size = JCB_COMB_TBL_SIZE( width );
+    const uint_t *table = param->base_point_precomputed_table_packed;
+    const uint_t *entry;
+    eccp_point_projective_t result_projective;
+    int digit, block, j, j_cnt;
+    int comb_param_e = (param->order_n_data.bits - 1) / (width * blocks) + 1;  // same as ceil (bits / (width * blocks))
+    int comb_param_d = comb_param_e * blocks;
+    result_projective.identity = 1;
+
+    digit = comb_param_e - 1;
+    while(digit >= 0) {
+        eccp_jacobian_point_double(&result_projective, &result_projective, param);
+        for(block = 0; block < blocks; block++) {
+            j = 0;
+            for(j_cnt = 0; j_cnt < width; j_cnt++) {
+                j |= bigint_test_bit_var(scalar, comb_param_d*j_cnt + comb_param_e*block + digit, param->order_n_data.words) << j_cnt;
+            }
+
+            if(j > 0) {
+                // the entries are added straight from the packed words (x followed by y)
+                entry = &table[(block*tbl_size + j-1) * ECCP_PACKED_POINT_WORDS( param )];
+                eccp_jacobian_point_add_affine_xy(&result_projective, &result_projective, entry,
+                                                  entry + param->prime_data.words, param);
+            }
         }
+        digit--;
+    }
+
+    eccp_jacobian_to_affine(result, &result_projective, param);
+}
+
+/**
+ * Packs the table computed by eccp_jacobian_point_multiply_COMB_precompute and
+ * selects eccp_jacobian_point_multiply_COMB_packed as eccp_mul_base_point
+ * (eccp_modified_jacobian_point_multiply_COMB_packed if a is neither 0 nor -3).
+ * @param param elliptic curve parameters (with a computed COMB table)
+ * @param packed the destination of the packed table
+ *        (JCB_COMB_BLOCKS_TBL_SIZE(width, blocks) * ECCP_PACKED_POINT_WORDS words)
+ */
+void eccp_jacobian_point_multiply_COMB_pack_table( eccp_parameters_t *param, uint_t *packed ) {
+    int tbl_size = JCB_COMB_BLOCKS_TBL_SIZE( param->base_point_precomputed_table_width, JCB_COMB_BLOCKS( param ) );
+
+    eccp_affine_points_pack( packed, param->base_point_precomputed_table, tbl_size, param );
+    param->base_point_precomputed_table_packed = packed;
+    if( eccp_modified_jacobian_is_preferable( param ) ) {
+        param->eccp_mul_base_point = &eccp_modified_jacobian_point_multiply_COMB_packed;
+    } else {
+        param->eccp_mul_base_point = &eccp_jacobian_point_multiply_COMB_packed;
     }
-    param->eccp_mul_base_point = &eccp_jacobian_point_multiply_COMB;
 }
 
 /**
  * Performs a point scalar multiplication with a fixed base point. 
  * Should be constant time. Should perform point additions width identity (except initialization).
- * @param result the resulting point
+ * @param result the resulting point in Jacobian coordinates (not normalized)
  * @param scalar the multiplicant
  * @param param elliptic curve parameters (includes pre-computation table)
  *
@@ -600,23 +789,22 @@ void eccp_jacobian_point_multiply_COMB_precompute( eccp_parameters_t *param ) {
  * 
  * TODO: UNTESTED!!
  */
-void eccp_jacobian_point_multiply_COMB_WOZ( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param ) {
+void eccp_jacobian_point_multiply_COMB_WOZ_projective( eccp_point_projective_t *result, const gfp_t scalar, const eccp_parameters_t *param ) {
     int width = param->base_point_precomputed_table_width;
     int comb_param_d = (param->order_n_data.bits - 1) / width + 1;  // same as ceil (bits / width)
     int tbl_size = JCB_COMB_WOZ_TBL_SIZE(width);
-    eccp_point_affine_t *table = param->base_point_precomputed_table;
-    eccp_point_projective_t result_projective;
+    const eccp_point_affine_t *table = param->base_point_precomputed_table;
     eccp_point_affine_t temp;
     int digit, index, j;
     int to_invert;
-    result_projective.identity = 1;
+    result->identity = 1;
 
     digit = comb_param_d;
     index = 0;
     for(j = 0; j < width - 1; j++) {
         index |= bigint_test_bit_var(scalar, comb_param_d*j + digit, param->order_n_data.words) << j;
     }
-    eccp_affine_to_jacobian(&result_projective, &table[index], param);
+    eccp_affine_to_jacobian(result, &table[index], param);
 
     digit--;
     while(digit > 0) {
@@ -633,22 +821,65 @@ void eccp_jacobian_point_multiply_COMB_WOZ( eccp_point_affine_t *result, const g
             eccp_affine_point_copy(&temp, &table[index], param);
         }
         
-        eccp_jacobian_point_double(&result_projective, &result_projective, param);
-        eccp_jacobian_point_add_affine(&result_projective, &result_projective, &temp, param);
+        eccp_jacobian_point_double(result, result, param);
+        eccp_jacobian_point_add_affine(result, result, &temp, param);
         digit--;
     }
 
     if(bigint_test_bit_var(scalar, 0, param->order_n_data.words) == 0) {
         eccp_affine_point_negate(&temp, &param->base_point, param);
-        eccp_jacobian_point_add_affine(&result_projective, &result_projective, &temp, param);
+        eccp_jacobian_point_add_affine(result, result, &temp, param);
     }
+}
+
+/**
+ * Performs a point scalar multiplication with a fixed base point
+ * (see eccp_jacobian_point_multiply_COMB_WOZ_projective).
+ * @param result the resulting point
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters (includes pre-computation table)
+ */
+void eccp_jacobian_point_multiply_COMB_WOZ( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param ) {
+    eccp_point_projective_t result_projective;
 
+    eccp_jacobian_point_multiply_COMB_WOZ_projective(&result_projective, scalar, param);
     eccp_jacobian_to_affine(result, &result_projective, param);
 }
 
 /**
- * Initializes the pre-computation table for eccp_jacobian_point_multiply_COMB_WOZ
+ * Multiplies the base point with a scalar using param->eccp_mul_base_point but
+ * returns the result in Jacobian coordinates, such that the caller can
+ * normalize several results at once (e.g., eccp_batch_normalize). Multiplications
+ * without a Jacobian variant fall back to param->eccp_mul_base_point (or
+ * param->eccp_mul) and return a point with z = 1.
+ * @param result the resulting point in Jacobian coordinates
+ * @param scalar the multiplicant
  * @param param elliptic curve parameters
+ */
+void eccp_jacobian_point_multiply_base_point( eccp_point_projective_t *result, const gfp_t scalar, const eccp_parameters_t *param ) {
+    eccp_point_affine_t result_affine;
+    int has_table = ( param->base_point_precomputed_table != NULL );
+
+    if( has_table && ( param->eccp_mul_base_point == &eccp_jacobian_point_multiply_COMB ) ) {
+        eccp_jacobian_point_multiply_COMB_projective( result, scalar, param );
+    } else if( has_table && ( param->eccp_mul_base_point == &eccp_jacobian_point_multiply_COMB_WOZ ) ) {
+        eccp_jacobian_point_multiply_COMB_WOZ_projective( result, scalar, param );
+    } else if( has_table && ( param->eccp_mul_base_point == &eccp_protected_point_multiply_COMB_WOZ ) ) {
+        eccp_protected_point_multiply_COMB_WOZ_projective( result, scalar, param );
+    } else {
+        eccp_generic_mul_wrapper( &result_affine, &param->base_point, scalar, param );
+        eccp_affine_to_jacobian( result, &result_affine, param );
+    }
+}
+
+/**
+ * Computes the pre-computation table for eccp_jacobian_point_multiply_COMB_WOZ
+ * (or eccp_modified_jacobian_point_multiply_COMB_WOZ if a is neither 0 nor -3)
+ * and sets it as base_point_precomputed_table.
+ * @param param elliptic curve parameters (with base_point_precomputed_table_width)
+ * @param table writable storage of JCB_COMB_WOZ_TBL_SIZE(width) points
+ * @param constant_time if 1, eccp_protected_point_multiply_COMB_WOZ is selected as
+ *        eccp_mul_base_point (for secret scalars, e.g., ECDSA nonces and private keys)
  *
  * Based on Algorithm 2 in 
  * Zhe Liu, Erich Wenger, Johann Großschädl - "MoTE-ECC: Energy-Scalable Elliptic Curve Cryptography for Wireless Sensor Networks"
@@ -657,9 +888,8 @@ void eccp_jacobian_point_multiply_COMB_WOZ( eccp_point_affine_t *result, const g
  * 
  * computes (2^(d*(w-1)) +/- 2^(d*(w-2)) +/- ... +/- 2^(d) +/- 2^) * P
  */
-void eccp_jacobian_point_multiply_COMB_WOZ_precompute( eccp_parameters_t *param ) {
+void eccp_jacobian_point_multiply_COMB_WOZ_precompute( eccp_parameters_t *param, eccp_point_affine_t *table, const int constant_time ) {
     int width = param->base_point_precomputed_table_width;
-    eccp_point_affine_t *table = param->base_point_precomputed_table;
     int comb_param_d = (param->order_n_data.bits - 1) / width + 1;  // same as ceil (bits / width)
     int tbl_size = JCB_COMB_WOZ_TBL_SIZE(width);
     eccp_point_affine_t temp_a;
@@ -691,7 +921,14 @@ void eccp_jacobian_point_multiply_COMB_WOZ_precompute( eccp_parameters_t *param
         eccp_affine_point_add(&table[j], &table[j], &temp_a, param);
     }
     
-    param->eccp_mul_base_point = &eccp_jacobian_point_multiply_COMB_WOZ;
+    param->base_point_precomputed_table = table;
+    if( constant_time ) {
+        param->eccp_mul_base_point = &eccp_protected_point_multiply_COMB_WOZ;
+    } else if( eccp_modified_jacobian_is_preferable( param ) ) {
+        param->eccp_mul_base_point = &eccp_modified_jacobian_point_multiply_COMB_WOZ;
+    } else {
+        param->eccp_mul_base_point = &eccp_jacobian_point_multiply_COMB_WOZ;
+    }
 }
 
 
@@ -59,6 +59,11 @@ void eccp_jacobian_point_add_affine( eccp_point_projective_t *res,
                                      const eccp_point_projective_t *a,
                                      const eccp_point_affine_t *b,
                                      const eccp_parameters_t *param );
+void eccp_jacobian_point_add_affine_xy( eccp_point_projective_t *res,
+                                        const eccp_point_projective_t *a,
+                                        const uint_t *bx,
+                                        const uint_t *by,
+                                        const eccp_parameters_t *param );
 void eccp_jacobian_point_negate( eccp_point_projective_t *res, const eccp_point_projective_t *P, const eccp_parameters_t *param );
 
 void eccp_jacobian_point_multiply_L2R_DA( eccp_point_affine_t *result,
@@ -67,17 +72,39 @@ void eccp_jacobian_point_multiply_L2R_DA( eccp_point_affine_t *result,
                                           const eccp_parameters_t *param );
 void eccp_jacobian_point_multiply_R2L_DA( eccp_point_affine_t *result, const eccp_point_affine_t *P, const gfp_t scalar, const eccp_parameters_t *param );
 void eccp_jacobian_point_multiply_L2R_NAF( eccp_point_affine_t *result, const eccp_point_affine_t *P, const gfp_t scalar, const eccp_parameters_t *param );
+void eccp_jacobian_point_multiply_shamir( eccp_point_projective_t *result,
+                                          const eccp_point_affine_t *P,
+                                          const gfp_t k,
+                                          const eccp_point_affine_t *Q,
+                                          const gfp_t l,
+                                          const eccp_parameters_t *param );
 
 /** convert a table width size in bits to the actual table size */
 #define JCB_COMB_TBL_SIZE(width) ((1 << width) - 1)
+/** the total table size of a comb table consisting of multiple blocks (Lim-Lee) */
+#define JCB_COMB_BLOCKS_TBL_SIZE(width, blocks) ((blocks) * JCB_COMB_TBL_SIZE(width))
+/** the number of comb blocks configured within the eccp_parameters_t (0 is treated as 1) */
+#define JCB_COMB_BLOCKS(param) ((param)->base_point_precomputed_table_blocks > 1 ? (int)(param)->base_point_precomputed_table_blocks : 1)
 
+void eccp_jacobian_point_multiply_COMB_projective( eccp_point_projective_t *result, const gfp_t scalar, const eccp_parameters_t *param );
+void eccp_jacobian_point_multiply_COMB_table( eccp_point_projective_t *result,
+                                              const gfp_t scalar,
+                                              const eccp_point_affine_t *table,
+                                              const int width,
+                                              const int blocks,
+                                              const eccp_parameters_t *param );
 void eccp_jacobian_point_multiply_COMB( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param );
-void eccp_jacobian_point_multiply_COMB_precompute( eccp_parameters_t *param );
+void eccp_jacobian_point_multiply_COMB_precompute( eccp_parameters_t *param, eccp_point_affine_t *table_storage );
+void eccp_jacobian_point_multiply_COMB_packed( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param );
+void eccp_jacobian_point_multiply_COMB_pack_table( eccp_parameters_t *param, uint_t *packed );
 
 /** convert a table width size in bits to the actual table size */
 #define JCB_COMB_WOZ_TBL_SIZE(width) (1 << (width - 1))
 
+void eccp_jacobian_point_multiply_COMB_WOZ_projective( eccp_point_projective_t *result, const gfp_t scalar, const eccp_parameters_t *param );
 void eccp_jacobian_point_multiply_COMB_WOZ( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param );
-void eccp_jacobian_point_multiply_COMB_WOZ_precompute( eccp_parameters_t *param );
+void eccp_jacobian_point_multiply_COMB_WOZ_precompute( eccp_parameters_t *param, eccp_point_affine_t *table, const int constant_time );
+
+void eccp_jacobian_point_multiply_base_point( eccp_point_projective_t *result, const gfp_t scalar, const eccp_parameters_t *param );
 
 #endif /* ECCP_JACOBIAN_H_ */
@@ -0,0 +1,570 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#include "eccp_modified_jacobian.h"
+#include "../gfp/gfp.h"
+#include "../bi/bi.h"
+#include "eccp_affine.h"
+#include "eccp_jacobian.h"
+#include "eccp_packed.h"
+
+/**
+ * Returns 1 if modified Jacobian coordinates pay off for the given curve. This
+ * is the case if the curve parameter a is neither 0 nor -3, because then every
+ * Jacobian doubling has to recompute Z^4 and a*Z^4.
+ * @param param elliptic curve parameters
+ * @return 1 if modified Jacobian coordinates should be used, otherwise 0
+ */
+int eccp_modified_jacobian_is_preferable( const eccp_parameters_t *param ) {
+    gfp_t one, minus_three;
+
+    if( gfp_is_zero( param->param_a ) )
+        return 0;
+
+    if( param->prime_data.montgomery_domain == 1 ) {
+        gfp_copy( one, param->prime_data.gfp_one );
+    } else {
+        gfp_clear( one );
+        one[0] = 1;
+    }
+    gfp_add( minus_three, one, one );
+    gfp_add( minus_three, minus_three, one );
+    gfp_negate( minus_three, minus_three );
+
+    return !gfp_is_equal( minus_three, param->param_a );
+}
+
+/**
+ *  Copies a modified Jacobian elliptic curve point.
+ *  @param dest the destination memory
+ *  @param src the source memory
+ *  @param param elliptic curve parameters
+ */
+void eccp_modified_jacobian_point_copy( eccp_point_modified_jacobian_t *dest,
+                                        const eccp_point_modified_jacobian_t *src,
+                                        const eccp_parameters_t *param ) {
+    dest->identity = src->identity;
+    gfp_copy( dest->x, src->x );
+    gfp_copy( dest->y, src->y );
+    gfp_copy( dest->z, src->z );
+    gfp_copy( dest->az4, src->az4 );
+}
+
+/**
+ * Transforms a modified Jacobian point to an affine point
+ * @param res the resulting affine point
+ * @param a   the modified Jacobian point
+ * @param param elliptic curve parameters
+ */
+void eccp_modified_jacobian_to_affine( eccp_point_affine_t *res,
+                                       const eccp_point_modified_jacobian_t *a,
+                                       const eccp_parameters_t *param ) {
+    gfp_t T1, T2;
+
+    res->identity = a->identity;
+    if( res->identity == 1 ) {
+        return;
+    }
+    if( gfp_is_zero( a->z ) == 1 ) {
+        res->identity = 1;
+        return;
+    }
+
+    gfp_inverse( T1, a->z );
+    gfp_square( T2, T1 );
+    gfp_multiply( res->x, a->x, T2 );
+    gfp_multiply( res->y, a->y, T2 );
+    gfp_multiply( res->y, res->y, T1 );
+}
+
+/**
+ * Converts an affine point to a modified Jacobian point.
+ * @param res the resulting modified Jacobian point
+ * @param a   the given affine point
+ * @param param elliptic curve parameters
+ */
+void eccp_affine_to_modified_jacobian( eccp_point_modified_jacobian_t *res,
+                                       const eccp_point_affine_t *a,
+                                       const eccp_parameters_t *param ) {
+    gfp_copy( res->x, a->x );
+    gfp_copy( res->y, a->y );
+    gfp_copy( res->z, param->prime_data.gfp_one );
+    gfp_copy( res->az4, param->param_a );
+    res->identity = a->identity;
+}
+
+/**
+ * Doubles the given point in modified Jacobian coordinates
+ * @param res the doubled point
+ * @param a the point to double
+ * @param param elliptic curve parameters
+ *
+ * Cost: 4M + 4S (dbl-2009-bl with S computed as 2*X1*A)
+ *
+ *     XX = X1^2
+ *     A = 2*Y1^2
+ *     U = 2*A^2
+ *     S = 2*X1*A
+ *     M = 3*XX + T1
+ *     X3 = M^2 - 2*S
+ *     Y3 = M*(S-X3) - U
+ *     Z3 = 2*Y1*Z1
+ *     T3 = 2*U*T1
+ */
+void eccp_modified_jacobian_point_double( eccp_point_modified_jacobian_t *res,
+                                          const eccp_point_modified_jacobian_t *a,
+                                          const eccp_parameters_t *param ) {
+    gfp_t T1;
+    gfp_t T2;
+    gfp_t T3;
+    gfp_t T4;
+
+    /* only double if point isn't infinite */
+    if( a->identity == 1 ) {
+        res->identity = 1;
+        return;
+    }
+
+    if( gfp_is_zero( a->y ) ) {
+        // this handles the special case of doubling a point of order 2
+        res->identity = 1;
+        return;
+    }
+
+    gfp_square( T1, a->x );
+    gfp_add( T2, T1, T1 );
+    gfp_add( T1, T2, T1 );
+    gfp_add( T1, T1, a->az4 ); // M = 3*XX + T1
+    gfp_square( T2, a->y );
+    gfp_add( T2, T2, T2 ); // A = 2*Y1^2
+    gfp_multiply( T3, a->x, T2 );
+    gfp_add( T3, T3, T3 ); // S = 2*X1*A
+    gfp_square( T4, T2 );
+    gfp_add( T4, T4, T4 ); // U = 2*A^2
+    gfp_multiply( T2, a->y, a->z );
+    gfp_add( res->z, T2, T2 ); // Z3 = 2*Y1*Z1
+    gfp_multiply( T2, T4, a->az4 );
+    gfp_add( res->az4, T2, T2 ); // T3 = 2*U*T1
+    gfp_square( res->x, T1 );
+    gfp_subtract( res->x, res->x, T3 );
+    gfp_subtract( res->x, res->x, T3 ); // X3 = M^2 - 2*S
+    gfp_subtract( T3, T3, res->x );
+    gfp_multiply( T2, T1, T3 );
+    gfp_subtract( res->y, T2, T4 ); // Y3 = M*(S-X3) - U
+    res->identity = 0;
+}
+
+/**
+ * Add two points in modified Jacobian coordinates.
+ * Uses the Jacobian addition (see eccp_jacobian_point_add) and additionally
+ * computes T3 = a*Z3^4.
+ * @param res the sum
+ * @param a first summand
+ * @param b second summand
+ * @param param elliptic curve parameters
+ */
+void eccp_modified_jacobian_point_add( eccp_point_modified_jacobian_t *res,
+                                       const eccp_point_modified_jacobian_t *a,
+                                       const eccp_point_modified_jacobian_t *b,
+                                       const eccp_parameters_t *param ) {
+    gfp_t T1;
+    gfp_t T2;
+    gfp_t T3;
+    gfp_t T4;
+    gfp_t T5;
+    gfp_t T6;
+
+    /* if A is infinite, B is returned */
+    if( a->identity == 1 ) {
+        eccp_modified_jacobian_point_copy( res, b, param );
+        return;
+    }
+    /* if B is infinite, A is returned */
+    if( b->identity == 1 ) {
+        eccp_modified_jacobian_point_copy( res, a, param );
+        return;
+    }
+
+    gfp_square( T1, a->z );       // Z1Z1
+    gfp_square( T2, b->z );       // Z2Z2
+    gfp_multiply( T3, a->x, T2 ); // U1 = X1*Z2Z2
+    gfp_multiply( T4, b->x, T1 ); // U2 = X2*Z1Z1
+    gfp_multiply( T5, T1, a->z );
+    gfp_multiply( T6, T2, b->z );
+    gfp_add( T1, T1, T2 );        // Z1Z1+Z2Z2
+    gfp_multiply( T2, a->y, T6 ); // S1 = Y1*Z2*Z2Z2
+    gfp_multiply( T6, b->y, T5 ); // S2 = Y2*Z1*Z1Z1
+
+    if( gfp_is_equal( T3, T4 ) ) {
+        if( gfp_is_equal( T2, T6 ) ) {
+            // CASE: A is equal to B
+            eccp_modified_jacobian_point_double( res, a, param );
+            return;
+        } else {
+            // CASE: -A is equal to B
+            res->identity = 1;
+            return;
+        }
+    }
+
+    gfp_subtract( T4, T4, T3 ); // H = U2-U1
+    gfp_subtract( T6, T6, T2 );
+    gfp_add( T6, T6, T6 ); // r = 2*(S2-S1)
+    gfp_add( res->z, a->z, b->z );
+    gfp_square( T5, res->z );
+    gfp_subtract( T5, T5, T1 );
+    gfp_multiply( res->z, T5, T4 ); // Z3 = ((Z1+Z2)^2-Z1Z1-Z2Z2)*H
+    gfp_add( T5, T4, T4 );
+    gfp_square( T1, T5 );       // I = (2*H)^2
+    gfp_multiply( T5, T3, T1 ); // V = U1*I
+    gfp_multiply( T3, T4, T1 ); // J = H*I
+    gfp_square( res->x, T6 );
+    gfp_subtract( res->x, res->x, T3 );
+    gfp_subtract( res->x, res->x, T5 );
+    gfp_subtract( res->x, res->x, T5 ); // X3 = r^2-J-2*V
+    gfp_subtract( T5, T5, res->x );
+    gfp_multiply( res->y, T6, T5 );
+    gfp_multiply( T1, T2, T3 );
+    gfp_subtract( res->y, res->y, T1 );
+    gfp_subtract( res->y, res->y, T1 ); // Y3 = r*(V-X3)-2*S1*J
+    gfp_square( T1, res->z );
+    gfp_square( T1, T1 );
+    gfp_multiply( res->az4, T1, param->param_a ); // T3 = a*Z3^4
+    res->identity = 0;
+}
+
+/**
+ * Add a modified Jacobian and an affine point
+ * @param res the sum in modified Jacobian coordinates
+ * @param a modified Jacobian point
+ * @param b affine point
+ * @param param elliptic curve parameters
+ */
+void eccp_modified_jacobian_point_add_affine( eccp_point_modified_jacobian_t *res,
+                                              const eccp_point_modified_jacobian_t *a,
+                                              const eccp_point_affine_t *b,
+                                              const eccp_parameters_t *param ) {
+    if( b->identity == 1 ) {
+        eccp_modified_jacobian_point_copy( res, a, param );
+        return;
+    }
+    eccp_modified_jacobian_point_add_affine_xy( res, a, b->x, b->y, param );
+}
+
+/**
+ * Add a modified Jacobian point and an affine point given by its coordinates
+ * (see eccp_jacobian_point_add_affine_xy).
+ * @param res the sum in modified Jacobian coordinates
+ * @param a modified Jacobian point
+ * @param bx x coordinate of the affine point (must not be the point at infinity)
+ * @param by y coordinate of the affine point
+ * @param param elliptic curve parameters
+ */
+void eccp_modified_jacobian_point_add_affine_xy( eccp_point_modified_jacobian_t *res,
+                                                 const eccp_point_modified_jacobian_t *a,
+                                                 const uint_t *bx,
+                                                 const uint_t *by,
+                                                 const eccp_parameters_t *param ) {
+    gfp_t T1;
+    gfp_t T2;
+    gfp_t T3;
+    gfp_t T4;
+
+    /* if a is infinite, b is returned */
+    if( a->identity == 1 ) {
+        gfp_copy( res->x, bx );
+        gfp_copy( res->y, by );
+        gfp_copy( res->z, param->prime_data.gfp_one );
+        gfp_copy( res->az4, param->param_a );
+        res->identity = 0;
+        return;
+    }
+
+    gfp_square( T1, a->z );
+    gfp_multiply( T2, a->z, T1 );
+    gfp_multiply( T3, bx, T1 );
+    gfp_multiply( T1, by, T2 );
+    gfp_subtract( T3, T3, a->x );
+    gfp_subtract( T1, T1, a->y );
+
+    /* Check for errors */
+    if( gfp_is_zero( T3 ) == 1 ) {
+        if( gfp_is_zero( T1 ) == 1 ) {
+            // CASE: A is equal to B
+            eccp_modified_jacobian_point_double( res, a, param );
+            return;
+        } else {
+            // CASE: -A is equal to B
+            res->identity = 1;
+            return;
+        }
+    }
+
+    gfp_multiply( T2, a->z, T3 );
+    gfp_copy( res->z, T2 );
+    gfp_square( T2, T3 );
+    gfp_multiply( T4, T2, T3 );
+    gfp_multiply( T3, T2, a->x );
+    gfp_add( T2, T3, T3 );
+    gfp_square( res->x, T1 );
+    gfp_subtract( res->x, res->x, T2 );
+    gfp_subtract( res->x, res->x, T4 );
+    gfp_subtract( T3, T3, res->x );
+    gfp_multiply( T2, T3, T1 );
+    gfp_multiply( T1, T4, a->y );
+    gfp_subtract( res->y, T2, T1 );
+    gfp_square( T1, res->z );
+    gfp_square( T1, T1 );
+    gfp_multiply( res->az4, T1, param->param_a ); // T3 = a*Z3^4
+    res->identity = 0;
+}
+
+/**
+ * Negate a given point in modified Jacobian coordinates.
+ * @param res the resulting point
+ * @param P   the point to negate
+ * @param param elliptic curve parameters
+ */
+void eccp_modified_jacobian_point_negate( eccp_point_modified_jacobian_t *res,
+                                          const eccp_point_modified_jacobian_t *P,
+                                          const eccp_parameters_t *param ) {
+    gfp_copy( res->x, P->x );
+    gfp_negate( res->y, P->y );
+    gfp_copy( res->z, P->z );
+    gfp_copy( res->az4, P->az4 );
+    res->identity = P->identity;
+}
+
+/**
+ * Performs a point scalar multiplication in modified Jacobian coordinates
+ * @param result the resulting point
+ * @param P The base point to multiply
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters
+ *
+ * Hankerson Page 98 Algorithm 3.30
+ */
+void eccp_modified_jacobian_point_multiply_L2R_NAF( eccp_point_affine_t *result,
+                                                    const eccp_point_affine_t *P,
+                                                    const gfp_t scalar,
+                                                    const eccp_parameters_t *param ) {
+    uint_t scalar_helper[WORDS_PER_BITS( MIN_BITS_PER_GFP + 1 )];
+    eccp_point_affine_t P_neg;
+    eccp_point_modified_jacobian_t result_projective;
+    int bit, scalar_helper_size = WORDS_PER_BITS( param->order_n_data.bits + 1 );
+    int carry;
+
+    // compute NAF (3 * scalar)
+    scalar_helper[scalar_helper_size - 1] = 0;
+    bigint_copy_var( scalar_helper, scalar, param->order_n_data.words );
+    bigint_shift_left_var( scalar_helper, scalar_helper, 1, scalar_helper_size );
+    carry = bigint_add_var( scalar_helper, scalar_helper, scalar, param->order_n_data.words );
+    scalar_helper[scalar_helper_size - 1] += carry;
+
+    // prepare points
+    result_projective.identity = 1;
+    eccp_affine_point_negate( &P_neg, P, param );
+
+    bit = bigint_get_msb_var( scalar_helper, scalar_helper_size );
+    while( bit > 0 ) {
+        eccp_modified_jacobian_point_double( &result_projective, &result_projective, param );
+        if( ( bigint_test_bit_var( scalar_helper, bit, scalar_helper_size ) == 1 )
+            && ( bigint_test_bit_var( scalar, bit, param->order_n_data.words ) == 0 ) ) {
+            eccp_modified_jacobian_point_add_affine( &result_projective, &result_projective, P, param );
+        } else if( ( bigint_test_bit_var( scalar_helper, bit, scalar_helper_size ) == 0 )
+                   && ( bigint_test_bit_var( scalar, bit, param->order_n_data.words ) == 1 ) ) {
+            eccp_modified_jacobian_point_add_affine( &result_projective, &result_projective, &P_neg, param );
+        }
+        bit--;
+    }
+
+    eccp_modified_jacobian_to_affine( result, &result_projective, param );
+}
+
+/**
+ * Performs a point scalar multiplication with a fixed base point in modified
+ * Jacobian coordinates. Uses the table of eccp_jacobian_point_multiply_COMB_precompute
+ * (including its base_point_precomputed_table_blocks blocks).
+ * @param result the resulting point
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters (includes pre-computation table)
+ *
+ * Hankerson Page 106 Algorithm 3.44 (Lim-Lee variant with multiple tables)
+ */
+void eccp_modified_jacobian_point_multiply_COMB( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param ) {
+    eccp_modified_jacobian_point_multiply_COMB_table( result, scalar, param->base_point_precomputed_table,
+                                                      param->base_point_precomputed_table_width, JCB_COMB_BLOCKS( param ), param );
+}
+
+/**
+ * Performs a point scalar multiplication with the given comb table of a fixed
+ * point in modified Jacobian coordinates (see eccp_modified_jacobian_point_multiply_COMB).
+ * @param result the resulting point
+ * @param scalar the multiplicant
+ * @param table the comb table of eccp_jacobian_point_multiply_COMB_precompute
+ * @param width the comb width of table
+ * @param blocks the number of comb blocks of table
+ * @param param elliptic curve parameters
+ */
+void eccp_modified_jacobian_point_multiply_COMB_table( eccp_point_affine_t *result,
+                                                       const gfp_t scalar,
+                                                       const eccp_point_affine_t *table,
+                                                       const int width,
+                                                       const int blocks,
+                                                       const eccp_parameters_t *param ) {
+    int tbl_size = JCB_COMB_TBL_SIZE( width );
+    eccp_point_modified_jacobian_t result_projective;
+    int digit, block, j, j_cnt;
+    int comb_param_e = ( param->order_n_data.bits - 1 ) / ( width * blocks ) + 1; // same as ceil (bits / (width * blocks))
+    int comb_param_d = comb_param_e * blocks;
+    result_projective.identity = 1;
+
+    digit = comb_param_e - 1;
+    while( digit >= 0 ) {
+        eccp_modified_jacobian_point_double( &result_projective, &result_projective, param );
+        for( block = 0; block < blocks; block++ ) {
+            j = 0;
+            for( j_cnt = 0; j_cnt < width; j_cnt++ ) {
+                j |= bigint_test_bit_var( scalar, comb_param_d * j_cnt + comb_param_e * block + digit, param->order_n_data.words ) << j_cnt;
+            }
+
+            if( j > 0 ) {
+                eccp_modified_jacobian_point_add_affine( &result_projective, &result_projective, &table[block * tbl_size + j - 1], param );
+            }
+        }
+        digit--;
+    }
+
+    eccp_modified_jacobian_to_affine( result, &result_projective, param );
+}
+
+/**
+ * Performs a point scalar multiplication with a fixed base point in modified
+ * Jacobian coordinates using the packed comb table (see
+ * eccp_jacobian_point_multiply_COMB_pack_table and eccp_modified_jacobian_point_multiply_COMB).
+ * @param result the resulting point
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters (includes the packed pre-computation table)
+ */
+void eccp_modified_jacobian_point_multiply_COMB_packed( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param ) {
+    int width = param->base_point_precomputed_table_width;
+    int blocks = JCB_COMB_BLOCKS( param );
+    int tbl_size = JCB_COMB_TBL_SIZE( width );
+    const uint_t *table = param->base_point_precomputed_table_packed;
+    const uint_t *entry;
+    eccp_point_modified_jacobian_t result_projective;
+    int digit, block, j, j_cnt;
+    int comb_param_e = ( param->order_n_data.bits - 1 ) / ( width * blocks ) + 1; // same as ceil (bits / (width * blocks))
+    int comb_param_d = comb_param_e * blocks;
+    result_projective.identity = 1;
+
+    digit = comb_param_e - 1;
+    while( digit >= 0 ) {
+        eccp_modified_jacobian_point_double( &result_projective, &result_projective, param );
+        for( block = 0; block < blocks; block++ ) {
+            j = 0;
+            for( j_cnt = 0; j_cnt < width; j_cnt++ ) {
+                j |= bigint_test_bit_var( scalar, comb_param_d * j_cnt + comb_param_e * block + digit, param->order_n_data.words ) << j_cnt;
+            }
+
+            if( j > 0 ) {
+                entry = &table[( block * tbl_size + j - 1 ) * ECCP_PACKED_POINT_WORDS( param )];
+                eccp_modified_jacobian_point_add_affine_xy( &result_projective, &result_projective, entry,
+                                                            entry + param->prime_data.words, param );
+            }
+        }
+        digit--;
+    }
+
+    eccp_modified_jacobian_to_affine( result, &result_projective, param );
+}
+
+/**
+ * Performs a point scalar multiplication with a fixed base point in modified
+ * Jacobian coordinates. Uses the table of eccp_jacobian_point_multiply_COMB_WOZ_precompute.
+ * @param result the resulting point
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters (includes pre-computation table)
+ *
+ * Based on Algorithm 2 in
+ * Zhe Liu, Erich Wenger, Johann Großschädl - "MoTE-ECC: Energy-Scalable Elliptic Curve Cryptography for Wireless Sensor Networks"
+ */
+void eccp_modified_jacobian_point_multiply_COMB_WOZ( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param ) {
+    int width = param->base_point_precomputed_table_width;
+    int comb_param_d = ( param->order_n_data.bits - 1 ) / width + 1; // same as ceil (bits / width)
+    int tbl_size = JCB_COMB_WOZ_TBL_SIZE( width );
+    const eccp_point_affine_t *table = param->base_point_precomputed_table;
+    eccp_point_modified_jacobian_t result_projective;
+    eccp_point_affine_t temp;
+    int digit, index, j;
+    int to_invert;
+
+    digit = comb_param_d;
+    index = 0;
+    for( j = 0; j < width - 1; j++ ) {
+        index |= bigint_test_bit_var( scalar, comb_param_d * j + digit, param->order_n_data.words ) << j;
+    }
+    eccp_affine_to_modified_jacobian( &result_projective, &table[index], param );
+
+    digit--;
+    while( digit > 0 ) {
+        index = 0;
+        for( j = 0; j < ( width - 1 ); j++ ) {
+            index |= bigint_test_bit_var( scalar, comb_param_d * j + digit, param->order_n_data.words ) << j;
+        }
+        to_invert = bigint_test_bit_var( scalar, comb_param_d * ( width - 1 ) + digit, param->order_n_data.words );
+
+        if( !to_invert ) {
+            index = tbl_size - index - 1;
+            eccp_affine_point_negate( &temp, &table[index], param );
+        } else {
+            eccp_affine_point_copy( &temp, &table[index], param );
+        }
+
+        eccp_modified_jacobian_point_double( &result_projective, &result_projective, param );
+        eccp_modified_jacobian_point_add_affine( &result_projective, &result_projective, &temp, param );
+        digit--;
+    }
+
+    if( bigint_test_bit_var( scalar, 0, param->order_n_data.words ) == 0 ) {
+        eccp_affine_point_negate( &temp, &param->base_point, param );
+        eccp_modified_jacobian_point_add_affine( &result_projective, &result_projective, &temp, param );
+    }
+
+    eccp_modified_jacobian_to_affine( result, &result_projective, param );
+}
@@ -0,0 +1,146 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+#include "eccp_packed.h"
+#include "../bi/bi.h"
+
+/**
+ * Stores an affine point with the word size of the curve, i.e., x and y use
+ * param->prime_data.words words each (instead of WORDS_PER_GFP). The identity
+ * is encoded as x = y = 0, which is not a point on curves with b != 0.
+ * @param packed the destination (ECCP_PACKED_POINT_WORDS words)
+ * @param P the point to pack
+ * @param param elliptic curve parameters
+ */
+void eccp_affine_point_pack( uint_t *packed, const eccp_point_affine_t *P, const eccp_parameters_t *param ) {
+    int words = param->prime_data.words;
+
+    if( P->identity == 1 ) {
+        bigint_clear_var( packed, 2 * words );
+    } else {
+        bigint_copy_var( packed, P->x, words );
+        bigint_copy_var( packed + words, P->y, words );
+    }
+}
+
+/**
+ * Restores an affine point stored by eccp_affine_point_pack.
+ * @param P the resulting point
+ * @param packed the packed point (ECCP_PACKED_POINT_WORDS words)
+ * @param param elliptic curve parameters
+ */
+void eccp_affine_point_unpack( eccp_point_affine_t *P, const uint_t *packed, const eccp_parameters_t *param ) {
+    int words = param->prime_data.words;
+
+    bigint_copy_var( P->x, packed, words );
+    bigint_copy_var( P->y, packed + words, words );
+    P->identity = bigint_is_zero_var( packed, 2 * words );
+}
+
+/**
+ * Packs an array of affine points (see eccp_affine_point_pack).
+ * @param packed the destination (count * ECCP_PACKED_POINT_WORDS words)
+ * @param points the points to pack
+ * @param count the number of points
+ * @param param elliptic curve parameters
+ */
+void eccp_affine_points_pack( uint_t *packed, const eccp_point_affine_t *points, const int count, const eccp_parameters_t *param ) {
+    int i;
+
+    for( i = 0; i < count; i++ ) {
+        eccp_affine_point_pack( packed + i * ECCP_PACKED_POINT_WORDS( param ), &points[i], param );
+    }
+}
+
+/**
+ * Unpacks an array of affine points (see eccp_affine_point_unpack).
+ * @param points the resulting points
+ * @param packed the packed points (count * ECCP_PACKED_POINT_WORDS words)
+ * @param count the number of points
+ * @param param elliptic curve parameters
+ */
+void eccp_affine_points_unpack( eccp_point_affine_t *points, const uint_t *packed, const int count, const eccp_parameters_t *param ) {
+    int i;
+
+    for( i = 0; i < count; i++ ) {
+        eccp_affine_point_unpack( &points[i], packed + i * ECCP_PACKED_POINT_WORDS( param ), param );
+    }
+}
+
+/**
+ * Packs an array of affine points into a structure of arrays: the x
+ * coordinates and the y coordinates are stored consecutively with the word
+ * size of the curve. The identity is encoded as x = y = 0.
+ * @param x the destination of the x coordinates (count * param->prime_data.words words)
+ * @param y the destination of the y coordinates (count * param->prime_data.words words)
+ * @param points the points to pack
+ * @param count the number of points
+ * @param param elliptic curve parameters
+ */
+void eccp_affine_points_pack_soa( uint_t *x, uint_t *y, const eccp_point_affine_t *points, const int count, const eccp_parameters_t *param ) {
+    int words = param->prime_data.words;
+    int i;
+
+    for( i = 0; i < count; i++ ) {
+        if( points[i].identity == 1 ) {
+            bigint_clear_var( x + i * words, words );
+            bigint_clear_var( y + i * words, words );
+        } else {
+            bigint_copy_var( x + i * words, points[i].x, words );
+            bigint_copy_var( y + i * words, points[i].y, words );
+        }
+    }
+}
+
+/**
+ * Unpacks a structure of arrays stored by eccp_affine_points_pack_soa.
+ * @param points the resulting points
+ * @param x the x coordinates (count * param->prime_data.words words)
+ * @param y the y coordinates (count * param->prime_data.words words)
+ * @param count the number of points
+ * @param param elliptic curve parameters
+ */
+void eccp_affine_points_unpack_soa( eccp_point_affine_t *points, const uint_t *x, const uint_t *y, const int count, const eccp_parameters_t *param ) {
+    int words = param->prime_data.words;
+    int i;
+
+    for( i = 0; i < count; i++ ) {
+        bigint_copy_var( points[i].x, x + i * words, words );
+        bigint_copy_var( points[i].y, y + i * words, words );
+        points[i].identity = bigint_is_zero_var( x + i * words, words ) & bigint_is_zero_var( y + i * words, words );
+    }
+}
@@ -40,6 +40,8 @@
 #include "../bi/bi.h"
 #include "../utils/rand.h"
 #include "eccp_affine.h"
+#include "eccp_jacobian.h"
+#include <stddef.h>
 
 /**
  * Checks the given x, y and z coordinate, if they are a valid combination.
@@ -80,85 +82,43 @@ int eccp_protected_std_projective_point_is_valid(const gfp_t px, const gfp_t py,
 #define AVOID_CACHE_TIMING_ATTACKS 1
 
 /**
- * Performs a point scalar multiplication based on "8/16/32 shades of ECC on embedded microprocessors"
- * @param result the resulting point (set to identity when error happens) 
- * @param P The base point to multiply
+ * The Montgomery ladder of eccp_protected_point_multiply (x-only, common Z).
+ * Starts with a doubling of the (randomized) standard projective point (R1, ., R3).
+ * @param X1_out the resulting X coordinate of scalar*P (common Z_)
+ * @param X2_out the resulting X coordinate of (scalar+1)*P (common Z_)
+ * @param Z_ input: the square of the projective Y coordinate; output: the common Z coordinate
+ * @param R1 the projective X coordinate of P (overwritten)
+ * @param R3 the projective Z coordinate of P (overwritten)
+ * @param px the affine x coordinate of P
  * @param scalar the multiplicant
+ * @param ECC_curve_b_4 4*b
  * @param param elliptic curve parameters
  */
-void eccp_protected_point_multiply( eccp_point_affine_t *result,
-                                    const eccp_point_affine_t *P,
-                                    const gfp_t scalar,
-                                    const eccp_parameters_t *param ) {
-    gfp_t Z_, R1, R2, R3, R4, ECC_curve_b_4;
+static void eccp_protected_ladder( uint_t *X1_out,
+                                   uint_t *X2_out,
+                                   gfp_t Z_,
+                                   gfp_t R1,
+                                   gfp_t R3,
+                                   const gfp_t px,
+                                   const gfp_t scalar,
+                                   const gfp_t ECC_curve_b_4,
+                                   const eccp_parameters_t *param ) {
+    gfp_t R2, R4;
     int bit, bit_is_set;
+    uint_t *X1 = X1_out, *X2 = X2_out;
 #if (AVOID_CACHE_TIMING_ATTACKS == 1)
-    gfp_t X1, X2;
     int last_bit = 1;
 #else
-    gfp_t X1_, X2_;
-    uint_t *X1 = X1_, *X2 = X2_;
     uint_t* dest[2];
     dest[0] = X1;
     dest[1] = X2;
 #endif
 
-    if(P->identity == 1) {
-        result->identity = 1;
-        return;
-    }
-    
-    if(!eccp_affine_point_is_valid(P, param)) {
-        /* TODO: fancier error handling? */
-        result->identity = 1;
-        return;
-    }
-    
-    /* deal with the case that the scalar is larger than the group order */
-    if(bigint_compare_var(scalar, param->order_n_data.prime, param->order_n_data.words) >= 0) {
-        /* TODO: fancier error handling? */
-        result->identity = 1;
-        return;
-    }
-    
-    /* deal with the case that the scalar is zero */
-    if(bigint_is_zero_var(scalar, param->order_n_data.words)) {
-        result->identity = 1;
-        return;
-    }
-    
-    bigint_copy_var(R3, param->order_n_data.prime, param->order_n_data.words );
-    bigint_clear_var(R4, param->order_n_data.words );
-    R4[0] = 1;
-    bigint_subtract_var(R3, R3, R4, param->order_n_data.words);
-    
-    /* deal with the case that the scalar is (order-1) */
-    if(bigint_compare_var(scalar, R3, param->order_n_data.words) == 0) {
-        eccp_affine_point_negate(result, P, param);
-        return;
-    }
-
-    /* randomize projective coordinates */
-    gfp_rand(R4, &param->prime_data);
-    gfp_multiply(R1, P->x, R4);
-    gfp_multiply(R2, P->y, R4);
-    gfp_copy(R3, R4);
-
-    if(!eccp_protected_std_projective_point_is_valid(R1, R2, R3, R4, X1, X2, param)) {
-        /* TODO: fancier error handling? */
-        result->identity = 1;
-        return;
-    }
-    
-    gfp_add(ECC_curve_b_4, param->param_b, param->param_b);
-    gfp_add(ECC_curve_b_4, ECC_curve_b_4, ECC_curve_b_4);
-
     /* manually double the base point P */
     /* X1 = 4*X*Y^2*Z                   */
     /* X3 = (3*X^2+a*Z^2)^2 - 8*X*Y^2*Z */
     /* Z  = 4*Y^2*Z^2                   */
-    /* base point is in R1, R2, R3      */
-    gfp_square(Z_, R2);            /* Y^2 */
+    /* base point is in R1, Z_ (Y^2), R3 */
     gfp_add(Z_, Z_, Z_);             /* 2*Y^2 */
     gfp_add(R4, Z_, Z_);             /* 4*Y^2 */
     gfp_multiply(Z_, R1, R4);      /* 4*X*Y^2 */
@@ -228,7 +188,7 @@ void eccp_protected_point_multiply( eccp_point_affine_t *result,
         gfp_square(R1, X2);
         gfp_add(R2, R1, R2);
         gfp_add(R1, R1, R1);
-        gfp_multiply(X2, P->x, X1);
+        gfp_multiply(X2, px, X1);
         gfp_subtract(R3, R3, X2);
         gfp_multiply(X2, R1, R2);
         gfp_add(X2, X2, X2);
@@ -247,6 +207,74 @@ void eccp_protected_point_multiply( eccp_point_affine_t *result,
     X1 = dest[0];
     X2 = dest[1];
 #endif
+}
+
+/**
+ * Performs a point scalar multiplication based on "8/16/32 shades of ECC on embedded microprocessors"
+ * @param result the resulting point (set to identity when error happens) 
+ * @param P The base point to multiply
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters
+ */
+void eccp_protected_point_multiply( eccp_point_affine_t *result,
+                                    const eccp_point_affine_t *P,
+                                    const gfp_t scalar,
+                                    const eccp_parameters_t *param ) {
+    gfp_t Z_, R1, R2, R3, R4, ECC_curve_b_4;
+    gfp_t X1, X2;
+
+    if(P->identity == 1) {
+        result->identity = 1;
+        return;
+    }
+    
+    if(!eccp_affine_point_is_valid(P, param)) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+    
+    /* deal with the case that the scalar is larger than the group order */
+    if(bigint_compare_var(scalar, param->order_n_data.prime, param->order_n_data.words) >= 0) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+    
+    /* deal with the case that the scalar is zero */
+    if(bigint_is_zero_var(scalar, param->order_n_data.words)) {
+        result->identity = 1;
+        return;
+    }
+    
+    bigint_copy_var(R3, param->order_n_data.prime, param->order_n_data.words );
+    bigint_clear_var(R4, param->order_n_data.words );
+    R4[0] = 1;
+    bigint_subtract_var(R3, R3, R4, param->order_n_data.words);
+    
+    /* deal with the case that the scalar is (order-1) */
+    if(bigint_compare_var(scalar, R3, param->order_n_data.words) == 0) {
+        eccp_affine_point_negate(result, P, param);
+        return;
+    }
+
+    /* randomize projective coordinates */
+    gfp_rand(R4, &param->prime_data);
+    gfp_multiply(R1, P->x, R4);
+    gfp_multiply(R2, P->y, R4);
+    gfp_copy(R3, R4);
+
+    if(!eccp_protected_std_projective_point_is_valid(R1, R2, R3, R4, X1, X2, param)) {
+        /* TODO: fancier error handling? */
+        result->identity = 1;
+        return;
+    }
+    
+    gfp_add(ECC_curve_b_4, param->param_b, param->param_b);
+    gfp_add(ECC_curve_b_4, ECC_curve_b_4, ECC_curve_b_4);
+
+    gfp_square(Z_, R2);            /* Y^2 */
+    eccp_protected_ladder(X1, X2, Z_, R1, R3, P->x, scalar, ECC_curve_b_4, param);
 
     /* y-recovery (taken from Hutter) */
     gfp_multiply(R1, P->x, Z_);
@@ -307,4 +335,311 @@ void eccp_protected_point_multiply( eccp_point_affine_t *result,
     }
 }
 
+/**
+ * Performs an x-only point scalar multiplication (Montgomery ladder of
+ * eccp_protected_point_multiply without y-recovery).
+ * If py is NULL, the point is validated by checking that x^3+ax+b is a
+ * quadratic residue (Euler's criterion), otherwise by the curve equation.
+ * @param result_x the x coordinate of scalar*P
+ * @param px the x coordinate of P
+ * @param py the y coordinate of P (may be NULL)
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters
+ * @return 1 on success, 0 if P is invalid or scalar*P is the point at infinity
+ */
+int eccp_protected_point_multiply_x_only( gfp_t result_x,
+                                          const gfp_t px,
+                                          const gfp_t py,
+                                          const gfp_t scalar,
+                                          const eccp_parameters_t *param ) {
+    gfp_t Z_, R1, R2, R3, R4, ECC_curve_b_4;
+    gfp_t X1, X2;
+
+    if(bigint_compare_var(px, param->prime_data.prime, param->prime_data.words) >= 0) {
+        return 0;
+    }
+
+    /* y^2 = x^3 + a*x + b */
+    gfp_square(R1, px);
+    gfp_multiply(R2, R1, px);
+    gfp_multiply(R1, px, param->param_a);
+    gfp_add(R2, R2, R1);
+    gfp_add(R2, R2, param->param_b);
+
+    if(py != NULL) {
+        if(bigint_compare_var(py, param->prime_data.prime, param->prime_data.words) >= 0) {
+            return 0;
+        }
+        gfp_square(R1, py);
+        if(!gfp_is_equal(R1, R2)) {
+            return 0;
+        }
+    } else {
+        /* (p-1)/2 */
+        bigint_shift_right_one_var(R3, param->prime_data.prime, param->prime_data.words);
+        gfp_exponent(R1, R2, R3, param->prime_data.words);
+        if(!gfp_is_equal(R1, param->prime_data.gfp_one)) {
+            return 0;
+        }
+    }
+
+    /* deal with the cases that the scalar is zero or larger than the group order */
+    if(bigint_compare_var(scalar, param->order_n_data.prime, param->order_n_data.words) >= 0) {
+        return 0;
+    }
+    if(bigint_is_zero_var(scalar, param->order_n_data.words)) {
+        return 0;
+    }
+
+    /* deal with the case that the scalar is (order-1): x(-P) = x(P) */
+    bigint_copy_var(R3, param->order_n_data.prime, param->order_n_data.words );
+    bigint_clear_var(R4, param->order_n_data.words );
+    R4[0] = 1;
+    bigint_subtract_var(R3, R3, R4, param->order_n_data.words);
+    if(bigint_compare_var(scalar, R3, param->order_n_data.words) == 0) {
+        gfp_copy(result_x, px);
+        return 1;
+    }
+
+    /* randomize projective coordinates (Y^2 = y^2 * Z^2) */
+    gfp_rand(R3, &param->prime_data);
+    gfp_multiply(R1, px, R3);
+    gfp_square(R4, R3);
+    gfp_multiply(Z_, R2, R4);
+
+    gfp_add(ECC_curve_b_4, param->param_b, param->param_b);
+    gfp_add(ECC_curve_b_4, ECC_curve_b_4, ECC_curve_b_4);
+
+    eccp_protected_ladder(X1, X2, Z_, R1, R3, px, scalar, ECC_curve_b_4, param);
+
+    if(gfp_is_zero(Z_)) {
+        return 0;
+    }
+    gfp_inverse(R1, Z_);
+    gfp_multiply(result_x, X1, R1);
+    return 1;
+}
+
+/**
+ * Reads the entry index of a COMB_WOZ table with constant access pattern and
+ * (conditionally) negates it in constant time.
+ * @param result the selected (and possibly negated) table entry
+ * @param table the COMB_WOZ table
+ * @param index the table index
+ * @param negate if 1, the negated table entry is returned
+ * @param tbl_size the number of entries in the table
+ * @param param elliptic curve parameters
+ */
+static void eccp_protected_comb_woz_tbl_access( eccp_point_affine_t *result,
+                                                const eccp_point_affine_t *table,
+                                                const int index,
+                                                const int negate,
+                                                const int tbl_size,
+                                                const eccp_parameters_t *param ) {
+    const int words_per_entry = sizeof( eccp_point_affine_t ) / sizeof( uint_t );
+    gfp_t temp;
+
+    bigint_cr_tbl_access( result->x, table[0].x, index, tbl_size, words_per_entry, param->prime_data.words );
+    bigint_cr_tbl_access( result->y, table[0].y, index, tbl_size, words_per_entry, param->prime_data.words );
+    gfp_negate( temp, result->y );
+    bigint_cr_select_2( result->y, result->y, temp, negate, param->prime_data.words );
+    result->identity = 0;
+}
+
+/**
+ * Performs a point scalar multiplication with a fixed base point using the
+ * COMB_WOZ table (see eccp_jacobian_point_multiply_COMB_WOZ_precompute).
+ * In contrast to eccp_jacobian_point_multiply_COMB_WOZ, the table is accessed
+ * with a constant access pattern (bigint_cr_tbl_access), and the negation of
+ * the table entries and the final correction are performed without branches.
+ * Thus suited for secret scalars (e.g., as eccp_mul_base_point for signing).
+ * Exceptional cases of the point addition (e.g., scalars 1 or n-1) are still
+ * handled by branches.
+ * @param result the resulting point in Jacobian coordinates (not normalized)
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters (includes pre-computation table)
+ *
+ * Based on Algorithm 2 in
+ * Zhe Liu, Erich Wenger, Johann Großschädl - "MoTE-ECC: Energy-Scalable Elliptic Curve Cryptography for Wireless Sensor Networks"
+ */
+void eccp_protected_point_multiply_COMB_WOZ_projective( eccp_point_projective_t *result,
+                                                        const gfp_t scalar,
+                                                        const eccp_parameters_t *param ) {
+    eccp_protected_point_multiply_COMB_WOZ_table( result, scalar, &param->base_point, param->base_point_precomputed_table,
+                                                  param->base_point_precomputed_table_width, param );
+}
+
+/**
+ * Performs a point scalar multiplication in constant time with the given
+ * COMB_WOZ table of a fixed point (see eccp_protected_point_multiply_COMB_WOZ_projective).
+ * @param result the resulting point in Jacobian coordinates (not normalized)
+ * @param scalar the multiplicant
+ * @param P the fixed point of table
+ * @param table the table of eccp_jacobian_point_multiply_COMB_WOZ_precompute
+ * @param width the comb width of table
+ * @param param elliptic curve parameters
+ */
+void eccp_protected_point_multiply_COMB_WOZ_table( eccp_point_projective_t *result,
+                                                   const gfp_t scalar,
+                                                   const eccp_point_affine_t *P,
+                                                   const eccp_point_affine_t *table,
+                                                   const int width,
+                                                   const eccp_parameters_t *param ) {
+    int comb_param_d = ( param->order_n_data.bits - 1 ) / width + 1; // same as ceil (bits / width)
+    int tbl_size = JCB_COMB_WOZ_TBL_SIZE( width );
+    eccp_point_projective_t corrected;
+    eccp_point_affine_t temp;
+    int digit, index, j;
+    int to_invert, is_even;
+
+    digit = comb_param_d;
+    index = 0;
+    for( j = 0; j < width - 1; j++ ) {
+        index |= bigint_test_bit_var( scalar, comb_param_d * j + digit, param->order_n_data.words ) << j;
+    }
+    eccp_protected_comb_woz_tbl_access( &temp, table, index, 0, tbl_size, param );
+    eccp_affine_to_jacobian( result, &temp, param );
+
+    digit--;
+    while( digit > 0 ) {
+        index = 0;
+        for( j = 0; j < ( width - 1 ); j++ ) {
+            index |= bigint_test_bit_var( scalar, comb_param_d * j + digit, param->order_n_data.words ) << j;
+        }
+        to_invert = bigint_test_bit_var( scalar, comb_param_d * ( width - 1 ) + digit, param->order_n_data.words );
+
+        // same as index = tbl_size - index - 1 if to_invert == 0 (tbl_size is a power of two)
+        index ^= ( to_invert - 1 ) & ( tbl_size - 1 );
+        eccp_protected_comb_woz_tbl_access( &temp, table, index, 1 ^ to_invert, tbl_size, param );
+
+        eccp_jacobian_point_double( result, result, param );
+        eccp_jacobian_point_add_affine( result, result, &temp, param );
+        digit--;
+    }
+
+    // always compute the correction for even scalars and select the result afterwards
+    is_even = 1 ^ bigint_test_bit_var( scalar, 0, param->order_n_data.words );
+    eccp_affine_point_negate( &temp, P, param );
+    eccp_jacobian_point_add_affine( &corrected, result, &temp, param );
+    bigint_cr_select_2( result->x, result->x, corrected.x, is_even, param->prime_data.words );
+    bigint_cr_select_2( result->y, result->y, corrected.y, is_even, param->prime_data.words );
+    bigint_cr_select_2( result->z, result->z, corrected.z, is_even, param->prime_data.words );
+    result->identity = ( result->identity & ( 1 ^ is_even ) ) | ( corrected.identity & is_even );
+}
+
+/**
+ * Performs a point scalar multiplication with a fixed base point in constant
+ * time (see eccp_protected_point_multiply_COMB_WOZ_projective). Selected as
+ * eccp_mul_base_point by param_attach_const_table and
+ * eccp_jacobian_point_multiply_COMB_WOZ_precompute if constant_time is set.
+ * @param result the resulting point
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters (includes pre-computation table)
+ */
+void eccp_protected_point_multiply_COMB_WOZ( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param ) {
+    eccp_point_projective_t result_projective;
+
+    eccp_protected_point_multiply_COMB_WOZ_projective( &result_projective, scalar, param );
+    eccp_jacobian_to_affine( result, &result_projective, param );
+}
+
+/**
+ * Recodes a scalar into signed odd digits of ECCP_REGULAR_WINDOW bits
+ * (Joye, Tunstall - "Exponent Recoding and Regular Exponentiation Algorithms").
+ * Even scalars are replaced by scalar + n, which results in the same point.
+ * The recoding is independent of the point and can be shared by several
+ * multiplications with the same scalar (see eccp_protected_point_multiply_recoded).
+ * @param digits the resulting digits (least significant digit first,
+ *        ECCP_REGULAR_MAX_DIGITS entries)
+ * @param scalar the multiplicant
+ * @param param elliptic curve parameters
+ * @return the number of digits
+ */
+int eccp_protected_regular_recode( int *digits, const gfp_t scalar, const eccp_parameters_t *param ) {
+    int words = param->order_n_data.words + 1;
+    int digit_count = param->order_n_data.bits / ECCP_REGULAR_WINDOW + 1; // ceil((bits + 1) / window)
+    uint_t k[WORDS_PER_GFP + 1], k_plus_n[WORDS_PER_GFP + 1];
+    int i;
+
+    bigint_clear_var( k, words );
+    bigint_copy_var( k, scalar, param->order_n_data.words );
+    bigint_clear_var( k_plus_n, words );
+    k_plus_n[words - 1] = bigint_add_var( k_plus_n, k, param->order_n_data.prime, words - 1 );
+    bigint_cr_select_2( k, k_plus_n, k, k[0] & 1, words );
+
+    for( i = 0; i < digit_count - 1; i++ ) {
+        // digit = (k mod 2^(w+1)) - 2^w, k = (k - digit) / 2^w = (k >> w) | 1
+        digits[i] = (int)( k[0] & ( ( 1 << ( ECCP_REGULAR_WINDOW + 1 ) ) - 1 ) ) - ( 1 << ECCP_REGULAR_WINDOW );
+        bigint_shift_right_var( k, k, ECCP_REGULAR_WINDOW, words );
+        k[0] |= 1;
+    }
+    digits[digit_count - 1] = (int)k[0];
+
+    bigint_clear_var( k, words );
+    bigint_clear_var( k_plus_n, words );
+    return digit_count;
+}
+
+/**
+ * Loads the multiple |digit|*P from the table of odd multiples with a constant
+ * access pattern and negates it if the digit is negative.
+ * @param result the selected point
+ * @param table the odd multiples P, 3P, ..., (2^ECCP_REGULAR_WINDOW - 1)P
+ * @param digit an odd digit of eccp_protected_regular_recode
+ * @param param elliptic curve parameters
+ */
+static void eccp_protected_regular_tbl_access( eccp_point_projective_t *result,
+                                               const eccp_point_projective_t *table,
+                                               const int digit,
+                                               const eccp_parameters_t *param ) {
+    const int words_per_entry = sizeof( eccp_point_projective_t ) / sizeof( uint_t );
+    int sign = -( ( digit >> ( sizeof( int ) * 8 - 1 ) ) & 1 ); // -1 if negative, 0 otherwise
+    int index = ( ( digit ^ sign ) - sign - 1 ) >> 1;
+    gfp_t temp;
 
+    bigint_cr_tbl_access( result->x, table[0].x, index, ECCP_REGULAR_TBL_SIZE, words_per_entry, param->prime_data.words );
+    bigint_cr_tbl_access( result->y, table[0].y, index, ECCP_REGULAR_TBL_SIZE, words_per_entry, param->prime_data.words );
+    bigint_cr_tbl_access( result->z, table[0].z, index, ECCP_REGULAR_TBL_SIZE, words_per_entry, param->prime_data.words );
+    gfp_negate( temp, result->y );
+    bigint_cr_select_2( result->y, result->y, temp, sign & 1, param->prime_data.words );
+    result->identity = 0;
+}
+
+/**
+ * Performs a point scalar multiplication with a recoded scalar (see
+ * eccp_protected_regular_recode). Every digit costs ECCP_REGULAR_WINDOW
+ * doublings and one addition, and the table is accessed with a constant
+ * access pattern. Exceptional cases of the point addition are still handled
+ * by branches. The result is not normalized, such that several results can
+ * be converted to affine coordinates at once (eccp_batch_normalize).
+ * @param result the resulting point in Jacobian coordinates
+ * @param P the point to multiply (valid, not the identity)
+ * @param digits the recoded scalar
+ * @param digit_count the number of digits
+ * @param param elliptic curve parameters
+ */
+void eccp_protected_point_multiply_recoded( eccp_point_projective_t *result,
+                                            const eccp_point_affine_t *P,
+                                            const int *digits,
+                                            const int digit_count,
+                                            const eccp_parameters_t *param ) {
+    eccp_point_projective_t table[ECCP_REGULAR_TBL_SIZE];
+    eccp_point_projective_t double_P, temp;
+    int i, j;
+
+    // odd multiples P, 3P, 5P, ...
+    eccp_affine_to_jacobian( &table[0], P, param );
+    eccp_jacobian_point_double( &double_P, &table[0], param );
+    for( i = 1; i < ECCP_REGULAR_TBL_SIZE; i++ ) {
+        eccp_jacobian_point_add( &table[i], &table[i - 1], &double_P, param );
+    }
+
+    eccp_protected_regular_tbl_access( result, table, digits[digit_count - 1], param );
+    for( i = digit_count - 2; i >= 0; i-- ) {
+        for( j = 0; j < ECCP_REGULAR_WINDOW; j++ ) {
+            eccp_jacobian_point_double( result, result, param );
+        }
+        eccp_protected_regular_tbl_access( &temp, table, digits[i], param );
+        eccp_jacobian_point_add( result, result, &temp, param );
+    }
+}
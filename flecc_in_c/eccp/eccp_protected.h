@@ -51,10 +51,38 @@ extern "C" {
 
 #include "../types.h"
 
+/** the window size of eccp_protected_regular_recode */
+#define ECCP_REGULAR_WINDOW 4
+/** the number of odd multiples used by eccp_protected_point_multiply_recoded */
+#define ECCP_REGULAR_TBL_SIZE ( 1 << ( ECCP_REGULAR_WINDOW - 1 ) )
+/** the maximum number of digits of eccp_protected_regular_recode */
+#define ECCP_REGULAR_MAX_DIGITS ( MIN_BITS_PER_GFP / ECCP_REGULAR_WINDOW + 1 )
+
 void eccp_protected_point_multiply( eccp_point_affine_t *result,
                                     const eccp_point_affine_t *P,
                                     const gfp_t scalar,
                                     const eccp_parameters_t *param );
+int eccp_protected_point_multiply_x_only( gfp_t result_x,
+                                          const gfp_t px,
+                                          const gfp_t py,
+                                          const gfp_t scalar,
+                                          const eccp_parameters_t *param );
+void eccp_protected_point_multiply_COMB_WOZ_projective( eccp_point_projective_t *result,
+                                                        const gfp_t scalar,
+                                                        const eccp_parameters_t *param );
+void eccp_protected_point_multiply_COMB_WOZ_table( eccp_point_projective_t *result,
+                                                   const gfp_t scalar,
+                                                   const eccp_point_affine_t *P,
+                                                   const eccp_point_affine_t *table,
+                                                   const int width,
+                                                   const eccp_parameters_t *param );
+void eccp_protected_point_multiply_COMB_WOZ( eccp_point_affine_t *result, const gfp_t scalar, const eccp_parameters_t *param );
+int eccp_protected_regular_recode( int *digits, const gfp_t scalar, const eccp_parameters_t *param );
+void eccp_protected_point_multiply_recoded( eccp_point_projective_t *result,
+                                            const eccp_point_affine_t *P,
+                                            const int *digits,
+                                            const int digit_count,
+                                            const eccp_parameters_t *param );
 
 #ifdef	__cplusplus
 }
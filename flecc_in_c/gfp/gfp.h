@@ -98,17 +98,12 @@
 #undef gfp_inverse
 #undef gfp_mont_inverse
 
-void gfp_opt_3_add( gfp_t res, const gfp_t a, const gfp_t b );
-void gfp_opt_3_subtract( gfp_t res, const gfp_t a, const gfp_t b );
-void gfp_opt_3_multiply( gfp_t res, const gfp_t a, const gfp_t b );
-void gfp_opt_3_inverse( gfp_t res, const gfp_t a );
-
-#define gfp_add( res, a, b ) gfp_opt_3_add( res, a, b )
-#define gfp_subtract( res, a, b ) gfp_opt_3_subtract( res, a, b )
-#define gfp_multiply( res, a, b ) gfp_opt_3_multiply( res, a, b )
-#define gfp_mont_multiply( res, a, b, prime_data ) gfp_opt_3_multiply( res, a, b )
-#define gfp_inverse( res, a ) gfp_opt_3_inverse( res, a )
-#define gfp_mont_inverse( res, a, prime_data ) gfp_opt_3_inverse( res, a )
+#define gfp_add( res, a, b ) gfp_opt_3_add( res, a, b, &param->prime_data )
+#define gfp_subtract( res, a, b ) gfp_opt_3_subtract( res, a, b, &param->prime_data )
+#define gfp_multiply( res, a, b ) gfp_opt_3_multiply( res, a, b, &param->prime_data )
+#define gfp_mont_multiply( res, a, b, prime_data ) gfp_opt_3_multiply( res, a, b, prime_data )
+#define gfp_inverse( res, a ) gfp_opt_3_inverse( res, a, &param->prime_data )
+#define gfp_mont_inverse( res, a, prime_data ) gfp_opt_3_inverse( res, a, prime_data )
 
 #endif
 
@@ -221,6 +221,79 @@ void gfp_mont_exponent( gfp_t res, const gfp_t a, const uint_t *exponent, const
     bigint_copy_var(res, temp, prime_data->words);
 }
 
+/**
+ * Computes a square root modulo the prime using the Tonelli-Shanks algorithm
+ * (a single exponentiation if prime = 3 mod 4). Does support a=res.
+ * @param res a square root of a (if it exists)
+ * @param a the element to compute the square root of (Montgomery domain)
+ * @param prime_data the used prime data needed to do the multiplication
+ * @return 1 if a is a quadratic residue (or zero), 0 otherwise
+ *
+ * Cohen - "A Course in Computational Algebraic Number Theory", Algorithm 1.5.1
+ */
+int gfp_mont_sqrt( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data ) {
+    gfp_t q, exponent, z, c, t, r, b;
+    int words = prime_data->words;
+    int s, m, i;
+
+    if( bigint_is_zero_var( a, words ) == 1 ) {
+        bigint_clear_var( res, words );
+        return 1;
+    }
+
+    // prime - 1 = q * 2^s with q odd
+    bigint_copy_var( q, prime_data->prime, words );
+    bigint_set_bit_var( q, 0, 0, words );
+    for( s = 0; bigint_test_bit_var( q, s, words ) == 0; s++ ) {
+    }
+    bigint_shift_right_var( q, q, s, words );
+
+    // Euler's criterion: a^((prime-1)/2) has to be one
+    bigint_shift_right_one_var( exponent, prime_data->prime, words );
+    gfp_mont_exponent( t, a, exponent, words, prime_data );
+    if( bigint_is_equal_var( t, prime_data->gfp_one, words ) == 0 ) {
+        return 0;
+    }
+
+    if( s > 1 ) {
+        // find a quadratic non-residue z (2, 3, ...)
+        bigint_copy_var( z, prime_data->gfp_one, words );
+        do {
+            gfp_gen_add( z, z, prime_data->gfp_one, prime_data );
+            gfp_mont_exponent( b, z, exponent, words, prime_data );
+        } while( bigint_is_equal_var( b, prime_data->gfp_one, words ) == 1 );
+        gfp_mont_exponent( c, z, q, words, prime_data );
+    }
+
+    // r = a^((q+1)/2), t = a^q
+    bigint_shift_right_one_var( exponent, q, words );
+    bigint_clear_var( b, words );
+    b[0] = 1;
+    bigint_add_var( exponent, exponent, b, words );
+    gfp_mont_exponent( r, a, exponent, words, prime_data );
+    gfp_mont_exponent( t, a, q, words, prime_data );
+
+    m = s;
+    while( bigint_is_equal_var( t, prime_data->gfp_one, words ) == 0 ) {
+        // find the least i with t^(2^i) = 1
+        bigint_copy_var( b, t, words );
+        for( i = 0; bigint_is_equal_var( b, prime_data->gfp_one, words ) == 0; i++ ) {
+            gfp_mont_multiply( b, b, b, prime_data );
+        }
+        // b = c^(2^(m-i-1))
+        bigint_copy_var( b, c, words );
+        for( m = m - i - 1; m > 0; m-- ) {
+            gfp_mont_multiply( b, b, b, prime_data );
+        }
+        m = i;
+        gfp_mont_multiply( c, b, b, prime_data );
+        gfp_mont_multiply( t, t, c, prime_data );
+        gfp_mont_multiply( r, r, b, prime_data );
+    }
+    bigint_copy_var( res, r, words );
+    return 1;
+}
+
 /**
  * Compute the constant R, needed for montgomery multiplications
  * @param res the param R mod prime
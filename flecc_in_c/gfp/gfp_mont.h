@@ -52,6 +52,7 @@ void gfp_mont_inverse_binary( gfp_t result, const gfp_t a, const gfp_prime_data_
 void gfp_mont_exponent(
     gfp_t res, const gfp_t a, const uint_t *exponent, const int exponent_length, const gfp_prime_data_t *prime_data );
 void gfp_mont_inverse_fermat( gfp_t result, const gfp_t to_invert, const gfp_prime_data_t *prime_data);
+int gfp_mont_sqrt( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data );
 
 void gfp_mult_two_mont( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data );
 
@@ -1,27 +1,19 @@
 
 #include "types.h"
 
-uint_t *prime;
-gfp_prime_data_t *prime_data;
-
-void gfp_opt_3_init(gfp_prime_data_t *prime_data_local) {
-    prime_data = prime_data_local;
-    prime = prime_data_local->prime;
-}
-
-inline void bigint_clear( uint_t *dest ) {
+static inline void bigint_clear( uint_t *dest ) {
     dest[0] = 0;
     dest[1] = 0;
     dest[2] = 0;
 }
 
-inline void bigint_copy( uint_t *dest, const uint_t *source ) {
+static inline void bigint_copy( uint_t *dest, const uint_t *source ) {
     dest[0] = source[0];
     dest[1] = source[1];
     dest[2] = source[2];
 }
 
-inline int bigint_add( uint_t *res, const uint_t *a, const uint_t *b ) {
+static inline int bigint_add( uint_t *res, const uint_t *a, const uint_t *b ) {
     ulong_t temp;
     
     temp = (ulong_t)a[0] + (ulong_t)b[0];
@@ -33,7 +25,7 @@ inline int bigint_add( uint_t *res, const uint_t *a, const uint_t *b ) {
     return temp;
 }
 
-inline int bigint_subtract( uint_t *res, const uint_t *a, const uint_t *b ) {
+static inline int bigint_subtract( uint_t *res, const uint_t *a, const uint_t *b ) {
     slong_t temp;
     uint_t a0 = a[0], a1 = a[1], a2 = a[2];
     uint_t b0 = b[0], b1 = b[1], b2 = b[2];
@@ -47,7 +39,7 @@ inline int bigint_subtract( uint_t *res, const uint_t *a, const uint_t *b ) {
     return temp >> BITS_PER_WORD;
 }
 
-inline slong_t bigint_compare( const uint_t *a, const uint_t *b ) {
+static inline slong_t bigint_compare( const uint_t *a, const uint_t *b ) {
     slong_t temp;
     
     temp = (slong_t)a[2] - b[2];
@@ -60,7 +52,7 @@ inline slong_t bigint_compare( const uint_t *a, const uint_t *b ) {
     return temp;
 }
 
-inline int bigint_is_zero( const uint_t *a ) {
+static inline int bigint_is_zero( const uint_t *a ) {
     if( a[2] != 0)
         return 0;
     if( a[1] != 0)
@@ -70,7 +62,7 @@ inline int bigint_is_zero( const uint_t *a ) {
     return 1;
 }
 
-inline void bigint_set_bit( uint_t *a, const int bit, const int value ) {
+static inline void bigint_set_bit( uint_t *a, const int bit, const int value ) {
     int iWord, iBit;
     uint_t word;
 
@@ -99,7 +91,8 @@ void bigint_shift_right_one( uint_t *res, const uint_t *a ) {
 }
 
 
-void gfp_opt_3_add( gfp_t res, const gfp_t a, const gfp_t b ) {
+void gfp_opt_3_add( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data ) {
+    const uint_t *prime = prime_data->prime;
     int carry = bigint_add( res, a, b );
     if( carry ) {
         bigint_subtract( res, res, prime );
@@ -110,10 +103,10 @@ void gfp_opt_3_add( gfp_t res, const gfp_t a, const gfp_t b ) {
     }
 }
 
-void gfp_opt_3_subtract( gfp_t res, const gfp_t a, const gfp_t b ) {
+void gfp_opt_3_subtract( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data ) {
     int carry = bigint_subtract( res, a, b );
     if( carry ) {
-        bigint_add( res, res, prime );
+        bigint_add( res, res, prime_data->prime );
     }
 }
 
@@ -126,8 +119,8 @@ void gfp_opt_3_subtract( gfp_t res, const gfp_t a, const gfp_t b ) {
  * @param b second operand
  * @param prime_data the used prime data needed to do the multiplication
  */
-void gfp_opt_3_multiply( gfp_t res, const gfp_t a, const gfp_t b ) {
-    
+void gfp_opt_3_multiply( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data ) {
+    const uint_t *prime = prime_data->prime;
     uint_t a0 = a[0], a1 = a[1], a2 = a[2];
     uint_t b0 = b[0], b1 = b[1], b2 = b[2];
     uint_t p0 = prime[0], p1 = prime[1], p2 = prime[2];
@@ -216,13 +209,14 @@ void gfp_opt_3_multiply( gfp_t res, const gfp_t a, const gfp_t b ) {
 #define BIGINT_IS_ODD( a ) ( ( a[0] & 1 ) == 1 )
 
 /**
- * Calculate the montgomery inverse for the given globally defined constants
+ * Calculate the montgomery inverse modulo the given prime
  * based on Hankerson p. 42
  * @param res the inverse: (a * R)^1 * R^2 mod p
  * @param a the number to invert (within the montgomery domain)
  * @param prime_data the used prime data needed to do the multiplication
  */
-void gfp_opt_3_inverse( gfp_t res, const gfp_t a ) {
+void gfp_opt_3_inverse( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data ) {
+    const uint_t *prime = prime_data->prime;
     gfp_t u;
     gfp_t v;
     gfp_t x1;
@@ -264,17 +258,17 @@ void gfp_opt_3_inverse( gfp_t res, const gfp_t a ) {
 
     if( k < ( BITS_PER_WORD * length ) ) {
         bigint_copy( x2, x1 ); /* needed in case of future gfp_mont_multiply optimizations */
-        gfp_opt_3_multiply( x1, x2, prime_data->r_squared );
+        gfp_opt_3_multiply( x1, x2, prime_data->r_squared, prime_data );
         k += ( BITS_PER_WORD * length );
     }
     /* now k >= Wt */
-    gfp_opt_3_multiply( res, x1, prime_data->r_squared );
+    gfp_opt_3_multiply( res, x1, prime_data->r_squared, prime_data );
     if( k > ( BITS_PER_WORD * length ) ) {
         k = ( 2 * BITS_PER_WORD * length ) - k;
         bigint_clear( x2 );
         bigint_set_bit( x2, k, 1 );
         bigint_copy( x1, res ); /* needed in case of future gfp_mont_multiply optimizations */
-        gfp_opt_3_multiply( res, x1, x2 );
+        gfp_opt_3_multiply( res, x1, x2, prime_data );
     }
 }
 
@@ -14,11 +14,10 @@ extern "C" {
 
 #include "../types.h"
     
-void gfp_opt_3_init(gfp_prime_data_t *prime_data_local);
-void gfp_opt_3_add( gfp_t res, const gfp_t a, const gfp_t b );
-void gfp_opt_3_subtract( gfp_t res, const gfp_t a, const gfp_t b );
-void gfp_opt_3_multiply( gfp_t res, const gfp_t a, const gfp_t b );
-void gfp_opt_3_inverse( gfp_t res, const gfp_t a );
+void gfp_opt_3_add( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data );
+void gfp_opt_3_subtract( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data );
+void gfp_opt_3_multiply( gfp_t res, const gfp_t a, const gfp_t b, const gfp_prime_data_t *prime_data );
+void gfp_opt_3_inverse( gfp_t res, const gfp_t a, const gfp_prime_data_t *prime_data );
 
 #ifdef	__cplusplus
 }
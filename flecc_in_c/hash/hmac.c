@@ -0,0 +1,90 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#include "hmac.h"
+#include "sha2.h"
+
+/**
+ * Computes the HMAC-SHA256 (RFC 2104) of a message.
+ * @param mac the resulting message authentication code (HMAC_SHA256_BYTES bytes)
+ * @param key the key (keys longer than HMAC_SHA256_BLOCK_BYTES bytes are hashed first)
+ * @param key_length the length of the key in bytes
+ * @param message the message
+ * @param message_length the length of the message in bytes
+ */
+void hash_hmac_sha256( uint8_t *mac, const uint8_t *key, const int key_length, const uint8_t *message, const int message_length ) {
+    hash_sha224_256_t state;
+    uint8_t block[HMAC_SHA256_BLOCK_BYTES];
+    uint8_t inner[HMAC_SHA256_BYTES];
+    int i;
+
+    for( i = 0; i < HMAC_SHA256_BLOCK_BYTES; i++ ) {
+        block[i] = 0;
+    }
+    if( key_length > HMAC_SHA256_BLOCK_BYTES ) {
+        hash_sha256_init( &state );
+        hash_sha2_final( &state, key, key_length, key_length );
+        hash_sha256_to_byte_array( block, &state );
+    } else {
+        for( i = 0; i < key_length; i++ ) {
+            block[i] = key[i];
+        }
+    }
+
+    // inner hash: H((K ^ ipad) || message)
+    for( i = 0; i < HMAC_SHA256_BLOCK_BYTES; i++ ) {
+        block[i] ^= 0x36;
+    }
+    hash_sha256_init( &state );
+    hash_sha2_update( &state, block );
+    hash_sha2_final( &state, message, message_length, HMAC_SHA256_BLOCK_BYTES + message_length );
+    hash_sha256_to_byte_array( inner, &state );
+
+    // outer hash: H((K ^ opad) || inner)
+    for( i = 0; i < HMAC_SHA256_BLOCK_BYTES; i++ ) {
+        block[i] ^= 0x36 ^ 0x5C;
+    }
+    hash_sha256_init( &state );
+    hash_sha2_update( &state, block );
+    hash_sha2_final( &state, inner, HMAC_SHA256_BYTES, HMAC_SHA256_BLOCK_BYTES + HMAC_SHA256_BYTES );
+    hash_sha256_to_byte_array( mac, &state );
+
+    for( i = 0; i < HMAC_SHA256_BLOCK_BYTES; i++ ) {
+        block[i] = 0;
+    }
+}
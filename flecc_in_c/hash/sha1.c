@@ -39,6 +39,7 @@
 #define SHA1_C_
 
 #include "sha1.h"
+#include "../arch/x64/hash/sha_ni.h"
 
 #define leftrotate( value, bits ) ( ( ( value ) << ( bits ) ) | ( ( value ) >> ( 32 - ( bits ) ) ) )
 
@@ -117,6 +118,13 @@ void hash_sha1_update( hash_sha1_t *state, const uint8_t *message ) {
     uint32_t w[16];
     uint32_t temp;
 
+#if HASH_SHA_NI_AVAILABLE
+    if( hash_sha_ni_is_supported() ) {
+        hash_sha1_ni_process_blocks( state, message, 1 );
+        return;
+    }
+#endif
+
     /* copy message into the message block w */
     for( i = 0; i < 16 * 4; i += 4 ) {
         temp = ( (uint32_t)message[i] ) << 24;
@@ -149,6 +157,19 @@ void hash_sha1_final( hash_sha1_t *state, const uint8_t *message, const int rema
     /* debug_assert((total_length - remaining_length) % 64 == 0, "(total_length -
      * remaining_length) % 64 == 0"); */
 
+#if HASH_SHA_NI_AVAILABLE
+    if( hash_sha_ni_is_supported() ) {
+        uint8_t block[128];
+
+        hash_sha1_ni_process_blocks( state, message, remaining_length_ / 64 );
+        message += remaining_length_ & ~63;
+        remaining_length_ &= 63;
+        // the padding is built as bytes and processed like the message blocks
+        hash_sha1_ni_process_blocks( state, block, hash_sha_ni_pad( block, message, remaining_length_, total_length ) );
+        return;
+    }
+#endif
+
     while( remaining_length_ >= 64 ) {
         /* copy message into the message block w */
         for( i = 0; i < 16 * 4; i += 4 ) {
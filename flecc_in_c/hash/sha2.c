@@ -36,6 +36,8 @@
 ****************************************************************************/
 
 #include "sha2.h"
+#include "../arch/x64/hash/sha_ni.h"
+#include "../arch/x64/hash/sha256_mb.h"
 
 const uint32_t K256[64]
     = {0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL, 0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
@@ -159,6 +161,13 @@ void hash_sha2_update( hash_sha224_256_t *state, const uint8_t *message ) {
     uint32_t temp;
     int i;
 
+#if HASH_SHA_NI_AVAILABLE
+    if( hash_sha_ni_is_supported() ) {
+        hash_sha256_ni_process_blocks( state, message, 1 );
+        return;
+    }
+#endif
+
     for( i = 0; i < 16 * 4; i += 4 ) {
         temp = ( (uint32_t)message[i] ) << 24;
         temp |= ( (uint32_t)message[i + 1] ) << 16;
@@ -190,6 +199,19 @@ void hash_sha2_final( hash_sha224_256_t *state, const uint8_t *message, const in
     /* debug_assert((total_length - remaining_length) % 64 == 0, "(total_length -
      * remaining_length) % 64 == 0"); */
 
+#if HASH_SHA_NI_AVAILABLE
+    if( hash_sha_ni_is_supported() ) {
+        uint8_t block[128];
+
+        hash_sha256_ni_process_blocks( state, message, remaining_length_ / 64 );
+        message += remaining_length_ & ~63;
+        remaining_length_ &= 63;
+        // the padding is built as bytes and processed like the message blocks
+        hash_sha256_ni_process_blocks( state, block, hash_sha_ni_pad( block, message, remaining_length_, total_length ) );
+        return;
+    }
+#endif
+
     while( remaining_length_ >= 64 ) {
         /* copy message into the message block w */
         for( i = 0; i < 16 * 4; i += 4 ) {
@@ -231,6 +253,36 @@ void hash_sha2_final( hash_sha224_256_t *state, const uint8_t *message, const in
     }
 }
 
+/**
+ * Hashes independent messages with SHA256 (e.g., the messages of a batch
+ * verification). Without the SHA extension, 4 (SSE2) or 8 (AVX2) messages
+ * of similar length are hashed in parallel (see sha256_mb.h); the SHA
+ * extension hashes a single message about twice as fast as eight AVX2 lanes.
+ * @param digests the resulting states (see hash_sha256_to_byte_array), count entries
+ * @param messages the messages
+ * @param lengths the lengths of the messages in bytes
+ * @param count the number of messages
+ */
+void hash_sha256_multi( hash_sha224_256_t *digests, const uint8_t *const *messages, const int *lengths, const int count ) {
+    int i;
+
+#if HASH_SHA256_MB_AVAILABLE
+    if( hash_sha256_mb_lanes() > 0
+#if HASH_SHA_NI_AVAILABLE
+        && !hash_sha_ni_is_supported()
+#endif
+    ) {
+        hash_sha256_mb( digests, messages, lengths, count );
+        return;
+    }
+#endif
+
+    for( i = 0; i < count; i++ ) {
+        hash_sha256_init( &digests[i] );
+        hash_sha2_final( &digests[i], messages[i], lengths[i], lengths[i] );
+    }
+}
+
 /**
  *  Convert the hash state into a 224/8=28 byte long byte array.
  *  @param hash the 28 byte long array
@@ -260,3 +312,255 @@ void hash_sha256_to_byte_array( uint8_t *hash, const hash_sha224_256_t *state )
         *hash++ = state->hash[i] & 0xFF;
     }
 }
+
+const uint64_t K512[80]
+    = {0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+       0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+       0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+       0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+       0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+       0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+       0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+       0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+       0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+       0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+       0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+       0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+       0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+       0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+       0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+       0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+       0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+       0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+       0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+       0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL};
+
+#define ROTATE64( a, n ) ( ( ( a ) >> ( n ) ) | ( ( a ) << ( 64 - ( n ) ) ) )
+
+#define Sigma0_512( x ) ( ROTATE64( ( x ), 28 ) ^ ROTATE64( ( x ), 34 ) ^ ROTATE64( ( x ), 39 ) )
+#define Sigma1_512( x ) ( ROTATE64( ( x ), 14 ) ^ ROTATE64( ( x ), 18 ) ^ ROTATE64( ( x ), 41 ) )
+#define sigma0_512( x ) ( ROTATE64( ( x ), 1 ) ^ ROTATE64( ( x ), 8 ) ^ ( ( x ) >> 7 ) )
+#define sigma1_512( x ) ( ROTATE64( ( x ), 19 ) ^ ROTATE64( ( x ), 61 ) ^ ( ( x ) >> 6 ) )
+
+/* message schedule: w[i] of rounds 16 to 79 replaces w[i - 16] */
+#define SHA512_EXPAND( w, i ) \
+    ( w[( i ) & 0xf] += sigma1_512( w[( ( i ) + 14 ) & 0xf] ) + w[( ( i ) + 9 ) & 0xf] + sigma0_512( w[( ( i ) + 1 ) & 0xf] ) )
+
+/* one round; instead of moving the working variables, the callers rotate the arguments */
+#define SHA512_ROUND( a, b, c, d, e, f, g, h, i, wi )                     \
+    do {                                                                  \
+        T1 = ( h ) + Sigma1_512( e ) + Ch( e, f, g ) + K512[i] + ( wi ); \
+        ( d ) += T1;                                                      \
+        ( h ) = T1 + Sigma0_512( a ) + Maj( a, b, c );                    \
+    } while( 0 )
+
+/* eight rounds, after which the working variables are in their original positions */
+#define SHA512_ROUNDS_8( i, W )                                 \
+    do {                                                        \
+        SHA512_ROUND( a, b, c, d, e, f, g, h, ( i ) + 0, W( ( i ) + 0 ) ); \
+        SHA512_ROUND( h, a, b, c, d, e, f, g, ( i ) + 1, W( ( i ) + 1 ) ); \
+        SHA512_ROUND( g, h, a, b, c, d, e, f, ( i ) + 2, W( ( i ) + 2 ) ); \
+        SHA512_ROUND( f, g, h, a, b, c, d, e, ( i ) + 3, W( ( i ) + 3 ) ); \
+        SHA512_ROUND( e, f, g, h, a, b, c, d, ( i ) + 4, W( ( i ) + 4 ) ); \
+        SHA512_ROUND( d, e, f, g, h, a, b, c, ( i ) + 5, W( ( i ) + 5 ) ); \
+        SHA512_ROUND( c, d, e, f, g, h, a, b, ( i ) + 6, W( ( i ) + 6 ) ); \
+        SHA512_ROUND( b, c, d, e, f, g, h, a, ( i ) + 7, W( ( i ) + 7 ) ); \
+    } while( 0 )
+
+#define SHA512_W_LOAD( i ) message[i]
+#define SHA512_W_EXPAND( i ) SHA512_EXPAND( message, i )
+
+/**
+ * Initialize the state with the SHA384 initialization vector
+ * @param state the hash state
+ */
+void hash_sha384_init( hash_sha384_512_t *state ) {
+    state->hash[0] = 0xcbbb9d5dc1059ed8ULL;
+    state->hash[1] = 0x629a292a367cd507ULL;
+    state->hash[2] = 0x9159015a3070dd17ULL;
+    state->hash[3] = 0x152fecd8f70e5939ULL;
+    state->hash[4] = 0x67332667ffc00b31ULL;
+    state->hash[5] = 0x8eb44a8768581511ULL;
+    state->hash[6] = 0xdb0c2e0d64f98fa7ULL;
+    state->hash[7] = 0x47b5481dbefa4fa4ULL;
+}
+
+/**
+ * Initialize the state with the SHA512 initialization vector
+ * @param state the hash state
+ */
+void hash_sha512_init( hash_sha384_512_t *state ) {
+    state->hash[0] = 0x6a09e667f3bcc908ULL;
+    state->hash[1] = 0xbb67ae8584caa73bULL;
+    state->hash[2] = 0x3c6ef372fe94f82bULL;
+    state->hash[3] = 0xa54ff53a5f1d36f1ULL;
+    state->hash[4] = 0x510e527fade682d1ULL;
+    state->hash[5] = 0x9b05688c2b3e6c1fULL;
+    state->hash[6] = 0x1f83d9abfb41bd6bULL;
+    state->hash[7] = 0x5be0cd19137e2179ULL;
+}
+
+/**
+ * Initialize the state with the SHA512/256 initialization vector
+ * @param state the hash state
+ */
+void hash_sha512_256_init( hash_sha384_512_t *state ) {
+    state->hash[0] = 0x22312194fc2bf72cULL;
+    state->hash[1] = 0x9f555fa3c84c64c2ULL;
+    state->hash[2] = 0x2393b86b6f53b151ULL;
+    state->hash[3] = 0x963877195940eabdULL;
+    state->hash[4] = 0x96283ee2a88effe3ULL;
+    state->hash[5] = 0xbe5e1e2553863992ULL;
+    state->hash[6] = 0x2b0199fc2c85b8aaULL;
+    state->hash[7] = 0x0eb72ddc81c52ca2ULL;
+}
+
+/**
+ * Process a 1024-bit block to update the current hash state (80 rounds,
+ * unrolled by eight).
+ * @param state the hash state to update
+ * @param message already prepared uint64_t[16] array used to update the state (is overwritten during the calculation)
+ */
+static void hash_sha512_process_block( hash_sha384_512_t *state, uint64_t *message ) {
+    uint64_t a, b, c, d, e, f, g, h;
+    uint64_t T1;
+    int i;
+
+    a = state->hash[0];
+    b = state->hash[1];
+    c = state->hash[2];
+    d = state->hash[3];
+    e = state->hash[4];
+    f = state->hash[5];
+    g = state->hash[6];
+    h = state->hash[7];
+
+    SHA512_ROUNDS_8( 0, SHA512_W_LOAD );
+    SHA512_ROUNDS_8( 8, SHA512_W_LOAD );
+    for( i = 16; i < 80; i += 8 ) {
+        SHA512_ROUNDS_8( i, SHA512_W_EXPAND );
+    }
+
+    state->hash[0] += a;
+    state->hash[1] += b;
+    state->hash[2] += c;
+    state->hash[3] += d;
+    state->hash[4] += e;
+    state->hash[5] += f;
+    state->hash[6] += g;
+    state->hash[7] += h;
+}
+
+/**
+ * Converts 128 bytes to 16 big-endian 64-bit words.
+ * @param message_ul the resulting words
+ * @param message a 128 bytes long byte array
+ */
+static void hash_sha512_load_block( uint64_t *message_ul, const uint8_t *message ) {
+    uint64_t temp;
+    int i, j;
+
+    for( i = 0; i < 16; i++ ) {
+        temp = 0;
+        for( j = 0; j < 8; j++ ) {
+            temp = ( temp << 8 ) | message[8 * i + j];
+        }
+        message_ul[i] = temp;
+    }
+}
+
+/**
+ * Update the hash state with a 1024 bit large message (SHA384, SHA512, and SHA512/256).
+ * @param state the hash state to update
+ * @param message a 128 bytes long byte array
+ */
+void hash_sha512_update( hash_sha384_512_t *state, const uint8_t *message ) {
+    uint64_t message_ul[16];
+
+    hash_sha512_load_block( message_ul, message );
+    hash_sha512_process_block( state, message_ul );
+}
+
+/**
+ * Finalizes the SHA384, SHA512, or SHA512/256 hash calculation.
+ * @param state the current state of the hash calculation --> will contain the final hash value.
+ * @param message the remaining message to be signed.
+ * @param remaining_length the number of remaining bytes within "message"
+ * @param total_length the total number of bytes signed
+ *
+ * (total_length - remaining_length) should already been processed using hash_sha512_update.
+ * (total_length - remaining_length) must be a multiple of 128!!
+ */
+void hash_sha512_final( hash_sha384_512_t *state, const uint8_t *message, const int remaining_length, const int total_length ) {
+    int i, remaining_length_ = remaining_length;
+    uint64_t message_ul[16];
+
+    while( remaining_length_ >= 128 ) {
+        hash_sha512_update( state, message );
+        message += 128;
+        remaining_length_ -= 128;
+    }
+
+    /* copy message into the message block w */
+    for( i = 0; i < 16; i++ ) {
+        message_ul[i] = 0;
+    }
+    for( i = 0; i < remaining_length_; i++ ) {
+        message_ul[i / 8] |= ( (uint64_t)message[i] ) << ( ( ~i & 7 ) * 8 );
+    }
+
+    /* do message padding (the length is a 128 bit number, the upper half is always zero) */
+    message_ul[remaining_length_ >> 3] |= 0x80ULL << ( ( ~remaining_length_ & 7 ) * 8 );
+
+    if( remaining_length_ >= 112 ) {
+        hash_sha512_process_block( state, message_ul );
+
+        for( i = 0; i < 15; i++ ) {
+            message_ul[i] = 0;
+        }
+    }
+    message_ul[15] = ( (uint64_t)total_length ) * 8;
+    hash_sha512_process_block( state, message_ul );
+}
+
+/**
+ *  Convert the first words of a SHA384/512 hash state into a byte array.
+ *  @param hash the resulting byte array (words * 8 bytes)
+ *  @param state the hash state
+ *  @param words the number of 64-bit words to convert
+ */
+static void hash_sha512_state_to_byte_array( uint8_t *hash, const hash_sha384_512_t *state, const int words ) {
+    int i, j;
+    for( i = 0; i < words; i++ ) {
+        for( j = 56; j >= 0; j -= 8 ) {
+            *hash++ = ( state->hash[i] >> j ) & 0xFF;
+        }
+    }
+}
+
+/**
+ *  Convert the hash state into a 384/8=48 byte long byte array.
+ *  @param hash the 48 byte long array
+ *  @param state the hash state
+ */
+void hash_sha384_to_byte_array( uint8_t *hash, const hash_sha384_512_t *state ) {
+    hash_sha512_state_to_byte_array( hash, state, 6 );
+}
+
+/**
+ *  Convert the hash state into a 512/8=64 byte long byte array.
+ *  @param hash the 64 byte long array
+ *  @param state the hash state
+ */
+void hash_sha512_to_byte_array( uint8_t *hash, const hash_sha384_512_t *state ) {
+    hash_sha512_state_to_byte_array( hash, state, 8 );
+}
+
+/**
+ *  Convert the SHA512/256 hash state into a 256/8=32 byte long byte array.
+ *  @param hash the 32 byte long array
+ *  @param state the hash state
+ */
+void hash_sha512_256_to_byte_array( uint8_t *hash, const hash_sha384_512_t *state ) {
+    hash_sha512_state_to_byte_array( hash, state, 4 );
+}
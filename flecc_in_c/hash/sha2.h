@@ -42,13 +42,27 @@
 
 /** The state of SHA224 and SHA256. */
 typedef struct _hash_sha224_256_t_ { uint32_t hash[8]; } hash_sha224_256_t;
+/** The state of SHA384, SHA512, and SHA512/256. */
+typedef struct _hash_sha384_512_t_ { uint64_t hash[8]; } hash_sha384_512_t;
 
 void hash_sha224_init( hash_sha224_256_t *state );
 void hash_sha256_init( hash_sha224_256_t *state );
 void hash_sha2_update( hash_sha224_256_t *state, const uint8_t *message );
 void hash_sha2_final( hash_sha224_256_t *state, const uint8_t *message, const int remaining_length, const int total_length );
 
+void hash_sha256_multi( hash_sha224_256_t *digests, const uint8_t *const *messages, const int *lengths, const int count );
+
 void hash_sha224_to_byte_array( uint8_t *hash, const hash_sha224_256_t *state );
 void hash_sha256_to_byte_array( uint8_t *hash, const hash_sha224_256_t *state );
 
+void hash_sha384_init( hash_sha384_512_t *state );
+void hash_sha512_init( hash_sha384_512_t *state );
+void hash_sha512_256_init( hash_sha384_512_t *state );
+void hash_sha512_update( hash_sha384_512_t *state, const uint8_t *message );
+void hash_sha512_final( hash_sha384_512_t *state, const uint8_t *message, const int remaining_length, const int total_length );
+
+void hash_sha384_to_byte_array( uint8_t *hash, const hash_sha384_512_t *state );
+void hash_sha512_to_byte_array( uint8_t *hash, const hash_sha384_512_t *state );
+void hash_sha512_256_to_byte_array( uint8_t *hash, const hash_sha384_512_t *state );
+
 #endif /* SHA2_H_ */
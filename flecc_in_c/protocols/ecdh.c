@@ -37,6 +37,8 @@
 
 #include "../eccp/eccp.h"
 #include "../gfp/gfp.h"
+#include "ecdh.h"
+#include <stddef.h>
 
 /**
  * First phase of a diffie-hellman key exchange
@@ -57,32 +59,200 @@ void ecdh_phase_one( eccp_point_affine_t *res, const gfp_t scalar, const eccp_pa
 }
 
 /**
- * First phase of a diffie-hellman key exchange
- * @param res resulting point
+ * Copies the public key of the other party and converts it to the domain of
+ * the curve (the caller's point is left unchanged).
+ * @param peer the converted point
+ * @param other_party_point the public key of the other party (not in montgomery domain)
+ * @param param elliptic curve parameters
+ */
+static void ecdh_peer_to_domain( eccp_point_affine_t *peer, const eccp_point_affine_t *other_party_point, const eccp_parameters_t *param ) {
+    eccp_affine_point_copy( peer, other_party_point, param );
+    // assume that the other party does not use Montgomery domain
+    if( param->prime_data.montgomery_domain == 1 ) {
+        gfp_normal_to_montgomery( peer->x, peer->x, &param->prime_data );
+        gfp_normal_to_montgomery( peer->y, peer->y, &param->prime_data );
+    }
+}
+
+/**
+ * Second phase of a diffie-hellman key exchange
+ * @param res resulting point; the point at infinity if the public key of the other party is invalid
  * @param scalar ephemeral or static private key (param->order_n_mont_data.prime_data.words large)
  * @param other_party_point the (ephemeral) public key of the other party
  * @param param elliptic curve parameters
  */
 void ecdh_phase_two( eccp_point_affine_t *res,
                      const gfp_t scalar,
-                     eccp_point_affine_t *other_party_point,
+                     const eccp_point_affine_t *other_party_point,
                      const eccp_parameters_t *param ) {
+    eccp_point_affine_t peer;
 
-    // assume that the other party does not use Montgomery domain
+    ecdh_peer_to_domain( &peer, other_party_point, param );
+    if( eccp_affine_point_is_valid( &peer, param ) == 0 ) {
+        res->identity = 1;
+        return;
+    }
+
+    eccp_generic_mul_wrapper( res, &peer, scalar, param );
+
+    // the commonly derived key shall not be in montgomery domain
     if( param->prime_data.montgomery_domain == 1 ) {
-        gfp_normal_to_montgomery( other_party_point->x, other_party_point->x, &param->prime_data );
-        gfp_normal_to_montgomery( other_party_point->y, other_party_point->y, &param->prime_data );
+        gfp_montgomery_to_normal( res->x, res->x, &param->prime_data );
+        gfp_montgomery_to_normal( res->y, res->y, &param->prime_data );
     }
+}
 
-    if( eccp_affine_point_is_valid( other_party_point, param ) == 0 ) {
-        // TODO: error handling
+/**
+ * Second phase of a diffie-hellman key exchange with imported keys (see
+ * eckey.h). The public key of the other party was checked and converted to
+ * the domain of the curve by eckey_public_import.
+ * @param res resulting point (not in montgomery domain); the point at infinity
+ *        if the public key of the other party is invalid
+ * @param private_key the ephemeral or static private key
+ * @param other_party_key the (ephemeral) public key of the other party
+ * @param param elliptic curve parameters
+ * @return 1 on success, 0 if the public key of the other party is invalid
+ */
+int ecdh_phase_two_with_key( eccp_point_affine_t *res,
+                             const eckey_private_t *private_key,
+                             const eckey_public_t *other_party_key,
+                             const eccp_parameters_t *param ) {
+    if( other_party_key->valid == 0 ) {
+        res->identity = 1;
+        return 0;
     }
 
-    eccp_generic_mul_wrapper( res, other_party_point, scalar, param );
+    eccp_generic_mul_wrapper( res, &other_party_key->point, private_key->scalar, param );
 
     // the commonly derived key shall not be in montgomery domain
     if( param->prime_data.montgomery_domain == 1 ) {
         gfp_montgomery_to_normal( res->x, res->x, &param->prime_data );
         gfp_montgomery_to_normal( res->y, res->y, &param->prime_data );
     }
+    return 1;
+}
+
+/**
+ * Second phase of a diffie-hellman key exchange that only computes the
+ * x coordinate of the shared point (Montgomery ladder without y-recovery).
+ * For a peer other than the base point, ecdh_phase_two uses the same ladder,
+ * so both cost about the same; this variant saves bandwidth, not time.
+ * @param shared_secret the x coordinate of the shared point as big-endian byte
+ *        array (BYTES_PER_BITS( param->prime_data.bits ) bytes)
+ * @param scalar ephemeral or static private key (param->order_n_data.words large)
+ * @param other_party_x the x coordinate of the (ephemeral) public key of the other party
+ * @param other_party_y the y coordinate of the public key of the other party (may be NULL,
+ *        then the point is validated by checking that x^3+ax+b is a quadratic residue)
+ * @param param elliptic curve parameters
+ * @return 1 on success, 0 if the public key of the other party is invalid
+ */
+int ecdh_phase_two_x_only( uint8_t *shared_secret,
+                           const gfp_t scalar,
+                           const gfp_t other_party_x,
+                           const gfp_t other_party_y,
+                           const eccp_parameters_t *param ) {
+    gfp_t x, y, shared_x;
+    int bytes = BYTES_PER_BITS( param->prime_data.bits );
+    int i, result;
+
+    if( bigint_compare_var( other_party_x, param->prime_data.prime, param->prime_data.words ) >= 0 ) {
+        return 0;
+    }
+    bigint_copy_var( x, other_party_x, param->prime_data.words );
+    if( other_party_y != NULL ) {
+        bigint_copy_var( y, other_party_y, param->prime_data.words );
+    }
+
+    // assume that the other party does not use Montgomery domain
+    if( param->prime_data.montgomery_domain == 1 ) {
+        gfp_normal_to_montgomery( x, x, &param->prime_data );
+        if( other_party_y != NULL ) {
+            gfp_normal_to_montgomery( y, y, &param->prime_data );
+        }
+    }
+
+    result = eccp_protected_point_multiply_x_only( shared_x, x, ( other_party_y != NULL ) ? y : NULL, scalar, param );
+    if( result == 0 ) {
+        return 0;
+    }
+
+    // the commonly derived key shall not be in montgomery domain
+    if( param->prime_data.montgomery_domain == 1 ) {
+        gfp_montgomery_to_normal( shared_x, shared_x, &param->prime_data );
+    }
+    for( i = 0; i < bytes; i++ ) {
+        shared_secret[i] = bigint_get_byte_var( shared_x, param->prime_data.words, bytes - 1 - i );
+    }
+    return 1;
+}
+
+/**
+ * Second phase of diffie-hellman key exchanges of one (static) private key
+ * with several other parties. The scalar is recoded once for all parties
+ * (eccp_protected_regular_recode), and the shared points of up to
+ * ECDH_BATCH_SIZE parties are converted to affine coordinates with a single
+ * inversion (eccp_batch_normalize). The public keys of each chunk are
+ * checked together (eccp_affine_points_validate_batch).
+ * @param res the resulting points (count entries, not in montgomery domain);
+ *        the point at infinity for invalid public keys
+ * @param scalar the static private key (param->order_n_data.words large)
+ * @param other_party_points the public keys of the other parties (count entries,
+ *        not in montgomery domain)
+ * @param count the number of other parties
+ * @param param elliptic curve parameters
+ * @return the number of valid public keys
+ */
+int ecdh_phase_two_batch( eccp_point_affine_t *res,
+                          const gfp_t scalar,
+                          const eccp_point_affine_t *other_party_points,
+                          const int count,
+                          const eccp_parameters_t *param ) {
+    uint_t buffer[ECCP_BATCH_BUFFER_WORDS( ECDH_BATCH_SIZE, WORDS_PER_GFP )];
+    uint_t valid_peers[ECCP_BATCH_BITMAP_WORDS( ECDH_BATCH_SIZE )];
+    int digits[ECCP_REGULAR_MAX_DIGITS];
+    eccp_point_batch_t shared_points;
+    eccp_point_projective_t shared_point;
+    eccp_point_affine_t peer;
+    int digit_count, offset, batch, i;
+    int valid = 0;
+
+    digit_count = eccp_protected_regular_recode( digits, scalar, param );
+
+    for( offset = 0; offset < count; offset += batch ) {
+        batch = count - offset;
+        if( batch > ECDH_BATCH_SIZE ) {
+            batch = ECDH_BATCH_SIZE;
+        }
+        eccp_batch_init( &shared_points, buffer, batch, param );
+        eccp_affine_points_validate_batch( valid_peers, &other_party_points[offset], batch, 0, param );
+
+        for( i = 0; i < batch; i++ ) {
+            if( ECCP_BATCH_BITMAP_GET( valid_peers, i ) == 0 ) {
+                // the batch is initialized with points at infinity
+                continue;
+            }
+            ecdh_peer_to_domain( &peer, &other_party_points[offset + i], param );
+            eccp_protected_point_multiply_recoded( &shared_point, &peer, digits, digit_count, param );
+            eccp_batch_set( &shared_points, i, &shared_point, param );
+            valid++;
+        }
+        eccp_batch_normalize( &shared_points, param );
+
+        for( i = 0; i < batch; i++ ) {
+            // the normalized points have z = 1
+            res[offset + i].identity = eccp_batch_is_identity( &shared_points, i );
+            bigint_copy_var( res[offset + i].x, shared_points.x + i * shared_points.words, param->prime_data.words );
+            bigint_copy_var( res[offset + i].y, shared_points.y + i * shared_points.words, param->prime_data.words );
+            // the commonly derived key shall not be in montgomery domain
+            if( ( param->prime_data.montgomery_domain == 1 ) && ( res[offset + i].identity == 0 ) ) {
+                gfp_montgomery_to_normal( res[offset + i].x, res[offset + i].x, &param->prime_data );
+                gfp_montgomery_to_normal( res[offset + i].y, res[offset + i].y, &param->prime_data );
+            }
+        }
+    }
+
+    for( i = 0; i < digit_count; i++ ) {
+        digits[i] = 0;
+    }
+    return valid;
 }
@@ -40,10 +40,29 @@
 
 #include "../types.h"
 
+/** the number of shared points of ecdh_phase_two_batch normalized with one inversion */
+#define ECDH_BATCH_SIZE 16
+
 void ecdh_phase_one( eccp_point_affine_t *res, const gfp_t scalar, const eccp_parameters_t *param );
 void ecdh_phase_two( eccp_point_affine_t *res,
                      const gfp_t scalar,
                      const eccp_point_affine_t *other_party_point,
                      const eccp_parameters_t *param );
 
+int ecdh_phase_two_with_key( eccp_point_affine_t *res,
+                             const eckey_private_t *private_key,
+                             const eckey_public_t *other_party_key,
+                             const eccp_parameters_t *param );
+
+int ecdh_phase_two_x_only( uint8_t *shared_secret,
+                           const gfp_t scalar,
+                           const gfp_t other_party_x,
+                           const gfp_t other_party_y,
+                           const eccp_parameters_t *param );
+int ecdh_phase_two_batch( eccp_point_affine_t *res,
+                          const gfp_t scalar,
+                          const eccp_point_affine_t *other_party_points,
+                          const int count,
+                          const eccp_parameters_t *param );
+
 #endif /* ECDH_H_ */
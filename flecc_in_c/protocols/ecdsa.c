@@ -39,6 +39,182 @@
 #include "../eccp/eccp.h"
 #include "../gfp/gfp.h"
 #include "../bi/bi.h"
+#include "../hash/hmac.h"
+#include "ecdsa.h"
+#include <stddef.h>
+
+/** state of the HMAC-DRBG used to derive deterministic nonces (RFC 6979, Section 3.2) */
+typedef struct _ecdsa_rfc6979_state_t_ {
+    uint8_t K[HMAC_SHA256_BYTES];
+    uint8_t V[HMAC_SHA256_BYTES];
+    /** 1 if a candidate nonce was returned already (requires a state update, step h.3) */
+    int generated;
+} ecdsa_rfc6979_state_t;
+
+/**
+ * Computes s = k^-1 (e + d*r) of an ECDSA signature with the private key
+ * already in Montgomery domain of order n (see eckey_private_t).
+ * @param s the resulting s of the signature
+ * @param k_inverse the inverse of the ephemeral key in Montgomery domain (k^-1 R)
+ * @param r the r of the signature
+ * @param hash_of_message the hash of the message (smaller than param->order_n_data.prime)
+ * @param private_key_mont the used private key in Montgomery domain (d R)
+ * @param param elliptic curve parameters
+ */
+static void ecdsa_sign_compute_s_mont( gfp_t s,
+                                       const gfp_t k_inverse,
+                                       const gfp_t r,
+                                       const gfp_t hash_of_message,
+                                       const gfp_t private_key_mont,
+                                       const eccp_parameters_t *param ) {
+    gfp_t t1, t2;
+
+    gfp_mont_multiply( t1, private_key_mont, k_inverse, &param->order_n_data ); // d R * k^-1 R * R^-1
+    gfp_mont_multiply( t1, t1, r, &param->order_n_data );              // d k^-1 R * r * R^-1
+    gfp_mont_multiply( t2, k_inverse, hash_of_message, &param->order_n_data ); // k^-1 R * e * R^-1
+    gfp_gen_add( s, t1, t2, &param->order_n_data );                    // k^-1 (e+d*r)
+}
+
+/**
+ * Computes s = k^-1 (e + d*r) of an ECDSA signature.
+ * Because private_key, r, and hash_of_message are not in Montgomery domain,
+ * the conversion back to normal domain is performed implicitly.
+ * @param s the resulting s of the signature
+ * @param k_inverse the inverse of the ephemeral key in Montgomery domain (k^-1 R)
+ * @param r the r of the signature
+ * @param hash_of_message the hash of the message (smaller than param->order_n_data.prime)
+ * @param private_key the used private key
+ * @param param elliptic curve parameters
+ */
+static void ecdsa_sign_compute_s( gfp_t s,
+                                  const gfp_t k_inverse,
+                                  const gfp_t r,
+                                  const gfp_t hash_of_message,
+                                  const gfp_t private_key,
+                                  const eccp_parameters_t *param ) {
+    gfp_t private_key_mont;
+
+    gfp_normal_to_montgomery( private_key_mont, private_key, &param->order_n_data ); // d * R^2 * R^-1
+    ecdsa_sign_compute_s_mont( s, k_inverse, r, hash_of_message, private_key_mont, param );
+}
+
+/**
+ * Computes r = x mod n for the x coordinate of an ephemeral point.
+ * @param r the resulting r of the signature
+ * @param x the (affine) x coordinate of the ephemeral point
+ * @param param elliptic curve parameters
+ */
+static void ecdsa_sign_x_to_r( gfp_t r, const gfp_t x, const eccp_parameters_t *param ) {
+    // in case order n and prime have a different length
+    r[param->order_n_data.words - 1] = 0;
+    if( param->prime_data.montgomery_domain == 1 ) {
+        // convert to normal basis is necessary
+        gfp_montgomery_to_normal( r, x, &param->prime_data );
+    } else {
+        bigint_copy_var( r, x, param->prime_data.words );
+    }
+
+    // TODO: using a loop here is not pretty (gfp_reduce)
+    // however prime and order_n are quite similar in size (in all
+    // standardized elliptic curves)
+    // therefore not many iterations are to be expected
+    gfp_reduce( r, &param->order_n_data );
+}
+
+/**
+ * Computes r = x(k*G) mod n for a given ephemeral key.
+ * @param r the resulting r of the signature
+ * @param ephemeral_key the ephemeral key k
+ * @param param elliptic curve parameters
+ */
+static void ecdsa_sign_compute_r( gfp_t r, const gfp_t ephemeral_key, const eccp_parameters_t *param ) {
+    eccp_point_affine_t ephemeral_point;
+
+    eccp_generic_mul_wrapper( &ephemeral_point, &param->base_point, ephemeral_key, param );
+    ecdsa_sign_x_to_r( r, ephemeral_point.x, param );
+}
+
+/**
+ * Computes count (k^-1, r) tuples. The ephemeral points k*G are computed in
+ * Jacobian coordinates and normalized with a single field inversion
+ * (eccp_batch_normalize); the inversions of k are batched as well
+ * (Montgomery's trick, one inversion modulo n).
+ * @param nonces the resulting nonces
+ * @param count the number of nonces (at most ECDSA_NONCE_BATCH_SIZE)
+ * @param param elliptic curve parameters
+ */
+static void ecdsa_nonces_generate( ecdsa_nonce_t *nonces, const int count, const eccp_parameters_t *param ) {
+    uint_t buffer[ECCP_BATCH_BUFFER_WORDS( ECDSA_NONCE_BATCH_SIZE, WORDS_PER_GFP )];
+    eccp_point_batch_t ephemeral_points;
+    eccp_point_projective_t ephemeral_point;
+    gfp_t products[ECDSA_NONCE_BATCH_SIZE];
+    gfp_t inverse, temp;
+    int i;
+
+    // k_i (stored in k_inverse) and k_i*G (not normalized)
+    eccp_batch_init( &ephemeral_points, buffer, count, param );
+    for( i = 0; i < count; i++ ) {
+        gfp_rand( nonces[i].k_inverse, &param->order_n_data );
+        eccp_jacobian_point_multiply_base_point( &ephemeral_point, nonces[i].k_inverse, param );
+        eccp_batch_set( &ephemeral_points, i, &ephemeral_point, param );
+    }
+    eccp_batch_normalize( &ephemeral_points, param );
+
+    // r_i and the running products of k_i (Montgomery domain)
+    for( i = 0; i < count; i++ ) {
+        ecdsa_sign_x_to_r( nonces[i].r, ephemeral_points.x + i * ephemeral_points.words, param );
+        if( eccp_batch_is_identity( &ephemeral_points, i ) ) {
+            bigint_clear_var( nonces[i].r, param->order_n_data.words );
+        }
+        // rare case r = 0: pick another k for this nonce
+        while( bigint_is_zero_var( nonces[i].r, param->order_n_data.words ) == 1 ) {
+            gfp_rand( nonces[i].k_inverse, &param->order_n_data );
+            ecdsa_sign_compute_r( nonces[i].r, nonces[i].k_inverse, param );
+        }
+        gfp_normal_to_montgomery( nonces[i].k_inverse, nonces[i].k_inverse, &param->order_n_data );
+        if( i == 0 ) {
+            bigint_copy_var( products[0], nonces[0].k_inverse, param->order_n_data.words );
+        } else {
+            gfp_mont_multiply( products[i], products[i - 1], nonces[i].k_inverse, &param->order_n_data );
+        }
+    }
+
+    // one inversion for all k_i
+    gfp_mont_inverse( inverse, products[count - 1], &param->order_n_data );
+    for( i = count - 1; i > 0; i-- ) {
+        gfp_mont_multiply( temp, inverse, products[i - 1], &param->order_n_data );
+        gfp_mont_multiply( inverse, inverse, nonces[i].k_inverse, &param->order_n_data );
+        bigint_copy_var( nonces[i].k_inverse, temp, param->order_n_data.words );
+    }
+    bigint_copy_var( nonces[0].k_inverse, inverse, param->order_n_data.words );
+}
+
+/**
+ * Sign the given hash of a message with the private key already in Montgomery
+ * domain of order n (shared by ecdsa_sign and ecdsa_sign_with_key).
+ * @param signature the resulting signature
+ * @param hash_of_message the hash of the message (smaller than param->order_n_data.prime)
+ * @param private_key_mont the used private key in Montgomery domain (d R)
+ * @param param elliptic curve parameters
+ */
+static void ecdsa_sign_mont( ecdsa_signature_t *signature,
+                             const gfp_t hash_of_message,
+                             const gfp_t private_key_mont,
+                             const eccp_parameters_t *param ) {
+    gfp_t ephemeral_key;
+
+    do {
+        do {
+            gfp_rand( ephemeral_key, &param->order_n_data );
+            ecdsa_sign_compute_r( signature->r, ephemeral_key, param );
+        } while( bigint_is_zero_var( signature->r, param->order_n_data.words ) == 1 );
+
+        gfp_normal_to_montgomery( ephemeral_key, ephemeral_key, &param->order_n_data );
+        gfp_mont_inverse( ephemeral_key, ephemeral_key, &param->order_n_data ); //  k^-1
+        ecdsa_sign_compute_s_mont( signature->s, ephemeral_key, signature->r, hash_of_message, private_key_mont, param );
+
+    } while( bigint_is_zero_var( signature->s, param->order_n_data.words ) == 1 );
+}
 
 /**
  * Sign the given hash of a message.
@@ -51,61 +227,470 @@ void ecdsa_sign( ecdsa_signature_t *signature,
                  const gfp_t hash_of_message,
                  const gfp_t private_key,
                  const eccp_parameters_t *param ) {
+    gfp_t private_key_mont;
+
+    gfp_normal_to_montgomery( private_key_mont, private_key, &param->order_n_data ); // d * R^2 * R^-1
+    ecdsa_sign_mont( signature, hash_of_message, private_key_mont, param );
+}
+
+/**
+ * Sign the given hash of a message with an imported private key (see
+ * eckey_private_import), whose Montgomery representation is reused.
+ * @param signature the resulting signature
+ * @param hash_of_message the hash of the message (smaller than param->order_n_data.prime)
+ * @param private_key the used private key
+ * @param param elliptic curve parameters
+ * @return 1 on success, 0 if the key was never imported or has been cleared
+ */
+int ecdsa_sign_with_key( ecdsa_signature_t *signature,
+                         const gfp_t hash_of_message,
+                         const eckey_private_t *private_key,
+                         const eccp_parameters_t *param ) {
+    if( private_key->public_key.valid == 0 )
+        return 0;
+
+    ecdsa_sign_mont( signature, hash_of_message, private_key->scalar_mont, param );
+    return 1;
+}
+
+/**
+ * Updates the HMAC-DRBG state: K = HMAC_K(V || separator || data), V = HMAC_K(V).
+ * @param state the HMAC-DRBG state
+ * @param separator the byte appended to V (0x00 or 0x01)
+ * @param data the provided data (private key and hash of message)
+ * @param data_length the length of data in bytes
+ */
+static void ecdsa_rfc6979_update( ecdsa_rfc6979_state_t *state, const int separator, const uint8_t *data, const int data_length ) {
+    uint8_t message[HMAC_SHA256_BYTES + 1 + 2 * BYTES_PER_GFP];
+    int i, length = HMAC_SHA256_BYTES;
+
+    for( i = 0; i < HMAC_SHA256_BYTES; i++ ) {
+        message[i] = state->V[i];
+    }
+    message[length++] = separator;
+    for( i = 0; i < data_length; i++ ) {
+        message[length++] = data[i];
+    }
+    hash_hmac_sha256( state->K, state->K, HMAC_SHA256_BYTES, message, length );
+    hash_hmac_sha256( state->V, state->K, HMAC_SHA256_BYTES, state->V, HMAC_SHA256_BYTES );
+}
+
+/**
+ * Initializes the HMAC-DRBG with the private key and the hash of the message
+ * (RFC 6979, Section 3.2, steps b to g).
+ * @param state the HMAC-DRBG state
+ * @param hash_of_message the hash of the message (smaller than param->order_n_data.prime)
+ * @param private_key the used private key
+ * @param param elliptic curve parameters
+ */
+static void ecdsa_rfc6979_init( ecdsa_rfc6979_state_t *state,
+                                const gfp_t hash_of_message,
+                                const gfp_t private_key,
+                                const eccp_parameters_t *param ) {
+    uint8_t data[2 * BYTES_PER_GFP];
+    int rlen = BYTES_PER_BITS( param->order_n_data.bits );
+    int i;
+
+    // int2octets(x) || bits2octets(h1)
+    for( i = 0; i < rlen; i++ ) {
+        data[i] = bigint_get_byte_var( private_key, param->order_n_data.words, rlen - 1 - i );
+        data[rlen + i] = bigint_get_byte_var( hash_of_message, param->order_n_data.words, rlen - 1 - i );
+    }
+    for( i = 0; i < HMAC_SHA256_BYTES; i++ ) {
+        state->V[i] = 0x01;
+        state->K[i] = 0x00;
+    }
+    ecdsa_rfc6979_update( state, 0x00, data, 2 * rlen );
+    ecdsa_rfc6979_update( state, 0x01, data, 2 * rlen );
+    state->generated = 0;
+
+    for( i = 0; i < 2 * rlen; i++ ) {
+        data[i] = 0;
+    }
+}
+
+/**
+ * Derives the next candidate nonce k in [1, n-1] (RFC 6979, Section 3.2, step h).
+ * @param k the resulting nonce
+ * @param state the HMAC-DRBG state
+ * @param param elliptic curve parameters
+ */
+static void ecdsa_rfc6979_next( gfp_t k, ecdsa_rfc6979_state_t *state, const eccp_parameters_t *param ) {
+    uint8_t T[BYTES_PER_GFP + HMAC_SHA256_BYTES];
+    int qlen = param->order_n_data.bits;
+    int rlen = BYTES_PER_BITS( qlen );
+    int tlen, i;
+
+    while( 1 ) {
+        if( state->generated == 1 ) {
+            ecdsa_rfc6979_update( state, 0x00, NULL, 0 );
+        }
+        state->generated = 1;
+
+        for( tlen = 0; tlen < rlen; tlen += HMAC_SHA256_BYTES ) {
+            hash_hmac_sha256( state->V, state->K, HMAC_SHA256_BYTES, state->V, HMAC_SHA256_BYTES );
+            for( i = 0; i < HMAC_SHA256_BYTES; i++ ) {
+                T[tlen + i] = state->V[i];
+            }
+        }
+
+        // k = bits2int(T): the leftmost qlen bits of T
+        bigint_clear_var( k, param->order_n_data.words );
+        for( i = 0; i < rlen; i++ ) {
+            bigint_set_byte_var( k, param->order_n_data.words, rlen - 1 - i, T[i] );
+        }
+        bigint_shift_right_var( k, k, 8 * rlen - qlen, param->order_n_data.words );
+
+        if( ( bigint_is_zero_var( k, param->order_n_data.words ) == 0 )
+            && ( bigint_compare_var( k, param->order_n_data.prime, param->order_n_data.words ) < 0 ) ) {
+            break;
+        }
+    }
+
+    for( i = 0; i < rlen; i++ ) {
+        T[i] = 0;
+    }
+}
+
+/**
+ * Sign the given hash of a message with a deterministic nonce (RFC 6979).
+ * The nonce is derived from the private key and the hash with HMAC-DRBG
+ * (using HMAC-SHA256), so no random number generator is needed.
+ * @param signature the resulting signature
+ * @param hash_of_message the hash of the message (smaller than param->order_n_data.prime,
+ *        see ecdsa_hash_to_gfp)
+ * @param private_key the used private key
+ * @param param elliptic curve parameters
+ */
+void ecdsa_sign_rfc6979( ecdsa_signature_t *signature,
+                         const gfp_t hash_of_message,
+                         const gfp_t private_key,
+                         const eccp_parameters_t *param ) {
+    ecdsa_rfc6979_state_t state;
+    gfp_t ephemeral_key;
+
+    ecdsa_rfc6979_init( &state, hash_of_message, private_key, param );
+    do {
+        do {
+            ecdsa_rfc6979_next( ephemeral_key, &state, param );
+            ecdsa_sign_compute_r( signature->r, ephemeral_key, param );
+        } while( bigint_is_zero_var( signature->r, param->order_n_data.words ) == 1 );
+
+        gfp_normal_to_montgomery( ephemeral_key, ephemeral_key, &param->order_n_data );
+        gfp_mont_inverse( ephemeral_key, ephemeral_key, &param->order_n_data ); //  k^-1
+        ecdsa_sign_compute_s( signature->s, ephemeral_key, signature->r, hash_of_message, private_key, param );
+
+    } while( bigint_is_zero_var( signature->s, param->order_n_data.words ) == 1 );
+
+    bigint_clear_var( ephemeral_key, param->order_n_data.words );
+}
+
+/**
+ * Computes the recovery id of a signature (see ecdsa_recover_public_key).
+ * @param ephemeral_point the ephemeral point k*G
+ * @param r the r of the signature (x coordinate of ephemeral_point mod n)
+ * @param param elliptic curve parameters
+ * @return bit 0: y coordinate of ephemeral_point is odd, bit 1: x coordinate of ephemeral_point is larger than n
+ */
+static int ecdsa_recovery_id( const eccp_point_affine_t *ephemeral_point, const gfp_t r, const eccp_parameters_t *param ) {
+    gfp_t temp;
+    int recovery_id;
+
+    if( param->prime_data.montgomery_domain == 1 ) {
+        gfp_montgomery_to_normal( temp, ephemeral_point->y, &param->prime_data );
+    } else {
+        bigint_copy_var( temp, ephemeral_point->y, param->prime_data.words );
+    }
+    recovery_id = temp[0] & 1;
+
+    if( param->prime_data.montgomery_domain == 1 ) {
+        gfp_montgomery_to_normal( temp, ephemeral_point->x, &param->prime_data );
+    } else {
+        bigint_copy_var( temp, ephemeral_point->x, param->prime_data.words );
+    }
+    if( bigint_compare_var( temp, r, param->order_n_data.words ) != 0 ) {
+        recovery_id |= 2;
+    }
+    return recovery_id;
+}
+
+/**
+ * Sign the given hash of a message and return the recovery id that allows
+ * ecdsa_recover_public_key to reconstruct the public key from the signature.
+ * @param signature the resulting signature
+ * @param hash_of_message the hash of the message (smaller than param->order_n_data.prime)
+ * @param private_key the used private key
+ * @param param elliptic curve parameters
+ * @return the recovery id (0 to 3)
+ */
+int ecdsa_sign_recoverable( ecdsa_signature_t *signature,
+                            const gfp_t hash_of_message,
+                            const gfp_t private_key,
+                            const eccp_parameters_t *param ) {
     gfp_t ephemeral_key;
     eccp_point_affine_t ephemeral_point;
+    int recovery_id;
 
     do {
         do {
             gfp_rand( ephemeral_key, &param->order_n_data );
             eccp_generic_mul_wrapper( &ephemeral_point, &param->base_point, ephemeral_key, param );
+            ecdsa_sign_x_to_r( signature->r, ephemeral_point.x, param );
+        } while( ( ephemeral_point.identity == 1 ) || ( bigint_is_zero_var( signature->r, param->order_n_data.words ) == 1 ) );
 
-            // in case order n and prime have a different length
-            signature->r[param->order_n_data.words - 1] = 0;
-            if( param->prime_data.montgomery_domain == 1 ) {
-                // convert to normal basis is necessary
-                gfp_montgomery_to_normal( signature->r, ephemeral_point.x, &param->prime_data );
-            } else {
-                bigint_copy_var( signature->r, ephemeral_point.x, param->prime_data.words );
-            }
+        recovery_id = ecdsa_recovery_id( &ephemeral_point, signature->r, param );
+        gfp_normal_to_montgomery( ephemeral_key, ephemeral_key, &param->order_n_data );
+        gfp_mont_inverse( ephemeral_key, ephemeral_key, &param->order_n_data ); //  k^-1
+        ecdsa_sign_compute_s( signature->s, ephemeral_key, signature->r, hash_of_message, private_key, param );
 
-            // TODO: using a loop here is not pretty (gfp_reduce)
-            // however prime and order_n are quite similar in size (in all
-            // standardized elliptic curves)
-            // therefore not many iterations are to be expected
-            gfp_reduce( signature->r, &param->order_n_data );
-        } while( bigint_is_zero_var( signature->r, param->order_n_data.words ) == 1 );
+    } while( bigint_is_zero_var( signature->s, param->order_n_data.words ) == 1 );
 
-        // reuse ephemeral_key and ephemeral_point to safe memory
-        // compute k^-1 e + (k^-1 d) r
-        // because private_key, signature->r, and hash_of message are not in
-        // Montgomery domain,
-        // the conversion back to normal domain is performed implicitly.
-        gfp_normal_to_montgomery( ephemeral_key, ephemeral_key, &param->order_n_data );
-        gfp_mont_inverse( ephemeral_key, ephemeral_key, &param->order_n_data );                         //  k^-1
-        gfp_normal_to_montgomery( ephemeral_point.y, private_key, &param->order_n_data );               // d * R^2 * R^-1
-        gfp_mont_multiply( ephemeral_point.x, ephemeral_point.y, ephemeral_key, &param->order_n_data ); // d R * k^-1 R * R^-1
-        gfp_mont_multiply( ephemeral_point.x, ephemeral_point.x, signature->r, &param->order_n_data );  // d k^-1 R * r * R^-1
-        gfp_mont_multiply( ephemeral_point.y, ephemeral_key, hash_of_message, &param->order_n_data );   // k^-1 R * e * R^-1
-        gfp_gen_add( signature->s, ephemeral_point.x, ephemeral_point.y, &param->order_n_data );        // k^-1 (e+d*r)
+    return recovery_id;
+}
+
+/**
+ * Reconstructs the public key from an ECDSA signature (SEC 1 Section 4.1.6):
+ * Q = r^-1 (s*R - e*G), where R is the ephemeral point selected by the recovery id.
+ * @param candidates the recovered public key(s) (not in montgomery domain). If
+ *        recovery_id is ECDSA_RECOVERY_ID_ALL, up to ECDSA_RECOVERY_MAX_CANDIDATES
+ *        points are written, otherwise one point.
+ * @param signature the signature
+ * @param hash_of_message the hash of the message (smaller than param->order_n_data.prime)
+ * @param recovery_id the recovery id returned by ecdsa_sign_recoverable or ECDSA_RECOVERY_ID_ALL
+ * @param param elliptic curve parameters
+ * @return the number of recovered candidates (0 if the signature is invalid)
+ */
+int ecdsa_recover_public_key( eccp_point_affine_t *candidates,
+                              const ecdsa_signature_t *signature,
+                              const gfp_t hash_of_message,
+                              const int recovery_id,
+                              const eccp_parameters_t *param ) {
+    gfp_t u1, u2, x;
+    eccp_point_affine_t R;
+    eccp_point_projective_t sum;
+    int count = 0;
+    int id, first, last;
+
+    if( bigint_is_zero_var( signature->r, param->order_n_data.words ) == 1 )
+        return 0;
+    if( bigint_is_zero_var( signature->s, param->order_n_data.words ) == 1 )
+        return 0;
+    if( bigint_compare_var( signature->r, param->order_n_data.prime, param->order_n_data.words ) >= 0 )
+        return 0;
+    if( bigint_compare_var( signature->s, param->order_n_data.prime, param->order_n_data.words ) >= 0 )
+        return 0;
+
+    if( recovery_id == ECDSA_RECOVERY_ID_ALL ) {
+        first = 0;
+        last = ECDSA_RECOVERY_MAX_CANDIDATES - 1;
+    } else if( ( recovery_id >= 0 ) && ( recovery_id < ECDSA_RECOVERY_MAX_CANDIDATES ) ) {
+        first = last = recovery_id;
+    } else {
+        return 0;
+    }
+
+    // u1 = -e*r^-1, u2 = s*r^-1
+    gfp_normal_to_montgomery( u2, signature->r, &param->order_n_data );  // r*R
+    gfp_mont_inverse( u2, u2, &param->order_n_data );                    // r^-1*R
+    gfp_mont_multiply( u1, hash_of_message, u2, &param->order_n_data );  // e*r^-1
+    gfp_gen_negate( u1, u1, &param->order_n_data );                      // -e*r^-1
+    gfp_mont_multiply( u2, signature->s, u2, &param->order_n_data );     // s*r^-1
+
+    for( id = first; id <= last; id++ ) {
+        // x = r (+ n)
+        bigint_clear_var( x, param->prime_data.words );
+        bigint_copy_var( x, signature->r, param->order_n_data.words );
+        if( ( id & 2 ) && ( bigint_add_var( x, x, param->order_n_data.prime, param->order_n_data.words ) != 0 ) ) {
+            continue;
+        }
+        if( bigint_compare_var( x, param->prime_data.prime, param->prime_data.words ) >= 0 ) {
+            continue;
+        }
+        if( param->prime_data.montgomery_domain == 1 ) {
+            gfp_normal_to_montgomery( x, x, &param->prime_data );
+        }
+        if( eccp_affine_point_decompress( &R, x, id & 1, param ) == 0 ) {
+            continue;
+        }
+
+        // u1*G + u2*R with one chain of doublings, normalized once
+        eccp_jacobian_point_multiply_shamir( &sum, &param->base_point, u1, &R, u2, param );
+        if( sum.identity == 1 ) {
+            continue;
+        }
+        eccp_jacobian_to_affine( &candidates[count], &sum, param );
 
+        // the public key shall not be in montgomery domain
+        if( param->prime_data.montgomery_domain == 1 ) {
+            gfp_montgomery_to_normal( candidates[count].x, candidates[count].x, &param->prime_data );
+            gfp_montgomery_to_normal( candidates[count].y, candidates[count].y, &param->prime_data );
+        }
+        count++;
+    }
+    return count;
+}
+
+/**
+ * Initializes an (empty) pool of precomputed ECDSA nonces.
+ * @param pool the pool to initialize
+ * @param nonces the storage of the nonces (capacity entries)
+ * @param capacity the maximum number of nonces
+ * @param low_watermark ecdsa_nonce_pool_needs_refill returns 1 if no more than
+ *        low_watermark nonces are left
+ */
+void ecdsa_nonce_pool_init( ecdsa_nonce_pool_t *pool, ecdsa_nonce_t *nonces, const int capacity, const int low_watermark ) {
+    pool->nonces = nonces;
+    pool->capacity = capacity;
+    pool->count = 0;
+    pool->low_watermark = low_watermark;
+    pool->generated = 0;
+    pool->consumed = 0;
+    pool->underruns = 0;
+}
+
+/**
+ * Returns 1 if the number of available nonces dropped to the low watermark.
+ * @param pool the nonce pool
+ * @return 1 if the pool should be refilled, 0 otherwise
+ */
+int ecdsa_nonce_pool_needs_refill( const ecdsa_nonce_pool_t *pool ) {
+    return ( pool->count <= pool->low_watermark ) ? 1 : 0;
+}
+
+/**
+ * Precomputes (k^-1, r) tuples until the pool is full or max_count nonces
+ * were added. Intended to be called in idle time (offline phase). The
+ * normalization of k*G and the inversion of k are shared by up to
+ * ECDSA_NONCE_BATCH_SIZE nonces.
+ * @param pool the nonce pool
+ * @param max_count the maximum number of nonces to compute
+ * @param param elliptic curve parameters
+ * @return the number of added nonces
+ */
+int ecdsa_nonce_pool_refill( ecdsa_nonce_pool_t *pool, const int max_count, const eccp_parameters_t *param ) {
+    int added = 0;
+    int batch;
+
+    while( ( added < max_count ) && ( pool->count < pool->capacity ) ) {
+        batch = pool->capacity - pool->count;
+        if( batch > max_count - added ) {
+            batch = max_count - added;
+        }
+        if( batch > ECDSA_NONCE_BATCH_SIZE ) {
+            batch = ECDSA_NONCE_BATCH_SIZE;
+        }
+        ecdsa_nonces_generate( &pool->nonces[pool->count], batch, param );
+        pool->count += batch;
+        pool->generated += batch;
+        added += batch;
+    }
+    return added;
+}
+
+/**
+ * Sign the given hash of a message using a precomputed nonce of the pool
+ * (online phase). Falls back to ecdsa_sign if the pool is empty.
+ * Used nonces are removed from the pool and cleared.
+ * @param signature the resulting signature
+ * @param hash_of_message the hash of the message (smaller than param->order_n_data.prime)
+ * @param private_key the used private key
+ * @param pool the nonce pool
+ * @param param elliptic curve parameters
+ * @return 1 if a pooled nonce was used, 0 if the pool was empty
+ */
+int ecdsa_sign_with_pool( ecdsa_signature_t *signature,
+                          const gfp_t hash_of_message,
+                          const gfp_t private_key,
+                          ecdsa_nonce_pool_t *pool,
+                          const eccp_parameters_t *param ) {
+    ecdsa_nonce_t *nonce;
+
+    do {
+        if( pool->count == 0 ) {
+            pool->underruns++;
+            ecdsa_sign( signature, hash_of_message, private_key, param );
+            return 0;
+        }
+        pool->count--;
+        nonce = &pool->nonces[pool->count];
+        bigint_copy_var( signature->r, nonce->r, param->order_n_data.words );
+        ecdsa_sign_compute_s( signature->s, nonce->k_inverse, nonce->r, hash_of_message, private_key, param );
+        bigint_clear_var( nonce->k_inverse, param->order_n_data.words );
+        bigint_clear_var( nonce->r, param->order_n_data.words );
     } while( bigint_is_zero_var( signature->s, param->order_n_data.words ) == 1 );
+
+    pool->consumed++;
+    return 1;
 }
 
 /**
- * Returns 1 if the given ECDSA signature is valid.
- * @param signature the signature to verify
- * @param hash_of_message the hash of the message (smaller thanparam->order_n_data.prime)
- * @param public_key the public key used for the verification (assumed to be not in montgomery domain)
+ * Signs several hashes with the same private key. The normalizations of the
+ * ephemeral points and the inversions of the ephemeral keys are shared by up
+ * to ECDSA_NONCE_BATCH_SIZE signatures.
+ * @param signatures the resulting signatures (count entries)
+ * @param hashes_of_messages the hashes of the messages (each smaller than param->order_n_data.prime)
+ * @param count the number of hashes to sign
+ * @param private_key the used private key
  * @param param elliptic curve parameters
- * @return 1 if signature is valid, 0 if signature is invalid
  */
-int ecdsa_is_valid( const ecdsa_signature_t *signature,
-                    const gfp_t hash_of_message,
-                    const eccp_point_affine_t *public_key,
-                    const eccp_parameters_t *param ) {
-    gfp_t w, u1;
-    eccp_point_affine_t P1, P2;
+void ecdsa_sign_batch( ecdsa_signature_t *signatures,
+                       const gfp_t *hashes_of_messages,
+                       const int count,
+                       const gfp_t private_key,
+                       const eccp_parameters_t *param ) {
+    ecdsa_nonce_t nonces[ECDSA_NONCE_BATCH_SIZE];
+    int offset, batch, i;
 
+    for( offset = 0; offset < count; offset += batch ) {
+        batch = count - offset;
+        if( batch > ECDSA_NONCE_BATCH_SIZE ) {
+            batch = ECDSA_NONCE_BATCH_SIZE;
+        }
+        ecdsa_nonces_generate( nonces, batch, param );
+        for( i = 0; i < batch; i++ ) {
+            bigint_copy_var( signatures[offset + i].r, nonces[i].r, param->order_n_data.words );
+            ecdsa_sign_compute_s( signatures[offset + i].s, nonces[i].k_inverse, nonces[i].r, hashes_of_messages[offset + i], private_key, param );
+            if( bigint_is_zero_var( signatures[offset + i].s, param->order_n_data.words ) == 1 ) {
+                ecdsa_sign( &signatures[offset + i], hashes_of_messages[offset + i], private_key, param );
+            }
+        }
+        for( i = 0; i < batch; i++ ) {
+            bigint_clear_var( nonces[i].k_inverse, param->order_n_data.words );
+        }
+    }
+}
+
+/**
+ * Compares the x coordinate of a Jacobian point with a given value without
+ * converting the point to affine coordinates (X == x*Z^2).
+ * @param P the Jacobian point (not the identity)
+ * @param x the value to compare with (normal domain, prime_data.words long)
+ * @param param elliptic curve parameters
+ * @return 1 if x is the affine x coordinate of P, 0 otherwise
+ */
+static int ecdsa_jacobian_x_is_equal( const eccp_point_projective_t *P, const gfp_t x, const eccp_parameters_t *param ) {
+    gfp_t temp, z_squared;
+
+    if( bigint_compare_var( x, param->prime_data.prime, param->prime_data.words ) >= 0 ) {
+        return 0;
+    }
+    if( param->prime_data.montgomery_domain == 1 ) {
+        gfp_normal_to_montgomery( temp, x, &param->prime_data );
+    } else {
+        gfp_copy( temp, x );
+    }
+    gfp_square( z_squared, P->z );
+    gfp_multiply( temp, temp, z_squared );
+    return gfp_is_equal( temp, P->x );
+}
+
+/**
+ * Checks the ranges of r and s of a signature.
+ * @param signature the signature to verify
+ * @param param elliptic curve parameters
+ * @return 1 if r and s are in [1,n-1], 0 if the signature is invalid
+ */
+static int ecdsa_verify_check_ranges( const ecdsa_signature_t *signature, const eccp_parameters_t *param ) {
     /* Verify that r and s are integers in the interval [1,n-1]. If any
      * verification fails then reject the signature */
     if( bigint_is_zero_var( signature->r, param->order_n_data.words ) == 1 )
@@ -116,47 +701,331 @@ int ecdsa_is_valid( const ecdsa_signature_t *signature,
         return 0;
     if( bigint_compare_var( signature->s, param->order_n_data.prime, param->order_n_data.words ) >= 0 )
         return 0;
+    return 1;
+}
+
+/**
+ * Checks the ranges of r and s and the public key of a signature.
+ * @param P the public key in Montgomery domain (result)
+ * @param signature the signature to verify
+ * @param public_key the public key (assumed to be not in montgomery domain)
+ * @param param elliptic curve parameters
+ * @return 1 if the checks passed, 0 if the signature is invalid
+ */
+static int ecdsa_verify_prepare( eccp_point_affine_t *P,
+                                 const ecdsa_signature_t *signature,
+                                 const eccp_point_affine_t *public_key,
+                                 const eccp_parameters_t *param ) {
+    if( ecdsa_verify_check_ranges( signature, param ) == 0 )
+        return 0;
 
     /* Verify the validity of the public key (just to be sure) */
-    eccp_affine_point_copy( &P1, public_key, param );
+    eccp_affine_point_copy( P, public_key, param );
     if( param->prime_data.montgomery_domain == 1 ) {
-        gfp_normal_to_montgomery( P1.x, public_key->x, &param->prime_data );
-        gfp_normal_to_montgomery( P1.y, public_key->y, &param->prime_data );
+        gfp_normal_to_montgomery( P->x, public_key->x, &param->prime_data );
+        gfp_normal_to_montgomery( P->y, public_key->y, &param->prime_data );
     }
-    if( eccp_affine_point_is_valid( &P1, param ) == 0 )
+    if( eccp_affine_point_is_valid( P, param ) == 0 )
+        return 0;
+    if( P->identity == 1 )
         return 0;
-    if( P1.identity == 1 )
+    return 1;
+}
+
+/**
+ * Checks x(u1*G + u2*P) mod n == r with u1 = e*s^-1 and u2 = r*s^-1.
+ * @param signature the signature to verify (checked by ecdsa_verify_prepare)
+ * @param hash_of_message the hash of the message (smaller than param->order_n_data.prime)
+ * @param s_inverse s^-1 in Montgomery domain of order n
+ * @param P the public key in Montgomery domain (checked by ecdsa_verify_prepare)
+ * @param param elliptic curve parameters
+ * @return 1 if signature is valid, 0 if signature is invalid
+ */
+static int ecdsa_verify_finish( const ecdsa_signature_t *signature,
+                                const gfp_t hash_of_message,
+                                const gfp_t s_inverse,
+                                const eccp_point_affine_t *P,
+                                const eccp_parameters_t *param ) {
+    gfp_t w, u1;
+    eccp_point_affine_t P2;
+    eccp_point_projective_t sum;
+
+    gfp_mont_multiply( u1, hash_of_message, s_inverse, &param->order_n_data ); // u1 = e*s^-1*R*R^-1
+    gfp_mont_multiply( w, signature->r, s_inverse, &param->order_n_data );     // u2 = r*s^-1*R*R^-1
+
+    // TODO: replace by joint sparse form simultaneous point multiplication
+    eccp_generic_mul_wrapper( &P2, P, w, param );
+    // the sum stays in Jacobian coordinates (no inversion)
+    eccp_jacobian_point_multiply_base_point( &sum, u1, param );
+    eccp_jacobian_point_add_affine( &sum, &sum, &P2, param );
+
+    if( sum.identity == 1 )
+        return 0;
+
+    // x mod n == r  <=>  x == r or x == r+n (if r+n < p)
+    bigint_clear_var( w, param->prime_data.words );
+    bigint_copy_var( w, signature->r, param->order_n_data.words );
+    if( ecdsa_jacobian_x_is_equal( &sum, w, param ) == 1 ) {
+        return 1;
+    }
+    if( bigint_add_var( w, w, param->order_n_data.prime, param->order_n_data.words ) == 0 ) {
+        return ecdsa_jacobian_x_is_equal( &sum, w, param );
+    }
+    return 0;
+}
+
+/**
+ * Returns 1 if the given ECDSA signature is valid.
+ * @param signature the signature to verify
+ * @param hash_of_message the hash of the message (smaller thanparam->order_n_data.prime)
+ * @param public_key the public key used for the verification (assumed to be not in montgomery domain)
+ * @param param elliptic curve parameters
+ * @return 1 if signature is valid, 0 if signature is invalid
+ */
+int ecdsa_is_valid( const ecdsa_signature_t *signature,
+                    const gfp_t hash_of_message,
+                    const eccp_point_affine_t *public_key,
+                    const eccp_parameters_t *param ) {
+    eccp_point_affine_t P;
+    gfp_t w;
+
+    if( ecdsa_verify_prepare( &P, signature, public_key, param ) == 0 )
         return 0;
 
     gfp_normal_to_montgomery( w, signature->s, &param->order_n_data ); // s*R
     gfp_mont_inverse( w, w, &param->order_n_data );                    // s^-1*R
-    gfp_mont_multiply( u1, hash_of_message, w, &param->order_n_data ); // u1 = e*s^-1*R*R^-1
-    gfp_mont_multiply( w, signature->r, w, &param->order_n_data );     // u2 = r*s^-1*R*R^-1
+    return ecdsa_verify_finish( signature, hash_of_message, w, &P, param );
+}
 
-    // TODO: replace by joint sparse form simultaneous point multiplication
-    // TODO: safe memory
-    eccp_generic_mul_wrapper( &P2, &P1, w, param );
-    eccp_generic_mul_wrapper( &P1, &param->base_point, u1, param );
-    eccp_affine_point_add( &P1, &P1, &P2, param );
+/**
+ * Returns 1 if the given ECDSA signature is valid for an imported public key
+ * (see eckey_public_import). The key is neither checked nor converted again.
+ * @param signature the signature to verify
+ * @param hash_of_message the hash of the message (smaller than param->order_n_data.prime)
+ * @param public_key the public key used for the verification
+ * @param param elliptic curve parameters
+ * @return 1 if signature is valid, 0 if signature or public key is invalid
+ */
+int ecdsa_is_valid_with_key( const ecdsa_signature_t *signature,
+                             const gfp_t hash_of_message,
+                             const eckey_public_t *public_key,
+                             const eccp_parameters_t *param ) {
+    gfp_t w;
 
-    if( P1.identity == 1 )
+    if( public_key->valid == 0 )
+        return 0;
+    if( ecdsa_verify_check_ranges( signature, param ) == 0 )
         return 0;
 
-    // in case order n and prime have a different length
-    w[param->order_n_data.words - 1] = 0;
-    if( param->prime_data.montgomery_domain == 1 ) {
-        // convert to normal basis is necessary
-        gfp_montgomery_to_normal( w, P1.x, &param->prime_data );
-    } else {
-        bigint_copy_var( w, P1.x, param->prime_data.words );
+    gfp_normal_to_montgomery( w, signature->s, &param->order_n_data ); // s*R
+    gfp_mont_inverse( w, w, &param->order_n_data );                    // s^-1*R
+    return ecdsa_verify_finish( signature, hash_of_message, w, &public_key->point, param );
+}
+
+/**
+ * Verifies several signatures (of possibly different public keys). The
+ * inversions of s are shared by up to ECDSA_VERIFY_BATCH_SIZE signatures
+ * (Montgomery's trick), and the sums are compared in Jacobian coordinates.
+ * @param results the result of each signature (count entries): 1 if valid, 0 if invalid
+ * @param signatures the signatures to verify (count entries)
+ * @param hashes_of_messages the hashes of the messages (each smaller than param->order_n_data.prime)
+ * @param public_keys the public keys (count entries, assumed to be not in montgomery domain)
+ * @param count the number of signatures
+ * @param param elliptic curve parameters
+ * @return the number of valid signatures
+ */
+int ecdsa_is_valid_batch( int *results,
+                          const ecdsa_signature_t *signatures,
+                          const gfp_t *hashes_of_messages,
+                          const eccp_point_affine_t *public_keys,
+                          const int count,
+                          const eccp_parameters_t *param ) {
+    eccp_point_affine_t keys[ECDSA_VERIFY_BATCH_SIZE];
+    gfp_t s[ECDSA_VERIFY_BATCH_SIZE];
+    gfp_t products[ECDSA_VERIFY_BATCH_SIZE];
+    int indices[ECDSA_VERIFY_BATCH_SIZE];
+    gfp_t inverse, temp;
+    int offset, batch, formed, i;
+    int valid = 0;
+
+    for( offset = 0; offset < count; offset += batch ) {
+        batch = count - offset;
+        if( batch > ECDSA_VERIFY_BATCH_SIZE ) {
+            batch = ECDSA_VERIFY_BATCH_SIZE;
+        }
+
+        // s_i in Montgomery domain and the running products of the well-formed signatures
+        formed = 0;
+        for( i = 0; i < batch; i++ ) {
+            results[offset + i] = ecdsa_verify_prepare( &keys[formed], &signatures[offset + i], &public_keys[offset + i], param );
+            if( results[offset + i] == 0 ) {
+                continue;
+            }
+            indices[formed] = offset + i;
+            gfp_normal_to_montgomery( s[formed], signatures[offset + i].s, &param->order_n_data );
+            if( formed == 0 ) {
+                bigint_copy_var( products[0], s[0], param->order_n_data.words );
+            } else {
+                gfp_mont_multiply( products[formed], products[formed - 1], s[formed], &param->order_n_data );
+            }
+            formed++;
+        }
+        if( formed == 0 ) {
+            continue;
+        }
+
+        // one inversion for all s_i (s_i is replaced by s_i^-1)
+        gfp_mont_inverse( inverse, products[formed - 1], &param->order_n_data );
+        for( i = formed - 1; i > 0; i-- ) {
+            gfp_mont_multiply( temp, inverse, products[i - 1], &param->order_n_data );
+            gfp_mont_multiply( inverse, inverse, s[i], &param->order_n_data );
+            bigint_copy_var( s[i], temp, param->order_n_data.words );
+        }
+        bigint_copy_var( s[0], inverse, param->order_n_data.words );
+
+        for( i = 0; i < formed; i++ ) {
+            results[indices[i]] = ecdsa_verify_finish( &signatures[indices[i]], hashes_of_messages[indices[i]], s[i], &keys[i], param );
+            valid += results[indices[i]];
+        }
     }
-    gfp_reduce( w, &param->order_n_data );
+    return valid;
+}
 
-    if( bigint_compare_var( w, signature->r, param->order_n_data.words ) == 0 ) {
-        return 1;
+/**
+ * Starts a streaming signature generation of a message hashed with SHA-256.
+ * The nonce (k*G, r and k^-1) is computed here, so that only s is left to be
+ * computed once the whole message has been hashed.
+ * @param stream the streaming context
+ * @param param elliptic curve parameters
+ */
+void ecdsa_sign_stream_init( ecdsa_stream_t *stream, const eccp_parameters_t *param ) {
+    ecdsa_verify_stream_init( stream );
+    ecdsa_nonces_generate( &stream->nonce, 1, param );
+}
+
+/**
+ * Starts a streaming signature verification of a message hashed with SHA-256.
+ * @param stream the streaming context
+ */
+void ecdsa_verify_stream_init( ecdsa_stream_t *stream ) {
+    hash_sha256_init( &stream->hash );
+    stream->block_length = 0;
+    stream->total_length = 0;
+    bigint_clear_var( stream->nonce.r, WORDS_PER_GFP );
+    bigint_clear_var( stream->nonce.k_inverse, WORDS_PER_GFP );
+}
+
+/**
+ * Hashes the next part of the message of a streaming signature generation
+ * or verification. Complete blocks are hashed directly from data, only a
+ * remainder of less than ECDSA_STREAM_BLOCK_BYTES bytes is copied.
+ * @param stream the streaming context
+ * @param data the next part of the message
+ * @param length the length of data in bytes (arbitrary)
+ */
+void ecdsa_stream_update( ecdsa_stream_t *stream, const uint8_t *data, const int length ) {
+    int remaining = length;
+
+    stream->total_length += length;
+
+    // complete a partial block first
+    if( stream->block_length > 0 ) {
+        while( ( remaining > 0 ) && ( stream->block_length < ECDSA_STREAM_BLOCK_BYTES ) ) {
+            stream->block[stream->block_length++] = *data++;
+            remaining--;
+        }
+        if( stream->block_length < ECDSA_STREAM_BLOCK_BYTES ) {
+            return;
+        }
+        hash_sha2_update( &stream->hash, stream->block );
+        stream->block_length = 0;
+    }
+
+    while( remaining >= ECDSA_STREAM_BLOCK_BYTES ) {
+        hash_sha2_update( &stream->hash, data );
+        data += ECDSA_STREAM_BLOCK_BYTES;
+        remaining -= ECDSA_STREAM_BLOCK_BYTES;
+    }
+
+    while( remaining > 0 ) {
+        stream->block[stream->block_length++] = *data++;
+        remaining--;
+    }
+}
+
+/**
+ * Finalizes the hash of a streaming signature generation or verification and
+ * converts it to a number smaller than order n (same result as ecdsa_hash_to_gfp).
+ * The words of the SHA-256 state are used directly instead of its bytes.
+ * @param element the resulting number
+ * @param stream the streaming context
+ * @param param elliptic curve parameters
+ */
+static void ecdsa_stream_digest( gfp_t element, ecdsa_stream_t *stream, const eccp_parameters_t *param ) {
+    const int hash_words = 8;
+    int i;
+
+    hash_sha2_final( &stream->hash, stream->block, stream->block_length, stream->total_length );
+
+    for( i = 0; i < hash_words; i++ ) {
+        element[i] = stream->hash.hash[hash_words - 1 - i];
+    }
+    if( param->order_n_data.bits < hash_words * BITS_PER_WORD ) {
+        // only the leftmost bits of the hash are used
+        bigint_shift_right_var( element, element, hash_words * BITS_PER_WORD - param->order_n_data.bits, hash_words );
     } else {
-        return 0;
+        for( ; i < param->order_n_data.words; i++ ) {
+            element[i] = 0;
+        }
     }
+    gfp_reduce( element, &param->order_n_data );
+}
+
+/**
+ * Finalizes a streaming signature generation (see ecdsa_sign_stream_init).
+ * The precomputed nonce is cleared; if the context is finalized again without
+ * ecdsa_sign_stream_init, a fresh nonce is computed.
+ * @param signature the resulting signature
+ * @param stream the streaming context
+ * @param private_key the used private key
+ * @param param elliptic curve parameters
+ */
+void ecdsa_sign_stream_final( ecdsa_signature_t *signature,
+                              ecdsa_stream_t *stream,
+                              const gfp_t private_key,
+                              const eccp_parameters_t *param ) {
+    gfp_t hash_of_message;
+
+    ecdsa_stream_digest( hash_of_message, stream, param );
+
+    do {
+        if( bigint_is_zero_var( stream->nonce.r, param->order_n_data.words ) == 1 ) {
+            ecdsa_nonces_generate( &stream->nonce, 1, param );
+        }
+        bigint_copy_var( signature->r, stream->nonce.r, param->order_n_data.words );
+        ecdsa_sign_compute_s( signature->s, stream->nonce.k_inverse, signature->r, hash_of_message, private_key, param );
+        // a nonce must never be used twice
+        bigint_clear_var( stream->nonce.r, param->order_n_data.words );
+        bigint_clear_var( stream->nonce.k_inverse, param->order_n_data.words );
+    } while( bigint_is_zero_var( signature->s, param->order_n_data.words ) == 1 );
+}
+
+/**
+ * Finalizes a streaming signature verification (see ecdsa_verify_stream_init).
+ * @param stream the streaming context
+ * @param signature the signature to check
+ * @param public_key the public key of the signer
+ * @param param elliptic curve parameters
+ * @return 1 if the signature is valid, 0 otherwise
+ */
+int ecdsa_verify_stream_final( ecdsa_stream_t *stream,
+                               const ecdsa_signature_t *signature,
+                               const eccp_point_affine_t *public_key,
+                               const eccp_parameters_t *param ) {
+    gfp_t hash_of_message;
+
+    ecdsa_stream_digest( hash_of_message, stream, param );
+    return ecdsa_is_valid( signature, hash_of_message, public_key, param );
 }
 
 /**
@@ -39,15 +39,93 @@
 #define ECDSA_H_
 
 #include "../types.h"
+#include "../hash/sha2.h"
+
+/** the number of nonces sharing one inversion in ecdsa_nonce_pool_refill and ecdsa_sign_batch */
+#define ECDSA_NONCE_BATCH_SIZE 16
+/** the number of signatures sharing one inversion in ecdsa_is_valid_batch */
+#define ECDSA_VERIFY_BATCH_SIZE 16
+/** the number of possible recovery ids (ecdsa_recover_public_key) */
+#define ECDSA_RECOVERY_MAX_CANDIDATES 4
+/** recovery id that makes ecdsa_recover_public_key return all candidates */
+#define ECDSA_RECOVERY_ID_ALL -1
+/** the block size of the hash function used by the streaming API (SHA-256) */
+#define ECDSA_STREAM_BLOCK_BYTES 64
+
+/** Context of a streaming ECDSA signature generation or verification with SHA-256
+ *  (see ecdsa_sign_stream_init and ecdsa_verify_stream_init) */
+typedef struct _ecdsa_stream_t_ {
+    /** the SHA-256 state of the processed blocks */
+    hash_sha224_256_t hash;
+    /** the bytes of the message not yet processed (less than a block) */
+    uint8_t block[ECDSA_STREAM_BLOCK_BYTES];
+    /** the number of bytes in block */
+    int block_length;
+    /** the total number of bytes of the message */
+    int total_length;
+    /** the nonce precomputed by ecdsa_sign_stream_init (unused for verification) */
+    ecdsa_nonce_t nonce;
+} ecdsa_stream_t;
 
 void ecdsa_sign( ecdsa_signature_t *signature,
                  const gfp_t hash_of_message,
                  const gfp_t private_key,
                  const eccp_parameters_t *param );
+int ecdsa_sign_with_key( ecdsa_signature_t *signature,
+                         const gfp_t hash_of_message,
+                         const eckey_private_t *private_key,
+                         const eccp_parameters_t *param );
+void ecdsa_sign_rfc6979( ecdsa_signature_t *signature,
+                         const gfp_t hash_of_message,
+                         const gfp_t private_key,
+                         const eccp_parameters_t *param );
+int ecdsa_sign_recoverable( ecdsa_signature_t *signature,
+                            const gfp_t hash_of_message,
+                            const gfp_t private_key,
+                            const eccp_parameters_t *param );
+int ecdsa_recover_public_key( eccp_point_affine_t *candidates,
+                              const ecdsa_signature_t *signature,
+                              const gfp_t hash_of_message,
+                              const int recovery_id,
+                              const eccp_parameters_t *param );
+void ecdsa_nonce_pool_init( ecdsa_nonce_pool_t *pool, ecdsa_nonce_t *nonces, const int capacity, const int low_watermark );
+int ecdsa_nonce_pool_needs_refill( const ecdsa_nonce_pool_t *pool );
+int ecdsa_nonce_pool_refill( ecdsa_nonce_pool_t *pool, const int max_count, const eccp_parameters_t *param );
+int ecdsa_sign_with_pool( ecdsa_signature_t *signature,
+                          const gfp_t hash_of_message,
+                          const gfp_t private_key,
+                          ecdsa_nonce_pool_t *pool,
+                          const eccp_parameters_t *param );
+void ecdsa_sign_batch( ecdsa_signature_t *signatures,
+                       const gfp_t *hashes_of_messages,
+                       const int count,
+                       const gfp_t private_key,
+                       const eccp_parameters_t *param );
+void ecdsa_sign_stream_init( ecdsa_stream_t *stream, const eccp_parameters_t *param );
+void ecdsa_stream_update( ecdsa_stream_t *stream, const uint8_t *data, const int length );
+void ecdsa_sign_stream_final( ecdsa_signature_t *signature,
+                              ecdsa_stream_t *stream,
+                              const gfp_t private_key,
+                              const eccp_parameters_t *param );
+void ecdsa_verify_stream_init( ecdsa_stream_t *stream );
+int ecdsa_verify_stream_final( ecdsa_stream_t *stream,
+                               const ecdsa_signature_t *signature,
+                               const eccp_point_affine_t *public_key,
+                               const eccp_parameters_t *param );
 int ecdsa_is_valid( const ecdsa_signature_t *signature,
                     const gfp_t hash_of_message,
                     const eccp_point_affine_t *public_key,
                     const eccp_parameters_t *param );
+int ecdsa_is_valid_with_key( const ecdsa_signature_t *signature,
+                             const gfp_t hash_of_message,
+                             const eckey_public_t *public_key,
+                             const eccp_parameters_t *param );
+int ecdsa_is_valid_batch( int *results,
+                          const ecdsa_signature_t *signatures,
+                          const gfp_t *hashes_of_messages,
+                          const eccp_point_affine_t *public_keys,
+                          const int count,
+                          const eccp_parameters_t *param );
 
 void ecdsa_hash_to_gfp( gfp_t element, const uint8_t *hash, const int hash_length, const gfp_prime_data_t *prime );
 
@@ -0,0 +1,194 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#include "../bi/bi.h"
+#include "../eccp/eccp.h"
+#include "../gfp/gfp.h"
+#include "../utils/rand.h"
+#include "eckey.h"
+
+/**
+ * Converts a checked point to the domain of the curve.
+ * @param key the resulting public key
+ * @param point the point (not in montgomery domain)
+ * @param valid the result of the checks of point
+ * @param param elliptic curve parameters
+ */
+static void eckey_public_set( eckey_public_t *key, const eccp_point_affine_t *point, const int valid, const eccp_parameters_t *param ) {
+    eccp_affine_point_copy( &key->point, point, param );
+    if( ( valid == 1 ) && ( param->prime_data.montgomery_domain == 1 ) ) {
+        gfp_normal_to_montgomery( key->point.x, key->point.x, &param->prime_data );
+        gfp_normal_to_montgomery( key->point.y, key->point.y, &param->prime_data );
+    }
+    key->valid = valid;
+}
+
+/**
+ * Imports a public key received from another party. The point is checked
+ * once (see eccp_affine_points_validate_batch) and converted to the domain
+ * of the curve, so that protocols using the key neither check nor convert it.
+ * @param key the resulting public key
+ * @param point the point (not in montgomery domain)
+ * @param param elliptic curve parameters
+ * @return 1 if the point is a valid public key, 0 otherwise (key is marked invalid)
+ */
+int eckey_public_import( eckey_public_t *key, const eccp_point_affine_t *point, const eccp_parameters_t *param ) {
+    uint_t valid[ECCP_BATCH_BITMAP_WORDS( 1 )];
+
+    eccp_affine_points_validate_batch( valid, point, 1, 1, param );
+    eckey_public_set( key, point, ECCP_BATCH_BITMAP_GET( valid, 0 ), param );
+    return key->valid;
+}
+
+/**
+ * Imports several public keys (e.g., a key directory), checking up to
+ * ECCP_VALIDATE_BATCH_SIZE points at once.
+ * @param keys the resulting public keys (count entries)
+ * @param points the points (count entries, not in montgomery domain)
+ * @param count the number of keys
+ * @param param elliptic curve parameters
+ * @return the number of valid public keys
+ */
+int eckey_public_import_batch( eckey_public_t *keys, const eccp_point_affine_t *points, const int count, const eccp_parameters_t *param ) {
+    uint_t valid[ECCP_BATCH_BITMAP_WORDS( ECCP_VALIDATE_BATCH_SIZE )];
+    int offset, batch, i;
+    int valid_count = 0;
+
+    for( offset = 0; offset < count; offset += batch ) {
+        batch = count - offset;
+        if( batch > ECCP_VALIDATE_BATCH_SIZE ) {
+            batch = ECCP_VALIDATE_BATCH_SIZE;
+        }
+        valid_count += eccp_affine_points_validate_batch( valid, &points[offset], batch, 1, param );
+        for( i = 0; i < batch; i++ ) {
+            eckey_public_set( &keys[offset + i], &points[offset + i], ECCP_BATCH_BITMAP_GET( valid, i ), param );
+        }
+    }
+    return valid_count;
+}
+
+/**
+ * Exports a public key (e.g., to send it to another party).
+ * @param point the resulting point (not in montgomery domain)
+ * @param key the public key
+ * @param param elliptic curve parameters
+ */
+void eckey_public_export( eccp_point_affine_t *point, const eckey_public_t *key, const eccp_parameters_t *param ) {
+    eccp_affine_point_copy( point, &key->point, param );
+    if( ( key->valid == 1 ) && ( param->prime_data.montgomery_domain == 1 ) ) {
+        gfp_montgomery_to_normal( point->x, point->x, &param->prime_data );
+        gfp_montgomery_to_normal( point->y, point->y, &param->prime_data );
+    }
+}
+
+/**
+ * Returns 1 if the public key passed the checks of eckey_public_import.
+ * @param key the public key
+ * @return 1 if the key is valid, 0 otherwise
+ */
+int eckey_public_is_valid( const eckey_public_t *key ) {
+    return key->valid;
+}
+
+/**
+ * Computes the public key and the Montgomery representation of a private key.
+ * @param key the private key (key->scalar is set)
+ * @param param elliptic curve parameters
+ */
+static void eckey_private_complete( eckey_private_t *key, const eccp_parameters_t *param ) {
+    gfp_normal_to_montgomery( key->scalar_mont, key->scalar, &param->order_n_data );
+    eccp_generic_mul_wrapper( &key->public_key.point, &param->base_point, key->scalar, param );
+    key->public_key.valid = 1;
+}
+
+/**
+ * Imports a private key.
+ * @param key the resulting private key
+ * @param scalar the private key d (param->order_n_data.words large)
+ * @param param elliptic curve parameters
+ * @return 1 if d is in [1,n-1], 0 otherwise (key is left unchanged)
+ */
+int eckey_private_import( eckey_private_t *key, const gfp_t scalar, const eccp_parameters_t *param ) {
+    if( bigint_is_zero_var( scalar, param->order_n_data.words ) == 1 )
+        return 0;
+    if( bigint_compare_var( scalar, param->order_n_data.prime, param->order_n_data.words ) >= 0 )
+        return 0;
+
+    bigint_copy_var( key->scalar, scalar, param->order_n_data.words );
+    eckey_private_complete( key, param );
+    return 1;
+}
+
+/**
+ * Exports a private key.
+ * @param scalar the resulting private key d (param->order_n_data.words large)
+ * @param key the private key
+ * @param param elliptic curve parameters
+ */
+void eckey_private_export( gfp_t scalar, const eckey_private_t *key, const eccp_parameters_t *param ) {
+    bigint_copy_var( scalar, key->scalar, param->order_n_data.words );
+}
+
+/**
+ * Generates a new key pair.
+ * @param key the resulting private key
+ * @param param elliptic curve parameters
+ */
+void eckey_private_generate( eckey_private_t *key, const eccp_parameters_t *param ) {
+    gfp_rand( key->scalar, &param->order_n_data );
+    eckey_private_complete( key, param );
+}
+
+/**
+ * Returns the public key belonging to a private key.
+ * @param key the private key
+ * @return the public key (valid as long as key)
+ */
+const eckey_public_t *eckey_private_get_public( const eckey_private_t *key ) {
+    return &key->public_key;
+}
+
+/**
+ * Overwrites a private key with zeros.
+ * @param key the private key
+ */
+void eckey_private_clear( eckey_private_t *key ) {
+    bigint_clear_var( key->scalar, WORDS_PER_GFP );
+    bigint_clear_var( key->scalar_mont, WORDS_PER_GFP );
+    key->public_key.valid = 0;
+}
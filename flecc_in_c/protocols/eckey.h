@@ -0,0 +1,55 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+#ifndef ECKEY_H_
+#define ECKEY_H_
+
+#include "../types.h"
+
+int eckey_public_import( eckey_public_t *key, const eccp_point_affine_t *point, const eccp_parameters_t *param );
+int eckey_public_import_batch( eckey_public_t *keys, const eccp_point_affine_t *points, const int count, const eccp_parameters_t *param );
+void eckey_public_export( eccp_point_affine_t *point, const eckey_public_t *key, const eccp_parameters_t *param );
+int eckey_public_is_valid( const eckey_public_t *key );
+
+int eckey_private_import( eckey_private_t *key, const gfp_t scalar, const eccp_parameters_t *param );
+void eckey_private_export( gfp_t scalar, const eckey_private_t *key, const eccp_parameters_t *param );
+void eckey_private_generate( eckey_private_t *key, const eccp_parameters_t *param );
+const eckey_public_t *eckey_private_get_public( const eckey_private_t *key );
+void eckey_private_clear( eckey_private_t *key );
+
+#endif /* ECKEY_H_ */
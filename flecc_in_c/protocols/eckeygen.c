@@ -38,6 +38,7 @@
 #include "../eccp/eccp.h"
 #include "../utils/rand.h"
 #include "../gfp/gfp.h"
+#include "eckeygen.h"
 
 /**
  * Generate an elliptic curve key pair
@@ -56,3 +57,49 @@ void eckeygen( gfp_t private_key, eccp_point_affine_t *public_key, eccp_paramete
         gfp_montgomery_to_normal( public_key->y, public_key->y, &param->prime_data );
     }
 }
+
+/**
+ * Generate several elliptic curve key pairs. The private keys of up to
+ * ECKEYGEN_BATCH_SIZE key pairs are drawn at once (gfp_rand_multiple), the
+ * public keys are computed in Jacobian coordinates and converted to affine
+ * coordinates with a single inversion (eccp_batch_normalize).
+ * @param private_keys resulting private keys (count entries)
+ * @param public_keys resulting public keys (count entries, not in montgomery domain)
+ * @param count the number of key pairs
+ * @param param elliptic curve parameters
+ */
+void eckeygen_batch( gfp_t *private_keys, eccp_point_affine_t *public_keys, const int count, const eccp_parameters_t *param ) {
+    uint_t buffer[ECCP_BATCH_BUFFER_WORDS( ECKEYGEN_BATCH_SIZE, WORDS_PER_GFP )];
+    eccp_point_batch_t points;
+    eccp_point_projective_t point;
+    eccp_point_affine_t *public_key;
+    int offset, batch, i;
+
+    for( offset = 0; offset < count; offset += batch ) {
+        batch = count - offset;
+        if( batch > ECKEYGEN_BATCH_SIZE ) {
+            batch = ECKEYGEN_BATCH_SIZE;
+        }
+        gfp_rand_multiple( &private_keys[offset], batch, &param->order_n_data );
+
+        eccp_batch_init( &points, buffer, batch, param );
+        for( i = 0; i < batch; i++ ) {
+            eccp_jacobian_point_multiply_base_point( &point, private_keys[offset + i], param );
+            eccp_batch_set( &points, i, &point, param );
+        }
+        eccp_batch_normalize( &points, param );
+
+        // the normalized points have z = 1
+        for( i = 0; i < batch; i++ ) {
+            public_key = &public_keys[offset + i];
+            public_key->identity = eccp_batch_is_identity( &points, i );
+            if( param->prime_data.montgomery_domain == 1 ) {
+                gfp_montgomery_to_normal( public_key->x, points.x + i * points.words, &param->prime_data );
+                gfp_montgomery_to_normal( public_key->y, points.y + i * points.words, &param->prime_data );
+            } else {
+                bigint_copy_var( public_key->x, points.x + i * points.words, param->prime_data.words );
+                bigint_copy_var( public_key->y, points.y + i * points.words, param->prime_data.words );
+            }
+        }
+    }
+}
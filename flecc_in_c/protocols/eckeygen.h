@@ -40,6 +40,10 @@
 
 #include "../types.h"
 
+/** the number of key pairs of eckeygen_batch normalized with one inversion */
+#define ECKEYGEN_BATCH_SIZE 16
+
 void eckeygen( gfp_t private_key, eccp_point_affine_t *public_key, eccp_parameters_t *param );
+void eckeygen_batch( gfp_t *private_keys, eccp_point_affine_t *public_keys, const int count, const eccp_parameters_t *param );
 
 #endif /* ECKEYGEN_H_ */
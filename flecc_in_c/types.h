@@ -38,6 +38,7 @@
 #ifndef TYPES_H_
 #define TYPES_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef uint32_t uint_t;
@@ -102,6 +103,33 @@ typedef struct _eccp_point_projective_t_ {
     gfp_t z;
     uint8_t identity;
 } eccp_point_projective_t;
+/** Elliptic curve point using modified Jacobian (x,y,z,a*z^4) coordinates. */
+typedef struct _eccp_point_modified_jacobian_t_ {
+    gfp_t x;
+    gfp_t y;
+    gfp_t z;
+    /** a*z^4 (cached between point operations) */
+    gfp_t az4;
+    uint8_t identity;
+} eccp_point_modified_jacobian_t;
+/** Batch of elliptic curve points in Jacobian coordinates stored as structure of arrays
+ *  (see eccp_batch.h). Each coordinate uses words words; point i starts at index i * words. */
+typedef struct _eccp_point_batch_t_ {
+    /** x coordinates */
+    uint_t *x;
+    /** y coordinates */
+    uint_t *y;
+    /** z coordinates */
+    uint_t *z;
+    /** temporary storage (e.g., for the simultaneous inversion of eccp_batch_normalize) */
+    uint_t *temp;
+    /** bitmap of the points at infinity (bit i % BITS_PER_WORD of identity[i / BITS_PER_WORD]) */
+    uint_t *identity;
+    /** the number of points in the batch */
+    uint_t count;
+    /** the number of words per coordinate */
+    uint_t words;
+} eccp_point_batch_t;
 /** specifies the used eccp_parameters_t */
 typedef enum _curve_type_t { UNKNOWN, SECP192R1, SECP224R1, SECP256R1, SECP384R1, SECP521R1, CUSTOM } curve_type_t;
 /** function point to a gfp operation (TODO: integrate into eccp_parameters_t) */
@@ -112,6 +140,19 @@ struct _eccp_parameters_t_;
 typedef void (*eccp_mul_t)(eccp_point_affine_t *,const eccp_point_affine_t*,const gfp_t,const struct _eccp_parameters_t_*);
 /** typedef of function pointer to an optimized scalar multiplication with constant point (used in eccp_parameters_t). */
 typedef void (*eccp_mul_const_t)(eccp_point_affine_t *,const gfp_t,const struct _eccp_parameters_t_*);
+/** Fixed point with its own comb pre-computation table (see eccp_generic.h). */
+typedef struct _eccp_fixed_point_t_ {
+    /** the registered point */
+    eccp_point_affine_t point;
+    /** comb table of point (COMB or, if constant_time is set, COMB_WOZ; NULL if the entry is unused) */
+    eccp_point_affine_t *table;
+    /** the comb width of table */
+    uint_t width;
+    /** the number of comb blocks of table (1 for COMB_WOZ) */
+    uint_t blocks;
+    /** 1 if the point is multiplied in constant time (eccp_protected_point_multiply_COMB_WOZ_table) */
+    int constant_time;
+} eccp_fixed_point_t;
 /** Parameters needed to do elliptic curve computations. */
 typedef struct _eccp_parameters_t_ {
     /** data needed to do computations modulo the prime */
@@ -131,17 +172,72 @@ typedef struct _eccp_parameters_t_ {
     curve_type_t curve_type;
     /** generic scalar multiplication to be used for protocols */
     eccp_mul_t eccp_mul;
-    /** pointer to a table with precomputed multiples of the base_point to be used by eccp_mul_base_point */
-    eccp_point_affine_t *base_point_precomputed_table;
+    /** pointer to a table with precomputed multiples of the base_point to be used by eccp_mul_base_point
+     *  (read-only, e.g., the const tables of param_attach_const_table or a mapped table file) */
+    const eccp_point_affine_t *base_point_precomputed_table;
     /** the comb parameter that influences the size of the comb table */
     uint_t base_point_precomputed_table_width;
+    /** the number of comb blocks (Lim-Lee) stored in the comb table (0 is treated as 1) */
+    uint_t base_point_precomputed_table_blocks;
+    /** base_point_precomputed_table stored with the curve's word size (see eccp_packed.h), or NULL */
+    const uint_t *base_point_precomputed_table_packed;
+    /** the table file mapped by param_attach_table_mmap (see param_mmap.h), or NULL */
+    void *base_point_table_mapping;
+    /** the length of base_point_table_mapping in bytes */
+    size_t base_point_table_mapping_length;
     /** optimized scalar multiplication of the base point (uses base_point_tbl) */
     eccp_mul_const_t eccp_mul_base_point;
+    /** registry of further fixed points, indexed by handle (see eccp_fixed_point_register), or NULL */
+    eccp_fixed_point_t *fixed_points;
+    /** the number of entries of fixed_points */
+    uint_t fixed_points_capacity;
 } eccp_parameters_t;
+/** Public key in the internal representation of the curve (see eckey.h);
+ *  the members are only accessed by the eckey_* functions */
+typedef struct _eckey_public_t_ {
+    /** the point in the domain of the curve (Montgomery domain if used) */
+    eccp_point_affine_t point;
+    /** 1 if the point passed the checks of eckey_public_import */
+    uint8_t valid;
+} eckey_public_t;
+/** Private key together with its public key (see eckey.h);
+ *  the members are only accessed by the eckey_* functions */
+typedef struct _eckey_private_t_ {
+    /** the scalar d in [1,n-1] (normal domain, used for point multiplications) */
+    gfp_t scalar;
+    /** d*R in Montgomery domain of order n (used for the s of ECDSA signatures) */
+    gfp_t scalar_mont;
+    /** the public key d*G */
+    eckey_public_t public_key;
+} eckey_private_t;
 /** ECDSA signature, with GF(p) elements modulo ecc_parameters_t.order_n_data */
 typedef struct _ecdsa_signature_t_ {
     gfp_t r;
     gfp_t s;
 } ecdsa_signature_t;
+/** Precomputed ECDSA nonce (see ecdsa_nonce_pool_refill) */
+typedef struct _ecdsa_nonce_t_ {
+    /** k^-1 in Montgomery domain of order n */
+    gfp_t k_inverse;
+    /** x coordinate of k*G modulo n (the r of the signature) */
+    gfp_t r;
+} ecdsa_nonce_t;
+/** Pool of precomputed ECDSA nonces used by ecdsa_sign_with_pool */
+typedef struct _ecdsa_nonce_pool_t_ {
+    /** storage of the nonces (capacity entries) */
+    ecdsa_nonce_t *nonces;
+    /** the maximum number of nonces */
+    uint_t capacity;
+    /** the number of available nonces */
+    uint_t count;
+    /** ecdsa_nonce_pool_needs_refill signals a refill if count drops to this value */
+    uint_t low_watermark;
+    /** statistics: the total number of precomputed nonces */
+    uint_t generated;
+    /** statistics: the number of signatures computed with a pooled nonce */
+    uint_t consumed;
+    /** statistics: the number of signatures computed while the pool was empty */
+    uint_t underruns;
+} ecdsa_nonce_pool_t;
 
 #endif /* TYPES_H_ */
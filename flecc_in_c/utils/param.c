@@ -91,6 +91,48 @@ extern const uint_t SECP521R1_B[16];
 extern const uint_t SECP521R1_BASE_X[16];
 extern const uint_t SECP521R1_BASE_Y[16];
 
+extern const eccp_point_affine_t SECP192R1_COMB_WOZ_W4[8];
+extern const eccp_point_affine_t SECP192R1_COMB_WOZ_W5[16];
+extern const eccp_point_affine_t SECP192R1_COMB_WOZ_W6[32];
+extern const eccp_point_affine_t SECP224R1_COMB_WOZ_W4[8];
+extern const eccp_point_affine_t SECP224R1_COMB_WOZ_W5[16];
+extern const eccp_point_affine_t SECP224R1_COMB_WOZ_W6[32];
+extern const eccp_point_affine_t SECP256R1_COMB_WOZ_W4[8];
+extern const eccp_point_affine_t SECP256R1_COMB_WOZ_W5[16];
+extern const eccp_point_affine_t SECP256R1_COMB_WOZ_W6[32];
+extern const eccp_point_affine_t SECP384R1_COMB_WOZ_W4[8];
+extern const eccp_point_affine_t SECP384R1_COMB_WOZ_W5[16];
+extern const eccp_point_affine_t SECP384R1_COMB_WOZ_W6[32];
+extern const eccp_point_affine_t SECP521R1_COMB_WOZ_W4[8];
+extern const eccp_point_affine_t SECP521R1_COMB_WOZ_W5[16];
+extern const eccp_point_affine_t SECP521R1_COMB_WOZ_W6[32];
+
+/** a pre-computed COMB_WOZ table stored in const memory (see param_const_tables.c) */
+typedef struct _param_const_table_t_ {
+    curve_type_t type;
+    uint_t width;
+    const eccp_point_affine_t *table;
+} param_const_table_t;
+
+/** all pre-computed tables generated by table_gen */
+static const param_const_table_t param_const_tables[] = {
+    { SECP192R1, 4, SECP192R1_COMB_WOZ_W4 },
+    { SECP192R1, 5, SECP192R1_COMB_WOZ_W5 },
+    { SECP192R1, 6, SECP192R1_COMB_WOZ_W6 },
+    { SECP224R1, 4, SECP224R1_COMB_WOZ_W4 },
+    { SECP224R1, 5, SECP224R1_COMB_WOZ_W5 },
+    { SECP224R1, 6, SECP224R1_COMB_WOZ_W6 },
+    { SECP256R1, 4, SECP256R1_COMB_WOZ_W4 },
+    { SECP256R1, 5, SECP256R1_COMB_WOZ_W5 },
+    { SECP256R1, 6, SECP256R1_COMB_WOZ_W6 },
+    { SECP384R1, 4, SECP384R1_COMB_WOZ_W4 },
+    { SECP384R1, 5, SECP384R1_COMB_WOZ_W5 },
+    { SECP384R1, 6, SECP384R1_COMB_WOZ_W6 },
+    { SECP521R1, 4, SECP521R1_COMB_WOZ_W4 },
+    { SECP521R1, 5, SECP521R1_COMB_WOZ_W5 },
+    { SECP521R1, 6, SECP521R1_COMB_WOZ_W6 }
+};
+
 /**
  * Compare two buffers which both have length limitations.
  * @param buffer1
@@ -334,5 +376,62 @@ void param_load( eccp_parameters_t *param, const curve_type_t type ) {
     param->eccp_mul_base_point = NULL;
     param->base_point_precomputed_table = NULL;
     param->base_point_precomputed_table_width = 0;
+    param->base_point_precomputed_table_blocks = 1;
+    param->base_point_precomputed_table_packed = NULL;
+    param->base_point_table_mapping = NULL;
+    param->base_point_table_mapping_length = 0;
+    param->fixed_points = NULL;
+    param->fixed_points_capacity = 0;
     
 }
+
+/**
+ * Selects the variable-base point multiplication param->eccp_mul. param_load
+ * sets the protected multiplication, whose Montgomery ladder does not depend on
+ * the curve parameter a. For public scalars (e.g., signature verification),
+ * a NAF multiplication in modified Jacobian coordinates is selected if the curve
+ * parameter a is neither 0 nor -3, and in Jacobian coordinates otherwise.
+ * @param param elliptic curve parameters (loaded by param_load, including param_a)
+ * @param constant_time if 1, eccp_protected_point_multiply is selected (for secret scalars)
+ */
+void param_select_mul( eccp_parameters_t *param, const int constant_time ) {
+    if( constant_time ) {
+        param->eccp_mul = &eccp_protected_point_multiply;
+    } else if( eccp_modified_jacobian_is_preferable( param ) ) {
+        param->eccp_mul = &eccp_modified_jacobian_point_multiply_L2R_NAF;
+    } else {
+        param->eccp_mul = &eccp_jacobian_point_multiply_L2R_NAF;
+    }
+}
+
+/**
+ * Attaches a pre-computed (read-only) COMB_WOZ table of the base point and
+ * sets eccp_mul_base_point accordingly. No pre-computation is needed at runtime.
+ * The attached table resides in const memory; the *_precompute functions
+ * replace it by a table in their own (writable) storage.
+ * @param param elliptic curve parameters (loaded by param_load)
+ * @param width the comb width (4, 5, or 6)
+ * @param constant_time if 1, eccp_protected_point_multiply_COMB_WOZ is selected as
+ *        eccp_mul_base_point (for secret scalars, e.g., ECDSA nonces and private keys)
+ * @return 1 if a table was attached, 0 if no table is available (param is unchanged)
+ */
+int param_attach_const_table( eccp_parameters_t *param, const uint_t width, const int constant_time ) {
+    int i;
+
+    for( i = 0; i < (int)( sizeof( param_const_tables ) / sizeof( param_const_tables[0] ) ); i++ ) {
+        if( ( param_const_tables[i].type == param->curve_type ) && ( param_const_tables[i].width == width ) ) {
+            param->base_point_precomputed_table = param_const_tables[i].table;
+            param->base_point_precomputed_table_width = width;
+            param->base_point_precomputed_table_blocks = 1;
+            if( constant_time ) {
+                param->eccp_mul_base_point = &eccp_protected_point_multiply_COMB_WOZ;
+            } else if( eccp_modified_jacobian_is_preferable( param ) ) {
+                param->eccp_mul_base_point = &eccp_modified_jacobian_point_multiply_COMB_WOZ;
+            } else {
+                param->eccp_mul_base_point = &eccp_jacobian_point_multiply_COMB_WOZ;
+            }
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -49,6 +49,8 @@ typedef struct _eccp_param_in_const_mem_t_ {
 
 curve_type_t param_get_curve_type_from_name( const char *buffer, const int buffer_length);
 void param_load( eccp_parameters_t *param, const curve_type_t type );
+void param_select_mul( eccp_parameters_t *param, const int constant_time );
+int param_attach_const_table( eccp_parameters_t *param, const uint_t width, const int constant_time );
 
 void param_load_from_const_mem( eccp_parameters_t *param, eccp_param_in_const_mem_t *param_in_mem );
 
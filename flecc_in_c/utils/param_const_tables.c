@@ -0,0 +1,365 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+/* generated by table_gen - do not edit */
+
+#include "../types.h"
+
+const eccp_point_affine_t SECP192R1_COMB_WOZ_W4[8] = {
+    {{0x8F2BCDB4, 0x9DFBC41A, 0xC7ADDCE7, 0x995D1066, 0x207E473D, 0x36ED0D94}, {0xCC256969, 0xDB1DA3EA, 0x8087E8DD, 0xB72ABF01, 0xF1AF1159, 0xCF72CD04}, 0},
+    {{0x42162D47, 0x33B259E7, 0xA6C2F00A, 0x1DBBD5EF, 0x53C33C2D, 0xE1CF1351}, {0x5ED96C77, 0x1BBBD3A7, 0xB88AE7E9, 0xC5164299, 0x009BA942, 0x0F70774D}, 0},
+    {{0xEA4700B1, 0xCD564626, 0x205DCE0D, 0x3DED6410, 0x5BBBA5BA, 0x71731573}, {0x5893A8CD, 0x1967B679, 0x57A86AA7, 0x8945C42B, 0x00F133CD, 0xF4535194}, 0},
+    {{0xA601FDB9, 0x5E221381, 0xA9AAF478, 0x768C5209, 0x2E5596AD, 0x1613DB14}, {0xDC2C3160, 0x2D63A559, 0x2D2FC078, 0x61FAF9AF, 0xE66BB9E7, 0x3EA44591}, 0},
+    {{0xBF4F30BB, 0x2204C1C8, 0xEB12D38D, 0x443E99DE, 0x8484C0CC, 0x111AF0A3}, {0x506199EF, 0xE1F8702B, 0xB99681E0, 0x1B6E87B7, 0x5B7517A2, 0x06B91DB8}, 0},
+    {{0xB44CBDBB, 0xC66C3658, 0x6F9ECD4C, 0x61D68493, 0x9795BDA4, 0x3CC024EF}, {0x24150145, 0xEBD0A000, 0xD7F7CF37, 0x2CDDACA5, 0x054F3067, 0x914CEB7E}, 0},
+    {{0xCEED0572, 0x33FB7C09, 0xBEAF833C, 0xB5EB1350, 0x3D1783CD, 0x2EEF76B4}, {0x89514457, 0x43F14164, 0xD4AA5559, 0xAE78A897, 0x44ADC090, 0x19721CF5}, 0},
+    {{0x952D98A7, 0xB6164F8B, 0x6D26D49C, 0x632CCE7C, 0xED474212, 0xA7C06322}, {0xABDACC33, 0xE4B4DB41, 0x81D2ACC2, 0x45B68E00, 0xACA61D83, 0x3979809C}, 0}
+};
+
+const eccp_point_affine_t SECP192R1_COMB_WOZ_W5[16] = {
+    {{0x8A45F4F9, 0x1D139262, 0x9F793AFF, 0xE1217DF2, 0xB02E334C, 0x5F7B06CC}, {0xBE1E25BB, 0x0A34B324, 0xE3550893, 0xA0A3D2B9, 0x94B8DFD3, 0x72312879}, 0},
+    {{0x13F76301, 0xDAA0784F, 0xA11B40C6, 0x0652FE47, 0x54999FB8, 0xF6B9678B}, {0xCD6B0D04, 0x37E18BAF, 0x736D057E, 0xEC011410, 0xD31F1121, 0xC3611C22}, 0},
+    {{0xD5228A7F, 0x7CF72DBD, 0xB9A2ABEA, 0xE77BA83B, 0x2A09868E, 0xA0E064C9}, {0xFD49E1D9, 0x41803A24, 0x921A52F7, 0xE1D1CD06, 0x2EBF030E, 0xAF49612D}, 0},
+    {{0x4E9A8557, 0x4CC03348, 0x18184C39, 0x6D0E05FE, 0x799BF519, 0x1A687692}, {0xD43853A9, 0x879A7126, 0x5256C37A, 0xFE77C6B0, 0xC6A3B52D, 0x7F417202}, 0},
+    {{0x086A3995, 0x4459AD64, 0x3A65A6A3, 0xD422D474, 0x235CDEC7, 0x3F4643CB}, {0x4DF1A0D4, 0x6DD025B2, 0x886E1791, 0x6C5DD7C2, 0x693FCF63, 0x08765547}, 0},
+    {{0xB06A2BC8, 0x9424D911, 0xC407B4A4, 0x7AF4F0F7, 0x267E0973, 0x02C7BC9D}, {0xF6E4AA7D, 0xFD290000, 0x7175E8F5, 0x771D1D50, 0x7110498B, 0xB7DD4A25}, 0},
+    {{0x934E05F7, 0x148F7E2C, 0x976A99C4, 0xFC50634D, 0xD83186B8, 0xBFCF54B0}, {0xCA57B27B, 0xA72F64B3, 0xB8B410F5, 0x8449FACF, 0x39FF701F, 0xB312DC58}, 0},
+    {{0x11C8486F, 0x11605D2D, 0xECE2B136, 0x53EDCF54, 0x5095F4A3, 0xDFF99213}, {0xB7F51E74, 0xFD0A8387, 0xD619AFD0, 0x1F0F92D8, 0xAAC49425, 0x74C2E178}, 0},
+    {{0x2D732F7E, 0x5F2BD473, 0x75579EB1, 0x028168FA, 0x68A5CE63, 0x65D1B38A}, {0xFBEFB189, 0xB3FFE951, 0xF70AACAE, 0xF411B515, 0xFD620F7F, 0xDCF7834B}, 0},
+    {{0xDFF5E7CB, 0xBD29865D, 0x89DA30B1, 0x69182CB3, 0x56150E28, 0x8D13585D}, {0x11745C53, 0x3230117D, 0x9E7ACA4C, 0x7383496B, 0x962CA725, 0xB6A67B49}, 0},
+    {{0xEEE25F75, 0xDBFCE6AF, 0xE1FF111A, 0x6DB1FB73, 0x023F6785, 0x2C5478AA}, {0xA3EE4D38, 0xE0E3929A, 0xDE9599AE, 0x9B08CC98, 0x8329B98A, 0x2D4AF222}, 0},
+    {{0x6DDBEDE1, 0x1207ECE2, 0x952F3002, 0xD08638FB, 0x572026CE, 0x33BE89AD}, {0xEDD9A08E, 0x4990530D, 0x7B458BDD, 0x8B6C9BF8, 0x5C0276F7, 0xE2C5F852}, 0},
+    {{0x17462E7A, 0xFAFDFC67, 0x458A5C85, 0x77D91F00, 0x754D1445, 0x8806C3C2}, {0xAB6F940E, 0xC5536F87, 0x64186B95, 0x03E5F138, 0xFC09D606, 0x9F67C12A}, 0},
+    {{0xB9BFAE4F, 0x8A768B2A, 0x702B560D, 0xF0B1738A, 0xEB6E56ED, 0x84C4A329}, {0x7DC50EC1, 0x5A75B99C, 0x1C47333D, 0x45F20618, 0xA76CCF74, 0x97C6C293}, 0},
+    {{0x926BD71D, 0x4EE2F0C7, 0xAF03DC2D, 0x766E2175, 0x16F9ED97, 0x1E5F6A6E}, {0xB116BD35, 0xD464E0E8, 0xBEF5F1CB, 0xA54D5F4A, 0x397A9979, 0x828DE1FB}, 0},
+    {{0xF2ADAF50, 0x1D103827, 0xF1775B82, 0xBC2A4314, 0x9087DB9D, 0xE752C2C4}, {0xC96E240A, 0xBC1AD0FF, 0xDB6BE29B, 0xCF2F0E30, 0x42E633EA, 0x2FB00832}, 0}
+};
+
+const eccp_point_affine_t SECP192R1_COMB_WOZ_W6[32] = {
+    {{0xDC638F13, 0xE4A8F462, 0x8E2D32B8, 0xEBADB21F, 0x5781840E, 0xCCCEBFD9}, {0x17D35AE5, 0x7A5B1439, 0x13B8B586, 0xBEED90AC, 0x9A51A8CB, 0x7F860FA6}, 0},
+    {{0xD71FEEB6, 0x818F7884, 0x599E684E, 0x8545CADB, 0x4B60E44C, 0xECD917F0}, {0xB2D4177E, 0x6D45AD76, 0xA7033222, 0x909BBB3C, 0x521DFB03, 0x64CA33C5}, 0},
+    {{0x5B7679A5, 0x198A1441, 0xBF03CF3C, 0xFA9C076C, 0xD59320BA, 0x956166CA}, {0xAEF4CC55, 0xAFFC9B95, 0xF8019ABE, 0xB211E0F1, 0x0D189281, 0x53C31D2C}, 0},
+    {{0x8B280CEC, 0x76891C33, 0xB7395CE4, 0xDCD8A7FB, 0x9778B5C5, 0x3A8EDFE1}, {0x4B6869AA, 0x45D82E9F, 0x68766CAC, 0x9E8B78D5, 0x8999CBEE, 0x99E08120}, 0},
+    {{0xD6D8348C, 0xEB7408FF, 0x75DAF76E, 0x9587D947, 0xB0CED1DF, 0x70216201}, {0x7907ADB3, 0x906D1438, 0x7966117F, 0xA6556756, 0x3CF59FCA, 0xBD9C2CA1}, 0},
+    {{0x5B429CB5, 0x08268FD1, 0x61ECCDB0, 0x0065C77A, 0x08DC9538, 0xA60D4B0B}, {0x94F341D6, 0xEFAAC06C, 0xDC044282, 0x5109E489, 0x2C53F5D9, 0x690F3DEC}, 0},
+    {{0x665D8D50, 0xF961670A, 0x94BF77BC, 0xD46911E7, 0xC714FB85, 0x02DA549A}, {0xDE5D3900, 0xC86F06CD, 0xCB31DB52, 0xC6C32B44, 0xB0627D61, 0x0C4BFB18}, 0},
+    {{0x1FB0BEAD, 0x1AE03C7F, 0xDE17C1BC, 0x5B7C0429, 0x59304ED9, 0xE3763887}, {0x6C29296C, 0xC55C7576, 0xBDDEE231, 0x2759F0E7, 0x27947669, 0x6B9C5B79}, 0},
+    {{0x3C270E5B, 0x61398A29, 0xD1A2A1CD, 0xAA02D125, 0xC0A5EA6D, 0xD71331F8}, {0x962F1290, 0xDFB9A314, 0x576361D7, 0xB1285832, 0xD7F873E6, 0x13598B69}, 0},
+    {{0x22D4BCC8, 0xDACE0E85, 0x8B67158B, 0xD763DA86, 0x80EF40B5, 0x37C5858E}, {0xD84F69F5, 0xB8AF3E06, 0xC0290809, 0xFB51A86A, 0x12138184, 0xB0A033E1}, 0},
+    {{0x976380D9, 0x82D41985, 0xF2565719, 0x9D9D67D9, 0x59DEDACF, 0x9C8CD9C9}, {0x273B966D, 0x92C15DA7, 0xB84094D7, 0xC3AF8B69, 0x57B94195, 0xB4781CAC}, 0},
+    {{0xA53CAF72, 0x456672A5, 0xE4E10F36, 0xE6616650, 0x68EA49F3, 0x52BF984D}, {0x52C252FC, 0x3C4CE177, 0x67406DC0, 0x75F7FF95, 0xCA747323, 0x42D9ADB5}, 0},
+    {{0x0C6439AA, 0x212C996A, 0xF622A6A8, 0xC1844566, 0xFF6A93A0, 0x8D066C5E}, {0x0A072F94, 0x5A02278D, 0x88B3C51E, 0x16153D72, 0xAFD6C56F, 0x1CE93CDA}, 0},
+    {{0x70AD18F1, 0x277E9E04, 0xF197BDF9, 0xE9CE79EB, 0x943D012A, 0xCA9AA814}, {0xEE902415, 0x09C0E123, 0x9E186E76, 0x963048B7, 0xED4B39F8, 0xDF65ACDE}, 0},
+    {{0x9D404E6B, 0x309AEFC3, 0xC86B3A95, 0x539C4F73, 0xDA5BB35A, 0xFBEBF775}, {0x5B5522D9, 0x3A699B1C, 0x3577660C, 0x590C1315, 0x50D94FE5, 0x4A811AA4}, 0},
+    {{0x822662AC, 0x4E94538E, 0x0EB93ACA, 0x6899D0DF, 0x5152293C, 0xE9344D94}, {0xF6661522, 0x07C6FCD8, 0xEB92887C, 0x1036CE86, 0x15069AAB, 0x1A60955D}, 0},
+    {{0x209EE074, 0x62DD6BBA, 0xCBAE509B, 0x94CE8C04, 0x44F1ADF7, 0xBBC0B6C9}, {0xA98E4AAB, 0x544AEA0F, 0x9696CCF4, 0xF31E4BC0, 0x8E8BD14D, 0x3E6DA0E8}, 0},
+    {{0xE239B59F, 0x41AACAB0, 0x62CDA785, 0x1346545A, 0xE3432BB7, 0xA31B3B92}, {0xE59DF923, 0x494184FE, 0x666DDD6B, 0xA470FF72, 0xC988203D, 0x095FAD0A}, 0},
+    {{0xDB05A2B6, 0xA1ADE2FF, 0x1EB57AC8, 0x0F67CA13, 0x1980C028, 0x3EF84A9E}, {0x773A3FDD, 0x54745EAD, 0x87651FCA, 0xA9F603A7, 0x914BAD6A, 0x29AFDD0A}, 0},
+    {{0x4CAD93EA, 0x4AA26081, 0xAA968FBC, 0x3CDFBF24, 0x58443093, 0xDFC3EB9E}, {0x2E1E2312, 0x2B5CD0E0, 0xBF573B19, 0x8A1F57AE, 0xAF890552, 0xE4A6C116}, 0},
+    {{0xD84CE28E, 0xDC3F643E, 0x6C58A71C, 0x83648749, 0x80994EED, 0x8435BBFE}, {0x024731B6, 0x9D466740, 0xC9C2DE58, 0xF450E611, 0xCB0E19AC, 0x012D6549}, 0},
+    {{0x0002AD39, 0xD36CC7E6, 0x2B1E523B, 0x7D215561, 0xC7E02BB0, 0x2AEBA42C}, {0x30F188D6, 0xF0C60514, 0x250E5186, 0xC9A025ED, 0x853A461C, 0xC2BD6A0A}, 0},
+    {{0x2CD5E2A8, 0xCFFAAE8D, 0x807F9DFE, 0x1ABF02DB, 0x78D9063D, 0x49FFD3BC}, {0xD24EDBD3, 0x39A19F8A, 0x33102C0C, 0x08AB954A, 0x5B9474CB, 0xD212A00F}, 0},
+    {{0x82525153, 0x2AD2BAB9, 0x9EBDC78A, 0x57EB6395, 0xC4BAA9D5, 0x8D85A358}, {0x6770CDD1, 0xEB2B3026, 0x8C59FB58, 0xF374CDA2, 0x6008B7D4, 0x09AECA81}, 0},
+    {{0xCF641B9F, 0xF9DEC6B4, 0x7EF7D9A2, 0x63098622, 0xCDCA899D, 0xAA7AB924}, {0xD15B912E, 0x8D99874D, 0xC8A31022, 0x1360B683, 0x0E2DD6D0, 0xE8D73DEB}, 0},
+    {{0x3658F7E4, 0xC6C70E06, 0x2ECE2128, 0xE888F1CA, 0xC6DD5397, 0x17F291D4}, {0xBD708564, 0xD1906B05, 0x5C7D1CE9, 0xF20D2A07, 0x07D1B1D8, 0x1D1DC57D}, 0},
+    {{0x78656E91, 0x2691E29A, 0xDB85E7C7, 0xA6DEAECB, 0x6ADCA02E, 0xDA1AA16A}, {0xB9E79C32, 0x40474687, 0x0CAAC4C5, 0x6BA15F31, 0x6B18A7A3, 0x5FC00E75}, 0},
+    {{0x199EFC46, 0x3C1786BD, 0xF10D14D8, 0x153A7249, 0xE5BD1898, 0xBD0783B0}, {0x9D0AFC5B, 0xB3F9040E, 0xB7AA79C5, 0x61171DC0, 0x28434D55, 0x1B016E92}, 0},
+    {{0xDDFE415E, 0x024D63FD, 0x7F0CEA84, 0xBDAC567E, 0xDFA4E909, 0xC0443CE1}, {0x14265485, 0x22EC4D5D, 0xB2402648, 0xC66828EA, 0xBBB748CE, 0x3629FD63}, 0},
+    {{0xEC968E53, 0xD8278BC6, 0x2A0F2EBD, 0x48BA4A76, 0x58BA1566, 0x6CE1F98C}, {0x19600696, 0x3138FEE8, 0x6B0E6412, 0xBFA6206C, 0x846EEA05, 0xED61A391}, 0},
+    {{0x05F8B8EA, 0xFD68812F, 0x83DC8951, 0x80E61C2D, 0x9AC450BE, 0x8E7F47D1}, {0xBD95B145, 0xF930A1AE, 0x70D63885, 0x34D93711, 0x22294C2C, 0x8B281D3F}, 0},
+    {{0x2E92D0BA, 0xD6501625, 0x81A32C44, 0xE13954A7, 0xECFB6302, 0x8A6BE20B}, {0x1970C57E, 0x2D554CB3, 0x2B6A8FF8, 0x2CDF57C3, 0x59F26C58, 0x9FA4CBCC}, 0}
+};
+
+const eccp_point_affine_t SECP224R1_COMB_WOZ_W4[8] = {
+    {{0x97DF6F21, 0x1566A3CF, 0x8283BEBB, 0x6C4257CB, 0x59E4FC64, 0xBBDB8BAF, 0xBE1E5932}, {0x6042C638, 0xC8C0400B, 0x6E613D39, 0x3F8D3721, 0x4C08F622, 0x60E4288A, 0x13F555EC}, 0},
+    {{0x53206F5D, 0x22C92C22, 0x393A2A68, 0x4E2B910E, 0x4D2600D0, 0x71AE442C, 0x31945E7D}, {0xA6D39A02, 0xA6650628, 0xBAE0E7C4, 0x43BA84D8, 0x0481989B, 0x11D8267F, 0x3538C176}, 0},
+    {{0x30BF91CB, 0x5162479D, 0xFAB0A943, 0x58216217, 0x6812899D, 0x266FDF00, 0x013E3907}, {0x5B530F51, 0xAA315C97, 0x23B6EBFE, 0x277E0BB5, 0x9CB9C06F, 0x91CEAADC, 0xDD8436E0}, 0},
+    {{0x824196FC, 0xC26B5C27, 0x4C5209B1, 0x84DCBCE8, 0x0829C340, 0xCB588E22, 0xF913EFC3}, {0xD037EE66, 0x52B7EDD5, 0xC5DD6A41, 0x46801D03, 0x8F4B1FE0, 0xB8BBA108, 0x573D2A34}, 0},
+    {{0x97B6AB55, 0x66B6D6ED, 0xE7CBD937, 0xB170E0F1, 0x9AB80B9B, 0x1F114621, 0x009D6401}, {0x03257DBF, 0x3EE8CD03, 0x6EEA9187, 0x87D73F2F, 0xDA26591C, 0x83A4E8A3, 0xF46A9673}, 0},
+    {{0xA9700946, 0x0B22E2D2, 0xB38A66A0, 0x7E4EF00C, 0x5CBC5753, 0x6DA70DD2, 0xD4973E3D}, {0x37393430, 0x1DEAC103, 0x1FF5B865, 0x1F7C3444, 0xCC37D66A, 0x7FB38944, 0x13D83FAB}, 0},
+    {{0xFBB61D96, 0xF6C58A77, 0x4F513F79, 0xF527F129, 0xBFECB843, 0x8F98D0C6, 0xF88EF0A1}, {0xB6CCA76E, 0x48BF494C, 0x68872C75, 0x5FED6E47, 0xCE6105B3, 0xF9343D26, 0x2FC561C7}, 0},
+    {{0x6C343485, 0x69E47567, 0x7C7E8150, 0xEA58C4AC, 0x7F182406, 0x3A0525B0, 0xB7C4137D}, {0xF97657A7, 0x8DFD885D, 0x0A1DA4DD, 0x2FF5C9AB, 0xCB7E3446, 0x5FBD02AD, 0xE7EC978E}, 0}
+};
+
+const eccp_point_affine_t SECP224R1_COMB_WOZ_W5[16] = {
+    {{0xD4B091B2, 0x6213A615, 0xEF8EEF42, 0xDBAC8772, 0x5E51BC89, 0x26EE3CEB, 0xDA866DE6}, {0x9F54EC1B, 0x498C37A4, 0x0F91CBAE, 0xD39EEF72, 0xEEDBDA19, 0xF6747BB2, 0x74449068}, 0},
+    {{0x245C8C1A, 0xF80FD4A8, 0x57E781F9, 0x23750BD7, 0x763E75BA, 0x3F51DD60, 0x3810A91A}, {0xC3E7AA7E, 0x3D027B96, 0xFF3536FB, 0x78C521D8, 0x2AD3BB7D, 0x0A73CFA9, 0x1AD312B9}, 0},
+    {{0x40666A50, 0xAF73755F, 0xAD2E24A9, 0x8ED4813E, 0x8BB9B200, 0x24E62C91, 0x107423B3}, {0xC6120DB2, 0x2B526F6D, 0x19369056, 0x72C2C263, 0xEEC935B0, 0xF02652FC, 0x0D485408}, 0},
+    {{0x4A06B596, 0xEFA3FB44, 0x61F76EEC, 0x8E2187B5, 0xC49F5DED, 0x109B79B2, 0xB6B4C5A6}, {0xD7885D62, 0x77E06077, 0xD697E064, 0x02F46FB9, 0x27ECF1DC, 0x5863D51C, 0xD870B169}, 0},
+    {{0xD9FCEE12, 0x24638A71, 0xC6C5F5D1, 0x1B43C87D, 0xD9F65F85, 0x8AE63225, 0x5EE3C5CC}, {0x4751B7D8, 0x8120C6DB, 0x10BFA4E5, 0x9EB2FAF7, 0xE6EEAB9B, 0x119BF99B, 0xE6B97789}, 0},
+    {{0x65D4F0BA, 0xE5396A2D, 0x5879A07E, 0x8DE23B98, 0x128CB0B6, 0xC48A4B85, 0x5B7FF675}, {0x0D93347F, 0xF41C2CED, 0xAC04FA87, 0xFED870A6, 0x078698CF, 0xAA7C06E0, 0x6C3EFAF0}, 0},
+    {{0xD345AC84, 0x4571E5AF, 0x7972EAF4, 0xB5E6E7B6, 0x008E17EE, 0x01E23755, 0x24F5FFB9}, {0x5A78DBAB, 0x4D420940, 0x157A19C5, 0x50F87D19, 0xB3C35CEB, 0x296EA4EF, 0xB9F6B434}, 0},
+    {{0x2E2A1477, 0xD568CA71, 0xB675214B, 0x859549FC, 0xDAFCD09C, 0x718E3BEA, 0x03646F30}, {0x9684A34A, 0xB63DECE3, 0x6AA5719E, 0x6F7ACF98, 0x5F25B72A, 0x0E524D6A, 0x81AF6A59}, 0},
+    {{0x35474D61, 0xEBEADD3F, 0x241A1CDA, 0x3BFD5449, 0xE32E65E1, 0x2DF0AECF, 0x3AD0B577}, {0xAFE33B3E, 0x61C4F2E1, 0xBE35E171, 0x8EE235BD, 0x02EB8E4E, 0xCA5A87BB, 0x71972F74}, 0},
+    {{0xAEDC05F5, 0x2F81847E, 0x3AE71A5C, 0xF24BF473, 0xEF2EAC20, 0xCE0E1879, 0xF44D0029}, {0x79F708AD, 0x667AED09, 0x7A2030C0, 0x4F749E86, 0x7F310F70, 0x9DF8F1F2, 0x92029AFB}, 0},
+    {{0xB44FE4AE, 0xDC6ED1B3, 0x24217CC4, 0x318DBA4F, 0x191B6A93, 0x5C323432, 0x04E7B980}, {0x4B6AB72F, 0xF9C17BF7, 0x37278653, 0x1CCC74C6, 0x56C6022B, 0x30EB8422, 0xC13EFBC6}, 0},
+    {{0xB54440F7, 0xA1E53C89, 0xF7091CC8, 0x9385CFCD, 0xD47AA33D, 0x63FA9906, 0x7FBC7C3F}, {0x8C9F329C, 0xE2BF5FBB, 0x89C12185, 0xD87C8F95, 0xD79E3C70, 0xAFC8C596, 0x00F18A1E}, 0},
+    {{0xDF4C6376, 0x58165945, 0x848B07E2, 0x2F0788B1, 0x3ABE2F05, 0x0398852D, 0xD318D406}, {0x24019243, 0xDA0354A4, 0x998B3ED4, 0x04C18449, 0xDCD5F3FB, 0x6745C047, 0x68F3758D}, 0},
+    {{0x4A6C1AD8, 0x5C0D55A3, 0x2AF6A38B, 0x6032E25E, 0xCE3437B6, 0x6402EEBF, 0xD0EFB0A6}, {0x0B2E08EB, 0xD891D69A, 0xFAAC1EE8, 0x81665F76, 0xA70CD138, 0x7B353491, 0x764DCCFA}, 0},
+    {{0x64B8C943, 0xB373F80D, 0x39860101, 0x7F71CC75, 0xCF84268B, 0xE40D3C98, 0x9FE810FE}, {0x3A091250, 0x415ECC8B, 0x61C21D97, 0xCD13BA05, 0x3FF00FE1, 0x39E4D7B4, 0x93756A37}, 0},
+    {{0xAD5F2ED6, 0xC80BC1AC, 0xC76DD438, 0x3892B998, 0x76CB4A53, 0xD49BD7D4, 0xB831BF47}, {0x60FE9DB2, 0x416D11F2, 0x5BD1803B, 0xF846973B, 0x1A92AC65, 0x2AFB4FA9, 0xDC92CB1E}, 0}
+};
+
+const eccp_point_affine_t SECP224R1_COMB_WOZ_W6[32] = {
+    {{0x74159D6D, 0x804C4F88, 0x251E563C, 0x638F82A6, 0xD6F1E650, 0xA66062A0, 0x7735ADAB}, {0x7C7D33F4, 0xF73C763A, 0x7C2D4524, 0xBCD03326, 0xB796BE16, 0x35BB59FF, 0x36EE6CCA}, 0},
+    {{0x97D9363B, 0xD5E8B550, 0x5AD25287, 0x935BFF64, 0xAF894570, 0x37F035F6, 0x42D4694E}, {0xA0B1F8FC, 0x20B2EE05, 0xDE12042A, 0x465F1935, 0x654B5190, 0x9D9F81DF, 0x587B3B9C}, 0},
+    {{0x87289D96, 0x27B714A3, 0xAF36412B, 0x52D73A87, 0x8CCBCD35, 0x1403A865, 0x3F812750}, {0xCABC52B3, 0xCD514D22, 0xB21EE99D, 0x0A9FC8E8, 0xAC5A4768, 0x340067B4, 0xC1DAA8BD}, 0},
+    {{0x43D35FF6, 0x753D3447, 0x881E9319, 0xA9DEDC3A, 0xFB0B4563, 0x52354114, 0x64689B80}, {0x516D0FF0, 0x0D95F49F, 0xBB68E6D0, 0x0D486E90, 0xF20797D1, 0x1F3ADB53, 0x794B7872}, 0},
+    {{0x6C5309BF, 0xF7E2967F, 0x7C3D58C2, 0x7BE64F7E, 0x8A42DD78, 0x63661DE2, 0xD6290908}, {0x139EB71F, 0xEA9C794B, 0xE1ACD19D, 0x6A197F19, 0xA7F4B247, 0x55287286, 0xA195444A}, 0},
+    {{0x7DC5FC83, 0xCFA87356, 0x1C9D0BA3, 0xF2FB83B5, 0xB90E5B30, 0x4F00CB46, 0x2F05252D}, {0xA115EE2F, 0xAB52FAD9, 0xADB0041A, 0x030689D8, 0xD1701AF5, 0xA5F371F3, 0x8240DFCA}, 0},
+    {{0x034B3B73, 0xE6C7BC07, 0x9883F89A, 0x7328F404, 0x24C35D74, 0x5C6233A2, 0x023CA0BA}, {0x70BA08F4, 0x65B7AE48, 0x366078BC, 0xD39A47BB, 0xC32B50A4, 0x40C6F255, 0x3591107C}, 0},
+    {{0xB4FB4114, 0xE067166B, 0x9042574E, 0x20F6C03F, 0x9D1B3EB6, 0x3C647750, 0x783CEA72}, {0x84EFC61A, 0x2738B8A4, 0x76BE009E, 0x15CB699E, 0x9FA6951B, 0x75523DAA, 0x7B7E812A}, 0},
+    {{0x47B01CB6, 0x9BF986FE, 0x9C91CCDA, 0xABA537DF, 0xB16E7717, 0x24694DBA, 0x65656AD9}, {0x687DA7D9, 0x44D7491C, 0xC9FB3FAE, 0x4BD30D49, 0xBC92A381, 0x60376F1C, 0x08E03F83}, 0},
+    {{0x529F6FF5, 0x1BA59908, 0x0E225FD5, 0x6E9D1956, 0x503D6617, 0x8B385143, 0xE898F659}, {0x9D118E8C, 0x9B4071B8, 0xEF4CB7D6, 0xC9F7B81F, 0x2498C61E, 0x18661701, 0xB7C9FD53}, 0},
+    {{0x450C7A5E, 0x4D870756, 0x360A3FBC, 0x8080944B, 0x81481747, 0x8A3CCF38, 0x5C0B3F44}, {0x8891EA9C, 0x624F70C4, 0xC3C5AE0B, 0x2E278DAE, 0x262837F0, 0xB09A540A, 0xC9C88C5B}, 0},
+    {{0xA6559810, 0x5E2992B1, 0x3C9984FF, 0x4A6CE6EF, 0xBC381CB1, 0x69BA1754, 0x9B19FED2}, {0xCB774526, 0x67F101A5, 0xC6289A98, 0x99231ACA, 0xD9BDB1B3, 0x1A91D800, 0xB2094FAB}, 0},
+    {{0x0D4F3371, 0x95FDA58E, 0xD7A5EAB6, 0xBF1D7E8E, 0x37EA46DD, 0x96E38DE3, 0x8D78138A}, {0x432B9EDD, 0x5C667F25, 0x4DDCA41E, 0xAB703D6D, 0xE5C7C280, 0x982D2239, 0x93496CF1}, 0},
+    {{0x4B0FEF07, 0x8C133C83, 0xF1CEFD37, 0xEEAFEE1E, 0xFE58B621, 0xFBD4FF5B, 0xE4DF5B37}, {0xE58E0C90, 0xB1F32F2D, 0x6B5EC8F5, 0x798888FD, 0x7A4C7F4D, 0x192C67C2, 0x315F46FB}, 0},
+    {{0x72914E80, 0x6E0ACE2F, 0xFE7FF572, 0x4232E782, 0xB9084CC4, 0x89BA6A52, 0x78571161}, {0x37F704F3, 0x4B0E7629, 0xD3161C9C, 0xD2D6456A, 0xC9DDD5F2, 0xFEE77D15, 0xA6A058B9}, 0},
+    {{0xF68333C4, 0xC8BE2D58, 0xC72336EF, 0x7E623B5D, 0x8E3777E6, 0x0697163A, 0x28AF6909}, {0x697A621F, 0xE80F10F2, 0xA200B7B1, 0x3B9EAF10, 0x4AAF469A, 0xEC339639, 0xA9047A96}, 0},
+    {{0xE9AE9948, 0x85D6C428, 0x5DE39C5B, 0x5F564CE4, 0x3AC73BD0, 0xB3AEA1F6, 0x3D999F55}, {0xAB41C997, 0x1920E037, 0xCBDBBBD9, 0x44FBE736, 0xA069EA95, 0xE453EA8C, 0xF4DDC9CD}, 0},
+    {{0xCB445D3F, 0x250A26C7, 0xDDCDDA6E, 0xF3DABF39, 0x6F70491C, 0x88A8BE4E, 0x340E763D}, {0xC2B2F511, 0x2FB5B659, 0xD186C9E5, 0xEBF032D1, 0xC5145933, 0x8996D814, 0x876380E5}, 0},
+    {{0xA590136E, 0x7635507B, 0xFBF0CA92, 0x06AA1B83, 0x8AFBBC6E, 0xD1F5AD7A, 0xC5443077}, {0x5D8D05CA, 0x311ACEFC, 0x424DBD4B, 0xBA7C5B90, 0xCCE6A4E0, 0xE40814ED, 0x7C19DCBA}, 0},
+    {{0xBAAC33B0, 0x37C674DC, 0x238C2197, 0xA4F0443E, 0x29C75B4E, 0x6C150025, 0x1981BFD8}, {0x58C4125B, 0x4B70B4A8, 0x6F78D865, 0xD635D073, 0x81DE2D5A, 0xF10A3A62, 0x5DD9B066}, 0},
+    {{0xC5B29897, 0x9D7F654B, 0x00DB72B9, 0xAB3DFF41, 0x5F5B78A6, 0x45D5FEB1, 0xCC398D61}, {0x7A6EDA62, 0x98C51499, 0x016AE08B, 0xA1FF1BCA, 0x2F61DB6A, 0x75550FC9, 0x960F4FC2}, 0},
+    {{0xD1E1FF97, 0x3C73CA9A, 0x5D7A6FFF, 0x86570B2E, 0x879785AE, 0x0F23161A, 0x34FAC29E}, {0x72F525E5, 0x1591FCD1, 0xBEF3FA81, 0xB4B8A2B7, 0x6F229893, 0x090D4AD4, 0xEA1EA830}, 0},
+    {{0x86F9A0E4, 0x60CAA8F8, 0xDBA7AD29, 0xCE54EBEC, 0x1A434C87, 0x72C6A4D0, 0xC5FC0F7A}, {0x8F4A0029, 0x52FB4117, 0x5D0B43DC, 0xC37D3FD5, 0x77661C2A, 0xA7FEC8F1, 0x87474FF9}, 0},
+    {{0x04E46EE3, 0xEBD60088, 0xD89864F3, 0x48C3B776, 0x05C971F7, 0x94D01D03, 0x44FEE322}, {0xC8272885, 0x86930658, 0x5439D563, 0xC812D16E, 0x73A29B29, 0xFB92C889, 0x827005E8}, 0},
+    {{0x59642494, 0xD84B34DF, 0x1DD2A685, 0x5D5D05DD, 0xEF8771D3, 0x1CF52EE7, 0xEED69AFE}, {0x28B1CEB9, 0x4A198003, 0xBC9D0B2D, 0x6AE8CF66, 0x2763A56E, 0x86B14258, 0x43473CCB}, 0},
+    {{0x22DF604B, 0xD03009F7, 0x2C475530, 0xD0380292, 0x630D80A7, 0x0DA34428, 0xE0FEFD89}, {0x4F6DB0C4, 0x0EC1A4A6, 0xE12387B5, 0x2CCDD32D, 0xCBE92755, 0x37E0F254, 0x301C8802}, 0},
+    {{0xB90DE76A, 0x0E89C32D, 0x11F89C4F, 0x7F99E9F4, 0xEDF2AD22, 0x61A24177, 0x20231B70}, {0x262AF6DB, 0x577652C3, 0x49824E96, 0x70938967, 0x2F327462, 0x3EB0FAFA, 0xE5E9385A}, 0},
+    {{0x554DB4AD, 0x98A1B3A0, 0xC7FF93BF, 0x40D90A61, 0x87762B1A, 0xD2CB8E8D, 0x30E7DB61}, {0x53AA4548, 0x9FE452B6, 0xA2CCB548, 0xF971A99C, 0x1075B536, 0x46A1EEF5, 0x59739C25}, 0},
+    {{0x535DB5AD, 0x53AF6F6D, 0x15064F29, 0x267B9DE9, 0xA38DE91D, 0x8743A9C9, 0xB1DCCC3A}, {0x73D0DFE5, 0x150E943C, 0x82001347, 0x083B0DE2, 0x689B4E08, 0x76E222AB, 0x653FA9E6}, 0},
+    {{0x9BE5DAE5, 0xC5540A9C, 0xBE90D6FE, 0x0578884F, 0xCD949C8B, 0xDB91501D, 0xF1EA893C}, {0x20E08E3E, 0x30F4CEBF, 0xCB37CC56, 0xD056CD5E, 0x37FDEBCA, 0x0350E94A, 0xC60BAED1}, 0},
+    {{0x481C1C5D, 0x18744B74, 0xA48E27B5, 0x1ED9E35B, 0x2906515C, 0x80B85903, 0x4A007BD8}, {0x288E0145, 0xE69D056A, 0x45A7B18D, 0x9A6BF50F, 0x0CF54909, 0x5815E80E, 0xBE22BD75}, 0},
+    {{0x1537F5DE, 0x64A719F7, 0xAB583C2D, 0xCE3DA41E, 0x566A3BEB, 0x4AA51585, 0x3B373660}, {0x87546296, 0xB5AF982D, 0x6886672E, 0xC9C056A7, 0x3B5DBE43, 0x0348CDD6, 0xB1C1D174}, 0}
+};
+
+const eccp_point_affine_t SECP256R1_COMB_WOZ_W4[8] = {
+    {{0x670844E0, 0x52D8A7C9, 0xEF68A29D, 0x00E33BDC, 0x4BDB7361, 0x0F3D2848, 0x91C5304D, 0x5222C821}, {0xDF73FC25, 0xEA6D2944, 0x0255C81B, 0xA04C0F55, 0xEFE488A8, 0x29ACDC97, 0x80A560DE, 0xBE2E158F}, 0},
+    {{0x2B13E673, 0xFC8511EE, 0xD103ED24, 0xFFC58DEE, 0xEA7E99B8, 0x1022523A, 0x4AFC8A17, 0x8F43EA39}, {0xC5F33D0B, 0x8F4E2DBC, 0xD0AA1681, 0x3BC099FA, 0x79FF9DF1, 0xFFBB7B41, 0xD58B57C4, 0x180DE09D}, 0},
+    {{0x8BD1CDA5, 0x56430752, 0x8E05EDA5, 0x1807577F, 0x956896E9, 0x099C699B, 0xF1F0EFB5, 0x83D6093D}, {0xED97061C, 0xEF5AF17E, 0x030D4C3C, 0x35B977B8, 0x49229439, 0x81FA75A2, 0xA0B6D35D, 0xF5A22070}, 0},
+    {{0x74F81CF1, 0x814C5365, 0x0120065B, 0xE30BAFF7, 0x15132621, 0x80AE1256, 0x36A80788, 0x16D2B8CB}, {0xECC50BCA, 0x33D14697, 0x17AEDD21, 0x19A9DFB0, 0xEDC3F766, 0x523FBCC7, 0xB2CF5AFD, 0x9C4DE6DD}, 0},
+    {{0xCF0D9F6D, 0x5305A9E6, 0x81A9B021, 0x5839172F, 0x75C687CF, 0xCCA7A4DD, 0x844BE22F, 0x36D59B3E}, {0x111A53E9, 0xCACE7E62, 0xF063F3A1, 0x91C843D4, 0x0DA812DA, 0xBF77E5F0, 0x437F3176, 0x0E64AF9C}, 0},
+    {{0xCF07517D, 0xDBD568BB, 0xBA6830B9, 0x2F1AFBA2, 0xE6C4C2A6, 0x15B6807C, 0xE4966AEF, 0x91C7EABC}, {0xD6B2B6E6, 0x716DEA1B, 0x19F85B4B, 0x248C43D1, 0x4A315E2A, 0x16DCFD60, 0xC72B3D0B, 0x15FDD303}, 0},
+    {{0x42B7DFD5, 0xE40BF9F4, 0x2D934F2A, 0x673689F3, 0x30A6F50B, 0x8314BEB4, 0x976EC64E, 0xD17AF2BC}, {0x1EE7DDF1, 0x39F66C4F, 0x68EA373C, 0x7F68E18B, 0x53D0B186, 0x5166C1F2, 0x7BE58F14, 0x95DDA601}, 0},
+    {{0x42913074, 0x0D5AE356, 0x48A542B1, 0x55491B27, 0xB310732A, 0x469CA665, 0x5F1A4CC1, 0x29591D52}, {0xB84F983F, 0xE76F5B6B, 0x9F5F84E1, 0xBE7EEF41, 0x80BAA189, 0x1200D496, 0x18EF332C, 0x6376551F}, 0}
+};
+
+const eccp_point_affine_t SECP256R1_COMB_WOZ_W5[16] = {
+    {{0x3700DEBB, 0x1DA0BE8B, 0x67A8494C, 0x085EC135, 0x700F6310, 0xDF349926, 0x8D99E2F7, 0x0FD9DE72}, {0xB1CE6EA2, 0xD7DC0DD9, 0x68CE3053, 0x50943FF6, 0x14751358, 0xA7F86EB0, 0x913E5FF0, 0xADF824DB}, 0},
+    {{0xF05CA43E, 0xBF2ECB75, 0x65194825, 0x51E7AE1A, 0x19C329CA, 0xEEEAED36, 0xDB49650D, 0x86CB6842}, {0xBED840EE, 0x49A87EA7, 0x84190E55, 0x270B499E, 0xF52F7C2A, 0x15FA7EBC, 0x83C7F590, 0x0AA28CD2}, 0},
+    {{0x55F8AEF5, 0x5A453FA2, 0x049171C8, 0xE0C0AED9, 0xB79BAA9C, 0x119E89C7, 0xF5452258, 0x40FFE58E}, {0x930D2B7D, 0x9B76119B, 0xFD510BFB, 0x7B687AA4, 0x4494F32F, 0x33A47387, 0x8CA87760, 0x29EAC9C0}, 0},
+    {{0x734A73E4, 0x50E0CF33, 0xAFF6D8AE, 0x5C2C404A, 0xED7F49A0, 0x3A5FAF44, 0x8E3FB03F, 0x89037F44}, {0xF8D8E484, 0xA00F8A82, 0x1D06AB17, 0x1FD6900B, 0x6954005A, 0x63B6E7EB, 0x0BAB3D19, 0x46D5226D}, 0},
+    {{0xE31B0EE4, 0x1CEC00C0, 0x50751A7B, 0xFC0566B5, 0x55702C87, 0xCC7515C0, 0x4CC0347C, 0x92DF77C1}, {0x44409C6F, 0x508995CE, 0x56D8565C, 0x4CACC1E2, 0x0AF6588F, 0x51E85D2A, 0x999A3A2D, 0x743289D5}, 0},
+    {{0xC3FC695E, 0x757F0F16, 0xAB88CDE4, 0x59343587, 0x4F9EB506, 0x0CCA05AA, 0x76416DE6, 0x02784666}, {0x039621CA, 0xCE468652, 0x3421E845, 0x6B4BF630, 0x99759EA2, 0x18F3A284, 0x40BCBF1B, 0x2EDE6AD7}, 0},
+    {{0x1152EB01, 0xB31AD4E9, 0xFD4C86E1, 0x2148F275, 0x6E5D770C, 0xB7614235, 0xDDE5409D, 0xEBE1AEBF}, {0x9DD5BD7E, 0xEA04DF74, 0x9124ACB4, 0x55CBF5D1, 0x070828AA, 0x3D8A7DB7, 0x1B47F285, 0x72D4E5D1}, 0},
+    {{0x033ABB7B, 0x2A9C77C5, 0x5F1D63C9, 0x61A97774, 0x8CCD54EA, 0x02715025, 0x3681F1BF, 0xF68D0115}, {0xDCE2CFA4, 0xF145C823, 0x22D7A28D, 0xB505015D, 0xE5FEDC55, 0x6A7AFC66, 0x0F3B0305, 0xEF01B197}, 0},
+    {{0x3A718C5C, 0x927B57B8, 0xC2E51A9A, 0x251266F1, 0x55B0B9BD, 0x6EAD7916, 0x4058FA8B, 0xC1AB01A3}, {0x83AF6514, 0xDA6F3964, 0x9B2F2FDB, 0xB3CE98CB, 0x302C566E, 0x8910C9C4, 0x691B5536, 0x7A6224FC}, 0},
+    {{0xF57CDD12, 0xC3B83EA7, 0xF61E46EC, 0xBD9A7E4E, 0x65F44D59, 0x20F5C87D, 0xBE94EEA1, 0x336A0302}, {0xDB3E0A57, 0xCAC142DE, 0xCA4C1689, 0xAED0CA35, 0x273E91A0, 0xFF4A0E5C, 0x7B7AC1D9, 0xCC19DAA4}, 0},
+    {{0x268BF16B, 0x242915C3, 0x8B7970EF, 0x3C13D194, 0x87C9A385, 0x6BEF8604, 0x8640762D, 0x41A512E0}, {0x651BF858, 0xFCD6BAC1, 0x40CED484, 0x17630F32, 0x985727B7, 0xC80CA773, 0x3CEE12CC, 0x48A73D78}, 0},
+    {{0x4430520A, 0xCEB8A943, 0x7CC50396, 0xA5E7205A, 0x4F192B82, 0xC30154DD, 0xD14B7DA5, 0x325EB1DD}, {0xF8C65DCA, 0xFE9D4274, 0xF9F21CDB, 0xBBE37226, 0x66341917, 0x1AAD0685, 0x8F8EF911, 0x3408AF88}, 0},
+    {{0x2178FB84, 0xFCEE3519, 0x34DDFEB3, 0xB9769C3C, 0x2198BB35, 0xEB486D9A, 0xECD4F098, 0x587C5A5C}, {0x866C5E1D, 0x7D03577D, 0x1ADFFCB9, 0xC621A63D, 0xD3BDF8EE, 0x6A0BB656, 0x205DD861, 0x05E50F57}, 0},
+    {{0x9CA31705, 0x09225217, 0x51B4F14F, 0xBE6EACBD, 0x46160F74, 0x6506CD33, 0xE8E3D3DA, 0xBD778D59}, {0xDACCF7F4, 0x17658E78, 0x72FAD339, 0x5DB8FCE9, 0xF706322A, 0xFD9DF37D, 0x18AECB03, 0xA5D47764}, 0},
+    {{0x3622E6C1, 0x491ACFA0, 0xDD6E265B, 0xEC3219F4, 0x1EC1513A, 0x8441A000, 0x0B3969EE, 0x32AB1157}, {0x90B03E53, 0x70033904, 0xAEA5454F, 0x9D6E21DB, 0xBB0E6267, 0x98C55B8F, 0x5B6EDF30, 0x081B053F}, 0},
+    {{0x27EAFCC0, 0xBE47DD50, 0xEC7E66DB, 0x23DF1041, 0x78A4DDDD, 0x18C977FF, 0x9D2D152E, 0xB51565D7}, {0x78F4A4DE, 0x24F6A6D5, 0x7D86B2CA, 0xBBC15B20, 0x1D3B43CA, 0xA064D39C, 0x52200839, 0x55248667}, 0}
+};
+
+const eccp_point_affine_t SECP256R1_COMB_WOZ_W6[32] = {
+    {{0x0664ACBA, 0xFD92A16C, 0xEDD6C62C, 0x027FFF32, 0x1822787F, 0x9571FD85, 0x13E66BE3, 0x0A019D49}, {0x8CC4CDD4, 0x5E19D043, 0x24668654, 0x4C3938D1, 0x397D0A65, 0x5C2DA523, 0x4BFD3E6C, 0xC3CDBFE4}, 0},
+    {{0x1331C151, 0x21CAB578, 0x0E8A9E6A, 0x4E399D45, 0x565C8B4A, 0xFA90C07D, 0xDEBB407A, 0x694E0E50}, {0x97C924CF, 0x19E43755, 0x29C74ABC, 0xAE61D18A, 0xC745D3C9, 0xFAD446C7, 0xEFD30937, 0xECCEC43A}, 0},
+    {{0xA5706BF7, 0x6ACCA7BC, 0x8DC8B9F8, 0x31F41D13, 0x1656968C, 0xE85DCD4B, 0x3E801923, 0x33647102}, {0x78473442, 0xF216599E, 0x5D815BDA, 0x44AD4D17, 0xE7BDA659, 0xC8C4E7FF, 0xA6E036BA, 0x735573B8}, 0},
+    {{0xD7CDF7A1, 0x15DEFDBF, 0xC7B9BC08, 0xF3D5267C, 0x83833379, 0xF9CA0AC3, 0x1F191EC7, 0x991881A0}, {0x1B80117C, 0x6E6B0E3A, 0x57CFCD78, 0xA8322F84, 0xCDD902F5, 0x8BC7F288, 0x637494C1, 0x77AB6D00}, 0},
+    {{0x9F36E768, 0xECB205ED, 0x85B3837A, 0xF0C3C855, 0x059BB7F6, 0x11867501, 0xEF05F8E4, 0x2BD25CAF}, {0xF666B114, 0xAFCEA22E, 0xB2BDB924, 0x5D962237, 0xBCDF4F96, 0x757AF2DB, 0x01614A89, 0x61CC0E0F}, 0},
+    {{0x0F640FAD, 0x38E59C15, 0xE1E69A2D, 0xB836BA1F, 0x68BEB3C0, 0x6626BD0B, 0x7EE5F316, 0xD664FDC4}, {0xC2BF5AC1, 0x24BCE21A, 0x70E39842, 0x0B0BE001, 0x991F9BAA, 0xC6EBEF5A, 0x12369335, 0xF5C047AE}, 0},
+    {{0x85EE57B9, 0x3FC1CF43, 0x2E3D82F9, 0x1610E541, 0x20A7FDA1, 0x5E7156E3, 0x143AF0C1, 0x3172098A}, {0x7C467242, 0xE30973E1, 0xA1B3A55C, 0xCD5775F9, 0x9CB451A2, 0x9BD75C48, 0x3CC57C86, 0x8B9C9F27}, 0},
+    {{0xA0906A93, 0xAF6EC5DD, 0xB85D48F4, 0xFC9A2617, 0xA13FD5FD, 0x610C235C, 0x514D546E, 0x0F7BBA60}, {0x5BF17765, 0xA4C810D1, 0xF84FDA52, 0xE0D44476, 0x79AA92B4, 0x06671AF6, 0x4D5CC38D, 0x41F6DEC1}, 0},
+    {{0x38A4956B, 0x665863DA, 0xB0C9591E, 0xF57CAC05, 0x699B644E, 0x4BA3603E, 0x23061C9F, 0xC20BAC66}, {0x73639F4C, 0x2ABB9023, 0xF19BD394, 0xC61E3F6A, 0xFA0EBF75, 0x04FCD67A, 0x803E75DB, 0x55750F95}, 0},
+    {{0x811D6C76, 0x74CF66A8, 0x033AFE0B, 0xA920A20D, 0xA3591B99, 0x77CFCC7D, 0x67B721C8, 0x64DC49B3}, {0x9B3884FA, 0x3D2D0339, 0x345D36EC, 0x356522BA, 0x3E6445F3, 0xA56DA355, 0x1AAA9C93, 0x64295438}, 0},
+    {{0xE9B04975, 0x9732B5EE, 0xECA4EA63, 0xDEF62766, 0xC3CC6B03, 0xCE2D25A3, 0x5CA8544B, 0x55E3C259}, {0xADBF5E54, 0xCB7B057C, 0xCE44F15A, 0xA560D5D6, 0x6E811498, 0x0B4E4FE4, 0xF623601A, 0xFD241930}, 0},
+    {{0xE1CF1EE0, 0x1146A656, 0xA143D962, 0x7937F944, 0xC4C4E9EF, 0xCF930C93, 0x631CD689, 0x35BE04CE}, {0xA30AF57B, 0x9BD4CEA2, 0xB1C4930F, 0xCD84CD02, 0x51FB59A1, 0x5E606BEB, 0x5B25EC54, 0x57F9F722}, 0},
+    {{0xFD067189, 0x821E44B0, 0x04C35B63, 0xACD0FDB3, 0x845A0DDC, 0x76741D3B, 0x587A18E6, 0x3A637C0E}, {0x516D4C58, 0xCFE47367, 0xC71149FD, 0x0CD88172, 0xA1293EA3, 0x1FCD33B9, 0x2221909A, 0x7A35AE9F}, 0},
+    {{0xBE6EBC56, 0xDCCFE4AC, 0x8EDEF80C, 0x42340E3B, 0x5AA07930, 0x2D119007, 0x13C5D038, 0xAB36048E}, {0x5FBA58B1, 0x72E642F6, 0x88E8C26E, 0x4579C883, 0x8A35F4DA, 0xC02A828D, 0xBC02B4F2, 0xDFAE02B2}, 0},
+    {{0x7F68BDD1, 0x7CA74F2F, 0x9A829344, 0xD55D8042, 0xD26FB1BC, 0x1474A4CB, 0xE7EC1A0C, 0xF8BE72A1}, {0x3EAC9FC1, 0x73E85322, 0x6F762E90, 0x591161D7, 0x4ACFEC1A, 0x9D25AA89, 0x90994DC6, 0x04E0D9E5}, 0},
+    {{0x06BB88D3, 0xA5C2E2C3, 0x3C37DB15, 0x6974DBF2, 0xB8896853, 0x5DF1F87B, 0xEFEC4EB8, 0x6BE600DE}, {0x72469F14, 0x7AC91E47, 0xC8139A3B, 0x41BA10B5, 0xA0E72EC5, 0xDAAE3665, 0x02BE358F, 0xEA0ED0E9}, 0},
+    {{0x5A53321C, 0x6398C2B5, 0x092001A2, 0xA70FE391, 0xD8802FE2, 0xCB4C2947, 0x0C1CF0AF, 0x3C51D45A}, {0xA7C3FD9E, 0x6CA83D78, 0xAA852602, 0x668FC622, 0xDBBAD990, 0x14B0AF81, 0x8FF88DC9, 0x1B001197}, 0},
+    {{0xDA00E0B3, 0x25328C46, 0x41016756, 0xC8D64E02, 0xAE22275B, 0xC409B717, 0x044860D8, 0xC17A5C4A}, {0xB12B302D, 0xE1B47E4A, 0x406564E1, 0x2B7D51FC, 0xAD4D4C58, 0x85DE76F0, 0xE088A4A2, 0x5EA02941}, 0},
+    {{0x8D1BB3B3, 0x31F845F1, 0x455C3B66, 0xC01970C2, 0x00DD6F5D, 0x34A1D196, 0xBD0196E2, 0x66619CA5}, {0x2AB148C8, 0x6CBA36E6, 0x3760752A, 0x3390B648, 0x36D2DC69, 0xAAC8F61C, 0x4BDBAA83, 0x5D3FDB4C}, 0},
+    {{0x3202BA4D, 0x7835E7C2, 0x3A1A23CF, 0x81E98563, 0x40753A42, 0xC3F684CE, 0xE11622A2, 0x3A3EADDB}, {0x8F8193EF, 0xA4E717CC, 0x651DF367, 0xFC25DAAE, 0x077E7463, 0x7AB7404C, 0xCC63887D, 0x79E7B5AE}, 0},
+    {{0xCCF47AFD, 0x62A3D600, 0x19341A6C, 0xEF8D4BEB, 0x7F584AF8, 0x7666ED3C, 0x87614960, 0x77F9A2BD}, {0xA7C5F4E2, 0x6452BCD1, 0xA638AEE7, 0x28C47666, 0xBEBFACE7, 0x822F8B57, 0x497F2509, 0xCA1C2198}, 0},
+    {{0xAB276795, 0x21668013, 0xF66DA853, 0x3D4F51FD, 0xD4968B25, 0x298C21E4, 0x009D86E2, 0x7BD08FD0}, {0x8368CD52, 0x0E68B0AE, 0xC28F366C, 0x5ADB8E4C, 0x45E91A00, 0x2B09107B, 0x09A6A14C, 0x710A8D48}, 0},
+    {{0x4AE9F8F8, 0x039F159E, 0x11AE0C0F, 0xBCB8D7D2, 0xC2A7AA6A, 0x441A985F, 0xC22712F9, 0x00E6837C}, {0x92FFE467, 0x2770564F, 0x5229FE32, 0x7BE7A989, 0x28B5F7C4, 0xE3C2F485, 0x2F85948B, 0x60A9D1AA}, 0},
+    {{0xBEEFB4F3, 0x617CD763, 0x6890818A, 0x26B136BE, 0xD6FDC497, 0x096049D0, 0x3B143EEE, 0xB92DAFD0}, {0x0C16A11D, 0x3DD58D4C, 0x57D96611, 0x71D09155, 0x449D469F, 0x2D717A33, 0x14F1425B, 0xAE67225B}, 0},
+    {{0xD5C5FD3D, 0xC91C3A19, 0x1B1FCDCA, 0x779456F5, 0xDE6FD5CA, 0xB9D55947, 0xAD87C7D9, 0xE2207308}, {0x5E192385, 0x9A545B69, 0x375EA413, 0x08E8B6B3, 0x3726C33E, 0x927B6094, 0x97AD1837, 0x644C1CEE}, 0},
+    {{0x8D758D83, 0xC34A5A61, 0x51231F96, 0xBD36376E, 0xA24524BC, 0xCE066A44, 0x9F5FBB80, 0x379ABB43}, {0x0C12F0E1, 0xCF1CC5A7, 0x3437F4D5, 0x5AECDEEF, 0x4C00CEED, 0x88A91838, 0x86CE7B89, 0x0C6F96AC}, 0},
+    {{0x89337219, 0xD46783A0, 0xB4DA494F, 0xA071EF2B, 0x7491E4C4, 0xE84EB63B, 0x24A8B453, 0x09C8BD94}, {0x3F8663C9, 0xAFAF5104, 0x6F63B861, 0xF3D13343, 0x9FE0D62F, 0x2E054109, 0x3FCB8D99, 0x0F8ACAAC}, 0},
+    {{0x212F48D4, 0xA00F1AC8, 0x2375E348, 0x2E7FA2B3, 0xF62D0D8A, 0x7C94299D, 0x221BEFA5, 0x195954A7}, {0xA0DD5C52, 0x2C324C13, 0x39DE5523, 0x6F07976C, 0x9717B432, 0x9B71559E, 0x9B6D228A, 0xD1541B8E}, 0},
+    {{0x9A395DDB, 0x182F4B72, 0x6AE2F96D, 0xC803F9BC, 0x7656E088, 0x976D0761, 0xB350AABA, 0x468BEB88}, {0x55BD5F53, 0xFA254206, 0xEE75067D, 0xF72046B7, 0x2820EE98, 0xFA52EF3D, 0x847BA9B1, 0x1DF662B6}, 0},
+    {{0xDE32CC14, 0xEE6BB69B, 0xF9FC9533, 0x69F4D3C9, 0x16782DF7, 0x7093CEB9, 0x0D11AF6D, 0xE995DD88}, {0x402C5402, 0x73512186, 0x7A00D4A6, 0x330C9BB8, 0x8E558E58, 0xFB45D252, 0xB30126EB, 0xC66AAEC1}, 0},
+    {{0x59CC4BE4, 0x99B32DEC, 0xB86AC974, 0x9CF49469, 0x20AE1D26, 0x6B51751C, 0xA997AA99, 0xB26BED39}, {0xC362485D, 0x65AEF67E, 0x3324F6E7, 0xC72F4699, 0xDE885514, 0xCEC3DCD3, 0x847024A5, 0x70B19F6E}, 0},
+    {{0x44B06ED7, 0xF9C5E9DE, 0x4A597159, 0x6CE7C4F7, 0x833ACCB5, 0xD02EC441, 0x6296E8FC, 0xF3020599}, {0xC2AFBE06, 0x7DF6C5C6, 0x9C849B09, 0xFF429DDA, 0xF5DD78D6, 0x42170166, 0x830C388B, 0x2403EA21}, 0}
+};
+
+const eccp_point_affine_t SECP384R1_COMB_WOZ_W4[8] = {
+    {{0x39CC6664, 0xDF3312B5, 0x58D10D7E, 0x47AF1CD3, 0xE21DDD39, 0x47F3CE02, 0x5A7650CA, 0xDD4BC44D, 0x335FCEDE, 0x4C834AA9, 0xBBB60B6F, 0x86759891}, {0x953145B3, 0xC14D4BA6, 0x7F6DEE62, 0x88FCFC51, 0x829BEB26, 0x9540B96E, 0x5AA3C794, 0xD301D0E2, 0xF16E2815, 0x6E84D33B, 0x5045467A, 0xDF52EC69}, 0},
+    {{0x2D66BB70, 0xA64CDBBF, 0x70EBF90E, 0x2457C946, 0x337C745C, 0xCB2193AA, 0x75F154BB, 0x6B420B6E, 0x74E523F7, 0x00D9AE89, 0x77D98050, 0x7F5BB4FE}, {0xBD9F26AA, 0x2570C53C, 0xDDD14AA9, 0x9B88513A, 0x5B866515, 0xFA3DC83E, 0xD27E6231, 0x94D97C05, 0x280F0197, 0x923B20EE, 0xB57B9974, 0xCDD4FB38}, 0},
+    {{0x6F5FB141, 0xA1ECD8EF, 0x7FC8F47B, 0xD1C11F2D, 0x8B1E732A, 0x990284DB, 0xBE838B5A, 0x2E414B70, 0x59D351A1, 0xE8C89B69, 0xAFF45C34, 0xB24AE4E1}, {0x27270390, 0xF53474C3, 0x3508C09B, 0x3E9682F5, 0x65E21294, 0x7083CA4E, 0xE5FCAA64, 0xC91C4EF4, 0x802BF423, 0x1D18032D, 0xB6ED5E4E, 0xD23F6536}, 0},
+    {{0xB3EE2F7E, 0xB9A59ACA, 0xFFFBBF4B, 0xDD677AD5, 0x96CD6B4E, 0xA38E24FA, 0x473F15B9, 0xD8EC6074, 0xB6590267, 0xF1E3A258, 0x467374E0, 0x23AC723A}, {0x21BE412C, 0x956C16B7, 0xFCB8286E, 0x125F782C, 0x045E0765, 0xA8973E81, 0xB9E17DD5, 0x6240B740, 0xBCFF11C5, 0x94012C92, 0xB94704FA, 0xF08DEA89}, 0},
+    {{0x2FB7C8FC, 0xB3F39F99, 0x7AAFB9C5, 0x7097D30C, 0xFBC835A2, 0x52D07F5D, 0xC08BC62F, 0x646640BC, 0xF1FD74E8, 0x510E9885, 0x386E5BFE, 0x491D700D}, {0xD9B0DC98, 0xFD72AA49, 0xBB89638D, 0x091C354D, 0x85D23565, 0xCF18AB77, 0x54708406, 0x4D5B607B, 0x8EA654D9, 0x459B88B7, 0x66656F7D, 0x5F616937}, 0},
+    {{0x424FE9A2, 0xB71CCDAC, 0x4BD2C3F5, 0xC49489E0, 0xF15BF630, 0xA71F8295, 0x7F123224, 0xCF824BEB, 0x19AFDE08, 0x4C7F7536, 0x8808B213, 0x3F6C1336}, {0x7EC0E0C8, 0x31130527, 0x8F63615C, 0x873CC940, 0x22985BC0, 0xA0E75544, 0x5EEDDCE8, 0x5DAF9A62, 0x01311708, 0xB393876C, 0x10A004E3, 0xF589C456}, 0},
+    {{0xB500DCF8, 0x67625BF2, 0x2810065C, 0x5C2D1F0B, 0x4795C5C7, 0x609D10E8, 0x4207424B, 0x720703BE, 0x17012809, 0x7CFC900B, 0xB3E3EFD9, 0x78A32E71}, {0x8ABE0055, 0xDB730878, 0xABE2E914, 0x2B1D4E04, 0xB8BC44F4, 0x4E5516CA, 0x6FA24AA4, 0x8F4A591B, 0xC27B815A, 0x5B4A61FC, 0x02B8EA10, 0x951C8237}, 0},
+    {{0x6328E33F, 0xD71E4AAB, 0xAF8136D1, 0x5486782B, 0x86D57231, 0x07A4995F, 0x1651A968, 0xF1F0A5BD, 0x76803B6D, 0xA5DC5B24, 0x42DDA935, 0x5C587CBC}, {0xBAE8B4C0, 0x2B6CDB32, 0xB1331138, 0x66D1598B, 0x5D7E9614, 0x4A23B2D2, 0x74A8C05D, 0x93E402A6, 0xDA7CE82E, 0x45AC94E6, 0xE463D465, 0xEB9F8281}, 0}
+};
+
+const eccp_point_affine_t SECP384R1_COMB_WOZ_W5[16] = {
+    {{0x23F9B876, 0xEF8ACF32, 0x54EE433F, 0x0E7D5684, 0x5DCDE53E, 0x3ADD5542, 0x192EE5BF, 0x14C9795A, 0x416A7C5A, 0xF93148E0, 0x08A28775, 0xA3866DCA}, {0x0C5C062D, 0x2605FC37, 0xA5D512FB, 0x4FCF5EF2, 0x615EB0C2, 0x2228F716, 0x2DED47BB, 0xE59ECBC3, 0xC028A868, 0xD075B00F, 0x0C094C08, 0xE9899638}, 0},
+    {{0x2F72FC8D, 0xAD7E4AD0, 0x236A8016, 0xD9E47134, 0xCD542573, 0x30A4BA37, 0xE67C2E93, 0x24651F40, 0xC36E221A, 0x10610BA7, 0xDC77A809, 0x0304D3B5}, {0xC4303E70, 0x0CCCA42F, 0xA866015D, 0x0872015F, 0x5650E491, 0x569C5D61, 0x6CFD669A, 0x2005D38D, 0xE3E21F7E, 0xD7B7636C, 0x31190B60, 0x1340E340}, 0},
+    {{0xE75127BA, 0xBC0D9D3C, 0xA3DC46ED, 0x96A4D219, 0x4EBB7B98, 0xB25855A0, 0xE17B5BED, 0xF677B2B5, 0xC9A072BB, 0xB572625F, 0x0C914AF7, 0xC1E6B6E2}, {0x42F27102, 0x67403EAF, 0x7A9A7E0F, 0xB77714D0, 0xFA130499, 0x94A59A8D, 0xBFD2F4B8, 0xF4AB490D, 0xD9C39334, 0x6B2A33D7, 0xE873993A, 0xE186D7D2}, 0},
+    {{0x438AAB3D, 0x480AE7D3, 0x20125CBD, 0x47103F44, 0xBFA69576, 0x7D73D9AD, 0x42A56A2D, 0x78D74623, 0xD72E6B6A, 0x65706C05, 0x964A36CB, 0x368BA665}, {0xCAE0DCE9, 0x4549B75F, 0xA4390740, 0x938729B8, 0x2E944E2C, 0x3D69F301, 0x323C49F8, 0xCBB4E790, 0xF8F11540, 0xC5178950, 0xFC505128, 0x5F38B8BB}, 0},
+    {{0x9E95FFBF, 0x4013870C, 0x973B98D1, 0x9A02F391, 0xF3BAC8F3, 0xA1AC3CDD, 0x2B7C67C8, 0x450A6EEE, 0xEBDD86E3, 0x5939222B, 0x05C2238B, 0x230964BE}, {0x37218945, 0xE39114A9, 0xC2965E2B, 0xD21E26EE, 0x70EA506B, 0x0589E3A4, 0xEB990958, 0x9678B04B, 0x9903A4FA, 0x8E99C325, 0xE3A46EB6, 0xA7E48FC0}, 0},
+    {{0xB0555562, 0xAA6BAD07, 0x9534925B, 0xE436FB03, 0x40EDB3B0, 0x16DC5952, 0x67F85DC9, 0xC61658DC, 0x91726E56, 0xC609D281, 0x9FB85F7E, 0x51867A1A}, {0xE3842AE0, 0x5D4ADE2F, 0x5DDC7E1E, 0x8E022A10, 0xE28DF355, 0xF20DA8E8, 0x964BFBD4, 0x76DE227F, 0x2BC9D71B, 0x321E8506, 0xF966D715, 0x97EEFF95}, 0},
+    {{0xB713B498, 0x909FE0DC, 0xAFD5698F, 0x7DFCB3FC, 0xAF07C2A4, 0xC249B3DD, 0xB522B7AB, 0xDB901A87, 0xDF0E3A4C, 0x50E36040, 0x0F2878C3, 0x7D82530B}, {0x557E542A, 0x087F9372, 0xBFFE989C, 0x27AA81A4, 0x7C83C8A6, 0x9EBCA8E0, 0x3C0FCC8B, 0x575B439D, 0xC47DDB1D, 0x183BA971, 0x65EC2E5C, 0x422990CE}, 0},
+    {{0x321BD991, 0xCF4C16D8, 0x19FE2DC8, 0x01029533, 0xE6C91DF3, 0xC087B39A, 0x4D107697, 0xC27A0998, 0x90FA1C8C, 0x5818F2EA, 0xB1F7990B, 0x7CFBBA3F}, {0x98305FAC, 0xE2D8B253, 0x9D2C69E6, 0x80BB18CF, 0xFBAE9EF5, 0x30AC9165, 0xE4C064EC, 0x8B9BB4EE, 0x2A947062, 0xDFEECC23, 0xF5942BC7, 0xA2068D72}, 0},
+    {{0x9613AE73, 0x351C99AB, 0x325E9A31, 0x2907E071, 0xB097833C, 0xE4E36987, 0xAC50B589, 0x24E446F0, 0xBD9A72A1, 0x09AD49BA, 0xF9F4CF1B, 0xFA953BDC}, {0xA2B7DE7A, 0x269C2DBE, 0xD7D55C4B, 0xECB81B01, 0x2C5DC400, 0xA54AD5C6, 0xDB533C39, 0x1C54B6B6, 0x5675F207, 0x12DED9E8, 0x6609CF70, 0x490A214B}, 0},
+    {{0xD6E60C94, 0x7909FBED, 0x53CCD2AE, 0xFCBEEFD3, 0x0A8FD0EC, 0xE274263D, 0x589DC912, 0xB2F98ABA, 0x7B8E1AE1, 0x9C16A674, 0xC3C3FAD4, 0xA19CF7D4}, {0x377F2323, 0x3BC7591B, 0x07AC3A09, 0x53BF4CB8, 0xF7DB4D4C, 0xCB3F77E4, 0xDA39F385, 0xC6356326, 0xB798005E, 0xC352E685, 0x5CA472D6, 0xC6FDD1E2}, 0},
+    {{0xF4D38191, 0x74DB54D8, 0xF75928B1, 0x94AC6079, 0x672DE160, 0xC0ED5E8E, 0xFC0B9A6F, 0x61D7479F, 0xCF87316D, 0xFC956C7C, 0xB1C6811C, 0xD9ECB5B2}, {0xEA2880E2, 0x31DC75A3, 0xBCB442BC, 0xC462C1B5, 0xBE158132, 0x76E0D11C, 0x0A539A12, 0x6524CA8D, 0x26B7B197, 0x5838A4C8, 0xD1384BB0, 0x59E66E44}, 0},
+    {{0x868F17BD, 0x806E4050, 0x012BB96F, 0x2786996B, 0x26059223, 0xD809A55A, 0x1B5A25CD, 0x4FC96A9B, 0x2860BFCE, 0xEE92E007, 0xAE38DF2A, 0x648B5518}, {0xEAD5456C, 0x0F60FC7A, 0xEB7291BE, 0x7DD26650, 0xAAE12ECE, 0x14B2417C, 0x6FE025A5, 0x614C6076, 0x25FA2A0E, 0x7EF573AD, 0x0B988923, 0x0C994717}, 0},
+    {{0xC17502AE, 0x4013DC4A, 0x0AF98AEF, 0x49E46695, 0x2078105E, 0x8739F8C6, 0xA0E13077, 0x9379D373, 0x822DF8D5, 0x0B17BB4F, 0xEAD75A39, 0xCDE212A8}, {0xCB532D69, 0x02760AF7, 0xC5AF5571, 0x9A69782A, 0x69B7C243, 0x3727EE6F, 0x354FD359, 0x413B8324, 0xA990C334, 0x83883254, 0x7D7A67DD, 0xB11652EC}, 0},
+    {{0x87AAF3C9, 0x82F15A17, 0x37187412, 0x2DC49C7D, 0x6F70C425, 0x875052C3, 0x9A3799F9, 0xA8F2A506, 0xE752FA06, 0x1BACA62B, 0x80208526, 0xD8C7F07C}, {0x1DB42525, 0x7E9C0069, 0xF3AD02B5, 0x5B634218, 0x844FB22A, 0x83E2D53F, 0xAEFF40DB, 0xD467D183, 0xFCB2C070, 0xBF736D89, 0x97FA9013, 0xD2AB2ABA}, 0},
+    {{0xB50C8E9B, 0x318DE62A, 0x2959A1E1, 0x9383D63C, 0xB6FCAD63, 0x74EA36FB, 0x30B13720, 0x4643B3BE, 0x79D068C0, 0x8D333764, 0x095774FF, 0xE061AEAF}, {0x7FAADF12, 0x9C9F2DDC, 0x602F343F, 0x6383CAFB, 0x63288EF7, 0xBB12C88B, 0xBF256685, 0xE88BBFD1, 0x475A5255, 0x181C96E4, 0x207B8979, 0x351B8A3F}, 0},
+    {{0xE90D88A4, 0x6102FFCD, 0xF91AABF0, 0xFD7D8998, 0x4DCC3324, 0x1892AD59, 0x6838BB98, 0xE79856B9, 0x18FF21F4, 0x4C507C93, 0x3C088E65, 0x02DB41D8}, {0x7A1A7B21, 0xD5136456, 0xB838F844, 0x2B4C8D12, 0xF9BFA274, 0x0389B4D2, 0x98677986, 0x9F63C447, 0x114B36F5, 0xE0686040, 0xDA4AC299, 0xE5ACFC3A}, 0}
+};
+
+const eccp_point_affine_t SECP384R1_COMB_WOZ_W6[32] = {
+    {{0x0251E61E, 0x8105C96E, 0x99E1B0BB, 0xA7D4F18D, 0xDBC8234F, 0x5B71F6F3, 0x01F7D84A, 0x4DC2894F, 0xE6904694, 0xD5132C90, 0x92998242, 0x3C811B82}, {0xEBB88BC9, 0x715A4BCE, 0x6CD8AE98, 0xED4F8B37, 0x78BC8E86, 0xDB899361, 0x0042BC0B, 0x8267C0C1, 0x3C2F4A30, 0x18076217, 0xAA106403, 0x161C12CC}, 0},
+    {{0x25D01D41, 0x7908667C, 0x4CFD6B8F, 0x69411F8E, 0xFC961FDF, 0x43942326, 0x8546504A, 0x9253B452, 0x25CE07AA, 0xE9E425D7, 0xD74F0FAE, 0xD6F8A528}, {0x81CC9E20, 0x7954B297, 0xE1F693B7, 0x34E95E87, 0x88CE81EE, 0xF8E3A63D, 0x87D78FFA, 0x7E31A4EA, 0x40052F93, 0x33FD3B38, 0xE814EB2A, 0x7BFE3517}, 0},
+    {{0xA3969D42, 0x69A8488C, 0xAADBC15A, 0x9E8D068A, 0xEF9199C4, 0x386AB095, 0x0790437E, 0x5693A445, 0x05803408, 0x6AFEE6FB, 0x524470EA, 0x2F70934C}, {0xA6CA1027, 0xF3D8D409, 0x4FD32188, 0x06994D64, 0xAA99BB75, 0x1007BA0F, 0xA0F1A090, 0xCD5AAE98, 0xF54EA17E, 0x2DDD856C, 0xF00D72B0, 0x512FD903}, 0},
+    {{0x30452204, 0x51A2CF1C, 0x621C1C67, 0x891D7D8E, 0x65DFF7C2, 0x0AF5A9B4, 0x504740A9, 0x82126CA4, 0x3D55CE0B, 0xBFBFF154, 0x17EB9702, 0xA6973D02}, {0x66F2D88C, 0x157C7716, 0x711DCC22, 0x91251E53, 0xF767C4FE, 0xE34B2B89, 0xB209F221, 0xE1DA6567, 0x08BCF91A, 0x9FCA502B, 0x32BAB6DE, 0x0537AF67}, 0},
+    {{0x9F302BA8, 0xDC587F70, 0x5950EAB3, 0x877668D7, 0x6C8281AB, 0x979B3B11, 0xA8249B24, 0x5EBB36AD, 0x2D6F0C04, 0x2C82A5D6, 0xA6B6F87B, 0x6D6CD374}, {0x15E220A2, 0x2E7A7981, 0x90087597, 0x824396AD, 0x9BCF87E8, 0x1F219610, 0x5C6ADA68, 0x0B3BC746, 0x9F1CB1FA, 0x920FD0A4, 0x92864B61, 0xD47807C1}, 0},
+    {{0x93051A22, 0x5BCE03D7, 0x285E7B2F, 0x6D1F4420, 0x4FE5FFF1, 0xE7360FE0, 0xC1BAEFFD, 0x9E2EFE36, 0x379EDA53, 0x3264CBFF, 0x3EEAE815, 0x9F299DFB}, {0x58922605, 0xD73ADF1B, 0xD24EAA11, 0x3D75B504, 0xE4861D27, 0x4E7A8554, 0x9DEEE5DA, 0x3316F3B6, 0xE9F520A6, 0xE617D61E, 0x9CA3D737, 0x7DB56B98}, 0},
+    {{0x08A423BF, 0x938F36E5, 0x20342165, 0xFCB8E4F3, 0xE3982F0D, 0xA1D83353, 0xE2A08DF4, 0x1D63B6CD, 0xE89A6D54, 0x084A1F88, 0xEA7E52DB, 0xA34A753F}, {0xECCBFC95, 0x79C9A7FD, 0xE4526882, 0x226A85E5, 0x1A9C27CF, 0x957F6359, 0x122EBFF7, 0x90FD4265, 0x5CE428A5, 0x6D59C734, 0x114BFAFA, 0x9CA8DD30}, 0},
+    {{0xCCA6A5A4, 0xF6CF2294, 0xF6170C50, 0xDD76F41F, 0x643B19B3, 0x94F12EA3, 0x9E15A617, 0x8C2B04FE, 0x9CA0FC93, 0x54314F07, 0xAD704F9B, 0x8842F943}, {0x42FCFFF0, 0x25F9557F, 0xB38F0ABA, 0xED5AD97F, 0x15DEADF4, 0xFB5FDF69, 0xEF9D3EE2, 0xA4006524, 0xF6CA4CE6, 0xF313601E, 0x8225D2EE, 0xFB5EA4F8}, 0},
+    {{0xA6AB4962, 0xB8D24A67, 0x65E04919, 0x1FF200C8, 0x1274CB59, 0x269AF900, 0xE9139B40, 0x9F371978, 0x460FE65B, 0xF29E91FE, 0x21EEE281, 0x477FE516}, {0x69F794C0, 0x08239219, 0x51EF4067, 0x5167DD3C, 0x11D64EA9, 0xB4B8DBFC, 0x859488FE, 0xEB259E9C, 0x17FD0380, 0xF72972D8, 0x969328AF, 0x2593EA87}, 0},
+    {{0x07B0B0B4, 0xA39C15E8, 0xA8703D41, 0x104B7E40, 0xA3DBB5F9, 0x031B04DB, 0x8990E720, 0x8DED2EE7, 0xC6727DBF, 0x3B99CDA3, 0x79F18898, 0x28B7443E}, {0xFA79A32C, 0x0256EBF5, 0x62416757, 0x299C19C3, 0x57C966C1, 0xFB097011, 0x33C1F11B, 0xFB25FD27, 0x9026FE1C, 0xE6CA9888, 0xDAD33921, 0x54FA967A}, 0},
+    {{0x9DA8C259, 0xE60E7117, 0x2C9F7713, 0x84EDFD2C, 0x011B4787, 0xD19D6F6D, 0x634DC557, 0xCED9ACB4, 0xC1718535, 0xD7C9C60C, 0x19E1EA96, 0xA9C109EE}, {0x26353F33, 0xC818B29F, 0xC50F5ACA, 0x431AC5CB, 0x72790513, 0xE6C8804E, 0x83E2DD24, 0xE6D7300A, 0x79C1CF19, 0x6AE810F7, 0x97E5D954, 0x1E03CF0B}, 0},
+    {{0x0F561ECF, 0x33D2F8B1, 0xEE33557E, 0x7236B37C, 0xE998DFE9, 0x7421BC7D, 0xC5D95AF5, 0xA48264FE, 0x604BA943, 0x644C01FF, 0xEC50A0D6, 0x8A27B018}, {0xD26F0AF3, 0x92FD9FF3, 0xA2436B74, 0xE67FC269, 0x4813BFAE, 0x0E4C0EC0, 0x97CED818, 0x16AA7B11, 0xE91E43DF, 0x8C7DC826, 0x4B5025FE, 0x2054EF3C}, 0},
+    {{0x5AA5DD5B, 0x7CF881F0, 0x8ACD0512, 0x1933BE20, 0xB87B12DC, 0xFC4A883C, 0xFDB6A1BF, 0x2CC76680, 0x1ECBF88E, 0x9E75E660, 0x6826E31A, 0x891ACD63}, {0xE940E91E, 0x74D3A606, 0x042E6BE0, 0x14A42512, 0x8FD95C9B, 0x3EF9A1A4, 0x33771DD9, 0xA50336FC, 0xF329FAAD, 0xBA6BBECF, 0x7AD2D4E2, 0x530E78B6}, 0},
+    {{0x65C8E083, 0xB60DFF39, 0xBB0FB9F0, 0xAE786F2A, 0x1FBB102C, 0x830A811A, 0x94C157BF, 0xB995E02A, 0x53A6E0DC, 0x7D07EFDB, 0x66D6337B, 0x5F0E8EA4}, {0x3C3E5029, 0x34068A0D, 0x578E7BED, 0xADE83D00, 0xF7E1C602, 0x792352F7, 0x15F70B7A, 0x60376122, 0xC8D8321E, 0xA7765869, 0x76273993, 0x708C30EA}, 0},
+    {{0x02699795, 0xAEC13597, 0x1FC11B27, 0x0A363402, 0x9A294C81, 0xFE8BD5BF, 0x4AFEC28B, 0x2EEF2FA1, 0x9260B7EE, 0x04BE3837, 0x4CAC7E5C, 0x7358768F}, {0x7F7B96BB, 0x3E3ABADA, 0xAD330158, 0xE5C39BE8, 0x88C6D2A5, 0x55C474F4, 0x1FF85D04, 0x427FCD5F, 0x90F20E37, 0x0E58C293, 0x0F668FC9, 0x279ADE30}, 0},
+    {{0x74BED419, 0xA9277516, 0x7CDF3A12, 0xA17787AB, 0x38FC2DD1, 0xE0F4DF8A, 0x92536409, 0x943BE2DF, 0x9C11A97B, 0x509481D8, 0x435E0A97, 0x6541F6FA}, {0xF8B29896, 0x163037C4, 0x44A6AA79, 0x1C442920, 0xB4050FE1, 0xA0EB36D4, 0x82F86ED2, 0x6CB75CA2, 0xE5187712, 0x749BAFD2, 0x4B529EAE, 0xE34A649A}, 0},
+    {{0xCD2CEAF6, 0x23193242, 0x53DA67D6, 0x2B37AA1E, 0x4BB5FDA9, 0x7F775D79, 0xB6C2C628, 0xE71658E3, 0xBF8762C4, 0xE84EF6E3, 0xFE78D2ED, 0xD91A6C51}, {0xC56D1C53, 0xD44D6940, 0xB3A78ED5, 0x5AAFB6FA, 0xAF5A874D, 0x489F007D, 0xC3E592B3, 0x7A7741BA, 0x967D10A7, 0x577A31D6, 0xD5AB9F93, 0x65FFACB3}, 0},
+    {{0x66675FE6, 0xB287FB3E, 0xC2500136, 0x5268B35B, 0x129D9918, 0xA1FA9F68, 0x3DF9C68C, 0x2214D0F2, 0x758CB1D9, 0x758E39BE, 0xE6D05162, 0x8AD4A9D5}, {0x68A7ED0F, 0x274ACB90, 0xBFA08C37, 0x29D670FA, 0x1D02E2AB, 0xFD640D77, 0x1F35D751, 0x1CD2A737, 0xAFEE1C9B, 0x0224EC71, 0xFE56E7B7, 0xB5D19CCD}, 0},
+    {{0xB2409843, 0xE620D909, 0x03375A86, 0xAF96811D, 0x49386938, 0xEDDA3927, 0xD8F03C5A, 0x8CC26C0F, 0x2D02AB19, 0x6B4E0282, 0x30F7D02F, 0xCF7BB700}, {0x73372239, 0x80D787B1, 0x45FB2475, 0x0EAB5AA9, 0x283C7F68, 0xC850EE6F, 0x8463A3E0, 0xC02270CB, 0x1AF40B7F, 0x907150DD, 0xCD9722AE, 0xD3F38641}, 0},
+    {{0xA144BD76, 0x00648445, 0x2610725F, 0x3C8FA5AC, 0xDE536F63, 0x69C0B503, 0x4869AD12, 0x0CBDF5DC, 0xDF042D7E, 0x5130A47C, 0xBA20E3BC, 0xA01AB51A}, {0x80C63E3B, 0xAFAFE10F, 0x2F520FBA, 0xEF7BFDA6, 0x5F86F5FE, 0x55C639C2, 0xA6E5C47E, 0xDB5BC6A9, 0x729722A5, 0xA4447085, 0xE682929D, 0x52EDEFD8}, 0},
+    {{0xA2816C0A, 0xFD6D5645, 0x3492804E, 0xC5EA3F3A, 0xA86E72C3, 0x8B65EEE1, 0xC935971F, 0x4A511CA5, 0x96A15841, 0x5A02B948, 0x2B213650, 0x70D76001}, {0x653308B7, 0x6FA04D78, 0x0D3E619C, 0xDA184245, 0x81726E34, 0xDC9B3750, 0x5628B9E8, 0xE6CE8648, 0x4D1C2A26, 0x2AFBA78B, 0x1E9D3C78, 0x2572D622}, 0},
+    {{0x84907295, 0x4AD482D3, 0x6F4B7080, 0x282EBC1E, 0xF71087A0, 0x0E1F4647, 0x0209D1FA, 0x8423478D, 0xF6E1F18D, 0x9C893DD5, 0x3AD9517D, 0xC811AA8B}, {0xD75E022D, 0xBC4DEBDF, 0xD2004C7D, 0x8BFDF91B, 0xCAF04A4D, 0x78376180, 0xE7325E5D, 0xB7276E59, 0x562D922E, 0x84894802, 0xC6C9C0A6, 0xC955AC20}, 0},
+    {{0x9EA56FEE, 0x0AF30269, 0x5C06049F, 0x9722B89A, 0xCFF9A4A2, 0x7AE5E92C, 0xA7F991AD, 0xA4138052, 0xC90C3851, 0xE05FC593, 0xD9A3AFFE, 0x2A90E5F2}, {0xF8E6633C, 0x3CF9233C, 0x23DD4B60, 0xE8F630EE, 0x6DF21FE0, 0x50963ED4, 0x92C89921, 0xACDA4E3F, 0x117DE978, 0xE6DFC54D, 0xD2F5AB4E, 0xDA4627E4}, 0},
+    {{0x1F33158B, 0xC32D7A99, 0xD36B7F65, 0xF5846EA8, 0xB95D29F2, 0xF2F8BE04, 0x2B6F816A, 0x0DB23A43, 0xCF74CF1D, 0x9A58683C, 0xADEAA37C, 0xA6550EB2}, {0x47057B02, 0x42B3FBA4, 0xF7499483, 0x24615327, 0x31EE6F85, 0xEA6327FD, 0x7A321A32, 0x2671AC30, 0x48AE8C0A, 0xAE670B73, 0x996A2086, 0x82830301}, 0},
+    {{0xB5DF9327, 0x50F1A9BD, 0x9A660CA6, 0x9591E460, 0x0D534C70, 0x194B2665, 0x19BD542E, 0xE53AE678, 0xE200C2FB, 0x5983840F, 0xC9BE7FF8, 0x3C98838A}, {0x4C762730, 0x9CB692A4, 0x99AC40EC, 0xC9A0AC9C, 0x11F99C21, 0xE4D2FE37, 0xA8F40576, 0x01663435, 0x8E752766, 0xFBD0677F, 0x080C3B9C, 0x8E9FDE8F}, 0},
+    {{0x1BE45FC3, 0x422685D5, 0x1A1A87C1, 0x8415F9FF, 0x53CF8D84, 0x0E167106, 0xC09EA8F4, 0x8C8CC1F0, 0x562293F1, 0x120BAB6E, 0xFCFBDAC8, 0x5CF0F9D0}, {0xB83DCCAF, 0x106FA677, 0xD6669C00, 0x4E1CEF47, 0x9984A268, 0xABF2A56B, 0xA786FC40, 0xB553702C, 0x4954C3D6, 0x5F4AFC82, 0xBB5F687C, 0xB299E4C0}, 0},
+    {{0x54C85B88, 0x072F458D, 0x62E7E269, 0xC9FC3C1F, 0xDB96DF04, 0x90F804FB, 0x88B9C9F6, 0xCEF098D9, 0x8587E62D, 0xF3E40E57, 0xDBB044EF, 0xDE0148EC}, {0x54DEE389, 0x693452FD, 0x42327D10, 0x86507484, 0x8BEA80EE, 0x9B94592B, 0x9DE61F9E, 0xE7DC0199, 0x6A2684AA, 0x4BC576CE, 0xA0B12761, 0xFFDF2F58}, 0},
+    {{0x54EE243E, 0x8803DEB7, 0xACCA49EC, 0x2E0659C0, 0x05BC7758, 0xF97BDAC6, 0x2758BD5B, 0x5416F592, 0x21C47CBF, 0x652D534C, 0x75AA28D4, 0x50E9836A}, {0xB670BF38, 0xED57DDEA, 0x13030C71, 0xCDE89872, 0x5885616D, 0xC74E5E3B, 0x346C147B, 0x108D27AC, 0x3FFEF917, 0x00293BD8, 0x87A8D078, 0x8224DA88}, 0},
+    {{0x850E032C, 0x9B8C2DE2, 0x5E53A08B, 0x1623DF5A, 0xD959C953, 0x5E750560, 0x40B418BA, 0x76021E22, 0x15D4FDFD, 0x5689434F, 0xB1F155ED, 0xDE66D6C9}, {0xB3F79992, 0x24854839, 0x24C196FA, 0xF4144E60, 0xDE279D6F, 0x3A1942AB, 0xBCC1097A, 0x7B9062EE, 0x240D79DC, 0x851438B3, 0xC685D691, 0x19B3EE03}, 0},
+    {{0x1FDB21DC, 0x4791B9A5, 0x5DF38CF0, 0x200762A0, 0x51ED8460, 0x23C6A20F, 0x2B1F5787, 0x7D01AE58, 0xA017B5E5, 0xC73C4028, 0xF177DDD6, 0xD8D23762}, {0x6502F03C, 0x2CA3F05F, 0x766F96DB, 0x30193017, 0x56C9A093, 0x5013D7DC, 0xBBA1744A, 0xE0A40BEE, 0x978826E6, 0xDAEF1BE8, 0x2D199CEC, 0x54F8ACBB}, 0},
+    {{0xAEB330A1, 0x80F13023, 0x5A9B5404, 0x778B4879, 0x0E7EA6E1, 0xD4A80C75, 0xCA603F7A, 0x5A924DA6, 0xF1922676, 0x3229A4F7, 0x23FB1A8A, 0x197C2B48}, {0x629AB902, 0x1CC41542, 0x09C4BA6A, 0xBF3E0888, 0x4257A194, 0xC58AD89B, 0xFF31B638, 0xD8C749C5, 0x9FF9BFC5, 0x80460D4E, 0xCF177F1B, 0x37F81AA5}, 0},
+    {{0x1C718580, 0x1AE0C4E1, 0xBF99A0BF, 0x303F48A6, 0x91AE219F, 0xA5551E44, 0x55A05287, 0xDC41D9BD, 0x6872B123, 0xD5AA73E3, 0xE6395BF6, 0x6FD94B0C}, {0xC00AFBC1, 0xBB95FDBA, 0x497CAC10, 0x9CD96208, 0xCA51AFEA, 0x8ADBD8C1, 0xF3BC5F5F, 0x94FEDAFB, 0xDF9F5371, 0x29C0217B, 0xD9024634, 0x5C13EB4B}, 0}
+};
+
+const eccp_point_affine_t SECP521R1_COMB_WOZ_W4[8] = {
+    {{0x0386E361, 0x967F3D95, 0xFF434579, 0x1477D0FA, 0x8529D810, 0x2941A684, 0x4B66A9A9, 0xC8D01369, 0xCED4C71A, 0x2E22119C, 0x0DE53E6F, 0x82752493, 0x4B7199A2, 0x2EC4912F, 0x8048778C, 0x32BE2048, 0x00000075}, {0x8B1A7194, 0xAFC6404F, 0x9B112160, 0xBC2BE5AA, 0x33E699D7, 0x8AB057B0, 0x450E2A34, 0x3BF7CEA0, 0x2AE3D95F, 0xFD6FE971, 0xEAEC28CE, 0xD1B2AA07, 0x66E9B715, 0x42873EA4, 0xE27CF237, 0x3CAAA6FB, 0x000001DE}, 0},
+    {{0xDD83E73E, 0x53573F4E, 0x1BF2FE0B, 0x1EAAE2AE, 0xA356F84A, 0xAE16DD2E, 0x92893A0C, 0x8DEC4C28, 0x4DB54B34, 0x64196AFF, 0x20F5362F, 0x9B963A17, 0xCC44E5DF, 0x22E89485, 0xF13A780C, 0x3DB01322, 0x000000C0}, {0x18EC794B, 0xF7351767, 0x2B37AF34, 0x41CB1279, 0x1FC27D24, 0xA11EE04F, 0x4053734F, 0x002193C9, 0x2DF2E39C, 0xAB14D7F1, 0xAF6C35B9, 0xF5C47446, 0xB0E7BD9B, 0xD4E95740, 0x498749D4, 0xF6536B70, 0x0000008D}, 0},
+    {{0xD925C332, 0xF92DCE95, 0xAA141599, 0x4AD6E821, 0x048A5EAB, 0x5713C7ED, 0xF65D4D90, 0x7E05BD6A, 0x5E4D9A33, 0xD6067D6A, 0x1C09EB4B, 0x7455EE1F, 0xAF335C27, 0xAD27CD4B, 0x1E96E824, 0x61AC7E8B, 0x000001E9}, {0x50FD7D48, 0x97DA7BCB, 0x6524E4F8, 0xD02D6A4C, 0xB5240222, 0xE6D2EBF5, 0x13406A2B, 0x9B4A1E97, 0x561355AE, 0xE05551E9, 0xC2683140, 0x60911DF8, 0x6F361E9B, 0x00630F58, 0xE3208502, 0x0F90402B, 0x0000014A}, 0},
+    {{0x8AF69A4D, 0x8B5E7302, 0x368E15B6, 0x1E08223B, 0x4AB60E1B, 0xB76B4378, 0xE9E96869, 0x0BF93C35, 0xAF45EBF6, 0xA1215955, 0x78D54BD6, 0x10FA98C3, 0x048AF9A1, 0xC783F9FF, 0x01DA6FD9, 0x235DAD0C, 0x000001A4}, {0xCC84DBD1, 0xDA6B96D0, 0xA8332CF7, 0x4DB71BFE, 0x2A2E724C, 0xFC0942D4, 0xA084DEC4, 0xBFE4C1E0, 0xB1FA3C38, 0x6E152AAA, 0x58E43473, 0x01551F0E, 0xEAF31969, 0x14AD5CDE, 0x026EFC8E, 0x1E906788, 0x000000B8}, 0},
+    {{0xE53A911E, 0x3F1C673E, 0x33734CBB, 0x9A7B7C00, 0xDA6FE5A9, 0x6E8CBDF1, 0x68D757A5, 0x713E29F9, 0xFA351859, 0x7B6D44E9, 0x121CE2CD, 0x496A5FFB, 0x0E8D374D, 0x9E132E3C, 0x982801C1, 0x76EE9B2C, 0x000001F3}, {0x16CF986A, 0xF36F11C1, 0x154F20FC, 0xCD622053, 0x884CB87E, 0xCE3FFB55, 0x4BDF3442, 0x8B49EC52, 0x416497E5, 0x5CF06FA0, 0xC4349EC3, 0x1A71A2B2, 0x49E2678D, 0x90CD1C63, 0xE9E2D130, 0x6D2CB8A6, 0x00000178}, 0},
+    {{0x9F3E99B3, 0xC592F8E7, 0xA1080875, 0x36FF7996, 0x7F879E24, 0xB3BA9688, 0xFB1F91EE, 0xFAD585D6, 0x4146B7EE, 0xD20FFBCD, 0xFC34148B, 0x54C8A8C5, 0xB2C33B69, 0x803E2F95, 0x29ED1733, 0x913DFDAB, 0x00000056}, {0xB09FAF0A, 0x5A95CC88, 0xFA62A102, 0xFD513259, 0x7153A6D7, 0x126B9E4D, 0x0F6A8D10, 0xD4D708CA, 0xE28943F7, 0x913E98F7, 0x21F5CE85, 0xD79678D4, 0x85A9BC94, 0x5654754B, 0x2AC6DCC8, 0x181ECE29, 0x000001C3}, 0},
+    {{0x923FF5AE, 0x3BCFC616, 0xB141451E, 0xCF9CEF00, 0x7A4A0F85, 0x08342135, 0x4A908251, 0x4FC53AC2, 0x3B75A153, 0x2F7E3FD7, 0x5ACFD71F, 0xA4DEFC56, 0xC6AA2B8A, 0xEDB91EEC, 0x547B1D17, 0x1D471B81, 0x0000018F}, {0x16BAEEBD, 0xC5E83750, 0x597B0955, 0x14B83D08, 0x4FD5EF31, 0xC476E92E, 0xC04AEE5F, 0x5CFB7D6A, 0x5A39E550, 0x621F163C, 0xCCA355ED, 0xCA620CF3, 0x84932AA4, 0xA5BF1133, 0x3A55B1BE, 0x21B82123, 0x000001C8}, 0},
+    {{0x8A93B0B9, 0xA01D5B88, 0xADE45266, 0x86DE5CDA, 0x135BC18B, 0xB555ECDA, 0x8A0DF107, 0x3229BBDB, 0xDF996975, 0x40359AC5, 0x08ED1A12, 0x00371011, 0x4CBC15E4, 0x625513E2, 0x6F7C04BA, 0xD4A81A0E, 0x00000137}, {0x61F876C1, 0xAD925730, 0x4204165C, 0x7A41D6BA, 0xB5EA5C05, 0xE7310292, 0x31C25B9C, 0x2F570FF0, 0xC7B0B7A8, 0x341A1790, 0xC3778A75, 0x36325008, 0xE7158BEB, 0xE72842C5, 0x02B07444, 0x2CEAC408, 0x00000036}, 0}
+};
+
+const eccp_point_affine_t SECP521R1_COMB_WOZ_W5[16] = {
+    {{0x2AA7BE2B, 0xE5B4BF19, 0xD52AC9E2, 0x2A18BD16, 0x90B7DA4C, 0x57D7664F, 0x869704AB, 0xCF00C207, 0xDAA27153, 0xCEE8A9A2, 0x5911E7A7, 0x19F8DA4E, 0x673ED1F6, 0x48EBCB2A, 0x5443FC0E, 0xFA0600A9, 0x00000130}, {0xDD0BACA9, 0x59674B26, 0x7185C651, 0xA56C003C, 0x36625ED7, 0x3867750A, 0x23D7692F, 0x504DE7C4, 0x7D966D03, 0x91F4D50C, 0x934441BB, 0x84DA3920, 0x52510845, 0xEE86C1DF, 0x67FE4337, 0x52522812, 0x00000159}, 0},
+    {{0x34A7F6C6, 0x8E9F72A2, 0x595F2A26, 0x83FDCE0D, 0x102A5413, 0x3D8E5856, 0x80F2EA02, 0x1A2E5DCE, 0x8D159E22, 0x68F1BB4D, 0x140E1756, 0x3C524635, 0xF94FDEA9, 0x8D0F5BB8, 0xDD38BCD0, 0x9378B73B, 0x0000012A}, {0x0BC868D4, 0x72AD87B5, 0xC00238BA, 0x1D83F7A6, 0xEC1C50DA, 0x58783348, 0xF9D31587, 0x191BB94E, 0x9A36A510, 0x74CDFFE0, 0x428E0429, 0x2F74DDD4, 0xD288B047, 0xE8C1575F, 0xC6C0EEEE, 0xC39BE176, 0x0000007A}, 0},
+    {{0xE1E12A9F, 0xFB770873, 0x83B06383, 0xB4193A0A, 0x39FC768A, 0x5CED2F8E, 0x8124B954, 0x7FEC4E26, 0x570336D5, 0xC129CF93, 0x14B5492F, 0xFD019AF5, 0xA621E9B3, 0xAD6D126C, 0xE8811874, 0x24D65F41, 0x00000048}, {0x1E131183, 0x4F823A9C, 0x5A0B8A34, 0x94183CAB, 0x29381472, 0x61B63071, 0xF26F4062, 0x4279D3F9, 0x29A5784B, 0x18BFEE9E, 0xA3C1CA75, 0xCB6C94FB, 0x5DD11178, 0x084B3495, 0x098BC056, 0x47D320A4, 0x0000006C}, 0},
+    {{0xE3E25E91, 0x787D1817, 0xD332462A, 0x0C594E10, 0x5DD08CB7, 0x38D0CA30, 0x17F732B4, 0xB6882314, 0xE19F1CCB, 0xD709F977, 0x933DFD31, 0xC29C3053, 0xD7EC0488, 0x25B1E376, 0xC25C523F, 0x10225887, 0x00000057}, {0x6B043F9A, 0xC6FEEB49, 0xBE65A995, 0x36308FBB, 0x53EF4AF1, 0x9B2B1688, 0xAD457ECA, 0xBE045A53, 0x596DFE15, 0x15C09294, 0x0F59642D, 0x22AA9BA3, 0x5E951429, 0xF4313C65, 0xD089CEC3, 0x47CEF19F, 0x0000011C}, 0},
+    {{0x592295C4, 0x7448E0C0, 0x4D3A41DE, 0x5B1A9FA6, 0x550938E8, 0xA403B65D, 0xAB33BEB4, 0x10093F41, 0xE5BC62BF, 0x916EA0CE, 0x43326BA0, 0x7F06B241, 0xD5D7EB39, 0x57D81B60, 0x6AB235A5, 0x89479F7D, 0x0000004A}, {0x9F7A107B, 0x37A4A1FC, 0xDC77843B, 0x50E7ECF2, 0x5AFD6B3B, 0x9107FCAB, 0x0CD26AB7, 0xFA2FAFA7, 0xEA4C9B86, 0x5E50AAAF, 0x23169666, 0x5794AC36, 0x8D8717B7, 0xBFC7924C, 0xACFC622B, 0xF305941B, 0x000000A2}, 0},
+    {{0xC5DCD99B, 0xEB2A3C63, 0xBBFC683C, 0x950C8CD0, 0x7C5CC36E, 0x4232EFB1, 0x7A526DFC, 0xE546FEA2, 0x75B7B99D, 0x6347A3DB, 0xE9A02A76, 0xED2AAB07, 0x3F1F9784, 0xF964140F, 0xAB0362C4, 0xED8A4190, 0x00000147}, {0xA27EA63C, 0x6534E962, 0xF472FB2C, 0x99A0104E, 0x5AF6C697, 0xEBBA8C20, 0x5BDB37C3, 0x6B8BDBEA, 0x3138BE9E, 0xBCDEF00B, 0x3F2317BC, 0x3804D88D, 0x20DF730D, 0x751A0E27, 0x45076772, 0x82345191, 0x0000011D}, 0},
+    {{0x308142A1, 0x8C452E38, 0x9719707D, 0x6CC95BD5, 0xEA7BF6A7, 0xAB0C1840, 0x8E546F63, 0x446B3734, 0x0E30B0CE, 0x4E227201, 0xE360C08D, 0x25E2C52B, 0x84D7D0DF, 0x55AB0F5F, 0x5672B90E, 0x8F4535FE, 0x0000019C}, {0x6B28E15B, 0x3A857251, 0xABDBBEEA, 0x0A6AAFBC, 0xEB2462D1, 0xE0939B3E, 0x565D820E, 0x6347D074, 0xA5D865CB, 0x6E9C663F, 0x26EF533D, 0xCBE92792, 0xE0121823, 0xD68C8455, 0xA5EA4165, 0x94EB4972, 0x000000D6}, 0},
+    {{0xFABEAE42, 0xFF754306, 0x46D6C2D7, 0xC2C8CDAC, 0xC64F7D07, 0x56756E38, 0xF5F637A9, 0xA1C70E6D, 0x13A8E461, 0xA80EB8FE, 0xD2EEFF08, 0x57981838, 0x666D187D, 0x6234C9A8, 0xBC9ADB89, 0x49295D13, 0x00000075}, {0x735DDABF, 0xAE5D8C03, 0xA9A337AB, 0x8D4A15D0, 0xDB5676DA, 0x55AD768E, 0xC144BCB0, 0xD0D7B2D7, 0x2D2E93BC, 0x07DD26BD, 0x137EB1A8, 0x3258A658, 0xABF47A01, 0xCFA4C73C, 0x59F8CE86, 0x8B073050, 0x0000004F}, 0},
+    {{0xC55D2753, 0x6EAE4C1F, 0x96EA996A, 0xE50FED22, 0x77BDD51B, 0x7C5DF2B3, 0xEC64E615, 0xED0A7E36, 0xA3BA729B, 0xAC9FE1E6, 0x1C7A576E, 0x944AEAFF, 0xE992EB49, 0xB9607FEF, 0x05F72354, 0xE06F4BFD, 0x000000EE}, {0xC79B1E2D, 0x03E7101A, 0x134AD49B, 0xA46752AB, 0x4FFBD1A5, 0x68EF110C, 0x1DD2C89D, 0x60A49269, 0xFE7A16BB, 0x538E2D86, 0x9F43463D, 0xFA0F3F43, 0x816B1CD4, 0xBE6C633E, 0xA3B30A06, 0x1005894D, 0x00000050}, 0},
+    {{0x98BBDE20, 0x554EB993, 0x084EFC6C, 0xF8C9137D, 0xB01FCF3F, 0x99CD21E0, 0xD15F0D6B, 0xD053FE76, 0x028B2B84, 0x9A63F29B, 0xFB41757A, 0xBA8D3948, 0xF1302DE9, 0x9D365C50, 0x22E6C87F, 0x8C5FFEF8, 0x00000053}, {0xC9524590, 0xA95F99B7, 0x13B81680, 0xD49458DB, 0x1C08D1D3, 0xD3F2D1ED, 0xAD2027DA, 0xAB65359F, 0xDA485438, 0xE4E781DA, 0x41620BCD, 0x70972F87, 0x7AC51015, 0x41B86112, 0x09BF7939, 0x495D0146, 0x000000ED}, 0},
+    {{0x6E0ED17E, 0xA6001CE3, 0x44050FE6, 0xC47A6501, 0xD3CE36B1, 0x12A256D2, 0x3673F1F4, 0xABF9E4BD, 0xCEF58561, 0xB04469C7, 0xF09213FF, 0x2CF15F3D, 0xF0C8F2F3, 0x86B69620, 0xA6F9C153, 0x6713B07F, 0x000000C6}, {0x3CC523EE, 0xE6958810, 0x88249BB5, 0x1BC48178, 0x158FE751, 0xBB753710, 0xFED1C1F3, 0xFAC08B80, 0x4F327423, 0xEEA63FAF, 0xAEDC42FA, 0x271CC5FB, 0x92B977B9, 0x12379209, 0x0CC061CD, 0x0C6E9141, 0x0000001C}, 0},
+    {{0x823D0E89, 0xF38F512F, 0x1DE9EE06, 0x6F456461, 0xB6BA1AF7, 0xC3324DD0, 0x8FF9A661, 0xA05CD17E, 0x884A3B17, 0x25256557, 0x98F9B410, 0x96583A76, 0xD3ABA923, 0x6E5999D3, 0xE96058EA, 0xB292ED3E, 0x0000011C}, {0x4271F564, 0x964C175B, 0x28E6BAFE, 0x98DD5684, 0x30D10669, 0x0FF85B8D, 0xA4BA2528, 0xB67DE4C0, 0x48C655ED, 0x778495A4, 0x19EA3A26, 0xAC060275, 0x5BD9C18A, 0x8D45E227, 0x8DED54C4, 0x33533C06, 0x0000017F}, 0},
+    {{0x5466AB4A, 0x756C186C, 0xDFE901AF, 0x4E000B10, 0x60BEAA11, 0x693C5B1E, 0x4BFD32FA, 0x82491102, 0x0D84114F, 0xC7A2ABB0, 0xF221F67C, 0x8D8E33D1, 0x4BBF6253, 0xA7B7F3BA, 0xAC1FB253, 0xEBF08B2A, 0x00000105}, {0x69DDFD10, 0x280E2067, 0x282B29CF, 0xEA8D233E, 0xA00013E3, 0x55343D4E, 0x0EA062A8, 0x003AA11B, 0x3140FEC0, 0x2348D8D1, 0x339572CC, 0x2BDA9218, 0x94A28479, 0xA0903EBA, 0x27C2E8F2, 0x03E617F5, 0x000000A4}, 0},
+    {{0x214B7315, 0xB324F596, 0x75914870, 0x01B00DE9, 0x19161677, 0x7F831703, 0x8DBAD25E, 0x688A8C2F, 0xE3BFCD97, 0x19EC663E, 0x98DF7B7B, 0x55C11440, 0xE16B5846, 0xFE0C86E5, 0xCC3D8A9A, 0x3B38020E, 0x000000AE}, {0x660B20FC, 0x86B25275, 0xBB48DFEB, 0xA77CA9E1, 0x66B327C1, 0x2B0BF3FC, 0xBBE9581E, 0x5EF6F918, 0xC7501763, 0x21CAF1E3, 0x4842772C, 0x484B0BFA, 0xDE4F8D3F, 0x11F58AB5, 0x6D90A027, 0x5E9FABA9, 0x000001A2}, 0},
+    {{0xA51659DA, 0xE859F902, 0xA518FB4D, 0x09A61EF5, 0x630FAD3C, 0xE7AC2144, 0xA51549ED, 0xCBB197AD, 0xF2045395, 0xAFFBE897, 0xB1FE9531, 0x1D0FCCC8, 0x1E877F89, 0x1C9F4660, 0x82F2D18C, 0x3D36F71B, 0x0000012C}, {0xD2DC7327, 0xB28B4658, 0x5223ABA9, 0x9D1A8149, 0x1689ED8C, 0xC10759D3, 0x07D82CCD, 0x1C232113, 0xCB7190AC, 0xDFC759F8, 0x0AF98E95, 0x1062B682, 0x5F50A105, 0x8B649A7B, 0x60C76648, 0x0D10649C, 0x0000000F}, 0},
+    {{0x72C8A216, 0x2F04437E, 0xA4849954, 0x7E29CF03, 0x407914C8, 0x2ECB115A, 0xCF048029, 0xDC119153, 0x257C0ACF, 0xDD29112F, 0x418B5E47, 0x279D45B0, 0x6A40576C, 0x4F3E45A9, 0x12876175, 0x404623A0, 0x00000031}, {0xFE2ECE35, 0xC50FD29B, 0x48BF415C, 0xCA583D77, 0x4F0340A6, 0xD21CDDFA, 0xEF156744, 0x192B979A, 0xA4A1395B, 0x4E530996, 0x1F2552F6, 0x2D856066, 0x6736D428, 0x87F85B95, 0xE5F285CA, 0x3EF5BD36, 0x00000070}, 0}
+};
+
+const eccp_point_affine_t SECP521R1_COMB_WOZ_W6[32] = {
+    {{0xF8786227, 0x8168536D, 0x35AED5E4, 0x80561729, 0xAC329556, 0xC542F4F2, 0x330C8CB6, 0x7D0C92B9, 0xBC8E7D35, 0x990D9F86, 0xF9270221, 0xC0011806, 0x9F40088B, 0x62AB6787, 0x6443E38F, 0xAEE93B3D, 0x000000FB}, {0x2874DABF, 0x2C196CC2, 0x6913264E, 0x2F3AD5C4, 0xC04F21C1, 0xD83CB2EC, 0x2DED4391, 0x3BC8A5AA, 0x3F2035EC, 0xBBE387C4, 0x6C4F323C, 0xBAE20AC1, 0x253170C4, 0x413641A9, 0xB2C1A9BA, 0x7B1D2E84, 0x0000018F}, 0},
+    {{0xBC80723E, 0xE071601E, 0x977E1A82, 0x9240C281, 0xBE0E9C5B, 0x0FDBCC59, 0x0495B6B4, 0x93EF0F2E, 0x28A032DE, 0x15110F86, 0x3DE69342, 0x7D0B776E, 0xFC618973, 0xC14C2ECD, 0xF90414C1, 0xA4E9D3FF, 0x000001F5}, {0xDEBC0947, 0x93DBFD94, 0xD46C655A, 0xC1811CCF, 0x61243F40, 0x5ABEFDAF, 0x63D982BD, 0x965F7A9C, 0xFA0FE6D3, 0x4048303E, 0xF72A793F, 0xB6483D1E, 0xB9E5D4FA, 0xB028007A, 0x926D697B, 0x6453D16C, 0x000000BD}, 0},
+    {{0x9B115029, 0x0BA5AA77, 0xCE879ACB, 0x1F48245D, 0xF71DDDA1, 0xAE5D3526, 0x45BDE747, 0x40D5C9ED, 0xE6818802, 0x295326FB, 0x072018D5, 0x4A4111C5, 0xEF1FF351, 0xE352B580, 0x26911A4D, 0x2E7ED3F3, 0x00000144}, {0x19A48A8C, 0x37715DEA, 0xFAB846F1, 0x5EA62B1D, 0x4056CA93, 0xAC2B5978, 0xD8587DC9, 0xBE8A8113, 0x8D143D43, 0x3DB26FA3, 0x60A6D528, 0x40FD3F7E, 0xDE4AEB32, 0xD3EF4D65, 0xBADD7999, 0x1D09C25A, 0x00000088}, 0},
+    {{0x4BE82F13, 0x8FBB48C7, 0xDB666EF0, 0xE2A9EF7E, 0xC591CD01, 0x83C981DE, 0x062EAAAF, 0xC0A56F1C, 0xA9BBB76F, 0xA1FFB588, 0x4FF57617, 0xC4719C62, 0x20F4898E, 0x3696F53E, 0xFCCD8BFA, 0x0507C7CC, 0x00000176}, {0x91277609, 0x4722D9FC, 0x47AA7A7D, 0xC2633A41, 0xE1FA4B6E, 0xEBFF9A99, 0x2E82DC03, 0xD625746B, 0xDD194073, 0x38C3A0DA, 0x4F3C1373, 0x03FE3E10, 0xD8456078, 0x922B6279, 0xCFA68AAF, 0xA0397042, 0x0000000C}, 0},
+    {{0xA4511599, 0xAE5BB73E, 0x21C7AF66, 0x006AFF84, 0x6C66F090, 0x9ADC9259, 0xCE676E09, 0x50D99165, 0x9FA3958D, 0xC201DAE4, 0xA5A20518, 0xCD4D9521, 0x67F0F713, 0x624472FF, 0xC6D2D2B5, 0x29561EF4, 0x000001D2}, {0xB9D38224, 0x882EFDDE, 0xFB8654F1, 0x840F8123, 0xA3DC2E17, 0x9F885CE1, 0x9D477B6F, 0xD349D477, 0x97AA11AA, 0xDCDC7215, 0x78F5270D, 0x66CC6BE8, 0x2470EB0C, 0xC83D8F8E, 0x348CA7AC, 0x34F56FA9, 0x0000006B}, 0},
+    {{0x56DE6ED7, 0x2FF37161, 0xA04619FE, 0x467D4670, 0x1EF11975, 0xB1296D65, 0x8FD30B8C, 0x408686FC, 0x7AFA5332, 0x2EB56882, 0x60103C54, 0x3B786876, 0x8ACC5D2B, 0xBFABCCB3, 0xB2837EBA, 0x8238664F, 0x0000008E}, {0x376BF759, 0x2F81FCF3, 0xD11DE0C0, 0xE954E5D8, 0x6817166B, 0xFA2AC1D0, 0x1883D73B, 0xA8531A91, 0x81D5A52E, 0x48474D01, 0xAF8A52E7, 0x392F6D4B, 0xDCBD6641, 0xFD32E73B, 0x10A38E39, 0xC4DC86E0, 0x00000103}, 0},
+    {{0xB7157394, 0x6DDD9ACE, 0x0D6B6B4D, 0xE10FA1C6, 0xFC01E098, 0xA4F5B3CE, 0xFA9CA6F8, 0xB23CEF45, 0x4330CC30, 0xC8AC0AEE, 0x34502467, 0x5840C8EA, 0xCA898B1F, 0xD6B7A6D9, 0x3A564F4B, 0x8FC2796C, 0x000001F1}, {0x60024ECA, 0xCA192622, 0x83E1F67D, 0xD658A6FA, 0xAC30C5AB, 0xE418A572, 0x5E012F2D, 0x3F79E953, 0x7AB6A0E7, 0x9F150852, 0x7B9EFEE6, 0x2C91FCA9, 0xE59CAAD6, 0x55D613A9, 0x14A1B0BF, 0x9F413C3F, 0x000001D1}, 0},
+    {{0xBBFD9C34, 0xE1AC7185, 0x98FBBDDE, 0x35DC9837, 0x79A93920, 0x266009EE, 0xD7DD936D, 0xB3206DA6, 0x372D64CA, 0xDDBB517C, 0x04A6461C, 0x1B1E9439, 0xE7AAF8CA, 0x877497FE, 0xF26FF3C5, 0x96296FDC, 0x000001DF}, {0xA65E7219, 0x846D86FB, 0xCB928A23, 0x45F4FDD4, 0x23032859, 0xC089858F, 0x5720FF65, 0x7453C91F, 0xC5530841, 0xA5AC9683, 0xB7A19CE6, 0xC32812F2, 0x7328BB63, 0x9807F776, 0xA6BE4145, 0x291E0F14, 0x00000137}, 0},
+    {{0xBE82C59A, 0xC68F1C9F, 0xA19A8388, 0x61ADA129, 0x8D7E2C8E, 0xFEA85704, 0xE4F04F4C, 0x2E585FB9, 0xB5C27754, 0x57F23A30, 0x3884C22A, 0x939EF503, 0xC3EC21AE, 0x6B97BB87, 0xF92C6727, 0x4F271A7E, 0x00000144}, {0xF4DB3F58, 0x520DA56D, 0xB3E3A81C, 0x141B9F98, 0x6F49E180, 0x4199083C, 0x59B611F1, 0x21C70C6C, 0x856B9270, 0xE228911A, 0xD2EE5EBF, 0x5CBFF6B3, 0xDE0CCD1E, 0x02F9B545, 0x1A92998E, 0xFAED6F93, 0x0000000C}, 0},
+    {{0xA9C1DCF3, 0x77F645CE, 0xE7F2B68D, 0xD1069019, 0x36CEB20E, 0x7C855642, 0x6FAE1E47, 0x7F482D51, 0x5695450F, 0xEDC5E94E, 0x9DB0F1AE, 0x8E1DF180, 0x1713F02E, 0x5115B3DF, 0x9EF674CC, 0xBEA12DA2, 0x00000147}, {0xE1B6067A, 0xC661E70F, 0x651186D8, 0x9607C339, 0x26ED3EDA, 0x81751F79, 0x77042A26, 0x248A3FAF, 0x4E053166, 0xA8BBCD20, 0x78402B8A, 0x50566B37, 0x335E76F9, 0x74F2B008, 0x1C003CE3, 0xAECC87D1, 0x00000158}, 0},
+    {{0x22EC3935, 0x83C616DA, 0xF4802458, 0x3CE12FD5, 0xC351BBBE, 0x755688D1, 0x4AE9FB66, 0x767BD5B4, 0xF7BE4C3F, 0xDA52B442, 0x6912E858, 0x8659F828, 0x947996DF, 0x514174F1, 0x6AAEFCA0, 0xAE2BD0ED, 0x000000E7}, {0x0B967D27, 0x50E5A901, 0x7E9EA58D, 0xD0FEC9B5, 0x0A3C9FC8, 0xE2B67ABC, 0x108AAF94, 0x392EF8DB, 0x91F120B8, 0x3750374B, 0xE42401B0, 0xB07933A7, 0x2A21C6DC, 0x374204A6, 0xAE58A99F, 0x48AB648B, 0x0000015A}, 0},
+    {{0x99C8932D, 0x14DB5ACB, 0xE5473B91, 0x445D16D1, 0x8F76A898, 0x1F7E4EA7, 0x2AC7D459, 0x1A62122F, 0xCE786CE1, 0x5BE3DCBC, 0xB53DCCC8, 0x84FE8924, 0xBE939C5B, 0xA926CB45, 0xA8100F5C, 0xEF1A0B4A, 0x0000012B}, {0xBDDEEAF0, 0x4C0B217F, 0x5E18F845, 0xA973A273, 0x28652116, 0x5647EFF1, 0x671BF6FA, 0x1A93C747, 0x99981E9D, 0x23B70A19, 0x5A47DFA4, 0x40B65A5C, 0xD87CFEC1, 0xF3AF65EB, 0xCF28FB34, 0x21554DE9, 0x0000017C}, 0},
+    {{0xB2DDD4D3, 0xCF2AA6E9, 0x4BF4203B, 0x07334475, 0x3971534B, 0xC83FCBC1, 0xD522CFBD, 0x089626F7, 0xE88E6453, 0x9E1B5F3B, 0x2EECE344, 0x46E16972, 0x1DB0A341, 0x1EDAB27A, 0xB946BC95, 0xE8CCB528, 0x000001EA}, {0x65900CDA, 0x0A975C8E, 0xB75CEB62, 0x650F1E29, 0xD16F610F, 0xC807B6D3, 0xE281A800, 0xD36B27F8, 0x3904537C, 0xA60652AC, 0xB9931E8D, 0x8207E022, 0xD543CC4D, 0x05413276, 0xC4F92E60, 0xC47DA7E4, 0x00000139}, 0},
+    {{0x2C329734, 0x7E70A186, 0xDC504E24, 0xE3938690, 0x7091134A, 0xCAA3D172, 0xB8A0885C, 0x5D15ACF1, 0x35455962, 0x4813BC17, 0xA978A421, 0xE24E7BE2, 0x9A6F682A, 0xC523F556, 0x5ABED4D6, 0x94C0E325, 0x000000EC}, {0xCCE6D479, 0x97989E18, 0xD4F16826, 0x0A6298EE, 0x96345A57, 0x488D752B, 0xBBA17B08, 0xEB2E411D, 0x6B4E1A68, 0x080FD04E, 0x48C610C1, 0x93FC3174, 0x6E3F1499, 0x8C81FD01, 0x23FC5315, 0xA6FE0DFB, 0x00000159}, 0},
+    {{0xEF4E2F64, 0xDA831B5E, 0xA891564C, 0xCC39681A, 0xBF44167E, 0x3B3A7D13, 0x8A2E9ACF, 0xDF863A5E, 0x899A4DE3, 0xBD5C0F46, 0xBF901B74, 0x4D75D920, 0x92BB521F, 0x21161E10, 0x29E490C6, 0xF9353CAC, 0x0000012C}, {0x6E2C3F46, 0xE8F90C19, 0x5BC95738, 0xB5C4EFCE, 0x464EBAB2, 0xE0022D36, 0x27B10F61, 0x207F3830, 0xF98AD279, 0x865D9BDD, 0xFDBC2673, 0x554FAE9F, 0x72F8704F, 0x55877CFA, 0xBBECD942, 0x5C625A43, 0x0000002E}, 0},
+    {{0x35829BDC, 0x03DA130A, 0x4CDF1342, 0x953347DD, 0x10981748, 0x4996680E, 0x7984C07C, 0x10D091D0, 0x56832437, 0xC7DEB10B, 0x4478B0D5, 0x77C6A7D3, 0x176EFDA6, 0x6B97C130, 0x39C3826C, 0xE6BB64FB, 0x000001E6}, {0xE8D65BFC, 0x717B9293, 0x4C4DE3F3, 0x0CFF4E86, 0x8857C088, 0x6F06618E, 0x6EE31A40, 0x759B2E8F, 0x55D253E9, 0xE802BA71, 0x30671E7E, 0xC3484DF2, 0x6E60F5C8, 0x11A97DAE, 0x7AA88648, 0x517C0807, 0x0000010F}, 0},
+    {{0xC7034E39, 0xE5EB05A3, 0x9F3BFE9B, 0xAD602ABC, 0x96132F98, 0xACE8D02C, 0x53152EAD, 0x55926D91, 0x6E571919, 0x0A515E66, 0xFF3721D2, 0x0D478C6D, 0x8614A27F, 0x33CF1569, 0xB2D5745B, 0xC79ADE4D, 0x00000193}, {0xA2D13B25, 0xAFCE532C, 0x1981FC9E, 0x814C0B16, 0x840C2C70, 0x8D207110, 0xAB0AA127, 0x5F2C4056, 0xE1C0F12D, 0x7C97D76D, 0x7D2475A4, 0x54182886, 0x07B3D04C, 0xDF9FC56A, 0x2AA91CA0, 0x096F6566, 0x00000051}, 0},
+    {{0x1AB49A6C, 0x6926C0A0, 0x692B9EE0, 0xC4ADEA1F, 0x80BAEF34, 0xA1F6C7E3, 0x92FC6030, 0x2D69D0EC, 0xA70987B3, 0xF96C0CE5, 0xABC34D36, 0x93B8DABA, 0xFACD5C29, 0x8E915C4D, 0x6CD92DD5, 0xA5C3A1D2, 0x000000EE}, {0x507616FB, 0xFF1E3F22, 0xE69D39E9, 0x4A560209, 0xC6B7020B, 0xBA9AF51F, 0x0610FBA4, 0x5B3CB4C6, 0x6CF2E7AF, 0x8728D140, 0x20EB418B, 0x5C32C37A, 0x6778BFD2, 0xF98805FE, 0x7E491D3D, 0xB4B404E3, 0x0000009E}, 0},
+    {{0xD7DE3E93, 0x8BF1FF45, 0x21A42D93, 0x4457450C, 0xA4B9FE46, 0x0E2BC437, 0x8B56471D, 0x4F3C7DE2, 0xDF636114, 0x7D6948F9, 0xA2C25FFD, 0x2D175F83, 0xF4D16DAE, 0x7B0B7B0C, 0xF1A75658, 0x44223F2F, 0x00000134}, {0xEA6641B3, 0xBA57AD1D, 0x20A5B2C5, 0xB168E497, 0x2148155C, 0x5F7FD16A, 0x427ED0C4, 0x90D3E293, 0x7B71B67B, 0xE0B1236B, 0xE520674E, 0x5CFF2641, 0x32E274FC, 0x234C7D11, 0xE5D89B17, 0x5DF8D08D, 0x000000AF}, 0},
+    {{0x71941A96, 0x2566231D, 0x09194F1B, 0x98311C78, 0xD903790F, 0x0D9749EF, 0x687A47E9, 0xC1B5D985, 0x0B597AF9, 0xF25440EF, 0x7E48ACE5, 0x010D0637, 0xA131F756, 0xB2CFFFBB, 0xCC57921C, 0xDA5CA16D, 0x00000167}, {0xE10FDA98, 0xF13DCF86, 0xE338765C, 0x88E90C77, 0x0EADFE93, 0xF9757EAE, 0x6B52FC60, 0x3D88964B, 0x4A4D6846, 0x4640CC9B, 0xD0FE51FA, 0xC10C203F, 0x41A2168D, 0xDDA3EC58, 0x41BBB6F8, 0x2C498B42, 0x000001CB}, 0},
+    {{0x5718C733, 0x52E01664, 0xACF57649, 0x0542D214, 0x0A99968D, 0xD49EACB4, 0x56EEC619, 0x2BC447F5, 0x23134986, 0xEF4175F5, 0xB6CE7FA0, 0x4511D470, 0x45410BA4, 0xF5450E45, 0x304FB551, 0x4197BA21, 0x000001A5}, {0x7B2350BF, 0x9015E571, 0x684DEB6D, 0x3883B0CA, 0x63E4DE7C, 0x33CB8D67, 0xD5BD145D, 0x9810845E, 0x8B289A3D, 0x04EF2386, 0xF0F7F97C, 0x8BE65839, 0xB567CC2C, 0xBE231F3D, 0x485FD214, 0x5F41CBF7, 0x0000012D}, 0},
+    {{0x7C7D8564, 0xD41072E7, 0x0182959A, 0x85D347F1, 0xE1DC2951, 0xF0329DBE, 0xBBF4FFB2, 0x50778FC3, 0xBEE65BDB, 0xAD4C7780, 0x16E77115, 0x7688908B, 0x831A384D, 0x7B2850A5, 0xAA784685, 0xBB38ED3B, 0x0000001D}, {0xC10AEA32, 0xAC8FE51A, 0x0A449AA8, 0x1D00FEE1, 0x3D0C1B41, 0x2E909E49, 0xD624BF68, 0x68ECFAE1, 0xF3D729C8, 0x461F0CEE, 0xA6ADFED6, 0xA66A592B, 0x739706E5, 0x2F84A712, 0x31C5A04D, 0xFEEEE136, 0x000001C4}, 0},
+    {{0xD1475FA3, 0xA77FABF5, 0x524E986C, 0xD9E35E5F, 0x372100A2, 0x047D86D8, 0x4881AA4E, 0x2C6FDEFB, 0xA2BB1B49, 0x2C8169B6, 0xDDBA7D93, 0x2E8ADC50, 0x2B1975B3, 0xA6EF0B58, 0x3E629204, 0x9C4055D8, 0x00000007}, {0xDA64D0BB, 0x5DD5FAB6, 0x5F937E94, 0x60AA471F, 0xB16BD492, 0xF8A64AC1, 0xA589982E, 0xD1EC62AF, 0x8E489798, 0xDAA8D574, 0xD6F32D6B, 0xAE649811, 0xD610BF99, 0x5C3A0F9F, 0xC7174996, 0xBB03B33A, 0x00000196}, 0},
+    {{0xD82EF668, 0x5501A6A7, 0xC1AA8A75, 0xB2FA2222, 0xAFB1AD12, 0x4DE5D43D, 0x37DE2BCB, 0xDC4117B3, 0x03984027, 0x294789AD, 0x2C760387, 0x0E59F4FA, 0x4968FFFC, 0x2218AB41, 0x4D54D3E0, 0x13D2FBA1, 0x000000F8}, {0x6C0942A6, 0xDD9B4D38, 0x4729CDE8, 0x62696EA2, 0x8EEFD28D, 0xEF95052F, 0xC69A8DB8, 0x0B438C36, 0xC2905534, 0xB302A66A, 0xC84D6B30, 0xF813BE5A, 0x1281211A, 0x7176E9EB, 0xAAF4FFF4, 0x769E3DDF, 0x0000006F}, 0},
+    {{0x9C516F7A, 0xBB087C3E, 0xB459524E, 0x09213209, 0x2E0406D5, 0x4D5C1BB4, 0x14FAFA70, 0x61090361, 0xF4F47CEF, 0xD6723977, 0xFE8FD15D, 0xD46AE87F, 0x33EBD358, 0x30CEF438, 0xBC358E8E, 0x03ED5F48, 0x00000012}, {0x3A5D9671, 0x9A817CA8, 0x2499E57A, 0x38F3143F, 0x703E7439, 0x07804A30, 0xB9F67433, 0x0C7A80ED, 0xA41BC950, 0xE92A38E7, 0x169B5BB5, 0x6D3F7697, 0x44030E43, 0x1D472871, 0x469821E6, 0x64446CC1, 0x0000009D}, 0},
+    {{0xA4064818, 0x7B12109A, 0xCD4D95C8, 0xE85B9650, 0xF791B1B4, 0xAA186965, 0x97F7BD09, 0x959C13C5, 0x13108E1C, 0x31A52FF5, 0x59FA78DB, 0x13BF93FC, 0xE4E94D0A, 0x52970C63, 0xE0A2D266, 0x786EA74D, 0x00000079}, {0xC03F7FCF, 0x4F52A12C, 0xEBC874C8, 0x8BCD78BB, 0x70A4625A, 0xB9359540, 0x6FAC7A5D, 0x000C8325, 0x7B374B9C, 0x8E1BC128, 0xA2A2F338, 0x2A9E6FCD, 0xB9F2803C, 0xA8744E5F, 0x0230B952, 0x1AF02109, 0x000000FA}, 0},
+    {{0x47A552AC, 0x618BDD31, 0xD37164F9, 0x4B71B7A2, 0xF71F642B, 0xE4F2CA48, 0x1EA11D06, 0x92420FAB, 0x59750FB8, 0xC8A8D3F0, 0x62E85CB8, 0xD15834F4, 0xE0B7996D, 0x543C0150, 0x15F6654E, 0xDFE2A8A8, 0x0000017D}, {0xCFA023B8, 0x0447DC3F, 0x4159D935, 0x44199814, 0xC742428A, 0xA6379126, 0x43368275, 0x4278974B, 0xFA2F9041, 0xF03A2BE5, 0xE7BC05C2, 0xF81788E0, 0xEB1BDF46, 0x17ACB74F, 0x3C499913, 0x1B6F121B, 0x000001C3}, 0},
+    {{0xAB0FDE00, 0x30D837B6, 0x0A93A3F6, 0x366AB189, 0x8782444F, 0xD07301F1, 0xC6288D39, 0x6980326B, 0x6E5DE8BB, 0xF0CD53EF, 0xF784B7E8, 0xB59C9966, 0x64140BC4, 0x165A38A2, 0x4FEA84B6, 0x3CDD9A10, 0x000000E1}, {0xCB6D6D07, 0xE190F7A1, 0x97326299, 0x7421E15D, 0xF11AA86E, 0x8AA33130, 0x9CBB6EB9, 0x2F44441F, 0x78CEDA21, 0x8799C653, 0x7F6F3FD8, 0x492CE152, 0x040163EE, 0xEA57B0B8, 0x191CC659, 0x0488560C, 0x000001FB}, 0},
+    {{0x03569E99, 0x2D6F14CA, 0x8ABFA928, 0xD24838AE, 0x22E895D3, 0xC023141D, 0x9F6EA39E, 0x53E34DC7, 0x89880553, 0x01C87554, 0xC551AF12, 0x552B5C16, 0x1DF653CA, 0xAFA6EEDB, 0x8AB27B4E, 0x38180B32, 0x00000015}, {0xA59CB8C4, 0x35E2A3AD, 0x5CF10979, 0xEBB39D8A, 0x1C6998BE, 0xA649EFC9, 0x5BF4D910, 0x3F173BD7, 0x26FAE2A2, 0x4AA2E1B1, 0x8030A274, 0x43DEBD3C, 0x3477D9EA, 0x877E39C2, 0x6600A368, 0x05669322, 0x000000DB}, 0},
+    {{0xF0085CAA, 0xFD25D34C, 0x448A04D6, 0x9D685C92, 0xDCD43CBC, 0xB37C84E0, 0xE3107FE0, 0x8A70E90E, 0x75E2BD41, 0x57C8C735, 0xA380BF7C, 0x771C91B7, 0xEBCF4F74, 0x6B07AD7B, 0xA9BB2646, 0x17F54FC5, 0x000000EF}, {0x3FD9B746, 0xD09851E3, 0x5A86DFBF, 0x37DD410D, 0x7378862D, 0x801255AC, 0x394889CE, 0x814F5AD0, 0x5A2205D5, 0x8BD9F8CF, 0x678B76B2, 0x706238F6, 0x5A58853F, 0xFB058E2E, 0x6DBBE11C, 0x637598E9, 0x0000008B}, 0},
+    {{0x31C1E719, 0x150A7282, 0x54D9DB79, 0xEA69C509, 0x3F0803F4, 0x189FB51B, 0x1A8BB7DC, 0x0F2153DD, 0x738F55D9, 0x2C394BAD, 0x82330C74, 0xDB8502C1, 0xD01E3158, 0x80A8F059, 0x0573D916, 0xA28F2A53, 0x000001F6}, {0x192CFFAC, 0xF3AAE13C, 0x82A0965B, 0x38F94171, 0xC61100D9, 0xA1E60C94, 0xEAE82679, 0xAEEB6CF7, 0x257781B2, 0x9AD43DE3, 0x7C0D427C, 0x73EFBD97, 0x1CAAC3CE, 0xADD3A068, 0x5EC73621, 0x3A9474D1, 0x000001F5}, 0},
+    {{0x5B7EF792, 0xFD9A6146, 0xD2139441, 0x4F2F3E81, 0x51115807, 0x5CBFA301, 0x8311DDD6, 0xCB612476, 0xA213AB26, 0x7368E2DA, 0x494DBF0E, 0x96B88C17, 0x55D9EBBD, 0x556F4EA3, 0xA6D8C73C, 0xF09734EB, 0x0000006C}, {0xD7FA547A, 0x1104CF7F, 0x3646F311, 0x0D89940A, 0xE6110931, 0x5801B3BF, 0xE002F9E0, 0x12FD87E1, 0x05FA1F24, 0x9B4C29B7, 0xF5CA69D9, 0x52112A40, 0x7A9160E6, 0x6FD4FE5D, 0x3895C334, 0x79618749, 0x0000002C}, 0}
+};
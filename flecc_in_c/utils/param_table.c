@@ -0,0 +1,211 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+#include "param_table.h"
+#include <string.h>
+#include "../eccp/eccp.h"
+
+/**
+ * Updates an Adler-32 style checksum with the given bytes.
+ * @param checksum the checksum so far (1 for the first call)
+ * @param data the bytes to be added
+ * @param length the number of bytes
+ * @return the updated checksum
+ */
+static uint32_t param_table_checksum( const uint32_t checksum, const uint8_t *data, const size_t length ) {
+    uint32_t sum1 = checksum & 0xFFFF;
+    uint32_t sum2 = checksum >> 16;
+    size_t i;
+
+    for( i = 0; i < length; i++ ) {
+        sum1 = ( sum1 + data[i] ) % 65521;
+        sum2 = ( sum2 + sum1 ) % 65521;
+    }
+    return ( sum2 << 16 ) | sum1;
+}
+
+/**
+ * Computes a checksum that identifies the curve (prime, a, b, and base point).
+ * @param param elliptic curve parameters
+ * @return the checksum
+ */
+static uint32_t param_table_curve_checksum( const eccp_parameters_t *param ) {
+    size_t length = param->prime_data.words * BYTES_PER_WORD;
+    uint32_t checksum = 1;
+
+    checksum = param_table_checksum( checksum, (const uint8_t *)param->prime_data.prime, length );
+    checksum = param_table_checksum( checksum, (const uint8_t *)param->param_a, length );
+    checksum = param_table_checksum( checksum, (const uint8_t *)param->param_b, length );
+    checksum = param_table_checksum( checksum, (const uint8_t *)param->base_point.x, length );
+    checksum = param_table_checksum( checksum, (const uint8_t *)param->base_point.y, length );
+    return checksum;
+}
+
+/**
+ * Computes the checksum of a table file (header with checksum 0 and the entries).
+ * @param header the header of the table file
+ * @param entries the table entries
+ * @return the checksum
+ */
+static uint32_t param_table_file_checksum( const param_table_header_t *header, const uint8_t *entries ) {
+    param_table_header_t temp = *header;
+
+    temp.checksum = 0;
+    return param_table_checksum( param_table_checksum( 1, (const uint8_t *)&temp, sizeof( temp ) ),
+                                 entries,
+                                 (size_t)header->entries * header->point_size );
+}
+
+/**
+ * Returns the number of table entries for the given table type and comb configuration.
+ * @param type the type of the table
+ * @param width the comb width
+ * @param blocks the number of comb blocks
+ * @return the number of entries, or 0 if the configuration is invalid
+ */
+static uint32_t param_table_entries( const param_table_type_t type, const uint32_t width, const uint32_t blocks ) {
+    if( ( width < 1 ) || ( width > 16 ) || ( blocks < 1 ) || ( blocks > 16 ) ) {
+        return 0;
+    }
+    if( type == PARAM_TABLE_COMB ) {
+        return JCB_COMB_BLOCKS_TBL_SIZE( width, blocks );
+    } else if( ( type == PARAM_TABLE_COMB_WOZ ) && ( width > 1 ) && ( blocks == 1 ) ) {
+        return JCB_COMB_WOZ_TBL_SIZE( width );
+    }
+    return 0;
+}
+
+/**
+ * Returns the size of the table file that param_table_serialize generates.
+ * @param param elliptic curve parameters (with base_point_precomputed_table)
+ * @param type the scalar multiplication the table was computed for
+ * @return the size in bytes, or 0 if the configuration is invalid
+ */
+size_t param_table_file_size( const eccp_parameters_t *param, const param_table_type_t type ) {
+    uint32_t blocks = ( type == PARAM_TABLE_COMB ) ? JCB_COMB_BLOCKS( param ) : 1;
+    uint32_t entries = param_table_entries( type, param->base_point_precomputed_table_width, blocks );
+
+    if( entries == 0 ) {
+        return 0;
+    }
+    return sizeof( param_table_header_t ) + (size_t)entries * sizeof( eccp_point_affine_t );
+}
+
+/**
+ * Writes the pre-computed table of the base point in the versioned table file format.
+ * @param buffer the destination buffer
+ * @param length the length of buffer in bytes
+ * @param param elliptic curve parameters (with a computed base_point_precomputed_table)
+ * @param type the scalar multiplication the table was computed for
+ * @return the number of bytes written, or 0 on error
+ */
+size_t param_table_serialize( uint8_t *buffer, const size_t length, const eccp_parameters_t *param, const param_table_type_t type ) {
+    size_t size = param_table_file_size( param, type );
+    param_table_header_t header;
+
+    if( ( size == 0 ) || ( size > length ) || ( param->base_point_precomputed_table == NULL ) ) {
+        return 0;
+    }
+
+    memset( &header, 0, sizeof( header ) );
+    header.magic = PARAM_TABLE_MAGIC;
+    header.version = PARAM_TABLE_VERSION;
+    header.curve_type = param->curve_type;
+    header.curve_checksum = param_table_curve_checksum( param );
+    header.table_type = type;
+    header.width = param->base_point_precomputed_table_width;
+    header.blocks = ( type == PARAM_TABLE_COMB ) ? JCB_COMB_BLOCKS( param ) : 1;
+    header.montgomery_domain = param->prime_data.montgomery_domain;
+    header.point_size = sizeof( eccp_point_affine_t );
+    header.entries = param_table_entries( type, header.width, header.blocks );
+
+    memcpy( buffer + sizeof( header ), param->base_point_precomputed_table, (size_t)header.entries * header.point_size );
+    header.checksum = param_table_file_checksum( &header, buffer + sizeof( header ) );
+    memcpy( buffer, &header, sizeof( header ) );
+    return size;
+}
+
+/**
+ * Validates a table file and attaches its (read-only) entries as pre-computed
+ * table of the base point. The data is used in-place and must therefore stay
+ * valid and unmodified as long as param uses the table.
+ * @param param elliptic curve parameters (loaded by param_load)
+ * @param data the table file contents (aligned to at least BYTES_PER_WORD)
+ * @param length the length of data in bytes
+ * @param constant_time if 1, eccp_protected_point_multiply_COMB_WOZ is selected as
+ *        eccp_mul_base_point (see param_attach_const_table); COMB tables are rejected
+ * @return 1 if the table was attached, 0 if the data is invalid (param is unchanged)
+ */
+int param_table_attach( eccp_parameters_t *param, const uint8_t *data, const size_t length, const int constant_time ) {
+    const param_table_header_t *header = (const param_table_header_t *)data;
+    uint32_t entries;
+
+    if( ( length < sizeof( param_table_header_t ) ) || ( ( (uintptr_t)data % BYTES_PER_WORD ) != 0 ) ) {
+        return 0;
+    }
+    entries = param_table_entries( (param_table_type_t)header->table_type, header->width, header->blocks );
+    if( ( header->magic != PARAM_TABLE_MAGIC ) || ( header->version != PARAM_TABLE_VERSION ) ||
+        ( header->curve_type != (uint32_t)param->curve_type ) ||
+        ( header->curve_checksum != param_table_curve_checksum( param ) ) ||
+        ( header->montgomery_domain != param->prime_data.montgomery_domain ) ||
+        ( header->point_size != sizeof( eccp_point_affine_t ) ) || ( entries == 0 ) || ( header->entries != entries ) ||
+        ( constant_time && ( header->table_type != PARAM_TABLE_COMB_WOZ ) ) ||
+        ( length < sizeof( param_table_header_t ) + (size_t)entries * sizeof( eccp_point_affine_t ) ) ||
+        ( header->checksum != param_table_file_checksum( header, data + sizeof( param_table_header_t ) ) ) ) {
+        return 0;
+    }
+
+    param->base_point_precomputed_table = (const eccp_point_affine_t *)( data + sizeof( param_table_header_t ) );
+    param->base_point_precomputed_table_width = header->width;
+    param->base_point_precomputed_table_blocks = header->blocks;
+    if( header->table_type == PARAM_TABLE_COMB ) {
+        if( eccp_modified_jacobian_is_preferable( param ) ) {
+            param->eccp_mul_base_point = &eccp_modified_jacobian_point_multiply_COMB;
+        } else {
+            param->eccp_mul_base_point = &eccp_jacobian_point_multiply_COMB;
+        }
+    } else if( constant_time ) {
+        param->eccp_mul_base_point = &eccp_protected_point_multiply_COMB_WOZ;
+    } else {
+        if( eccp_modified_jacobian_is_preferable( param ) ) {
+            param->eccp_mul_base_point = &eccp_modified_jacobian_point_multiply_COMB_WOZ;
+        } else {
+            param->eccp_mul_base_point = &eccp_jacobian_point_multiply_COMB_WOZ;
+        }
+    }
+    return 1;
+}
@@ -0,0 +1,82 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+#ifndef PARAM_TABLE_H_
+#define PARAM_TABLE_H_
+
+#include <stddef.h>
+#include "../types.h"
+
+/** magic number at the beginning of every pre-computed table file ("FLTB") */
+#define PARAM_TABLE_MAGIC 0x42544C46
+/** the version of the table file format */
+#define PARAM_TABLE_VERSION 1
+
+/** the scalar multiplication the stored table is meant for */
+typedef enum _param_table_type_t_ { PARAM_TABLE_COMB = 1, PARAM_TABLE_COMB_WOZ = 2 } param_table_type_t;
+
+/** Header of a pre-computed table file. The table entries (eccp_point_affine_t) directly follow the header. */
+typedef struct _param_table_header_t_ {
+    /** PARAM_TABLE_MAGIC */
+    uint32_t magic;
+    /** PARAM_TABLE_VERSION */
+    uint32_t version;
+    /** the curve_type_t of the curve the table was computed for */
+    uint32_t curve_type;
+    /** checksum of the prime, a, b, and the base point (identifies custom curves) */
+    uint32_t curve_checksum;
+    /** the param_table_type_t */
+    uint32_t table_type;
+    /** base_point_precomputed_table_width */
+    uint32_t width;
+    /** base_point_precomputed_table_blocks */
+    uint32_t blocks;
+    /** whether the entries are stored in Montgomery domain */
+    uint32_t montgomery_domain;
+    /** sizeof( eccp_point_affine_t ) of the generating build */
+    uint32_t point_size;
+    /** the number of table entries */
+    uint32_t entries;
+    /** checksum over the header (with checksum set to 0) and all entries */
+    uint32_t checksum;
+} param_table_header_t;
+
+size_t param_table_file_size( const eccp_parameters_t *param, const param_table_type_t type );
+size_t param_table_serialize( uint8_t *buffer, const size_t length, const eccp_parameters_t *param, const param_table_type_t type );
+int param_table_attach( eccp_parameters_t *param, const uint8_t *data, const size_t length, const int constant_time );
+
+#endif /* PARAM_TABLE_H_ */
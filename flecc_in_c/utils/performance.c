@@ -39,10 +39,30 @@
 #include "rand.h"
 #include "bi/bi_gen.h"
 #include "gfp/gfp.h"
+#include "../protocols/ecdh.h"
+#include "../protocols/ecdsa.h"
+#include "../protocols/eckeygen.h"
+#include "../hash/sha1.h"
+#include "../hash/sha2.h"
+#include "../arch/x64/hash/sha_ni.h"
+#include "../arch/x64/hash/sha256_mb.h"
 #include <stdio.h>
 #include <math.h>
+#include <time.h>
 
 #define NUM_ITERATIONS 1000
+/** the largest comb width measured by performance_test_eccp_comb */
+#define PERF_COMB_MAX_WIDTH 8
+/** the largest number of comb blocks measured by performance_test_eccp_comb */
+#define PERF_COMB_MAX_BLOCKS 4
+/** the number of peers measured by performance_test_ecdh for ecdh_phase_two_batch */
+#define PERF_ECDH_BATCH_PEERS 256
+/** the size of the buffer hashed (repeatedly for longer messages) by performance_test_hash */
+#define PERF_HASH_BUFFER_BYTES 65536
+/** the number of bytes hashed per message length by performance_test_hash (at least one message) */
+#define PERF_HASH_TOTAL_BYTES ( 16L << 20 )
+/** the number of messages per hash_sha256_multi call of performance_test_sha256_multi */
+#define PERF_HASH_MULTI_COUNT 1024
 
 /**
  * Platform dependent function that returns a cycle counter
@@ -136,3 +156,462 @@ void performance_test_gfp_mul(eccp_parameters_t *param) {
 #endif
     performance_print_statistics(runtime);
 }
+
+/**
+ * measures param->eccp_mul_base_point with random scalars and prints the statistics
+ */
+static void performance_test_eccp_mul_base_point(eccp_parameters_t *param) {
+    eccp_point_affine_t point;
+    gfp_t scalar;
+    unsigned long runtime[NUM_ITERATIONS];
+    int run_number;
+    unsigned long start_time, stop_time;
+
+    for(run_number = 0; run_number < NUM_ITERATIONS; run_number++) {
+        do {
+            gfp_rand(scalar, &param->order_n_data);
+            bigint_set_bit_var(scalar, param->order_n_data.bits-1, 1, param->order_n_data.words);
+        } while(bigint_compare_var(scalar, param->order_n_data.prime, param->order_n_data.words) >= 0);
+        start_time = perf_get_cycle_counter();
+        param->eccp_mul_base_point(&point, scalar, param);
+        stop_time = perf_get_cycle_counter();
+        runtime[run_number] = stop_time - start_time;
+    }
+    performance_print_statistics(runtime);
+}
+
+/**
+ * checks the performance of the fixed-base comb multiplication for
+ * several table widths and block counts (Lim-Lee), with the table stored
+ * as eccp_point_affine_t and packed to the word size of the curve
+ */
+void performance_test_eccp_comb(eccp_parameters_t *param) {
+    static eccp_point_affine_t table[JCB_COMB_BLOCKS_TBL_SIZE(PERF_COMB_MAX_WIDTH, PERF_COMB_MAX_BLOCKS)];
+    static uint_t table_packed[JCB_COMB_BLOCKS_TBL_SIZE(PERF_COMB_MAX_WIDTH, PERF_COMB_MAX_BLOCKS) * 2 * WORDS_PER_GFP];
+    const eccp_point_affine_t *saved_table = param->base_point_precomputed_table;
+    const uint_t *saved_table_packed = param->base_point_precomputed_table_packed;
+    uint_t saved_width = param->base_point_precomputed_table_width;
+    uint_t saved_blocks = param->base_point_precomputed_table_blocks;
+    eccp_mul_const_t saved_mul_base_point = param->eccp_mul_base_point;
+    int width, blocks, comb_param_e, tbl_size;
+
+    for(width = 2; width <= PERF_COMB_MAX_WIDTH; width++) {
+        for(blocks = 1; blocks <= PERF_COMB_MAX_BLOCKS; blocks <<= 1) {
+            param->base_point_precomputed_table_width = width;
+            param->base_point_precomputed_table_blocks = blocks;
+            eccp_jacobian_point_multiply_COMB_precompute(param, table);
+            comb_param_e = (param->order_n_data.bits - 1) / (width * blocks) + 1;
+            tbl_size = JCB_COMB_BLOCKS_TBL_SIZE(width, blocks);
+
+            printf("width(%d) blocks(%d) doublings(%d) table(%lu bytes): ", width, blocks, comb_param_e,
+                   (unsigned long)(tbl_size * sizeof(eccp_point_affine_t)));
+            performance_test_eccp_mul_base_point(param);
+
+            eccp_jacobian_point_multiply_COMB_pack_table(param, table_packed);
+            printf("width(%d) blocks(%d) doublings(%d) packed table(%lu bytes): ", width, blocks, comb_param_e,
+                   (unsigned long)(tbl_size * ECCP_PACKED_POINT_WORDS(param) * sizeof(uint_t)));
+            performance_test_eccp_mul_base_point(param);
+        }
+    }
+
+    param->base_point_precomputed_table = saved_table;
+    param->base_point_precomputed_table_packed = saved_table_packed;
+    param->base_point_precomputed_table_width = saved_width;
+    param->base_point_precomputed_table_blocks = saved_blocks;
+    param->eccp_mul_base_point = saved_mul_base_point;
+}
+
+/**
+ * Measures the runtime of a fixed-base multiplication for a fixed scalar
+ * (class 0) and random scalars (class 1) in random order and prints Welch's
+ * t-statistic of both classes. |t| > 4.5 indicates a data-dependent runtime.
+ * @param param elliptic curve parameters (with pre-computation table)
+ * @param mul the fixed-base multiplication to measure
+ */
+static void performance_test_timing_variance(eccp_parameters_t *param, eccp_mul_const_t mul) {
+    eccp_point_affine_t point;
+    gfp_t scalar, fixed_scalar;
+    unsigned long runtime;
+    double sum[2] = {0.0, 0.0}, sum_sq[2] = {0.0, 0.0}, mean[2], var[2];
+    int count[2] = {0, 0};
+    int run_number, class, bit;
+    int width = param->base_point_precomputed_table_width;
+    int comb_param_d = (param->order_n_data.bits - 1) / width + 1;
+    unsigned long start_time, stop_time;
+
+    // all bits of the top comb row set (never negates a table entry), all other bits cleared
+    bigint_clear_var(fixed_scalar, param->order_n_data.words);
+    for(bit = comb_param_d*(width-1); bit < (int)param->order_n_data.bits-1; bit++) {
+        bigint_set_bit_var(fixed_scalar, bit, 1, param->order_n_data.words);
+    }
+    bigint_set_bit_var(fixed_scalar, 0, 1, param->order_n_data.words);
+
+    for(run_number = 0; run_number < 2*NUM_ITERATIONS; run_number++) {
+        gfp_rand(scalar, &param->order_n_data);
+        class = scalar[0] & 1;
+        if(class == 0) {
+            bigint_copy_var(scalar, fixed_scalar, param->order_n_data.words);
+        } else {
+            do {
+                gfp_rand(scalar, &param->order_n_data);
+            } while(bigint_compare_var(scalar, param->order_n_data.prime, param->order_n_data.words) >= 0);
+        }
+        start_time = perf_get_cycle_counter();
+        mul(&point, scalar, param);
+        stop_time = perf_get_cycle_counter();
+        runtime = stop_time - start_time;
+
+        sum[class] += (double)runtime;
+        sum_sq[class] += (double)runtime * (double)runtime;
+        count[class]++;
+    }
+
+    for(class = 0; class < 2; class++) {
+        mean[class] = sum[class] / count[class];
+        var[class] = (sum_sq[class] - sum[class] * mean[class]) / (count[class] - 1);
+    }
+    printf("fixed avg(%.2f) random avg(%.2f) t(%.2f)\n", mean[0], mean[1],
+           (mean[0] - mean[1]) / sqrt(var[0] / count[0] + var[1] / count[1]));
+}
+
+/**
+ * compares the timing variance of the COMB_WOZ multiplication and its
+ * constant-time variant eccp_protected_point_multiply_COMB_WOZ
+ */
+void performance_test_eccp_comb_timing(eccp_parameters_t *param) {
+    static eccp_point_affine_t table[JCB_COMB_WOZ_TBL_SIZE(PERF_COMB_MAX_WIDTH)];
+    const eccp_point_affine_t *saved_table = param->base_point_precomputed_table;
+    uint_t saved_width = param->base_point_precomputed_table_width;
+    uint_t saved_blocks = param->base_point_precomputed_table_blocks;
+    eccp_mul_const_t saved_mul_base_point = param->eccp_mul_base_point;
+
+    param->base_point_precomputed_table_width = 5;
+    param->base_point_precomputed_table_blocks = 1;
+    eccp_jacobian_point_multiply_COMB_WOZ_precompute(param, table, 0);
+
+    printf("eccp_jacobian_point_multiply_COMB_WOZ: ");
+    performance_test_timing_variance(param, &eccp_jacobian_point_multiply_COMB_WOZ);
+    printf("eccp_protected_point_multiply_COMB_WOZ: ");
+    performance_test_timing_variance(param, &eccp_protected_point_multiply_COMB_WOZ);
+
+    param->base_point_precomputed_table = saved_table;
+    param->base_point_precomputed_table_width = saved_width;
+    param->base_point_precomputed_table_blocks = saved_blocks;
+    param->eccp_mul_base_point = saved_mul_base_point;
+}
+
+/**
+ * measures one ECDH shared-secret derivation per run with random scalars
+ * @param param elliptic curve parameters
+ * @param peer the public key of the other party (normal domain)
+ * @param variant 0: ecdh_phase_two, 1: ecdh_phase_two_x_only, 2: ecdh_phase_two_x_only without y
+ */
+static void performance_test_ecdh_variant(eccp_parameters_t *param, const eccp_point_affine_t *peer, int variant) {
+    eccp_point_affine_t point, shared;
+    uint8_t shared_secret[BYTES_PER_GFP];
+    gfp_t scalar;
+    unsigned long runtime[NUM_ITERATIONS];
+    int run_number;
+    unsigned long start_time, stop_time;
+
+    for(run_number = 0; run_number < NUM_ITERATIONS; run_number++) {
+        do {
+            gfp_rand(scalar, &param->order_n_data);
+        } while(bigint_compare_var(scalar, param->order_n_data.prime, param->order_n_data.words) >= 0
+                || bigint_is_zero_var(scalar, param->order_n_data.words));
+        eccp_affine_point_copy(&point, peer, param);
+        start_time = perf_get_cycle_counter();
+        if(variant == 0) {
+            ecdh_phase_two(&shared, scalar, &point, param);
+        } else {
+            ecdh_phase_two_x_only(shared_secret, scalar, point.x, (variant == 1) ? point.y : NULL, param);
+        }
+        stop_time = perf_get_cycle_counter();
+        runtime[run_number] = stop_time - start_time;
+    }
+    performance_print_statistics(runtime);
+}
+
+/**
+ * compares the runtime of the second ECDH phase computing the whole shared
+ * point with the x-only variant (with and without the y coordinate of the peer)
+ * and the average cost per peer of ecdh_phase_two and ecdh_phase_two_batch on
+ * the same random peers
+ */
+void performance_test_ecdh(eccp_parameters_t *param) {
+    static eccp_point_affine_t peers[PERF_ECDH_BATCH_PEERS];
+    static eccp_point_affine_t shared[PERF_ECDH_BATCH_PEERS];
+    eccp_point_affine_t peer;
+    gfp_t scalar;
+    int run_number;
+    unsigned long start_time, stop_time, total_time;
+
+    // a random peer, the base point would take the fixed-base comb shortcut of ecdh_phase_two
+    gfp_rand(scalar, &param->order_n_data);
+    eccp_generic_mul_wrapper(&peer, &param->base_point, scalar, param);
+    if(param->prime_data.montgomery_domain == 1) {
+        gfp_montgomery_to_normal(peer.x, peer.x, &param->prime_data);
+        gfp_montgomery_to_normal(peer.y, peer.y, &param->prime_data);
+    }
+
+    printf("ecdh_phase_two: ");
+    performance_test_ecdh_variant(param, &peer, 0);
+    printf("ecdh_phase_two_x_only: ");
+    performance_test_ecdh_variant(param, &peer, 1);
+    printf("ecdh_phase_two_x_only (no y): ");
+    performance_test_ecdh_variant(param, &peer, 2);
+
+    for(run_number = 0; run_number < PERF_ECDH_BATCH_PEERS; run_number++) {
+        gfp_rand(scalar, &param->order_n_data);
+        eccp_generic_mul_wrapper(&peers[run_number], &param->base_point, scalar, param);
+        if(param->prime_data.montgomery_domain == 1) {
+            gfp_montgomery_to_normal(peers[run_number].x, peers[run_number].x, &param->prime_data);
+            gfp_montgomery_to_normal(peers[run_number].y, peers[run_number].y, &param->prime_data);
+        }
+    }
+    do {
+        gfp_rand(scalar, &param->order_n_data);
+    } while(bigint_compare_var(scalar, param->order_n_data.prime, param->order_n_data.words) >= 0);
+    // the generic ecdh_phase_two on the same peers and scalar for comparison
+    total_time = 0;
+    for(run_number = 0; run_number < PERF_ECDH_BATCH_PEERS; run_number++) {
+        eccp_affine_point_copy(&peer, &peers[run_number], param);
+        start_time = perf_get_cycle_counter();
+        ecdh_phase_two(&shared[run_number], scalar, &peer, param);
+        stop_time = perf_get_cycle_counter();
+        total_time += stop_time - start_time;
+    }
+    printf("ecdh_phase_two (same peers): avg(%.2f) per peer\n", (double)total_time / PERF_ECDH_BATCH_PEERS);
+    start_time = perf_get_cycle_counter();
+    ecdh_phase_two_batch(shared, scalar, peers, PERF_ECDH_BATCH_PEERS, param);
+    stop_time = perf_get_cycle_counter();
+    printf("ecdh_phase_two_batch: avg(%.2f) per peer\n", (double)(stop_time - start_time) / PERF_ECDH_BATCH_PEERS);
+}
+
+/**
+ * compares the runtime of ecdsa_sign with the online phase of
+ * ecdsa_sign_with_pool (the pool is refilled outside of the measurement)
+ * and the average cost per signature of ecdsa_sign_batch
+ */
+void performance_test_ecdsa_sign(eccp_parameters_t *param) {
+    static ecdsa_nonce_t nonces[NUM_ITERATIONS];
+    static ecdsa_signature_t signatures[NUM_ITERATIONS];
+    static gfp_t hashes[NUM_ITERATIONS];
+    ecdsa_nonce_pool_t pool;
+    ecdsa_signature_t signature;
+    gfp_t hash, private_key;
+    unsigned long runtime[NUM_ITERATIONS];
+    int run_number;
+    unsigned long start_time, stop_time;
+
+    gfp_rand(private_key, &param->order_n_data);
+    gfp_rand(hash, &param->order_n_data);
+
+    for(run_number = 0; run_number < NUM_ITERATIONS; run_number++) {
+        start_time = perf_get_cycle_counter();
+        ecdsa_sign(&signature, hash, private_key, param);
+        stop_time = perf_get_cycle_counter();
+        runtime[run_number] = stop_time - start_time;
+    }
+    printf("ecdsa_sign: ");
+    performance_print_statistics(runtime);
+
+    ecdsa_nonce_pool_init(&pool, nonces, NUM_ITERATIONS, 0);
+    start_time = perf_get_cycle_counter();
+    ecdsa_nonce_pool_refill(&pool, NUM_ITERATIONS, param);
+    stop_time = perf_get_cycle_counter();
+    printf("ecdsa_nonce_pool_refill: avg(%.2f) per nonce\n", (double)(stop_time - start_time) / NUM_ITERATIONS);
+
+    for(run_number = 0; run_number < NUM_ITERATIONS; run_number++) {
+        start_time = perf_get_cycle_counter();
+        ecdsa_sign_with_pool(&signature, hash, private_key, &pool, param);
+        stop_time = perf_get_cycle_counter();
+        runtime[run_number] = stop_time - start_time;
+    }
+    printf("ecdsa_sign_with_pool: ");
+    performance_print_statistics(runtime);
+
+    for(run_number = 0; run_number < NUM_ITERATIONS; run_number++) {
+        gfp_rand(hashes[run_number], &param->order_n_data);
+    }
+    start_time = perf_get_cycle_counter();
+    ecdsa_sign_batch(signatures, (const gfp_t *)hashes, NUM_ITERATIONS, private_key, param);
+    stop_time = perf_get_cycle_counter();
+    printf("ecdsa_sign_batch: avg(%.2f) per signature\n", (double)(stop_time - start_time) / NUM_ITERATIONS);
+}
+
+/**
+ * compares the runtime of the key pair generation with eckeygen and
+ * the average cost per key pair of eckeygen_batch
+ */
+void performance_test_eckeygen(eccp_parameters_t *param) {
+    static gfp_t private_keys[NUM_ITERATIONS];
+    static eccp_point_affine_t public_keys[NUM_ITERATIONS];
+    gfp_t private_key;
+    eccp_point_affine_t public_key;
+    unsigned long runtime[NUM_ITERATIONS];
+    int run_number;
+    unsigned long start_time, stop_time;
+
+    for(run_number = 0; run_number < NUM_ITERATIONS; run_number++) {
+        start_time = perf_get_cycle_counter();
+        eckeygen(private_key, &public_key, param);
+        stop_time = perf_get_cycle_counter();
+        runtime[run_number] = stop_time - start_time;
+    }
+    printf("eckeygen: ");
+    performance_print_statistics(runtime);
+
+    start_time = perf_get_cycle_counter();
+    eckeygen_batch(private_keys, public_keys, NUM_ITERATIONS, param);
+    stop_time = perf_get_cycle_counter();
+    printf("eckeygen_batch: avg(%.2f) per key pair\n", (double)(stop_time - start_time) / NUM_ITERATIONS);
+}
+
+/** hashes a message of the given length (see performance_test_hash) */
+typedef void (*perf_hash_t)(const uint8_t *buffer, const long length);
+
+/**
+ * hashes length bytes with SHA1; messages longer than PERF_HASH_BUFFER_BYTES
+ * consist of repetitions of buffer and are processed block by block
+ */
+static void performance_hash_sha1(const uint8_t *buffer, const long length) {
+    hash_sha1_t state;
+    long offset;
+
+    hash_sha1_init(&state);
+    for(offset = 0; offset + PERF_HASH_BUFFER_BYTES < length; offset += 64) {
+        hash_sha1_update(&state, buffer + offset % PERF_HASH_BUFFER_BYTES);
+    }
+    hash_sha1_final(&state, buffer, length - offset, length);
+}
+
+/**
+ * hashes length bytes with SHA256 (see performance_hash_sha1)
+ */
+static void performance_hash_sha256(const uint8_t *buffer, const long length) {
+    hash_sha224_256_t state;
+    long offset;
+
+    hash_sha256_init(&state);
+    for(offset = 0; offset + PERF_HASH_BUFFER_BYTES < length; offset += 64) {
+        hash_sha2_update(&state, buffer + offset % PERF_HASH_BUFFER_BYTES);
+    }
+    hash_sha2_final(&state, buffer, length - offset, length);
+}
+
+/**
+ * hashes length bytes with SHA512 (see performance_hash_sha1)
+ */
+static void performance_hash_sha512(const uint8_t *buffer, const long length) {
+    hash_sha384_512_t state;
+    long offset;
+
+    hash_sha512_init(&state);
+    for(offset = 0; offset + PERF_HASH_BUFFER_BYTES < length; offset += 128) {
+        hash_sha512_update(&state, buffer + offset % PERF_HASH_BUFFER_BYTES);
+    }
+    hash_sha512_final(&state, buffer, length - offset, length);
+}
+
+/**
+ * prints cycles/byte and MB/s of a hash function for message lengths from 64 B to 64 MB
+ */
+static void performance_test_hash_function(const char *name, perf_hash_t hash, const uint8_t *buffer) {
+    long length, runs, run_number;
+    unsigned long start_time, stop_time;
+    clock_t start_clock, stop_clock;
+    double bytes, seconds;
+
+    printf("%s:", name);
+    for(length = 64; length <= (64L << 20); length <<= 4) {
+        runs = PERF_HASH_TOTAL_BYTES / length;
+        if(runs < 1) {
+            runs = 1;
+        }
+        start_clock = clock();
+        start_time = perf_get_cycle_counter();
+        for(run_number = 0; run_number < runs; run_number++) {
+            hash(buffer, length);
+        }
+        stop_time = perf_get_cycle_counter();
+        stop_clock = clock();
+
+        bytes = (double)length * runs;
+        seconds = (double)(stop_clock - start_clock) / CLOCKS_PER_SEC;
+        printf(" %ldB(%.2f cycles/byte", length, (double)(stop_time - start_time) / bytes);
+        if(seconds > 0.0) {
+            printf(" %.2f MB/s", bytes / seconds / 1e6);
+        }
+        printf(")");
+    }
+    printf("\n");
+}
+
+/**
+ * measures the throughput of SHA1, SHA256, and SHA512 (SHA224, SHA384, and
+ * SHA512/256 only differ in the initialization vector and the length of the
+ * output) for message lengths from 64 B to 64 MB
+ */
+void performance_test_hash(void) {
+    static uint8_t buffer[PERF_HASH_BUFFER_BYTES];
+    int i;
+
+    for(i = 0; i < PERF_HASH_BUFFER_BYTES; i++) {
+        buffer[i] = (uint8_t)i;
+    }
+#if HASH_SHA_NI_AVAILABLE
+    printf("SHA extension: %s\n", hash_sha_ni_is_supported() ? "used" : "not used");
+#endif
+    performance_test_hash_function("sha1", &performance_hash_sha1, buffer);
+    performance_test_hash_function("sha256", &performance_hash_sha256, buffer);
+    performance_test_hash_function("sha512", &performance_hash_sha512, buffer);
+}
+
+/**
+ * measures hash_sha256_multi against hashing the same PERF_HASH_MULTI_COUNT
+ * messages one at a time, for message lengths of 64 B, 256 B, and 1 KB
+ */
+void performance_test_sha256_multi(void) {
+    static uint8_t buffer[PERF_HASH_BUFFER_BYTES];
+    static hash_sha224_256_t digests[PERF_HASH_MULTI_COUNT];
+    static const uint8_t *messages[PERF_HASH_MULTI_COUNT];
+    static int lengths[PERF_HASH_MULTI_COUNT];
+    unsigned long start_time, single_time, multi_time;
+    long runs, run_number, length;
+    double bytes;
+    int i;
+
+    for(i = 0; i < PERF_HASH_BUFFER_BYTES; i++) {
+        buffer[i] = (uint8_t)i;
+    }
+#if HASH_SHA256_MB_AVAILABLE
+    printf("multi-buffer lanes: %d\n", hash_sha256_mb_lanes());
+#endif
+    for(length = 64; length <= 1024; length <<= 2) {
+        for(i = 0; i < PERF_HASH_MULTI_COUNT; i++) {
+            messages[i] = buffer + (i * length) % (PERF_HASH_BUFFER_BYTES - length);
+            lengths[i] = length;
+        }
+        runs = PERF_HASH_TOTAL_BYTES / (PERF_HASH_MULTI_COUNT * length);
+        bytes = (double)runs * PERF_HASH_MULTI_COUNT * length;
+
+        start_time = perf_get_cycle_counter();
+        for(run_number = 0; run_number < runs; run_number++) {
+            for(i = 0; i < PERF_HASH_MULTI_COUNT; i++) {
+                hash_sha256_init(&digests[i]);
+                hash_sha2_final(&digests[i], messages[i], lengths[i], lengths[i]);
+            }
+        }
+        single_time = perf_get_cycle_counter() - start_time;
+
+        start_time = perf_get_cycle_counter();
+        for(run_number = 0; run_number < runs; run_number++) {
+            hash_sha256_multi(digests, messages, lengths, PERF_HASH_MULTI_COUNT);
+        }
+        multi_time = perf_get_cycle_counter() - start_time;
+
+        printf("sha256 %ldB: single %.2f cycles/byte, multi %.2f cycles/byte\n", length,
+               (double)single_time / bytes, (double)multi_time / bytes);
+    }
+}
@@ -46,6 +46,13 @@ extern "C" {
 
 void performance_test_eccp_mul(eccp_parameters_t *param);
 void performance_test_gfp_mul(eccp_parameters_t *param);
+void performance_test_eccp_comb(eccp_parameters_t *param);
+void performance_test_eccp_comb_timing(eccp_parameters_t *param);
+void performance_test_ecdh(eccp_parameters_t *param);
+void performance_test_ecdsa_sign(eccp_parameters_t *param);
+void performance_test_eckeygen(eccp_parameters_t *param);
+void performance_test_hash(void);
+void performance_test_sha256_multi(void);
 
 
 #ifdef	__cplusplus
@@ -39,16 +39,67 @@
 #include "rand.h"
 #include "../bi/bi.h"
 
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <unistd.h>
+#if defined( __APPLE__ )
+#include <sys/random.h>
+#endif
+#endif
+
+/** the maximum number of bytes requested from getentropy at once */
+#define RAND_ENTROPY_MAX_BYTES 256
+/** the maximum number of numbers gfp_rand_multiple draws entropy for at once */
+#define RAND_MULTIPLE_MAX_COUNT 16
+
 /**
- * Use the deterministic rand() function to initialize dest with random data
- * @param dest
+ * Fills dest with deterministic pseudo random data (xorshift32). The whole
+ * state of the generator is kept in state, so independent generators may be
+ * used concurrently.
+ * @param dest the destination
  * @param length the number of words to generate
+ * @param state the state of the generator (must not be zero, is updated)
  */
-void bigint_rand_insecure_var( uint_t *dest, const int length ) {
+void bigint_rand_insecure_var( uint_t *dest, const int length, uint_t *state ) {
+    uint_t x = *state;
+    int word;
+    for( word = 0; word < length; word++ ) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        *dest++ = x;
+    }
+    *state = x;
+}
+
+/**
+ * Fills dest with random data of the operating system (getentropy), which
+ * keeps no state within the library and is safe to be called from several
+ * threads. Aborts if the operating system provides no entropy.
+ * Platforms without such a source fall back to rand(), which is neither
+ * secure nor thread-safe.
+ * @param dest the destination
+ * @param length the number of words to generate
+ */
+void bigint_rand_secure_var( uint_t *dest, const int length ) {
+#if defined( __unix__ ) || defined( __APPLE__ )
+    uint8_t *bytes = (uint8_t *)dest;
+    int remaining = length * BYTES_PER_WORD;
+    int chunk;
+
+    while( remaining > 0 ) {
+        chunk = ( remaining < RAND_ENTROPY_MAX_BYTES ) ? remaining : RAND_ENTROPY_MAX_BYTES;
+        if( getentropy( bytes, chunk ) != 0 ) {
+            abort();
+        }
+        bytes += chunk;
+        remaining -= chunk;
+    }
+#else
     int word;
     for( word = 0; word < length; word++ ) {
         *dest++ = rand();
     }
+#endif
 }
 
 /**
@@ -65,10 +116,46 @@ void gfp_rand( gfp_t dest, const gfp_prime_data_t *prime_data ) {
     else
         mask = ( 1 << msb ) - 1;
     do {
-        // TODO: to be replaced with an external library or something more secure
-        bigint_rand_insecure_var( dest, prime_data->words );
+        bigint_rand_secure_var( dest, prime_data->words );
         /* speedup of this loop */
         dest[prime_data->words - 1] &= mask;
     } while( ( bigint_compare_var( dest, prime_data->prime, prime_data->words ) >= 0 )
-             && ( bigint_is_zero_var( dest, prime_data->words ) == 0 ) );
+             || ( bigint_is_zero_var( dest, prime_data->words ) == 1 ) );
+}
+
+/**
+ * Generate several numbers that are *smaller* than the given prime and larger
+ * than 0. The entropy of up to RAND_MULTIPLE_MAX_COUNT numbers is requested
+ * at once; numbers out of range are drawn again with gfp_rand.
+ * @param dest       the numbers to generate (count entries)
+ * @param count      the number of numbers
+ * @param prime_data the upper bound
+ */
+void gfp_rand_multiple( gfp_t *dest, const int count, const gfp_prime_data_t *prime_data ) {
+    uint_t entropy[RAND_MULTIPLE_MAX_COUNT * WORDS_PER_GFP];
+    int msb, offset, batch, i;
+    uint_t mask;
+
+    msb = prime_data->bits & ( BITS_PER_WORD - 1 );
+    if( msb == 0 )
+        mask = UINT_T_MAX;
+    else
+        mask = ( 1 << msb ) - 1;
+
+    for( offset = 0; offset < count; offset += batch ) {
+        batch = count - offset;
+        if( batch > RAND_MULTIPLE_MAX_COUNT ) {
+            batch = RAND_MULTIPLE_MAX_COUNT;
+        }
+        bigint_rand_secure_var( entropy, batch * prime_data->words );
+        for( i = 0; i < batch; i++ ) {
+            bigint_copy_var( dest[offset + i], entropy + i * prime_data->words, prime_data->words );
+            dest[offset + i][prime_data->words - 1] &= mask;
+            if( ( bigint_compare_var( dest[offset + i], prime_data->prime, prime_data->words ) >= 0 )
+                || ( bigint_is_zero_var( dest[offset + i], prime_data->words ) == 1 ) ) {
+                gfp_rand( dest[offset + i], prime_data );
+            }
+        }
+    }
+    bigint_clear_var( entropy, RAND_MULTIPLE_MAX_COUNT * WORDS_PER_GFP );
 }
@@ -43,12 +43,9 @@
 void bigint_rand_fipsXXX_set_seed( uint_t *seed, const int length );
 void bigint_rand_fipsXXX( uint_t *dest, const int length );
 
-void bigint_rand_insecure_var( uint_t *dest, const int length );
-
-/**
- * Writes a (pseudo) random integer string. Should use external entropy.
- */
+void bigint_rand_insecure_var( uint_t *dest, const int length, uint_t *state );
 void bigint_rand_secure_var( uint_t *dest, const int length );
 void gfp_rand( gfp_t dest, const gfp_prime_data_t *prime_data );
+void gfp_rand_multiple( gfp_t *dest, const int count, const gfp_prime_data_t *prime_data );
 
 #endif /* RAND_H_ */
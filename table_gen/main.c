@@ -0,0 +1,126 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <flecc_in_c/types.h>
+#include <flecc_in_c/eccp/eccp.h>
+#include <flecc_in_c/utils/param.h>
+
+/** the curves for which comb tables are generated */
+static const curve_type_t table_gen_curves[] = { SECP192R1, SECP224R1, SECP256R1, SECP384R1, SECP521R1 };
+/** the curve names (prefix of the generated symbols) */
+static const char *table_gen_curve_names[] = { "SECP192R1", "SECP224R1", "SECP256R1", "SECP384R1", "SECP521R1" };
+/** the comb widths for which tables are generated */
+static const int table_gen_widths[] = { 4, 5, 6 };
+/** the largest generated comb width */
+#define TABLE_GEN_MAX_WIDTH 6
+
+/**
+ * Prints a GF(p) element as C array initializer.
+ * @param value the element to print
+ * @param words the number of words to print
+ */
+void table_gen_print_gfp( const gfp_t value, const int words ) {
+    int i;
+    printf( "{" );
+    for( i = 0; i < words; i++ ) {
+        printf( "0x%08X%s", value[i], ( i < words - 1 ) ? ", " : "" );
+    }
+    printf( "}" );
+}
+
+/**
+ * Prints the COMB_WOZ table of the given curve and width as const array.
+ * @param param elliptic curve parameters
+ * @param name the name of the curve
+ * @param width the comb width
+ */
+void table_gen_print_comb_woz( eccp_parameters_t *param, const char *name, const int width ) {
+    eccp_point_affine_t table[JCB_COMB_WOZ_TBL_SIZE( TABLE_GEN_MAX_WIDTH )];
+    int tbl_size = JCB_COMB_WOZ_TBL_SIZE( width );
+    int i;
+
+    param->base_point_precomputed_table_width = width;
+    param->base_point_precomputed_table_blocks = 1;
+    eccp_jacobian_point_multiply_COMB_WOZ_precompute( param, table, 0 );
+
+    printf( "const eccp_point_affine_t %s_COMB_WOZ_W%d[%d] = {\n", name, width, tbl_size );
+    for( i = 0; i < tbl_size; i++ ) {
+        printf( "    {" );
+        table_gen_print_gfp( table[i].x, param->prime_data.words );
+        printf( ", " );
+        table_gen_print_gfp( table[i].y, param->prime_data.words );
+        printf( ", %d}%s\n", table[i].identity, ( i < tbl_size - 1 ) ? "," : "" );
+    }
+    printf( "};\n" );
+}
+
+/**
+ * Generates flecc_in_c/utils/param_const_tables.c, which contains the
+ * pre-computed COMB_WOZ tables (Montgomery domain) of the standard curves.
+ * Usage (from the source directory): table_gen > flecc_in_c/utils/param_const_tables.c
+ */
+int main( void ) {
+    eccp_parameters_t param;
+    int curve, width;
+    FILE *license = fopen( "flecc_in_c/types.h", "r" );
+    char line[128];
+    int line_cnt = 0;
+
+    // reuse the license header of the library
+    if( license != NULL ) {
+        while( ( line_cnt < 36 ) && ( fgets( line, sizeof( line ), license ) != NULL ) ) {
+            fputs( line, stdout );
+            line_cnt++;
+        }
+        fclose( license );
+        printf( "\n" );
+    }
+    printf( "/* generated by table_gen - do not edit */\n\n" );
+    printf( "#include \"../types.h\"\n" );
+
+    for( curve = 0; curve < (int)( sizeof( table_gen_curves ) / sizeof( table_gen_curves[0] ) ); curve++ ) {
+        param_load( &param, table_gen_curves[curve] );
+        for( width = 0; width < (int)( sizeof( table_gen_widths ) / sizeof( table_gen_widths[0] ) ); width++ ) {
+            printf( "\n" );
+            table_gen_print_comb_woz( &param, table_gen_curve_names[curve], table_gen_widths[width] );
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -31,6 +31,10 @@ void init_param_itsec2012_30(eccp_parameters_t *param) {
     param->eccp_mul_base_point = NULL;
     param->base_point_precomputed_table = NULL;
     param->base_point_precomputed_table_width = 0;
+    param->base_point_precomputed_table_blocks = 1;
+    param->base_point_precomputed_table_packed = NULL;
+    param->fixed_points = NULL;
+    param->fixed_points_capacity = 0;
     
     // set prime data
     param->prime_data.bits = 30;
@@ -43,10 +43,13 @@
  */
 
 #include <stdio.h>
+#include <unistd.h>
 #include <flecc_in_c/io/io.h>
 #include <flecc_in_c/bi/bi.h>
 #include <flecc_in_c/gfp/gfp.h>
 #include <flecc_in_c/utils/param.h>
+#include <flecc_in_c/utils/param_table.h>
+#include <flecc_in_c/arch/posix/utils/param_mmap.h>
 #include <flecc_in_c/utils/assert.h>
 #include <flecc_in_c/utils/performance.h>
 #include <flecc_in_c/eccp/eccp.h>
@@ -54,6 +57,8 @@
 #include <flecc_in_c/protocols/protocols.h>
 #include <flecc_in_c/hash/sha1.h>
 #include <flecc_in_c/hash/sha2.h>
+#include <flecc_in_c/hash/hmac.h>
+#include "test_threads.h"
 
 //#define READ_BUFFER_SIZE 4*BYTES_PER_GFP+2*WORDS_PER_GFP+10
 #define READ_BUFFER_SIZE 10000
@@ -219,6 +224,12 @@ void read_elliptic_curve_parameters (char *buffer, const int buf_length, eccp_pa
     param->eccp_mul_base_point = NULL;
     param->base_point_precomputed_table = NULL;
     param->base_point_precomputed_table_width = 0;
+    param->base_point_precomputed_table_blocks = 1;
+    param->base_point_precomputed_table_packed = NULL;
+    param->base_point_table_mapping = NULL;
+    param->base_point_table_mapping_length = 0;
+    param->fixed_points = NULL;
+    param->fixed_points_capacity = 0;
 }
 
 /**
@@ -241,6 +252,24 @@ void extract_test_id( char *test_id, const int id_length, const char *buffer ) {
 }
 
 #define TBL_WIDTH 5
+/** the number of nonces used by the ecdsa_sign_with_pool test command */
+#define NONCE_POOL_SIZE 5
+/** the maximum number of peers of the ecdh_phase_two_batch test command */
+#define ECDH_TEST_MAX_PEERS 40
+/** the maximum number of hashes of the ecdsa_sign_batch test command */
+#define SIGN_BATCH_MAX_SIZE 40
+/** the maximum comb table size supported by the eccp_comb_precompute test command */
+#define TBL_MAX_SIZE JCB_COMB_BLOCKS_TBL_SIZE(6, 4)
+/** the maximum number of points per batch of the eccp_batch_* test commands */
+#define BATCH_MAX_SIZE 8
+/** the maximum number of points of the eccp_affine_points_validate_batch test command */
+#define VALIDATE_BATCH_MAX_SIZE 40
+/** the maximum number of messages of the sha256_multi test command */
+#define SHA256_MULTI_MAX_COUNT 80
+/** the maximum message length (in bytes) of the sha256_multi test command */
+#define SHA256_MULTI_MAX_LENGTH 512
+/** temporary file used by the eccp_comb_table_file test command (%ld is the process id, tests may run in parallel) */
+#define TBL_FILE_NAME "eccp_comb_table_%ld.tmp"
 
 /**
  * Reads test cases from the default input stream and executes and verifies them
@@ -268,6 +297,10 @@ unsigned test_ser() {
     eccp_point_projective_t ecproj_var_b;
     eccp_point_projective_t ecproj_var_c;
 
+    eccp_point_modified_jacobian_t ecmjac_var_a;
+    eccp_point_modified_jacobian_t ecmjac_var_b;
+    eccp_point_modified_jacobian_t ecmjac_var_c;
+
     curve_params.curve_type = read_curve_type( buffer, READ_BUFFER_SIZE );
     if(curve_params.curve_type == CUSTOM) {
         read_elliptic_curve_parameters(buffer, READ_BUFFER_SIZE, param);
@@ -276,13 +309,17 @@ unsigned test_ser() {
     }
     length = curve_params.prime_data.words;
 
-    // TODO: BEAUTIFY!!!
-    gfp_opt_3_init(&param->prime_data);
-
-    eccp_point_affine_t comb_table[JCB_COMB_WOZ_TBL_SIZE(TBL_WIDTH)];
-    param->base_point_precomputed_table = comb_table;
-    param->base_point_precomputed_table_width = TBL_WIDTH;
-    eccp_jacobian_point_multiply_COMB_WOZ_precompute(param);
+    eccp_point_affine_t comb_table[TBL_MAX_SIZE];
+    eccp_point_affine_t fixed_point_table[TBL_MAX_SIZE];
+    eccp_fixed_point_t fixed_points[1];
+    uint_t comb_table_packed[TBL_MAX_SIZE * 2 * WORDS_PER_GFP];
+    uint_t batch_buffer[3][ECCP_BATCH_BUFFER_WORDS( BATCH_MAX_SIZE, WORDS_PER_GFP )];
+    eccp_point_batch_t batch_a, batch_b, batch_c;
+    if( param_attach_const_table( param, TBL_WIDTH, 1 ) == 0 ) {
+        param->base_point_precomputed_table_width = TBL_WIDTH;
+        param->base_point_precomputed_table_blocks = 1;
+        eccp_jacobian_point_multiply_COMB_WOZ_precompute(param, comb_table, 1);
+    }
 
     while( 1 ) {
         io_read( buffer, READ_BUFFER_SIZE );
@@ -504,6 +541,72 @@ unsigned test_ser() {
             errors += assert_bigint( test_id, bi_var_expected, curve_params.prime_data.r_squared, length );
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, length );
             errors += assert_integer( test_id, bi_var_expected[0], curve_params.prime_data.n0 );
+        } else if( line_starts_with( buffer, "eccp_batch_add" ) || line_starts_with( buffer, "eccp_batch_double" ) ||
+                   line_starts_with( buffer, "eccp_batch_negate" ) ) {
+
+            int operation = line_starts_with( buffer, "eccp_batch_add" ) ? 0 : ( line_starts_with( buffer, "eccp_batch_double" ) ? 1 : 2 );
+            int count = read_integer( buffer, READ_BUFFER_SIZE );
+            int i;
+            errors += assert_integer( test_id, 1, ( count >= 1 ) && ( count <= BATCH_MAX_SIZE ) );
+            if( ( count < 1 ) || ( count > BATCH_MAX_SIZE ) ) {
+                count = 0;
+            }
+            eccp_batch_init( &batch_a, batch_buffer[0], count, param );
+            eccp_batch_init( &batch_b, batch_buffer[1], count, param );
+            eccp_batch_init( &batch_c, batch_buffer[2], count, param );
+            // the expected results are stored as affine points in batch_c
+            for( i = 0; i < count; i++ ) {
+                read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
+                eccp_batch_set_affine( &batch_a, i, &ecaff_var_a, param );
+                if( operation == 0 ) {
+                    read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_b, &( curve_params.prime_data ), 1 );
+                    eccp_batch_set_affine( &batch_b, i, &ecaff_var_b, param );
+                }
+                read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_expected, &( curve_params.prime_data ), 1 );
+                eccp_batch_set_affine( &batch_c, i, &ecaff_var_expected, param );
+            }
+
+            // use projective inputs (2 * a, 2 * b) for the addition, to cover z != 1
+            if( operation == 0 ) {
+                eccp_batch_double( &batch_a, &batch_a, param );
+                eccp_batch_double( &batch_b, &batch_b, param );
+                eccp_batch_add( &batch_a, &batch_a, &batch_b, param );
+                eccp_batch_double( &batch_c, &batch_c, param );
+            } else if( operation == 1 ) {
+                eccp_batch_double( &batch_a, &batch_a, param );
+            } else {
+                eccp_batch_negate( &batch_a, &batch_a, param );
+            }
+            errors += assert_integer( test_id, 1, eccp_batch_validate( NULL, &batch_a, param ) );
+            eccp_batch_normalize( &batch_a, param );
+            eccp_batch_normalize( &batch_c, param );
+
+            for( i = 0; i < count; i++ ) {
+                errors += assert_integer( test_id, eccp_batch_is_identity( &batch_c, i ), eccp_batch_is_identity( &batch_a, i ) );
+                if( eccp_batch_is_identity( &batch_c, i ) == 0 ) {
+                    errors += assert_bigint( test_id, batch_c.x + i * length, batch_a.x + i * length, length );
+                    errors += assert_bigint( test_id, batch_c.y + i * length, batch_a.y + i * length, length );
+                }
+            }
+        } else if( line_starts_with( buffer, "eccp_affine_point_pack" ) ) {
+
+            uint_t packed[2 * WORDS_PER_GFP];
+            uint_t packed_x[WORDS_PER_GFP], packed_y[WORDS_PER_GFP];
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
+
+            eccp_affine_point_pack( packed, &ecaff_var_a, param );
+            eccp_affine_point_unpack( &ecaff_var_b, packed, param );
+            eccp_affine_points_pack_soa( packed_x, packed_y, &ecaff_var_a, 1, param );
+            eccp_affine_points_unpack_soa( &ecaff_var_c, packed_x, packed_y, 1, param );
+
+            errors += assert_integer( test_id, ecaff_var_a.identity, ecaff_var_b.identity );
+            errors += assert_integer( test_id, ecaff_var_a.identity, ecaff_var_c.identity );
+            if( ecaff_var_a.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_a.x, ecaff_var_b.x, length );
+                errors += assert_bigint( test_id, ecaff_var_a.y, ecaff_var_b.y, length );
+                errors += assert_bigint( test_id, ecaff_var_a.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_a.y, ecaff_var_c.y, length );
+            }
         } else if( line_starts_with( buffer, "eccp_affine_point_add" ) ) {
 
             read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
@@ -535,6 +638,25 @@ unsigned test_ser() {
                 errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
                 errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
             }
+        } else if( line_starts_with( buffer, "eccp_affine_points_validate_batch" ) ) {
+
+            eccp_point_affine_t points[VALIDATE_BATCH_MAX_SIZE];
+            int expected_valid[VALIDATE_BATCH_MAX_SIZE];
+            uint_t valid_bitmap[ECCP_BATCH_BITMAP_WORDS( VALIDATE_BATCH_MAX_SIZE )];
+            int i;
+
+            int count = read_integer( buffer, READ_BUFFER_SIZE );
+            errors += assert_integer( test_id, 1, count <= VALIDATE_BATCH_MAX_SIZE );
+            for( i = 0; i < count; i++ ) {
+                read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &points[i], &( curve_params.prime_data ), 0 );
+                expected_valid[i] = read_integer( buffer, READ_BUFFER_SIZE );
+            }
+            int expected = read_integer( buffer, READ_BUFFER_SIZE );
+
+            errors += assert_integer( test_id, expected, eccp_affine_points_validate_batch( valid_bitmap, points, count, 1, param ) );
+            for( i = 0; i < count; i++ ) {
+                errors += assert_integer( test_id, expected_valid[i], ECCP_BATCH_BITMAP_GET( valid_bitmap, i ) );
+            }
         } else if( line_starts_with( buffer, "eccp_affine_point_is_valid" ) ) {
 
             read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
@@ -617,6 +739,87 @@ unsigned test_ser() {
             eccp_affine_to_jacobian( &ecproj_var_a, &ecaff_var_a, param );
             int is_valid = eccp_jacobian_point_is_valid( &ecproj_var_a, param );
             errors += assert_integer( test_id, expected, is_valid );
+        } else if( line_starts_with( buffer, "eccp_modified_jacobian_point_add_affine" ) ) {
+
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_b, &( curve_params.prime_data ), 1 );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_expected, &( curve_params.prime_data ), 1 );
+
+            eccp_affine_to_modified_jacobian( &ecmjac_var_a, &ecaff_var_a, param );
+            eccp_modified_jacobian_point_add_affine( &ecmjac_var_c, &ecmjac_var_a, &ecaff_var_b, param );
+            eccp_modified_jacobian_to_affine( &ecaff_var_c, &ecmjac_var_c, param );
+
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
+        } else if( line_starts_with( buffer, "eccp_modified_jacobian_point_add" ) ) {
+
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_b, &( curve_params.prime_data ), 1 );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_expected, &( curve_params.prime_data ), 1 );
+
+            // the inputs are doubled first such that Z != 1 (expected is 2A+2B)
+            eccp_affine_to_modified_jacobian( &ecmjac_var_a, &ecaff_var_a, param );
+            eccp_affine_to_modified_jacobian( &ecmjac_var_b, &ecaff_var_b, param );
+            eccp_modified_jacobian_point_double( &ecmjac_var_a, &ecmjac_var_a, param );
+            eccp_modified_jacobian_point_double( &ecmjac_var_b, &ecmjac_var_b, param );
+            eccp_modified_jacobian_point_add( &ecmjac_var_c, &ecmjac_var_a, &ecmjac_var_b, param );
+            eccp_modified_jacobian_to_affine( &ecaff_var_c, &ecmjac_var_c, param );
+
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
+        } else if( line_starts_with( buffer, "eccp_modified_jacobian_point_double" ) ) {
+
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_expected, &( curve_params.prime_data ), 1 );
+
+            eccp_affine_to_modified_jacobian( &ecmjac_var_a, &ecaff_var_a, param );
+            eccp_modified_jacobian_point_double( &ecmjac_var_c, &ecmjac_var_a, param );
+            eccp_modified_jacobian_to_affine( &ecaff_var_c, &ecmjac_var_c, param );
+
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
+        } else if( line_starts_with( buffer, "eccp_modified_jacobian_point_multiply" ) ) {
+
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_expected, &( curve_params.prime_data ), 1 );
+
+            eccp_modified_jacobian_point_multiply_L2R_NAF( &ecaff_var_c, &ecaff_var_a, bi_var_a, param );
+
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
+        } else if( line_starts_with( buffer, "eccp_point_multiply_public" ) ) {
+
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_expected, &( curve_params.prime_data ), 1 );
+
+            param_select_mul( param, 0 );
+            if( eccp_modified_jacobian_is_preferable( param ) ) {
+                errors += assert_integer( test_id, 1, param->eccp_mul == &eccp_modified_jacobian_point_multiply_L2R_NAF );
+            } else {
+                errors += assert_integer( test_id, 1, param->eccp_mul == &eccp_jacobian_point_multiply_L2R_NAF );
+            }
+            param->eccp_mul( &ecaff_var_c, &ecaff_var_a, bi_var_a, param );
+            param_select_mul( param, 1 );
+
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
         } else if( line_starts_with( buffer, "eccp_point_multiply" ) ) {
 
             read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
@@ -625,6 +828,114 @@ unsigned test_ser() {
 
             param->eccp_mul( &ecaff_var_c, &ecaff_var_a, bi_var_a, param );
 
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
+        } else if( line_starts_with( buffer, "eccp_comb_attach_const_table" ) ) {
+
+            int width = read_integer( buffer, READ_BUFFER_SIZE );
+            errors += assert_integer( test_id, 1, param_attach_const_table( param, width, 0 ) );
+        } else if( line_starts_with( buffer, "eccp_comb_table_file" ) ) {
+
+            param_table_type_t type = (param_table_type_t)read_integer( buffer, READ_BUFFER_SIZE );
+            int width = read_integer( buffer, READ_BUFFER_SIZE );
+            int blocks = read_integer( buffer, READ_BUFFER_SIZE );
+            uint_t file_data[( sizeof( param_table_header_t ) + sizeof( comb_table ) ) / sizeof( uint_t )];
+            size_t file_size;
+            char file_name[64];
+
+            snprintf( file_name, sizeof( file_name ), TBL_FILE_NAME, (long)getpid() );
+
+            // compute the table, store it to a file, and map it again
+            param->base_point_precomputed_table_width = width;
+            param->base_point_precomputed_table_blocks = blocks;
+            if( type == PARAM_TABLE_COMB ) {
+                eccp_jacobian_point_multiply_COMB_precompute( param, comb_table );
+            } else {
+                eccp_jacobian_point_multiply_COMB_WOZ_precompute( param, comb_table, 0 );
+            }
+            errors += assert_integer( test_id, 1, param_write_table_file( file_name, param, type ) );
+
+            // a corrupted table must be rejected
+            file_size = param_table_serialize( (uint8_t *)file_data, sizeof( file_data ), param, type );
+            errors += assert_integer( test_id, 1, file_size > 0 );
+            ( (uint8_t *)file_data )[file_size - 1] ^= 0x01;
+            errors += assert_integer( test_id, 0, param_table_attach( param, (uint8_t *)file_data, file_size, 0 ) );
+
+            // only COMB_WOZ tables can be attached for the constant-time multiplication
+            errors += assert_integer( test_id, type == PARAM_TABLE_COMB_WOZ, param_attach_table_mmap( param, file_name, 1 ) );
+            if( type == PARAM_TABLE_COMB_WOZ ) {
+                errors += assert_integer( test_id, 1, param->eccp_mul_base_point == &eccp_protected_point_multiply_COMB_WOZ );
+            }
+            errors += assert_integer( test_id, 1, param_attach_table_mmap( param, file_name, 0 ) );
+            remove( file_name );
+        } else if( line_starts_with( buffer, "eccp_comb_table_detach" ) ) {
+
+            // the mapped table of eccp_comb_table_file is removed
+            errors += assert_integer( test_id, 1, param->base_point_table_mapping != NULL );
+            param_detach_table_mmap( param );
+            errors += assert_integer( test_id, 1, param->base_point_precomputed_table == NULL );
+            errors += assert_integer( test_id, 1, param->eccp_mul_base_point == NULL );
+            errors += assert_integer( test_id, 1, param->base_point_table_mapping == NULL );
+            param_detach_table_mmap( param );
+
+            // a table that was not mapped is kept
+            param->base_point_precomputed_table_width = TBL_WIDTH;
+            param->base_point_precomputed_table_blocks = 1;
+            eccp_jacobian_point_multiply_COMB_WOZ_precompute( param, comb_table, 0 );
+            param_detach_table_mmap( param );
+            errors += assert_integer( test_id, 1, param->base_point_precomputed_table == comb_table );
+        } else if( line_starts_with( buffer, "eccp_comb_pack_table" ) ) {
+
+            eccp_jacobian_point_multiply_COMB_pack_table( param, comb_table_packed );
+        } else if( line_starts_with( buffer, "eccp_comb_precompute" ) ) {
+
+            int width = read_integer( buffer, READ_BUFFER_SIZE );
+            int blocks = read_integer( buffer, READ_BUFFER_SIZE );
+            int supported = ( width >= 1 ) && ( blocks >= 1 ) && ( JCB_COMB_BLOCKS_TBL_SIZE( width, blocks ) <= TBL_MAX_SIZE );
+            errors += assert_integer( test_id, 1, supported );
+            if( supported ) {
+                param->base_point_precomputed_table_width = width;
+                param->base_point_precomputed_table_blocks = blocks;
+                eccp_jacobian_point_multiply_COMB_precompute( param, comb_table );
+            }
+        } else if( line_starts_with( buffer, "eccp_fixed_point_multiply" ) ) {
+
+            int width = read_integer( buffer, READ_BUFFER_SIZE );
+            int blocks = read_integer( buffer, READ_BUFFER_SIZE );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 1 );
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_expected, &( curve_params.prime_data ), 1 );
+
+            eccp_fixed_point_registry_init( param, fixed_points, 1 );
+            // the Lim-Lee comb and the constant-time COMB_WOZ table
+            for( int constant_time = 0; constant_time <= 1; constant_time++ ) {
+                int handle = eccp_fixed_point_register( param, &ecaff_var_a, fixed_point_table, width, blocks, constant_time );
+                errors += assert_integer( test_id, 0, handle );
+                // the registry is full
+                errors += assert_integer( test_id, -1, eccp_fixed_point_register( param, &ecaff_var_a, fixed_point_table, width, blocks, constant_time ) );
+
+                errors += assert_integer( test_id, 1, eccp_fixed_point_multiply( &ecaff_var_c, handle, bi_var_a, param ) );
+                errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+                if( ecaff_var_expected.identity == 0 ) {
+                    errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                    errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+                }
+
+                eccp_fixed_point_unregister( param, handle );
+                errors += assert_integer( test_id, 0, eccp_fixed_point_multiply( &ecaff_var_c, handle, bi_var_a, param ) );
+            }
+            param->fixed_points = NULL;
+            param->fixed_points_capacity = 0;
+        } else if( line_starts_with( buffer, "eccp_comb_cr_point_multiply" ) ) {
+
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_expected, &( curve_params.prime_data ), 1 );
+
+            eccp_protected_point_multiply_COMB_WOZ( &ecaff_var_c, bi_var_a, param );
+
             errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
             if( ecaff_var_expected.identity == 0 ) {
                 errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
@@ -666,19 +977,262 @@ unsigned test_ser() {
                 errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
                 errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
             }
+        } else if( line_starts_with( buffer, "thread_pool" ) ) {
+            int thread_count = read_integer( buffer, READ_BUFFER_SIZE );
+            int job_count = read_integer( buffer, READ_BUFFER_SIZE );
+            errors += assert_integer( test_id, 0, test_threads_pool( param, thread_count, job_count ) );
+        } else if( line_starts_with( buffer, "verify_queue" ) ) {
+            int client_count = read_integer( buffer, READ_BUFFER_SIZE );
+            int request_count = read_integer( buffer, READ_BUFFER_SIZE );
+            int max_batch = read_integer( buffer, READ_BUFFER_SIZE );
+            int deadline_us = read_integer( buffer, READ_BUFFER_SIZE );
+            errors += assert_integer( test_id, 0, test_threads_verify_queue( param, client_count, request_count, max_batch, deadline_us, NULL ) );
+        } else if( line_starts_with( buffer, "thread_stress" ) ) {
+            int thread_count = read_integer( buffer, READ_BUFFER_SIZE );
+            int iterations = read_integer( buffer, READ_BUFFER_SIZE );
+            errors += assert_integer( test_id, 0, test_threads_stress( thread_count, iterations ) );
+        } else if( line_starts_with( buffer, "eckeygen_batch" ) ) {
+
+            gfp_t private_keys[SIGN_BATCH_MAX_SIZE];
+            eccp_point_affine_t public_keys[SIGN_BATCH_MAX_SIZE];
+            int i;
+
+            int count = read_integer( buffer, READ_BUFFER_SIZE );
+            errors += assert_integer( test_id, 1, count <= SIGN_BATCH_MAX_SIZE );
+            eckeygen_batch( private_keys, public_keys, count, param );
+            for( i = 0; i < count; i++ ) {
+                // 0 < private key < n
+                errors += assert_integer( test_id, 0, bigint_is_zero_var( private_keys[i], param->order_n_data.words ) );
+                errors += assert_integer( test_id, 1, bigint_compare_var( private_keys[i], param->order_n_data.prime, param->order_n_data.words ) < 0 );
+                ecdh_phase_one( &ecaff_var_expected, private_keys[i], param );
+                errors += assert_integer( test_id, 0, public_keys[i].identity );
+                errors += assert_bigint( test_id, ecaff_var_expected.x, public_keys[i].x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, public_keys[i].y, length );
+            }
+        } else if( line_starts_with( buffer, "ecdh_phase_two_batch" ) ) {
+
+            eccp_point_affine_t peers[ECDH_TEST_MAX_PEERS];
+            eccp_point_affine_t shared[ECDH_TEST_MAX_PEERS];
+            eccp_point_affine_t expected_shared[ECDH_TEST_MAX_PEERS];
+            int i;
+
+            int count = read_integer( buffer, READ_BUFFER_SIZE );
+            errors += assert_integer( test_id, 1, count <= ECDH_TEST_MAX_PEERS );
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );
+            for( i = 0; i < count; i++ ) {
+                read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &peers[i], &( curve_params.prime_data ), 0 );
+                read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &expected_shared[i], &( curve_params.prime_data ), 0 );
+            }
+            int expected = read_integer( buffer, READ_BUFFER_SIZE );
+
+            errors += assert_integer( test_id, expected, ecdh_phase_two_batch( shared, bi_var_a, peers, count, param ) );
+            for( i = 0; i < count; i++ ) {
+                errors += assert_integer( test_id, expected_shared[i].identity, shared[i].identity );
+                if( expected_shared[i].identity == 0 ) {
+                    errors += assert_bigint( test_id, expected_shared[i].x, shared[i].x, length );
+                    errors += assert_bigint( test_id, expected_shared[i].y, shared[i].y, length );
+                }
+            }
+        } else if( line_starts_with( buffer, "ecdh_phase_two_x_only" ) ) {
+
+            uint8_t shared_secret[BYTES_PER_GFP];
+            uint8_t shared_secret_no_y[BYTES_PER_GFP];
+            uint8_t expected_secret[BYTES_PER_GFP];
+            int bytes = BYTES_PER_BITS( param->prime_data.bits );
+            int i;
+
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 0 );
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, length );
+            int expected = read_integer( buffer, READ_BUFFER_SIZE );
+
+            int result = ecdh_phase_two_x_only( shared_secret, bi_var_a, ecaff_var_a.x, ecaff_var_a.y, param );
+            int result_no_y = ecdh_phase_two_x_only( shared_secret_no_y, bi_var_a, ecaff_var_a.x, NULL, param );
+
+            errors += assert_integer( test_id, expected, result );
+            errors += assert_integer( test_id, expected, result_no_y );
+            if( expected == 1 ) {
+                for( i = 0; i < bytes; i++ ) {
+                    expected_secret[i] = bigint_get_byte_var( bi_var_expected, length, bytes - 1 - i );
+                    errors += assert_integer( test_id, expected_secret[i], shared_secret[i] );
+                    errors += assert_integer( test_id, expected_secret[i], shared_secret_no_y[i] );
+                }
+            }
+        } else if( line_starts_with( buffer, "ecdh_phase_two_with_key" ) ) {
+
+            eckey_private_t private_key;
+            eckey_public_t other_party_key;
+
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 0 );
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_expected, &( curve_params.prime_data ), 0 );
+            int expected = read_integer( buffer, READ_BUFFER_SIZE );
+
+            errors += assert_integer( test_id, 1, eckey_private_import( &private_key, bi_var_a, param ) );
+            errors += assert_integer( test_id, expected, eckey_public_import( &other_party_key, &ecaff_var_a, param ) );
+            errors += assert_integer( test_id, expected, ecdh_phase_two_with_key( &ecaff_var_c, &private_key, &other_party_key, param ) );
+            errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
+            if( ecaff_var_expected.identity == 0 ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
+            }
+            // the shared point is the same from both sides
+            if( expected == 1 ) {
+                eckey_public_export( &ecaff_var_b, eckey_private_get_public( &private_key ), param );
+                errors += assert_integer( test_id, 1, eckey_public_import( &other_party_key, &ecaff_var_b, param ) );
+                eckey_private_generate( &private_key, param );
+                ecdh_phase_two_with_key( &ecaff_var_a, &private_key, &other_party_key, param );
+                eckey_public_export( &ecaff_var_b, eckey_private_get_public( &private_key ), param );
+                ecdh_phase_two( &ecaff_var_c, bi_var_a, &ecaff_var_b, param );
+                errors += assert_integer( test_id, 0, eccp_affine_point_compare( &ecaff_var_a, &ecaff_var_c, param ) );
+            }
+            eckey_private_clear( &private_key );
         } else if( line_starts_with( buffer, "ecdh_phase_two" ) ) {
 
             read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 0 );
             read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );
             read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_expected, &( curve_params.prime_data ), 0 );
 
+            eccp_affine_point_copy( &ecaff_var_b, &ecaff_var_a, param );
             ecdh_phase_two( &ecaff_var_c, bi_var_a, &ecaff_var_a, param );
+            // the public key of the other party is left unchanged
+            errors += assert_bigint( test_id, ecaff_var_b.x, ecaff_var_a.x, length );
+            errors += assert_bigint( test_id, ecaff_var_b.y, ecaff_var_a.y, length );
 
             errors += assert_integer( test_id, ecaff_var_expected.identity, ecaff_var_c.identity );
             if( ecaff_var_expected.identity == 0 ) {
                 errors += assert_bigint( test_id, ecaff_var_expected.x, ecaff_var_c.x, length );
                 errors += assert_bigint( test_id, ecaff_var_expected.y, ecaff_var_c.y, length );
             }
+        } else if( line_starts_with( buffer, "ecdsa_recover_public_key" ) ) {
+
+            ecdsa_signature_t signature;
+            eccp_point_affine_t candidates[ECDSA_RECOVERY_MAX_CANDIDATES];
+
+            read_bigint( buffer, READ_BUFFER_SIZE, signature.r, param->order_n_data.words ); // read r of signature
+            read_bigint( buffer, READ_BUFFER_SIZE, signature.s, param->order_n_data.words ); // read s of signature
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );    // hash of message
+            int recovery_id = read_integer( buffer, READ_BUFFER_SIZE );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_expected, &( curve_params.prime_data ), 0 ); // public key
+            int expected = read_integer( buffer, READ_BUFFER_SIZE );
+
+            int count = ecdsa_recover_public_key( candidates, &signature, bi_var_a, recovery_id, param );
+            errors += assert_integer( test_id, expected, count );
+            if( ( expected == 1 ) && ( count == 1 ) ) {
+                errors += assert_bigint( test_id, ecaff_var_expected.x, candidates[0].x, length );
+                errors += assert_bigint( test_id, ecaff_var_expected.y, candidates[0].y, length );
+            }
+        } else if( line_starts_with( buffer, "ecdsa_sign_recoverable" ) ) {
+
+            ecdsa_signature_t signature;
+            eccp_point_affine_t candidates[ECDSA_RECOVERY_MAX_CANDIDATES];
+            int i, found = 0;
+
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );                      // hash of message
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_b, param->order_n_data.words );                      // private key
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 0 ); // public key
+
+            int recovery_id = ecdsa_sign_recoverable( &signature, bi_var_a, bi_var_b, param );
+            errors += assert_integer( test_id, 1, ecdsa_is_valid( &signature, bi_var_a, &ecaff_var_a, param ) );
+            errors += assert_integer( test_id, 1, ecdsa_recover_public_key( candidates, &signature, bi_var_a, recovery_id, param ) );
+            errors += assert_bigint( test_id, ecaff_var_a.x, candidates[0].x, length );
+            errors += assert_bigint( test_id, ecaff_var_a.y, candidates[0].y, length );
+
+            int count = ecdsa_recover_public_key( candidates, &signature, bi_var_a, ECDSA_RECOVERY_ID_ALL, param );
+            for( i = 0; i < count; i++ ) {
+                found |= ( eccp_affine_point_compare( &ecaff_var_a, &candidates[i], param ) == 0 );
+            }
+            errors += assert_integer( test_id, 1, found );
+        } else if( line_starts_with( buffer, "ecdsa_sign_rfc6979_sha256" ) ) {
+
+            hash_sha224_256_t sha2_state;
+            ecdsa_signature_t signature;
+            uint8_t message[400];
+            uint8_t hash[32];
+
+            int message_length = read_message( buffer, READ_BUFFER_SIZE, message, 400 );
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_b, param->order_n_data.words ); // private key
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_c, param->order_n_data.words ); // expected r
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_expected, param->order_n_data.words ); // expected s
+
+            hash_sha256_init( &sha2_state );
+            hash_sha2_final( &sha2_state, message, message_length, message_length );
+            hash_sha256_to_byte_array( hash, &sha2_state );
+            ecdsa_hash_to_gfp( bi_var_a, hash, 256, &( param->order_n_data ) );
+
+            ecdsa_sign_rfc6979( &signature, bi_var_a, bi_var_b, param );
+            errors += assert_bigint( test_id, bi_var_c, signature.r, param->order_n_data.words );
+            errors += assert_bigint( test_id, bi_var_expected, signature.s, param->order_n_data.words );
+        } else if( line_starts_with( buffer, "ecdsa_sign_batch" ) ) {
+
+            ecdsa_signature_t signatures[SIGN_BATCH_MAX_SIZE];
+            gfp_t hashes[SIGN_BATCH_MAX_SIZE];
+            int i;
+
+            int count = read_integer( buffer, READ_BUFFER_SIZE );
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_b, param->order_n_data.words );                      // private key
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 0 ); // public key
+            errors += assert_integer( test_id, 1, count <= SIGN_BATCH_MAX_SIZE );
+            for( i = 0; i < count; i++ ) {
+                read_bigint( buffer, READ_BUFFER_SIZE, hashes[i], param->order_n_data.words ); // hash of message
+            }
+            int expected = read_integer( buffer, READ_BUFFER_SIZE );
+
+            ecdsa_sign_batch( signatures, (const gfp_t *)hashes, count, bi_var_b, param );
+            for( i = 0; i < count; i++ ) {
+                errors += assert_integer( test_id, expected, ecdsa_is_valid( &signatures[i], hashes[i], &ecaff_var_a, param ) );
+            }
+        } else if( line_starts_with( buffer, "ecdsa_sign_with_key" ) ) {
+
+            ecdsa_signature_t signature;
+            eckey_private_t private_key;
+
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );                      // hash of message
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_b, param->order_n_data.words );                      // private key
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 0 ); // public key
+            int expected = read_integer( buffer, READ_BUFFER_SIZE );
+
+            errors += assert_integer( test_id, 1, eckey_private_import( &private_key, bi_var_b, param ) );
+            eckey_private_export( bi_var_c, &private_key, param );
+            errors += assert_bigint( test_id, bi_var_b, bi_var_c, param->order_n_data.words );
+            eckey_public_export( &ecaff_var_c, eckey_private_get_public( &private_key ), param );
+            errors += assert_integer( test_id, 0, eccp_affine_point_compare( &ecaff_var_a, &ecaff_var_c, param ) );
+
+            errors += assert_integer( test_id, 1, ecdsa_sign_with_key( &signature, bi_var_a, &private_key, param ) );
+            errors += assert_integer( test_id, expected, ecdsa_is_valid( &signature, bi_var_a, &ecaff_var_a, param ) );
+            errors += assert_integer( test_id, expected,
+                                      ecdsa_is_valid_with_key( &signature, bi_var_a, eckey_private_get_public( &private_key ), param ) );
+            eckey_private_clear( &private_key );
+            // a cleared key is rejected
+            errors += assert_integer( test_id, 0, ecdsa_sign_with_key( &signature, bi_var_a, &private_key, param ) );
+        } else if( line_starts_with( buffer, "ecdsa_sign_with_pool" ) ) {
+
+            ecdsa_signature_t signature;
+            ecdsa_nonce_t nonces[NONCE_POOL_SIZE];
+            ecdsa_nonce_pool_t pool;
+            int i;
+
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );                      // hash of message
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_b, param->order_n_data.words );                      // private key
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 0 ); // public key
+            int expected = read_integer( buffer, READ_BUFFER_SIZE );
+
+            ecdsa_nonce_pool_init( &pool, nonces, NONCE_POOL_SIZE, 1 );
+            errors += assert_integer( test_id, 1, ecdsa_nonce_pool_needs_refill( &pool ) );
+            errors += assert_integer( test_id, NONCE_POOL_SIZE - 1, ecdsa_nonce_pool_refill( &pool, NONCE_POOL_SIZE - 1, param ) );
+            errors += assert_integer( test_id, 1, ecdsa_nonce_pool_refill( &pool, NONCE_POOL_SIZE, param ) );
+            errors += assert_integer( test_id, 0, ecdsa_nonce_pool_needs_refill( &pool ) );
+
+            // the last two signatures are computed with an empty pool
+            for( i = 0; i < NONCE_POOL_SIZE + 2; i++ ) {
+                int pooled = ecdsa_sign_with_pool( &signature, bi_var_a, bi_var_b, &pool, param );
+                errors += assert_integer( test_id, ( i < NONCE_POOL_SIZE ) ? 1 : 0, pooled );
+                errors += assert_integer( test_id, expected, ecdsa_is_valid( &signature, bi_var_a, &ecaff_var_a, param ) );
+            }
+            errors += assert_integer( test_id, 1, ecdsa_nonce_pool_needs_refill( &pool ) );
+            errors += assert_integer( test_id, NONCE_POOL_SIZE, pool.generated );
+            errors += assert_integer( test_id, NONCE_POOL_SIZE, pool.consumed );
+            errors += assert_integer( test_id, 2, pool.underruns );
         } else if( line_starts_with( buffer, "ecdsa_signverify_selftest" ) ) {
 
             ecdsa_signature_t signature;
@@ -734,6 +1288,95 @@ unsigned test_ser() {
 
             int is_valid = ecdsa_is_valid( &signature, bi_var_a, &ecaff_var_a, param );
             errors += assert_integer( test_id, expected, is_valid );
+        } else if( line_starts_with( buffer, "ecdsa_sign_stream_sha256" ) ) {
+
+            hash_sha224_256_t sha2_state;
+            ecdsa_stream_t stream;
+            ecdsa_signature_t signature;
+            uint8_t message[400];
+            uint8_t hash[32];
+            int i;
+
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_b, param->order_n_data.words );                      // private key
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 0 ); // public key
+            int message_length = read_message( buffer, READ_BUFFER_SIZE, message, 400 );
+            int chunk_length = read_integer( buffer, READ_BUFFER_SIZE );
+
+            ecdsa_sign_stream_init( &stream, param );
+            for( i = 0; i < message_length; i += chunk_length ) {
+                ecdsa_stream_update( &stream, message + i, ( message_length - i < chunk_length ) ? message_length - i : chunk_length );
+            }
+            ecdsa_sign_stream_final( &signature, &stream, bi_var_b, param );
+
+            hash_sha256_init( &sha2_state );
+            hash_sha2_final( &sha2_state, message, message_length, message_length );
+            hash_sha256_to_byte_array( hash, &sha2_state );
+            ecdsa_hash_to_gfp( bi_var_a, hash, 256, &( param->order_n_data ) );
+
+            errors += assert_integer( test_id, 1, ecdsa_is_valid( &signature, bi_var_a, &ecaff_var_a, param ) );
+        } else if( line_starts_with( buffer, "ecdsa_verify_stream_sha256" ) ) {
+
+            ecdsa_stream_t stream;
+            ecdsa_signature_t signature;
+            uint8_t message[400];
+            int i;
+
+            read_bigint( buffer, READ_BUFFER_SIZE, signature.r, param->order_n_data.words ); // read r of signature
+            read_bigint( buffer, READ_BUFFER_SIZE, signature.s, param->order_n_data.words ); // read s of signature
+
+            int message_length = read_message( buffer, READ_BUFFER_SIZE, message, 400 );
+            int chunk_length = read_integer( buffer, READ_BUFFER_SIZE );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 0 ); // public key
+            int expected = read_integer( buffer, READ_BUFFER_SIZE );
+
+            ecdsa_verify_stream_init( &stream );
+            for( i = 0; i < message_length; i += chunk_length ) {
+                ecdsa_stream_update( &stream, message + i, ( message_length - i < chunk_length ) ? message_length - i : chunk_length );
+            }
+            errors += assert_integer( test_id, expected, ecdsa_verify_stream_final( &stream, &signature, &ecaff_var_a, param ) );
+        } else if( line_starts_with( buffer, "ecdsa_is_valid_with_key" ) ) {
+
+            ecdsa_signature_t signature;
+            eckey_public_t public_key;
+
+            read_bigint( buffer, READ_BUFFER_SIZE, signature.r, param->order_n_data.words ); // read r of signature
+            read_bigint( buffer, READ_BUFFER_SIZE, signature.s, param->order_n_data.words ); // read s of signature
+            read_bigint( buffer, READ_BUFFER_SIZE, bi_var_a, param->order_n_data.words );    // hash of message
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 0 ); // public key
+            int expected_key = read_integer( buffer, READ_BUFFER_SIZE );
+            int expected = read_integer( buffer, READ_BUFFER_SIZE );
+
+            errors += assert_integer( test_id, expected_key, eckey_public_import( &public_key, &ecaff_var_a, param ) );
+            errors += assert_integer( test_id, expected_key, eckey_public_is_valid( &public_key ) );
+            errors += assert_integer( test_id, expected, ecdsa_is_valid_with_key( &signature, bi_var_a, &public_key, param ) );
+            if( expected_key == 1 ) {
+                eckey_public_export( &ecaff_var_c, &public_key, param );
+                errors += assert_integer( test_id, 0, eccp_affine_point_compare( &ecaff_var_a, &ecaff_var_c, param ) );
+            }
+        } else if( line_starts_with( buffer, "ecdsa_is_valid_batch" ) ) {
+
+            ecdsa_signature_t signatures[SIGN_BATCH_MAX_SIZE];
+            gfp_t hashes[SIGN_BATCH_MAX_SIZE];
+            eccp_point_affine_t public_keys[SIGN_BATCH_MAX_SIZE];
+            int expected_results[SIGN_BATCH_MAX_SIZE];
+            int results[SIGN_BATCH_MAX_SIZE];
+            int i;
+
+            int count = read_integer( buffer, READ_BUFFER_SIZE );
+            errors += assert_integer( test_id, 1, count <= SIGN_BATCH_MAX_SIZE );
+            for( i = 0; i < count; i++ ) {
+                read_bigint( buffer, READ_BUFFER_SIZE, signatures[i].r, param->order_n_data.words ); // read r of signature
+                read_bigint( buffer, READ_BUFFER_SIZE, signatures[i].s, param->order_n_data.words ); // read s of signature
+                read_bigint( buffer, READ_BUFFER_SIZE, hashes[i], param->order_n_data.words );      // hash of message
+                read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &public_keys[i], &( curve_params.prime_data ), 0 ); // public key
+                expected_results[i] = read_integer( buffer, READ_BUFFER_SIZE );
+            }
+            int expected = read_integer( buffer, READ_BUFFER_SIZE );
+
+            errors += assert_integer( test_id, expected, ecdsa_is_valid_batch( results, signatures, hashes, public_keys, count, param ) );
+            for( i = 0; i < count; i++ ) {
+                errors += assert_integer( test_id, expected_results[i], results[i] );
+            }
         } else if( line_starts_with( buffer, "ecdsa_is_valid_sha256" ) ) {
 
             hash_sha224_256_t sha2_state;
@@ -756,7 +1399,47 @@ unsigned test_ser() {
             int is_valid = ecdsa_is_valid( &signature, bi_var_a, &ecaff_var_a, param );
             errors += assert_integer( test_id, expected, is_valid );
         } else if( line_starts_with( buffer, "ecdsa_is_valid_sha384" ) ) {
+
+            hash_sha384_512_t sha2_state;
+            ecdsa_signature_t signature;
+            uint8_t message[400];
+            uint8_t hash[48];
+
+            read_bigint( buffer, READ_BUFFER_SIZE, signature.r, param->order_n_data.words ); // read r of signature
+            read_bigint( buffer, READ_BUFFER_SIZE, signature.s, param->order_n_data.words ); // read s of signature
+
+            int message_length = read_message( buffer, READ_BUFFER_SIZE, message, 400 );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 0 ); // public key
+            int expected = read_integer( buffer, READ_BUFFER_SIZE );
+
+            hash_sha384_init( &sha2_state );
+            hash_sha512_final( &sha2_state, message, message_length, message_length );
+            hash_sha384_to_byte_array( hash, &sha2_state );
+            ecdsa_hash_to_gfp( bi_var_a, hash, 384, &( param->order_n_data ) );
+
+            int is_valid = ecdsa_is_valid( &signature, bi_var_a, &ecaff_var_a, param );
+            errors += assert_integer( test_id, expected, is_valid );
         } else if( line_starts_with( buffer, "ecdsa_is_valid_sha512" ) ) {
+
+            hash_sha384_512_t sha2_state;
+            ecdsa_signature_t signature;
+            uint8_t message[400];
+            uint8_t hash[64];
+
+            read_bigint( buffer, READ_BUFFER_SIZE, signature.r, param->order_n_data.words ); // read r of signature
+            read_bigint( buffer, READ_BUFFER_SIZE, signature.s, param->order_n_data.words ); // read s of signature
+
+            int message_length = read_message( buffer, READ_BUFFER_SIZE, message, 400 );
+            read_eccp_affine_point( buffer, READ_BUFFER_SIZE, &ecaff_var_a, &( curve_params.prime_data ), 0 ); // public key
+            int expected = read_integer( buffer, READ_BUFFER_SIZE );
+
+            hash_sha512_init( &sha2_state );
+            hash_sha512_final( &sha2_state, message, message_length, message_length );
+            hash_sha512_to_byte_array( hash, &sha2_state );
+            ecdsa_hash_to_gfp( bi_var_a, hash, 512, &( param->order_n_data ) );
+
+            int is_valid = ecdsa_is_valid( &signature, bi_var_a, &ecaff_var_a, param );
+            errors += assert_integer( test_id, expected, is_valid );
         } else if( line_starts_with( buffer, "ecdsa_is_valid" ) ) {
 
             ecdsa_signature_t signature;
@@ -848,6 +1531,20 @@ unsigned test_ser() {
             hash_sha224_to_byte_array( hash, &sha2_state );
 
             errors += assert_byte_array( test_id, expected_hash, hash, 28 );
+        } else if( line_starts_with( buffer, "hmac_sha256" ) ) {
+
+            uint8_t key[200];
+            uint8_t message[256];
+            uint8_t expected_mac[HMAC_SHA256_BYTES];
+            uint8_t mac[HMAC_SHA256_BYTES];
+
+            int key_length = read_message( buffer, READ_BUFFER_SIZE, key, 200 );
+            int message_length = read_message( buffer, READ_BUFFER_SIZE, message, 256 );
+            read_message( buffer, READ_BUFFER_SIZE, expected_mac, HMAC_SHA256_BYTES );
+
+            hash_hmac_sha256( mac, key, key_length, message, message_length );
+
+            errors += assert_byte_array( test_id, expected_mac, mac, HMAC_SHA256_BYTES );
         } else if( line_starts_with( buffer, "sha256_final" ) ) {
 
             hash_sha224_256_t sha2_state;
@@ -887,8 +1584,196 @@ unsigned test_ser() {
             hash_sha256_to_byte_array( hash, &sha2_state );
 
             errors += assert_byte_array( test_id, expected_hash, hash, 32 );
+        } else if( line_starts_with( buffer, "sha256_multi" ) ) {
+
+            static uint8_t messages[SHA256_MULTI_MAX_COUNT][SHA256_MULTI_MAX_LENGTH];
+            static uint8_t expected_hashes[SHA256_MULTI_MAX_COUNT][32];
+            hash_sha224_256_t digests[SHA256_MULTI_MAX_COUNT];
+            const uint8_t *message_pointers[SHA256_MULTI_MAX_COUNT];
+            int lengths[SHA256_MULTI_MAX_COUNT];
+            uint8_t hash[32];
+            int i, count;
+
+            count = read_integer( buffer, READ_BUFFER_SIZE );
+            for( i = 0; i < count; i++ ) {
+                lengths[i] = read_message( buffer, READ_BUFFER_SIZE, messages[i], SHA256_MULTI_MAX_LENGTH );
+                read_message( buffer, READ_BUFFER_SIZE, expected_hashes[i], 32 );
+                message_pointers[i] = messages[i];
+            }
+
+            hash_sha256_multi( digests, message_pointers, lengths, count );
+
+            for( i = 0; i < count; i++ ) {
+                hash_sha256_to_byte_array( hash, &digests[i] );
+                errors += assert_byte_array( test_id, expected_hashes[i], hash, 32 );
+            }
+        } else if( line_starts_with( buffer, "sha384_final" ) ) {
+
+            hash_sha384_512_t sha2_state;
+            uint8_t expected_hash[48];
+            uint8_t hash[48];
+            uint8_t message[256];
+
+            int message_length = read_message( buffer, READ_BUFFER_SIZE, message, 256 );
+            read_message( buffer, READ_BUFFER_SIZE, expected_hash, 48 );
+
+            hash_sha384_init( &sha2_state );
+            hash_sha512_final( &sha2_state, message, message_length, message_length );
+
+            hash_sha384_to_byte_array( hash, &sha2_state );
+
+            errors += assert_byte_array( test_id, expected_hash, hash, 48 );
+        } else if( line_starts_with( buffer, "sha384_update" ) ) {
+
+            hash_sha384_512_t sha2_state;
+            uint8_t expected_hash[48];
+            uint8_t hash[48];
+            uint8_t message[256];
+            int i, block_count, block_length, processed_length;
+
+            hash_sha384_init( &sha2_state );
+            block_count = read_integer( buffer, READ_BUFFER_SIZE );
+
+            // a block of 128 bytes is given as one line or as two lines of 64 bytes
+            block_length = 0;
+            processed_length = 0;
+            for( i = 0; i < block_count; i++ ) {
+                block_length += read_message( buffer, READ_BUFFER_SIZE, message + block_length, 128 );
+                if( block_length >= 128 ) {
+                    hash_sha512_update( &sha2_state, message );
+                    processed_length += 128;
+                    block_length = 0;
+                }
+            }
+            errors += assert_integer( test_id, 0, block_length );
+
+            int message_length = read_message( buffer, READ_BUFFER_SIZE, message, 256 );
+            read_message( buffer, READ_BUFFER_SIZE, expected_hash, 48 );
+            hash_sha512_final( &sha2_state, message, message_length, message_length + processed_length );
+
+            hash_sha384_to_byte_array( hash, &sha2_state );
+
+            errors += assert_byte_array( test_id, expected_hash, hash, 48 );
+        } else if( line_starts_with( buffer, "sha512_256_final" ) ) {
+
+            hash_sha384_512_t sha2_state;
+            uint8_t expected_hash[32];
+            uint8_t hash[32];
+            uint8_t message[256];
+
+            int message_length = read_message( buffer, READ_BUFFER_SIZE, message, 256 );
+            read_message( buffer, READ_BUFFER_SIZE, expected_hash, 32 );
+
+            hash_sha512_256_init( &sha2_state );
+            hash_sha512_final( &sha2_state, message, message_length, message_length );
+
+            hash_sha512_256_to_byte_array( hash, &sha2_state );
+
+            errors += assert_byte_array( test_id, expected_hash, hash, 32 );
+        } else if( line_starts_with( buffer, "sha512_256_update" ) ) {
+
+            hash_sha384_512_t sha2_state;
+            uint8_t expected_hash[32];
+            uint8_t hash[32];
+            uint8_t message[256];
+            int i, block_count, block_length, processed_length;
+
+            hash_sha512_256_init( &sha2_state );
+            block_count = read_integer( buffer, READ_BUFFER_SIZE );
+
+            // a block of 128 bytes is given as one line or as two lines of 64 bytes
+            block_length = 0;
+            processed_length = 0;
+            for( i = 0; i < block_count; i++ ) {
+                block_length += read_message( buffer, READ_BUFFER_SIZE, message + block_length, 128 );
+                if( block_length >= 128 ) {
+                    hash_sha512_update( &sha2_state, message );
+                    processed_length += 128;
+                    block_length = 0;
+                }
+            }
+            errors += assert_integer( test_id, 0, block_length );
+
+            int message_length = read_message( buffer, READ_BUFFER_SIZE, message, 256 );
+            read_message( buffer, READ_BUFFER_SIZE, expected_hash, 32 );
+            hash_sha512_final( &sha2_state, message, message_length, message_length + processed_length );
+
+            hash_sha512_256_to_byte_array( hash, &sha2_state );
+
+            errors += assert_byte_array( test_id, expected_hash, hash, 32 );
+        } else if( line_starts_with( buffer, "sha512_final" ) ) {
+
+            hash_sha384_512_t sha2_state;
+            uint8_t expected_hash[64];
+            uint8_t hash[64];
+            uint8_t message[256];
+
+            int message_length = read_message( buffer, READ_BUFFER_SIZE, message, 256 );
+            read_message( buffer, READ_BUFFER_SIZE, expected_hash, 64 );
+
+            hash_sha512_init( &sha2_state );
+            hash_sha512_final( &sha2_state, message, message_length, message_length );
+
+            hash_sha512_to_byte_array( hash, &sha2_state );
+
+            errors += assert_byte_array( test_id, expected_hash, hash, 64 );
+        } else if( line_starts_with( buffer, "sha512_update" ) ) {
+
+            hash_sha384_512_t sha2_state;
+            uint8_t expected_hash[64];
+            uint8_t hash[64];
+            uint8_t message[256];
+            int i, block_count, block_length, processed_length;
+
+            hash_sha512_init( &sha2_state );
+            block_count = read_integer( buffer, READ_BUFFER_SIZE );
+
+            // a block of 128 bytes is given as one line or as two lines of 64 bytes
+            block_length = 0;
+            processed_length = 0;
+            for( i = 0; i < block_count; i++ ) {
+                block_length += read_message( buffer, READ_BUFFER_SIZE, message + block_length, 128 );
+                if( block_length >= 128 ) {
+                    hash_sha512_update( &sha2_state, message );
+                    processed_length += 128;
+                    block_length = 0;
+                }
+            }
+            errors += assert_integer( test_id, 0, block_length );
+
+            int message_length = read_message( buffer, READ_BUFFER_SIZE, message, 256 );
+            read_message( buffer, READ_BUFFER_SIZE, expected_hash, 64 );
+            hash_sha512_final( &sha2_state, message, message_length, message_length + processed_length );
+
+            hash_sha512_to_byte_array( hash, &sha2_state );
+
+            errors += assert_byte_array( test_id, expected_hash, hash, 64 );
+        } else if(line_starts_with( buffer, "performance_test_eckeygen" ) ) {
+            performance_test_eckeygen(param);
+        } else if(line_starts_with( buffer, "performance_test_sha256_multi" ) ) {
+            performance_test_sha256_multi();
+        } else if(line_starts_with( buffer, "performance_test_hash" ) ) {
+            performance_test_hash();
+        } else if(line_starts_with( buffer, "performance_test_ecdsa_sign" ) ) {
+            performance_test_ecdsa_sign(param);
+        } else if(line_starts_with( buffer, "performance_test_verify_queue" ) ) {
+            int client_count = read_integer( buffer, READ_BUFFER_SIZE );
+            int request_count = read_integer( buffer, READ_BUFFER_SIZE );
+            int max_batch = read_integer( buffer, READ_BUFFER_SIZE );
+            int deadline_us = read_integer( buffer, READ_BUFFER_SIZE );
+            test_threads_verify_queue_report(param, client_count, request_count, max_batch, deadline_us);
+        } else if(line_starts_with( buffer, "performance_test_thread_pool" ) ) {
+            int max_threads = read_integer( buffer, READ_BUFFER_SIZE );
+            int job_count = read_integer( buffer, READ_BUFFER_SIZE );
+            test_threads_pool_scaling(param, max_threads, job_count);
+        } else if(line_starts_with( buffer, "performance_test_ecdh" ) ) {
+            performance_test_ecdh(param);
         } else if(line_starts_with( buffer, "performance_test_eccp_mul" ) ) {
             performance_test_eccp_mul(param);
+        } else if(line_starts_with( buffer, "performance_test_eccp_comb_timing" ) ) {
+            performance_test_eccp_comb_timing(param);
+        } else if(line_starts_with( buffer, "performance_test_eccp_comb" ) ) {
+            performance_test_eccp_comb(param);
         } else if(line_starts_with( buffer, "performance_test_gfp_mul" ) ) {
             performance_test_gfp_mul(param);
         }
@@ -0,0 +1,475 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+/*
+ * test_threads.c
+ *
+ * Multi-threaded stress test of the reentrancy of the library core.
+ */
+
+#include "test_threads.h"
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <flecc_in_c/arch/posix/utils/thread_pool.h>
+#include <flecc_in_c/arch/posix/utils/verify_queue.h>
+#include <flecc_in_c/utils/param.h>
+#include <flecc_in_c/utils/rand.h>
+#include <flecc_in_c/bi/bi.h>
+#include <flecc_in_c/protocols/protocols.h>
+
+/** the curves the threads of test_threads_stress iterate through */
+static const curve_type_t test_threads_curves[] = { SECP192R1, SECP224R1, SECP256R1, SECP384R1, SECP521R1 };
+/** the number of entries of test_threads_curves */
+#define TEST_THREADS_CURVE_COUNT ( (int)( sizeof( test_threads_curves ) / sizeof( test_threads_curves[0] ) ) )
+
+/** Work and result of one thread of test_threads_stress */
+typedef struct _test_threads_job_t_ {
+    pthread_t thread;
+    /** the parameters of the thread (its own copy or one shared with other threads) */
+    const eccp_parameters_t *param;
+    /** the number of sign/verify iterations */
+    int iterations;
+    /** the number of failed checks */
+    int failures;
+} test_threads_job_t;
+
+/**
+ * Signs and verifies random hashes with random keys.
+ * @param argument the test_threads_job_t of the thread
+ * @return NULL
+ */
+static void *test_threads_worker( void *argument ) {
+    test_threads_job_t *job = (test_threads_job_t *)argument;
+    const eccp_parameters_t *param = job->param;
+    ecdsa_signature_t signature;
+    eccp_point_affine_t public_key;
+    gfp_t private_key, hash;
+    int i;
+
+    for( i = 0; i < job->iterations; i++ ) {
+        gfp_rand( private_key, &param->order_n_data );
+        gfp_rand( hash, &param->order_n_data );
+        ecdh_phase_one( &public_key, private_key, param );
+
+        if( ( i & 1 ) == 0 ) {
+            ecdsa_sign( &signature, hash, private_key, param );
+        } else {
+            ecdsa_sign_rfc6979( &signature, hash, private_key, param );
+        }
+        if( ecdsa_is_valid( &signature, hash, &public_key, param ) != 1 ) {
+            job->failures++;
+        }
+        hash[0] ^= 1;
+        if( ecdsa_is_valid( &signature, hash, &public_key, param ) != 0 ) {
+            job->failures++;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Signs and verifies concurrently on different curves. Even threads use
+ * their own parameters, odd threads share the parameters of their curve
+ * (including the pre-computed table) with each other.
+ * @param thread_count the number of threads (at most TEST_THREADS_MAX_THREADS)
+ * @param iterations the number of sign/verify iterations per thread
+ * @return the number of failed checks, -1 if the threads could not be run
+ */
+int test_threads_stress( const int thread_count, const int iterations ) {
+    eccp_parameters_t shared_params[TEST_THREADS_CURVE_COUNT];
+    eccp_parameters_t own_params[TEST_THREADS_MAX_THREADS];
+    test_threads_job_t jobs[TEST_THREADS_MAX_THREADS];
+    int failures = 0;
+    int i;
+
+    if( thread_count > TEST_THREADS_MAX_THREADS ) {
+        return -1;
+    }
+    for( i = 0; i < TEST_THREADS_CURVE_COUNT; i++ ) {
+        param_load( &shared_params[i], test_threads_curves[i] );
+        param_attach_const_table( &shared_params[i], 4, 1 );
+    }
+    for( i = 0; i < thread_count; i++ ) {
+        if( ( i & 1 ) == 0 ) {
+            param_load( &own_params[i], test_threads_curves[( i / 2 ) % TEST_THREADS_CURVE_COUNT] );
+            jobs[i].param = &own_params[i];
+        } else {
+            jobs[i].param = &shared_params[( i / 2 ) % TEST_THREADS_CURVE_COUNT];
+        }
+        jobs[i].iterations = iterations;
+        jobs[i].failures = 0;
+    }
+
+    for( i = 0; i < thread_count; i++ ) {
+        if( pthread_create( &jobs[i].thread, NULL, test_threads_worker, &jobs[i] ) != 0 ) {
+            break;
+        }
+    }
+    if( i < thread_count ) {
+        failures = -1;
+    }
+    while( --i >= 0 ) {
+        pthread_join( jobs[i].thread, NULL );
+        if( failures >= 0 ) {
+            failures += jobs[i].failures;
+        }
+    }
+    return failures;
+}
+
+/**
+ * Generates keys, signs, verifies, and derives ECDH secrets with a thread pool.
+ * Each of the three batches mixes jobs of all threads and queues.
+ * @param param elliptic curve parameters
+ * @param thread_count the number of worker threads
+ * @param job_count the number of keys (even, at most TEST_THREADS_MAX_JOBS)
+ * @return the number of failed checks, -1 if the pool could not be started
+ */
+int test_threads_pool( const eccp_parameters_t *param, const int thread_count, const int job_count ) {
+    static gfp_t keys[TEST_THREADS_MAX_JOBS], hashes[TEST_THREADS_MAX_JOBS], tampered[TEST_THREADS_MAX_JOBS];
+    static eccp_point_affine_t public_keys[TEST_THREADS_MAX_JOBS], secrets[TEST_THREADS_MAX_JOBS];
+    static ecdsa_signature_t signatures[TEST_THREADS_MAX_JOBS];
+    static flecc_job_t jobs[2 * TEST_THREADS_MAX_JOBS];
+    flecc_pool_t pool;
+    flecc_batch_t batch;
+    int failures = 0;
+    int i, words = param->prime_data.words;
+
+    if( ( job_count > TEST_THREADS_MAX_JOBS ) || ( job_count & 1 ) || ( flecc_pool_init( &pool, thread_count ) == 0 ) ) {
+        return -1;
+    }
+    flecc_batch_init( &batch );
+
+    for( i = 0; i < job_count; i++ ) {
+        jobs[i].type = FLECC_JOB_KEYGEN;
+        jobs[i].param = param;
+        jobs[i].private_key = keys[i];
+        jobs[i].point = &public_keys[i];
+    }
+    flecc_batch_submit( &pool, &batch, jobs, job_count );
+    flecc_batch_wait( &pool, &batch );
+
+    // signatures and ECDH secrets of neighbouring keys in one batch
+    for( i = 0; i < job_count; i++ ) {
+        gfp_rand( hashes[i], &param->order_n_data );
+        jobs[2 * i].type = FLECC_JOB_SIGN;
+        jobs[2 * i].param = param;
+        jobs[2 * i].private_key = keys[i];
+        jobs[2 * i].hash = hashes[i];
+        jobs[2 * i].signature = &signatures[i];
+        jobs[2 * i + 1].type = FLECC_JOB_ECDH;
+        jobs[2 * i + 1].param = param;
+        jobs[2 * i + 1].private_key = keys[i];
+        jobs[2 * i + 1].public_key = &public_keys[i ^ 1];
+        jobs[2 * i + 1].point = &secrets[i];
+    }
+    flecc_batch_submit( &pool, &batch, jobs, 2 * job_count );
+    flecc_batch_wait( &pool, &batch );
+    for( i = 0; i < job_count; i++ ) {
+        if( ( jobs[2 * i + 1].result != 1 ) || ( bigint_compare_var( secrets[i].x, secrets[i ^ 1].x, words ) != 0 )
+            || ( bigint_compare_var( secrets[i].y, secrets[i ^ 1].y, words ) != 0 ) ) {
+            failures++;
+        }
+    }
+
+    // every second verification uses a wrong hash
+    for( i = 0; i < job_count; i++ ) {
+        bigint_copy_var( tampered[i], hashes[i], param->order_n_data.words );
+        tampered[i][0] ^= i & 1;
+        jobs[i].type = FLECC_JOB_VERIFY;
+        jobs[i].param = param;
+        jobs[i].hash = tampered[i];
+        jobs[i].public_key = &public_keys[i];
+        jobs[i].signature = &signatures[i];
+    }
+    flecc_batch_submit( &pool, &batch, jobs, job_count );
+    flecc_batch_wait( &pool, &batch );
+    for( i = 0; i < job_count; i++ ) {
+        if( jobs[i].result != ( ( i & 1 ) ^ 1 ) ) {
+            failures++;
+        }
+    }
+
+    flecc_pool_destroy( &pool );
+    return failures;
+}
+
+/**
+ * Prints the throughput of batch signing with 0 (caller only) to max_threads
+ * worker threads and the speedup compared to a single worker thread.
+ * @param param elliptic curve parameters
+ * @param max_threads the maximum number of worker threads
+ * @param job_count the number of signatures per measurement (at most TEST_THREADS_MAX_JOBS)
+ */
+void test_threads_pool_scaling( const eccp_parameters_t *param, const int max_threads, const int job_count ) {
+    static gfp_t key, hash;
+    static ecdsa_signature_t signatures[TEST_THREADS_MAX_JOBS];
+    static flecc_job_t jobs[TEST_THREADS_MAX_JOBS];
+    struct timespec start, stop;
+    flecc_pool_t pool;
+    flecc_batch_t batch;
+    double seconds, single = 0.0;
+    int threads, i;
+
+    gfp_rand( key, &param->order_n_data );
+    gfp_rand( hash, &param->order_n_data );
+    for( i = 0; i < job_count; i++ ) {
+        jobs[i].type = FLECC_JOB_SIGN;
+        jobs[i].param = param;
+        jobs[i].private_key = key;
+        jobs[i].hash = hash;
+        jobs[i].signature = &signatures[i];
+    }
+
+    for( threads = 0; threads <= max_threads; threads++ ) {
+        if( flecc_pool_init( &pool, threads ) == 0 ) {
+            return;
+        }
+        flecc_batch_init( &batch );
+        clock_gettime( CLOCK_MONOTONIC, &start );
+        flecc_batch_submit( &pool, &batch, jobs, job_count );
+        flecc_batch_wait( &pool, &batch );
+        clock_gettime( CLOCK_MONOTONIC, &stop );
+        flecc_pool_destroy( &pool );
+
+        seconds = ( stop.tv_sec - start.tv_sec ) + ( stop.tv_nsec - start.tv_nsec ) * 1e-9;
+        if( threads == 1 ) {
+            single = seconds;
+        }
+        printf( "flecc_batch (%d threads): %.1f signatures/s", threads, job_count / seconds );
+        if( threads >= 1 ) {
+            printf( ", speedup %.2f", single / seconds );
+        }
+        printf( "\n" );
+    }
+}
+
+/** Requests of one client thread of test_threads_verify_queue */
+typedef struct _test_threads_client_t_ {
+    pthread_t thread;
+    flecc_verify_queue_t *queue;
+    flecc_verify_request_t *requests;
+    int count;
+} test_threads_client_t;
+
+/**
+ * Counts the completions of a request (flecc_verify_callback_t). The request
+ * must already be done when the callback is called.
+ * @param request the completed request
+ * @param context the counter (int)
+ */
+static void test_threads_verify_callback( flecc_verify_request_t *request, void *context ) {
+    if( request->done == 1 ) {
+        ( *(int *)context )++;
+    }
+}
+
+/**
+ * Submits the requests of a client one after the other and waits for each.
+ * @param argument the test_threads_client_t of the thread
+ * @return NULL
+ */
+static void *test_threads_verify_client( void *argument ) {
+    test_threads_client_t *client = (test_threads_client_t *)argument;
+    int i;
+
+    for( i = 0; i < client->count; i++ ) {
+        flecc_verify_submit( client->queue, &client->requests[i] );
+        flecc_verify_wait( client->queue, &client->requests[i] );
+    }
+    return NULL;
+}
+
+/**
+ * Verifies signatures of several client threads, each submitting single
+ * requests, through a coalescing verification queue. Every fifth signature
+ * is checked against a wrong hash, every second request uses a callback.
+ * @param param elliptic curve parameters
+ * @param client_count the number of client threads (at most TEST_THREADS_MAX_THREADS)
+ * @param request_count the number of requests per client (client_count * request_count at most TEST_THREADS_MAX_JOBS)
+ * @param max_batch the maximum batch size of the queue
+ * @param deadline_us the deadline of the queue in microseconds
+ * @param stats the resulting statistics of the queue (may be NULL)
+ * @return the number of failed checks, -1 if the test could not be run
+ */
+int test_threads_verify_queue( const eccp_parameters_t *param,
+                               const int client_count,
+                               const int request_count,
+                               const int max_batch,
+                               const int deadline_us,
+                               flecc_verify_stats_t *stats ) {
+    static gfp_t keys[TEST_THREADS_MAX_JOBS], hashes[TEST_THREADS_MAX_JOBS];
+    static eccp_point_affine_t public_keys[TEST_THREADS_MAX_JOBS];
+    static ecdsa_signature_t signatures[TEST_THREADS_MAX_JOBS];
+    static flecc_verify_request_t requests[TEST_THREADS_MAX_JOBS];
+    static int completions[TEST_THREADS_MAX_JOBS];
+    test_threads_client_t clients[TEST_THREADS_MAX_THREADS];
+    flecc_verify_queue_t *queue;
+    flecc_verify_stats_t queue_stats;
+    int total = client_count * request_count;
+    int failures = 0;
+    int i;
+
+    if( ( client_count > TEST_THREADS_MAX_THREADS ) || ( total > TEST_THREADS_MAX_JOBS ) ) {
+        return -1;
+    }
+    for( i = 0; i < total; i++ ) {
+        gfp_rand( keys[i], &param->order_n_data );
+        gfp_rand( hashes[i], &param->order_n_data );
+        ecdh_phase_one( &public_keys[i], keys[i], param );
+        ecdsa_sign( &signatures[i], hashes[i], keys[i], param );
+        if( i % 5 == 4 ) {
+            hashes[i][0] ^= 1;
+        }
+        requests[i].signature = &signatures[i];
+        requests[i].hash = hashes[i];
+        requests[i].public_key = &public_keys[i];
+        requests[i].callback = ( i & 1 ) ? test_threads_verify_callback : NULL;
+        requests[i].context = &completions[i];
+        completions[i] = 0;
+    }
+
+    queue = malloc( sizeof( flecc_verify_queue_t ) );
+    if( ( queue == NULL ) || ( flecc_verify_queue_init( queue, param, max_batch, deadline_us ) == 0 ) ) {
+        free( queue );
+        return -1;
+    }
+    for( i = 0; i < client_count; i++ ) {
+        clients[i].queue = queue;
+        clients[i].requests = &requests[i * request_count];
+        clients[i].count = request_count;
+        if( pthread_create( &clients[i].thread, NULL, test_threads_verify_client, &clients[i] ) != 0 ) {
+            break;
+        }
+    }
+    if( i < client_count ) {
+        failures = -1;
+    }
+    while( --i >= 0 ) {
+        pthread_join( clients[i].thread, NULL );
+    }
+    flecc_verify_queue_stats( queue, &queue_stats );
+    flecc_verify_queue_destroy( queue );
+    free( queue );
+    if( failures < 0 ) {
+        return -1;
+    }
+
+    for( i = 0; i < total; i++ ) {
+        if( requests[i].result != ( i % 5 != 4 ) ) {
+            failures++;
+        }
+        if( completions[i] != ( i & 1 ) ) {
+            failures++;
+        }
+    }
+    if( ( queue_stats.requests != (uint_t)total ) || ( queue_stats.average_batch_size > max_batch ) ) {
+        failures++;
+    }
+    if( stats != NULL ) {
+        *stats = queue_stats;
+    }
+    return failures;
+}
+
+/**
+ * Prints throughput and latency of single verifications of several client
+ * threads through a verification queue, without coalescing (batches of one
+ * request) and with the given batch size and deadline.
+ * @param param elliptic curve parameters
+ * @param client_count the number of client threads
+ * @param request_count the number of requests per client
+ * @param max_batch the maximum batch size of the queue
+ * @param deadline_us the deadline of the queue in microseconds
+ */
+void test_threads_verify_queue_report( const eccp_parameters_t *param,
+                                       const int client_count,
+                                       const int request_count,
+                                       const int max_batch,
+                                       const int deadline_us ) {
+    flecc_verify_stats_t stats;
+    int batch = 1, deadline = 0;
+    int run;
+
+    for( run = 0; run < 2; run++ ) {
+        if( test_threads_verify_queue( param, client_count, request_count, batch, deadline, &stats ) != 0 ) {
+            printf( "flecc_verify_queue: failed\n" );
+            return;
+        }
+        printf( "flecc_verify_queue (max_batch %d, deadline %d us): %.1f verifications/s, avg batch %.2f, p50 %.1f us, p99 %.1f us\n",
+                batch, deadline, stats.throughput, stats.average_batch_size, stats.p50_latency_us, stats.p99_latency_us );
+        batch = max_batch;
+        deadline = deadline_us;
+    }
+}
+
+#else
+
+int test_threads_stress( const int thread_count, const int iterations ) {
+    return -1;
+}
+
+int test_threads_pool( const eccp_parameters_t *param, const int thread_count, const int job_count ) {
+    return -1;
+}
+
+void test_threads_pool_scaling( const eccp_parameters_t *param, const int max_threads, const int job_count ) {
+}
+
+int test_threads_verify_queue( const eccp_parameters_t *param,
+                               const int client_count,
+                               const int request_count,
+                               const int max_batch,
+                               const int deadline_us,
+                               struct _flecc_verify_stats_t_ *stats ) {
+    return -1;
+}
+
+void test_threads_verify_queue_report( const eccp_parameters_t *param,
+                                       const int client_count,
+                                       const int request_count,
+                                       const int max_batch,
+                                       const int deadline_us ) {
+}
+
+#endif
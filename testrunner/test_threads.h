@@ -0,0 +1,70 @@
+/****************************************************************************
+**
+** Copyright (C) 2014 Stiftung Secure Information and 
+**                    Communication Technologies SIC and
+**                    Graz University of Technology
+** Contact: http://opensource.iaik.tugraz.at
+**
+** This file is part of <product_name>.
+**
+** $BEGIN_LICENSE:DEFAULT$
+** Commercial License Usage
+** Licensees holding valid commercial licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and SIC. For further information
+** contact us at http://opensource.iaik.tugraz.at.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+** 
+** This software is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** GNU General Public License for more details.
+**
+** You should have received a copy of the GNU General Public License
+** along with this software. If not, see http://www.gnu.org/licenses/.
+**
+** $END_LICENSE:DEFAULT$
+**
+****************************************************************************/
+
+
+/*
+ * test_threads.h
+ */
+
+#ifndef TEST_THREADS_H_
+#define TEST_THREADS_H_
+
+#include <flecc_in_c/types.h>
+
+/** the maximum number of threads of test_threads_stress */
+#define TEST_THREADS_MAX_THREADS 32
+/** the maximum number of jobs of test_threads_pool and test_threads_pool_scaling */
+#define TEST_THREADS_MAX_JOBS 256
+
+int test_threads_stress( const int thread_count, const int iterations );
+int test_threads_pool( const eccp_parameters_t *param, const int thread_count, const int job_count );
+void test_threads_pool_scaling( const eccp_parameters_t *param, const int max_threads, const int job_count );
+
+struct _flecc_verify_stats_t_;
+int test_threads_verify_queue( const eccp_parameters_t *param,
+                               const int client_count,
+                               const int request_count,
+                               const int max_batch,
+                               const int deadline_us,
+                               struct _flecc_verify_stats_t_ *stats );
+void test_threads_verify_queue_report( const eccp_parameters_t *param,
+                                       const int client_count,
+                                       const int request_count,
+                                       const int max_batch,
+                                       const int deadline_us );
+
+#endif /* TEST_THREADS_H_ */
@@ -0,0 +1,2315 @@
+custom
+brainpoolP256r1
+100
+A9FB57DBA1EEA9BC3E660A909D838D726E3BF623D52620282013481D1F6E5377
+100
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A7
+7D5A0975FC2C3057EEF67530417AFFE7FB8055C126DC5C6CE94A4B44F330B5D9
+26DC5C6CE94A4B44F330B5D9BBD77CBF958416295CF7E1CE6BCCDC18FF8C07B6
+1
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E545C1D54C72F046997
+eccp_affine_point_add 1
+033F8415BC54D1E1BAB9326111DB4BF432BBCB74834F8ABFF1F914347C494BFC
+1A5C24B8EAC5EEA080D76ACBBEA9E6F199B645CAAE2BD2C11360E276AED4F860
+0
+033F8415BC54D1E1BAB9326111DB4BF432BBCB74834F8ABFF1F914347C494BFC
+1A5C24B8EAC5EEA080D76ACBBEA9E6F199B645CAAE2BD2C11360E276AED4F860
+0
+71BCA263866E75F2EF0896C722E21EF9008CA6A9590F26A5231F033A65CB68A1
+24EE2C25EF2B46F56BC97E6EAB6D3E8CA458C98311B2A02CA4A24FC6A9D4AE0F
+0
+eccp_affine_point_add 2
+74422AE78A5ECCB2EE978C88D5887A3C32793416DB1669259F03DB49FF972684
+016CB98A58B3F1F05F57819F3CE0E0790E896AC51C54BBFE31B25AB271DA03E4
+0
+74422AE78A5ECCB2EE978C88D5887A3C32793416DB1669259F03DB49FF972684
+A88E9E51493AB7CBDF0E88F160A2ACF95FB28B5EB8D16429EE60ED6AAD944F93
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+eccp_affine_point_add 3
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+869D6815DEFF7F16679E6B49E5790A1792901C5519D6B6B957DD73A548091280
+47C61D1D2761E3A78FD12F464DC19C1D9E41C3C1FE2DCA2D4ABEC3ADECA2FBB7
+0
+869D6815DEFF7F16679E6B49E5790A1792901C5519D6B6B957DD73A548091280
+47C61D1D2761E3A78FD12F464DC19C1D9E41C3C1FE2DCA2D4ABEC3ADECA2FBB7
+0
+eccp_affine_point_add 4
+0581D6A7FE930A33047E0192B33D22F4B67DC557B43E47ECF7A5658400E430DC
+3EBF205D0A2AF7B9831EEC8568BDED3490B4CDA3CC3D414DE054BDCC60EE81B6
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0581D6A7FE930A33047E0192B33D22F4B67DC557B43E47ECF7A5658400E430DC
+3EBF205D0A2AF7B9831EEC8568BDED3490B4CDA3CC3D414DE054BDCC60EE81B6
+0
+eccp_affine_point_add 5
+135AC1DF6CEF46540DCDBFE57C110BB65907B47182FB155CCFFDBA1EAD5C137F
+2FF773E9C68DF52F6A799C8CB4276C84DF0CAA0A3B5F592852D3068286FD32C7
+0
+39A8F1B54ED8F2AC5F9DB556A4A939370314197C731F0590C7A3B9B149DD4F76
+5EF0F8ABC550AB115A95108641BE9191EA9C37B7D6ED60E7150BA4372F176919
+0
+7CF0E49A520A7C8609964B5C0FEF9400A25E06DCBFB526C652A09FD8EF757944
+75D1D611253DD2E8F6ECA22486BE4518137C473A5840A2525322B626EFA098AB
+0
+eccp_affine_point_add 6
+16F5E13839BBB23DD88DE5B3813E323182900C6A469D4AD4579B0844078B3B6F
+070BE66A32AA6057F989C942BC99689AFE721BBB9969E45149B4B9287B8D0474
+0
+75F13887D6C5C797760055B0461522BA542EB699F53F502C09DF1E55BBF37E74
+1E2B8252BD7655DCF531442B69E0AB3F2FE421257440895DC452AEF75A653FAB
+0
+8AC05F580359CF5BA22F65260CD442D329A00567076027698F23627977A8F837
+A6E54C85A863AE148BC20EDA96D25FF37967475503534716B6D19DA249E2D5C0
+0
+eccp_affine_point_add 7
+98D71C706507447DFED98C28AE651582B1D62582E82DDEB92EE63EEBA47800C5
+3DB92B07EBB06C5863C6153B6E3676759940DA727629D7FADBC84BEE80827A0C
+0
+4EB469E5646265B9881C55A120F8F96BC8D800ED29959C4EB05D39834AE67857
+305D86C18CEF760708748C05AFF9029AF841E36743F11D3870C60DB750907784
+0
+16BDEFA4FA56ED195C848449655F0FD0660B353C018BAB41CAA9521963038EDF
+173F8E0C39A52B05BC6481AAB46D6C16A0E4769853D80B80708441A0A41FDA4F
+0
+eccp_affine_point_add 8
+05232375CFED263CC890035284A03DC10064D4CB6B3C158868EA31ED573A8695
+4D51CD198CAAC458FC524CDF7AE2BCDD74FD3754C49097489BC220EF12558C74
+0
+444C6200CCBFCE90C8C6E53D147136459A38A52B648A601E0707BF95AA0BFCA4
+2A4B96214192696AA955B68AD903D8FF28CFABE3347809D12D6CDB5D88F796E3
+0
+11F9B8990F55FEB239815212D5CBCA5A253FE6BFC29DD5CD9FA8171243920502
+90D76A24934D5E9C156BD032786BF9BA28334D4951BD53A1951EEBB39C1C0D48
+0
+eccp_affine_point_add 9
+45980E16F81E6D80387BE94A46F87D6622D8C8FFAAE971DA102C0CB2BD59E49B
+1D712FDF94C47F918A4BADFC07F49F2583EE5B9ED7116027C6CD53395AA5938E
+0
+7CF4682A12E50CADD966AB7850819929D32362AF080FDEE62271BDC3EC9CEC4F
+8CEECACED570E33779E30E07C38246A9AFE50CF554BEBF0DD1CE0188548A08A4
+0
+7CA7D39AE436BD71BF159D1EFB9F7B094075AAC844DB28DAAA913ED0C5325306
+8534E377E8E497B85F0C51B674F068D0B9B4C6C770E09E0D490941C282D385C5
+0
+eccp_affine_point_add 10
+6CB7EEC20785A194E91365D290B161107FF4B9208B44282A4F95A2E73C134274
+588D83C693E8CD363C707DFFCAE0AA8C675617C0D31A301CC05561C8BA5F9FEA
+0
+9220C00F17E95698DAAD088014B0665D3ACA3BC5674F19904D3DF2E9EDDBE16D
+6A1B82D046CB4ECF6C590E841A3F141F8938DEE60450F0C0732C27084A8468BF
+0
+42FF706ADC04BE51B4D8A6A13611E16C7D5EB072B565A57C3CFFCA1A6EE24840
+936B04458D64C770D6D2C39E329584F60809466591ED5FA5822101913DBAD1F1
+0
+eccp_affine_point_add 11
+50E95A1B4C2DCBDABE54D719172029D4729F1F5038F7FE0682C85B8FD44FE6C0
+49F635EDE95A09096D421AF405E411DBC0AD834BA7CC5360F85B8D0F5AFDF740
+0
+A3AEBFEB0068D976A807A04C66756E7C1F0CC953B41AF1691F890AB9E0CB236A
+694D9267E505C6F1AA4AFC06406212604CC38FC29D9685CF297FBAD283DC98DC
+0
+6D26C7ABC763763329CC14A963AEF814B21B2ACF8AF866A2A6567E9CA6674B89
+3D9AECCD119157E16C5676241ED64B76B0BBEA8A535844612C3DF294638F8C0A
+0
+eccp_affine_point_add 12
+3EBD7756E40A1D41F3B38047B262F61D8DDB1B157FB8753AEF90E017996CE666
+18B930646D4161051BE5104E712B1BB65EEB790E612FB2E71FA081BEE4DD58B8
+0
+534096AA108FC6E941CD6E72F3BFB85CE03BFF3BD351D30D9E6880DB03EE3830
+6D1FCB56ECDE629A96F8FEE6930B13CB76462F0AB5BDD52692004BBB7AA4F098
+0
+019F7957DC95F75D188AE051BD6642A578E29A9631AA43D0AB43463EFD4DC127
+754F9960ED517BB9C8B0234EED4D539FC7EE938D580A349DA9CE76EC0C8075E4
+0
+eccp_affine_point_add 13
+43FFFC0B02D1787BF3050760D15192FBB3A3D58FCB98B9BEED6BE7C90BE596B0
+694438007C80114C69F691ED0C33018D0AEF714E4340F0AE55C1E0BD46288B9D
+0
+088120379DFB7B368E55A048A8ADE59843DAE3E91B38300F420B17117E89466D
+9861194C5587AE7F78B899CFF7F347F4CD99EFB2F4C7D48DDFE0474BD4538A95
+0
+9004C9B595657EBB3E23179C2F49379BF20E43C84B970F5872C788CDBEDE9545
+39A9C36695924C89C9EEB78DBF40C1BEE7ABDCC819E541B76D39AC635DA5DDD7
+0
+eccp_affine_point_add 14
+6A39C20BA7E2D258B941DD701A88865A0B6ACC58F510EE59AC9E5AF064FF6D32
+9F280FF390E868728DCFE441778E1652806F4A7544F91E5F458C2C34146BB0D4
+0
+15A86A3E1F2667C62C1515F073E5AA38FF398086AE1D69D9907F1BA4A81D4F81
+09E79CCFDD197490BE5AA031471984B5F4BAE00BE550EB1B979E15C7ADED1F07
+0
+30B2A652EFDE5F3599A3B4B1C66FEC6BCB87C4C0CE1DDD4F1E7FCE4CBB1506AE
+8ED56A84131DFD3AA0E6A635DFADC1DC00219D27E441716E45E0E60B590F0589
+0
+eccp_affine_point_add 15
+0C5E59C6FDAC9EB899948B91F3B70E22BD846F1065A3B3D8F05D70DC69DEE748
+4346E278C3E94F29E0DA7E8EC986657AE0427FEDB86B98C58E39C41D06BFCD28
+0
+8212F55217CAC934F014BCD07F1B36BF1648780A16B4F2F83C43B61F0AC000B7
+9253C0171C3E5EAA20833D173DF2C6230DD1A37F741B4FFD57ED0C171886C8C9
+0
+4C7178335AC4D3530305DD1B69ADE7BD03CF142ACDBE7FFF5588FD32DD6D3B7B
+28C51FFFB6CD69E12FB45EB0047FD208C9C0F456A2DCECB78FAD07E40B97ADCA
+0
+eccp_affine_point_add 16
+102B06EFA595C547097DF09BA98A6F6121AA9CAF2471CCE4CE790FDA07E760F7
+A6E863BD95AAD3FAA8EB5542B264BB6C0C3FDF5B599C8E7C654AA5F9DB5561CE
+0
+968A0C9ABB2CFDB84DF299899DB8BBC9C879CF9D33799B95CDCE353DA05D9757
+0C2AEB367047D2F5F9218247144D4BC99D6F8D97B12568251A5B80442EA620F8
+0
+4AC8730144BAE5B743755EABAE46ED0E87428F082CD50724A5A9FD89659FE425
+1615DA08A71834963A52035BE065185FF3E9E5BCCD686A1117B2C2F6454022C8
+0
+eccp_affine_point_add 17
+3621B5F8FBFD0A19F1845CEB425F980E7C8222FCDD62583D4269F6351B5AC619
+4F068430EF7232047A3B0D5FFFAC4F35901961ABCC7558316768F933AC30CFC2
+0
+0D6B04B8B3C7B75CE6DD663313B5C727164DE050468C08A1996BF861D0716754
+4FB157A5EB65589859DF312F48B614F97C581FA2EEC4D62CB4E11FBFA5B2B3F3
+0
+25BB58EAA24DD086DD42FF68DEB90065DE3A73C6114A7E21B01F4D7CEA0BB2D4
+56502E207BB0180E9912815967C1A5F1B63F6178966D46F9C9152C6E4C678BCF
+0
+eccp_affine_point_add 18
+3B0E20DE8F5CE1EEDF3A9DF6D2A40FB5BD9BC92F5E92A8A1DA24B35431050C43
+773625011EFF441BD9018EB0F58F470C61B8CD91F3B2A8B62D3F2510208DCEE7
+0
+3BE5C00D5076CD66D90F01CB122FBF0CE9ED08FE15B728AD9CCE7EA97AC9E1FE
+9913175822DD217EDD87B31C3F819062968FA99A99D1BD7ECF1763672026D3AB
+0
+539FF252190D82E5BABFEBE7A8F2605BA6B2496CB57FAABDFED3FDB6AED9C376
+597D69A3FFC83CD8A8AA654862F4AD98758E1CEA1FEF28C4F47B1B82718467E5
+0
+eccp_affine_point_add 19
+4601252127711E9FF0518BC348E479158C814E5E990FBCC8D1802A3448CD8E70
+12A55F1EFFD3073D7E48F14363E4817C8032BE2C0D40C07423040D6ED5D8B665
+0
+9A4BDD9F79AB59274260F485B023CBBDA70030F6A15345C2DF8D8152091E2890
+75DCEF4175D9FD151712809FDEB39AD5C7FE52915F5EDE6B4A1C92072280C280
+0
+05DEB333AD6A532BF569C6187959FE18A705AABABA6C90977618F9643F9D144A
+5F3E8BAD4FF7C7531D93D3C753343EAAFE78D52A30AC5386674024BF624C7E26
+0
+eccp_affine_point_add 20
+9DE7F22014C8BE83E4FEC1D674780E1AFAEE046AC0D7A10A82D1F91CD1B07203
+857AA3947DB914B203ACEB169C3A9514A8D3D80984FB909EF8F71ED0F2DA01B1
+0
+80ECCF062F0859C4A127D725779171724366A2AA5CFC4CA3878D58EDCA7E91D0
+7DCD4028139339848ACC76BC15A49854D427F725A9735B942EBD4F76912E1BC8
+0
+349908766A44E5EF60B24F673D0F48FDDAA3EB6FAB80FF334793770DE77D32D8
+51AA4E7C8396BA9540AC1B28B50F5E6D351980600B388D21949251DFA58AC6E6
+0
+eccp_jacobian_point_double 21
+2C078D622ACEE9CD8E55585B3F2C1AFE775D04A18A47CB6042D405EA685349E8
+6F474B6CAB78F8586D8A854FBDA15F8ACCBB39709FC88F718C8D2FBC509E15FB
+0
+5ABE522B63C3FACB50FFF067EB86436901A6425B73726FE71C1274EF1824315D
+8311453FFBDE4CB3226041C9769A4626AF5CDC420D6A841A2ACFA01E8DEAA7C2
+0
+eccp_jacobian_point_double 22
+06AFBB3DFC58D5D4BC5EC7257A34B392E5E15E730E1B4E8A3F94F4B0E705FDCA
+4ED1EBBF98474A2CFF0099B4664D71D5AF1CF7E83F8F3541687380F5CAEF2F55
+0
+7459A9983B392BE3E016014650943DED8368F2007BA33D7F5C6443AA77724122
+96D75FA85B109D06673D07F9D5AC810D9E8A5D067774FA37057C1237D769937F
+0
+eccp_jacobian_point_double 23
+8A99D230ADBA05091AE46CFD54601A1E375B49C2BB81363EAFE75935729DB5BF
+329F3F69FC00B00746D26756D7D67CB0A76755DF353C1441B72C6450584EEA6A
+0
+90D2D19BBB251BBEB166A7D40CA2F4A738D0D0B1D7AC759B81D676344B1F52CF
+25531EA047C24A3DA34FF4DAEC5A0BD007C0CE419FBCBC0F9E5B66F1D1670366
+0
+eccp_jacobian_point_double 24
+13DC32372C8EF09753B4E33FFAB7394343029CDCC35AC2E7A6882019953E0030
+740594627938AC4EFB0CEC91E41DEC11F56783720C5BB2F8A40768A61DE10E55
+0
+22A56A92956A9DC5733E141EFDB0403ED38E0BF075A47CE3D5BDC077432737B3
+562240CA65FBC52F3F4A34809105CA0C7D49DE0F87E35B6BE14707521943955D
+0
+eccp_jacobian_point_double 25
+25ACDD6FCDD9077537E57F06A2891F0A3220B9FEC52BE126302D4396B68A4B08
+444C2A35AE790029351F07565080C887A9038F4AE415E6FB3AE7E050FA7C4623
+0
+1C23CF301E35B557B6A04891447AAED48A9D407B8EFCCEB64EC1CCCB606AD625
+255E53743EE37F9897B20B30FDAD7C4ECD550FCCBCC5A64084EDACAB091DDC59
+0
+eccp_jacobian_point_double 26
+3DA2414CEEEF5CEE50073013BF66D3508D5136539B0EC2304F03446B35BA0425
+598AA660826CC20F01005DAA537217D56EDD8DCF872FB872C6529253A22E9E88
+0
+7E987DC5C75C8A0D73CE1033CB800FB13DCC6058AE1C078F39841EEA0C9E2950
+7C6297A6C2ED1BF4EF1ADB8A7BEF1AA2C70FBB11422EB8B238F6BE22C23A42D3
+0
+eccp_jacobian_point_double 27
+12847D32FFB316A72CB9381C4AB4E2CC3118689AD72213C99BF93B9C24F1B528
+30E7E6E9676223C7738650EDF2187E1460689C926F6B9E10974CAB96E980B9CD
+0
+9BABCCDC1AAEB5D8C8327816CEF52E7F3F3FF653BC82C406FD537ABBD2228DB9
+5167804702509D80F250E516FCAAFDC9F3AC9F683C9EF783DE76FA19A58CB3BC
+0
+eccp_jacobian_point_double 28
+92117FD7CDA451842A2B070A7078E2EFD05AF4F4D93168DE7E043E66FE350525
+4D437CE9A105B0A9784A215AE0E0097CB8676D95641AC2F747335A8A59222F67
+0
+1FB1F51D641248D4D7975EA3243313D5A82F9D3216C3BB65FB56931EBBFE72A6
+36C7DA1EE36348D7F1264F24DC6ED7548BA4697CE3541FCA5C4FCDA237ABFA7A
+0
+eccp_jacobian_point_double 29
+8EBDEE2506018D0C0144B76A1E50402A7E7ECF5CB5C4050F681A1038C2E5E43F
+7831360606E3E4B79C51A20D744406217E2368428A42C4262BB9207684B65CAD
+0
+9BBED2A658F0BA2AD88A094D1775A4352AFE7E28CB2D15CE1F9170854D591069
+1B3E1843E87B7AF65444D84D29034C1076A22487801DF1808992AF3EBB533F60
+0
+eccp_jacobian_point_double 30
+08733470905E3E4D35027432353786268C89C9E7257BD029E762EE80801CBD6F
+56F77B3F143B67A6ABA31EAF1F0B0FF21090D7F698554FD2677E60C7FCF7EFA2
+0
+1177B72863B3249CA49F1FE76E584348553FD6F6050801EBA0227240AC8049B1
+07579F1B71A16B0D14992BD4AF4BF484D9A3C08CCECF158399D9405B71CD3502
+0
+eccp_modified_jacobian_point_add_affine 31
+1C01F399C122CB0E94CF3349DFA1299A0F104347F67BE04B1F6D6C343DF6563F
+4BBB1CF186C837342D56F4F41460F2F329C8D5C54110AA38B6E5C65B3C775DF5
+0
+1C01F399C122CB0E94CF3349DFA1299A0F104347F67BE04B1F6D6C343DF6563F
+4BBB1CF186C837342D56F4F41460F2F329C8D5C54110AA38B6E5C65B3C775DF5
+0
+28AD08C9344D02C1F6DA7458BCE24D9B50146C75C2EDCCDB190A2218BD46C8DF
+489383AF642DE3A4F4BABFA93016992DA1161E77124AF074F2E9725F14933529
+0
+eccp_modified_jacobian_point_add_affine 32
+1DBE7728E53875684016327996F6942B96033A82DE192FEC56488F58A6E02715
+2C54EBC7A276810BBF0E72B5AD915119B1F1C231116648088A00430BD6FACC43
+0
+1DBE7728E53875684016327996F6942B96033A82DE192FEC56488F58A6E02715
+7DA66C13FF7828B07F5797DAEFF23C58BC4A33F2C3BFD81F9613051148738734
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+eccp_modified_jacobian_point_add_affine 33
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+A01E36BF6AEAEC8F25ECFD233319C1ED43214CD2C82A9F6BE2413E0444C47EDB
+056F15FA2A4BDE4C963EC2CA31447752ADB47766497F67366509B07019F4BA34
+0
+A01E36BF6AEAEC8F25ECFD233319C1ED43214CD2C82A9F6BE2413E0444C47EDB
+056F15FA2A4BDE4C963EC2CA31447752ADB47766497F67366509B07019F4BA34
+0
+eccp_modified_jacobian_point_add_affine 34
+4D9440E48F53831BAB36DEE94E31058C1F1A67B16CB5E7030FBE5C2A547942CE
+7F32A363914628CD10A10CC81ED3D02E0BE1EAE089F14FEDE5859302208DFD95
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+4D9440E48F53831BAB36DEE94E31058C1F1A67B16CB5E7030FBE5C2A547942CE
+7F32A363914628CD10A10CC81ED3D02E0BE1EAE089F14FEDE5859302208DFD95
+0
+eccp_modified_jacobian_point_add_affine 35
+89969BD12B6511B0B2603517DE59D5FBA818DC45718DDB272253C241144FBCB0
+450262CA7615B59F089C690F771A869271305D1CB40A12829CAA55053B54A36B
+0
+12B4AF9D944B558B1DDF26B6F3FF9758B9AA07A69AFB848A6A54CA93DE9965DD
+8CA1C2477459956433E2681B0B4DACF350F945622799FBD9BCE4769F00033CB5
+0
+8D1428A4C69742BBCC292F23F0B9DA3BF5D79AF7BD9803AA1D1DA4F070C07170
+986C04BD555D5AE069F9CE95ACA945F67FEBCE1A659BDA20CDC2CFA7F1690C45
+0
+eccp_modified_jacobian_point_add_affine 36
+2AEC82D2D978DD3771A9A011F59E8C4AC7359DCC27E5A1FB0BEFCD276DA4F867
+83D806D63D9952EF155EAA77742DEE9DFA5DA45DE7506292FF60ED3704AA702D
+0
+38E089DAFFB33855609AEA0A30C323ED6B1AE9B75CBEAAA8DD9C7A60FE2AEE23
+405EF1EB742F04C09A29117626F63A9BFB62BDE3FF69259ACC09750EAAA33120
+0
+3910BFF517D1BE280A7ED116B0E2B78D39AED5C936601269530F44D6AF06DC14
+664AEE2C5E21DC1455F31546E3FAE2FA873C3E9EB767F642C09FF034B7C70CBA
+0
+eccp_modified_jacobian_point_add_affine 37
+341AF63E00F12D0C6FD259F90751E0F1F630BD5BDE4BA79DC8BD7FBA1251F51C
+22371B0F32DBE032849D8289F854D539C51961384FCA6FE99D971FA9AA884950
+0
+11686595E574EFD892BD6C7D65D97E3D1DC49DD9DF792A3406D601E56EB6E053
+A09B5923FDE270A68109C143E2288C8D900A57FCB26F7A5C040A5FB2B6C80B95
+0
+381840BD97CDEA185A44C75A48486188856B4EEBE1712449FD76A6C69F644BC2
+6F716919D5FFBA73FCFEF6D4D8D28858EB4BAE57AA18DA97BDF70B8EE1CA8577
+0
+eccp_modified_jacobian_point_add_affine 38
+2C1B33A8BCB9383515B7240E1E4D482612B38EE891FE0C7124B6AA54BA050092
+956A48CDFCEE65CD3A90EA15E16489D3CC02A2ED7DA4D30CF2CA10DC7FB99B89
+0
+9119838F2AFB55486ACB16D1A42D4C967C902CB42CFEE36B820726FE1D981D6F
+38767FB0A1040F32BB3F9C387FA41F95BF02AF0563D46BE56AFC21C0B1378827
+0
+74E8BEE8FCB8A08DB1A83D548B4F4E28E0069E3DF725847E9FE47C589926D210
+5E7D565EA110B99E42D4D7346D9B9387C00B98EBCD82532A893D0F13E5E66C09
+0
+eccp_modified_jacobian_point_add_affine 39
+1C7C7A5D911C4C64A25F64DFEE2A9C08DA71E016542709D5302EE02036584859
+21051CBB67798AA9BFA0042ED8010ABC151C0BCA196B55814D1895CD01187D58
+0
+8E200816C99F0B5BA0AFE46DD0D9F9D9A5FE6BC29F6B999EFA4EE37C9C6CCE37
+4F1A08313F2B4FAE54296D70B0FBD90F3CE6B53B0993004795E8A85C7C4D1F8D
+0
+4549161360DA3BE349240C5FD63D878849A1F2D1CB95148D890B6A30D4680E21
+319547812CB56EBF5A259C6A5B4482D4538A4CB67CF9DE1DDC0C7168E7711204
+0
+eccp_modified_jacobian_point_add_affine 40
+80CD7DB3339CAD4A1663BEF73C65C2864148E48B3E38656FA9987E585631281F
+3F3029BE83FEFE734742B5BD4F333152ECB77B6C1E385898D6D74172FF5C3D61
+0
+8BBD98BDC768B92325CAD9DAEBDA5856375BA08684BC44EEB5666766CC7E9C5F
+1F9A8EAC3E45A79D763822BB1E8170DE0698AEA00FF1B506FE850C07A7C3BCE0
+0
+22518E92306C18BE7C97196E417777E656EFF531DD36156E411F5ED546862A40
+1A39FFF1A16D0123E94F7628667BC30BCBBB865795CF955BC84AE7C1947AB813
+0
+eccp_modified_jacobian_point_add_affine 41
+58A5E90C43A11E07194BAEF87B90C2F7CE6D3569AFCCEAC93BEE292CE88EB81E
+54517F8881D87286EF5B3E68CF7AA783FC9695B743FC7912B7A61F4D453E1AEB
+0
+3E38FF736F846A3B996EF0121C7515FCA187CF0CE419686CFA724FB5B3356E80
+170645BCD511C41913D54F5DB4A3691361C0C6F7394AC435F940712B0FFBE6EC
+0
+745FC4615340A7FDC90601FCB9FB8BBE35431D5E40193DFDB4566DB3E49BEA41
+12A9D5C314D7D18D395C32075996A1FC27F66A6D0F85E14194BEA0ACE0EA4608
+0
+eccp_modified_jacobian_point_add_affine 42
+831A12014DFB7FDE9C7AFB927705488311A2D1027C73300016BB0D21340051F8
+7FA79D96B5576E6CBC92C7BAF1CAEC6D3F44F85D146C42324D06F60727713361
+0
+6DD940E0690659EEFBA13DFD2AD55C4FB0AC6D442E925B9E4C9DA8280CAD1BCF
+202C162CF9C312A2ED4884D031C8884457FC7DD7249088F827E34C94F9F8600D
+0
+401C5D63C309386B7A602B00ABE14475C2EF0EFD66458480EE3F83D2B29C25B7
+5A29DC6FA04A72CC659BD9FBD3876969F739BA2479B7C1D0046B3511A147B054
+0
+eccp_modified_jacobian_point_add_affine 43
+11873E3AC7B1257B6808737DB5F6FD827BBDD002BE98BF6DDEA89EB6CD04F1E6
+3949446A0E66D050C7FC8CA10BE23B9078772D87ED451AB9AB467ACEA6AEF094
+0
+72BADE98BE79523C4E495801BC0793F09A143D6A1355C9E7555C7BE4E6D8DC40
+0E6575829D4DF9CE96D7B5F3712DFFFAE6F8514AF908703015678732A38155F3
+0
+658727ADE6BB3C05BC4EA2DD4F01C00C3C8EC47641BFE2463343C9B2E8B8CC67
+97F73ECE60938866058FA61C9A615680F4309C12445505F41E794B47B4AD18A5
+0
+eccp_modified_jacobian_point_add_affine 44
+80DCE20410D5C49641C332C81886C19F85358F30EC67F754A3730CE160E2528F
+51C137B6289D82D93DC469CC64AFC2F87E7F6F483AE199E7A0D9770B342EBC89
+0
+1383ED61C70E2B0A30F580D0F6C0E8E0BA9251E87C0E0A57C2B7351C5E9F911E
+0C87FE04AB9EE8289F5643430D4924CCF9E419EDA1ED56C14BA71FB7635AD526
+0
+9B5ACC171CE83F01F924DB1F68AD847F45144055A890F0C2B41287129501D546
+A264CF4F46ACD442DACEC3A1E8AB8B267DABB35950198F60D9EE71B87DF878C6
+0
+eccp_modified_jacobian_point_add_affine 45
+25FED6688CCB521956D4E536CC5802F0D953C816FE80CB8DFD86B4E34DB01FDD
+93797D2DB2428C9B0FE240EE49C9698DB0287AEA156527C6904EAC65D8547A74
+0
+95274BCF83CD628F963F2F78BDB97A41AA78B83CDC96F3406DB2392058B2B591
+5836C4BC1D197B97FED1DEA7E5E6966C5B1F83DD3AA7D49C5EE9271574A4983D
+0
+A03138C668BF9B657B2DBAE0BD218A5570B6DD9229CBC5F69D6AE284A68C6439
+43A474CF158E98CFAAD6E420B78088D156D8AF1CEFE6158807E5F602AF07CB85
+0
+eccp_modified_jacobian_point_add_affine 46
+96F6A89DC9D481E8CF77AF8514BC689CC2524E5CB4EAC630BF0A9B7E8839B203
+40E9097967E5B7F158737A60706CCCC11E92D34ECD4DF6794A0A4F5FF144E268
+0
+80D5C6BD37B3571637741D5954FA12B578F2F76806E492E2A2195A745A63545C
+4E3800A307BA3E5C7EC87D73B19E71E95723930A7968CB27E4C7D9FFAF400A75
+0
+6C2F738AEBA3DAF065847A7D3F0754A5A53376A769F1708B7CDFA95C242E9A7C
+8E03A602D12784A47ABB03C5FA08C0A6F55AF9B79B97ABE12CD638CC389A1F00
+0
+eccp_modified_jacobian_point_add_affine 47
+01E87BACB00C868552FAF53BA7A21DD55592E15ACA8E10BD32ECE06ACED16EAA
+9EA2AFF81C52AA032673BA7F58BA3258641C786A760BE8C71F4536513D99AB49
+0
+892A35D7D5F8AD1282539B91131946DA4BAA8C6C8A2BA062C9E87453BE83F376
+746781A98434A41C41966EF6F5AB3CC530657B501C6565C7FC0289EC5A421AD9
+0
+8B7B298D204D560E4BE3DBFC273D9DF020E6B4101D94C78566D1DF9AF8989331
+1AC8625AD8778FB08407CF0EDD82685C6BFD213C88C1D9AE9A8B42C5AD7928A1
+0
+eccp_modified_jacobian_point_add_affine 48
+2D27FEA4484F2B0269185BA469345A906E214C6BC4F98E7CE68BC2E3D12A958B
+080CA8C182DA3941A7A48FFD31327AFFD63899FA30A21224F9E6ED5A6FE597FD
+0
+A733C068A9D7E7BF21247D2195988C750B5675A4919C70FF96BE856383C112E0
+4814C283C09A0567DD9D031AB06C0FADE7A8D5B0DBEC4A1F7F50073C007A65F6
+0
+9913E530DB2F3DBA5E08AC850C7C88A87F5B7956DEC998A3DE687EE4E01953FC
+01482DD85CDD4925C34B3118A013E996F3EF2619E22D0AF0E8DF0D0F7FB370FB
+0
+eccp_modified_jacobian_point_add_affine 49
+34C08A85FB3CD5D669975DCEFBC2972AE16121A736B84B5AB2856CEFF1C145F3
+6A443F991A4A89532B10240D7F9197C5C3D10358D9C3FE129EF3F7E1C7EABD4C
+0
+0C0B451B636C41C85D1C9DAE30E4DA42F50E784BB78A30B2F186C62C9BE12B15
+683976043A1755A31F4DE1940AF07DDFDC9131B9162C5AE0E4A625C0F53EBF2F
+0
+80264998BA208C51CFF351F828A7EF5A2450C972C06D066D11CF5F5D373B4671
+A0E2EB61AE61B01CE3B420B1826A03A090F09343AF78B1B5A4512E18976BA40D
+0
+eccp_modified_jacobian_point_add_affine 50
+7353ABFFB22468C123B8FC1F24F2EA588446B0F2FEC17FA1170DEF7F7A37F326
+078F0F6FD12695BD94B387C6691B5275F170222038F1B88BCE3887CC7A5255D3
+0
+3715648CB8954AB63117B9823ACF4C86D3F030C446D1C435BB69C7943AB72508
+1233F7E0CE7D62DE35B328F695D498D99F6D9C3FDB852A812A93D046BBA96D0F
+0
+021246BB0509F7C18D2D09BF3F3E702E677F59CF398BEAECD413100614B8CF64
+2933EE54515B5909B6883CF6C85B5F52DE56724F97508B09544435E6DC86F657
+0
+eccp_modified_jacobian_point_add 51
+97B0268B8459DF21C8865B98AAD08A6680E6F584440BE50A2B65A51D90EEF939
+6FCA252E9C53E3D6CF683971A4CBA0B98DAB3349C8B6A93A6A7A500569BEF7FB
+0
+97B0268B8459DF21C8865B98AAD08A6680E6F584440BE50A2B65A51D90EEF939
+6FCA252E9C53E3D6CF683971A4CBA0B98DAB3349C8B6A93A6A7A500569BEF7FB
+0
+0A042D755BF23F1A679B811A378D7DD476EC20E9D2404B61A9A6B924368466CE
+8D97FEA746156724667BA42F491F1E55A182A718BBA658E5A6810ECBD213F084
+0
+eccp_modified_jacobian_point_add 52
+591820F0B4B1891DA256A840D7412CCDADFC4BA9A2ECE9BD59A40BD1040A01C7
+3921456D2BF020E66CED41F00867B6355FFBDD69508CF83BE291E1C0CBF0C0D6
+0
+591820F0B4B1891DA256A840D7412CCDADFC4BA9A2ECE9BD59A40BD1040A01C7
+70DA126E75FE88D5D178C8A0951BD73D0E4018BA849927EC3D81665C537D92A1
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+eccp_modified_jacobian_point_add 53
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+7649F79C3F5859756A295418E82F64E71DCE18A161FA1000061D586E4747C2E6
+5E8337633D1372C18E2BBF06E29D9F2911C3756D0A584ED2DCBB3F32760844F5
+0
+501C63A8A950C47B736A60FE33A2C2F5820C829FF760CBF5E346D973DE7F00A3
+626728DA22A311B727351C1F3597266E3C1A7F3AD1F12A761993E5BAFC7BA50E
+0
+eccp_modified_jacobian_point_add 54
+1636DE5E29911E707C70D57C9F011AF7BDF44ACAE2A77F7C7898EAAA3B51EB0D
+5AFF8ADBC5F365D928ECA60A2280637F2A6828B36D28EA33AAE9CDDA52CA72B6
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+2F2F5F4A96A90B7DDA738B89F4A8EA8A8479E1FBA0B6D028CECF623AD6A97CBD
+00547AAFC8CB83542C6C5391CF7A44B0BBFAA6D35798D4A22431EC8D522329CE
+0
+eccp_modified_jacobian_point_add 55
+686DC2BD593F44433EDF4CC488E5AE25AF926CDD9FBDFBA771FAED8C4B30FCBD
+87E2DE2D6A162822E899C2123CCD5C3130D8CA90FC4DDEE8EEFD7D6BB0767416
+0
+1160A67F8272E98F0CA091F01A4508F47E0264AEE61F9C914641D057F0872303
+523D048C176D889E11A54EE0C6F012A044117FAF67A63BF95501529F9E66581E
+0
+0B1AC1D58485F58C6686C615EFF8515D8E9B6B0C43D743E47573367E48C94152
+6818D529BA28EFC1B0DC34E8199E416BD35CA9954369BB24729C1FF9B0190D62
+0
+eccp_modified_jacobian_point_add 56
+858D946B832B53093982B762CB5CED6A23040947D8E9462603C2E4C93B1D969F
+A8F8083E9D859CBB75BFD18C3A5EC1E7B8B3AAD58C62E5BAF52526DDAA34975A
+0
+43BB8643ADF2E3DBA5513D9886F0E6D46C88416C1C26EB3D2829291B53225B50
+487F32F541147AE7DFCF9BDBB58CE9E369CFDF20BDC3F588ADB6DC821CB95645
+0
+9D999340F81013D6DD4AA54ECFA0941FFAB64AB73A3671EEDD2A0851309BF61B
+593AC6F595132F602880AD4D23A6C85248F1A9B9828BCCE2A05A3BEACC948045
+0
+eccp_modified_jacobian_point_add 57
+87A05574DA345EDD0E05F398B8C41B67013356F8F3FA4BCEA3A25734BAFE1410
+67712A10296257206ACDD2F013C0CF004C30ACA045894714D49DA7A5B13484AE
+0
+658C204C0DD3EF03536D8980B8E86756947D6EDBD5347B46FADCCDE3874816E6
+5DD4C9E0EF13454C21F79077ACA78C8BD493A8016BF40C06F75288B2EEBDCD67
+0
+8719EAE6EBDA6BCD727C1C5C056E1D2F6183E1A298E0B2F216E63E6476AF03C5
+26439B5A3D6D2FC9FE11567267221666D7F44D0E1F3F1DEC5B2E36379114FD28
+0
+eccp_modified_jacobian_point_add 58
+7E175CE72B51816022CC65510D0209D1DFC9BB3BB9E638D35EC2997195D3BBEB
+4FF2A93663C8500F5A99BB24F35A997CCAF33142EBF69187E6CF7A65C54E596E
+0
+6BBDDB7B32ADC2CB0A3B3CDC0F32B4A2FF22CA25106D7A9EAB4B03DF8710E6CC
+8D1E6C8B47157CD90899DEF210500F24D4FF8DA9053BF299C3D953375BBC0886
+0
+6BD17A48C76CCBF90ADFEB25AE9D4E0BF31C9B7440F4467CC229691C49FDFB65
+2E3DEAEB1591FF3868C072E222F4D695E003A44238C9D68FA1243B05C2FAC6EF
+0
+eccp_modified_jacobian_point_add 59
+27036DE3D78D0E29A74DC9F5E9B86DAC2E2CBDBAEA91957737E8A0BD2563E7F1
+7B1DE0E678878A720E1E125EF01074ABF47B5A78811A1D7B976C3DB2BBC5525C
+0
+8998A6A3E80ED64A11A559F1AFCC5E9227E4E76C46E5EE8C75B604C5CBA8E5F0
+0DB7A95B64570815584315343147CFECC2AF97229B852F7E96BBBA3AA413B17C
+0
+62702B871B394BC186BCA40295C35DAA254A6B5DDC7EF6E93EB71FAA09BFDC08
+4F8371EE1704D70F63BC39E8124F0872BD30B19CB76F98F30C25A10A360304AD
+0
+eccp_modified_jacobian_point_add 60
+33EAD78EA70E6B1358E6320064C406907E317AEF1EF4D5E38B6AB85BFA3F859C
+22385F7888E8C13EA0E2518CE05129CCDF8AE7342B03ADD629A655DA6EAF6543
+0
+964E88CCCF95894E8EEACE9933A0E6ACD3C68DDD49B80C024FFF49B133BBCACC
+0A8339608D89E3ACFD1AD31DBC88B0E6CF6DA5965ED350F0A2ECB0E4ACACF53E
+0
+6637F5C27AF40E2325FFCC5E55FA6A9E80C298CD30A7611568BA96A3EEF763A9
+955D0637FA497D5CAB3686B9E89D17F7427BD12C49D107AAEFD72F60BA2FD961
+0
+eccp_modified_jacobian_point_add 61
+63C2D604C4C8186D1E86AB3E531484B6DA0D666C02B8F399953F54E55BD07C48
+2AC51E0C396378FBD60B3419F1DB9156B1724141F5D3B367D0666168BF698189
+0
+326209D4F787B7BC45A992D393326F6C979433E6F826A6896ED884C3F6A71049
+3FEDB102FBDEE8D218F6CBE99F5C5EB59209EB6A1F8B678F4136CCC2A557A774
+0
+24F508E928E35FFA25E988395936E89E7C724C4802054879C3497C10BC2E7506
+346DFD8F7F5AD54939833B027D88BB0B07FB565E634C30A48266CA6F20276ADC
+0
+eccp_modified_jacobian_point_add 62
+315D1D165BD438F28A0B81C73F48E103075CC247A7F5540C08BE72A5E2BE3725
+77D804ACC59741E9AE2B6B306CCA0271547B269AD576A3495D7FA963CB483689
+0
+67DC7DC9B4FCD4695FE8FE55F1F8FC7C2C6ACE76C334FF096CA5EE6DDB86FFBA
+592E086539446A8CD28AB347B3F0AD310AB53A403C4C16C1A624FD64A74692F2
+0
+697F9BC1229B445771AC01CACA9F876CAD312A47E7E29079A067C535CE59692D
+7CCDCD0BD81E214C174BDCDFE536D9F2AB79602BDBD909CF000A3E5CD611835E
+0
+eccp_modified_jacobian_point_add 63
+49679B8A61C3F3C9592573A8630DBC72EA41A53EAE5EFF7A6028BBE97893F791
+505B0A2D96D7248481A8EBC1BFE310D8C19F72CFBAE46D3CF487D6485C662F95
+0
+80A3CDE363AE97419471C1515391952CB3588006B4831E900A4A09AF8BD12BCF
+9FD76EF9E7E6CCCD839A10CB36E0CE081C5844CA95EA23B1476B8E39E052D633
+0
+7D5BC6EC1E3A046C3F162914CA23D3E5074E5AAFE3165DD28889AC25C0B08F15
+63816C78F31326D4F7B23B8A879ABCDB2C80904133C86B96977BFC520F87A3CD
+0
+eccp_modified_jacobian_point_add 64
+3007C8B2D02ECD7F865D50E9914F0CF6737710323C51AE8E00E1E5A858B486C0
+0309D4051B9E65FD6B03E164FF1DE322266F0AD84BB8E0D366C181B329BBB901
+0
+9F1393A45B82963B323E1D3BFBCB964A560A5FB48CA9F45A81249063581B8AD9
+A44A359C1E830F7E787D819B98F88F54DAF3868F3816D8BADFDDFF59DFAE3A5D
+0
+16B618EF0B09E7209B202AAB49990F9BD90478E22875C82E986A30056628B03F
+7B146BBE0114EF5E45742DCB11B02A7178933E2164B0D6496D5020A0F531A753
+0
+eccp_modified_jacobian_point_add 65
+A09A38E21D41A7C8CD35BC4E86E04B378DEA3AFD541922E9EDB517337512BEA0
+2565E4005DA3310B21D59D9BD5C1CAC2E9149317210E9B5038FE2584D8C429B7
+0
+81356A81F16ED784982A55502FE103F90E2F649F21DB665B4C2BE93580A55261
+20B3A890DB6AEBC8C2A6F3F982B43B50DEBBD69CEA8A393F77D3868CCCD40804
+0
+34F6CF82ACA1CFD531BA6E7C481771D1DA15BAB211BA2AFB2B18A0F37CF266E3
+10373CC4078404DFC0ED98183C9322E5E2E41A70DC7F766F2877EE4F2F9DB1F0
+0
+eccp_modified_jacobian_point_add 66
+A058078E37DE7860F529A254A357CE076C0E29F9D3140A4DFBAB19C5D29F0C6C
+823202083ABA3611AF5C7C85DD4F23F74CAE64C11B75A2954178E45713D75E6D
+0
+57ACCB4AF55A0396781B9A9B0FCBF9C287BD3752B950920E5091839C764CC530
+965A91571080D0FBFD9F1C02B80B8DFD09A3C28D648E1D552F753FDC308EA8B5
+0
+0597149C69394E71D6E71C4F396FDBFF4F7ECB570834A3E1EE3A13836D5B958F
+5689F5ECCAA891B040B5370E3DF18B5B037E10972CFF7ACA5083C6B6CDC1A7DF
+0
+eccp_modified_jacobian_point_add 67
+7D966B931FB157C7F527BA1A6ECBA9970D2253382155318D48EEBF7344EC7903
+67A1F643558C5F7F97AFCA7A1B768DDCAD561FEFB1394997FF5E717189077A09
+0
+375CF0041B3DEB95D759E61C8D1126046FAB0F09C635AAF0499B77387A3D6624
+2BA7087068B6971A33A8F2AF0BEDEBEB26E26993F422D95E6737C98464CF5959
+0
+0A5D40255DF931471C7FEB593F96241949C1CD2400BE91DBBDF59C26C6EBEF6D
+3C7CDD566869DBFB6664AF85C8D68C36DB9804ED14E3DEF904C5E3C9E5B18F48
+0
+eccp_modified_jacobian_point_add 68
+1E31A8A7475A4AF803A1690ECDFC9E8F3CB594F0AC75BE7243DEFF3889F0DF43
+975A351105EA4C7AFA6FDF75E7427E621E4C871D8237FE45F57479F708608CB0
+0
+7DC58FAFA9FDCCF9572A03D37B0AA0AACACF1E6241E837562183D1B2CF0E08CA
+4C4E3BECE9D1845C0B9577EFA64AF0B72EBF51172F79D9D451C808F61F59C752
+0
+059BDD6A7E5FD10E05E8B1C71D19CEECED3245FAAB7E2C92B87ABE42B611B3D7
+7F9E10A9C7AA8E9D202B9A65DE309A00D4F3BE8E258126C7E09C2D31AFA63F9F
+0
+eccp_modified_jacobian_point_add 69
+79E517756DABA268A2BBDD6BFFAC268F041623F0F329D5D596F2779D558EE9D0
+1B26208B94B094F344A12FF01BCDC42BD6FC8F2E68B097D1814B4F2787C75DD2
+0
+503A921EB13166FF7845516406162C652114CF88D30A45C18273478B68DE25CC
+9D59A3E42198372600BD429C2F311779125D8291721EE62882DAAB84C4B88C82
+0
+6A8E4221C11E643836CE8C2043D54BD6C16D02BD399E0CFAF6C6107231C8182A
+2BF14901488B8D97EBC739B8B3C56A0A0C445E42CD3424CDE743EC3C10295AA0
+0
+eccp_modified_jacobian_point_add 70
+15B80ED963E59536B1D713C5C4F99043717B54EB9901729699C934C28A68FB1E
+899CA5CB4AC4673EAB4E8718367D9FCBEF267019B1C879E0AE57147D7C25CE68
+0
+587EBF5516B2B4810C6A5CF4A63964F481B94785FC6FCF801F5AB3EF2F986FE9
+802A548DDF670813E926D85DF5BB02F51F5A4DAC4D45F8CE1D9F423221E3805F
+0
+49C6A205B70F7A4F44C4C6495C73111BC4B416DDFB8A3853824421247047BCF4
+98809D7D2B6ABFF6E1142359B9A1273515958A2C24CF1D1020B355F7F1754EFB
+0
+eccp_modified_jacobian_point_double 71
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+eccp_modified_jacobian_point_double 72
+61FBDA5FA9BC5B6BE5B4F76138EE4F6829DC25F49CA2239F611ACC2524093D1D
+A94367CB33FCD1AB3559C7F0F487C3C751FBB42A815E803520621AE690D02BDF
+0
+2328B78B9590FBCF5B3FA26745174F464152581733CEE0A09B48A416C0939DE6
+A9C9A7B3F8D84D6EC7BD2BFCBDED5ECF68D7B6128DB64F3E487F581EE5BC97F1
+0
+eccp_modified_jacobian_point_double 73
+A70891A429B0104D5576C9B9F714B86215AA112C2F7A414AA17D19E6E93780C6
+8A31E4B0E108FBBA264060EAE6A3B71507B23EC98C1A23B47A25F210CADD8341
+0
+24CE5AB55314CE02FBA921D067E8B955C82BC3497AB1FB3C611C9985359343C3
+7AFB78B828917DE20C6344A9F4CD04B33E949FBC92F26A9470105CBAD33EBADD
+0
+eccp_modified_jacobian_point_double 74
+660763FE3DF4B3E3A00ABB04FDAE0ED9C25942480D022453A7D62977AFE603DC
+6A165293F997CECCB764CE3BAFB5D9B11713334D4600448B3992BE1869D8EC18
+0
+3D782A6E1C4C46EE39E3E7B2DA6954F36C036B6D0ED0A903E9A3514A640A3307
+1BC336C43380A49D7357D7F6D3DC4C47A4D49CDD1C20AB736341677F390AC9B9
+0
+eccp_modified_jacobian_point_double 75
+7975738B23EB40E1486077E6579002CE9F31B2DF93D4DFD48A25732B0AF61208
+9FA9995B5F7427E48FA227350291D858F57CB2C21D67C7D49C41A1192BDE855C
+0
+0FA368CD45874CAEEF61EBF0AD4623ECBEE70057ED82524C4AB51E0B5C5136A9
+82FD8B6705BFF31D75A177E4A9B155D16684086E06F09DF38E49666232966368
+0
+eccp_modified_jacobian_point_double 76
+555B4E5ED27CA8DCC9AD2E193870D887C39C6357B1E226B28D3B84846C9A349C
+79E44D77BE15E6BE50D8B0FECC1EF1C0935F10535811166E0BE0C6F1534B911C
+0
+3FA89A5A54AD4B15B046B7739CD4D674AD19F0B367D8082B01AB144DDF900C1A
+830114B9EA9BF9D5DAB08188B86E628F5E6D806D259A3CF2A579717707B0051B
+0
+eccp_modified_jacobian_point_double 77
+46B33990E2FA7F98FD76C7AE8C58531F4422FADE365FC5696EE056F284B70E91
+1230C58292EA473CBD35EEBAA1C0FB959809F6B2F50A5FBF313AB9D3348BB2AC
+0
+929CE18581F4D7B13A88BCEF6D3E43BF245E402E1C3996BA9BA8CF80D77FAF18
+2CB0F6EFA3F2B0DC589A3D0C2DCFC240B0AAC97E932852F86C04CA5787872972
+0
+eccp_modified_jacobian_point_double 78
+6629E82278553FA599FD80E3032B225613CD0D5D9729CA16B52037A1780600D0
+9411393F4B26A621EA648AE886BA6B518455FF7B5AEF2C9660E3881F634225B0
+0
+2DB77CDB1736743A8ECA3BFC2025CB4863175229630927FDEBC922A8E4D24E25
+427006A2C4928FE89C76B1EB31B81CE4F77F41C1F66EFFB09F3EF075B92FA2C4
+0
+eccp_modified_jacobian_point_double 79
+5D9391ACE4A31186BDD2EBDEA596F536F7A3EF5B345B680B81194A9B66AEB582
+151388CF0BBB36A3F419C791AB6F57F47C51A90B35F7F988117E5376C0770A84
+0
+6601A627B24D841A8F5F04D545E6D7465D6370AEF39CDDBADFE88B7A8139FA36
+3105F91C86C63C3C1D67253CCD3EEDD815FD8884F095C08260F7A3B3C498A58A
+0
+eccp_modified_jacobian_point_double 80
+A1411D1B58CA8BCFF63D2FD0E0E13C79C6C7177A85A835BC037300E81621537A
+419F1DE1ABE2914392E6BCD061E74C14CD9B0523D89E10994C8712D7777422AA
+0
+38F2CCD42890E57BD3A5A51B59F135D743D1ABD66498B9A5238EE5BD8824F0EE
+A9F0F9C149B4E1CD3AB164AD84E19994B77FF073FFEC0E48ED089E4B1356832E
+0
+eccp_modified_jacobian_point_double 81
+7A9AF415A4F682D95A361DC717DA5FB7948CBA8CC079F8E101BBE9BB7BD5D2A3
+53BD03E312B381F151E5B641529AC2501124E0682909AA185977E3DF466C5AB7
+0
+A6D5724EC77F966DFD92A540C3671BDE189309F3C41D4295DE9DEC324B98F093
+687A3DC1075034FF48DAA9C31BCB1A1D9EE88459F1DF343C5C6328CAA0242980
+0
+eccp_modified_jacobian_point_double 82
+054B6F6E01E237D866639BA735FDE241E57ED553C76AB2C4C3B8D059A043B8FC
+3D3529834AE388E70F0E038BBD270B5BB3EA446203F81C36E1C6809EA033CD42
+0
+7FF0A047CDE9230029977963AD0DDCF742E90DBA5D4BF7F0869E2D9C3670A98F
+925F84A408F3AEC2F6D9A988F53CEBF55E146802A524ADA3708743B047C8A86C
+0
+eccp_modified_jacobian_point_double 83
+3C9932BA2E1948B6C59EA3B7F19E0897313F3CEBAD996C522ACAAB0621420C78
+5C83BF8B812C35BDFCF86C95E0EE34F766792BC00FA5BBBCBE6B3E81C8AAB1A3
+0
+877A121C2B0E78D5AB7B0E9199FDFB7A60D3CFC58D18CAD1C40A8370CA04EE80
+3F55E040D75D5403BF5946D3EBF8BAE1CC790F5D7951817F830B9BB1325A9C08
+0
+eccp_modified_jacobian_point_double 84
+9B8EAC80E400A550E63F223A55B71655FE61276911B38180F771F55962514577
+38254F67E557DBAEFE1AD0B2C68AEB9F58A2303E05BF74C620E7876FBFFA6BAD
+0
+8A71D8A437015258FE67BDE375A44D15C1D13368FF1E3D63523C549B8196A4B3
+47094B4C57024F4DAE5AB32D733CD3CEC469BD7E248A49D87DCA21AF12092BD7
+0
+eccp_modified_jacobian_point_double 85
+1AF428552860D1B60DD1C7381957417F6816951BBDF45DC2A6172FB49261CC11
+8C4B871169492CBB2A6274312B63FB0C8330736CCD42305249E2EAD7F3100AF4
+0
+7C76A13E395CCED37BB93A0B532C3BD9910F3A552908FBBB330E69C248CA7C15
+02175D428DA9C2CAD2CF8DB83924FAA8F6BE22ABD9D49DF311D2EE89E360EF14
+0
+eccp_modified_jacobian_point_double 86
+2702C52E71E39B20D981892C3CB25C31B8503A19FBBD27D681E8D38312C4E092
+6B898EEE7AFE71A2DE6CAC5697A0030EACABF1DDF7F8CE3D3D627450E3E57197
+0
+03950A07D2ABE63DF0037D2A83A4366FB4C29C4715BC79ADF58D2C601F89375E
+45594494EA04881613F21035C843B8408C91EDAB051884E72BA318448443EB56
+0
+eccp_modified_jacobian_point_double 87
+8E8A2A8D8C3132296A9D731B74DBA2FC3CDEC2FE3A9EF3DB16B01857206FDDB6
+008EAFE674558A64246B01D5FC780EF1663373D43F9ECECBD2BC63201DBA8B57
+0
+376B53058EB10D5BA2A0D7AC5E21BC0B58368BE22E8F13A153BCE71F248C8B05
+98B542588EA78D8D7670B5DAB525E644A0D8DFFA0D8092317B0E76F35AB4BB1A
+0
+eccp_modified_jacobian_point_double 88
+1C6FBEC1FCFE5CF58CB807279ADBB9A5F3AE688EE30232123AFE08EE31A64231
+2E728AFC18F8B20C702FC40C3E9373EE8A6A5D2CB3A2005843A5C48CBA473A8B
+0
+3ACB492BDF3C9563371E2A26421F8499C36B346A4C3E18429B23B0C22F57D2A8
+9E3277E5F9A66B5EF3D4EC6348F5F4F50E5459CC13E9E481FAA98EAC17E7C22C
+0
+eccp_modified_jacobian_point_double 89
+436973B04AD1B35B23F0733ED27FAFFA00FC7E2AB20FB0CEBC6BD78C3CD5A565
+5732A7E6E3C7D64A3AFB2CCB69AD7247238916B2D177685DB3B2D715F7B0D51C
+0
+67DF7DB28C73F99C1E1B4FD9F7F3766203557B7179FE2981D4CD9BDDA0D01C1C
+3F077575FCFE95B3F07764C42F573CF460F8FD6606E532F84DDDA9243D6D5AD5
+0
+eccp_modified_jacobian_point_double 90
+07320685237A7CAFC2560305C688C7B48C4C82545671D6CC738765ECDD26F1C5
+38D1222836C3CA028CFD3CAB00EC0BA2A4B632CF0DD0500D73ACE5AFEAC8047E
+0
+28D225006005AF3372087D27710CE8FC1257A87A6329A59347970C43B9134270
+8D172BDEF88A629D04D5E5ACD849132D377428DD88F2AF449C33B5BAEE887E6F
+0
+eccp_modified_jacobian_point_multiply 91
+A4596B6A26EEF61107A3D9A1BFB1A6443B76E574E431A17E88A1C7265D1C30C7
+A14D28A02C5D8C7FD4F7B0F8080213B78C61CA9CC2D96622FA437CDF06EF0157
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+eccp_modified_jacobian_point_multiply 92
+771293493CE69D6B328D11C6F34C00CE127F9A0CDB60A401A7816F96201DCCEA
+3E54E274B4DCBEA5D436191E4963D513C6686BF1D0570204BBFB40C6DFB519B6
+0
+0000000000000000000000000000000000000000000000000000000000000001
+771293493CE69D6B328D11C6F34C00CE127F9A0CDB60A401A7816F96201DCCEA
+3E54E274B4DCBEA5D436191E4963D513C6686BF1D0570204BBFB40C6DFB519B6
+0
+eccp_modified_jacobian_point_multiply 93
+A28F184376F2A85EE39E5DC4A3F35202826DA2F61C1C6425CC7FAF8F2524B296
+A579081A0D0656CA614D4E7BDE005E3FABEC511CB9AE2A938DC0569FB70D899B
+0
+0000000000000000000000000000000000000000000000000000000000000002
+128193C846F0425636C7D81E6C928AA880057A7A7FED2E6AC6C14993579D14CF
+99D1CF02B4F08EC8C7929151398D2A35F944F576564A28DC983F7250219B6EA9
+0
+eccp_modified_jacobian_point_multiply 94
+824C8853EA913E64613C17840A67075B9B1579238DBB1BD72969A98F4165AE00
+81DDE6FA09A5E3332410F4C3C2487EB1F0E11D3AFD9FB3C4825B922AFD620D36
+0
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+824C8853EA913E64613C17840A67075B9B1579238DBB1BD72969A98F4165AE00
+281D70E19848C6891A5515CCDB3B0EC07D5AD8E8D7866C639DB7B5F2220C4641
+0
+eccp_modified_jacobian_point_multiply 95
+08424887A3959947BFB45BA82C935124926DE2BE5A17375122B079CEDE857BDF
+7053F65A8052B1737EED822A873B2CC694C3C0296081900AA4BD27FD6DADDEFB
+0
+1998F7DA1E07BFF3C7F853E4B46454F87A76D343A6ED3013A43E5CAC88951F06
+6EFCA1DC02FB92B8232E36FB1FD19C440E78013A4CB0DC053894578CB5562CE5
+50A693A351AC0F2AFAFFFD4243482CADF9B51B5C86702F8607154BBE211A0495
+0
+eccp_modified_jacobian_point_multiply 96
+1EAECDC4C6CFD8A9C759A9FC63FF0C5AF335BC0D5C34717A9DC42CD0FADA2235
+92368F51018400FA0BB4BDBAA8F9C8E22511A4865F966885A21622F9D52420C1
+0
+4D3D49D96F12B7948A5129660F442FCBC326A4506C727BF8B35810809DECF9A7
+2DA52C12A281CF6DCC0CD2399B6DEEE0464829BDFC9735A8367870E4ECBC52A9
+341BDA8878523ED902015F7D001B5960AA8B7CD365C83E785351DF786D8B3ED8
+0
+eccp_modified_jacobian_point_multiply 97
+67FB10A11B2AC4BA1E4677E3818339C48FE64E34FAD7F50BEC2844BF419F0341
+8EEA7CD94F069AEEB909D40B84F68361B9E1603097435593A54ADF3C5687031C
+0
+8D7274F9EF63B24BA01CB2BC890E1151D3081F27FDF12D06266292C59E574F36
+733E69975AD6D4BBC8B869852187946BB34CA0759BEF9BF185BD93538B189AB9
+6D9EA2FEA6A0B5921DF77190BA134E566279898427FD17396C916A59AD1D800D
+0
+eccp_modified_jacobian_point_multiply 98
+63E5875491B50E179BA683A2CC4C37E7877329E02D8CC4FFC4865A067BB3846D
+88073459585E42212D55D2E4943AAEC1605C61D923E4B407BBAC8199F32516A8
+0
+6C081DC20BED7DB83E7824AE435AB7EC95C05CB8A5C1D84092160E8E9B433CCF
+A5A143C9C0BF75395517B644942F36187CF8694148E2A210A74387FC3D2E6BE3
+37A2877E7CAC20A881C20E384E7AD1342BE244B8F818D5C349B75F9262B072C7
+0
+eccp_modified_jacobian_point_multiply 99
+3237775A15BF7E321E723292C493FE0A33CA443E2B5F2EC0B2E4D31999129CE9
+9B4472CE33DBC2B2607DDDE0D009AF610CAE6854F6B81D87FAFDB8AC864581CD
+0
+0116684AEA985543A988329AA7B9004BBB4A7ABD005C2706F2E880332867F22B
+7927EF5A6F87D70D93C0949BA77452F3D90F4081E13BBD9C7742FF543F7C25DE
+150876B562134663FD2B2E6950BA4137F6E6728E051C2C4106BA50E2FBE8ECEC
+0
+eccp_modified_jacobian_point_multiply 100
+74479B41037169E57C27BF471F943E5E0A5BE536A45F7E3213039C4BFA72BC95
+04FB98124DD65AFCEAC793A361ABE1780E7CF9F92B8C1E54897CF38C55EDAD6E
+0
+5BAEA23165D8EEC3FA6F2C7C49B042CD9FD99FDE0D7108472DE2CA50F40EC113
+4F48C4DB74B405C273AE2A8F6AA479173C334A9C199E208F0CBB0FD5E5543C31
+5083A91D86F09E1390C971EB713ED14A372446C019BB876D833688A7C38E654D
+0
+eccp_modified_jacobian_point_multiply 101
+1C898DD9B83FB98C002BE74A8A014054A290B8E1EFC09E8A6B2B956C43D3B41F
+862506159E78FB653E0E2C50FB5D7AFD66A19234620731300754C3FA6ACAA935
+0
+A818C89AC3B6521F0AE95D642BCE8E5A30066361AD223D66A3A19D8A054A1769
+0926106D7A14D5145A5E9C312AE0631FC82406AEBB63CC44F59C44D3B51150E6
+7DFE94C24D0FCEF6C9FBFD5CFD19BD185D083C20459836801FEEE63E0064FE62
+0
+eccp_modified_jacobian_point_multiply 102
+8742EDFF7D4B4918D4F4F1F7F7FAC929D02D00FCB3A111B91A5E62F4C671FB3D
+58169AE41FCCE0DA2205279EA13BC32CA4480B3138BF8ECCFE638B00C267D148
+0
+0CC0F86F13811E092E0F5CAFF072B171CF4FC9E40DD9F2110DD347230C881248
+2495D23E29AE16D4373152648A8F18B8C636465408F4C6B8BE04A99179CA2A7B
+1C599D60A6272F162D6718088EAA7AA036E5A48BBD2D4DD0EE6B1A6AF077F4F9
+0
+eccp_modified_jacobian_point_multiply 103
+1619F1AB95A2880173AFED3785D7C61C390AAAC14A17F160EEC420A85DD859B7
+0E77A7812F813E8705285D615A454964D3A42F7949D5514C40F2AAE3D5CB3841
+0
+8BD8141DC4F09D3F958700D9F0A4E870BE19CE3835A553F6CFF8AEAE592D2614
+786C51463CBDABA563753D464290CF48E44DC50AB52031D49668B6F1D290CCDC
+78F16D62EAB71BAE2CA09A3FACE6FD49757244BA532E4594300FF704C868027E
+0
+eccp_modified_jacobian_point_multiply 104
+3373D836775807B560BD8D8BBA3A3E1F6D31525F1A726A317A65FF864AA37AC2
+0996385F9B30C787927C3F293B7126F0DD1FDEE9D312631E5C879FCE8B50C28A
+0
+22062FCA70EFA521A5A52D6A301D0A540A802058E7B042FC9FC3FC4313EA149E
+9A91020C07D1029DAE7CF42226BEFCF8CDDBA66EEF6ECC3B16AD063AC4EE1FAF
+924AA872B5BBE12B304930716BD6E0D7B16E55092AA466A74A1457CAB720643E
+0
+eccp_modified_jacobian_point_multiply 105
+3705D65454AD51029F7D562FA89D165ADD2490548EE9C99F951FF71F65749533
+3D3962B596D5F74AC0A489D3EEAEF7A8677304B448BE95F4D72F9E172B9AD088
+0
+8F60D4DCE523E108597B9B673A2A3CCB726DEE2F22F37297995747E52985FCD8
+0C4751697678322B300E83865517384511A512E89C683F96CFC3BC5876F4BD6C
+5E89F888305698636C9EE1CB1D3B6DB49936FE5F3DDA966258406D4076C74775
+0
+eccp_modified_jacobian_point_multiply 106
+6B8B80D53B435409DCC9D50D3779DB30AC855D75C597ACDB6D8081204FEBB512
+984F07DF3AE3E957918E9326DE9CBA5C4CC6A4A937E61AC23BF14E079F1F99E1
+0
+9A8A4FF2C532416340F216EA965B51D425D7F5AFC19BD8FA75C6ACF13C4D5E61
+A6EC37A256223C2CD7744B88BC8FA2E91077A0191D7BE4800063EE69DCA7CC9E
+9981DB0F5056672E1238CCEF0E429FBAAAC848D3191C5AB219C736392DBE9A43
+0
+eccp_modified_jacobian_point_multiply 107
+2EB15B30FB7D2E27DBF93D56878022D1F4F56593DB70D2A04FB511F575C5008A
+A7339D78EAF772AC0825FC1245EA30AB0E10EAD0045808387A87AC0F5EBE7605
+0
+1E058D20923EADB444F96B1946D85E3D4A5A21283CAB90ED37A6B7464E7B2141
+5143D49CD2C9C38AE601E652BED4D86DBB8BFC1D9ACE7E9FB94C7A889E745599
+3F8D4A060B4442AE38D674138D8E1393916A11A0304E0034F98DEAA7CAC88791
+0
+eccp_modified_jacobian_point_multiply 108
+24B76DB0D7CDBE2895B6F42C8CBF16CC686B7C3B3FC1D0EB020BDA09405DDEDD
+81F3E844A78EACC8EBBD7AC821017F6F360BA66B8934528E049C731BB07C161E
+0
+48686F4BD18A093F36C7255AF1F1B760D75948211A96689E88EF6E4184F91EB3
+5BCC0A729BC227E58EF20182F1B4B89BD2B9FBDDCAC88A468E32D7BCF3107999
+31D31FD5A56258F9B56AA91B93DCD19E0E9F66B563D55D0AB2E9032C8BAE6FA8
+0
+eccp_modified_jacobian_point_multiply 109
+5B7D63A97E0DDEE124FA72147B5A2F332AAFBF62705DF22F8914422655534E63
+6B0DE8A2F80F71314BF19037CA6505EE6E015C6929ABA621DE0098716906A7C4
+0
+8111370189887E012883685508F2476D3E8638508FAF3EED4F343350E842CDCB
+9949654903BBC8DEC8753B08DA21F3595003D8290718A789D85C6F90B2CFA0A0
+0BBE70E14D85585048C63B6CCD212719ADADFC838173CB52BA28FC17A98B566D
+0
+eccp_modified_jacobian_point_multiply 110
+16E6E61E9F47EB3BB2773883A9A1DEE8402E5335D393696CD180D8B5722F2D7D
+934745858823D00EB50C46B6B36A2626F3B70B4A0015D000006980FB910C3456
+0
+9E0394623BA45FADECE5DADA37FF545DAC9355748FEC84058C1F396816B55E7A
+853943D6665B40AB1BDEC6B613A43E16EDDF809464F6FC9DB389106C2B1E2B42
+732FAABD4C28B85EF0EBF1C18CCA620638187535503195212B4E31246FFBE147
+0
+eccp_point_multiply 111
+41947A683CCBC42BF71F310BEEC3070E8D54B73007D7F31A1C44C9553D145C91
+A38D472F3850A031C01DC2FF4F0EAFFF6A6E978B63FC458DA3795C134770303E
+0
+0000000000000000000000000000000000000000000000000000000000000001
+41947A683CCBC42BF71F310BEEC3070E8D54B73007D7F31A1C44C9553D145C91
+A38D472F3850A031C01DC2FF4F0EAFFF6A6E978B63FC458DA3795C134770303E
+0
+eccp_point_multiply 112
+A47DF74222EACBEC1386E50FD9ACC039F01E9DF9BDBFCF3496C53926A5A09FB1
+5A068AA78C036167B825A88AC3770CC08A619A8C0D9C2267DC90CA87B41DFA2E
+0
+0000000000000000000000000000000000000000000000000000000000000002
+4A89C6A5A3C8D8DEF8B7233DE2A79EDA8D8459555666B11628D481EDB49E2307
+0C321832E6F7935DAD4D00929608317ED187FE29DD59A5E927B416AF0A063B1C
+0
+eccp_point_multiply 113
+82EB7AFA2A3F2D9C93D719F58D61D9D3D77802AB782904719C84F208B759C28F
+48FD54AB9AF3676A3DBF39CEA7DBC50AD8EAFEC8CAEDC9CF7FEABE418BF6DB03
+0
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+82EB7AFA2A3F2D9C93D719F58D61D9D3D77802AB782904719C84F208B759C28F
+60FE033006FB425200A6D0C1F5A7C8679550F75B0A385658A02889DB93777874
+0
+eccp_point_multiply 114
+7C7CDAD3DE47CFB45F64A817BD6654154BB730267558939CB45533E6CA64F704
+0316BD3D3FDC5F46F5A5B4C364A01A237FC4862A7EA305215BC90D758E0A713C
+0
+A9A0026D3E8FA71F4F130A21D50DE26728E570438EADC420A61F2A1035B0DF90
+86FD40DA501B5DB75B55B08D6E702DD89506C9F33EEECE7E7BB873DC981A266A
+9AED426A77AE39FCEF3D60628F156600661CA819116DFD6E5D8C683714983839
+0
+eccp_point_multiply 115
+3E8750EB4F3B2C32C16AA3400B0DC586912E3175AE55BE7012F43ED92370EDB9
+77B2A8FB4CCC72979D628687D636857FAD8B9A5A6010AD277B6A83080BAC72E3
+0
+7CC4D984E38E5AAA4F63DD8625975CF1D1000405233677B7E76A60E6AAD94FF8
+8049BE13D21AB3B8ECF8DA73A61AB144772368F0BB090E9D0A77B307D3181327
+86962FFE8063AB074EC2372F443A9EC99C27E2365820F3BEB234DF670C7E3188
+0
+eccp_point_multiply 116
+18917F75F2C2C4F7B68349C93DAF5408D073E0EF5584771F887C7A82912D2E78
+2B0605DF1120C4695EFF510A9FCF88426DBEE43DCDCFA8FCDC2690924C5AD3D5
+0
+614616937A5D0FB84110C2C0BD9363EBFD058773CA57A4999EED4E4BD4968276
+9B58F29EC10BF8B4712101EE404BC6F7C004F268A03A7F93BA9FA1D181B8DF5F
+4BCE5E9FD37F4B41915A40BF72F89BDD776C2AC66F415204D5915101C04CCA50
+0
+eccp_point_multiply 117
+19C9CDF7411334E91FCA1D3470806A88E103793A40EF8CDE8BDAEFC3575C34C2
+007AE2B32B758B0B424490820B9B45C5C380328F6CEA4D6D445F2404FBFA5CE9
+0
+8D7267C737759FD7F9A857E625A6810DC17A754FFE3108B012F9983BF821FCC4
+96786006118ED26F264368225220447566A26093CD417AAC3951BE77D0A1FB04
+9A9E75421E9BC1A442761211DC7A9362B127CC1004CCF1719B0F81CAE109B799
+0
+eccp_point_multiply 118
+7C53CBF6FFD70490DFE1785B376CD88DDC90D8EA9F24C1315A4CC7E182ACB1E9
+71F5BBFB7D5E7295416A9E404FC1083CE8980AB87E110F6FFA621833419C30DE
+0
+510038FB486DF35E915283E65933BC624A2AD19BBEF149C5D3E1B178BFE8FAF4
+834C293ED3188C642AA28E2836CC773A1148C9FA9AAA1F124ACC33AA278CFD7F
+A63395F2FBBE8A7DA98DA0D73375432C7DB93D91B70FF5A185A91446A38AF259
+0
+eccp_point_multiply 119
+7C7022A42C155C5486D43153609C46E0C31F36DB9AAEAE99EF4F19D5CD4A39CA
+31B1F1DE9CE70140D1C2CCE33E1CF671C4B4B46896E083E7BD385A67BFF5FF5D
+0
+6B10F20B4768FD0A6C96716C2EDD2D6D7F81A16A7D2020E6D6E52053889D2A29
+4407B4CA52C27CB844DBF6400667522FF2310B1800C764C2CA19B4D69600A3BC
+172FB742BE9AEC26F156CEA6F630AA32C7383DEBED7818D990F86F09FDEA6C69
+0
+eccp_point_multiply 120
+3B9E643AEB8FF75FBAA8D87CD016A625FF794D1C01E1B96463F705376E97B1B5
+85671AAEB019DF43A3842C15B245A9BAE2041F009FA99F9469298385EC4939A8
+0
+5184B76D964F5C2D1CAA39E43B5E6B5F319C6F7344884BCC06C51CA53493FB2C
+78C4D0E1C49704CE51D8702501F3A6CB2A92125009E10209794D89A659794A82
+A7ADAF7D6B3A31B888AA206E817D2E27934E17707DF3E82A2A7E631EBF60077B
+0
+eccp_point_multiply 121
+47858E77B088ABDFFECADC3DE1A012A76BD4B29F7B0C55EFA240BE0A94770918
+0374ADB0DECA5DD56A7057A63A80E93DF7E8C9298423B1CEEBF9C8B75FBDA369
+0
+A73EA3B346F9013D8816E3FFB37DA4E7A37853893C0ED0FF3EB8F718B0015F19
+617544C9186E4C205F88FCF616ABA2282B0F7137C9E89A645E47023BA496E599
+7AB17F8477E8CBEC6DA0BE7C010B84A739C387F89E44F01EA27B6F43298660A2
+0
+eccp_point_multiply 122
+22587062C3BC88572FFB19EAA48D049ED6574C39FA475D543260620E4E314FC9
+6D2DD20C2034580D6C38867E4C221BCD56B78D5BFEE4B7B998F06CFE22CC7EB3
+0
+912CF72FC1A8074352FCE7B7684FADF5812C897E5C0F456E10540941F6040B5A
+9CEF37F3B441061B34038385523B9FA5E85918685220B25D600C99E4EDBE67CE
+91D3056A7DC87FE3A3F1CDA87D57330B548E559FA9A6161E6810F64A75658C8C
+0
+eccp_point_multiply 123
+374A26E7C969368615D67168C6F65AC7C12F4716920790270024562E6B232A7E
+8EA441878B2B12C965A61DF2A6206CC52337EB223F50624B355F4D7BDE7AB20B
+0
+20A662E2267E8CEA8D9E2F5A5273E723D65C04A3C3625DE8FAE84EE36A2BA7CD
+06B5B5F5EE8C04BD5D6277F2CAA1229CD613531B907B0164C6D60324A5F60EB4
+9F4F47487B1B1B624FC2B58C762C623C960023E2E4BB27BAEE28AE04CFA0275C
+0
+eccp_point_multiply 124
+13B7D2B27826D82AB62ABC444E62CDFF79E653D948EB38E2B69A9166A58A42C5
+52115A805854C8EC261DA0BAE688331EB2B12049E8DBC575B76ED481FF67F1CF
+0
+47BC70F16072D5BDDADA51345DC080339AFBA954B2D6FB80503C2535E95B3427
+4772D01646A2DA76BDB1C099FCB78EE29BB93D236F2DDE7A01AC91C1622D4EB1
+4727FC8897C4A7C3C9FB5ECCACC050C8A3FBF97B60E7423FF19478D6D4A0E951
+0
+eccp_point_multiply 125
+8E86F1EE619AA43E9DD42CE02C03C61A0B1654F08ACC76753C5536E862FA8208
+66DB1DCBAB6D761FF77812B6772F9E918882F1152539B2D6C53DC23519FFDAB4
+0
+86DDA3FA831AAA11AA93A20F8D053C92511DA5B67DED7FB955632E8BD6B7F2DA
+37E9DCC5A06C9D872769D51E1BD30145F00413E49D17A24BFDAA1A6F49363C59
+5929976D36E08A9CC47AFEFC2FDC6762CD34DFE1F4E8C9B8C6968191CB9EFA27
+0
+eccp_point_multiply 126
+584FC9FBE6C63398BF334F0B8A6E5A226251997F2E7260A6BD6046A9F968B381
+66C748B1F9C9EB4A5BA4F6A266040D1E2D786339304AA6F808C3240683FAD7BC
+0
+369027142F9480B03E317CCAD00C8BFB3D8C0955F1130F1CDE14ADFA6C72174E
+0F63DBDBC6C9F567AD816B4B2C6FF459CB019A6FDEC75EEB824830CCDCE822CD
+4CD02938A3F8304F235813782A7996FB57E54D15A1D8BB2974E05A3CA795AEFB
+0
+eccp_point_multiply 127
+A9C8B321E313A18714ABB41155788ED6E619892C33AC89C841809A47A6510105
+8D714EE3FEBEAB9D4BB8EF0FEE4EA46072B76BD753C73FD8353D86376A339172
+0
+4107C26D1248319D80EAA730CC82E175451AB22664C7A98752537E7A9A644080
+686A3AE06AEEB7CEB386AFE792090EB4B17A0B4A1E3209037A446A2C318819DC
+81C52B59D5505A9856813E1BA3A1C55E78F53C15855031828A4ECD60C22137E9
+0
+eccp_point_multiply 128
+2DE189FE8618D2436C52FDED8C704DB79A972AF9A60DD8798C77F3EC1D7B486B
+594A5907AB086CBCA8E26FED79DEE9C333E9B5FA19C9E7B84C659BD0BB80A42B
+0
+1CA3A272F3AD5442BD4F0F49DDA58E0838D96039C506A7039B3DC51DA4EA0CBA
+72344C85010631D766D407FDFA7A5F06DD23688381038A98DA6DE63C7A5AB08F
+838148628F4714625D9620302776995FA9F8127CEE93618A09A3536DB4E1B2CF
+0
+eccp_point_multiply 129
+168C9C10E0FA21991FAD37011FDD797CA7C2D415AAD8ED3733782544AF3CB371
+163BEA04BCFA553857E9D4A57DA47602DBF422BB0CAF0130BBE69BCA1A5AD2D0
+0
+19DD7F25239D158BF02CE7286A8F4299C320CF743AC7E3ECA3E5455AE4B2C48F
+498E30DC979B1997282D831AB956811566C5558510C488472D9298F4A03C7CFF
+639B5AA9C1885449CF035114AD860507E569BF039BF0F2A5A2FB79966290A5D7
+0
+eccp_point_multiply 130
+3FE5C3F7B8B78229F654536667F04BCC1B63E44E12F463EC249D270756095732
+3BDB5FC31C00B9A2734FE5CDA5BBFBBD8319AF956117C8D9C8E8A869397C4836
+0
+72CC2D7FABAC3BE534E49D6F64DB2C35C270EEF8FBC37023D7CC8A7F4D54E6BB
+70CA676433B624113F89B2E5BF6EEE3A701FCD66D3D4A011B8A2B56F5D69EDC2
+A610B038F7E3AA6F270079CFFD55FE86A265495A0C46386B49322954B09A651A
+0
+eccp_comb_point_multiply 131
+0000000000000000000000000000000000000000000000000000000000000001
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E545C1D54C72F046997
+0
+eccp_comb_point_multiply 132
+0000000000000000000000000000000000000000000000000000000000000002
+743CF1B8B5CD4F2EB55F8AA369593AC436EF044166699E37D51A14C2CE13EA0E
+36ED163337DEBA9C946FE0BB776529DA38DF059F69249406892ADA097EEB7CD4
+0
+eccp_comb_point_multiply 133
+0000000000000000000000000000000000000000000000000000000000000003
+A8F217B77338F1D4D6624C3AB4F6CC16D2AA843D0C0FCA016B91E2AD25CAE39D
+4B49CAFC7DAC26BB0AA2A6850A1B40F5FAC10E4589348FB77E65CC5602B74F9D
+0
+eccp_comb_point_multiply 134
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+557C5FA5DE13E4BEA66DC47689226FA8ABC4B110A73891D3C3F5F355F069E9E0
+0
+eccp_comb_point_multiply 135
+58D041F0CC2B52814D8F7CF4CC1D175CFDA90EA859574C98F09CE426445383EE
+6D1A9FF53267C9DA9ABB7EAC39B29EB7A57FA1FA486EF9D53B0862244F8B31AD
+5F2D386DE353DBCBF2486B5C4E10F3790B4F5B7A1649E735FE2564A74AB6E9AC
+0
+eccp_comb_point_multiply 136
+0B547147CE602C81DB9EFC873949748E9DC17308D5C8A9C53B8CFB4932CC8803
+5EFB76635F70619DC45D2141A14512099067C7F932A26CAD8F14BDC275B2B105
+4814D8A5AE60D41B8BEB3ECE833D949A39442AA76FB08D513A96700A729FBC8C
+0
+eccp_comb_point_multiply 137
+3628E3F4E8B992CF85E4384F2C669173FEBCBB41E013CF145B64D62D92F18423
+A6583EF16F6FDD725EDC78567F6AFD4FC029408DA812207CE0352EF8B24ABC52
+77CA44B137EF3BC71E9A275851772A2EA0D7F53C6B2B2EC4A9E2C9A3021B2B9A
+0
+eccp_comb_point_multiply 138
+81DC4C2356ACE09B51610843EAD3037CB82D1FBA41752A7E5EC053CBD982B066
+207F0BAAE08CA363EC202499AE22891ED38CA51DD6BB406766D75E751328B6C0
+1BD9010A5948DEA32EA61D34DDC86EE8483DA872C3C9391B67677D71662922F4
+0
+eccp_comb_point_multiply 139
+287D5C0C8BCB862C6022B0572450DD3317BFFB7D049DBFB68152E5BD7C99CFC4
+84303225CC7FA33D90F4D76363E90DF833E0F20986F0927EF02017D2CDE57749
+8619E7A989F21BE8556979B52144B0128FFBF1CC54487201F970DBCA63B6175F
+0
+eccp_comb_point_multiply 140
+99267421DB8E97227FD17C6022949D0B80E15CDAC8C6CA5BEFEF1CB2896D9FE4
+4502F720BECEA73FB8312477F882CC409986C056DD4C3D76B92E987B654ECE6D
+4A7D88D51853412465674764636436BAC86D586CB560A58DF4DB33F34D00AD86
+0
+eccp_comb_point_multiply 141
+54629E02AC851B86385528542A26417777A5A95CF4FE506441C3441267D82D41
+4BBE9CB40100B49EA66ECEE12EE8A54D33BDF6D8E02B2F2F5B54738BDBD19165
+A95606E7EE8EBD0780EBA1879659BCDF41FBFE5F73D849F3EF2D3CC7B96FAB3D
+0
+eccp_comb_point_multiply 142
+91BF7E2CBC441AF2F041B8811F4E8EBF224FF85A272C019593C0A72A123D6353
+55076518D0DCB063DF90B632036FACDB620BCE49724EBD8E468F615D27B866F2
+90E70B6301CAEE1ADA40F05794D0F443C75DA1064FCB63F3D17231BB8DEF96BD
+0
+eccp_comb_point_multiply 143
+0984E45B3FF7F6B4C3D95451EE9DDF581DB73B39746A6EC34F3B21426FBE8DFB
+A7179C3FFB350FFB0C7133206E030B8D2C269912AECDABFDD3608690DA418CD7
+70A4987E0516925CB47D1BA4F330B13560D4AFDD33204FA212B6ADFE64A79FA1
+0
+eccp_comb_point_multiply 144
+04CBA01ECB179BA10AE22EBC7D05FBEEB9EDF048AAFD7D368B7CE038AAE12D5E
+259A9FCEBA000477A342D10B56E2BAB19FFDD0D8B35927B92141DBA32FAAC357
+1C5BE0CFBB650D5C1BA96740E4C3790C46BE483746CD088BBFE4D184ECC404FB
+0
+eccp_comb_point_multiply 145
+1C5AFECC04EE512A5245B3F74094E4321BDD8929B879E442562BFF7B8E8E972E
+965BF9096CDAB7D0BEEFDDABA9D8A9CD184950C011856966D470989F4FEFC829
+057970F650419ED033FDDF5C9D0713BD0E715BBCBD44864916E368083500C4EA
+0
+eccp_comb_point_multiply 146
+152636C6B682920A96EEDEDAA18502DA78A90AF59FD416E2C6C51F63CF430E68
+7644F6814FCDF6D8697912CBC592C015466E991B6D74569BB16B821D260F5BED
+5BEAB39FE3A8AB9C8DD25852B0654B2D5F45AA383118C5304D30AFCFA4166918
+0
+eccp_comb_point_multiply 147
+467CF6E78C0F6BC0F4275CA08D426DC9277FAF33412F776B6D7539F918230F73
+8ADB5FFAB5B5D68C82B29D9AB4C286A9AFA7601579CC7A782200789A2551F9E4
+2BB3DEBD5BD6B39736025BDE7373529F7F431B4FC7D732E29D6C10914BB6014A
+0
+eccp_comb_point_multiply 148
+64366E71CF55875E02CC391F78EF1D4973AFE19E405735A26599B58CD9383850
+97020C788FBACA30D76EEEFF58D1B2A7B9C18D5D474406A684DCE5086D74E238
+94A2F57A04174C9A5EDFAE95768060E05ED59D43DE4C20697C6EC6238AD160FD
+0
+eccp_comb_point_multiply 149
+7AF826788CEF40C9F30658D5BD09474FF650ADBDB0FF2F5377AA34BDC586B4BB
+1D596E90B9BFC3AF4C139F95B88484C2CADE9A863DE6062270660D660B8C2474
+41F518D075F8C07A80F2958D99422AFDDF4FBD7FF80D636F4738A06BB92B095F
+0
+eccp_comb_point_multiply 150
+0DFA83AEE0C9443E7F9DC66DCF77FDF0561934FB200B3D40F56FEEBDBFEC02A9
+676DC6372C9630CE1813A762BEFC43DF62606A96AA66A5A47A817B8B5F18C82B
+3988511BE4BE8E20713E3F654E0A74636935E856668825281D98BFAD15835467
+0
+eccp_comb_precompute 151
+4
+1
+eccp_comb_point_multiply 152
+0000000000000000000000000000000000000000000000000000000000000001
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E545C1D54C72F046997
+0
+eccp_comb_point_multiply 153
+0000000000000000000000000000000000000000000000000000000000000002
+743CF1B8B5CD4F2EB55F8AA369593AC436EF044166699E37D51A14C2CE13EA0E
+36ED163337DEBA9C946FE0BB776529DA38DF059F69249406892ADA097EEB7CD4
+0
+eccp_comb_point_multiply 154
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+557C5FA5DE13E4BEA66DC47689226FA8ABC4B110A73891D3C3F5F355F069E9E0
+0
+eccp_comb_point_multiply 155
+47CA10822B65FD8E2EBB535940BC1C2CABE16152C56A285B141EC67B7C9D6196
+47EB71B4A5B005804411DEC15DB30829DF8F0384507C0168A09739CD0C0A0D67
+09E87D6A93138A434AEB9C287D649ED1810AF22EA030A53A70BFDC96AC9399CC
+0
+eccp_comb_point_multiply 156
+99D7CF5DCEE029A7D7392F988AE730F7F65BCBA67F0807EBB9B6675F96E8F1EA
+70E3DE4777189187F3275CD45127A2C005B5E3BF1E55C6C6178D3C029C8EB7F8
+1AF41CA9435C93ADC15D8E5D7B258D2BB11C80D286BA51CF38A9B4EDB163AB38
+0
+eccp_comb_point_multiply 157
+0498CC73DB101A32791980513FB5F5F4A2C8FAEB74DB3152186E7BABA9AE1174
+6BFB1FDFB7FA962204B4D45408D964CAB6DDE2E9B3E5775F75181098513DB21A
+1F007858CBED86DB417D311AE1026E5276220B2D76D237E0566EA4ED11CF3083
+0
+eccp_comb_precompute 158
+4
+2
+eccp_comb_point_multiply 159
+0000000000000000000000000000000000000000000000000000000000000001
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E545C1D54C72F046997
+0
+eccp_comb_point_multiply 160
+0000000000000000000000000000000000000000000000000000000000000002
+743CF1B8B5CD4F2EB55F8AA369593AC436EF044166699E37D51A14C2CE13EA0E
+36ED163337DEBA9C946FE0BB776529DA38DF059F69249406892ADA097EEB7CD4
+0
+eccp_comb_point_multiply 161
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+557C5FA5DE13E4BEA66DC47689226FA8ABC4B110A73891D3C3F5F355F069E9E0
+0
+eccp_comb_point_multiply 162
+82B6B599CC001ACE16B9E21FB3CF3A4153E84B4D88AFAC51604A28BABB6BA3F9
+7A5A5A0F758DE2F93F81A15098CC0C9DB76BB168D5B608C64FEE9952999307FD
+1015D927191777785A9C7EEF96DE22F1250BAFF39DF2431A6A9A734474A4E2AE
+0
+eccp_comb_point_multiply 163
+7DF93BCB99D3A52D48C4B8B7C7FF48B5A0DA8F7CB65AB7F890A80199430F0279
+73BC8098E79B061B00692D6CAAAA7165062EDD3A8651D9DE2A87573FCBD4275B
+8CB25A0AF5C68AD7D8FD6117669C14B140F42E5B19FEBF02C3128161E7AFE835
+0
+eccp_comb_point_multiply 164
+60D3A83337A569E8E0EC3799359F26525A1DCBF1DAFA250B19259D23E27FD2A1
+7077498D95AEA06ECC1E0FE2609CBA59AEEC3E8E885B3983FB1CBB57363FE05F
+3547988818AEDA78DAD395D3FD92FFE9E744D53756A74CBBFEBA0D239C3970E1
+0
+eccp_comb_precompute 165
+5
+3
+eccp_comb_point_multiply 166
+0000000000000000000000000000000000000000000000000000000000000001
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E545C1D54C72F046997
+0
+eccp_comb_point_multiply 167
+0000000000000000000000000000000000000000000000000000000000000002
+743CF1B8B5CD4F2EB55F8AA369593AC436EF044166699E37D51A14C2CE13EA0E
+36ED163337DEBA9C946FE0BB776529DA38DF059F69249406892ADA097EEB7CD4
+0
+eccp_comb_point_multiply 168
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+557C5FA5DE13E4BEA66DC47689226FA8ABC4B110A73891D3C3F5F355F069E9E0
+0
+eccp_comb_point_multiply 169
+0ECEB0B4CF6B08CA3BA3FDA10D3846637B494F42FD3886C110AC770D28CC8DE1
+88A0E7B4CB8167427D00F7B7456009E894BE55A6C068298D399416208EA8608C
+11EA903FE2E649D12B8C76537405BAE9ACD9943519B441D023B90F9068EE8180
+0
+eccp_comb_point_multiply 170
+1C4D6BFDC432D149087AA9A86C16D65C7DAFCD2F1E6F66D224FA8260F66117D1
+5D1544CBC71DC867E13A416DC1A95B0519197B58840C7B630B00BF3F63B51DE2
+3377005853A6807753F1BB6DA780D643158C7BEF0B97604F4D2939AD20CED05B
+0
+eccp_comb_point_multiply 171
+84476E26B468D9B2C5A74B9A00F038C9ABF005DCF59E7D8F8D1AD5CFA78B3104
+A090EF99ADA93983E4FA9974E789136340411A5D09B10D4CEE7667FA7AE54998
+5C03B280FD58AAD06934511D429778ABF7BC0A9F8B9D1999B6018A9D8138C7F4
+0
+eccp_comb_precompute 172
+6
+4
+eccp_comb_point_multiply 173
+0000000000000000000000000000000000000000000000000000000000000001
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E545C1D54C72F046997
+0
+eccp_comb_point_multiply 174
+0000000000000000000000000000000000000000000000000000000000000002
+743CF1B8B5CD4F2EB55F8AA369593AC436EF044166699E37D51A14C2CE13EA0E
+36ED163337DEBA9C946FE0BB776529DA38DF059F69249406892ADA097EEB7CD4
+0
+eccp_comb_point_multiply 175
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+557C5FA5DE13E4BEA66DC47689226FA8ABC4B110A73891D3C3F5F355F069E9E0
+0
+eccp_comb_point_multiply 176
+A3B76590B7DE2332DEC60336ADFE76144BEEA4441E41B9C1D2031A34658570C3
+219CF39B1298B8AB8FBD8955F9EEBACF0F660E15C9AAB01B531921C6818A4234
+9D3A1BCA851B7DD2A3E80DEC53DD95F25CAF87CD470C8A77C6D63C9AF1D1B84F
+0
+eccp_comb_point_multiply 177
+A9ACEC3C49888E6D7753E15A03F5449963D351ED916A5940F2BC5C5DC0C78F44
+8B677E8747DBA699578E836E8902FF6AAE08D8D9C8D300AAFA2364FE97D8EA7E
+629F3474AA78464939E94E463BC584B12D57C68394BDE47DFA2E7A8AB9820971
+0
+eccp_comb_point_multiply 178
+1D6479F25240532D3B4B10E4ABC1C6D8CF462502323CA382F92DAB82C1E84E17
+15F364CB164A8336F7588D68B3586693E503B3EA443D4AEC218F6AB7C086818A
+083C1DFFC8F706523339BABF8CA84E3EB9DB3DD4CBB8CB313958D1CC74B36DBD
+0
+eccp_comb_precompute 179
+3
+4
+eccp_comb_point_multiply 180
+0000000000000000000000000000000000000000000000000000000000000001
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E545C1D54C72F046997
+0
+eccp_comb_point_multiply 181
+0000000000000000000000000000000000000000000000000000000000000002
+743CF1B8B5CD4F2EB55F8AA369593AC436EF044166699E37D51A14C2CE13EA0E
+36ED163337DEBA9C946FE0BB776529DA38DF059F69249406892ADA097EEB7CD4
+0
+eccp_comb_point_multiply 182
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+557C5FA5DE13E4BEA66DC47689226FA8ABC4B110A73891D3C3F5F355F069E9E0
+0
+eccp_comb_point_multiply 183
+6BA668351E1BD923121B522B5552A2AF1AFE7DB0BBB947277DDACD908E888CBB
+A3F6514087691CAC05A5C5F3D15CC132C30D378153F4D0D97CB75AF4C0A94E31
+66751083B6F718A578A59ADA5897FE3E5CE58244654E607EBE8393DF0E74A243
+0
+eccp_comb_point_multiply 184
+10C0AA7622C556A92B8EB1EFCDBA1877319FA3EA743AE1D176983C05F6DB904E
+6094956D91F9B1FDFE68B46C8A553C0B7796329BC4B0EE532DA17AC3F149E20B
+A92615C15726352F2717A1E399B6A1B7180E5A6776F07ABCA14185269319CF3E
+0
+eccp_comb_point_multiply 185
+465CC667C4666BA838C089649999B4112318F92D00F38C1039B65455F5990E3D
+7D52D98831EA46B662AA7D3832FFCDA16CD77E920B09041080512613551D692F
+75D518355F6275E8F7E2679A366D7E5B819DEA6C06834DECF5E4AD9C8B435E83
+0
+eccp_comb_table_file 186
+1
+5
+2
+eccp_comb_point_multiply 187
+0000000000000000000000000000000000000000000000000000000000000001
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E545C1D54C72F046997
+0
+eccp_comb_point_multiply 188
+0000000000000000000000000000000000000000000000000000000000000002
+743CF1B8B5CD4F2EB55F8AA369593AC436EF044166699E37D51A14C2CE13EA0E
+36ED163337DEBA9C946FE0BB776529DA38DF059F69249406892ADA097EEB7CD4
+0
+eccp_comb_point_multiply 189
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+557C5FA5DE13E4BEA66DC47689226FA8ABC4B110A73891D3C3F5F355F069E9E0
+0
+eccp_comb_point_multiply 190
+697CDCAF5274BC83E4990D570E33AEA9F8DB5848C8AE9A746A2FBB67AF6A7945
+56D45CDADBAAAC730D610E113CDF963007D28BDB6DF0E7FA4C55D8292368159A
+21AA61EFC4A50BAB5B3444DCCEDE8BBF94F6D71E35E13839716893DD5733954B
+0
+eccp_comb_point_multiply 191
+1DBD13C0AC76B2916853437149C1FCB429CEF413E2EA7456935C9EA94B58A171
+641DA16C72714DE60C7DD849D555CD9007BCAA39358884641BF6571E40E06F2E
+08DB91C8DC8E3EDD29FCE2A175782AC11B7F13DB802997328A4FE2B6EE8DFAA9
+0
+eccp_comb_table_file 192
+2
+6
+1
+eccp_comb_point_multiply 193
+0000000000000000000000000000000000000000000000000000000000000001
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E545C1D54C72F046997
+0
+eccp_comb_point_multiply 194
+0000000000000000000000000000000000000000000000000000000000000002
+743CF1B8B5CD4F2EB55F8AA369593AC436EF044166699E37D51A14C2CE13EA0E
+36ED163337DEBA9C946FE0BB776529DA38DF059F69249406892ADA097EEB7CD4
+0
+eccp_comb_point_multiply 195
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+557C5FA5DE13E4BEA66DC47689226FA8ABC4B110A73891D3C3F5F355F069E9E0
+0
+eccp_comb_point_multiply 196
+06EEDFA7E51D6857C96FAF477FFD8D9A6924B65B60D8D5C40D789F286F52FFC8
+139580275277BD7A74A3B66B00D6124E6516CF717EEEB6CCF389A3CA1267BB1F
+56CD2A57C1004DC2DB502C935651EC2B2ACD9CB81CCF52B5855F19372210D210
+0
+eccp_comb_point_multiply 197
+9EF65FAC582BFE042B9CF1A22681C4062308A5E963AE6AA5532F3B44A87DA6D4
+A6AE604B8705244F5D5D3D2033E406804A92E4E068F940487F9FAB4A0B02BF85
+6FF79020BA1C7260F0D0E5ABAE059456CA606A95824CFC4C4D3DCE381C18964F
+0
+eccp_comb_table_file 198
+2
+5
+1
+eccp_comb_cr_point_multiply 199
+0000000000000000000000000000000000000000000000000000000000000001
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E545C1D54C72F046997
+0
+eccp_comb_cr_point_multiply 200
+0000000000000000000000000000000000000000000000000000000000000002
+743CF1B8B5CD4F2EB55F8AA369593AC436EF044166699E37D51A14C2CE13EA0E
+36ED163337DEBA9C946FE0BB776529DA38DF059F69249406892ADA097EEB7CD4
+0
+eccp_comb_cr_point_multiply 201
+0000000000000000000000000000000000000000000000000000000000000003
+A8F217B77338F1D4D6624C3AB4F6CC16D2AA843D0C0FCA016B91E2AD25CAE39D
+4B49CAFC7DAC26BB0AA2A6850A1B40F5FAC10E4589348FB77E65CC5602B74F9D
+0
+eccp_comb_cr_point_multiply 202
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+557C5FA5DE13E4BEA66DC47689226FA8ABC4B110A73891D3C3F5F355F069E9E0
+0
+eccp_comb_cr_point_multiply 203
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A5
+743CF1B8B5CD4F2EB55F8AA369593AC436EF044166699E37D51A14C2CE13EA0E
+730E41A86A0FEF1FA9F629D5261E6398355CF0846C018C2196E86E13A082D6A3
+0
+eccp_comb_cr_point_multiply 204
+86833DBF0C14AA0239356523C1955501ED591CF8D6AE16CDC3307796E04FF610
+6ED1F7F7F0FEF99681C883EDDC036381D8DF962FC92DACA71B0104FD9591A78C
+07EEA2DBDB3FC85AAE17DB24A38D1BFB8E44943DBAB5B78DE07058E0D111A80B
+0
+eccp_comb_cr_point_multiply 205
+1BEC2D9BCC508EFD47EA2DDDD04B3EA1C54BF023CC6AF0182A60B66141551A9E
+06D5966040A1D35AA1D6C8D3F59F5E9C0AECAD046C153E60849A75BB0C006331
+64618298EB10B9678AB14061FD12ACA8FD410D4B4F12A9DF0384E3FE8825FD9E
+0
+eccp_comb_cr_point_multiply 206
+352F8714FF861A60047ADB302EA232E054C46198E01D15F9DB402669E15BCDEF
+4740D96B682302BBAA4DEEFE588E248FD45A399F30D13E6B673577626D7B4E6E
+030CD762C968BA57A45D7A75CF22CE325306D14818019756BFB1B1AE225338DA
+0
+eccp_comb_cr_point_multiply 207
+39B537E23A7BE4070CDD34D8C9DD90A62F36B43DB4F3E2B67EDE650558C46CCC
+190196B0F56C545FA86CA03377ED3D24A8F97E2BCF51EE8101012BF16E8A4F8F
+0B88ECCF9667027EB72EDCB4551E8E0674ACD9DF39FF5882357540D4CC21FC17
+0
+eccp_comb_cr_point_multiply 208
+8E4D64C05E9D6A6336491D91B15241CB266E92809E95CBE59CFBB3FBEAEAE8E4
+202FF5ABABC63A28EBA8000F0825DBA8DC4EF2554476511E24A3D95821E9855C
+4ABAE113BACF608DFCD4EB716818F32008FEEB6F94E944D090A0079CEC9A17FF
+0
+eccp_comb_table_file 209
+2
+3
+1
+eccp_comb_cr_point_multiply 210
+0000000000000000000000000000000000000000000000000000000000000001
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E545C1D54C72F046997
+0
+eccp_comb_cr_point_multiply 211
+0000000000000000000000000000000000000000000000000000000000000002
+743CF1B8B5CD4F2EB55F8AA369593AC436EF044166699E37D51A14C2CE13EA0E
+36ED163337DEBA9C946FE0BB776529DA38DF059F69249406892ADA097EEB7CD4
+0
+eccp_comb_cr_point_multiply 212
+0000000000000000000000000000000000000000000000000000000000000003
+A8F217B77338F1D4D6624C3AB4F6CC16D2AA843D0C0FCA016B91E2AD25CAE39D
+4B49CAFC7DAC26BB0AA2A6850A1B40F5FAC10E4589348FB77E65CC5602B74F9D
+0
+eccp_comb_cr_point_multiply 213
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+557C5FA5DE13E4BEA66DC47689226FA8ABC4B110A73891D3C3F5F355F069E9E0
+0
+eccp_comb_cr_point_multiply 214
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A5
+743CF1B8B5CD4F2EB55F8AA369593AC436EF044166699E37D51A14C2CE13EA0E
+730E41A86A0FEF1FA9F629D5261E6398355CF0846C018C2196E86E13A082D6A3
+0
+eccp_comb_cr_point_multiply 215
+3F5500281219567A8D148E28922D1047824334C79163C1F1D5397B21DE4F0F8B
+85668A7CDEFDA860401D8C00D1AF8924CB1B3FD1FFB5887C4BF050A7B57E186B
+292DF7B5F3F2C11F39AE98B4C51EA900A633E2D31BF618048345F4E2CE99AB0F
+0
+eccp_comb_cr_point_multiply 216
+922AEF0C6606E2FEF636C2F84B69A8D799FAB4C43498F9DBF6B096757A48CD6F
+32231C4EA5C546363F28BD8E324B3FA77BD50CF470C134DC16B4D58B2BDAF171
+5F3F352C0742D49DB9D91EA4717C42C6BC7E046F28D25FED576B2AFE813A3CBA
+0
+eccp_comb_cr_point_multiply 217
+767DB3891E312AD306A79D2FB66C4629A67725F452BE9ABCE3C18B1A7F961CFD
+748560C9735B7828F2DCD1E1769738CAF2E23E381228DB5DAE14579567B851C5
+2EA01A1180BD75FC7BBA98559EDF05892FEB922266EF80857827BBA3EF301E24
+0
+eccp_comb_cr_point_multiply 218
+7A86700719DB22F34EFAD33392D6EB5EC06298F3930124E1296E67869CBCC56D
+3BC815161EDCC1C97FF194F49739D61BA1D45A55D33E30B5DA75F17385F2ADC0
+517199B0F5C828A4A6F28FE7A2E1ECDC035575004F153AF8ACA31EF5B3AB3815
+0
+eccp_comb_cr_point_multiply 219
+162086AE2C460432EE6166092353E7132DF08ED06B4CC46DBBA9D3BBA22C826C
+39726EF872B2DEAEB3E2A378E63396B807743690A0AAB59653DACDF9C140F8AF
+9CF0309A37220BBF36227505FBCBA2829EB1DD655A870DDEA734D8A5CD71E83D
+0
+eccp_comb_table_detach 257
+eccp_affine_point_pack 220
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+eccp_affine_point_pack 221
+3D4F46389C6BDCBEC29905448024B40D878A7D6C4B65CEAEB6103A55DBE08750
+3F06FDD82624AAC5F412255288C2F92749D40949E3D6662AEC6E4AB96F8FFD71
+0
+eccp_affine_point_pack 222
+764A382690C9E8C81204044E85E5A237195210AA8BC2B8FC4B1F255652A3A76C
+222B5463ACD3F12837A286246E57BC3656DC1FCE594B9D581DA6FF6EB2313330
+0
+eccp_affine_point_pack 223
+503FBD15B080A9950964ED19B04667426AFCF6113656CE04BE5245831915F9D2
+46D1DAB4335ED2DCE9E75570C80B44624331E7D514E73874C9A5DFB3D7060AAD
+0
+eccp_affine_point_pack 224
+2AA418EF0A09062E747FC8087F09D3C7A76E64ED9785441530375E98A5E04A6A
+1F452BB9B1004E20BAFF65067C9F47750CB04B813A249D7A3F000C1A1154484E
+0
+eccp_comb_precompute 225
+4
+1
+eccp_comb_pack_table 226
+eccp_comb_point_multiply 227
+0000000000000000000000000000000000000000000000000000000000000001
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E545C1D54C72F046997
+0
+eccp_comb_point_multiply 228
+0000000000000000000000000000000000000000000000000000000000000002
+743CF1B8B5CD4F2EB55F8AA369593AC436EF044166699E37D51A14C2CE13EA0E
+36ED163337DEBA9C946FE0BB776529DA38DF059F69249406892ADA097EEB7CD4
+0
+eccp_comb_point_multiply 229
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+557C5FA5DE13E4BEA66DC47689226FA8ABC4B110A73891D3C3F5F355F069E9E0
+0
+eccp_comb_point_multiply 230
+4F6B9F21C931B1BBB554AE5A1BB22B50D9FA416AC1073D161DCA67632B6012EE
+44E86E50FB64F7DE098E54097D38635996E0762FE4DDC152BF092899555E9BB6
+46A6129A4B8343B32AFEC63C6C8F33C32FA339206E3444B3C3FDD84AFFC2E371
+0
+eccp_comb_point_multiply 231
+826ABDD41405EDD83257309D6E9E5ABC735101CAC792E853AA23986D44178170
+2834CEBACB3E0E187DA2C27C143D7EC448815190F80710044A0E92B64E6ECB05
+2FDE2AF208B25174CB68904CEB2334602A98310DA24C608B64B845D967A69EB1
+0
+eccp_comb_point_multiply 232
+7A0DC58C7C6A0D59DECB32848ABE3D47E6794D80CCC52214556D30F318312322
+2308E021D14A305CEE8211BEE18157F8CA7EBCD3A46B4894CB2FC9386A28A977
+5775F5C58A1A0135C056B8977F6743205C8071D9079DFC5063569016372C18E1
+0
+eccp_comb_precompute 233
+5
+3
+eccp_comb_pack_table 234
+eccp_comb_point_multiply 235
+0000000000000000000000000000000000000000000000000000000000000001
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+547EF835C3DAC4FD97F8461A14611DC9C27745132DED8E545C1D54C72F046997
+0
+eccp_comb_point_multiply 236
+0000000000000000000000000000000000000000000000000000000000000002
+743CF1B8B5CD4F2EB55F8AA369593AC436EF044166699E37D51A14C2CE13EA0E
+36ED163337DEBA9C946FE0BB776529DA38DF059F69249406892ADA097EEB7CD4
+0
+eccp_comb_point_multiply 237
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+8BD2AEB9CB7E57CB2C4B482FFC81B7AFB9DE27E1E3BD23C23A4453BD9ACE3262
+557C5FA5DE13E4BEA66DC47689226FA8ABC4B110A73891D3C3F5F355F069E9E0
+0
+eccp_comb_point_multiply 238
+416FBA9A0FE0351C27E009277B7A9E406FA3B685B0FCEB3824AD69135A29E0D7
+287980B33E02F881D7E3AF3997F58216DB4941D2B4433997889394FE762807F7
+A179C0029F5A02F7D741990F9ABCFF11C7DD5A8021808113C056708DC3D69632
+0
+eccp_comb_point_multiply 239
+0F213A798C8C0EAA4EDA341DD8BEB206DA168698504C799E524EAB3D99D907F1
+1883F46355F17180DA335849525BBF18B8075599A705DC3163BF024885DFFBA1
+6D5B2C46A8296579B47D234E032A43DC31ECD22F9820530A275B4D0E2E482C6D
+0
+eccp_comb_point_multiply 240
+95B8DFF697935F2E8288C41B8D2BB0DF3A6CD2CCE257C77AB2A0AE8DD9D5841E
+1C799019A211ADBC57B3E2DA1E95E3E9CEC97AC8D35B9CDD78D6D973AAB8BF6B
+4B97D411CF8A082CB78F7A9268B0288410173526BD23606F576295482F765B1B
+0
+eccp_batch_add 241
+5
+9671C166650ED64AFE71E534A8EF72EF88B0B21FF1AB165344538BD41340B117
+5B3EED891658A02F370DD3389DE66211B11ED5B8BFD1A649DDDA562B02197F78
+0
+01BD76A91D5E6530B56C9642776A1A4EC0A1B61F6F7852E27B6D654F13CA509C
+8311B5236A51D126FA42FFFE6CF9B8474790C1A1EC3CDA4362E9BC7260FC71A8
+0
+4B7ED2F6F593B13E1841FC9873862802037B2FB35EC9DB4109CA2ABDC7CD269C
+913E260977925B8E41DD57311864E179ED62339D47B35D9A5E20F3E5F447299C
+0
+91F1AB81F4170A150B38FBAE3B92B43A1995F4E4D58A8D87033CC07EF191A7CE
+6C45D928FB66D475BD01E774AA39D7C25D9681BA7799057FCC220525C924B887
+0
+91F1AB81F4170A150B38FBAE3B92B43A1995F4E4D58A8D87033CC07EF191A7CE
+3DB57EB2A687D5468164231BF349B5B010A574695D8D1AA853F142F756499AF0
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+8500C521CF77C197DE352F0C7E06C3535F312FD83A72EEC3EBAAFA6E15E4013B
+4BAB5336ED056EEA06761A8B9DB85410B687CF0472C8EDC580DAD73524AE81CE
+0
+8500C521CF77C197DE352F0C7E06C3535F312FD83A72EEC3EBAAFA6E15E4013B
+4BAB5336ED056EEA06761A8B9DB85410B687CF0472C8EDC580DAD73524AE81CE
+0
+032B497A91B174A479541447A4E721031A2657CDA9D5654484D5BD3C5BFBC746
+96C47244CF097260F6FE422EB0A6BB5258F33D26B8E8D30088477F6E0148A0D0
+0
+032B497A91B174A479541447A4E721031A2657CDA9D5654484D5BD3C5BFBC746
+96C47244CF097260F6FE422EB0A6BB5258F33D26B8E8D30088477F6E0148A0D0
+0
+8C0F4B0189FD5839604CBB0797C181F2751594FC07F577F8CCA5A932D71DA95E
+7754B63F88E23C4D6B6E64A6E5BC0975B857BA11C1260DA9B401BCE8EFCB1F80
+0
+32193D32633B22FD556EDF4BDCA1658082CD257C1E3A49EFBD1AC3A6CC76E861
+996F3DBE924B040E6D52301D3E0602B905F2C688889492D5C42D48A7ACB3D63D
+0
+03BB25D2C284520A691A8EA20B34FCBE6189EF3BF0FE1757D9C41079AD8D909B
+8CAE72742917A97918107278DCCA6E183728A78EC45751F37F447C3263E97DAF
+0
+9126B610DA910E03684D10D3DBF921CE5FBAA214E203163E49F2A6D59228432F
+4DA881A0FB82D0C401A70488A47BB8951AC7DD57F578B530991D0409A656DA18
+0
+eccp_batch_double 242
+5
+90F082BACA74988EE1C04D6F66AE0510015ECB7A2669EE86A52105F06E2250CA
+2226F7DD26C08309729642670F58B16D0F46A321F63108B0B69DE201CE737ADB
+0
+A5AD00C1256336B306DBFC834F471CE94687B557C10BA5B2C705217D553B9C32
+5BEE341A29B0CD96A7226F72170FB5B75EC925A56DEB1C356EF87C2FE0E3857C
+0
+5C3F693481492EDD25F9D48C81AB93E0413F4975A4242EB771701B1C4471A82A
+3CBB1D05F2090EB121C03DA039C7DFC72B665C717D19432136AE223410901BD5
+0
+59AB2B4D24ED438458BFFC48F27243D234EB9D31B3499BF4EC0B19A3B19F47C2
+3A9C9AA878CBF9A64768E7037CA4CF1F283179B7F9AAE6A2D3C49C62E6BAA2D8
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+98780D9A7C4825A09082FD09C7FCAFEFC16E645A0F9AF4967370042D66BD19B9
+20BD0A47944DAA68EF2156AB52620A8E4D31CBC1D67DF7B02D6082A253343FA4
+0
+435BE88B3D5C740133DB8F655941AF432E220A920A79FA819E5C5C147D00BD3B
+965F8B45156AC92243753A51489C7BCBE88FDD05B8FC7B9B755E62DAA4A8B552
+0
+A92FD8DBC7C1C8158A849B1215F7867AB8438820C7103DA02C91ADE510977495
+71D782B1C8B9BE68E383BA8E3E71E05273CBB9AF481686F95DE8CBCA573931DD
+0
+737848BEF7767F0B6E8A4735DF6FD1222444809A4C785F9CA620BF97EF2BD37E
+761832CB1208A26EFBA3F6BE5629524119C06CBB7B7795513D8BC2D90274C5BB
+0
+eccp_batch_negate 243
+5
+87048EAD22A5B590705307E5BC695F41477597CAF9F4D2F1912201AA218DD31F
+7ED5A3C23B76D0500FDA1586961A862EEB84917FAA0380087E865E69B8F2D5D1
+0
+87048EAD22A5B590705307E5BC695F41477597CAF9F4D2F1912201AA218DD31F
+2B25B4196677D96C2E8BF50A0769074382B764A42B22A01FA18CE9B3667B7DA6
+0
+9F52741D21FB5D4E6FCB3125B022F1C4DC634273C9EA10238A6495A400D64D7A
+251B500787611CD5A25C516FF052294352FDD1F22DAF1F25C858CA42464DD7E0
+0
+9F52741D21FB5D4E6FCB3125B022F1C4DC634273C9EA10238A6495A400D64D7A
+84E007D41A8D8CE69C09B920AD31642F1B3E2431A777010257BA7DDAD9207B97
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+1BF59406679B54A1B850C9A9E7567FA7B75F457D2C9A0A448FD8A3C55DD6FBE6
+1BC681CFB3D8DF8689D210F314973F5057BE4B13BD2CFCB64AD7E4710E958FFB
+0
+1BF59406679B54A1B850C9A9E7567FA7B75F457D2C9A0A448FD8A3C55DD6FBE6
+8E34D60BEE15CA35B493F99D88EC4E22167DAB1017F92371D53B63AC10D8C37C
+0
+88FDDE0D32E01D85028578C80354DE12E3A102F64755F7395AB467930F6741DC
+57827D86B70B23DCFDC26DF6F8C9589EC2108A8982C93DAA98AEE693772AAD57
+0
+88FDDE0D32E01D85028578C80354DE12E3A102F64755F7395AB467930F6741DC
+5278DA54EAE385DF40A39C99A4BA34D3AC2B6B9A525CE27D87646189A843A620
+0
+eccp_batch_add 244
+8
+58E58602B7CD5A0184BA6697360720B350D791B5BA628A026E540A8B5A3FCF42
+9D286E3F279B11620AE75AC4C84C551D708B2855E59F9424F61369488595BEB7
+0
+3080BA7C69060AA95CE4DD126A1920E1BD24860101EB8482E8EAD0AD63F59E6A
+64E832F143AABAA3955A51F1A62B306EEAE008C8824E44FD3BEB9D8FEB59206B
+0
+7E0C7D31E3F045D46CA3C2C6672DE785710DE1877E80346AE6E8F4689CA20C17
+46F5AD5E097E9939E0407BF236FD29B17D6219170E47A6807323D5A0AB192D62
+0
+38714BCEBF44670D81D2A33EB56B52116F0BF4A057EDD22C036486B6F996E3C1
+70170F0998CD2E1FFBBB4902E042A70092D0D844B623A5E3F1AB5FB945BE856E
+0
+38714BCEBF44670D81D2A33EB56B52116F0BF4A057EDD22C036486B6F996E3C1
+39E448D209217B9C42AAC18DBD40E671DB6B1DDF1F027A442E67E863D9AFCE09
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+810B7F7A840D25481E4525CA996042E1FE69455AF8A4D6802D81A8493F91A921
+7A0640B67427C25151984FB4694F04F7F3E64FAB28E4E49C2A95B950229DBE41
+0
+810B7F7A840D25481E4525CA996042E1FE69455AF8A4D6802D81A8493F91A921
+7A0640B67427C25151984FB4694F04F7F3E64FAB28E4E49C2A95B950229DBE41
+0
+42D94BA15564633BA62D2F00EDF6275E1D6B6969CD72E38BDA66F682DDACB3C6
+631040E74CCC7691C849CB330DA2F2DD920668BD58AE74D09522F206F8768DC2
+0
+42D94BA15564633BA62D2F00EDF6275E1D6B6969CD72E38BDA66F682DDACB3C6
+631040E74CCC7691C849CB330DA2F2DD920668BD58AE74D09522F206F8768DC2
+0
+9971BDB3D9BA8C0BE1BBE441724476663D459D948C0E56B7AA50156DC6C8928C
+4A583010CAB21512459F44563286222B649943D3C2CA945A31E0EAA472E48D9F
+0
+89DE1F89DB4C09CF870307BC0B8C3C9A01F110DD33A93EF1F67DA1D3C0EDFCB8
+15D01339EB41DB3BA2C3FF9986F3DBB6184236BB4785713BE08501612172D05E
+0
+087AE88B9348AE7A6EA9025DD89BFD95DD2F0F29A3DE97A11DE80B4745ECE7D8
+600E5FAFC26FF4F2827085AFBB6B04FEBA8DE98B76E9160905728158C3CE6346
+0
+00BCF2E85DAE2B1411F1921F0154D6A1B362368809B6E650EC9953EDC2976926
+3DCB07D9F16FD511A859A3B60EB3E30CAD7E12AC2FED7B101666CF81141A9632
+0
+9D8A21C5F8BE381B13A759325B504B4E7C74D991895ECFA727B19B6DFC2B242C
+25CE3CEDD7CF41FF45969A3056B289B729E67BD995823740A732D5C18CAEA57B
+0
+11B3D3227E28D933CEF74D839D3CA597E47A737AB5634D5E046763A2DB349217
+0884F2EEB14A69B5D956069B71A15074275E14F3FEA6BE63CA093649D13523A6
+0
+84431939D2047CA07709FD990FFA86F0EAFAC8AA67732B279ABAE3FC614DB415
+174F587910F8B635AEA919C2F8CA7B6CB5655BEA58080686532E80A0FABECF15
+0
+570946066AE9EB5A708F1EBE8BBE2012BAD6221ED3777984256D929C594DEA8F
+6A6E1C3D9CDE68166A038950BB9CFF2DE3C7D44A199F5EAB058003E833F0D98D
+0
+973E6A08299CF903078EAF1A1C21BB3556FB0D620220A8437A54C994727D31A2
+8CAB4F12C6DF27AD9687230051206E16521E4BDB1E12D1CDC3ED6C895AAE1E47
+0
+7C8815E972AAE8B31704905657813A60CC03DBBA6EBB92325D74C5AF20B86FCA
+79F76F4D4920F8D1DDFC2CE36022D2EA0E9A837DE9A9807FC43FCBFDBC7CE20C
+0
+A50B6D55BCDDB78AAB2754A375B9DE56F66ACD6B640D66FC58480A58A24D62B1
+402265752D501D5AB67FC69C8C89FEEE23E39D3A4BAFB202064F3DE37CA7459B
+0
+A65EEFBB6C673A7D4F5AC229D94E1E98EFDFEB457D31AB1643D7BD8B1143D78A
+9F32507248F98C3B05EE9BF39DB4170D73E16120E177D2D3C0A6DA92C19A7FB7
+0
+971AF3DD1BACAEF318AE6F8BDF05301084E8C2B7155AD8267BA3E5BEF44D1211
+3F5C7B948554E86BF7D30041BA2AB4D1B79FAF25D511CE4A8B5C1843AAC3E680
+0
+eccp_batch_double 245
+8
+66968AFD5D94C17471F6A169051FA35EDDFC31A5C3705072C6DAE050A589A2C2
+1FF55C082BCFD5E02164109BA5CA3428B631B84F6A5A71426B5711C9874865C9
+0
+765A6E2B1A97AF41E34CA782C2B53A7C60C0F89599F40A2835A362BC81C6A6D7
+1876D43EC6956E0121B2629B40BCC694AF7BB72C5F3F25CBE7BE098640B4FC7D
+0
+79BD72734E5C03B491F81499F742DFBE70C7EE0FD6EDE6A191208E4601B9F97D
+6C79D14D1630FD34EAF1A65C097306C3976BC5E059441DA2A6F9A51304FB7F1F
+0
+5005DBEAEE845A1C68A1EAF9D54EC12DBDA9F1B5EA8C426B0F2EDEFB5F700CF4
+487B8BC535164830E28F4064DCA564909F18D85213B08D7DD0C200388FC7F204
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+199010AF7A2ED430FDF69EBE45469CEA425E9FD49B3BB1A05CF0B5A850D9A6C7
+9F4EB8478AACDD400E3F3C923D440000B2F3EEA42858CE00BB6EE868769D683E
+0
+7C6700D19BB80F8A7C91F7FB25A7D62CC15D45C1ADE16F90EAEB455B8324FC39
+2A670ABF9D54D39B5834A3FB898047D3BDAB2B926C1F21C9A7319648DE9B710E
+0
+6AD3AD0901E2BBD49A31CE7CE4664861D6CC773BD8BBD8F880CD4F3CE7892384
+78911448927085488FA9351B05E351F5B0F22DCE408BB6D646D8ECAA7BF60602
+0
+0C7ED48CF8983F517CE1D1E25BCFF6B6A6AA440D4EACED500FB1818C18179C92
+4EB9C0EBD38AAF3E798411853777E2FB1B5F9D3A23FBA399728B8D8DD8F518D6
+0
+41BC3405AA4B95C25EE47FF243E05EF5F1D8D8478D182B3379BED37AC1D7FA6C
+0F5B8988F00785D5CA281AD919F27F804ED49259E2CE79970D6CB5882BABAA68
+0
+5283EEE07D59DD93FE57C473D1BF3CC3DBA74725D7C50FDA8E9FA44278298D28
+3E804A3C2A1505E475D7ED5599258929E5D373839AC67AF26EFEB294FED0D184
+0
+1B15D87FA7AB4B20579FD8EF4E483DD7C4C70FD62BDF4698BB3F8A0B791BE701
+3B2B390349CE6D39F4CACEE684E3DE956ABB995586988F7712E509F375C394D1
+0
+6F0673AD73B0656B3BF1D32E002EC82D30DB0F52464C8981E750A7C54677D0F3
+9425839C71D567BFCE6D13A3E98824E64D86CF8C688662E505EBCA2308C912A7
+0
+5FCDFBB47BAD6FF6CE40AC8455AD3276ECF98ED3DEFD6BB8760BC9488907581B
+0770D505E9CED7C6C004FDD390B93007618AA373F2D90FF3402E094B8D9AE497
+0
+9FD16693227B2ACD6A8137122A6A1CD81FA3744F17AB630BFFAB9F790F88B3E3
+638DA5AB6AD7ED73CD0F0B62E948A66B35B27C47E92B5A55229C8C7B7AF7A931
+0
+eccp_batch_negate 246
+8
+54E36EA4710CDD6BD263DBC3488782106D131FC8D8809E1E70EC8C08548666E2
+40B8C4D5E8C51B5A9178AADCA9946CFFE427CACA415523AA41B6434F8C7E41B5
+0
+54E36EA4710CDD6BD263DBC3488782106D131FC8D8809E1E70EC8C08548666E2
+69429305B9298E61ACED5FB3F3EF20728A142B5993D0FC7DDE5D04CD92F011C2
+0
+7197EDFAB9CB3C1BA64CD4C95F8BFE72D1010F8DE49E7335389933AEF080E13A
+25E1705A81BA335DF0B607C9D1C9B1BED2847D31C8D79B49A0AA6C6F82EC758D
+0
+7197EDFAB9CB3C1BA64CD4C95F8BFE72D1010F8DE49E7335389933AEF080E13A
+8419E7812034765E4DB002C6CBB9DBB39BB778F20C4E84DE7F68DBAD9C81DDEA
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+A25F344431355D49DFFA348F2DC6EDAC4A2D215EB04A4FD6CC1029589407A7C7
+A7632A2CC972D1F66608EB00B80B90137E0849AE310A58E22FE21DC68D051B70
+0
+A25F344431355D49DFFA348F2DC6EDAC4A2D215EB04A4FD6CC1029589407A7C7
+02982DAED87BD7C5D85D1F8FE577FD5EF033AC75A41BC745F0312A5692693807
+0
+928A71B7D2FF01AFAFADE46746BBFD6134684FB4EE2CD60373121CF058659B07
+46A6EBDF256256149ABFC2557A72095B9F0997BBAC83F447E405B8981445315B
+0
+928A71B7D2FF01AFAFADE46746BBFD6134684FB4EE2CD60373121CF058659B07
+63546BFC7C8C53A7A3A6483B23118416CF325E6828A22BE03C0D8F850B29221C
+0
+2867B11F02A1F2FAB527CFF5DD9C47D88069A9585F41553AA675C6854A06EE44
+075ACC7964590B9E5CEB19CB7CB8BD3F7D04572E2EB1A64174206E428F0E495F
+0
+2867B11F02A1F2FAB527CFF5DD9C47D88069A9585F41553AA675C6854A06EE44
+A2A08B623D959E1DE17AF0C520CAD032F1379EF5A67479E6ABF2D9DA90600A18
+0
+9094B2066BE1B8672B10E48A6E650A03FCF2BC4D4108CED839DD1243945ED6EC
+5B1A5AA3F0EE4EAE2228CBE4740958C5365888A307A1DEBFC52950DE3E73A30D
+0
+9094B2066BE1B8672B10E48A6E650A03FCF2BC4D4108CED839DD1243945ED6EC
+4EE0FD37B1005B0E1C3D3EAC297A34AD37E36D80CD8441685AE9F73EE0FAB06A
+0
+472ADB2B9DC446714463AF749B60674AA8A3266C05698C0B413FA77836F2A5B8
+3EA7A5DACB6B688CC8945713F1086D340549EF5E45A199F81D9EDAA9C148EE2D
+0
+472ADB2B9DC446714463AF749B60674AA8A3266C05698C0B413FA77836F2A5B8
+6B53B200D683412F75D1B37CAC7B203E68F206C58F84863002746D735E25654A
+0
+eccp_fixed_point_multiply 247
+2
+1
+7FC38CB7509F7CAC90A57BDC03A0158B19A28FE59AA5186FFE57B288F82051EB
+1FE36B138F4BE907E57B3A07432CE9A3AF502389632D7501306B5932FA1A5AF2
+0
+1FBDA72AA970ADFD8CA6CB82BED870C0E1B60D90BE3BA1D60C57CCAD3985C4AC
+7FDF2038D3D279F6B44C8F99DB9B24EB2B7E7D1B0728357AA4A473EBF0122A37
+1EF5D8C410F0A4EEFF3C7BEFB430C96948D47768431D4A98B4F0BB1C2A530C2B
+0
+eccp_fixed_point_multiply 248
+4
+1
+1DB8AAD23C07A45C066A415750539E884B800C07738ECB7BCA8C727DF6F5A271
+31DAE9F8ABE782B5997443A92817A57D82A5781D116156417001570EF0D753AE
+0
+121E51475D85801B1A41BD85004D991B7B0967631F48814B569F3ACDB187AEAE
+A0D9A493332ADECAADEC0ACC86C2E099E150D80FDFE018DEC235C5406F047DDA
+74E38EB05E783CE11A38367AFC1A192E496B9BC3693A53EAC363B58A85E52BC1
+0
+eccp_fixed_point_multiply 249
+4
+2
+6B359F58BB77A6C189A9C9F84DEEF29DCF5CF29D8805E7741DC3DF27DD516878
+7BF2329E76A2DE38357307BEAC404691F7A2378ED63030E29407E54458AAA43F
+0
+8933DFB25A14FD3ECA010F4F6CEE6F8C5B125A260A1521C30DDFFFEA3FCFF360
+593F530FF94CB32EB1D512089C417E3A96C2D0850DBC6005C04BA9E4EECEC469
+2BB120B9567123ACE197553B5867085EFFA4206390297C3B188B69C54978CD77
+0
+eccp_fixed_point_multiply 250
+5
+1
+3074F288CE4A230BF03D4836A9308494697C6FE04776035256B31B6FE6AA26F3
+0B17410FFF862445764CA909EBF44110747B5A87E76BD1FB1C00655A59D4246B
+0
+58583D8E0C1EFF6FF5AF1262353E46984A09D86A83CADDA76B00A786BF566111
+85BA1C4D5CDB6AF94877A8C32918E7E799D2281278387D45989360C56EC176BC
+3E8B53F82CBFA4BCB04C5651AC563B9DF84CA7F7CF857AEFAB997AF80CDFF8E6
+0
+eccp_fixed_point_multiply 251
+3
+4
+242B67EC62FFFAA6BA83A5B00A1BA311B69EBAEF518EAEB06BAF3E47636D1A75
+80F50EB5121D04925146C33DC54911F806429CFDC1784AC153A51C17EF504A09
+0
+8FF71E91B59EAF2E593397DB84EC589B6353A7BCD1F83B48FB922E79F6342E35
+60BEB532B86EFF6008B2D57B09340149B23C97375656832FB567826ED6F85CBB
+4D658C089348B7BB5FA85CB795068AFA04D4A370157FCDF6FCC6587267BF6224
+0
+eccp_fixed_point_multiply 252
+6
+2
+67111BDACD53B34335082FD2F36CE47C9455A01BC74AB05F4A026EA5C31F124D
+8D76779CC460851151E6719422324D794E60C0C02ECE618964719AB3F6BE9DFC
+0
+2810CEE038F58700D4127337BABED3C5BC4FFEAAD63F7D712947407C40DF0CDB
+605472A322049F5F2E5B14593793A318FBEE26C1C7A18D41D6668C3F720296C6
+6E2F3878EB00B75B3A01DFE0DFECA55556BEC0ACE885C5804BD85F204B3C675E
+0
+eccp_affine_points_validate_batch 253
+1
+57F4F2805BC76C00B23A77578AECEF8314DB573A510FF38DBE277D2BE2071036
+3C5E40EFA015678A374A9DFCBD0F7F78C299701B1B0D67F80914D37F8F952447
+0
+1
+1
+eccp_affine_points_validate_batch 254
+7
+22B6304E960E19331ADFDD4CEF0B70D8222B7B80339E0171DA8DC5D3F410AF6D
+75B01DFAE24F7C7B00DC9AE98A5499488B4A9FEE22A90D74E6C0C925BA38E759
+0
+1
+1569847ACD64FE4A5DAF495368A7BF7B1C5D3B2840D138FA6A15C00E15DE69BD
+1BF2C40767B4367EC17F1F9BD2ECE44D0CAA3E4AF648AB186155481B7FFEC6C4
+0
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0
+CDB6FE18D1D7BD20806D4C5237239619A8E57D97D57CBF34F053D7A4B75470D9
+5582B7C3CA9300C0785396106F4CE3D462E4D56DFEDC34FAA60267D4EDFF63CA
+0
+0
+8709F8D8B6C4EB0A436A371AD0C966B1CB8E64D779E09986F3DE32EB4584C2D9
+D62F42A5F45378C10D44D0F3EAC29E6FA0C9D6BDAC1FEE88D60110635F986444
+0
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+0
+0
+218A59304E8113ED22C92A3CB30508A5BE0C6ED60B8215F74E7CCFFA3EE51CF5
+A94E9A0087FBB435127EF8B6AE71E78D4464AFB2819429B4A2187CBFB57EFCE8
+0
+1
+2
+eccp_affine_points_validate_batch 255
+20
+96E8D6B21B16633C7ADEEE6837091AF736BC0ECEA116F9489538FAB616B3AF82
+5C17886869E13C3A48E43EDDB382C0FCB2103067FC13C2A3130647F5DCF28A4B
+0
+1
+4A758AA1878E98FBD8C66636A6E1B7B31B75FD3E3E1889829E4AB4BF2311D244
+9599EA2613225A92E785B902E0976A4194DF43FD6C14E12B66A6FDCBD936C70E
+0
+1
+A3ADA5D573ED4F1C37AF29C8C3B542833B34FFF705903CE0320E3ADA26427827
+57895EC6BE6629274B9F83981195285050CE6258D1585C304A76678522DB0AD2
+0
+1
+454790875507E203C55A1FAE4A799C7D0CC570BA083DD93C3E717F64641602A9
+83CFA68A7BFE375FF8B84B48540E2AF67C0BD20B11DDA2E0539F3F92322B1A40
+0
+1
+47F6403135B56BC4DF361FDA2CD5598316CE231E6CC203F9B121B94A30EE23D4
+7239C8EA8AC99E2BBFB14C4C19AD2573375D677E5AB147C93A30B31E30F25F20
+0
+1
+9495983AEB6757D1ABC5820A80E9168C16E2F058AFF5B7AED2E0FDEBEAFF269D
+1F62E249208A11F88A4EA2C92D54CFA7E6F2887E76F52629E4BC1A0527C4E1DC
+0
+1
+8FC0FA2021327A8623806856282E9AEAAC8D1006B2EDD059DA04F7F457749DF8
+A7FEB91A1586AD2DCC7B2B1F6823ABC526634556046C69481250733273684CDD
+0
+1
+9892E344FAC89E73A68B18EAB4B6B52EA0274C2E29B810BACAF310D90E9E9169
+342B5A677A6792E06251BF9C2CD57904AFBF0C39AE11E6FB759F71CDCB549D91
+0
+1
+3DB2DE339EE034E35F4F2BC8544F4C8CE9F895A7B6571A31DD7793806F30DD32
+2F2856AC8094F37F10CCF6592D9236B1C883E393D93EAE0D80A1727206C152EB
+0
+1
+3831D3E594DFBD57897BC4E00FAF302ECE6CB20B4564449CF12CCD6EB97FB375
+1DAD7A8E284F28B1B09B3C4195E612E91AC3D3675C0C87C887A76D0F7F7B7864
+0
+1
+8B8C49EB64C5E441617E92B52BAEA4FA603AAEC611531995A2C84498845B86D8
+220A4DE3BCBFCA18F97B31246C8E3BF402E2535EA776B5F1A632C4712BFAC89D
+0
+1
+2F4B4E5EC8262B115CD8B19E229D1D3CCAB76BA6CEF339B90F75C7AB31749CB9
+1636CE0D51E9CF2F0227B362FDEB0A3A198753887832A1EAEB74DB5124BE39DE
+0
+1
+8C77D8FBF579D3A81836795F0ED40A55572F46EFBA820854CB77EC15C31ECF7F
+75EB87B75129CE19272B017D46A803E3A60A6B8A111CE627D94DC7894396348E
+0
+1
+3809133F17494A6EECC1977866BEAC8ADA584C8806BC04A6C8015EC95010AA6B
+9ABC5A55B005901ADE51B7AF430F7C81EC286903FA6457C1FD370EB9F34DA339
+0
+1
+A087F65F6F80B49AB26F1AD8ACBB868608183FB4C81AD3BB8260DE3D78B4CFAB
+0FD8D2E67666D834F4B8E1D6FBE640964F12509796EBE5C38ED6BBD334B29653
+0
+1
+6F2B4FE3E6287E6E3AF8576AEE575C52EA94014A5D787090598314CCD7EFCB17
+62943F6AD2967996769817777DA9244A7C97461B66FFC7E85DFF0AAE68BE1627
+0
+0
+7D1FC7E6FC29E4B51D69D02669A241CDFE5B79BD3EA4433D41AFC44E3C38CA4B
+45CE188299D660E73CA61623C4BA3672E4F737911506EECEB24FA67BAEF74EF4
+0
+1
+E43B1DC942AFA23128CAD10A98DC7152EC7A3B12572F946088752D5CA06403C3
+685D63FBE922A2D1425A796EF451018111EBAA4D5FA97C50C2B63160B4762412
+0
+0
+4F7A4CB2389353A37BFE69263BBFF74166F3243A1E28C253385EAF4FA7CE40DD
+A3E353CEA195B772168A77F166783F43584A25276A40D09FE4365F7BEAB601A4
+0
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0
+17
+eccp_affine_points_validate_batch 256
+40
+4F99026DA08B843C1FA7C93C38A3CCA4D340B89E553E3D00793BEA8C8EE6B692
+1BA89EED7CEA9663B8857D6C83C15DE9C8997E3E5F56315C858BC8264CEBA2FF
+0
+1
+60F7C5FA7260ABC387E51AF7E4ACC04327CB09602CB068487B45A98A82B12189
+97DD302A6E93DE176BCC56DEC14AA360861A84A2A3827CE039D9E2AF327E20EE
+0
+1
+6FE7DDDBFFEF90EA6D89D5149D5F0625553287BFD8D2092E032B8B4B078BFB86
+0B9EF68334D54ED24763A94DE43DF8A546C482B8073C0B128A081F2C3FCD01EF
+0
+1
+A185AF7E51CD54B58BCC61F25D94F7D52897233157816578F53C3B1F85CAF3CF
+79C20CA06D77755B61EDAE476CFEA955D89468862EB716AA0D11F34D7EB9184B
+0
+1
+92D605C8761DBCDA539BBACED34C3C550F27CE26158041B25C7E7934E367E352
+0C00302B9A49117D8CF4F7F04D42527176994F1B4CF7A7DD7D0D121D9A58CC66
+0
+1
+94F248783BC158C3346A4C8F9E3549D60B7A8FD55FEE2C63935D0CBB0EF3D4F6
+165580353C185BC114100B5E6E5CD94D28EAA3EBAA1D8815C7487FF4D9DC267D
+0
+1
+18A74F1C90D01F1F4D2EEB880801904711B9193982A18B5173796087C3CE087F
+3A4B0C361B5621444C9C5E3C42EC9CAF932B9C822F413CA96E5B4929C4C4A466
+0
+1
+4FF5DE0964A1DAFC491DD8C00176D2A377A2579D3C678E28FEACB33637C93435
+20BBBEAC3B42DD9D1B3DC9A8FC8013693C56AC880C440D81395B77BB578A7383
+0
+1
+479F31FD2C9F8F5CD90F38DC16C29854F5A032DD959C2712A6560745748A6F17
+8436E7B0E7321A22624B22FEB37CBAAF7F88A1ED0A235B48132E9BA3FACF931F
+0
+1
+43F4B64F803746A0F74B1DD1B9C11EEDBD6256AF510393877ADDE4D1A7069CA2
+66C9792CCD7A43CC0E71F50C74E60E47E1FD23D02CC3BB31B881A643AC0DD338
+0
+1
+933FC394C00F91A8B1F9D1A3C724CCCB55BA48CEFAC32FEC591F2CBAFE8B867C
+102AE60F95AD01978A74E90D6B4B732AE13976A5CF328CA30FD08F569410AB1D
+0
+1
+720BACB2BDE4BE099C85EC4E1E725E1403F8F5207A33F7D40C37597ED7D39AE9
+911781F3F93D0B26A0A63B648D068FBBE7D6736C3F4CF8D1CCC913BDB74E621D
+0
+1
+3969F2F2AB16B9367EB646DD4F60A403C112E8BCB1BABF61B86B04B73492742D
+6F0D61E8ADF6D99509912164BFFCB2BB66EDFCD7113AE02FB4EDD4A20EBB09CE
+0
+1
+4F4432506615408DC13E40C47F3603609205E208C490C66DEE9270BBAA0C7CA7
+9A1F54C1ECBCAE83F4F77F2D94EF58223D4722B2A6FA9FDC9EB5B3E3B58D07CC
+0
+1
+73BDE79FED777F1FB682C753A964833653ABD3B487EC58D626DC0689F6C50FDF
+A484EE272BA4758EFA34C4638D4073A74ADB0CFE6C7F9F8E0A0146AC1460CC96
+0
+1
+0E8E440E8694A84B679F14333FDBBFB32E9125AC414949BC34D3896A52B43123
+69206C7FC794997AA305C659845A8FDDE137962BAC0C6183D5D565DF71158181
+0
+1
+24AC337AA70A2BF28D1B24C5917E72664A3CFCAE79CB46CCF56A13160A93ACFC
+344DF1191B0B554A3A78251EE7A11AE890E55A274902775C635D2F1FB3D1004E
+0
+1
+8D642ED2CA39261DF2AD8F1184755011415524BF185813E49DDAEAF880DBF1F3
+29F4A373F062A456D75675F9C357496016F1B3D2EB508C04550AC7010117F2A8
+0
+1
+76399C2C167E40F7483154EE6D3BA06D873588BCE07D665AA713DE261BB84AE9
+188E277D56C8998340FEB68C5ACA9921476749C58A12301C0884CB610D2FEFA1
+0
+1
+8FDD22A56DE48B5D35A654652C424B8E0714C843F66A03AE3190A7E66CEAA617
+6BAC9F291CA386F1D2FDC6B38B7F1DB1437042203114E0506854F6F90AFCBEA8
+0
+1
+2DEF093D95F43682D34BDD191134DBFF6C43AC4D27E7F3111774ABE5315AC101
+5B855AC84986EBB7A3499CDD2706DA197A578CFBCFE19978A3E0493E6D13C4A1
+0
+1
+341153DC4BBB6B70D64B6BE46D1C71C29FE45F4FC1D6988D8BDD6F417A23578C
+741DC5EE67C757FD08099E03A8D2A457B589C068332B91D5E109498924387D6C
+0
+1
+4EAF6C5D8CC94F851D832917C3C3FB4F19E99B813F8864449B97FAAFED6F102C
+5F916A41DA22F81608F2B2803DF194798848442009BBD0514A60BBE9CF163BA1
+0
+1
+9E431B2FED0CDAFA5677D92766983114D5D34081045358554D5059AA4A9350F7
+2B804575C4FB8C23F34BDED0437BC90B0178B9C57D4DD599B1D755965466BE11
+0
+1
+7DF0A2A0DF7B85004EDE3DDF0ABA3B560506C4A361C289420585CBEE5EF908C3
+8BFCD0AC47331E934DEDEDB96E830193AC899CCCD6E7F71B544EE147ACCC4985
+0
+1
+40CDEDF91AC713D17D0D1EB8664DBB0C0381093C01047828E9528CD6B6F091D1
+837EF66C899E2E53E8DA223916DCA1ECBFF41719C9DB7153213D32EA932A750F
+0
+1
+851E2E59241DE6F121C0A95BAFF470F79ED4BDCB31A10662BCD853169E53CC5C
+70289C119162B39151C08BC9C032B712EE1A97E77751417C9294978D3B5F88DF
+0
+1
+70B2E9F76ADE097ECF567DC39AA030C127B0A160E220A50B69A6B97EB94BF180
+00B0F93D0A2F6EA28C840608D7C9AACAF83418BF52BA21F639F899871C06A1E4
+0
+1
+533D49A8452D7D7CB6C7E7B2DC91F98DCA319457D273C2F54EF5D8E710CF7A57
+64CDC54E25369BB7B13EF776B6A0F04CA2B09B15935E7118D54E329642AA222E
+0
+1
+0E6314269B5FA93E44A978E3B82443E622D380E3F8A1C4483D4B713A2B257548
+80DE4A6C5A937279F5BC5C62C560CE0BE091F9091DAEC0E3C08A44D08AF08A27
+0
+1
+3A79E2F681D85D679611DB19443CF504137C4FC9BEB345462BCC0085168F4BFA
+944C949B6D60BE812923A66CAD8E4AD715A9A599A819E959DAD5A492DC630BE0
+0
+1
+13B4AABFCC379B37E50E131BAF3D673264E105119B83CB194E0E8531D35C64AC
+9F9DAAF7AB7302F04E3373895EDCFB20C20EE175EAC4B0203882D6AF2A2459E5
+0
+1
+982516605D605D2A75018048D186B9AE03572C3300B00416FFB53DF78539BC51
+5FD0A467EA913DD5A6DD88AAC650A489B321A39CB58C71BD06CE0CCCE0FABE58
+0
+1
+0A21AE30E90D349E57198EED00196FA34B3DA8FD798A08433BF3A0F6239B0EC4
+4063FAE6B386BDDB7007D09A310EABC0D5F6C70205B19BA04A877B1678DC3EC9
+0
+1
+A2119E8DA8D282F4091BA1C8D423D33947C5838037B66E10E876DEDD94EA6E6A
+0F5C9F8F4000B12BEFB3217CDFD7759A12F8BDDD515ACB26A36221FE938E41B3
+0
+1
+4E33C95D8519E3207573C0CB61C233D5CCA413AA9CF1FEB75BF18F3E965B1865
+1600CEF22FA2639A10C2072FE7E97B7C3B56844DE9A522AC377E2D568ABDC0A6
+0
+1
+61E9F01B2419A93F15587E4976731E2DC3D9431EA7B57FBF2B1F8F69C08B3DB0
+5B481AC446FBCEC72C69264052C78784BC93AD7D7524698466F1B6147582A144
+0
+1
+8D886568DC6B7201FCAAF3E7A32C3314F92F5666BE4F6B86BDBF7205B226FDB2
+51FC144ECF26B02AFF6470D7DC7701148FE1EA4BAB11D2674C45D11C4CC2FA8C
+0
+1
+165E857BAB41E314E92B25F5B813C2BD33185210C761D604F1AA67AA096B4879
+8D91E390A047EC379A1643A961FE79E697B43826676CF376451994AD1E5974EC
+0
+1
+5B03A2A26A30AE39D65059F8AD8628C37D7CD8332BC2FBDD323118CE1A8D09CF
+4A0FB099A382D1CB7126529AEEA9BB91AD9FD87CC6D528CD8813CE76F621E821
+0
+1
+40
+eccp_point_multiply_public 258
+82EB7AFA2A3F2D9C93D719F58D61D9D3D77802AB782904719C84F208B759C28F
+48FD54AB9AF3676A3DBF39CEA7DBC50AD8EAFEC8CAEDC9CF7FEABE418BF6DB03
+0
+A9FB57DBA1EEA9BC3E660A909D838D718C397AA3B561A6F7901E0E82974856A6
+82EB7AFA2A3F2D9C93D719F58D61D9D3D77802AB782904719C84F208B759C28F
+60FE033006FB425200A6D0C1F5A7C8679550F75B0A385658A02889DB93777874
+0
+eccp_point_multiply_public 259
+7C7CDAD3DE47CFB45F64A817BD6654154BB730267558939CB45533E6CA64F704
+0316BD3D3FDC5F46F5A5B4C364A01A237FC4862A7EA305215BC90D758E0A713C
+0
+A9A0026D3E8FA71F4F130A21D50DE26728E570438EADC420A61F2A1035B0DF90
+86FD40DA501B5DB75B55B08D6E702DD89506C9F33EEECE7E7BB873DC981A266A
+9AED426A77AE39FCEF3D60628F156600661CA819116DFD6E5D8C683714983839
+0
+eccp_point_multiply_public 260
+3E8750EB4F3B2C32C16AA3400B0DC586912E3175AE55BE7012F43ED92370EDB9
+77B2A8FB4CCC72979D628687D636857FAD8B9A5A6010AD277B6A83080BAC72E3
+0
+7CC4D984E38E5AAA4F63DD8625975CF1D1000405233677B7E76A60E6AAD94FF8
+8049BE13D21AB3B8ECF8DA73A61AB144772368F0BB090E9D0A77B307D3181327
+86962FFE8063AB074EC2372F443A9EC99C27E2365820F3BEB234DF670C7E3188
+0
+exit
@@ -4851,4 +4851,290 @@ sha512_update 1435
 F24EDCE17E89AE385DEFBB5746936F92789A436C046F8B8D311481C7460FBE460C696330B92F61F75EDD73972DC330B2F02C04D3B227743B0333FF579BBE19BCD1D8C99E746F0434F8F8F1E122C8DF0773D04769CAA92E53122A93A03911BDAA8DBFD0C7D85AABACA5E3C53E76B5205CF17A329D701C44E0492564DDFC784CE3
 EF4FECA9A3437734E1481F6E317A6B90FB6570689BCB3757D976A185B4CAF5E98D16E7F4A899404BAE9A9B518E2300DC485FF505986E4F10B29B1F80A62856955ED275704A190D3511DE5EF57AEF3079
 D65410466FE97EE3B936BF97533438D386318EEB5E2F0B9C4E79512212B8042B6A54C740547796A168693129C04279760713CE702B7BDE2710075D0627D1E4D5
+hmac_sha256 1436
+0B0B0B0B0B0B0B0B0B0B0B0B0B0B0B0B0B0B0B0B
+4869205468657265
+B0344C61D8DB38535CA8AFCEAF0BF12B881DC200C9833DA726E9376C2E32CFF7
+hmac_sha256 1437
+4A656665
+7768617420646F2079612077616E7420666F72206E6F7468696E673F
+5BDCC146BF60754E6A042426089575C75A003F089D2739839DEC58B964EC3843
+hmac_sha256 1438
+AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA
+DDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDDD
+773EA91E36800E46854DB8EBD09181A72959098B3EF8C122D9635514CED565FE
+hmac_sha256 1439
+0102030405060708090A0B0C0D0E0F10111213141516171819
+CDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCDCD
+82558A389A443C0EA4CC819899F2083A85F0FAA3E578F8077A2E3FF46729665B
+hmac_sha256 1440
+AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA
+54657374205573696E67204C6172676572205468616E20426C6F636B2D53697A65204B6579202D2048617368204B6579204669727374
+60E431591EE0B67F0D8A26AACBF5B77F8E0BC6213728C5140546040F0EE37F54
+hmac_sha256 1441
+AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA
+5468697320697320612074657374207573696E672061206C6172676572207468616E20626C6F636B2D73697A65206B657920616E642061206C6172676572207468616E20626C6F636B2D73697A6520646174612E20546865206B6579206E6565647320746F20626520686173686564206265666F7265206265696E6720757365642062792074686520484D414320616C676F726974686D2E
+9B09FFA71B942FCB27635FBCD5B0E944BFDC63644F0713938A7F51535C3A35E2
+hmac_sha256 1442
+D7
+3421BBEDBF1657B0A788A89DF2CD722BFA48DF7E05C2BF0C4AF334803A41EA2C3CC9965DB6E8D6FA93875BDD8753BE287A7F9B0E4BDA7ABA220FB11271C14AE2215217E2034AC047876410AE810D2BEC6A908544D65E0A997AC1153027E2C59203D185D1F1E1A25F6ECE37A58F56
+DD1CAC7252737F0030D41FFA325DB71D5FECFC3DC770FA39C134C54D9B6F55B1
+hmac_sha256 1443
+0B7C6C9E235A3CBB18D9EA1CCDF2756672B48A364E85AF34171CC4A781BE8EDF
+D5DCE3E5785CB944EA87808C75D03B26B3F89C8850980113027EAB863F49FC15
+E74EDF594F36AA7DDA897FAD4E3D6D509F17707C5BB083E888234BA6FDB32D5D
+hmac_sha256 1444
+941022D578D41D595752BED66B3E5796DC1DE412EA8248058FFC015C0888871B05A32B26DAC34BE23C9661675E927BC92C09248FAFC5525294859D0FAD8EA6
+7C34260AAE404A1CA6B90D474D684617C9830C0216EC82D95EF21179FC91E7543ADEC34957AD097E15140A0755AF7CA2E1F233FBD176D5252D7D3C76D116D415A8F285E31C33425CD7BBBB13AE98ACD0020B9288012BF42794CAAA5367CF7087BCF34047616355333A759968FFC17876BB2413CD5517063D14CFE930B2EBBBF95AE040CDD55EBD16BA6DEA13DA38C780FDCE09DF520C3E11968B6AC6BBEBD08ECB7E139A60A19C865050D96528EBF6A763857AFD9C92629929EAF0451B55C4A34ACACA9CBC0913
+CD6E791280D24506D8F2BFFCF25B14A8037F7A9ED0B02A1B5D9E74BAF6F79B83
+hmac_sha256 1445
+43E431B495CCEEF1A412190F990E553016F9184276B4BF64A8D9D5BDBE0E14EDCD5E9E3839C098C311BD42D0B96DE6587FC25E6F042D39649A1E0AC80EA3A17A
+7491A4
+CD0A2374B8B77CB6F3F8761C073D33CF09D93E6A5B592EDC22D4BB6DF7E78623
+hmac_sha256 1446
+C8CE4ED6ADD31E6A609A33014BDC06FCB9AC22DA9F58E4EBB5F3C237805E4C2112922384FB9278FE4429DE1C32DD290623093A6A4CC133E15064B83270E1D7BD49
+7D588097D88CC40B5B9BB39D1D393FE977C2B0459CF229D6F27DB9C77A45F4A4C1CE51F12F07409DA98B0CD3BB7666966A8F22A842EB7621
+92B13283D4EE5E6FD44A4842858091BC36DF3D05A78B2BCBB3E759414DA06957
+sha512_256_final 1447
+A1
+BD194BABF9ACAE0FDE79DBD5E78642C0671E8871460C5E93FB455E4FA0962063
+sha512_256_final 1448
+439A
+4E87A1B7245144BA01E4B4457A3FA95BD69864E039FE52057BA3254D717F60BC
+sha512_256_final 1449
+62DF54
+E6E53CF07988CEAF3E152D1B8CC14BE53CFC17F7ADABA1500CADC55D77EE2BA9
+sha512_256_final 1450
+4F37FC706F4FF16F0E25D82043FF53411C95ADAC307A8B87079046B4DF5966CD8D0DBB319395FE3B3A734BA8F1A3DC3805BCD8D6A200CF
+FE3E24DB2D618C1B5B08E2618C28B4B97368956A6E0C27F4FAEBEE18531A5BD4
+sha512_256_final 1451
+F0DB844FBC62EE7254724F518DDEC8DB06E89615300D0E01ABBC2EE5E031E62CF7516E24657CB410CAD9128B0AA0CBD82C76EDA23F182362
+FE03D4322E1B7C0E891E2BFD6F04F0D7AAE4C6A07440F74516A8EB390A9BFF05
+sha512_256_final 1452
+436B36457986A46343D816252CC7058E4D3E402E31C2E9A8EFCC9A95F5604107EAD4709E3D65115ECE30ABCF13B7546EAF4A621418E04AFFBF351B730A211E
+CEB1342EA8D0C3386EF43C13EC28A5283BC5279AB409385236EEA7DE2F16B83D
+sha512_256_final 1453
+4C70C63214E5FE553A369B2771D682B025835A78A8D4CEABB6B06A54F92B73599ED9277B80F4DA83EA29CF389B8C1FC2B4D25A89A45BC6241E0134AAD44E789D
+6EE1A37A0890F8D1D88CA8590B485A822C7C02D5F68E472245D52A591BB9B8ED
+sha512_256_final 1454
+97D4509259A0AFF323DF157A04EFAF91D8B1BE521FE9DE77CB2F14EE4398726D0CC390D423FF0EBD2A565ACA330EBE3775FB33F18F2211FC6AEB33A4FBD1ED3549
+C4EF7DDB68C097EE8C1D50EEAFDDBB015341D88DFE7C3FCA08C488216614453E
+sha512_256_final 1455
+3DF34FA0F60338E309613D81EB29F12C7C7B8B8C7AB542E1030C323C28BEE56B19512390A9DC50013D5318057DD1D76E10F767380CD84470E0BB66C8B8C4373C2EF8A83F979C7EC89BB307D55DCADFC575876990928DCBBE14E9A8EF2CBE6ACFC64E755EB3A3C7B2234E33A3790F
+BF58DAA9B670173EAFA5560FBE464B3DD44F5A7AC007BDF5F82B08EEF821ABE5
+sha512_256_final 1456
+9874C7594D302A721ACB9E7F4308E9319A397912E0C89CEFE4667B4E4E9E85D3E4BD900B18CBF6B3D2C4FBF851FEE9FB9C74DA252D9C145B70697B4302D399F290F2537A58B045E75D207A23F9DE46542A5AAEFB184DFADE898D14D22DE5944884DAB051B1618B7D257C1F2D1ADA3A
+CFD8D45D111534E51CC8C891FF6D3F554C5A5E8747229616F97B8BC92ABC715B
+sha512_256_final 1457
+3664A8A3B3DFEDC891753353F798CDE546A14941EE7D9D2344A65F18FF73BAC9449D37DA4D3A6FDB6B98FC4C732C34204477BEC56C62E0876271FE94B81862C8A33AD21EDC73B91716F1027D1974BE270BEBBF151AE12DA01C2897AD34F1633622ED70C9A6BF5919333ECD32E26942CC
+7FD535F551A1996F44FD1927F8AA5314F2B148025457E0592EFF6512A00A0FE4
+sha512_256_final 1458
+07F1D2DE6CB41E656F41033122164D0729BD780F2E11B22B6A71E9BCCCCABDE44D118C5B1BDEF2A31B68EE30B327913A1C75F7C6DCC342CFB48586C49B2C16E8D98766F262BA1F4DB2191CCE3082764DD625CF3CB1681852DB56E14A1883BAD391A35B0BB25147AFF0161C4AA1BE6B6FA3
+E66D0BB2F004CB4FE83A993A865EE98B74F89D43BBAC88F7F699D91974F8DF93
+sha512_256_final 1459
+A30B9D4835B65E172C93F2C50CFFA638F6A6019CF6B4BDF7ACBCDABE0DE23561A9C968F6057684810516749D18218F35AF527D563207898AA9F48509982B08E7BF6F2D929859DFC2ACF5BBE56EB670AE0F75C750E8E4643F0E9DDCFD39B3D99F6FFE8BE922EC47542B56559414E2CA4936B588AEA0FB65FF935940646228C7
+2ED44AE3F2265E64197FF400EAD78DA4F900205C104F634D710FA5C6187CAFAC
+sha512_256_final 1460
+BD50D464EB510B7D21DFDDF5768C58DAAB7B3F9847AF48F6928433B037FAE6F7698E79FA26F73DE50D27B68F8A369560666AD3104C4C5F72AA5BD3B2841C236C4273F01A5CF739AC5EEF0C8FD59FB527D9104135431212E5B89F98C09AF3EF5EE88CF8DCF71EB1411B4D80FCBAE5B0E003365FB0DCB356B50309F8519706B4BF
+4A6FDC86B3FB21A48E0522D510C61BF4006CBA023354FBAD36A8E9287B04F071
+sha512_256_final 1461
+448E61FEE53BD6899AFD4311E100A4DED9220BB99296DD4AA65D7F58DEB7173AA6E01364ABA551347655B1782A2B9E942582E94EE3FB715EA30D5AC5F43DD638E16CEA9D8D0558AC8ED8AC0BE6A4D6AFE41123ECE211CE5111EA9EEFE14E3CF5AFA17180672EC71749EF739C7BF30FDBD586F6425C98CA610424ABDB938EEBBCBD
+95F7556131FDD0C8030B1D324499B353E32BC284F4671633EF8B07C66768F25D
+sha512_256_final 1462
+6E30DFFB88A747D5861676F7609F3C8A1AE652B1740D5ECB182255321AD03FD4AD0FCE437965A0D099BA74C594DF99FEF9186D6CAA783A12A879C971E601D909689E67DD06C7E2AC7E0337C39AEAB7BD5132B3020F84148D967F6995AB7F2C99F85149F562E365FA56FA56E39105A192E1AEBE4C9FACE2513E411AADEAED45A312AA125AA12D356B8485382691DBC1FEB34A494A07711CD0FE9AD3D250C697E89B0722937162A9096092E8C8DE1C12F53B5E1A9CCB61466F0B73D5244F0F77907B7D852FAF23EE78
+E1432654F840D6257BDD5220FEFE21D9582F6055654553F4A6F2ADF70A240EFB
+sha512_256_final 1463
+839948668844B863D107B7E417A4296C1EC2ED447DEDBBBCDD3D0D57D5743EC141DFFA7A43FFC6E36BE11D2C8F41E4E70A650601A0D07C4EE16596965B262D02863400BA763750EB6E0E34D667BC68CBCA617A9D60C6600D9A07FD427FB98CF4D7B1BAB261CD2ED2A6E5685E0AA28A358AF1BDE0782BC0F7C4E743844E51A64A758D14581B77962EF323A35FED49EE2EF1A401FD9AC266ACAD53C64BA8259E9FD55E73731D25FC994911ED0E5E6381B49ADA16C662DB2B267AE677F014908941DCC83823BF47AF410283B340C604764615C255E70557C6D3E8C92D9CA11FBA88940C4A30BC324BFDCB09E6B6374C56
+A7021BAA2A684F6F7C305E4F24A80A82621659FFC3B4B33E96A9266005D7B616
+sha512_256_final 1464
+EF87C5B1B65606B20E0973FBCDB425E140F135AB0BB71E47E54BDA0EE01ACE0D487AB810C050A73E5D2D65E2C252BCFC8C617F0958944909705AED97935B47E1000F4F666CCEADEDF39DF84C10FED2141D0B7B2470D45AA4443D8E8267D3201A9A6EFEB7923646F84C91B01EB2E950FF678A7BC2058DC4EBD537427D36A9F99B1ABD8CE6DDB1BCA1513010AEFE883F56BF3115D87DA2B54F1D8216ED494A91844BF13B9D525261F3C7D657733F24C7C158E41BE945A5C546BF3E9D681BFE55382464A7DB63978EE70B817C984AAC99E5146CD7C61936D7F23B49D882659D04FDC16E666D2D51CE90CD1BA31FB55859B4
+8CB4264FD9173F694345E6C0B14041C55C5832BF23B360821C2E08F8EEFEF803
+sha512_256_final 1465
+7CBD728B3C0480019FC1860F25FE97CF684A8B12B5F44A98C11C1E5CAD29858136754C6BE6F430E8A62774C58E9CB79A652AC70286CAA390500B0E89611996D02E37F7EE38726FD0E8B91A1E84C07EC00EDC35F963BEC87146E6547EBB4525058C61AF758A249ED95BF399F7EFDB052A2D82C5E0517D2299961398BFEE8BCBE5A5310047969CE3C1892176EEF41D0F74BD2B229752E538B611A73A009194AA79C398B907F38E51978E00B7414CA2F76537860721B065D21E2F23F2E63649F1ABFF6E0DD78EE1737B936B7F32D66D22998045818D94D483C6779A1C452D12850B7BEB56CB3605070C5B4A3AA9658C589C900FC4D8FEE9A36A616417F1432F44
+34143857E61585865FE14F07885884A601BED16D343CA7EE6CA45AC78629A718
+sha512_256_update 1466
+1
+C003E385B82E2DF5BCD5286A3BF1AAA1F0FA74E5E92676C1C3CE495CCBDE4C8BAB3E9E0A12877CA64E815394E1F1393371293BD98EF4DD3175E061BAA60C19A92A0667B2B6FAFC36B6F659FF18D122127EF72BCAB1FE3388F129DF0B6D639300D21A0A1920A34A6F767EFAE64AA72C37D2A9EE0AA0804A82D41484D1C59F57E0
+00
+E3B18940AF0862343EBC06CEDCDD12B0B73336248B9FA9C0F17C1480760FA23B
+sha512_256_update 1467
+1
+99D3D2A6250977F62DA435CEFA705B960E8C9C67BC7AACE4761CB3D17A3D2A05910A8B28C554B2C272380E87F0A1AB86EAA1DC7D739A964110A2A731C8D4A4064C7045001741D9C94C4C7C3A8E7EE459D2DCBE409F0A04DB1C91517F7A1C2EF8B176285A42A81EBD2965756FF23C1BBE1FCC9CCD9A7C6DC77142F051A8B1480B
+E67242B0E3
+4EB5CB70A802E903E7BE35F35CE2261111A6A44260138DF84420DFD3CB23F6DF
+sha512_256_update 1468
+1
+9B73E95292D7977A49B6212290A381BA3A30DBCF827D16CDFD3D53329A5C824387A6F346C5C054914EB03EBF480C2D9944814E09B767514B9AD2AC2A06D04B9AE0980223C2652FBB19F107C4F2121530215007A5AEE477BDC01BCBC7379DAD54C1E24FDD5016A4BB16E291162B68DED0C5E9574ED69BCDEB91B2E431E6E68322
+6DC3519D30DCEBD0F7C31D96FD4AB26F8CECFD17CFD548DE1FE2B25936B1717A16C6ACC8622A8AC7F8D8D20FFCECD11E47AB036AB43A9367E2246DD44C9CA763A50125C30CAE7FCC64D4E399429F0061801B86462FD52AD1CA6973EBC9D135E287203F8E7FEC4977A597CBFF58A02E9E
+235709CD471BEB5B481FB35A0CE4F592DE06421E5F60BE3DD516070102BE3B26
+sha512_256_update 1469
+2
+E0947695F30E6987576E6E63510D3555A770D146BD566961B2CA9B6E10F3E9E401775AD1F3226DC728EFCBE042259E3A9E08218D32162128B59AD8D53807C20CB830F7EF3F49F59C12DF1D47D5037B5B8163DEEEECABCD3B52986E0BBF552C7C7EAB88E2E40420379745A8D3D894C78D633168D4B6CAFFAC91108C7B091885CD
+72213DA12002EEF6F6FDDEA6C1DBB111728A66BAF22A90D77A71C06759912923D9E9B5005FC2C110563349E3A010CC617087B15018F2551C64B62EADD35EF99C4D5E600CEE26103328DBA1294B905AB8ED8806E57B4BF01206407BBC930F040C2028F4834D62FA47F7F9F2C9019A1A1B6770FA7D9CB5F87E2E0C316B9C284C06
+12103474E408C6770A732B30743DAC9D777D74E732D4CC68E6B916DA97C75282751888A8130A2C4CE812F94ECBA4DE869AD461CD33A6360BC403CC350347B433B21AFCC8DF467166C24C41E6B7C1F9C780C30561FB304C1BE3772492A0B961AF99464AB42A389562BB4FE4863E5FEDABB6417D1049C57B8F220D24FC14FE43
+ABF6470690029312CA3F331F628DE6B0867F3FD15C7DF9C2E0D11E75D0818F6F
+sha512_256_update 1470
+2
+D88979AF6A61E90A0034639F8CCCC44FDC2CB57E9B52F2A588DE53BAD92A72F9A8D31843B73A53D17D29FEF2B8A500C5E4848576D0D11ECF1FBD8867C25F6759D8C4A267AF95CE2641F3233A112FE4B22110E1F81692A3470D4AD98AD3DD115679B066F860477346AE389FDB25CB3ED195CB5B052D5EE6EFC8102D15C676CBA5
+15C84584478F51854096726E4A42B956D2669A597D9174BDCA6EBA6ADB45970B46425672ACF6D5D0854120ACD5889E7DCF30EEB923832510B2F9FD355250CEAE84A03944EB54D190E9793D084BBAABD54C1D7A659BC32B7F602AF94DCAA184C71FD2517EBDE33297682B9AA7C8297C44281B153F1C7C86AA5563EA628B3C3934
+46B32C4473BDAB7175545DE04833C049468B84DCEB99479DA47247BCFFDB68EBC738A56E49038706294EA1231CD89BC758C339ACBD907BFD212D5C78EAAB66C3E9B9DE435A071CA60BB64C9BD90CF338A9D9F618BAC1D3AC63B4CC14C4F8F3FA550C57832082849D75742E5A640A9239DD48386F2B675C7E35308715E73D277ACA2ACF7EAD6E1DC824CAEA9761E8C2BE4B34055EBBC5A7C071A493EBD0125CEE2F52B1E9FAD96D695CF7BDD71E4A44B078FE551FCFED5CBA4A944EA13CC8948EA7055181114676B9
+55AF89ED198314FF0FCD98FDB7D6D8381CFD47CE6A4405DCEF3E036C4BAC09D4
+sha256_multi 1471
+70
+05514319490F9FB6085B1B7B9D0D4CFCCEDDB24E720D90ABC1A6164AF591403AA1C2823E32220E3699F8EE80967F8772657F987E19FF5E7B3A8DC200903350DF
+F85B2ABFC16FCB3278E6CA07B844341BFABCBAACA6A86F9283038A6F7523189D
+74F8C8
+7E8247B4181805302FA83EC6D1DE442FC0B86A8C4A89CE802DFD46970C2838C5
+189CFD3C5055AB640F7662FC93EF3B6E13B60F632C724A36E13D83FF6C57B8C61D342BB8CF0C16C1F3A0D83CF6EC7EE93D3E7C4F04F29499C6C14E46136FC9C48CACBEAD9FB09DF24F3624ABDCD0F20BDB6B489CE8A910AA7D517DB401BD7E31CDDBABAFE790E4635BDBC8EBA88EBFDA1CD1AF7D3215B2E91EB3F55A8BD0FD86660F9E2CAE24BCBB1CBB2406E02095CA3B41FED654447591081880DAD9E6750E5D729685B6B975EDFFC674EC8FC8B3795CF38F713048BD318F36CBCA7E933FA03DB0FE535304117F0C2BE3A7805603A6BB1CF8DD0E0298D8EFC65BC93CE6AC2291DDAD
+06C0EFFBA12801AD3E476DADC104B664C0A48F778A8708EEA0A09F34545AAA42
+35FD396157E966E619BC454815D6BDF9A5E3EAC9E0AB55F04E8A1E1D78309029F867FBFF4BC5CF3C34C95A1058C7CCAF9B9B418AB3EAF61D81EBFFE42488F85BAE76E4479D76FD0BBFA95D03CB043BD8581F2BDDEA942CD5537CED36BF1F93483C022EBF689D91F1B44675F57DA440768F2A4D318C85A5761BDF8A551C4DDEDF6ED72991170EC68E110118226A5AC613D171DA4C746CB859DBC26A1E2C44F580A0BF04C1C178136926FDD54F619DA01BAFCCD1DC83C7A4E7A1C2C4AD5A5A2754DBA0EF8BE0C8E7202566D22A32AABFCDF936E257CEEADA182E3F48D8E72DAC4349D7D9E8275153DCEB08B473DED772F48C6A7C2DEAA9B9F1E8BC4377904D1DC861DDEE2EFD9D91B0730A4CABDAB8363914D7EF84
+3ED73083B42D65CAFFBB5D44A01CA242FB7D3AF2879C84C5BBA8B810AB9C88D5
+1E3E7F234E341931B4EE014774BF70566F82CB30419C3D1907A4112D2BFF933E62EAA54F46689A289896BBE780C0BC8A518900F54787B014261954EFA55A7A5D6BA3C7C34B53F0FFCEFB0A91B19E3750CA178F4D782C3A622B24BF61C8354B58B61CC91C7071FDA4634AD28FDC1842FBACF597D68C134B8ADE6DAF0895994CD7DCFC0227C5DC13F0F3611CC155603AED1967316BD16746A6BBC0FCAE220C04ABC724D9F7696F7F36D111B0B875D50F546BDA0B113F07508C948357DAB06B36DBE1D8389209A97B68D0689298D8D5A2CBEFAA0732F50BEB3EC231EDB4FB9D42237D139DA6D0D63153F8592A6294D2F4C6DC85C434C920B9B8BDCBA4024B3D391D352C2CA6BEEDCA3AF241940CCEA0E3FE98796E43522B2FCD7AC769A69CA4A0DFFBBF922F3B9479A8383CC3594104BB9C983CB44AFC5D69208810AA32F208D98E
+92D46EC247296AA79DA32F0A45A424200EB69248CE59D72AB7C307FD03F6A360
+57AA01D8A170C194AFD7EA8F5FF82837F5B6FC8A4558301E5B5B0B26F281ABB9A75924E3220C752A247B292EFB863B9183ED5FEA9F0361EF61579A98FCC869A8C2B38B48AD45B5905C0128F3D889D9EE160EC7EF04C044143B957CA9FA30A3578044879D580910E0F04191FCB63464627D1F48
+89BB4AD0A51D49EDFCC27D0411A60DC501B88946FFB598878C5DC2A01177FE92
+6783DEE80B42219DC3FE20E8A2BFF08D9749C7482FE3878AC57B9D00D22C476E095248EB59A09ECC04AF9D89E3CACC05CA45265C5DFDC7F6A9650951A82BF149E4ABAD27CA8E618DDEE857F3CF24F362DD90B6B26296B7DDC829B63D644D519CDA76E83AE5439598BB4E07CF6676D63E10AB66EFF29C46B1A6B274823B1CC95C36AB80603F294D2E6A2712
+ED5B3955B692BF28E7256E95FFA88FF5A0B91FAFAF6F4620B2DE8B448F97CA6C
+FB8D7D99918D3CDB2797D4B5B8688E2F4A0BF5508EFADA8F79F58DCEDB874771E3833662E351F3DE32BC7A9EC70DF9E3C48DAC8031C5E22DE86BB9FBBAC3C81F152A2DB2FF40A123ABEC0762D095E386E26B0B8F0B962D2EAFE1C9B8F69BACF76E068D8D961612B453FD9E7956BE4F297A13390862D24AA10214C0173C9D8A8578BAF8CD490F26864F44E8B8843ED9D2F678C9EB5BEFDA03EA81C4DDA3F7F1533DA3B5295F9EBE15A3FE9764539366F738C445A6C6B29A37B4E83F19978705370A3FCE618D2E4044D6F2F89DADAAA3019BE05B9EF2235AB4357A64D00414CFC3CE4D4D583D71F27281B42E3EB377368E7CFA0B
+6A4232443063FD1653B585D899EF1BA2BB6F14AF8743945C5573043C1B5B70D3
+7C1745C99159E726D87BBC83E1AF92C09CBB9989404A33577128208C2ECCE834CCAF9A1C73CE30363978D73F615C1121D94575DE96296415744BF517A3510B6122630E0FF33F9987F50084FD9258E8D7FE9BD64226DE6C58B3F9E6621595E8B5AC80D561846DA8DD6ADF0984836B42AABA01DF0E9BF5890A
+13820E71834A0A274B4B8FDE72084109120E61CA4536F7B8D2FDEFDC2A67739C
+AE1848C1F121F1E3BFE226F45E87A72058669493CBF061358BAA74B271F1F21BBCE230B4021FC50286A50DBB93B2
+3D952F3854E5466254321107DA6185D7736FF63D53C4C4C2CD7791C099527A06
+DF250702C1C8022DAE7CFB91C9AD2C2D2494AEA45C9561E7CBF7EDECAACD933665CD1481031ED98B9F847DA16B0313C32C80DA885BA0BA245456AAF337573C
+E5F255E66938B1A0AEC98990689BFF9B763D1F46CBC4C2C63F528AF9A9ACEA95
+C79806B6C3798EF27F38B14795374A378D105F201633D360868A918D8DF87B2012CA6A157523FE4414684D67658F905C6FAA0BA847445F4FD79B17A1AC19E86A862E9DEB773308C0BF7D1F694779F4E35351316AF61460C62E770E7635E558AABF818CF669E7EEF2BAA9D1ED22C3606F38423420CE83475A90895041442DF6244E7D4A7F7DB6A5632730857DBAB4D7934EEB7245D51B331D8D8ABC32A6B6C75DB29C0CB1DAD56E7AE9945705109A670A112B2DA719CE1B4A1E8D96D5B493DFD60FD4029CE8C92CF03E44B9BEA831BC5714FD3F0FD3C21CE8E6FDC4A80D
+02F0A37DE47C204F5426C30BB49D3C9E1363B4BB30BB394EB991FAB095B18B3E
+FBD62BE0C7671903882D49ACCA70C92111A14B736A60A52156E60D63F3D08C39089F5C76BECB56DDFF11A1CEC186E9FAA0F38E652AAA1617BD13469763E5D8D6391DEE418D1054893CB83B280F93C4459CD6A679B8CA71310A8111B8A44226F0BD77B76D5D0BD20C7AC72BE39707EFF30D0C6510430C5176F093312F42291F551CD41F59DBB055E7D4
+B243E8876AF712E13794BA6A3AFF7716ABD341C84F524604D5A8CD001498BE50
+99D9888A0C6662F376EB8B6C8AC5ECBEA8312D00EEC9A3865056E33D4EA1E9436303438FE2414545293205E75EEDDE1A23355DEA25F9B99AF824DE16811B4F9DCAC1DF108811AA95ADE31BE3261DC853334C1CD3269506DC694B4829DEFE02C90BE37F9B8314B26C7352E7B21159E6FC15C26BE30985EAECA1050FE740446467796E91C9BC387F4A1AB64A0EE3345394A065F8CF0A67DCC85797333A9DAFEA6F7930356E91E8B0F268B5B3B0AF416DAB9A8D
+4C3D07A9F82EBCDF25F10DFC19F8B61A997EF358782399DC33D92BFC596F0D1F
+8DEDA13AB69F5DAEB337B6DB72487C5793403296A6C2BD4F0D0C48AE4B0E42B84CD078E3FC6ED8D0CABCC2CF57370AD612E9F6089637F11D98249E2DCBA5CB5C522DC09F807189E54FCFFA6AB9B94FE982F569BA3C00DFBABAAE3808C7745FC2E60687C8510FDFD14BEB93D83989793DCF845C45E46EE9BCBACB74046C9FC305273864460BF9B379767473DB29F4C5EE635E0AF054213E58050665DF7E0985F3B3749527487954BC493C511FDD6710250033D10C37232E70D92EE3C252969B7676CD3BAA9A8C5FA26D24D515A3A20D48A81EE54E8C0BF3F231A09DE4B9457CADD5ACE3CB141593ED3C38FC208B0FDBB5DEF85BAEB3698E52151E9AA1FAFD3C
+4CFC8FF544BAD9B05F606B9637C8E3E1124BC4F2891B4A9ECF730793D3286C68
+AAF7CC206611E73A249803E677811698EA9D31EFAB881DF7D1B325A5EB96C405B2865A4F543E936407E628DCC4B0E5057ABAE43946B9E56ED0E9B8EC8731944C2DAA17B326DEB7195BCC34854C4646C9430CBFD4AE7454D81C132B82DD21A6CE47C5EEED3364B86C678D259761A0535FAA1F46890E613FC5089D5C539DEF1439D8F9639125E00282679E0AC100F76241F3E9EEAFE2BF8074ACF9987017190D917AC2E6BE12BC76D423D55C4E0097E71A226ED33E995A346385BB6BA2886DC8FDDF7FAA0A6BDD48B4E44659CB8C616A95FF9C46C7F95D612EE05E30A3C4304271FBFD1457C1035671EB89E41840700BBFB2DECF0D38446B608CCF3FA2F449E2F6CAB8C8D4E6D24FFB4FDA6539811CE2986808
+3CCD83CFA10FCD3C504A0E54B32823EAE7B388C6C7BFC31E66FFA72B8F31A8B7
+A124834F81C74850B1F71516ABF0A18F79613E8C8068923F72FDDD4E0EDFA69C92F2860534CAD771C4A5D75F4F2C43E5147AACA0DFCB900E2F8A1B086B3FEF3B15736587BC97354D39F0CFAAA5637AE78787119C193925685503BE46973912C089339FED3B5434175943BD471E68D4092F1E921F948DA5092868806037
+7C076B039F384011C87E6EF9DD346A60B6030B0463408B2AF80455BF1595A098
+2BDCF8E22C2EF352CFB7A5AA1AB1FD69F3F3462CFF1E6DD0D7E750EE11F8D3F85F045D19AF23B83E1B75A27A47A6A7A470725104A63647BB7619CCFCEBF9888D639498BC13E5EE406FBAF1F749FBA13208C7F8A1E2A30AB620502E3A4231940F5066962E18BEB1772AECD9571C1BA24AA60144E6964BCB571C46811D01F45C6A2F7C8FAB534F1A12FDA3035A3214B86A857E3B735FD246601320F416A84DD90E49B65E14EA2F8D55B456FC8974774FD37FBA0837716C6C9D6A8D5AE4D8478C1401E46A4736E961B3990D8388E4C60C5A3123033EEF921449EB296589016814
+6E575AD8F79177AA1B72D232F35EB12D9ED9350F80B520C4B4D5EA9D0FD351E2
+D0EFA967DE0A7819075433EECF9B017C01629678CBFFD5996886470CC5EDF76CB2190332598270C1B8E9C4F6136D9753A2B8BD834B4EB97A76A7BC216016C5D51816954BD7571F86FDB8DE7B1C541F
+8B222664EFEE313768BD2C7BE2D102805D93767B9B65D2B281D64423FE8812D1
+8B23B09F0823DEBC15B204B3C871C7A177F6769CCF938FD0545BF5663C3C71526B210812A079D8BDC059A5965470488431DAB165483C3004EB93A89477936E2680E32408958BC82A05729954A4E9CE063F97E8D60F8D9FEE4BC160C5F11F6711C3D1B1CBCD2213A33D302C0E5665C4BF09CCE0934D99FE7E04B0BB37B2E0C2FB16774413E0F7AB2175E705
+1D0DAC93B42057B21BEA033D4C951BB442C641B2E976838B7C035FE0D15659AD
+60947546F0A6DA7EFE95979BCDA1956653361371E5A178E605DD6C1FCA7714212BBC03AC5992226AB0953B311665C3284B1991DD2BC724
+0B3F302E9CE28C45C76D4BC5248702421CA569C3AD251340AD0FB6FF63C47F48
+522905F944BCB37D5D100CE99309A25C4384225F91FC032AE2F415AAB5F8F36C6034204409CE3E94275F8A4A2C2D82BE5EA131D8CBA766BA15B6F5ACBEC88BD91839214F492DB0E28A1F7D096B90A1973FD322FF7626392E95D6A86E868B0399F9D3865A73A83E19FFE162AB73F84A77B37C21949FA4D33F89FDEE47EF03A118D837E457D10AC1ED17294235CDE0AA886AFCC9F023F9F1454758492F49B16530B9E810FFC0A64F197802EAE796ECC4EF0948572EC866AF669441E7D23705E1E06F69098B423F31077409D4BB95FE46D8950B707990F9E0B4262D6B6FA6FED6CF939188D1B2CE339745113A4C5161AC1C47FC52B09D1CFEAAFF49DE84ECD456DDB4911BFB8348359E74A775B4C4C44B0F06573D72D8D90B20FA7985F742AC528C914C1A6C00C0781C84D0447C99C3EDBC913FD7D59CCBC4BB0753F244C0030F68
+72A4FDE6A7C0481125A076B6F181346CEECA0C19D568F0803BD7EADD75CED311
+4E237AE2C91452D22B6D3C1BD3A702514F483B4BBA507E76BF515D9D15D58430542F016CBD5C60C2E85B26BED23E0B2A77C3DFCF8BFE43DAC47D0FAAD9D5DC001C
+E00328BEBF121E04605CD33403D5CC15DCCA764EC4D0F8DC86199BDFCA7B44BC
+457537B66F657688BD0125353881F8964617724BBACF94080BDB740F53CC504733C1C88B26A76CA847F3E678
+D829A4C5A30563D6B5D99962EB7DD09B9AC88F6B486EF3C6E2A4D59E122ADA4B
+022C30965444408FCCEF53FF1062AF19277C21D6AAC57CEB155A08ECF95B604F3939C21A6E7A202C48466986B7F566E121BF24B6335C77420D50BA26C01969C1FEC7EDC0A765FE4C3B4BA26960E73C6C2EDA655A7A7A21DC158439763734CA811479A1F80DE5A3BA7C0A0614BD6CE13ADD0A72CFFD023304594F48D06A4117BA5C2BDDDE839C2448B98780313310728286038AF70E84590ECC1A194FC6FD545291AF1FB9D908CE8BBA4532B79CDF849ABCE7A57C4333F68E52520918EAA46370454495D9B7861E7A718B582C0917431724A8307BD1512045FB240677
+D4D48D185E3177BA85458487C45290922D50BC7726BB5FC9F53DE7521ED9637E
+07205B2BF8C966CEE2A1695B23D2F051CA2C65D0418C8E2112C853DD2FCFDF698C8BD973
+24AA8941286F40EBFA1F8C6710C86FA026C342A6D6C3E4F2190966DB9A0E7668
+45F34FF25050C82C25D4C7F1909A56D6A3B452C5B1387BEA8A232888B318D061005EE41F15E2490B01C7140F9557C231013F3347258265C99C0C0350DA2B83A14C9B5A290C2E5F41FDF910E90437596DF0659F01EA7B13026358808AD5E81BAF235D2ADBC755E1E5937A4E6710CCA4BCAB46479DAA1E67E8962B2AD5242173479C22539718C6BE78B180526A2CC094DDD43377C797D01A64A64B21212D008EFB5EEEB5AFC9F8FB7A10F5E6BBC6A4C6C0E7FEFB61D168E0FFBD96C93BD67E29412912BD581DE3F31CEE24E12A6E609773E3585A834C9BDFB62A23CB23B5B2330D0EA9CE149D44D81040594850CD616F231F98E6B9016D2CDEF546635A8EDE826791ADECF37142FDBF2230CA825582FB1FC3B1744C57B4508BC96D268796AFB4060B2D79BD2336553E39D01EE5
+A6CB5795989045D6982A9D5F201222385B15485A2A2BCFF49AE1B36EDF5E9C95
+996765219563C33A2B9D84041A93D8A4BAD2B4A1DE40554FB6F71CF9E85097A1E0E6EBF487AF8879335055F3D609DE746C77D50E4CFE54993C2B362828E2CA338A1506F1F255C0FE0FDD64B65E4DF822C3F3423A5CFC07F319ED11347EB08A20AA61F8F675819E3FF88852874D30E6E7E509E834268A5DAF49016F8873AC70552BEF09E293DAFAC730AAE971C56B7DB8EF0A95FA4D61A1FE5C3D909CDB1E9730928C83E4
+FB6CD5896E48FE3ECB736CB06F064578B551E4FC488A9B5DE8617860441D513E
+720B942BBC510E9E0743D376939C0F149F30C09503A229A8BDB6471FA60951B903CF0AADEA7C3F0923DADD5CE73865BA7C21CF134C66D952DA965A8753F7038D1088B845F6EA47DAA610875CC0D32F5806B41784B8011DEE12A2E9D8BF948774818755CB11389087368D37A57AED8B168D0D2D60A5160B3105B380B9B3C4A78D8417F541927E22A5F31ECF6E940B4763FD2C8F408603C11338E43B7332D44EAC48A7EBC8C3CC696A06FBC03DE092BE61782C3D8233D68BB1B41820468D70DEDF3DFFAB9119C88B7AF93007E9EC689E65CAB6B82C76DF5A656C31BB7CDE3896EECB837D9F7C516D4770FA20D88740D15087402FDFC785A3FF77871F9996769C3A3A259536668426FC7D7AFD23C364B949452D787B1EB3741FC90AABCEC53A417366481731BCC4F0C96C003DD149B038015F69143B7739
+92699424F132F6A3AE0FB1EAFD6ED6716636275AC0BAC76255D71442D6B4C255
+D754D7561A4004D46B567E8A62862A6A69332D3E3C67B5C4652748916F82331F81F5B52D6AECC4A6706F883CC29818DC974628D4842C3048C0BF7C94BBA4C0012689DCE990D6A2F43E7D234B74048D54E8848A530D7037991D928A3F66074D7549B65FDD8F527C3939AED68F20C1F688F056722E5105C28B7EA77A4BE25EF2920AE0F04F61B5E7F6611EE82CFFF106C893E8737B64948D6030F033409864EE82828D7B9E6B3D9EF012BF901616D15C3EFC9ACE86B5BA342EE5C055C2F379877A76B143C9458814B3B40E6F3B2EDFEFCD8E47783DBEB788D99A8B11944731AF51B52F2F858F0661A52D7B24E0BDD63C8D245D893F131E82C419E31EB6CDC0196C6A5435C742BF56D4832D0450B0970FAF2E2DBCFEA50B9DC07669232AE2E3D072688C05423952F326C325670E91D87A26F0DEFAFFB5683D8CAF73B3EBB675D889D0B4AC3C5D5312AF4849A6D4880ABD6F4954E46F8667C07EB884805FB8CF985AFCB8E93E0B7FE223BB06C5AB982BB209E0143572A89E975F6706C93B786773624ACC8B45787719FF45F84B464826F021DBF7063433491FD0C6408115B2EF51BF9CA45433C585DED41261633FC547D9AE112627C62D01A4686CD78FC75C08DB
+07A53E508A15C9B09236C2B6720214024B0FCF7385D1A2BA237C4AC2D685AE10
+0BA6BA2CB3BC935B3664591ED0E330B8ACA507D29B31ECD9FCD0D9F6BE2CC2AFA3A3BD78D9F9C5E7CE172D689E1D1346DC28B9BD9C724208FD02B2F3F3E239E1F07052E74EF36A64DA68B930E2D811C1A2289D65C330DFC3A1A7E80CFF48A38D6185EDBE39C6A53E6C7002141569FBD5604F37EB17A7907F5ACF4C92E73024E8FD87B27B52BF1B1B37B800954BAF7B84304AD2ACEB8316625DD5063D4469CD5272CC0C26CA53C094AF15C5A3CF878BAC29D1589E236B172D107441
+E97C73078F09B2B501A1A290D39711D91726D285792908D654AEB87B15D4231F
+9F7E87A1F4788C148B4935BBA6E03C4BC7D5CA41D82193056A712EB45A4CDC02A0F532EC8088BDA7C9D1FC20A2B8FEB97AE481D81F874CF02AA28A97BC15F965B94B7B6A1DCBBBB26E5136360F60898B644ACF35F743D7D253D6FE8758F538095D9B8379840822D12187665617E89049C4974E9D7410BEF73E4270C8F9B7E22E9DD6A541B3778DE8A25C220A8DA9326A0CDB7E1E52BAD11886D3B864994C38DE7216A180F882C95E7C3094DD376891644984
+106363399830EAFE6C99882E2B0FBF76FECC302CEC09609F56A4198C6701C8D5
+EE1826130B8AC5455B2E68B7A65488FD1D51E2AF6D78A896F69822FA31D09E9D74966E1834D9F8922EBA35A7F63146B51F6E847447126E8C292B1B2FF6C6AFFAB09D5CA6F564CCC2B476F4FD7C22A60E5F69E3879B3FE6F98BD3A4060E5FB7D712A9983FB9B4D3E72DA1CFE1FAD32ED3C11518DF312F63715EF5D5AEEA99771ED0FB1E37333B15EAEC1BBB99AFFADCDA65375D367FA76BDB4C62EE9586378976BB0E37CBA200F26B115BE8641F7FEFDAB3C20A242579D3010C687E0C94B71D6E7EDE582831514A794F2120238412F2C61E5CEF2AAE601F13A356D9BDC2A96F25C3FEE841C6A40135076BEAFB6C3EFD82B938E1D0B40F02AFA430FBE41382D4FB7144DD225A1DDC031427853E850F30E3BC9E6859366CB4DD7470FFB13D1B989DE47BCED194A3DA66D99A
+1FF3C82F21C35B303FF2C2A78E259BA3B14BDBFEBFC8E900ABBF06A7044FCCFF
+66F5F218B7C5D34445058A84AE516F9AB297DD4CBDCBE1EB84B4D1A698FFB2A3341892A1D1BFA35C489869777EFE45DDF623190A449D2391785440E619
+610ADB6D89DA025F6CBE48A520E64339DBF812CE9DC1AF6954B3C79B92AC4CAE
+BFFE6E8D54A9BCC86D017F3792AF6895168A40622EBAFCA4958AAADCCC2D9EEF92AD7F85000F4243A585A74248899F1AA5B7B8240FD2F0D43B8A16102964EE1C22FFC2024413C079AE44A8468CD3B034DA49DEA40A31D832F6EC876469406CF5FF5DB3AB343FC163CE25B53E1CAAFEEF5650C3E31F0D90648192F5366D6C3C96183DDF26099E46D485B08D30214695BE4292C63F9785B89AE9C574DC248B263915210EC52AF4094DAF2A9600EA13FB14DD1FDDF67C643658548DDFFB3760420C12FF0BDE8B2CEC9079F368AA4CDD65B13ED217A342F2207AC129A7A1840933D9C78C81A867FFB2D2ABF09022
+DF8E7A6B269AC88B5B51288E25BE6AB4E8BE2010FEEED86E0AD218F36F31BFB4
+E6DB2EF94E8D05B2FE50DFA75DC40C64E62E3383781DB121EC0C4929550F7A7129AFCF09DD41C00E197548096CBEA915760006A21023A3E10FADF426CE2BCF90A00C16C6EB42131A105AE118FD6D44DF3F8D05CFA4C4E5060DC73E7832A8C9F7AD4BFB0912D7A2
+E76A9FAD8425D7676AC22199CD9D9E1C611B3F62189ED0634E2FC243F8643637
+C2E87BE409664285A861535093C5EA09EA80B96DBF7042F0B6FD6A1C0DD62CD0D22ED241BC5FFB9DEE31348C5CDBB4F49BED0C294BE302B061E30745593A7DF251
+7CBAD9BD29BEA37B6A09FB8990B84AB6C37F33318509C3C22A4AA9A41C1C78A1
+5FA0798D33C0DD6888AC697E1E6F343222834AF68A4D7A6A010E0811F56172043F45290742BFBD4A31632249D202F243E176650613439EF2D06103A24E5D9A
+98666C2212162B8A56725F048467F1AC2B74C083532D9EA1234364EF546B9414
+651508D4D2793CD43750525C301E538D290A4FC5E6F6A1185B685441E16A45ABBD63D933EC89292189B836C93D349BF02CD26745A70EBD368B2BE2F9E9DAAB98F18E2150CE7E17C0FA6DD314948B995D82B2B94878A8D5AB4FFAA60D12C8E094295C1AB6D93CA0A89DC4147E36CF6B703487DDBC96740BE8B85108238A74CE93A8893B30A184F6DB768D6C2C1A785EFCFDD43DC9FB050AA4D6FD2B1F9698017371364CE0B9C169F0AB29148646863B0F9D0C6D7D7248D17D72093F77147943CB132C89F551F3D2B84C9ED96A53732FD1C70ABC0CAA9C0B166B29AACFD2CED256707D64FD8743055C86E174FDE14B81525D302BFC71A1EE700B9480822784E91F857B893F3F69B4AA1D0A7E907A5ADB1AD90169C8966998CA077B5891E0110D1B83EBF44C059F56E427
+45C8CE8BA88C353B6EC0BA85DDB3CBF5CD346E6CAEDE560161EB70DCCB29F2F1
+63CCCE373AFF64CF887FC86AD8C8868CAC4FEEC1AB31D14D59CA4F325914E99BD6C6B8C28293F3C3E7E5307FD9F4EE3B9BF6F23880F20A53
+375F734DB486EFD6FE140732627A6FC3183E70C8256ABD6F3B6DE5F5C2069EA1
+44262B918D9CFB1162FC52AC241E80A863A393F06DF3DEA74F08EF1536AAF4E7D0C872A9004149A1BE9909C86EA4C9C8A578B12D9D93EDB1870142C2741628A493792E6F8B471A59B0010B440996053F0A0701A087CFF22D5013CD3AD5FC9FBE1C03B89417BA0C487252327CAB3CC87A5CF24B062231D4B3D1FE6E61F54DDD036627F2F3E790F0FA266B729E767446D24E9BCA34ABA0FF21A857342E19607CC8CD3F21E657ED92901A
+C83CA2208DBF45D8EB97088C397A1012FD8C2FE7F1CD5FD1AAF85E6699CF15CF
+E8DB16D1873C75C82E98C4C49F21CA88B14E3059475F8DD48A2B0CF71263164C00F7EAA55FCCDD4566FD530A51A0A4794E3A280652CD29F7604862CE4E87AE0F65A2CF3653E8C72F428138240233248982A6B26507AE416D74BC615350C6B9BFC38DAAD3217507B8D063C21ED4E59F2084E2610A1DCDA7182F8F850A770DA12275F32C5967CE0E8D9504E95C3C0B7F5B71307AE2F85E045B6B11DFDD119F7216D40900CA48F9E1CF9B1FA1FC372ACE6F79449DDA45BCF0F46E625A18208016BFF6AE765A64ADF867F0D8105C527C9E05AC55F560EBC3C0AF16041EDCB888A48E8317D85D71EA501718242D9197CC987C42EC87437BE0BA61EE2B2BF2B9CBAD0F726A10C7964D5CF208D6334A0F5F18F8699C1225353F3CD266382EA4E19FF9E456A5C82F99A953340B16B0108854AD213FED024D0FADC743E75364DA4C00ABEB9A61014ADDE60A2FDB9E4996DE16CD7F73FA80F3E42DA63D86C83FA62ED49719D81DD1676130FC476CF05502AFF0C78CA05FE38A625EC854647F1660D73F32DAC46C6A79B61FCDA9011C1AF2187A532826EDB96CECB7DF4D527FFAC190EA4C45D3A863FE16BDEEDD5F8E12305D2CFF21D073426F56EC0B1351A0CA79D6EAAFD81D988617993E079877901748BFFA553AA2EB1E85F60DA0A2F1E85DDC494A2242F11EB5B5C97FBA140B5A60A0FCCDB0D865237596AAFE4B418BA3C03A15CC94EF
+01A3DF6A6C5574ECAC109A8A4BB805D83BF481BEB17F67580E3A564C0DAEEFAA
+C959ACE4465A8563466AB202BCC038002A232DFB8873D578F7ACE00C3D76441A3F947D94FAEFD4F2057CF87DE19177E90D1E6977F8AAF94E85098A31E65AC896A0504C8896BA391402D57321502A200A7182BA2ABCFAB36DA7FC89FC2C4BA5B24236A9BF19E7F48CBB61BD3F04C34B95113EF89DB4EDD79EC803D96555E464F2B0F3F953319E2A9A2F016C3B83D6C2709B1796ADF49B92D1D73534B4B56879B28B9946
+FCECFA8EFA71E29F43EFA21D07C659AA28BF20FDA94BF62F4FF4A55172285726
+E39BF96ED61266FFD4238D9A8B6D57518DC37313ACAC4D0A394A60EF763C659BE43AC06DFBFCBF4C95A4D27A6344D9BC9B4BB91C069F98D8D07FD73CDD910A3DAE110A62CE308E9DF27F23130BD774EB31D70796F9C509C6AD5D585D85198F7DF1957FA51F9AC14DF645BB511334E4B2B67B0F31E3D93BE8FC0ABF9C28885442B8E0019D607E4209E3EFDF9A8EA7D3340F85DC710CE77CC9331444B4C6A7DBB41EEC7A1AAAE32BFD90874B97490221A033E27E320A3623399F6F4E90233BB58BAF58D7C1CE6CBFE99F2430309C0ED84FA3F7E1344117B4613302C6242046EE5A5E36B6ECFC5269D64E717CE25114C289EB485579184F492A823352BF564A051FF9893F7992E0A172A0
+3076A42003FD25CC6D5804AFA70ABC42BB5E78680D8B0495D6A22EC8E8F41437
+58CD43218DC447E8DCC6BF5A5BAABFE830687AE959A176ECCCBC8F470F5786196F09BC68757F603B9D89E04C62C8CC1E3C5FFC278BBF10E1281DAE114C3BE5BE8A7391D85FFF35F809711D2FDFCCD93EAEC7BDF8B9085BD3EA3EF84C23399D6049FC86C37564D605BA1EC3597F545282B00B4E7131EB9FCA4DBD61B873A065
+5F8C4C3A700016A17010C3AB4BBE4A030B305293B6F2FC335098396A660B0ACE
+516B0B667F2DC99B9496D92BC0E50DF47B9FE5F0A5FCDD2E6227A5F280A1E31CDD719B75255168CBA99EFE99DF98962F2A81223ADD7604E8AAE4B5C1544FBEE967D63F944A8F17073525DE954F8DE3A5CE264C7A4D8AC39C36D64221DB3A0F12D15216356248FD30419B6F0882F4EDD358E2908CADBE99
+443321E6C4ABD7F960719704FEF774F55D00A6C81BC245DE5FFDF61F30F107EE
+3F082146CAD2BB8C355B2C9256D0F69EE3B739A0DE0DC620E8DD87CF88B1B1403B9C7BC68D057121F210CF8E2D0B9EC9A23C18382FA1892E37DF0DB3E961E3A3CBD39FFF75273DABF9689CCAB9EA876C261313B1A65B0D9F92C19CD482B6DFFED709028A88E35EAB77B6AAD33EF970017A9FD4409D9AED7886CEFF438B95A06E6E6CCBCFBFEF4167C7F36B9005F2B0DB8F5E590D5041A30B25690190EF1CCF230E02B907EB118384C7
+DE545AC0B084A7955DCAFB740F27EFB3D1707649DCADC084EA16BCF6C212CC7C
+37C8F14C59C372722E3D6AFF0A9DA4E81B2EB60313384944FE430649F8E47642402DA76FAAC2FB2B309BD7D69B7C9A84DA24FB8E4CF5713E95909722193EB0E9D23EB198EC1EA28C32EFC0B2ABA1295086070A2B1CC5F14C30A9A39B73536743D1F3F8D587B09DAC88263B1F778F662815C18EB5A7
+790C91EAF7ACAF212D36A10DA5E000840368F4491BCF7D752557E61C4C297664
+FFBFC7AE0B52096B8747368F20DF6CB592EEF3185754E69343CA75C6E95253B603D0E32A50C898F39A092346949927AFED3D8CEAC5CB4E548E8AB6F78E9EEB725B263C1BD5458C6BFA7ABD1E163044A195141B04E0D85E2400FA4B43F49B072D3B8E7F734D91C5802B3D912FD927DD8A243689ABD7E2510EA9D7B1D8E5562E5B93AB305B6E9524BBBC6248A7C179E82F2D95B8C8608889FDC20B264623EBE14D0FE94168824B1FCDDAEDEEE2FDB242C015E85F13394808
+DCD2985F3CE043529706BFFD871450A2FF64F52D34B439C15822B568EFA99681
+D358DEB5BBCA768E1EDBE4CE17155F712FA1CFD2D8F01A430CC179F25F10CD4135340816125D69249C14C4CC35D95398B1DA7A6B04D414E30A9C935DDCE261160F9475FA0CAEFB717DC853D88C4FB73C09D6A2338ED48FF288749C60AEE06249688662D2429805A8CEAB11F890D2B80E540CE3D63BA6C33520526E44C49D3C90BEDC4F7B09766AC59848B27089D1A1302AEE1A48AC690BD6FD9EECB004A7AE04F54CCF95A38B18EE6BA8A68E2B7DF2D42278EC4F257067CD5E4F1A525B70E0811E451A0A0F60EDF1EDED27D31DDBAAFA7F2249B82DF4432E72A3C737B2E7BD4B618F5FCFFB98B2A7C085BE2805465308BF5A9329E44FACC1E56622943879E02F92104EBFA5A6BB6A27504684F53A512CB5248D5AE0AC5D43630CD9489D9E1444330337B7F75B72419C50E74C0C6434B1472A75A4734AD7F178ED2394BED93AD1A50624AD56569497071EC4BAB52B9BB17CE6FD97CE8B7F272E2BD3D6B3F76624C65D021AB73AE340FE37D264C0503EC22FDB243D64B44F998D29757B75697CE8B969407F76EC2FD0D74A827BEDFB831B61B6984D921DA0DEAFBC03ABFE49ECD08B0826E74E8C658F850D58993B588CD69A3E74AD188C9B4BA3F183FED94DF4EA
+3DA24A9643639BAF139FD085C8495C2BD2AB477205EB1223D73476BCBEBEBCF8
+ED612E52B4B342AABB2BEA0A84286DE5C7BEAE8DFEACCF16204E9C6348F4C3234704912B4555E223193872CD9247195654EF52F7F11DC959F886CC0E0B0139F4A7026F0FD354FE109B56BBDB3A219782A557F363A382D2D9CC520FAD3214775FC0
+29ADCA083604DD851085B6835E72E2E2908C118257F2464FA1DF9F2F6BDBD30E
+7C59CD36764214CDB7FF055027B55B15A0CE64D7CDB019DA9188C7573B64D603C8
+CAEA5FAE612C99921F3F103C0C183F3EE44030C960FC52A0F2C36CB38B4F43B5
+13D2F1919A147EFDDFEA05C85C745D3E5583CCB40525C6E7C682B20BA0F4266A415A24C23D4BECBBAEA77A525FA7C17AC0532CF8FF3162
+72DD8968889B6E8340DCFA6EE6EF29CF3CA024BEFEDC0A9F0946ACCC4D418374
+F9AAA4CD436EA8E88A4058F11BC7F47FD1AE6F9724F79B32BFE609EAFAA6463127022CBB4656CECE5ECDC905129EC7B6B8C14E
+12FE99F16240EE9EDCDEFDF0D88D40CDD9F8F50E0951F230749B88CEFAD55085
+ABE0D9FB71850671205CF3B09BEAB0B7A0E13BFA9F3AD17349FC07CF6FB5C1A15AC3A6FAB50EEF00D9AB31C87A97424EC5B2B6C41FDE91D9155D28AD356B879CC2DAC2C787FC54EDC89E0C384A38D39785A071882137487354F9D8FD7FC8C904A93CAAEDC7E0287A5794ED14DC097C8CF39B0C9ADDBB26785E89B94EE368C2D9865D909BE546346DA1CF9AEFB879466C27B78E4A676595DB552D4F50CC35487239482622102AFC1F9E283F7A169EE9E007498174DC88ED7FAF49F500906D19EFB800AC1C039BF1EA3A4EE69F3E2423EE68505AB0F25875CD140AA11C75AAC7C89744B9222E6F020448B7E7DA217A1BA929418177C61F73AC2D1B2E3E808EA5E359EB2F71C7143EB4A2293346111B658E7D43FCE0E986644B5FB259AAA765
+35F10E0D54223256C42E9D3150BEB7A57D54F9FEC064DF12DA383DFEDE52707A
+6186C0C073D70140D25BE4010A6416D2C6C565D182F17F833F502BA7C4FB9A08F41D1316B9AA30BC74735D1C0ABC3FCA450C878C36FEAEA48FC58013A36D03B9912BCC9D1BA82159ADF44B80A6F1DC186A0048F547E8D9AF49560124B115FA00D983CF348E569F3D40E38F4632A44E7E85B087F76DBF9E2C9AE193BDA174C56504297D87A36C0ADE10C1E78421FFB39F9DE97D7096DACE5EEE6F0C8A03083BC996CFA6BF23ED9081548B9F70
+9C648A806D6304D59B83283B5EC99B8CF233EC76FD87A9A7550BB187965EFF3C
+45BFA36E1D5DB7800BFF2294B2F183599FD78FCDFA72AC53E0061CC5E8B304CF2BB030C96232BEE797B95844ADA0C8D157FA2C683BF506A74F239B6E34751787BE36F37C2B6D3A4E1828F6CE4DA6C553CCF5BF208FA3114AFE864130B8D5D34F5EA5B8323443614E1110D37A7BBA195FCB9B3EA34CE132B923AFF6E1A0711EB20B1BE1CCE03248D972C79B3821D5517CA3A09B99DAE9CC9E06916FEB30544E9165AAAB25CC9FC2C8D7B463C44BEE29C16BA30C6937E48F5D0C1830E2A894909E4E69E834E28F99BAA13453CC9970E1C3F8DF4BC5F3E6E0FAFA16A2FA635C602751B4D98FFA06E4E07564F4C002AA590764F5B83F18B96BF432CBA5CAB50A8BA8A22D952875FC8CB6ADA25EB21E50B207AA8180225C0BD73175CA5A24A7DF7E01F747D163BC0CD24FF3A353DFEEC57291E7F97369D5CB
+B91D5DE9297F3BBDA4190C7D717F71D6EE5237E6BED7F92BD6C13067CFCAD223
+A1F0C173AAB2163BA089438F57075ACF88D284FCFDD6BB9C3A93B1A979E9505A3484ADF597A9F442808F0DE97D4FF3D348016BD67F2393677147FCA36132CD098728405CDF9DA6BAF8F47C979D5B8B5F77E93AB93D977421C5FCFE62F1E8892D514D69D5FD834DFADBDB336F
+5B2E5C1D9FA3DBBC4B847E6D7FA6B937F70249A7C98B66CDE4EBAF3CC48E9BE7
+7EDD20508F0FB143E73E6C7391C8E6FC375AE7FFA1FFDCE0C6B56966BF8E11966E467E42ADC4564D889634E8
+C412EF3286E57538EC70950C4F43E53C91DC59D6A08E1DD73F4E8FB643F4D7AA
+DC
+FB95AA98D6E6C5827A57EC17B978D647FCC01D98C357B7E64989AF57339E9AC3
+247DED699C36E18D8BDC40C68081809B9BEE470479F18A97288AB790A451FCABC1F2C6C9BCBBDFFC1942DA73706ECD9099243455A7B9941C6E388DBF514D116A9AC88389EA5B9D60CD1F81FFAB2F3B8AF6B590CCF0408F08D79190977DAF7978C124CEBEF404DB773B567C867EE87346BA01A817A58DE724F7600399B459A343
+AB1E1881F6199DA3CCE88934A536FE4D98DFE068222274F76AF36E8CDD353642
+E5B10257520C2C2F867370B35B778828B6C426DCDE86C575BBE3E1F10C09CBF70C5EE73FEDF23FBFDBA10945133ECEA1B34AFFAF09EC5C135D2CD89FA18A7F9594F28C7E5BA5F298F7A164214007DCBCC9A60F9DE9F227AF6FF458EA4C17176035AF07C0C7567B01F5DE6D6085958D4611AF
+E4901E483D7BD3621A452586839E997F50308A911DC6BFCD5D798B8210A66C31
+892C0A4827D16C97ED10F2CF76D22A9F7B3D99D35ED1962B1B53CC72AA42CA755FBB68C33064B74637220F56C72498149CC9131DB5E5FB247AA43EC40682075489D94744BB51872268FF4F0E411A9EBE3A17AA10D6A2A3A25ADAC7F38C1D3840B05EF2E7B85E80F4A2A51863C646BA64BD55D94088F2C1A569894860CACFEA28B9E962D3A0D1EBC951
+D8929255FD697EA933BDE8B1562999BA4FAD7AAD0A3B4C45549507FF337D4426
+D45E7D432F534C749C5193240C1AE2BACA7EE4EDCABC840100C71B4962F09551C25A3B7F07F223B89D82E0E60EEEEBF032536BA475F1351FE4D6EC415B1C26A7119CB3D36E49361097FCC987AC02B315FCC90BC63401C769F17BDEBF089786097EEFC1F641E15363498877A5797252E8BC696D3C2DC0480C58654B2399C552ED2D80239E757A9E1E1621785F5F2FB8AED8A816EA1B2E599CD5F4F22A7A12943035E7E801E3907E1064563E2AA6
+1B0E508C86808B6E224D1A28755CC97849F14E80A8A735D418CA34759B760AF4
+B2F74EBAFA9AD7A2D0D98FC7D6D3DCDDE0850DB67B09D1BE179F269C5DA8695A60741F1583CB0D16949F556218FB7548BB25D740EDCAB8B5421E42F02EB47A8C421A415B395290112BA7F938738377A893507B48734A5229F47952B7AA2460EF8D45B2514508B4F90EF9280E48A89536CC36E0B24D7D36EC82DE49EB9FFC7CACC7C3397A3FDC9BB558248631737CC7E720AA9DF3F5CE1CD0E9A8AF6F39323AC10638291584B8C985971837A54596696ECD3A6A5E4D156A14
+8566316B5A09D988B3749CA3C33602E43F822775580C47BE2B20D65F97912EA6
+08BA45C5F6438583396758C6437521D6CFE8D50C02501908BE897F7F08594A9F636F615A2AA84A0A7EF64A80B2D023461A02A2842401D16233B679130938B54819E05C2BFEF2A64E68C39EED3159519F63C3BD84E6346A0F78271147F6CF29FBBFE8A9DCF5D73383DFEE6B265789D8D6D2DF51253EE24DBFBB30D0096B081D83191EE79532AEF96918AAA9A5AFEC9B58C1B5B0BC014744B5C181FE59D6323DDAF8228AE381BEF25EDB769435D9C48F63BF63F1457270A64A6FA6F20B424D74278BEAEC9F6D07605FF857A33B652C2C5DDAB53CA8C38EC34703EF69DD7CF608B145BA865D8474C7403B7FC501F5CC508A76FC6DB1890EFA0DA5B1FEF7FDEF5488BDD73FB387B435085E168EFA785727AE3A719AB43AEC5DF4E0CB9329C290B266E75267F962D89904C994062389041FC0B0C43F5D61EFC185
+2C3ECF89AA956CCBB01288DC3D393909D4517BDAE316598F041F2018AA83FEFD
+55F8C66DDB118FDAFF6638488F46E007FAFD504936B3FEE05CE94A26781620DE3DCFAAFE4E0CD8EB59A2F76D35C48297DBCE0DDC1292C413F1191510F7FDD9692502524C814CD4EEC07E23BD17456B11E9612D100B68BED3CAED0C4714ADD490B99F34EC21F72BF9BDE970936CF5C688B88E4C3DB0B5BC7BA15AB2F30F1E33A5058AB5A24A582D9D300202F8A22DF0ABEB3E6EAEE2DCF41073D2FBBE272E232EB40DA7123899045E07DBABE4D104363913219979CAD1039127CC9C946E182EAB1A5204A920B132E231A5D629808797BE8C0E6B114D9BA682963FF0D5A58FE8203A182C2A6EE3D80BFF34D7033C16C21E85B40DCEAB2055B21D94CB3D2774D0CEA09008AC77B0FB2FDD8CDE487CEE173F59B5172BA0C1DA
+7049BFBD7546B83F49090886E59C5F4EAC427FC7FD8FDE8F9E3FE95F74139D48
+70D1A812EF53944B80BB715B1A7C67E56BB8717444A1B980D170EE481ED9E91FEA8E02AED53E422885153F7AE58EFA2E9C59EF9A45AAA58C2101437D8972EA3D02E6BA80C793A3EFE0E3E6DE2D0B5B4C724D72AE7A67F944B34F31D5C43E30683E5EC691B30E2AFDBD0388808C5E82B44690F0B32FBC37768D1E192FF0578A1DBA82E6CBFF709E3EDC1C7CBDAA8529E716E362D4B5C49FC13F0E6BBC12E26A643E316E291535AFFCB86ED654540FDF97DF0B379CB0F603D7AE9BA20812C3A104FB28A763C031195B8B24AD10F66CAA561A60F3
+3EECF227DC2B8F1152BCDC30E55D5CBE90633A97C70E59CEAC9EFD22E2798712
+01FE1DEAAD45ECF17FD6D7FFD545A314CB41493BC85F9F493C5226BDC3532AEC99995855B2C9A7C2B5A7ADEC326E47CBF212F38EBEE9E17DD2CC577419C09D4EA4E63D8791916704406F2339AC29423F4A42C720194BC56CA614E4A23D7CEC9D3C75D2B278434627828781EEF44BA37ABD31352B65741B84847369F56D1E73B7DEDFC5F479FA00F09826223B436391A122375AE7369856A59B431E5D4D43EEE363870AE88060A3BFAA948346DAC73695F56E68CD68F4BDE723C36C8D438EAB39B125CAD37DB65E9E37BE5E0A23710263E0C2727BEBDAEF9879F1B9834BE28F1012A28DEBF85E7BDC879B1E434D137EBB74FC872D726A4F8DD22ABDA56E7D4E
+438A41B751A9BBAA8932618AB92304E2D1CFA5045C14B7593424337B5C7B7E76
+18D829294CF796BC2F49DE7AEC8274FDA7C8C00FC7C2B102CFF0C95913F489B5E73D4B7C2174DAE383D56907D27A6333F6326A2353A829FDE377609A1A9E274A4135CDC46B537DFEFE9A152FF7D1DDE5BF44804E8E1511E6B1DB28369229DD8A32FB25CAA6C02E2664C9F99A02167657C750435BCDF32DAE4321FB1B123535CD1D845DB44DDCB0B8E8A1C2C22D7A0506D0D0AAC9BBC69816C0EE494361FF9FE933E4177F9EE97E68EAB199E1AB4F55C3DE25F10F9FBFA1A95BF6D8A448ADAB71318A3A1809C85E54BA99730418FE6928BB918D84FC7891FE2B3DBE
+BE26A6DDEFA253E92848433A58FA919A974B20BD2AE48DF760314747A9D06AFF
+sha256_multi 1472
+5
+A768DBB9E40163809332DB736A69D079CC11D577ABD9B95A56F34E404D17CB7AA710BB1ECC8FA1E705E84F22357B55A291B2CDBE9444D4
+F4153913984AD87F8A872F1F9C05D51E30D8706C7D2D6CA4D769E24E9F1659FD
+2724
+496FBDECAC3E4D3A29ABD50E91B06EBF851CBCF4F4630A580CD6A7ED860BA04A
+8B775F8192A2D75A58635121AE8F3015EAB3C20C737EA340F2B15783E28898E1D45AE54E640DD60DAB4F09D6924E94843602CAE3D115BF1080D2287ABB79829F
+8C7EB565A94834FD36250D6EF4C8D431C6CEF5A6232D38F266818FC93E3B5722
+AB3D78595EBC583E6211FA457C1DF7C65E24C7853B350D5953DF60D2407DBDD3E8E9490F919D15C219A26686281D5A09F0FE164FF3FAE5323D737768639949AE819A227D283C8BC8913F83CB8066E0E0E80162C3E9E5B8D8861A9F0E5A25F0626E24833D8777CB401996D7C8510C72E3DC236276082D80
+B83956024231E7C9A6206309CF1723EFAE1C186B0D8B01E52885A6D171CBC38C
+66
+252F10C83610EBCA1A059C0BAE8255EBA2F95BE4D1D7BCFA89D7248A82D9F111
+sha256_multi 1473
+1
+300315216D59B7B3CF5378B5006B8ECB1F5BB94365626567CE74CA7B54AE2FFA149A1898690D804DD3205627EB44B00DCF84B08B1161B9A7C087D8936E9B700ECC71818574AA106C6B0D7E89F3A59A9A3A033317322BB147D31223F24C855AD3BB47A5EA5337E700CA0E3FB936CD8BB772D7F24EEED0BD738048DC9C913772E27A5F96EC431607303F923EE92683AFB6FC546BF296F1913938A17CADF499FAA1BA7E9907526947F0C489642532316A871E98D2B2533576B5DE09BC8952D41B3ABCA823C5DEB6749F
+CB3EE37822755CE4040C870BE50F7A07D6946F6E17E88BA95A1E9B841BC43675
 exit
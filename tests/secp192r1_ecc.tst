@@ -5282,4 +5282,1134 @@ eccp_jacobian_point_equals 704
 274C2E4A7990BA819CB396C3C4DAFFABEE708A486CCA591E
 0
 0
+eccp_comb_precompute 705
+4
+1
+eccp_comb_point_multiply 706
+000000000000000000000000000000000000000000000001
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+07192B95FFC8DA78631011ED6B24CDD573F977A11E794811
+0
+eccp_comb_point_multiply 707
+000000000000000000000000000000000000000000000002
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+DD6BDA0D993DA0FA46B27BBC141B868F59331AFA5C7E93AB
+0
+eccp_comb_point_multiply 708
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+F8E6D46A003725879CEFEE1294DB32298C06885EE186B7EE
+0
+eccp_comb_point_multiply 709
+4935B675F501084146F7C9EAB38CF45A7AD98A70A603E9E2
+02E01D8AC963D4403F818151580B186DC687AD0E7725B82B
+969BCB7D05B602816EB7905BB442229E264AB5210197BC8B
+0
+eccp_comb_point_multiply 710
+8A20D9BFD30288E74120AC1510BC09C512EE52D232477962
+CF7C54E32460E0449F0D4E1E3D7DB51C5620B80A24D7D992
+292A10BBED589B23DA4A9B0112199B5EDBF22CB75A12CCFA
+0
+eccp_comb_point_multiply 711
+672490E5D09B0BF1D58AF9595F53F30140BEE3855543DB2C
+1E8851EC7D96E1D0E756E171876B5A9C64AD4B7EEC69B53E
+10B2B8914CB130C4B80B9646AC685BEEFE4134E7119F8550
+0
+eccp_comb_precompute 712
+4
+2
+eccp_comb_point_multiply 713
+000000000000000000000000000000000000000000000001
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+07192B95FFC8DA78631011ED6B24CDD573F977A11E794811
+0
+eccp_comb_point_multiply 714
+000000000000000000000000000000000000000000000002
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+DD6BDA0D993DA0FA46B27BBC141B868F59331AFA5C7E93AB
+0
+eccp_comb_point_multiply 715
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+F8E6D46A003725879CEFEE1294DB32298C06885EE186B7EE
+0
+eccp_comb_point_multiply 716
+D24375777DBD48A33D657B91E8E0E2373F725D532EEF070F
+AE7B5C31D39BE9383ED602B98F5012DA15A544FE3CA19908
+829DF1CA980AE2CB904F841F2A638F34D068A6E99BD42489
+0
+eccp_comb_point_multiply 717
+A77BF53192B007DAA3377235EAF5C04FBAD02341124327D3
+D2772171E5356865D093A96E2D9AC8B82B4BF89361167BC8
+6CAD512DD88499A883703205AA22B51502D4E5FEED5A6221
+0
+eccp_comb_point_multiply 718
+6AFBEF4FC65A478B6CDAC39DD6AD24679C5D1EDB1427C9D5
+890E2BACAE061ECDC3B5EF5121216B81E032C0C4C0C0F00D
+9BDC13F9870A85F05C2BA9A7452AB6074CEB6A1F19B8A8C5
+0
+eccp_comb_precompute 719
+5
+3
+eccp_comb_point_multiply 720
+000000000000000000000000000000000000000000000001
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+07192B95FFC8DA78631011ED6B24CDD573F977A11E794811
+0
+eccp_comb_point_multiply 721
+000000000000000000000000000000000000000000000002
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+DD6BDA0D993DA0FA46B27BBC141B868F59331AFA5C7E93AB
+0
+eccp_comb_point_multiply 722
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+F8E6D46A003725879CEFEE1294DB32298C06885EE186B7EE
+0
+eccp_comb_point_multiply 723
+5986A700FE21EE087081EA97A853C4BB0D7E8A95BD7BBC08
+3859ACA1EA46C22CD78AA4A4225030141287CBC92ABEC6A9
+2BBBB3F275D78FEA5C5863F56AD78A72E303E1A9DB9A52CB
+0
+eccp_comb_point_multiply 724
+7A7FAEBBA48B2364D0E93B1DF9744FC0D85311B3031937A9
+00025F9FD2FF6FB26EE1BBAEBF0E62A5D324B1C1B5DAD556
+8BC97A16CB5596DE05F183820BE8B22FBB6E3562ACE98C98
+0
+eccp_comb_point_multiply 725
+9C2A5DA1567C2D5FF0B169D09CC920F623350F9240C09BA0
+F2FD9B6B2E99AE51BD3116CE836A01846035F257A477EC56
+841E72486648745DE5DBC480DE495FBEFEE309B25DF87A1B
+0
+eccp_comb_precompute 726
+6
+4
+eccp_comb_point_multiply 727
+000000000000000000000000000000000000000000000001
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+07192B95FFC8DA78631011ED6B24CDD573F977A11E794811
+0
+eccp_comb_point_multiply 728
+000000000000000000000000000000000000000000000002
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+DD6BDA0D993DA0FA46B27BBC141B868F59331AFA5C7E93AB
+0
+eccp_comb_point_multiply 729
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+F8E6D46A003725879CEFEE1294DB32298C06885EE186B7EE
+0
+eccp_comb_point_multiply 730
+2416B27086342D4AD0842B04B44989213A3B91C1A67AFF4F
+146FE2F2995F548B169C0F9C842AD96DA57EB16F2545ADA4
+DC6917B97159E129FFA4B8D9B9284E8B223A1B2F934D254E
+0
+eccp_comb_point_multiply 731
+E950BAE64D523A59C07F840764563CFDF9C84F801946EAB0
+67B679A59D7605A77D4EDA7C7919A8F4FD968E4AB23ADE8D
+F316AE83AB23EC662DC67B758CDB000A61CEE50BE4B9DB6E
+0
+eccp_comb_point_multiply 732
+AE09A42DC691369F099E82E5EE64E1DCCBBB3962BFD96798
+F9EE159AAAB4D64703B4E52858A730AD8A0B814E1DC2D85B
+26DF367E448DACC6E0D39835352CE8942CFF51D9DE1F08C7
+0
+eccp_comb_precompute 733
+3
+4
+eccp_comb_point_multiply 734
+000000000000000000000000000000000000000000000001
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+07192B95FFC8DA78631011ED6B24CDD573F977A11E794811
+0
+eccp_comb_point_multiply 735
+000000000000000000000000000000000000000000000002
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+DD6BDA0D993DA0FA46B27BBC141B868F59331AFA5C7E93AB
+0
+eccp_comb_point_multiply 736
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+F8E6D46A003725879CEFEE1294DB32298C06885EE186B7EE
+0
+eccp_comb_point_multiply 737
+26D05530B5214BBC75A684812B91105815BD0C7187CDCDCD
+32005CE2673C8F6C07E5C661F3152F0A7B281B735C83B096
+977AC81CB73DDD6998407733098C1898D7DD8733699AAD0A
+0
+eccp_comb_point_multiply 738
+F9B970F82C43C9050D097024FF4ECDD78A50099A43DACDA8
+95224E35167774B5546732173E061CC926938C482D8187F1
+62EEC96D03F88F4EB0E602722CD1C271D4F30A1F7ADDA20E
+0
+eccp_comb_point_multiply 739
+26B63B6EC79B226773BAD9A903DA3F26A67AC2ABF7DE75DB
+CF58552D5907CE5B44DA2F6A25EB09D118981EA8FFE347A7
+60271D62E602FDD48FD4EED5E9F5BE83FAF430F9AC9EEC33
+0
+eccp_comb_attach_const_table 740
+4
+eccp_comb_point_multiply 741
+000000000000000000000000000000000000000000000001
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+07192B95FFC8DA78631011ED6B24CDD573F977A11E794811
+0
+eccp_comb_point_multiply 742
+000000000000000000000000000000000000000000000002
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+DD6BDA0D993DA0FA46B27BBC141B868F59331AFA5C7E93AB
+0
+eccp_comb_point_multiply 743
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+F8E6D46A003725879CEFEE1294DB32298C06885EE186B7EE
+0
+eccp_comb_point_multiply 744
+B64BA4FD98E616EC8BB01460217F871CBE0AE8FA1CEAC2CD
+DF8C3BBBA032AFA70138FA4B0C9A686C17CB221CF87CE9F0
+86371164DDD3193AAE8B76315E9357FC51E7AAF734E669D2
+0
+eccp_comb_point_multiply 745
+C37F0CE876CF29A6A34FAAB921EB4E0839F5C88E2D94628C
+83F2B9C2358057497F7BD425E0DACA4EBFB678A622CD0B41
+4E3E14A0197287E2F67BE17E2AA2D43699BDB9738D989874
+0
+eccp_comb_attach_const_table 746
+6
+eccp_comb_point_multiply 747
+000000000000000000000000000000000000000000000001
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+07192B95FFC8DA78631011ED6B24CDD573F977A11E794811
+0
+eccp_comb_point_multiply 748
+000000000000000000000000000000000000000000000002
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+DD6BDA0D993DA0FA46B27BBC141B868F59331AFA5C7E93AB
+0
+eccp_comb_point_multiply 749
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+F8E6D46A003725879CEFEE1294DB32298C06885EE186B7EE
+0
+eccp_comb_point_multiply 750
+29B21B6C6444F53B24F1E3CD369CBD3F35FEF5876AE5BC09
+DADD7AAEC33E4418EC800A9BC2BA8C4066C2B6FD84095C89
+484EC7479B89B3B7CCD0D257B8E9E467E595D2DBE43A6653
+0
+eccp_comb_point_multiply 751
+3383AC783005A6589B3D2F10218FEAA6F488C78DD79E9BE6
+75B5E8A18AB9D5099EE345FDFA5137EA59F309F801BA59D3
+D3F4E698166A673878FF5595DFCAA119C08392D70018C65B
+0
+eccp_comb_attach_const_table 752
+5
+eccp_comb_point_multiply 753
+000000000000000000000000000000000000000000000001
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+07192B95FFC8DA78631011ED6B24CDD573F977A11E794811
+0
+eccp_comb_point_multiply 754
+000000000000000000000000000000000000000000000002
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+DD6BDA0D993DA0FA46B27BBC141B868F59331AFA5C7E93AB
+0
+eccp_comb_point_multiply 755
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+F8E6D46A003725879CEFEE1294DB32298C06885EE186B7EE
+0
+eccp_comb_point_multiply 756
+6B9EE2B31850F2AB11CDA0B83D693DA968311DE3071DAA8D
+580735855049E821F6097535894025F3D45004FED9C9D0C9
+AA243E4DCDD6475D67C360514455532F0D9778E0ECDF27C9
+0
+eccp_comb_point_multiply 757
+D34787E4FD2FC982B24FA0D25086AFABE5DB963BFC17EBBF
+D00E341A87FF976DCD99509906C1D4411CBB2CD5163A69D5
+C83A60CC8A8584C1970E8A719F4F5D653D6353B508EB451F
+0
+eccp_comb_table_file 758
+1
+5
+2
+eccp_comb_point_multiply 759
+000000000000000000000000000000000000000000000001
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+07192B95FFC8DA78631011ED6B24CDD573F977A11E794811
+0
+eccp_comb_point_multiply 760
+000000000000000000000000000000000000000000000002
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+DD6BDA0D993DA0FA46B27BBC141B868F59331AFA5C7E93AB
+0
+eccp_comb_point_multiply 761
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+F8E6D46A003725879CEFEE1294DB32298C06885EE186B7EE
+0
+eccp_comb_point_multiply 762
+9B11BF0CD848292D993955BE58886F39137C56AF8C5187C2
+D4257A3BD83A6DCBFEBCE0EA7755FFD0DA5A02F271CABA91
+69ED8409F3084EFCAD1055ADD4357770458B0D4CFD7A6D45
+0
+eccp_comb_point_multiply 763
+64961C0158043666ED60F36482A5F8B31634106F49E185A0
+8AFC48CAD5EDA028EAB807F09C7365550D45346DC8AC2720
+13FB80F12823CEDFF9267497DA0BEA8C306DCD3FEFB32F3A
+0
+eccp_comb_table_file 764
+2
+6
+1
+eccp_comb_point_multiply 765
+000000000000000000000000000000000000000000000001
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+07192B95FFC8DA78631011ED6B24CDD573F977A11E794811
+0
+eccp_comb_point_multiply 766
+000000000000000000000000000000000000000000000002
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+DD6BDA0D993DA0FA46B27BBC141B868F59331AFA5C7E93AB
+0
+eccp_comb_point_multiply 767
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+F8E6D46A003725879CEFEE1294DB32298C06885EE186B7EE
+0
+eccp_comb_point_multiply 768
+D8F089C71A8E39A00847B35FF94ECF6804C663426A5DCF78
+4332B3E2F0E3B51E3119CD0B691B21FEEE643C10162607D7
+48748159D8E2DE91824511B80AFB406C6D2A8CC3C86D8596
+0
+eccp_comb_point_multiply 769
+15E4AFDE597D31C4CD9645CC398CFD10A6F6626B71D81317
+8F239B1D360C4F5C1C4CF6CAE2694E5CF30572D86CB6A2B8
+6AC48F12E4BD292B2560DB319C954201C6DD5D574885552F
+0
+eccp_comb_table_file 770
+2
+5
+1
+eccp_comb_cr_point_multiply 771
+000000000000000000000000000000000000000000000001
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+07192B95FFC8DA78631011ED6B24CDD573F977A11E794811
+0
+eccp_comb_cr_point_multiply 772
+000000000000000000000000000000000000000000000002
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+DD6BDA0D993DA0FA46B27BBC141B868F59331AFA5C7E93AB
+0
+eccp_comb_cr_point_multiply 773
+000000000000000000000000000000000000000000000003
+76E32A2557599E6EDCD283201FB2B9AADFD0D359CBB263DA
+782C37E372BA4520AA62E0FED121D49EF3B543660CFD05FD
+0
+eccp_comb_cr_point_multiply 774
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+F8E6D46A003725879CEFEE1294DB32298C06885EE186B7EE
+0
+eccp_comb_cr_point_multiply 775
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D2282F
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+229425F266C25F05B94D8443EBE4796FA6CCE505A3816C54
+0
+eccp_comb_cr_point_multiply 776
+9F3344D507B07FA39C6AB7104A08C720CEDE24428A013FDB
+F58FAB9A30656713563D826B34E29559DA58F05BC60E2FCA
+E9EFF64FE8E53B1611D28F2E7CDB4852062D1F41D6C6B580
+0
+eccp_comb_cr_point_multiply 777
+0C68EC5541DCE77FFA17FEA535C3212DD3B9C9D9A754AC3F
+6B6ECF23F874B60299AE3C04E19041E20BAD04D8D7F1EAF1
+4F9A86FCFDC0732786B24E147FD6E20747532E91FDEC8774
+0
+eccp_comb_cr_point_multiply 778
+14D138AFFD22BB4222527DBDA43E7740604D45F265AEC90B
+49A19A401AB2B75F9FB97535ECFDF35D8BBEBCD7256A5EEA
+7D82A3EBC2A2E3ED4C300DDE723544EB4331F9653034F069
+0
+eccp_comb_cr_point_multiply 779
+EEB1C97EFE1932A285B94CDFFE55088B01F282CB7627070B
+C349223E2F40E9A9FE2AAEFBBB0B088645D70A7A42EC0E96
+D6D72D0B569B5250005E9E55E181A776AF43D27D8172FE07
+0
+eccp_comb_cr_point_multiply 780
+E895DEA028EF45E0FFF91E751298DEB0069E277D3E1FFBE4
+84932037AD1B6AEDE5E287487EF0A39FA116A7258096946D
+75453FCA0A98484B2F36D64E0DE9F91155AD6154AA4340C6
+0
+eccp_comb_table_file 781
+2
+3
+1
+eccp_comb_cr_point_multiply 782
+000000000000000000000000000000000000000000000001
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+07192B95FFC8DA78631011ED6B24CDD573F977A11E794811
+0
+eccp_comb_cr_point_multiply 783
+000000000000000000000000000000000000000000000002
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+DD6BDA0D993DA0FA46B27BBC141B868F59331AFA5C7E93AB
+0
+eccp_comb_cr_point_multiply 784
+000000000000000000000000000000000000000000000003
+76E32A2557599E6EDCD283201FB2B9AADFD0D359CBB263DA
+782C37E372BA4520AA62E0FED121D49EF3B543660CFD05FD
+0
+eccp_comb_cr_point_multiply 785
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+F8E6D46A003725879CEFEE1294DB32298C06885EE186B7EE
+0
+eccp_comb_cr_point_multiply 786
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D2282F
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+229425F266C25F05B94D8443EBE4796FA6CCE505A3816C54
+0
+eccp_comb_cr_point_multiply 787
+66DAFD61EADED54487E414F8997C6B39D0EBE5C2D786EFE6
+D2687371B5CACB640E5692C00DC56BFBEFFA951C8F365965
+A25D5C9CB7DDF6707F7A56155882E237A7D2B1D11DCA70EC
+0
+eccp_comb_cr_point_multiply 788
+E1CF562F89032E245930C672A78851DED4F65EB6F8E0131E
+048CBD9FDCB0CE89A6B64B95CF85CD8336D9B3E286B20157
+58FF0CA26EADCBEEE56786EBB7CB3FAD181FCFB2BF484273
+0
+eccp_comb_cr_point_multiply 789
+9014D46ECE27C43B3FA56CC20604C16A66C2E6AF1150446B
+B1872BEDBD6CFD0E7A9D37EFBD80DB2B2300884F34E4B1C7
+4E4E2264D8E34EBF78413E0BBAF1DCC943BDFA4C9520381A
+0
+eccp_comb_cr_point_multiply 790
+1871D30B90CE99BE6DC75F6FC354BCCB47A0FBAFAC06350B
+AE31CA326B5FE7889B69679CBEC348B20AAE74511E7AACCE
+2F9D502FA149BA16DBF6A17515EF4FCFE1041A0BF39C32C7
+0
+eccp_comb_cr_point_multiply 791
+F850113DE52A3B3B8FF1DA58A38356B847472CF2AC844D27
+9561B2485F29DF44DEB4F7DBEEFFEA7B2750DFDFBBFAD71E
+2161477806E5B8C323EBA3DB2FE9441C6ACDB4F867A25698
+0
+eccp_comb_table_detach 829
+eccp_affine_point_pack 792
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+eccp_affine_point_pack 793
+BE41295F005B8146AC59A84141E89B2006BE3798ABA5E3DC
+D8DEF3F6C72B9CEA92AB6F9DE67CAB6839E321A6745E8C07
+0
+eccp_affine_point_pack 794
+3949B3E43048A70017ADA0E478F701820876BB1948FA39AC
+4A42FF6AFD260B9D0F95917A4F9B5369CA7EA42D1B961E33
+0
+eccp_affine_point_pack 795
+6494C230B3711C6A0B8BF6E070BDDCFCFDE6B90A9E1AEBCC
+072B2A0A691C8632965E3FC9DE55B4DD7EB593816AFFD878
+0
+eccp_affine_point_pack 796
+E1E9298217A9EFE64DC21CF168CE8BE63F06C2304F9EFD7F
+73A3FFA70B9354CF7950C76AB3F528F02B04CC5A1AE4CC24
+0
+eccp_comb_precompute 797
+4
+1
+eccp_comb_pack_table 798
+eccp_comb_point_multiply 799
+000000000000000000000000000000000000000000000001
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+07192B95FFC8DA78631011ED6B24CDD573F977A11E794811
+0
+eccp_comb_point_multiply 800
+000000000000000000000000000000000000000000000002
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+DD6BDA0D993DA0FA46B27BBC141B868F59331AFA5C7E93AB
+0
+eccp_comb_point_multiply 801
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+F8E6D46A003725879CEFEE1294DB32298C06885EE186B7EE
+0
+eccp_comb_point_multiply 802
+347639E0699E317F86AC7BC5729FCE14BB7CD907892120DE
+8B0E596DBFC0BD34E2A8A44E631D5D06F31892BD14EA637E
+6FCA271999722D2E003A3552CD5E6AB7F6846C5D7B4F010B
+0
+eccp_comb_point_multiply 803
+C52EF7610536BC6C1E3EF5DA17D625F897D42FDFFF106141
+F94AB41726466EECD9BF4C6129B516C4B89B03B8CD8FA0A0
+7FD7C44B6200F202D0E8370EFF11668A3FA04D936232B3A2
+0
+eccp_comb_point_multiply 804
+34B7AD5332D0BDB3576EB8E4672774F3E33E474AF096DBB8
+7251523FF27CC7252D38BE9AB8DA6FFF1AB0E3C1398337E9
+244C5E1D6C340E1FA33133693A1C5AF1E9C9558AD973A52B
+0
+eccp_comb_precompute 805
+5
+3
+eccp_comb_pack_table 806
+eccp_comb_point_multiply 807
+000000000000000000000000000000000000000000000001
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+07192B95FFC8DA78631011ED6B24CDD573F977A11E794811
+0
+eccp_comb_point_multiply 808
+000000000000000000000000000000000000000000000002
+DAFEBF5828783F2AD35534631588A3F629A70FB16982A888
+DD6BDA0D993DA0FA46B27BBC141B868F59331AFA5C7E93AB
+0
+eccp_comb_point_multiply 809
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+188DA80EB03090F67CBF20EB43A18800F4FF0AFD82FF1012
+F8E6D46A003725879CEFEE1294DB32298C06885EE186B7EE
+0
+eccp_comb_point_multiply 810
+3F1EC635F482468898CB994F5D69BD8964562841548F2856
+6EB29BDEBBF7C3D71E17E097005B1D41FEEFECDC66D59891
+B3650E9CE2367424313C51B41D47776E2CCD15BB2631A321
+0
+eccp_comb_point_multiply 811
+A9A8430F95BC11766A951CAD378876E6B956629F35D85603
+E374EE8ECEE14748C5BA8AC4AFC10F515A14FDA9630D8827
+B66BADA6B2C345F49D219AB2F9F8C5A38D52F87F465C14A9
+0
+eccp_comb_point_multiply 812
+2E0D4980D6B3EB4A0D3343B8F428817A0F5FA1A48C213117
+C2E1DDC943C7501ECE786A24DF4FCB6CE54BD3EC80578677
+98FB32DDCB2E42E8E0E8B9E3E60AD0BCFA27F5148F14A32C
+0
+eccp_batch_add 813
+5
+2976B2E9FA6D0CEFA8AFBCEE8D2FC06E7E046DA071F781E2
+E9D12629233DAF5E5DF3097C4033C91FE64053BEE05DA0A3
+0
+025D72D0178151BF2FFE3660EE8AE577D6824804B095C426
+E3D905332FD01DE37DF6C596B394D28EA8226D5434B26DE3
+0
+E7CE8FCD4CEF0FE19067570A4D38CECEC51024F8CF0CE10B
+778C7FD54D9ABD9D5A290CF796A78B1F9F8BD0F357939EAF
+0
+6C0476A57D74D336237E92D348E1C395150E2C96F0F30554
+40655A47F1B7055F9289DB2AEF1853B9435E0D34204B6D6B
+0
+6C0476A57D74D336237E92D348E1C395150E2C96F0F30554
+BF9AA5B80E48FAA06D7624D510E7AC45BCA1F2CBDFB49294
+0
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+11176DC860567D071B0409C28C68049C5F39CB1EFAF7F961
+62EF19A88747F22DA2B7C9AC9315DACE1F0F32D1271EFA6A
+0
+11176DC860567D071B0409C28C68049C5F39CB1EFAF7F961
+62EF19A88747F22DA2B7C9AC9315DACE1F0F32D1271EFA6A
+0
+0449F87E03DBA42E696CFA9EFC071E0C8E9E77A45A5DB4B4
+00C055C48229C2345D09583CF26FD843B462BE5E7BE08D9B
+0
+0449F87E03DBA42E696CFA9EFC071E0C8E9E77A45A5DB4B4
+00C055C48229C2345D09583CF26FD843B462BE5E7BE08D9B
+0
+735768118D2F9970DE2E98AA040B5FB224E62794E81813CD
+CF0FD50BDCE7AB73581B545BFB3771E5CBEAE01A9C4703C9
+0
+A7A41C255DFA76189BA427FE9C4237141FB492E8DE032A70
+61914B3D44F8232E4F1FE597B7CE3535552CC592419EF4ED
+0
+21DA709B1962BC03E03238EFA22C2AD751491A5E7EB974B6
+EC1FD106E10EAB62DD46E9C431804CF1B5A62C5C5E8A1BAA
+0
+3D38BA0F7DB347CF5A651CABC2C0213F7F2E4CDCB1D79AF9
+67447EE79FBBA0DBA6D7E1391536256C3CD90A279F07B1A5
+0
+eccp_batch_double 814
+5
+13A76B48C78EE2FA00A49EBD3812E057A9429DFE91048365
+B4E586C523C99B53C009A70E64ACA94B0C3A8980439038EF
+0
+DD56A33DD79BDB91A4C9D273A9EA1ADBB937B64C163D4F5C
+997A7DE26DBA7F895E8A181EDC871D36DEDFA19B34440B5F
+0
+B42C39177CD294F0BFECF67823AF8E224F2B4521416B91AF
+905330186152E585F67EA9406B7948FE2EC24D60892CCEA1
+0
+FD3261361C0D54CC0F8AB2ED6BF4A5D0D7BA51962EB61D7D
+85D3BED463E09FFB3C2F1E567A18B4C8C77AC67CF3E1183C
+0
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+640BFC3B8089D4BB24E1AB41390A1EA23F1AEFA74EE934CC
+D4C652623AF7A21CBB2E7F402105AE38F95DCC917B9B2B1F
+0
+B74A6F2079CD3E638AB592F8ED654B4D83B173596F88BC20
+BBE2152478F38E7F7D1919357D048DF9E604472F77C5BD63
+0
+47DDDF678F1D7BFADFB5A14D3F3FBB847980FA30CC72B496
+B471A51D064C0436DF97117BBBF6E423F4B642A95FB7FA00
+0
+06D1DE0A7CBA4AA5080FFBF3C6F5379ECF17C63BB22099AB
+0B66ACA18585511220190961629D991D625B242D80554EB1
+0
+eccp_batch_negate 815
+5
+BF1A47D8963C6EF8EE67340AFF8769DB525E7101A7DDB863
+83AB917A361DCB27C27117F1D48EC31BFC1283A4926FF22B
+0
+BF1A47D8963C6EF8EE67340AFF8769DB525E7101A7DDB863
+7C546E85C9E234D83D8EE80E2B713CE303ED7C5B6D900DD4
+0
+9924B25236681ACCFB0B0717A58BF30F632BFAD2268C0C3C
+B97DE7ABF98598A7E6DA2C2B74014684F222DDB2E097B33B
+0
+9924B25236681ACCFB0B0717A58BF30F632BFAD2268C0C3C
+46821854067A67581925D3D48BFEB97A0DDD224D1F684CC4
+0
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+BB16AC18F3E3B2973F853FED6A5E718F8FCE7B37CCBD784D
+F6C8ACB901BC5B50EC03E577E7BAF35AE1ADCF5C990BAFFC
+0
+BB16AC18F3E3B2973F853FED6A5E718F8FCE7B37CCBD784D
+09375346FE43A4AF13FC1A8818450CA41E5230A366F45003
+0
+3F65C56025CB4BF5825C2E9FE919A7117C346734BB7B6C02
+337663FF0DB94CBB1CEA5772C4C2F8C66CF5399D58065B32
+0
+3F65C56025CB4BF5825C2E9FE919A7117C346734BB7B6C02
+CC899C00F246B344E315A88D3B3D0738930AC662A7F9A4CD
+0
+eccp_batch_add 816
+8
+2F967C292D55B002A8B5FDEC8962FFC613DE49CBE343892D
+4ECABBC3E01B7DDBE76E0286A1CF3560AA5237CD4080CBA9
+0
+15FEB1644E42C0A4BF96072FDA4B8238803A427AD35E6201
+CD58DED63B07F90D1D10004073DAD7DE2A90B93822725506
+0
+21BB363395F5D045AFBEDFC308D20754853C0A71E1CFEA8A
+D943BA4B7312F3AD1D2CEBDB4BD43EA2159B0CA43EB5C224
+0
+C68616F89B27047D4A84BE0A73B62FC8142D9BCA4DEF7DAC
+B3CFCF2A7CB6A15C1CCC34965730F893AA087220CF570F23
+0
+C68616F89B27047D4A84BE0A73B62FC8142D9BCA4DEF7DAC
+4C3030D583495EA3E333CB69A8CF076B55F78DDF30A8F0DC
+0
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+1A01B54602C2FAF5E0028D25A530DC507B7F7CD8E8123C2A
+C982D72B8459B4A6BA6BEC6797BC405C99D8067AEF25218F
+0
+1A01B54602C2FAF5E0028D25A530DC507B7F7CD8E8123C2A
+C982D72B8459B4A6BA6BEC6797BC405C99D8067AEF25218F
+0
+EA9F229CC42F0501436DF340C2C9346FDD14C29DD021154B
+6ED870BC34A94E4449BF4A3A5322167008D47F3167F69B04
+0
+EA9F229CC42F0501436DF340C2C9346FDD14C29DD021154B
+6ED870BC34A94E4449BF4A3A5322167008D47F3167F69B04
+0
+A55BF01C438B4802EFF9238F9B0583C98BA450D9D3A293B7
+7FA1F3A2B75F661712843AD4ABBFA695457D2130E5120D4D
+0
+F8C32ADBAA8A79B897C12374364C0FA05BC06182A9DC96A8
+280769F02C079C036DF1BF830D3A61487D2F21C4AEC16257
+0
+36243280DDD96D73311CFEF6EC47575BE86084AF47BE81BF
+F1D43F8D318BD621349E0354268D5B90071DEBE0A29CD08D
+0
+59BAF7FAFD4D33B0D4A0FB7A85DEA616DFBBEFEECB13D3ED
+2556C80D3E466F5F9543F393C8590BF0A5D7993E5304B63E
+0
+C67C8C8CE8773920E62BFF35081941ABCF881BAFC5138BE2
+517F4D6FA091D7EFBCCAAEEB03D13B779186B9A2FA4D248A
+0
+D23057DF50B33F99B48A9EA9340CF4E680EB2146B7EBD32A
+1AC3957E21FE4A58E097FC96AD59EB7ACD395B2098DC205B
+0
+FA2681E271AE4C53F2146875D54F2F0C324D426746E9779E
+8C5DE49111FE0D2411D3AF2A1392F21F2B6376294CE7DF6B
+0
+C88E743BE48860CCE8F322C98CA643BB44E7DAE3D457A448
+2382E1F356A004023EFF9D3F26B477B849371994E39B17F8
+0
+DD2D38368B28392C5054D5177CE907FD99A100A9B3A8B0FF
+9622DDFFFF3251BFB2E2C0601BC2977C1259EE6EC096BC4E
+0
+1D83F863C096A9EBFA9376758FFBAF701A51CB1290D20E64
+14F43DF0D98747283DEF8076DB89C316A8D981AB59C56B84
+0
+E6EE6FEC7D702B89F0F5F2FD44A6A04DDBE7ACB92FB10E63
+E23FD606C6D3A4E1C20E8494985E48E8C361A579C9D41265
+0
+B0E792B02450ADCD2A60758DDFBAA35B6E568AA110E00012
+D0455C65212D4C9222DBF1F022A09DE59E81324056DDE3E1
+0
+889593A9083645D234D8E772B39D84DB6A8258C5091F2C2A
+E5C7D5105E51AE81B295127AF518E175E5C702E80D66B76A
+0
+eccp_batch_double 817
+8
+342A8626A2AA36C3A6452CE317B3B0805F9E68DAB8360C79
+CB1B27F3422AC0B0A583DB5C9FDE403C3499A55C59E44404
+0
+647CCE1640332EDDF8B27A276065100FF439E0579F36A562
+F78AB1C5E80AAE54B7275B41260661B4F396364DC27F0F32
+0
+DF02A4B95FDB77EC092E6685166A804BDFF29AA6BABC32B9
+160402F65DACE57C508CCEC39F64406170FC3A4A34CDB57F
+0
+AD1351F08F0012F8B9202B7EE18AB5D37996A674B341F4F4
+E196266D5251B587BC265DD36922CFCC7D9193C9EA4F57D8
+0
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+14E19B07F81585CE8C4BC79949D47A645A012F13D5EBC95E
+39AEE71D8BCF6465FB4609265E2E2084200B65ECFBDAEB81
+0
+E29D17A3AA199222FDF8B2691CDC63E52B64CBFCEC829DDD
+093FAE9147168D1C27C54BDFF5D6F3AF169BCE062F1D35AB
+0
+707F4AB25361BF7AB4000BEB944C6DC418C969CAF3132334
+9F39C17437D85E25AAD590E29FC620C06A1E27F5268FCB3D
+0
+18E2CB2CE28AD2C28E7CBC9BF2F41BD0B26EEFB1ECEB2D02
+08F5FA10ED471F692AC47334EAEFE4BE8312451AC7DB2C2E
+0
+286B452F8A330214B87AFA377196B98368B8FB0E14FDAE54
+04A181CDC742E69BDCBD42DB726D0D4A824D5FCF93DD76CD
+0
+CC85FED6E226BC30AE5A94650DB69219FDA886A3AAF5CDE4
+EAAF0274B4A936758FA629F4921BDFD46990329A8633376D
+0
+1C7271C38FAF0BCE6817260D65057BA63E91CB885E7C976F
+808185E7BD4FF91DC12714BC4F6CECCEA73AF69240FFF940
+0
+5EA14F05142C50DA041266B25CE4E0EC91FD3589A49513E8
+433C2C7E7D946EFC9071DB4C725C65F27870F460FA36D913
+0
+BF0BCA09A755C211071ECC45637261BC991FFD1A9B102815
+F9295FB4FB269B2BC7D7DD76E44F84248C91AB9BB1E3F085
+0
+115A0C944EB36FEAC747EC3CA6CA4D66C6A7B48D5F2307DA
+C8419E420C5AFFFC3E498E52BBEAA963363B69B55D4BEF61
+0
+eccp_batch_negate 818
+8
+9059A85D09BFA98E9ECB64752EFEEAEFA4B21C9BE2F744DC
+533D112A0DDD888A3899D05DB65BB6A1D4DAF1463BA57C2E
+0
+9059A85D09BFA98E9ECB64752EFEEAEFA4B21C9BE2F744DC
+ACC2EED5F2227775C7662FA249A4495D2B250EB9C45A83D1
+0
+A80CC0B68BE12960DA4E09B08C45135BE71138653EF2165A
+75788027F0158C8F4F988751C07FD957996047690721BDA3
+0
+A80CC0B68BE12960DA4E09B08C45135BE71138653EF2165A
+8A877FD80FEA7370B06778AE3F8026A7669FB896F8DE425C
+0
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+B493BB6F263AEF0C9D2FCC20E6521982DC1A543A23F2F3CF
+A73B7F5AC11C37A2033D2F3219311C8D28E4F95EA3F1DA41
+0
+B493BB6F263AEF0C9D2FCC20E6521982DC1A543A23F2F3CF
+58C480A53EE3C85DFCC2D0CDE6CEE371D71B06A15C0E25BE
+0
+99727A63E91CFAA72EB80336A8CAE11475896BB71834CA2F
+434F1443CCD901AA4FAFBCA8BD957211D94158D67B615E2A
+0
+99727A63E91CFAA72EB80336A8CAE11475896BB71834CA2F
+BCB0EBBC3326FE55B0504357426A8DED26BEA729849EA1D5
+0
+FEDF13F41F2B7161DAC59E22307063309A84246712290FB2
+8D8AEC0D0282BC6CE83A2B868ECCE2BDA179CD13F5DC7990
+0
+FEDF13F41F2B7161DAC59E22307063309A84246712290FB2
+727513F2FD7D439317C5D47971331D415E8632EC0A23866F
+0
+39B633DC9665A536F57EEF4F4C2FD15EE6BB50C5EF120B84
+7A49D2B30B6C9DA438DB865C7CBED5F9F7915DB5124748F2
+0
+39B633DC9665A536F57EEF4F4C2FD15EE6BB50C5EF120B84
+85B62D4CF493625BC72479A383412A05086EA24AEDB8B70D
+0
+967F7B419D2D5C6F6BE15B2364FB8E93D87E0125C75330A9
+1E14C002070263EC56B5472DF08C1D2E1429F1BF47E546D2
+0
+967F7B419D2D5C6F6BE15B2364FB8E93D87E0125C75330A9
+E1EB3FFDF8FD9C13A94AB8D20F73E2D0EBD60E40B81AB92D
+0
+eccp_fixed_point_multiply 819
+2
+1
+200E3124F848C168B4AFC84E6B6B49F43C1F440C606CACCD
+6B83EBFB2F8F1BDCA153058170E85019E75FDFC1EBAB188B
+0
+F45ED8C55D5CB4226399227AE1D6F9F507A81949E60D9348
+6EF371D11D402209A083E4C13D562E7691CDA555A467B430
+61338448658076BB9273E5DBF6FBA0B600BFD20AFDC01B55
+0
+eccp_fixed_point_multiply 820
+4
+1
+A0CD4551EA0A4C0C1FF367C3C7C88A286CC0B88C905CC5D6
+E74FF4038DEB85F9FECE8449E288D62BC87C96D3BEFE09DD
+0
+18B3CF3527A280CCD291A42182FD56459584375618334EDD
+036DA250168FB50D6742DDDC2BDA9FA0E393268C87FA2171
+AAD089182D9AF73BAC24ED128B4631D8DCA939C590629F67
+0
+eccp_fixed_point_multiply 821
+4
+2
+4B217F6A3C03E7C63120811B4D7DA9B4DF051902D88C9423
+67B6B993109B1E07AB3EB8994639E5851FBE8C87A0688485
+0
+5E8416160FACFB49CD1D47F2161E84D3861ABD5DC0AE6996
+23B6F0806EA0A46239FA08A3898FFAFFFC2741840E1C74DD
+02D171FB54A5E1399DA93624903B573DCE28E5B5C2AFA16D
+0
+eccp_fixed_point_multiply 822
+5
+1
+8A0CC30E69EB6787B217643D5627F4FF09CC4327EBB16B7D
+6BB21AE640B5F84666A2235C3682B7BD1E48D48C04A7E2F3
+0
+DFA01AED96BB17562AB01B1FEF0A3DC163015710CCEB48B4
+44F5DAB69919BD1BE6860D182024C244AAE7BBF0108A07E7
+4502638455DD6AFF24746C5C35E24B52B81606C0D4626C93
+0
+eccp_fixed_point_multiply 823
+3
+4
+E9D6CBB50D84CCE3B8B194C5BE59D82AD2FA7A1C41BF9A75
+96817BBC1A44B9567F01B774AA0C549A62EF7210B4EBDE38
+0
+2191CA539B751BF62DE04539890800A173FF6EED34BCA2B4
+8CC21A7253E14CA10DFF99399320F45672931E4A6C18E16D
+411E2B7764B9390D5832ABA341FB91C1BAE81E92B2C0ECD4
+0
+eccp_fixed_point_multiply 824
+6
+2
+A982E71B6ADF9776777D95DC1CDA508FDBA84FAC35DBDE14
+67B7E57D8007F9C19446A78F3C1FFA71A7E94CFB055E03FB
+0
+ABD8121694BF41EB1CA7F416D0B02C30AF1E61863F9A1FAA
+8CBD86E6FB120064EF9BC293B65DE56B0EB617F9CF04B170
+9D1B23E956B1082E3C5641F18801C005E8BE1C6B77723236
+0
+eccp_affine_points_validate_batch 825
+1
+B80F03A2B0AA14528FF4D1EA87DB5820ED8709F8D3884C06
+51B0F1C7AEADCF05C7401CCFBC064864FC4AB1AE79CD5DF6
+0
+1
+1
+eccp_affine_points_validate_batch 826
+7
+4A8DC7FD41AC558E9D39E856CFA7001AECCDCEFFFB46ED22
+C96B1589820E61CF881676E7B5B73692C2D39648867679BA
+0
+1
+80D40F9114717A7469D5DD97E3F4345D6A6D038ABC5C1F20
+F4A7EFD17B8E456BADFD7923B846F8B08AC75F0B37BF81C9
+0
+0
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+0
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFF
+F4F0DF4DA861FE7287DD5DE9880D511802DFE7D64B5DA610
+0
+0
+15E32851C70EB1BE5E2D980DAE0CBCA8AC8337117686EA79
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFF
+0
+0
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+0
+0
+38C4D6DAC456C98AFF21FB360F9A439384C37138848004B3
+3BF856599385075D84FC2FF8120BDC0B87AD04404F55356C
+0
+1
+2
+eccp_affine_points_validate_batch 827
+20
+8453C3ED7C64345E6C52B512E4E1AB80236C8CA65AED1541
+7A75948AE95CAA8BC528A572A265F268DE17683C2F98865C
+0
+1
+F290A14C91E6EAEFB67D5C08CBDBD127B1648E391F481781
+396C5DD0B9930BB8359601F09188054F3AAB29EF8037A5FC
+0
+1
+DD75CAD901DA91E8D10047333307E6E89C5016FB02DD1B22
+35115DE3001406B3AC34095C860D7CE266BBA264EA1AB253
+0
+1
+AA056FB61F4AA0AA85C11430C515F5C5326AB17C733D2D60
+8FCB42FE7FA40529A2CE883D24FE3B53A1CF511A9C81DA05
+0
+1
+4921774BB1F5193BFA890C49B606E6174AEAB1E0F8DE9877
+1BA541E9CAC605845A4698F6FFC95E02090B28CFB55C297E
+0
+1
+4ABBBAD975449D0FADE2D9DC88188CA920041F5BDEB4FE52
+D8F177D6258D4C8EF461E4C26E9E87927DB9CED07BBAA7ED
+0
+1
+8B3B7FA0FF43E3C08E2FCF274F96E6ADCCC245064D0CF0C9
+E01F1DAC79B412B720336E5904142C803C01B63E70807B35
+0
+1
+0F89B0291FB5733046B2BDF4EF7DB7FC30213ABBC202C837
+0F8C5CA12BE49579773F49DB6D46AF940F87C85913B09C30
+0
+1
+F1DF41B110E57FC897F09D2CC7E71A143D02AE73CF2BDF4B
+85E6EFD6865A7B8152774483766D9E96B9B2684C32FFF694
+0
+1
+4145B8E1ED56AFD1620A80484840AA180BC83AB9039E8D9C
+A94B6F06468E29614A672ED58ECA7CBC2EEEE30A6E203F6F
+0
+1
+82B8B5508A6D5E2124F225A2DCF694C4729BE4FB51EDF29F
+D39C2C65B651F904788EB763D61C43AE34E34D35835A7A0A
+0
+1
+AA8AEE997110A5F714F171B5FDB030EF4CFD1A6DC292988F
+8895BDE00F1291B7A6D3E5E60CC35A99A7E5F5E29DD697BA
+0
+1
+D1936A082BB0A941D6D0F7E533DED5566AA06BF7E8009BFE
+E08321CEAEB58691B3A0F2C1931AC0E0C1F5501FA37F2AE3
+0
+1
+D3D227A92F8E581FD611CA6EC90A8293F8A4326A36AD3812
+30A73EF122443093861670DC9D9ABC50112BF4F1FFA56C6C
+0
+1
+9AF18DC58425DB75B0DA0038A69295F5E41BCCF5FFD6B695
+14DE3C99D0F6415C2CD60642CC6A6F3C0967C9108F58DFC3
+0
+1
+4BB0CD43A521E55CA11833D3148BFD552D4F2FC9C635C7CC
+EBE7F8D52FE4DB5577C18DBD4E56D6F303518E70FBC430B3
+0
+0
+7CFB8FC08C6E66B6C5A5E46C85FFE9AA985E201BDEBC65BF
+65A87004D16CE29D6315970B64125FE6BA702B16C00A5A22
+0
+1
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFF
+0B662BBB9F358682DF8E4497767FBAC719914364226BD062
+0
+0
+195434DAF72C8BBCD1F55B73C73515E6ADD02E68238ADD72
+542265C2DC6D15046AC66526A2CF0626A4780E790786076A
+0
+1
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+0
+17
+eccp_affine_points_validate_batch 828
+40
+2AE7BE3B29D161B2D89F5934176F11460E3B0F9EDC49DFE4
+2D97184E7BB76DBC24A5AB96F4B5AC1CF487E9E786B3FF13
+0
+1
+CDA01EE584E8CF7C46D70A0D678BC69EF1AD160DCCA25630
+6C13D7104023CE8431CE06781D3DA6160B47DFC9782D4DB4
+0
+1
+F7F9BBC782D0C0981CCB7A2935E08D81499CE46444AADFF5
+8B49F7F5B8BE001917119EC50DA8695E5F8E01442C9B268B
+0
+1
+D645B1B7FCC0354B43B9123D4E1AF7AFA34613ECFF517E3B
+347BBC0E5D8847021087BA0ADE29E04512B25665F8B2D2E8
+0
+1
+1E56A446FCA964B72566B9838B400AEF63B0E26C66D12CD7
+52606E689B04BB961C1C3DEE11748F430F168EFCC6CEF21E
+0
+1
+663FCCE68F46DE4C1C893D408849CF9B4651261E2A22A013
+FEAE61B7564874AAE8B4546F6F522ABCF1A321AA5A5C3AB4
+0
+1
+EB87314134EDAB391B7F142AA5C52D3C9FE7CAC1A61EB957
+20C1C1C02E2692A78E9EF9F529D31DD99C1880F8969D0E9A
+0
+1
+569A0D6DD068263DE61D1B91CA4804AC8EFAB8C4833F6B2C
+CA65BE94466187BD8D2805963F2DCEA4050465450E0CE258
+0
+1
+5A8A0206C31EC21828BFCE4081E3F41D6263913C1AE2261C
+673F0CCDACE7005D50B7FDFED82C711A5E8184B1786A0C89
+0
+1
+4A92DCCB229CDF2FDD0708F18EDA72A0873411D8B013B7B6
+C61F443F9D91BA597F72561D1DB4CD772E31F9BAF35C1209
+0
+1
+80A7ED839D15665E207B0E336B3284E17D69B56B576F6CBF
+7201D93D05D1E94AD28851D1DBE7798C429638D72E34B78E
+0
+1
+0B54A31B5C8CBB90527881BF41913062C415D280549A28B0
+8597F6C1DA37FDB952C8E50D00BF1ABD85B6B96C4B932E46
+0
+1
+5C46A9C76AF86B040E895B0C322E488D5D12D7470FBFC8ED
+382229570E8C6E81D0015EFDE4F8362C5F51C3ECD2970E55
+0
+1
+6F50024617954F5D5E25853D20E1151B3B880949669BBE0A
+C9D4538198A84E2FEBA07075ABFC9C01D54EC64E178F1D36
+0
+1
+91A260B0CCBF2C36B0BE34F7C4DE662A5D95701A7B2C12DB
+95C5797F117043528CE081BDBA141B024FB3E5119DCBD51A
+0
+1
+47E5D844385C20D353D15392E9B1B9F315A9AD8A87BADDE7
+6470609AB885C3E64F6CEB2369D000697D57FA8D7522B4E8
+0
+1
+205C640D88049AFB18746C813C25F0646B11E02985A3EA89
+5E7A22BF8F5FF2FB95F12342EB21CAE218E7F98918710F50
+0
+1
+6D6B78A52240AA134D0F3E2D86528DB92C6ADC0F3101BD7C
+D31BEDB82F0EBA73BB7BDCB80F717D5E1A88884EA899AAD4
+0
+1
+307BAF60213F8C6F6E2444F94F43407BBD81B50773307107
+F5A6BCF2D8B33F76CFDC609343CA962BA8B322574701137E
+0
+1
+8F3573D91A4F0D0CEE1B5A1B13EFC7A02F7526FAF1F90EA3
+0533A07676F8D610AF522C36E30FDE6D691F77A4692DAEA2
+0
+1
+A4F8A3E8242B82568838D41C3587ED49CBC07B189991A8AD
+1913EF5E224651C41F018E9AA58BD6A42DCBBA1467CE2AF2
+0
+1
+559BC966B5C0DDBBD72FA6B98F2A698AF5664ABDA77AC3D3
+AB1C7A57E8B02797DEB0980A5B27D1D306715B209B8C9AB8
+0
+1
+5326CB3D5779DDDDB657D704B408D5B9AE8C68307A9046D1
+666503677B59DE54F7052D45049CB3F3EB1CEC82098A6E4D
+0
+1
+46CB7DE246930D287B90B82C7313C84B8050DDD95172391B
+5757E93690B5940B1B34C6A41AD9367CDD3DE5C5E6CC780E
+0
+1
+9D9ECC401B2CCAA355F09950DD524B0018FD55062B17046F
+1FA54EDD907BDC4B0D0FB2BF37230F65B5DA5E18E097AE47
+0
+1
+9DE3C67F600A05DCAB24F198780AAC965AB8549CE08F6DDE
+462B23AD216899BC9318E0FED4A618C123FF20686EF9C1D6
+0
+1
+5FB6E382232A09402B9E0E63576833E23F43FC565C1496EB
+CB87AC565891FDC8AC9C9877CA9DC57A7FB54678FD4F7936
+0
+1
+DF4A009315A0559F35D7E1682D2D09B033C870A11DA98570
+F5715A6A9A74D07134EDC6C7F296B9ECB7F39F7653532BE9
+0
+1
+DBF2D7C74F68CE1BB09496A009932991492A88DD42B38A71
+904CE01CE534728F218951E83BC4FC140FA2081528DD30E9
+0
+1
+2E5F09C9C3BAEA4C20D80D985CA0B4C9FE54E1B3C1143131
+B0396D03021565BE84298C82E218B0CB96C35DE17F09AA27
+0
+1
+1E3140A68BD0140C87DD917DE25964C43618D4214E5182C1
+0282ADA23045977D3B2861972ED589DA9B0D3A522CDDBF5D
+0
+1
+718510D9B41BDEA9343BE9C9EB58EAEB1D250D51571F892A
+EE4C3ED3432EED2544E55706341D5F73411370523CD6D190
+0
+1
+B944CF7B7209D08D755F4448C426B3213AB778FB8521C42F
+8EA58F963D46704DA277EFE7D6F73AB97EEF44E84BA007ED
+0
+1
+C6F0FBE7DEDC821ECEE512108500E0AF802D2D6E8C9FB265
+BDFBD791B1F86FDF359CE8CA11AAFB169B28074F63C25DFA
+0
+1
+C829C0CCC6538B8E968F29A401E431DF245E7C06E6ABFB7B
+9B03930B87254840D78FDEDDDCB674EFC66BBE5701C22512
+0
+1
+A6F7351A168F63933DC5AA66DDC9425ADBAC5EC0955F3200
+43C2CD61AB6914E69B3146CE0647EAA7B3049BFD2636E818
+0
+1
+172F14C2E26832D91FDA5DB1926D28F7EFF0B6C7B2656026
+FDC4B7D4D12F5CFABD28C8044EBA124D4E90CB1C649B676A
+0
+1
+76B7100A31A50316A3744C69D4ADB0F679B05F1D1461E17B
+D33E1784AD1D08DD7D6E71B7EE3DBC683CFE5F011C3B7A51
+0
+1
+633B43FF4115A923D6F9AFC920B09AE4835AEB5E7F2F1F5E
+2130205B0730BCCC1BBA09F4B16094C008F1B21C16F3CA35
+0
+1
+AE97478DE50A50ECDED32335FE4B1354EB4EEB99CBABBEE1
+C658BAEFC3954DCC3AA0B83D0A6DCDE0DDE4AB58F891DFA6
+0
+1
+40
 exit
@@ -3455,4 +3455,1585 @@ CA9B6BF18DB1A8CB805D994E58CC7B66DD677E79DAE96356
 EBCFF7DC9EFF798B610F16D298F6377D8088ECC7D490EFB3
 6E3B37A86D1D170204EDE3B66B296FBFA1403D9422B40ADA
 0
+ecdh_phase_two_x_only 458
+DBDB17B4F973ADBA988055B3D4937E76C2E38C389FDA5637
+461C4E3FB3EB190B01A69AA29B85C5D553D4FB82199DF96F
+0
+885D6F33E40C2FC4E158FB57A6E04B647A9D969146FC8894
+AF2B47FF5E61F526DDE0D4421FC76458471470B7DCBC2D3A
+1
+ecdh_phase_two_x_only 459
+5B7835B960C2E8C86D027FB9D031BC3689291F221A872463
+A885771607B4962515D7D8F8275CAC2F3731111FB41E864F
+0
+000000000000000000000000000000000000000000000001
+5B7835B960C2E8C86D027FB9D031BC3689291F221A872463
+1
+ecdh_phase_two_x_only 460
+E15B6178A815041B07CAACD6C8BD3AE05AE4A731E0F1952A
+97A997CA40DC26573126A36853EF42129418665DC7A7137E
+0
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+E15B6178A815041B07CAACD6C8BD3AE05AE4A731E0F1952A
+1
+ecdh_phase_two_x_only 461
+3C8CF5F6D0E86EAF080956DB52BC4539FAB7667EC2B7AA75
+AD8A48A90EC52D31DC4040EAFD5E4362A5B462A204B9A2BD
+0
+000000000000000000000000000000000000000000000002
+0E04457834C88A5165F791D330BCF88CE870CC9B312FDCB3
+1
+ecdh_phase_two_x_only 462
+06B20FD30317F7335BB0FE91352827EC9E7E9CA2296F579A
+8B3F5ECF549CD9B7327E48F2F56B060DAFAF88E71129F79D
+0
+E33D4470FAE2BFDD51BE78090E574C27DD546C921E04932C
+A33536DA1DAD95B82D9191AC3B03B94628856A8D85ABA4DF
+1
+ecdh_phase_two_x_only 463
+2695DCB5CADCDB6F161C9455803C4C73A19C4795077EC3CB
+66B5B409D1728C3A9BE58A39B27FDD8B6080503A186552AE
+0
+C50263CE52590A3CA74C860B1F88E9975DA83437BFF425B2
+757581A01D684901C1241ECEEF52AEEA1EA76ABA44C8B801
+1
+ecdh_phase_two_x_only 464
+CFB9D3D5638949ACFAE70516B32EDF262B695F708E8DE0EE
+DA19F769CAC4D633FE2A792346E30FAA6F081275230FC878
+0
+639847CB64EAE8928E1791494DE9658AA893A8B88651AAAA
+0228BC245366180703268801734077F6065DD04E1B33A41C
+1
+ecdh_phase_two_x_only 465
+77FFF583D74815A68EFE0CDF2AB753C00DFF6E47367D17F8
+D4B0C6486A6D3EA774DEC5C6DD63F77A721FA7678BF3D070
+0
+DA20BDE68F455969AED4D9ECBF539E01A09DE6DBDF6CE676
+204947156113F6090C486B8EB2B075B91C79A58C9A722388
+1
+ecdh_phase_two_x_only 466
+FBCC6176DA48D36B637F29113F842C5069CD6624EDF2BCFE
+E4025E52F0BB458C13747280FAABF479492C961037D2A2A9
+0
+592189B24680E53568F524D90EBEAEDF00C727EF51099AB5
+2BADF4094CF5181727E014DA355E2961D4A2DD79D314E1AF
+1
+ecdh_phase_two_x_only 467
+4CEFF9D0304A3E6005388ABA0A63FC05789BD35E14C3FFE3
+3F3544C7B5F1DD76723031E52AF8846773A032AB7C998706
+0
+96F1F4AE5BA9E5BFCA2A011B793600A699004C4A753258CE
+3843E29A16AFAE6EBCA5E605AE152DACB84070DD110BB455
+1
+ecdh_phase_two_x_only 468
+3E690163DF6B19C5AAE8D0B51C69F5785C8E1390C7CF3DC0
+000000000000000000000000000000000000000000000001
+0
+C204612E6111376F613890C87B2E0769027B723E11FA6055
+000000000000000000000000000000000000000000000000
+0
+ecdh_phase_two_x_only 469
+ECD718811DB496DDD671F19CF410A5F41A8E041FA82CAB60
+EBD876D0CF00A0BEEBE1F38AEDD1430A12B0DED538BAE548
+0
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22831
+000000000000000000000000000000000000000000000000
+0
+ecdsa_is_valid 470
+0000000000000000000000005FAA72270FD2DCEC9115DFE4
+462C37F3CCCA9F1FEDE003F4DCE05DE7C14104148697CA56
+95D6007FEB60FE56B7A3E3B4CE2F7ECC5DDAED5BA7244DD0
+DA6311CEE6B27BA22A316586DF392CD54CDFB20D692DFE92
+3A5A479F8156294F0E5FEBFA13AEE469E2262AA3E4CCF031
+0
+1
+ecdsa_is_valid 471
+0000000000000000000000005FAA72270FD2DCEC9115DFE5
+F48A5C3D0234F9B45D4226E618C22CFCC0181BF8EE46748D
+5FE254367ECA7E32B8C0252718BF1A3C02E2FB47839B6D09
+7B719A98617DE084C186FAF4CCD620FB5E1F952CE80BDECF
+0156CEAC0E8EFCD18060C118BDD7E40A66E262D9439D2E8C
+0
+0
+ecdsa_sign_with_pool 472
+141EC2C0E0045DCE48D39BE1CA37417AE8CD8AD5EB174F64
+CD268110F5913F13055665F0FBB3E84E0EF152125425B7B3
+7DA7C0534B41E64DC35CBECA10D5B9CD0C1ECC1F92555FAB
+0B6AB59659F37ED98E2E5B6D807764B58F175B10B912EF0B
+0
+1
+ecdsa_sign_with_pool 473
+44A15D898F61F0375D50C5F76EB1135CA700BC19BAFE6860
+44F85BD63F6582262D2C309BA0825ACB80A50DD9001A6567
+02B2CDAD0C4CA4487FF541F123E1ED0AF13845E31B582685
+59430285186798CDE81CA07E84576FF8DB8404761B41ADE5
+0
+1
+ecdsa_sign_with_pool 474
+654875DFCE5CA601C19DC4315875D21463D45566FB46A844
+7D71435FD3CCA1416868D91D937F5A1913E75C178AF34E82
+807869CBEDDD22FA4A2CF447AE5809F9A5D2C100B30BB0FA
+158988CAA0642E6EF83D61A47A2375F718BC2C9DFB60C341
+0
+1
+ecdsa_sign_with_pool 475
+4B584E858631AF84341B6BA3C3C082EAB39C15F37F54CDF7
+839E9E041F9AE58A2AEBB812645EC1173E49986BE3A6CFCF
+3C429BC1588274B2E0963D72F618895F379C70FDBEC88DDA
+B041714EF7EE0E865B8349AF054E50FA6D4AEF3E4B400545
+0
+0
+ecdsa_sign_batch 476
+1
+AA59CE1E9E293641EF70B4C0177344A39B95F239AE97D9DC
+8C1097A48CF5AA901253FB1B262A1C3F8477FB3AE13F31D1
+E5D13CE5AB57816E7C77463D77EF40DECCC11925E09A4CB8
+0
+0912B8E383D833A9A269D132D5A5167BBF2EB110D7881003
+1
+ecdsa_sign_batch 477
+5
+CA032FA5872C3A65700FDB1C5E85D8B3FBD5A293A18BB430
+01411B362B0BC0225AE59AD92D4147788D4BD8C3D6D4988A
+BAD84B1B3C19EA91F9857CD0875F5B5F89F4F9B1A2876D0A
+0
+CBA859A099C566C674F47996AED5CE80FB85A89C1B9C7EC8
+6C58BCA5BC731DD6F91AE57C60EA264FECDE8B73482C3495
+E724FE81F8A43B14CCD8904EF5A965F924F7408A71A1F3D7
+8B2DE38C133D33EA69C16089174D94060CACC82CD69EEE90
+6EAE951BB477CAF2A5F274AB5C718332EE00FEFA49E0C551
+1
+ecdsa_sign_batch 478
+16
+B486D616A3A206855DBCB37590082630967978C9D3AED4C6
+F612EEAF2A1AA883B57E358BC33366A819F39D4318E51D24
+41D96274FC5AB56D0CDF6A571B6C0D24FC1B228269D6D6BA
+0
+9E90F4E986D3692ECE9DA0DD08B7EECCF86E136292B55AEF
+01F0A9D2023FABD2102234396ABE13A48154940B36972583
+B508436711907BF05C63CA78E90462788297B9B0A7E14B71
+870A54C65A14597952EB4F560602DAD639906B93947F4100
+03750F88BA5FF686058E2F66DC4F1958D225F90C28C6F444
+4FC2AFEDB809CC36BC606C8937CC7EFDF13242D1E5835421
+4D3D33CEEA8BAD8BA640C41182BC1EC23A2CE0C9B3123CBF
+341EFEF6B793653845C98A3F48661CCF0AC5106D9FFB2A93
+A27A919F9E28777A4432021B36894CB624A5262C7B325618
+A613515F8E883CEE1ADF567972F6072170523A390C5C7E35
+717E568816940F343D38497EA608AF494449E54E00A6579D
+190E4C80078A385F59C54579575448A12154612AA655A544
+A0CBF1F22802962193E5F936106D966D263A1DBAFFD4160A
+49DD853087CA2860D14EA9AB3EBF7466A861DA6D8178CBBE
+E0CC81318B2B24FE2E080B5693979DEB06A987137959DBB2
+2A76D988B1CDCA1F1CA913E23622150822E10C4E4B52971C
+1
+ecdsa_sign_batch 479
+37
+AF6D8F6EEA791F928A654BF985415DE9946841ED6DD1C5A3
+7C1723940E53D277FE948AED4D6FFBAF66C06C5EED7E0259
+DA5B3A1946E5BF192E6DAF720087D8B92231FBF0CC09B5F0
+0
+D62444DB903B0C18116BABAA46FFFF5C5B7B00CB022C09D8
+7245863166BDE56C2BF193BAC104830F3966AE6B0DD290CB
+4F7F755AF7807DA11751EE1031C6605711455AF250FDAB58
+707D9E55B45DC6C73C015873D24A767137A06C280BEB2994
+C1549BA958D121967F3ECE2EB384CBDE907A94D6E5C1A6D8
+D894440C0A77D0C2993137C3EBEF4ADA479D723A8CCB322F
+B837FE293263E004CEB93516AC65DCA28B2852B0D9964BF1
+F38A88EA012B06CCA3C3BF3A4CB0C314D82CE567F77C507F
+42A48F2F071D5F76DF97036783E1BD34946058FA447A22B0
+FDBB0187552ED6CD384242E071CE2F44F72033FE977CD9C5
+347D41FBF721025E5B662C9C9E4CEAB6D3C44BAEC17379A0
+1D0C9E7CEEDCCA765C84F436DC3295C1A2E5A98DDEA42B1C
+EA68A7711184BB97F7A661667C980E995F4CFBC8D995D60B
+2A9C7FB4F82BE4D68FD647F59E9D31709A736232727416E7
+4897DC181616F99AB77E91D8930339FCCB96C13EA7688EF8
+E034AA0524BC0CE27DBB31BD09791EE15183AC46A684E521
+74B1C28DF0FB4A6950693995BB96E2E4BBF3011D0B0F648B
+F0440505BD3366DB7D12D0D616641234935BF0A99821A489
+EDAD64D8AD2879185E8C6C70B59CAC2C25115CBC2CA64A8A
+F35D41753BB42647288107132A5A6250329D3F15F1DD2235
+D249645EF205B0AC2B69F6041397C47FD6324A1751B7DA1C
+381560297A5BB770463F51EC1B32DBFCCD9DDCBD9F63F689
+8C94813E5C0B4C221CEB4028F6B08B500484F0801947AB38
+E0322FBA54A045B02807582DBD801C3AF29988CB00A6DC6D
+AA9CBEAE13283BD78A5BFB78C84A1BD27A44C1E9A648AC6B
+64BE72A03A37323D4BA9B9D4F33F761511FBB4E58BE03DE7
+6AF566080ECAA4DB91778CE5AC89215D95E109B33FD81AD1
+2A3AFB37F24E2F8F4493BCF1CD5310EE7F260C70D1E0F03D
+D115924A75CA474707B5CE0494965A8A86C810A6D5511609
+1057A24EFA082A26341D73EDA2D1D5FFC9822183893B153B
+5EE234DE732FD745746780337E9AEC603FAB374C2702D815
+2795B457C899179C1CF3EB6B29F3874BCA5BCFA53EDFC47E
+B2527CC941DAFFB902165D7FB072BA85D3464DB395BF2BD1
+F10A599E26E115D4BEE1451128BBF7CC55FDF28B7AC5E311
+D0F284D4D8FAA845EC461C8AA61AA011E6C414BE22840531
+0744624E1424A54F09B5A493C7B3C99B78B736E39243F95E
+A20E70698657D07D0BBC9D3D23B884FBBF3C26E084AD0501
+1
+ecdsa_sign_batch 480
+3
+40E1CD7BEB2FCFE5B8EA2C9840F879E696A13B9A3FB7886D
+7ECD65299D24696316ADD59CEFD8CEC1D9FDD8F8C7B971E0
+9372744CD8E57FA3199BCC2239D4EE176687FD64B3B91FF1
+0
+CF9070467D7C6C963AB40D113E43B3D7CE7B942B8C684932
+7D3D0BA765C80AEABC225BC3CB81695E5B9DCB2548CE86A2
+662E92F8A6C6D8267DE0FB5C9830958CE631828BD7A0FD4B
+0
+ecdsa_recover_public_key 481
+1B917DDA5298CCF156542EC6CA007AE2D499D573A87AE739
+1A41232A580258250316A7B53F5A34EF632ACF5A3DEC5D51
+CC864476A553DACF015D02DB900BD913BA9468FF654615C9
+1
+AA0631FE2E34A6802F9F3ADF8F5CF0BFC15F88D1BE658428
+115F5A41425C6C05D19FBD87C885281198EA03E25AF38AD2
+0
+1
+ecdsa_recover_public_key 482
+E74081139FD0291AF8651A2B74EFCEFF29AF0D65E2D9891E
+CDC5B00586792E7C08B56D967DC650CBC1212AA31AEF1855
+590B969B6C8186681BA3500E0234B3D85DC1464412DEF708
+0
+4A26CF026582B31EC9C7F9AD71FB35183EBCF4FEAB821E32
+D187838FFF13E7A276E59AAD1088EE742BC55E2EF3180C9D
+0
+1
+ecdsa_recover_public_key 483
+A0E1307783B9740F72228917FDF8A71390B312030984194B
+09DC125384DC58AF42809D28D5ABEF320895C8D29B43A049
+90B9C3615215E4B793E621C241EABB796E4977F375CDE39E
+1
+9E185D6ED1D452AB56455EEDB303BA198274640A29106652
+1D15B640D9D026DE831E35AEF6398E917DBE10DDC33FE1CC
+0
+1
+ecdsa_recover_public_key 484
+5FA8DF4ED51EE016B37680E40F965A59141B3B2367ED2D89
+892AA61B18D8CE415C0BB0A4DDF354AE5AE033C4350284B7
+50337E8ACD062F4A6186341FA23145DAC0827D679E68EC53
+1
+B94248AA6AE1D6BB3080E948FBB019AB8565A4B9481D901F
+6752FD9FEEC7197E8349DBBFD2E354B2549E052ED9AC9351
+0
+1
+ecdsa_recover_public_key 485
+39C4273B716239659678A00ECC327805AC0EAD973CE3D67A
+684DF6789B2E4337AD8C0C4F2DE80A244DC66DCD30B9E920
+49DD9EE4C0E7D596ADC9F7A5EF0EFA6C4C37B2642C28413C
+1
+725ADBF67C70C2B3694F178E3DA228E952DD1180F9043EEF
+10FBAEA4110EC587F4360ECFF5012054909D0002091BE48B
+0
+1
+ecdsa_recover_public_key 486
+5606DBC5AD5B3EF25B76FAC816C150C01FCD6FC8F936EEFB
+65D5A0C1E7C1F77FA9F4544FE481F60F331B4AB360D5FF5C
+6AD4EE0416916A2A83510096F1A24063F83605F678F7E14C
+1
+4E9647B466314D5B232BDDA207358B76532EDEC870B09526
+92D81644545027F40F2A0F443DBCF8E9D4499F70FECD1F9A
+0
+1
+ecdsa_recover_public_key 487
+6FB291D23B306AB6B30C31AF67356420C865381B5085FFD5
+86175748B834C6AE8B6CB44C19E1D5F11A48EA5C56C0AD8D
+BE6CE9BED17F9855FA0201102069EF83B218C81560E8E589
+0
+E602974C375AC4174387A5FD9B938AA5EA23F2CBE81FAE96
+FD4E4627C7F902E7BF4EAE7212C1B4A4FE437695C815F0D6
+0
+1
+ecdsa_recover_public_key 488
+B1F7E97DF2382CE2843278E1940798BBC5A3DACE03F361CD
+1CF8FE645491690E5148DE4D23E232AC59ECF04E92AC4130
+FC224D94E222D633DA333FAB3A19803AD0E818EECD8187DE
+2
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+0
+ecdsa_sign_recoverable 489
+DF1B5C50BD7F2717DD0B3D5C47FA785682517912EE6AB91D
+E85AE204E66068A6E2E02F7C54B967FF7D25542EC72EF228
+7F3167F4826CC3F1CD6CBA58E8B30B6A6E8C71CB7495EF68
+76BE4B3C5074C3F32DF010E5C567CDFB52AE71362FE4BA5B
+0
+ecdsa_sign_recoverable 490
+2BF5EE4DEB39C7D92DFB27522478229A9565A107CC70F2DD
+DE61F560307D4961FBCDF35780474704D639DF7C37BAD327
+0C9EA6199990950C0E3987B3092878EE5CE60D8530078031
+1076D8F1526FA85E2CA6C6F114546319DA473621B9814C3A
+0
+ecdsa_sign_recoverable 491
+0C56515E38E1A91CDFF3F9BC102FC25D90BF6F213604DC2F
+1F09D75F0A2805CE2DC45D854920BCB652529A525C9CB681
+2A14D2835A4E89F8AEA329AC8CBBCDE210988846B78F0612
+6171553E50EAD60FE6178534B818D67CBDC6FB5B2EB6662E
+0
+ecdh_phase_two_batch 492
+1
+3ECB55E90827174A8623121DE0BBF37A94594D8B75673FCB
+03EE5A1888C12723D5063932A9B30ABDB44904342E8E4182
+81651FAAA6303E926337374E77B6F2E26258AD84197E69AE
+0
+20DD8F44F02220443B64302C174C87B7AA4ADDC815538EA5
+C3B07955F2D0B930BE198ECC17DC8A8C06CEC173DD9B72C1
+0
+1
+ecdh_phase_two_batch 493
+7
+BE44DB9BE137404546F1417059300965C313063D20DD02F5
+149A0277EFCBE207B876EA2FF60AD7EA3B4341DA55DF07DC
+F6453491319F18EB5F5511D7E4632487ADA59A209B9F7680
+0
+662C8D8B0AE6CC03B93714EDDA60ECF9922FF1932DD7FC2C
+67B7B0DDBEDD6D9589109941A6E37DFB9F429ADB0F0E1EF8
+0
+9910393436D4F356EC185056974A7BAD9D0D460F612A6F1D
+0FBD1DD154CA9F5D07440F661C11029D933DB4D600806C26
+0
+42524FC4D99D284A34ED065DF5FC71CE5831B99D99E6B05E
+CD9851EAAD953DD9DAE882D04F8FDE11AC1768576D8E8225
+0
+380F037534B22D8B37125F4607BF281B44A7826A0B2106E4
+AE55353A093C4571940815A81AD8E9E2A00469510101D0F3
+0
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+117CB771C1CA7867A8126F5D7FD1507E56F4C3701E90F6BC
+611A55DF2E670AAA43973F5B7E0E41432D3D6F6B17AB4681
+0
+7DB7213A6CAF56C245D155318DFF56D091FDC2605E382C13
+14A3342E7DB18CCF42555FD10BDCFDD4054C87794D5699B8
+0
+E357CD79BD60393756DB3F0B14E042FE2A5F13D755DCBAE5
+C9C1AFF2A75C29C38D725FF5C4B2DDBFD3EF1F7CE847AAB2
+0
+47D8FC22DB27ACDC394477214664AA30B1CE314BCBCCC650
+AAD46102414D174074B1FD5F47DC71BC46C777B28D6C9A2A
+0
+B0786AFD6DBF9A7C5C7AE4C0CDEB00BE041F8CB2B5F04BC3
+07882F151A3F586ED85BE311A96024E2AF12FB87F7A59B69
+0
+3732A7BD488E00C8D9A513495361FE0DB8FBD8F823EFB32B
+9C7F20770E7C4FC83C8FAD8A81479480C1F9AC5BAAC5F94F
+0
+DCCF66B7631A47A9293D2C09F2710A6320C4FCEC6050F34E
+4C6A099C5494D972C3DED158C15F102D1282553819EBAF43
+0
+E3DBA8CCF0981E758BAB02DB42C5692639F9A50CD968CDD9
+B3DBAA27E708932ED15D26AA449DDC8103F983A72DD40E39
+0
+6
+ecdh_phase_two_batch 494
+20
+8538107D29A0645F4F69A8162760DFE5BCD7F30F3A2172D3
+B6B5ADCA0E90022EA2FB613DAEEB4BF77E2D3F9C702C434B
+107C13D2BA561FCC764CCDA50E34B95BB03746AEB302224C
+0
+53FF2723645D4E23BC0620C57264D57300A63D11414AFDDA
+BF398DCD95A12AE6817CA9E2F3F938A74C225120932B623E
+0
+E136B249DB7F45DE1994D736D8106D3D1671688B61BC35D8
+D42E63EB2C7D1EAADA5F5FDF29399BF519DA1E3D21CE22BC
+0
+BDE26BFB16ACC48FCBDA9B7A755B88CD24C53549D7C5C141
+1C95705D3E85A7A12A9F6A9A048C6E45BAAFD2B3BFC95591
+0
+3C9D7DDB7BBC895D3C3AE9E95B6977499086D34B01D2C07C
+A857E9B04192E9CAE5B5E8D77E3667CEC8FB6C6D342691BD
+0
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+1376B03D0EA7B96B32760950ABAF3826D1BB001961589C1D
+06D312D85E7F4D3F7F5662B3FEAFDA16E6230314ECA05F30
+0
+E2E1909AB6F06CE3AD84F1A45982EDE53E8DF22FBE4CE464
+394321D7A603FED6652C9C747156B6EFF5975DEF6D0BEDD4
+0
+962FE32CFAF06D9C503B1F601CC2D82729CC3AD6CEC72A6F
+9CDCDC17B8025E52C592B5169D796B253B00331861864F80
+0
+9E9017FB102BC2EC078D4F6062E591B4307E7418083640AD
+201B6F23F516A135D16EC39E90A0F79EB6A5770D28AFCF0A
+0
+E5300E63427311DE53EFAF6B15C89C55E14E098BC2CA0536
+28C7EBDC306C99E50608592900B6F7A74949CF0D56C8AB79
+0
+4FE7D9F0E0CB08655F354EC3D125F977655F79FDA14E335E
+847BEE84B0D95FDDC0AECD77AC9F113215C19DCFE44B6826
+0
+09D87905746AAC732DBC0548B0227E2FDE0218897A35BD78
+9A1723C41564F35D1BC3CF505DADB4E60EB67FE6F3C1F64A
+0
+E019B556126D996C965B78AE82021B6B47FB5DF784CE8BF5
+DA88484DABCBD2B4A4D6C84CC9EC00EECA8C340790E3FA37
+0
+698267FFBB03173466CAD948398D2EB672494D0701208F0A
+5C03484EB2D275F889286C2C6D035553FFBDC9A42454D19E
+0
+298524091327C8091C6DA2A0B69812BF8F1EE6E14E122D5D
+183710223CFA24C72136C20DC8B30F8D090DA72499F74DA6
+0
+50EC86EBC14A341DD896171E36AABA1421576ECAAE13A1DC
+7BAFAC4531735B76325ADBA812551E32C054F1AB95D21D2B
+0
+898B1498FB9B15A5C7D077B59A7E03D8291D14B57B265849
+441752FDB58D0C5846C4892492E3ABA7C4C465672B006C6E
+0
+F154928DEC478897A0E3A7601429550DA900EBD84D08CBFB
+2BF6F79BFB81A400B016EFECCA3EADCDD2F1DFD418ACDEC8
+0
+7BEF768C424B6098502EA85BF3FECB14DC470ED11B1E8D64
+54D741250D9C73764C6A0BB47B0EAD4E9BB83CF51730E1EF
+0
+065EBF6169B819E1DBC5E8C4A391BF6DB1352FA3490E4BD3
+D12B5D2D8AC0AA109CD32DF19497E50B7E443C6745CF0DBB
+0
+C25864FE6A0B03871E23D472853F949F70282E4DD44811E7
+7AA9CC32B0EE9E4D8FD191B73868034ABB9D723EACE50BA0
+0
+14AC7283AF199BFEFD432C95ABE163B041123C90F47BAB8C
+2F0DCC1F5170432CBC3395DBE8415DADEECCA5EF0C8EBFB0
+0
+1C8AAF75092849B40E0008DF88BC9B7FE882BFBDC61DAB73
+FECCC8B090D0BC39C729596B233B4FFA0F0CE2C57187B379
+0
+464506274CC2B21AE2522CF097F6B55ACACD3DC84974992E
+80CE11358C51512E44BB1B611FEFF74ECDBD28636142F9A8
+0
+AECF07F240B7051E2465AA469C976EBEEC1E840961DABE84
+54553FD790908D3DA5A08BD156C6AAE256030A297511A87D
+0
+ACDEC6A891ED4DABB57CE4250AA015D10F87FDAAA1C3D226
+C451F2B7E927C81D01292F9C00478EA0C332174F0F5F3E0D
+0
+8400EE9A6472AFC6EBD50093248B8864DF5379BE1DDCFBCF
+2A7745D6DDE670B52A3B8896DC37132454AF6354E7381803
+0
+04BD01E8F54B47B6B7BD59B133715F01864402A193AFFE38
+D2B3A2226AF2FF57A2C3EB15957B5D6E9EBBCD5FAB3CEBE7
+0
+87F0C3970125A9B5BE8A967FC9BAE8EEC7E87F2CE681E429
+5292C74207A4DBCE85902819B6A2BDEEB7DB1C455BBDDF9E
+0
+236BB785D2526B50BC708B9998F02070B6899F2C2E8D9A83
+9A763DA34865BCA26A68E22A220A52D813DA1C283DF050D6
+0
+0588E6F8BDF690FA90AD6FEDD3814AD66EA795B8982DABC7
+629F24C984E5CD4460912F86AB2B2DC500995D796C1D0300
+0
+44278A7CD2F9DDDCC211F9583646285DD962A505937C5C6D
+DCF7DC03AA30080170CFF8DCAC975707237CCBD62229BDDC
+0
+0C3DBA3FD7CE71F93476121759B434DB0EC75DCBEB2442FB
+AD9DBF02ADB4B1335CB8CB913ADCFDDD64E2AC68C65F46FD
+0
+9734115842195AE0ADF30F36327D5A8D08D67F9D783621F5
+F1BA1D6066423BE2E0B591B170D9E65303860E6AF9DBF19D
+0
+105A1B0B044CA6F450AEBC3EB86DAA768B51F1CA9DC9D863
+A07A1D4CEDBA30F02AC3BCE2D910C210821F42DDC30D20AC
+0
+29BA25FCB685600A2C60E076B73768F4C3D8922E92704614
+32D441601D18F1D654E43C12C791DD5615374146C9F834F2
+0
+7367EC0B85ABBD8F5401C4A0BB38494D6BE55FE8580498F9
+AAB80BC4C91B148A40B7D21BDADA73BAA6150DCBDE5B9FE9
+0
+BC2C5F10DF272E67790C749FED91E248FF915CAA3BB6DA55
+4B7C82A1090794578B44A6082B4CC26494C7DCBD649C5D9E
+0
+ADF882888C97EA8DE6311035EB03BB74186431EF53295274
+112C1D225AB4391B9E351F23B4E37B2D93E83CB58135183A
+0
+19
+ecdh_phase_two_batch 495
+5
+000000000000000000000000000000000000000000000001
+B1DFEA1F5D3AD7A8E62B578859FF08BD389F35E10C0B0C9C
+FFD490C3DB5D4E79A6F32D977426B082829F5100778BE1AD
+0
+B1DFEA1F5D3AD7A8E62B578859FF08BD389F35E10C0B0C9C
+FFD490C3DB5D4E79A6F32D977426B082829F5100778BE1AD
+0
+2C1F15CE42E92BAE40757B2D4C45CEB45A4CA4FB88393D57
+B9DC68313111707B41BEC2DA867058AAB7FDDA0359D7F0D0
+0
+2C1F15CE42E92BAE40757B2D4C45CEB45A4CA4FB88393D57
+B9DC68313111707B41BEC2DA867058AAB7FDDA0359D7F0D0
+0
+8667AE98C22C621B3A86BE4A42F8A10BADCFEB10B9C40CCC
+64E1DC1665B502F6780FED427064144A180DE23FF2930CA2
+0
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+D5548F56818304E63735116AF23E9408E382440382C9A367
+0155FA9D512D068B5DAD267FA2FA3C2A332E1E3DCBFE2F94
+0
+D5548F56818304E63735116AF23E9408E382440382C9A367
+0155FA9D512D068B5DAD267FA2FA3C2A332E1E3DCBFE2F94
+0
+91A0D06A452470C1ADA1AE7C3D2EDD3AFC4AA0DCC038415E
+9C73692D84B61C33E91CE4BB810C17882955A8E79F1FCD84
+0
+91A0D06A452470C1ADA1AE7C3D2EDD3AFC4AA0DCC038415E
+9C73692D84B61C33E91CE4BB810C17882955A8E79F1FCD84
+0
+4
+ecdh_phase_two_batch 496
+5
+000000000000000000000000000000000000000000000002
+1E60248C753DA3BBF3370AE39182F3FCB4E5798164C99110
+72B444D2B87CFE418DF20AF2C254148ECB25B4FF8D68D05C
+0
+5BA4A39D0BDD660BD35267A27ACC663229C4D1E896A71C6D
+DCC99F65B7F0223EF6419F75186BD442F0B7C7565C70F8F1
+0
+B38ABFC781B0B5B37953190CBABE3A22E34C30243FCD258C
+2153174075C453E5F21861766C776D3CF5A6D493206FC17A
+0
+64906798DA08D9D0878A70766E3FD78F8EF939A86E497F09
+75E2CDD0CCDF7A238906957C58C8184A6711BFEBF15C2D99
+0
+17D3E7552AF838ECE60C1E1AF1212FB5BC6EAD57167E9E13
+82E3F730CBCB6A6D0048C8A5448C4BF9AEA092B71CCF3F6C
+0
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+6C2544B384556B1F6B8FE1C03034A4FD8229051C8A21E37D
+4E603CE9D7B568DEFF4F51E57F10E41C67FE6AC21A471026
+0
+F626CB45D94713F70B33C06824F7986815486FE3E968050F
+FE30616B8E48283AF259F1345555EAF8826F0248FF6AE983
+0
+228F2D5B2C5D33D53973CAB7B06BF2B64011894C60E1DE28
+3C124913B619F472A5C50D27A38237EFD3D8E92AB37B27E9
+0
+10F87114EC866FDC17AF7BF8104311E3980F834452629484
+C8CDA7884A04170A477CACB974DC3A209A510890919121CB
+0
+4
+ecdh_phase_two_batch 497
+3
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22830
+96FCAB6F57AB816034BE774671A1A919BC9DE8A4DD37317C
+11FF9AF00038CD554664CA97ACF64D72DE3AC23BDB09E133
+0
+96FCAB6F57AB816034BE774671A1A919BC9DE8A4DD37317C
+EE00650FFFC732AAB99B35685309B28C21C53DC424F61ECC
+0
+6CB60B27D51D6A438061F5C77F2BD04550DED70C6E4A6242
+17D37288D4A68A37D970466AE673691DDDC427A917D82EC0
+0
+6CB60B27D51D6A438061F5C77F2BD04550DED70C6E4A6242
+E82C8D772B5975C8268FB995198C96E1223BD856E827D13F
+0
+E36AB3FA5516603B270D05A74EC370C1814188EDDBEDC2F1
+62644536DC982F4C25F7E80635C3CF3FC9CCF56A09DFBE9F
+0
+E36AB3FA5516603B270D05A74EC370C1814188EDDBEDC2F1
+9D9BBAC92367D0B3DA0817F9CA3C30BF36330A95F6204160
+0
+3
+ecdh_phase_two_batch 498
+33
+3F8B965018347F757BD79CE80773A1CC4B5329A02CF610E2
+FD446C2B0DACD774489BEE34F978A1CEBFB5E87E43EB5320
+921AE2BAF9D8F3944F8094233CB93FB1A58F5987A4E08F0E
+0
+FD14453221EED24F9EB3935A9CA4A979BEE7C41B5BB5AC1E
+8F1260E4D54FD677B65099990DE59619D0C950FEE984BD35
+0
+F15C2881968775761F9B6716162F85164247964E03812049
+4B4EF15B55B4E287674F2FD6403CFA4BC36F33A3A3EC7490
+0
+5DB5741E18BB4DFD21192AF74F3FF3DBD8C3F90A6BFE78ED
+1C582684F962DD81BC8AC756A8D061063A397B8ECED44DCA
+0
+27DCB2ACED4A8241CB84DDC164BD6D32CCB1E2CC9DC0E61B
+83482DB2470E20D32B8E321CDA83A136275BA788DA42FEA4
+0
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+22B439136186C11DEB7BB38E266DEF517A8325723086F3AC
+80B9907FD7AEA24380A38B5A17C721D3031011DA67CD012A
+0
+DB39921CD3D68B4644EDB805D50289B777A129734A8A8FFA
+76F865022550A1D59A5C61E815888C4B687B91168C04CFFA
+0
+9390D118B200DA193280F5714599C0B9C9497FA2354720AD
+1F7367EE07D934BEA8157B2CC02B9B814D0D4EEF06F2E39B
+0
+3B7E33027B8B2450893F083A033F646EA2EB50C7D6D65EC1
+64533919F74D84F7D0F65C56BBE786D48203380EB68BC6DD
+0
+CF42A59893F0A7C360C7275217E590D22F2C363308D40A5B
+B05F46473551E80C5A4179D6244429D6688C672DE59E021D
+0
+120C544394AE0450AB189F70D3E0E29AE89F1F2FE9F01CF8
+ACD359E044E33FACAFB1A7611FAE4B09FDB7B43B11D9F523
+0
+B7FCC26E3037829962CE2CBF06571E8A34B7D485814C51B8
+55D8136996F2377EFC8004FFFCADFC949D3121D01D86BE2B
+0
+96D377B7F1E17510893885DD55E3049D0F7463BDB7474BC9
+A8FB71787A7C851AA01C4C5CBAAA844A4D2D10DC7F28C0DE
+0
+31A02186AFF67A49510DC60B1FA27D011870CB42692DC1A3
+46C246D9C1E5290637FD906544113268C1249C769C2CB518
+0
+05028037BB3A2B6231B2C9D6D3DFBE2CD42AE325E27B09FE
+AFE9B0A0CB21ABF62880D1A56F090D9F5F84B00BBFCAC4CA
+0
+AF898F5A7BFD3FB1AD99245FE7BE72460CE760C10A71E458
+10FEFEE70CE4567E7B3ABE0DA7731AB9F6F699649AD449F7
+0
+A4B89A1579EA7AF5AC0C7F52FFB9BF3B15B36DB1D41C9569
+E994D7929C0F350564E0B3891592B9FEA531CC4AC702CB2F
+0
+A05CC8FE454F2F92B39688BD5168F1383540034DC8069020
+2F8CE18240C35A0749AB9BB62FBA9CCF49A0687ED5FDBC80
+0
+29AE74EBE99FB66F3438E4BCE478210025F987A0425E3B8B
+3CC969427EFDEB86C960540E89ABE5CBA96065C9812BCFD5
+0
+6677774BED477ED61FA31449A7BE60DA530E1C21834C52C8
+40BF127CD46FC182C3BCFA5A6DCA178731D084740B355C0C
+0
+2E752058D6BAFAACBFCF1261C42887D654EA4A763BC2D946
+8B9276695B4BA7040FBF4A6567904088C8457827B0974D9B
+0
+F6028FA1C8C7F607C5FE47B344716E32E64BED217663EA6F
+533170C9520D0BFBFDFF29499C00AF61BAEEACD9145F80C5
+0
+21F7FC750669A297904661E07CCA8B8D1E677F3E173094D9
+8180189ECFADA1AA6B86A1346BC60AB3594DAFD681EC135C
+0
+224F927C84359F5F22A0B574E41942A24E9FC749D5E8CCDA
+97B7E3E979745D51C4F8C41898A02EE75540F5361FE79F8A
+0
+B3799196D1131022E34ECDC0D7C08A0043A2AF7E45FDF0A7
+0A9FFCA275052A91AB055621672BEC6832049330E4585F21
+0
+B0B2D1CAE92FF11068AEC12C9EA85D04F61224E1B6DFFBDB
+CA012C1CF237A3D0D894B4724C1F894A41626A9E7E249FF1
+0
+EF7E0C9ACFB8360624A3FA6E9FD669C4FC458D5DD2C6FE08
+705EE48482CC310796F3379B2F8ABE728D6F5344958C66AD
+0
+22416CE034A453B43FF6F4A067FF16161CDCADA0A2C98D24
+7DD28973B3C19C461B66DA2C1C4171FDE1C7BF3809556B5F
+0
+22EC9D50AAF079CB345C8FB7F7F09458BE7B6C7AB867FDA6
+B9D3AEA87743119196C617C16B6635E04F66E46922F4E288
+0
+2E62D3F2E10F47F0F9268A6F6EB0728BECDF932DD66B7390
+A939419D11CEF2A0260366D2D040E5BA5636841F061A4277
+0
+D31561AACBAEF0AEE0FE523E62138C29923546D1F57BAD0B
+88A640F5F31ACEC6AEAC569FE9911145761F80CE9F570151
+0
+D5DE022B25ED75CA69BCEA5B1EAB215C990D71FDC2750EE8
+7E1A6BEBEF70D3B422D5D1CB67370B8368347C91AD5B5530
+0
+5C6AC63C9BE2F04DA67CC296DB39D07248819052C16758AA
+B93EF916FB871F4137A10C72CD2D1798099E9156C853ACC9
+0
+B71B003DACAEF9DFDDD95180FC0A19C77DBF1B52A6406A0D
+BC31220CE6924EAB7775F7E9E1323F4127AF1C90C00D625B
+0
+843B7263BDB3037D78C18140CC77DFF9C4A456B967990E7D
+98F6E1D0D333E435CC2D28D6867C66CE0E17A56FA62D13E2
+0
+01900C53E23F0E9F6CD2D93FE5DA444B501DC61D30F4EA29
+DE1906AF55A31E03A5053BD851BF3CF2E81DBB7DBD74100E
+0
+46675FB708A0F894092EF674E89189130D92634C20E77971
+7DE01F776C70FE355FFF034986051B9ACAC9038D338171E5
+0
+F8689ED842A31A8E086821E46E87A4ADAD6334097CCD34FA
+5B4DA48715B19889B88504A074EE16E73FC8D0AA2579B808
+0
+9D2F7CC8F7B1049CD4B4D149BBEF1D4215245FAE96711FC6
+8130EEA91083272A7334F773105A53A365DD6BFFA54A3DA0
+0
+DEDB538F777B645D7A14362F8697B5B1F7D4D3D9038437ED
+0B0A1F3A9F1565D1809B10CE9FF8B4DE4BC5C138B7CBEBD5
+0
+A792B65819757A5A11929A1BEE4E0EE3F0E503B23432380C
+921972D03C38D9502CCB106C8142ABC4795A6405C6F18A7B
+0
+B2A56098300CAAFB8CD33D54BE487B90D08B032FD7809288
+A9AC8D45FA38D564D1BC98B65CB09F6558C9846A02B07AAB
+0
+FB26326FD2ECDDABC337DCBCC06F4C0E5620CAD3E1BFB599
+51A49AF1D31EA4AB530340BF3F0F01A29B3A1678F231B670
+0
+8A11670DFFDD5A5D5CC44F5F4B297D1F4F20A79E6DF71974
+3D785BD9A97DF0B00C4DDE422E740F7A74E25935BB4B69BE
+0
+4DCEBEA9E50CCB4A8478FDF95ABAF37668D95F84A6706E7A
+A887E43D4FE286E2A457F5060FFB254FC9265E74E5804689
+0
+2A4A5CEEA06DC1E3376B46F087E3F941B487C54C2495BC86
+695340108D1446C0693421CBF4BC9915F4D1BE1D45827E7F
+0
+1C0F0B6B7E3AF47C6D4F4459229D3D1F393E937AC50E3848
+23DFA6F2017A497A35BE7C3F8D4398906734E8527C52CE75
+0
+74ABA148AEB22FD701904BC8882AA17A85A9226A88A9F257
+967AA8CFE72C513761110EE5B9296DA27DD9C79BE2C2BE0E
+0
+C161F6EF610815E1F5BC48A41F6A2EF2A0F8EC8997356CAD
+279D8626B5C428F360D9CA7F7A0C93D56586BAB9DF9D6AC0
+0
+AA94B32082372146BBD24341E653D8AF2559040C49076CD8
+899868FBDFB26986DEB77743D652E11516F5A99B1D965B91
+0
+5033356201226A8C0A8021F57E458EDFC7246B8927B88BD7
+335019C07939F0AC8B668A0460692F244DD592F7AD1EACE6
+0
+69E839FDBF02065C9CD4E5F08863F483A2E9C9871177A516
+7742109DD427CAB241544373FB718AC97DDEC4AAA9021C52
+0
+43B9924E211CAEE96898C6F789DFC9A01430E0073F737F99
+AD30F7DAA6B36A20C1DE21BB37C1A69AC2BCDD285CFFBF11
+0
+C5072D43CD42C50C21DDC634C77829BA7C070EB3995B3EF5
+50A150281E9D10AADE2141C867F6D468DD48342147882151
+0
+83891DB1214285BDE47AC95288295725E84576E8533E8969
+41F13336BB992BEC5826E55C8176CCE710B1EE2290D06449
+0
+3DCFA3DBCEF2C354FB34746C1E833A1E2CBEC566BF5F52C2
+AE91DF0FCE3B7BFC20885B95829B46468EB297DA47AADE89
+0
+CC0BA17274C6E09C911D4D7CA6F2BD6DBA34D9EFA3A3561F
+090EE7F9F952076C356712825BFF4C3B1B31A09E243B5C10
+0
+A5FAB28AFF14526F87CE0D6C837AB0BFBA1F2054395945D6
+17FB9805F7B1FF25BDBA83A85A0F040EBB78981D6078804B
+0
+C45E482C085D278E818E5ADF82D62BAEB813E2A2FA8C128D
+89557E1FF89F08451DB9D89FFA18805F7358F9E460FB294F
+0
+5B1DF108190230BF5D8AA8E8813ACF0F5A3804E2CA112CCF
+C33E32605E745355ED21959D65371DBA540386AF3CB443C7
+0
+E2690568E350F7F0ED39D587B3DB2705ADFFCEF863B3FFDC
+4CE5F893D5176094551CAE5E8E41E2A485CBA8C185848225
+0
+3824EC34586AD82F6155C20C01E8C9EDDF3F28BF2B668B00
+A76502F766AC10CA111D5AE366F675E1376158347C038198
+0
+7AD3C7B8D110EE4BB29B739DA15DFCCFCD63307CD74C9C94
+2CF255451802127127B67F375147E6F089DABC0B1E13A99B
+0
+66CD2E7DC814CE1E2A93A5566D978A1F25566A0EE713EB6A
+133E2BB960DCD23A8AA25426B6E191A1FD095F14DDD8355A
+0
+5D38AEEDB9C69B93B0F83B23070229FAB4BBE7CB47BCE177
+595304C4C73388FA461F44F607ACFF5BD86B60E6D78BEF9E
+0
+32
+ecdsa_sign_stream_sha256 499
+E6E9D6A12A8161E5FE1B14343B106980550CAEF9618A9262
+02F3C8D5EBF93C3756A6E2CA298192FB597749A943699509
+1D4E3DEF4342B3DDA0C5ADC346C9F37CFFA40D3F0A90B72B
+0
+C5
+1
+ecdsa_verify_stream_sha256 500
+ACC8F88D680E07DE8ACE755E5B3CB9C19E602CDA88B68A8D
+513E2A30165F94EB6FC0E7965B160EFE03B8FEBE1E27E915
+C5
+1
+02F3C8D5EBF93C3756A6E2CA298192FB597749A943699509
+1D4E3DEF4342B3DDA0C5ADC346C9F37CFFA40D3F0A90B72B
+0
+1
+ecdsa_verify_stream_sha256 501
+ACC8F88D680E07DE8ACE755E5B3CB9C19E602CDA88B68A8D
+513E2A30165F94EB6FC0E7965B160EFE03B8FEBE1E27E915
+C4
+1
+02F3C8D5EBF93C3756A6E2CA298192FB597749A943699509
+1D4E3DEF4342B3DDA0C5ADC346C9F37CFFA40D3F0A90B72B
+0
+0
+ecdsa_sign_stream_sha256 502
+026355459390C87CC36492ADBB4BB95CDA1A4658622FF19C
+0D5FA0970A27874FD68D500C27E7618782FDF86EA3D8A5FD
+0929A31FAABBA68B349AF1BCE079718A171030E121833EFB
+0
+7F09E04F4CA355831E3D10DD906E25B8F340093F32495B1B88A2730D5DDE1D9ACC4A362FD00BFCCA750B2B4527EACDD98F0E07EDA45A47
+7
+ecdsa_verify_stream_sha256 503
+0D07DECE832D1649E20A9698D11CCF4DB50D464A47CFFB06
+232FCC27CBAC59ED10B549F0C8228A0E88945D450A13DAB0
+7F09E04F4CA355831E3D10DD906E25B8F340093F32495B1B88A2730D5DDE1D9ACC4A362FD00BFCCA750B2B4527EACDD98F0E07EDA45A47
+7
+0D5FA0970A27874FD68D500C27E7618782FDF86EA3D8A5FD
+0929A31FAABBA68B349AF1BCE079718A171030E121833EFB
+0
+1
+ecdsa_verify_stream_sha256 504
+0D07DECE832D1649E20A9698D11CCF4DB50D464A47CFFB06
+232FCC27CBAC59ED10B549F0C8228A0E88945D450A13DAB0
+7E09E04F4CA355831E3D10DD906E25B8F340093F32495B1B88A2730D5DDE1D9ACC4A362FD00BFCCA750B2B4527EACDD98F0E07EDA45A47
+7
+0D5FA0970A27874FD68D500C27E7618782FDF86EA3D8A5FD
+0929A31FAABBA68B349AF1BCE079718A171030E121833EFB
+0
+0
+ecdsa_sign_stream_sha256 505
+1BFD008AD6BAD644C059C089DA099928DFE5395BAE9B3DEF
+66CC30FBC1C71E97132CF1353E22AB6233C78E0A255F7640
+7CF2E51E5D6751097861A11924C670ABD39E25F1BDA593E7
+0
+41D32BD6327B70DFB9EBD2E62A8D6C7F8DC1A6C296E1296D546D0F735CF07B20794FFCA83E74C43CE462FEC9B68AB50F5B4E4E5AD22415B46DCC9D914D84C276
+64
+ecdsa_verify_stream_sha256 506
+177157FA951FEBBFA710237542AC2A6FAEF5EAA67BDFF75F
+566DFBBB6BB2CC41E56A7D81FF4B8FF4C1DB1F795D3DA146
+41D32BD6327B70DFB9EBD2E62A8D6C7F8DC1A6C296E1296D546D0F735CF07B20794FFCA83E74C43CE462FEC9B68AB50F5B4E4E5AD22415B46DCC9D914D84C276
+64
+66CC30FBC1C71E97132CF1353E22AB6233C78E0A255F7640
+7CF2E51E5D6751097861A11924C670ABD39E25F1BDA593E7
+0
+1
+ecdsa_verify_stream_sha256 507
+177157FA951FEBBFA710237542AC2A6FAEF5EAA67BDFF75F
+566DFBBB6BB2CC41E56A7D81FF4B8FF4C1DB1F795D3DA146
+40D32BD6327B70DFB9EBD2E62A8D6C7F8DC1A6C296E1296D546D0F735CF07B20794FFCA83E74C43CE462FEC9B68AB50F5B4E4E5AD22415B46DCC9D914D84C276
+64
+66CC30FBC1C71E97132CF1353E22AB6233C78E0A255F7640
+7CF2E51E5D6751097861A11924C670ABD39E25F1BDA593E7
+0
+0
+ecdsa_sign_stream_sha256 508
+7DD27234CC286F1167362DEB4DA0328D6AA78B5C965F23DF
+C529E30B150FA490EEED6A7935AF76717B5EF877CD2AD9EF
+85535696D3718B4883B3AE7C84125A9A2EA238ACA58D9063
+0
+7A31F0E177F75DF295247EFDF1C01B0D64D3FFA5BB58DA087154CD4C0DC00D778A0C7EC55F16A75EFA201461BD5C8DF82CE0089E369BC722A3E0BE5B2B24BDC7B3
+64
+ecdsa_verify_stream_sha256 509
+2C0AFDDBBDC2E8E20B242A9AFBD22E85C4B6FFAFCD3EB349
+673AC95C84C0982C8BB9F249548677AB7650481DF4986132
+7A31F0E177F75DF295247EFDF1C01B0D64D3FFA5BB58DA087154CD4C0DC00D778A0C7EC55F16A75EFA201461BD5C8DF82CE0089E369BC722A3E0BE5B2B24BDC7B3
+64
+C529E30B150FA490EEED6A7935AF76717B5EF877CD2AD9EF
+85535696D3718B4883B3AE7C84125A9A2EA238ACA58D9063
+0
+1
+ecdsa_verify_stream_sha256 510
+2C0AFDDBBDC2E8E20B242A9AFBD22E85C4B6FFAFCD3EB349
+673AC95C84C0982C8BB9F249548677AB7650481DF4986132
+7B31F0E177F75DF295247EFDF1C01B0D64D3FFA5BB58DA087154CD4C0DC00D778A0C7EC55F16A75EFA201461BD5C8DF82CE0089E369BC722A3E0BE5B2B24BDC7B3
+64
+C529E30B150FA490EEED6A7935AF76717B5EF877CD2AD9EF
+85535696D3718B4883B3AE7C84125A9A2EA238ACA58D9063
+0
+0
+ecdsa_sign_stream_sha256 511
+50BEA82C03B3E59BD7C57E0210B4D06716E23C24EA1C5B9C
+24B9861079050D0933FA2B6FB1659526726D250FEF61B876
+FE29EF0A34750703C7808F362DE2F6E838D37FD2F37F6A0C
+0
+9DA0A508631AD83C084C8D8CB156F1CEF7818B527D0D8D1B62A4909180958A922F22879C4FCF06BF77BFD4E6D67113671F97BD0A58FDD72DF1183DCFEA2A2E082C8CE7DCC68A114E2CCFC5B5F066BD2C5194695E8A8AF8FC2D7D72520D292C89A67E5941814B57B303FC29292539B44B2E668FBA7C264A
+13
+ecdsa_verify_stream_sha256 512
+9817DF82CD0671F9ECAB3024EAF2B7B85B93D6C789B6CF8A
+4F887A3720308D676A11F3F8B02ECB00254495F07A341DB4
+9DA0A508631AD83C084C8D8CB156F1CEF7818B527D0D8D1B62A4909180958A922F22879C4FCF06BF77BFD4E6D67113671F97BD0A58FDD72DF1183DCFEA2A2E082C8CE7DCC68A114E2CCFC5B5F066BD2C5194695E8A8AF8FC2D7D72520D292C89A67E5941814B57B303FC29292539B44B2E668FBA7C264A
+13
+24B9861079050D0933FA2B6FB1659526726D250FEF61B876
+FE29EF0A34750703C7808F362DE2F6E838D37FD2F37F6A0C
+0
+1
+ecdsa_verify_stream_sha256 513
+9817DF82CD0671F9ECAB3024EAF2B7B85B93D6C789B6CF8A
+4F887A3720308D676A11F3F8B02ECB00254495F07A341DB4
+9CA0A508631AD83C084C8D8CB156F1CEF7818B527D0D8D1B62A4909180958A922F22879C4FCF06BF77BFD4E6D67113671F97BD0A58FDD72DF1183DCFEA2A2E082C8CE7DCC68A114E2CCFC5B5F066BD2C5194695E8A8AF8FC2D7D72520D292C89A67E5941814B57B303FC29292539B44B2E668FBA7C264A
+13
+24B9861079050D0933FA2B6FB1659526726D250FEF61B876
+FE29EF0A34750703C7808F362DE2F6E838D37FD2F37F6A0C
+0
+0
+ecdsa_sign_stream_sha256 514
+8AD8AB613DF9018A752586F1B7963A8B2FB5507611736203
+7475DE0483A361663CCC08A189D534C6F86A6CE21A384873
+042B83C26D7C167B674127F3B4D06DD7366EE8E0E6844DB9
+0
+6C80F46F952AB2D4FEB3E4F5B1C59B4B300BE44D94DDF3EA4EF7A3762DB12A399493857AAA6D03ECD923EE7532DB4FCF423009E17E63D1AECC78D4EC948DCB11DD9B66B05E5711A7CD1DF019F0D78E55E347E4DC3A79F60A2E624B9D1A1DB610BAECAC80A5BE7423680C05DDCD072BEA410350FBCA19352F43EE616A5E36C64550182F5A10083DCDAA2787841C5FB38DE63FEEE4B17896E3002213DFF3D5AC64850A8704E74B845F70E55457F66422204C894E6DE53484927110ED58AAE39BD41A37D9728B0406B3
+1
+ecdsa_verify_stream_sha256 515
+7983D5D588A3637F705484D9861814E1B326EDB8259EA846
+BFE8792B32B73CF96AB8B6BE8EB4AFC942D9AAAB5B9874C6
+6C80F46F952AB2D4FEB3E4F5B1C59B4B300BE44D94DDF3EA4EF7A3762DB12A399493857AAA6D03ECD923EE7532DB4FCF423009E17E63D1AECC78D4EC948DCB11DD9B66B05E5711A7CD1DF019F0D78E55E347E4DC3A79F60A2E624B9D1A1DB610BAECAC80A5BE7423680C05DDCD072BEA410350FBCA19352F43EE616A5E36C64550182F5A10083DCDAA2787841C5FB38DE63FEEE4B17896E3002213DFF3D5AC64850A8704E74B845F70E55457F66422204C894E6DE53484927110ED58AAE39BD41A37D9728B0406B3
+1
+7475DE0483A361663CCC08A189D534C6F86A6CE21A384873
+042B83C26D7C167B674127F3B4D06DD7366EE8E0E6844DB9
+0
+1
+ecdsa_verify_stream_sha256 516
+7983D5D588A3637F705484D9861814E1B326EDB8259EA846
+BFE8792B32B73CF96AB8B6BE8EB4AFC942D9AAAB5B9874C6
+6D80F46F952AB2D4FEB3E4F5B1C59B4B300BE44D94DDF3EA4EF7A3762DB12A399493857AAA6D03ECD923EE7532DB4FCF423009E17E63D1AECC78D4EC948DCB11DD9B66B05E5711A7CD1DF019F0D78E55E347E4DC3A79F60A2E624B9D1A1DB610BAECAC80A5BE7423680C05DDCD072BEA410350FBCA19352F43EE616A5E36C64550182F5A10083DCDAA2787841C5FB38DE63FEEE4B17896E3002213DFF3D5AC64850A8704E74B845F70E55457F66422204C894E6DE53484927110ED58AAE39BD41A37D9728B0406B3
+1
+7475DE0483A361663CCC08A189D534C6F86A6CE21A384873
+042B83C26D7C167B674127F3B4D06DD7366EE8E0E6844DB9
+0
+0
+ecdsa_sign_stream_sha256 517
+9A069CFE30B01C4952DC26B283B1B57CBC1B211055C97B7D
+3E2586CE807A22BD8E5450FB2245F9A3910740308A98D078
+8D4AC037CD22F1AF9803CAFF948F13267D45691CBA0047E9
+0
+60AB29B57A621D4160C888A46EBA56CB2A94E3FB8E09C117BD38E1D40029CD19359621432880626F6BDCF2E43786388F74497DD6B3FC60C2494D356F8022CCBB0EC86DBC2D002913D56BECB0728D5DF0C8C263D82E99DB8B05736ADDB3C430C073E1751DC2EBB1274E59432F79A6ABE0D27AB45240E70BD6876E96C00B9ED277DDD19107722867426BC8D05AE0599B573BBFC16CF2EB48040F3194A9A5594FFAC43F72E4C1EFCC1D8DFEA83C54EAE72927E0EB706A35DA6A063E02D1F1892F923B5C7D1C2DAB345445A79F5CC07593F5F790C1BB80936BC0B5E2FC8A28C60AEE21832C09001A1A75400A7F1886E23EC2D5B9693B395AAD9DADEE910D5F96DB1D1AF3BFA6BB2934CF93C268121DE3B63B5EAE9B16B131D5C7114329825E371592A55E151B5A2827AD1D9853AD7538D557A9557ED615154B2CEADEC271FCD4FEC61574711F63DB5CFEE6EBBF822B53525AEF89FA70D0C23FDB2E828BAEA661E09A3712EF39A9C86C6FAA96B79E7A8A0C95C92A9892C6A968DA55488FD9F44C5C819A17D74E350E5BDA48250D99CE64E6
+100
+ecdsa_verify_stream_sha256 518
+344A89D0A97E0ED1888C566E903EE2896862E558ED16589F
+FCFC8EE640BABAA16A040BF24D721CBEC55FF9658118454F
+60AB29B57A621D4160C888A46EBA56CB2A94E3FB8E09C117BD38E1D40029CD19359621432880626F6BDCF2E43786388F74497DD6B3FC60C2494D356F8022CCBB0EC86DBC2D002913D56BECB0728D5DF0C8C263D82E99DB8B05736ADDB3C430C073E1751DC2EBB1274E59432F79A6ABE0D27AB45240E70BD6876E96C00B9ED277DDD19107722867426BC8D05AE0599B573BBFC16CF2EB48040F3194A9A5594FFAC43F72E4C1EFCC1D8DFEA83C54EAE72927E0EB706A35DA6A063E02D1F1892F923B5C7D1C2DAB345445A79F5CC07593F5F790C1BB80936BC0B5E2FC8A28C60AEE21832C09001A1A75400A7F1886E23EC2D5B9693B395AAD9DADEE910D5F96DB1D1AF3BFA6BB2934CF93C268121DE3B63B5EAE9B16B131D5C7114329825E371592A55E151B5A2827AD1D9853AD7538D557A9557ED615154B2CEADEC271FCD4FEC61574711F63DB5CFEE6EBBF822B53525AEF89FA70D0C23FDB2E828BAEA661E09A3712EF39A9C86C6FAA96B79E7A8A0C95C92A9892C6A968DA55488FD9F44C5C819A17D74E350E5BDA48250D99CE64E6
+100
+3E2586CE807A22BD8E5450FB2245F9A3910740308A98D078
+8D4AC037CD22F1AF9803CAFF948F13267D45691CBA0047E9
+0
+1
+ecdsa_verify_stream_sha256 519
+344A89D0A97E0ED1888C566E903EE2896862E558ED16589F
+FCFC8EE640BABAA16A040BF24D721CBEC55FF9658118454F
+61AB29B57A621D4160C888A46EBA56CB2A94E3FB8E09C117BD38E1D40029CD19359621432880626F6BDCF2E43786388F74497DD6B3FC60C2494D356F8022CCBB0EC86DBC2D002913D56BECB0728D5DF0C8C263D82E99DB8B05736ADDB3C430C073E1751DC2EBB1274E59432F79A6ABE0D27AB45240E70BD6876E96C00B9ED277DDD19107722867426BC8D05AE0599B573BBFC16CF2EB48040F3194A9A5594FFAC43F72E4C1EFCC1D8DFEA83C54EAE72927E0EB706A35DA6A063E02D1F1892F923B5C7D1C2DAB345445A79F5CC07593F5F790C1BB80936BC0B5E2FC8A28C60AEE21832C09001A1A75400A7F1886E23EC2D5B9693B395AAD9DADEE910D5F96DB1D1AF3BFA6BB2934CF93C268121DE3B63B5EAE9B16B131D5C7114329825E371592A55E151B5A2827AD1D9853AD7538D557A9557ED615154B2CEADEC271FCD4FEC61574711F63DB5CFEE6EBBF822B53525AEF89FA70D0C23FDB2E828BAEA661E09A3712EF39A9C86C6FAA96B79E7A8A0C95C92A9892C6A968DA55488FD9F44C5C819A17D74E350E5BDA48250D99CE64E6
+100
+3E2586CE807A22BD8E5450FB2245F9A3910740308A98D078
+8D4AC037CD22F1AF9803CAFF948F13267D45691CBA0047E9
+0
+0
+ecdsa_sign_stream_sha256 520
+53EC04E406A673E453BD4BEFCDBCB66E99A98E572F623D26
+70869C4BDC447640AA1FEB39C084A32771DBBB813F712081
+73E8436D92FB8AF823949DAAD6BB64E3BB80A184596AF9FA
+0
+55019BD1C055F09F88291C2E7478231BDE3723E3EF761E574C282F85013B4F57B379BA2E7133693B374A35C143F19C6D86FDEC0BB97F9AE021D0E2C6BC3BE986C99BA752235987F93A99180281D2ED441D9FFFCE46972088AD97D1E59E167A88FB69B192E73F3DA1013B69D7C9E47747E6910C18900E66C3568D63B8F902D3C5
+400
+ecdsa_verify_stream_sha256 521
+558461F734F2A7AE6798FBF5997D8A235D8D9EEAD4E91E5D
+C6D7A62A82A7582AF92A06A96F1B860103D9DDFF1788B850
+55019BD1C055F09F88291C2E7478231BDE3723E3EF761E574C282F85013B4F57B379BA2E7133693B374A35C143F19C6D86FDEC0BB97F9AE021D0E2C6BC3BE986C99BA752235987F93A99180281D2ED441D9FFFCE46972088AD97D1E59E167A88FB69B192E73F3DA1013B69D7C9E47747E6910C18900E66C3568D63B8F902D3C5
+400
+70869C4BDC447640AA1FEB39C084A32771DBBB813F712081
+73E8436D92FB8AF823949DAAD6BB64E3BB80A184596AF9FA
+0
+1
+ecdsa_verify_stream_sha256 522
+558461F734F2A7AE6798FBF5997D8A235D8D9EEAD4E91E5D
+C6D7A62A82A7582AF92A06A96F1B860103D9DDFF1788B850
+54019BD1C055F09F88291C2E7478231BDE3723E3EF761E574C282F85013B4F57B379BA2E7133693B374A35C143F19C6D86FDEC0BB97F9AE021D0E2C6BC3BE986C99BA752235987F93A99180281D2ED441D9FFFCE46972088AD97D1E59E167A88FB69B192E73F3DA1013B69D7C9E47747E6910C18900E66C3568D63B8F902D3C5
+400
+70869C4BDC447640AA1FEB39C084A32771DBBB813F712081
+73E8436D92FB8AF823949DAAD6BB64E3BB80A184596AF9FA
+0
+0
+ecdsa_is_valid_batch 523
+1
+12A2E1082B19A2B36544D38260E2B56A5C85FE2C700E0F66
+DA02B3DDDCCE8067AB286DF602D25D18BEA07991BABC199C
+39850D170772EAEA4A21229039A40DFE612B6CD52D39F5AB
+13C70A54E8166F00CE8916F0EA042E52B0C985D9B6874656
+67F53E4795ED14246CAA9B6067B9490E678285E002ADEFF2
+0
+1
+1
+ecdsa_is_valid_batch 524
+5
+BEE8D958661C75F334C0C08D261B77101659C8ACCFB94EE3
+BCD3FE02E8EA77A91E1FFD7DBF94A7FFB7F75ADE11025E47
+AB8755C5B0F9AAFCC41EDCA667B13551974B975360E09044
+76260F02108AF2BB3AD81EB513D7A8FA1D01FD3C12603E27
+EF77898C05C35A0954F4FDF23C202172F02D87F80A78B981
+0
+1
+83D55105AB8643296EF35E133E3E8B9A37C1DBE6FB8A233B
+F5767537C45484B448648A5AC21ED739DE982887E5AB9F17
+F1702CDE1B93551350BFEB96F57BFE7B451ED237183982D3
+2DBE962B35378BE7252BD5E3C41811D38314F6C75BE8D3A7
+5441DA27935572EFE2E8586E4F55D840386E8589B49B6613
+0
+0
+2DF90BF8B9637719B8B84E4E53373BE3C66DF9E6F8B1D141
+837F24C3993D8DE526AFCF83718E8521DA598CAB70A03C94
+C6CCAC693F7A9C53BF4302B24223053B214A79023047A452
+112C67E15DA80F65DFCCE575832B1A54C9FCE32DC48AD040
+0AA6A1E41B3E2FD6D1B843A0DEFD1469EFD17BF9566024BA
+0
+1
+000000000000000000000000000000000000000000000000
+51C80F914C50F1C6372909238222C3D783A9730B8610008D
+5E9879FF542297BBCFBE5628A7483D73D82E3ED6BCAF0C20
+1136461F881E0D352F562F78EFB16179AFD698F544A9100B
+30DAB5379EA143EF8D057BBAA53A9D69DAAB19DB61C0069C
+0
+0
+5D4314EAEAFBAE1F6705B13E84F26252538FE6803A17A45C
+B39B73F980DCBC9CBB189A0E00A9F6AC9B8A66C05D44AE15
+9DC2B5D1588D6282FEB9A31CAF0A96C8BC935110CB477E85
+207BE546B086818FBB44E13626FD661940427D076D01C3EF
+0D7E663F4A1CDA0B7E4EC789A154EC7437F4C80C846CCEB4
+0
+1
+3
+ecdsa_is_valid_batch 525
+3
+4B5224E093EDE28072F22D75DB603BB8F8863A1CC32F308F
+1C9F2242484A39A27961E83CB551971D6B3C7641C9C1C85D
+481FFA498B0F441E8E55E385A5940E139A949347C0E27124
+B6DB51570484B1BD0A9FA4B458E0D65CAC007B9CB6B05AD8
+57AD055C5BE451FEA5FF1B5307A4ACAF670A8AFC2D1D3E80
+0
+0
+7BB3E8CFB8AAADC37F1808D0DF83BA7AE67C20FDDE6A660C
+FFFFFFFFFFFFFFFFFFFFFFFF99DEF836146BC9B1B4D22831
+C2BE277B6EE870AFFFB91FD80F2C7BFCB779E1EB9B527636
+2E3CB6815101599B97404F52BC69031A64F9CD7AF418CA76
+CB05C378E5DD33B2024414A5BE4B46A73E8BC2B4360BB076
+0
+0
+000000000000000000000000000000000000000000000000
+977E70A78FAD9A25BB1DFD95A27BD372F585C8D520891EA7
+1024B6D5A5336E83EBC9D0834B2FD3FBA64108E79EA08917
+642A006EC40BE5E546400BAAB9E5CB4C29FE095F05C24CF1
+16F29DF6BE4BA7C33B26EDF5D56E77028FC033A8A50C1E9B
+0
+0
+0
+ecdsa_is_valid_batch 526
+20
+8BA87451C1C01548387F5585C499F284D46C5721F1DEBBA1
+ABA127157D4896DE3F3C039E61F9802D9E22B624ABDDAE38
+7BAF63A147850BFB0F8F7BDBD4A7163BFAA2AC82D733291E
+93BA44E6CE4A43FC61CC5222D6254A91F0179CF09DEEA58F
+0295B61F82EA5823A6228713313EC157E9A4768233126BC0
+0
+1
+05C2995A85F345AA370CC004F792503401D9F7FE149D833A
+A476A8836CBB0B7F82208E8CA4750EB5E81D81A42BFC18B3
+7DBB32C548BD4F5F10BEFE337CD6B3D5CC32DBA18BDD1D86
+52400547FC0D8887D45327476CB6EF0A0B6111BC21E9EEA2
+FB14820C66D3305E2144A5731B45CED4E50FB920BB9F60AF
+0
+1
+834E9766E884B203684EEFB967515A2BC1EBC48D228E4D25
+075E4FD3C22AC87C4559C82F707A09CCDB2031EA29E5D7E0
+ECFE31421309439221E5BA4FA844FC6F21E03026F18858D2
+18F6FA1C586857242AE0EA3F9F908AF4475AE8BFFF16E1B9
+DCD28CB1BAC7489B30C0C48B9075BADAD2E3998B25C3C886
+0
+1
+7FA82552935EBC315A474ED3429DCCB391F8B96CAFC62D33
+6DC56BCF587C28E0539921A1D793832DDD2701CB17027EEF
+5CAC216ED34F1EB480CF1263888DCFE4BEE771B14751FB15
+F9A3C51B56562FB9CE94201CEE590DE776878E8EE584F402
+FECD64F0E08BD41757C0681A1ADC08042C2AD51C71785716
+0
+1
+2A2757EA79FF7A35EDC0B76EB2A7177E19AC702FDB40CA25
+2C086F92BDAA52A6BB1C630972DEDB6C230C8103A7AAFDE6
+21B5F83340055E6C73DF9724F19F3E94FD3ACF4923BA3D9C
+A9660C5FBADF1B0CFEFAE03F46E03D9F04D84B234661CB51
+B492A860ACC10A2D9243FAA6EAD4F812045D5C03A21D69F6
+0
+1
+C86BA4758BB0FE3AA7F8E350D2C05D4D912A99F56DADF916
+C2C3BE02A1BE592C976CF98829FA5D79BAA3A037F1D63E50
+67DD6C28E97BC674EA327188143774CD0139E254E8C4D180
+6C6D4707226B5C973DC35C470411B4CB6E838D8A90FDD7AF
+15B27AF7A0537D93EC88C26B16A649D5E31DCA5DA72F0459
+0
+1
+1F1EF1C8F1F2846FB87C30C0BA19A257F8870EE63751BDAB
+A8EA144DA61D6F9E6B7DED09C502E74E2858F72ECD2CB2DE
+2807DB1B387E751B383F521772F0D03B81F347D5AFCDA5E0
+F8761981176B258C1541DC1077C9A231811DE71F22DC0935
+B3CF0B5D24E8C3C57D43B2545ED5E096D093BE3F95DB16CC
+0
+1
+F2065D6F0CF2303C45D7FE69A05ECED109264CB13DFA77FA
+EDDDCCC1233F2D06073F263D028E3442022215E4F2040D23
+13C4297204016F418B2B24FC301DCFD42AA333A3211D941D
+B898D8FD60468E3AB1652216B6365C5A3E8F81D2D8E3B990
+EA1CE1E1DF4574DCCD3411A2E36E46B34302D180C1CEC7CD
+0
+1
+1BA003C5AA4D2AFB30E6312C08293D084751391622CBDBF7
+08E3E977B279826BFF4CFE5EEA31AA765BDF9566638EEDD9
+9E839612ADCA2F1A296450FBA1C2D54ED0087459EB90B836
+9195CE8062662F5C92C760E7ED5C416B78A5D33FB01432F1
+A9F06A0BE4AD45A14E1B3E3C786743E28E6153DF33F3B6D4
+0
+1
+898E4557D9DEE60824DC72A7CA794D5DD6F81EFF0A53595B
+5357EBB51D7A5F48E13E905E599ED22D7CEE05E1208868F3
+31E001E81DFDAEE834A18D19CBB1BFD708C0863C042CB50C
+D1CD89088C3DA0116A3133720733FCEBCACACB8739B166C1
+91967FD44F0D48072FD8B6BA6BCAC6ECBADB12882FDCC7CB
+0
+1
+CD64DA16EEC473F025688E9309C492558E5A926E756DE7EC
+852CF43423332E49F31297FAF30DBFF59778E6B9D40F754C
+60BB269DE333D9DD45E58674F1203CDAB2B029386DD2769F
+1B112D3F818FA695D89EAB52098C5C9684177F3ADC610826
+2F0D6BBA73BA6D5D9219C6E321D9899996228FE7B25260EF
+0
+1
+8E9D9C94ED0113E02940F457BF3389F01825F9B9536B9564
+EBB85DE0A3CB5EBB9D14AA499B6D5C492CC80CEC1BF38170
+7AECEC812C074A42F2A55C0CA8F399F829D35249CC00286C
+2F27B7F30914AAD95B50ABAA2D0F7125C5920219E338239B
+98E85A8E96F6D79E653D4B53CC1106E77C7D00D8ACDE7035
+0
+1
+B478360496208BFF7F289F7C674B48B7778E2324A6344408
+493E2AF1B76A26F519A555CA00AC9272CA6E821D311B4B11
+7B025C6660BF7ED5FE8B105F7F0F511171EA7E47E0C2820C
+75369FBB53CFBCDE148E00C55792CB49E78680A53864C285
+2B5EBB736F7C9FBA0E9E1BA58FFD279C5642D4D779AAC2A5
+0
+1
+BF78102349C2F26EF2E5D738A240A0E219EBB8FBFACDCD5E
+4EEAA3A5583BF170AD4785E0F563D84079CC0461775B206F
+5D1956A70A99B14E584D42142C957838C65C50E1A4375F1B
+1559A2069529FC479E9650319A17B04451911E8EEDE51250
+2A5DB156D10108E58C537BEB8960A08AA9199E862FF2BC0A
+0
+1
+F75130DBA27763776D26D142B7B074B3955630A0FC7FA2BE
+782D4E0C981F94DEF4358FF615D90AB3E54DA6ED9948305B
+04FA314F4D3D65A089817872CD715C693AFA94650129EB4A
+9DC60512E84BFB16FA50226A20D056E9EBA3D34A5077BAFB
+E6B312C32D3AA1A2A320980A0728C1F95CD85CF5FA82C434
+0
+0
+6B3B83153B0868D435AD90DA60F3ED6CFE86E2A64A419EA3
+2452C28DB49301444976284B7C7969FC12F00F6CF801DD41
+38F1EB00A7035C852B0962F54AD42AC80C3270D897675669
+FB1B3128E304EC05B8A98DC5DE91E64B5A7EDE102B66C5F9
+E7AB0804F3EB357DE03FB5EC0C65B96D23896DD412B07C85
+0
+1
+4719E3DA75505FF793881C6A514AD503E8534C5087ECD8C9
+225E07989E1EF3D683053A19022D3F1685313E745456CC51
+4F4F6CDD12B09BB0B14EED71F1901F860C6CC6AE7A2D3DEC
+0792D4FA7CB5A0D3204A2F3787885D0823ECB72D4D44AEC4
+A093364A4FC30CF63878925B8F7C7EA9ECB60C2DB3321AA8
+0
+1
+992897A93030404F11E1FA282477753965E6BE3B75B2157F
+7DEA1030489426F7DC49AE5803FEE0090720B19FDEC7AF41
+8D4C4CE404B62E8A0DF9FAC20D71FDB6CC3F25C4F6797E73
+2284CBE43ADC6337CEF359250F0CA528BF042E3B202C8E0C
+90687CD59CAF7E3070C97669700BBC2E110D7C315220B53C
+0
+0
+67BA64B435F0B6B88326835AC2B0CA20FC48DFC7A8E5CCF3
+D1F5F88535EEDA9F3AFFD477C57C4E5600929BBC48DCFC89
+7CBDBE7E88861035B4351ECCE23B4E3DDD8D32C33A9B51D7
+414E1E48E375F14A7B371E5649DE4CF31A40D9EA00811436
+DFB2ED0E763B1ECDAB881D85C111D98B2CE45F78150DD578
+0
+1
+31A4A870C330CC391C379656B7657686E826E97064658B88
+BE5F7EA0D72BDBC0EDCE9939ACAD854CB3F70BCA9B5A026F
+9BEB381EA189076D382FA43AC6AAE57E9AA1C6C2CBEB192C
+083EB0C9F2F14BF0656CFE106F17F4660E4BB34C95C4D7BF
+281594823F6E656E6A4E3D16975A2885184B3FE17128926F
+0
+0
+17
+ecdsa_is_valid_batch 527
+33
+E1F5CC353DC44A8FDEC50B850A19B02FBCEF8D7B74086E56
+50D5088DDA30DAE7E1BCB8D020DD5007231D272D42EEFBD1
+13A1323AFBB8C79136DA507AECF99501FDE5E244AC438567
+6E76B3D7C4821E0A3736857BA9851907763E3C94FD546804
+5544ABF8DEC9C30729CD1448BCC897CD5993E48F1E2E1F04
+0
+1
+BF4E9726B1C2285DB15C8AE196EC9A867362E1CC1356ED21
+50C1F0E4167C8608872F2126F775BD7F431AFC5BF5FDEA85
+EDCC6EE4CFEFCBB0CE8F009F3B7A9175477AF41B466F0B77
+0116F3E3628EC0C8C093DC54AC1D85134D5A008E12B5A95F
+C96451917267318FDBAB9F3EB984703029B179A9D8C00956
+0
+1
+8FB155BAF299248B423FC85D22666B3D5647D043C5988B9F
+9335617A5C90503A5989E034964013F34DBB1115D56AC459
+2316E5BE666D345972E76C38B2376427B356FF080391FF9E
+C8FDC22C55113364BC348FB57546D4C7521F78C6AA429CC5
+FBB6B55B6B61845D434C211653E7B5E6133F80E87562243F
+0
+1
+7CD4E1191624A2F8BC166C612E072F969945CA2714DAA8FD
+731CC42A108E72B5E6278CFF6A5AA0F2828E3B299A50A368
+77E4B97E538CC8D564028C6F0A045D69E0B881FD54579FA2
+6AD48B4176DE4DCBBDC2EDC9523DB6C166E492136B79633A
+DC048D22193C44682C355DA6C39F66FE5AB673B732C51680
+0
+1
+38778C3E1005B003894F2C5A3D03E0830733F7EAC1DFE397
+5F3187EE5D3074BE8ADAC94D23D0909E6C9BB8F6E7C9821D
+47311401F6656E521B57D66DA87FB1CC992463D3B6AB9E2F
+306AAFB86323BE99C9F421050528F05328293B3A98C49629
+0964CF81BDF0AA5011668FE6FE43B560D8072F384B151234
+0
+1
+F1951412284B49121F15087A9D8C374A0EC608BDD7EEDC47
+0BAB8AA19198389436BADF0F29E90563C0A2388F8EAD0CCF
+4F2F56A67D6B312330075D9FFCCA9F0215359C2C9D68742D
+4ABD965C948A05CC8280B94C2463E02801EA53A19F5E7DBF
+75FD9FA5E710DC172259862B54D582402042F0219785D7B4
+0
+1
+F1508D1AAE58E2026E0D696A48B3B496618CCE7EF2DCCB55
+4F026DB93467E8E2A31274D1433E334418D9574C35C0B811
+ED7E89618F114BB878C18FECFAAA50ED6A0443AA16148DDC
+DD23F54777B4CF9D04C71867DA17A186A276E11176F5E834
+D90668329C55B83F45035A80D725D292515330200E63E8BD
+0
+1
+6289F5DA38B6A0F647F1B48747E1DA8BC2DBE66977C87F5A
+BFE8CEDD4B295D9CFC7C697A1B2D11881AF1E10E75146C10
+FD6A62A324EA09AD531E34FD918E3AC64D037D22EAF53427
+42C625F45D8087E1BA1D18C2EEF8853841ED30651FD11005
+84CB79C45EACCB65450E62F06FA43E752B24671A548CA1B8
+0
+1
+740B578A9547EEF0EF75AFDFEDD5FBC88683FACFD04F5D1A
+D13001A6D637B6514329640D5059FAFB0BE06629ECA23F76
+C71C042C0BB94260FB49FC3913F73B4545ED03A35F5955FB
+B214821D90D22517F949A75B91C920A703AAD41620B2738D
+2A84761ECFDC9FC03B5475683F64B78D544AE253B4841573
+0
+1
+8E80D215650C8D17EEFBD32624C03049319579136870C1E6
+C3E79FFF34EF0D9432CB3E1CD096F825F774D21A5EBB63F1
+ADF0C09759BB7DA97FB8D4DEE9F98D6DE5045402A25A21FF
+C5BB44E4DE7A35CC75267E2613D3A16ACB830335BFDD6590
+25AED5B7326FC0D96F89CD937EDE84D851103A10A54B488D
+0
+1
+451E890BCDD3C6E925CBDCC8A0DFAF58CFC4C225A5E456B2
+3EA1F1FD32839E49312FC86D13A0B355BE45C05C817A69A6
+503D2A73000320F9117C84AC8BCD979043A58672C8DF696A
+BA64DF87B96194AE9DB450848F2DDE550A6C527A773F82FE
+00FF6393C7FBA0D3F368DEC416C8A178228C058188D262CA
+0
+1
+11CE274A7474C6968F83E3495E9B814C3249C4C85510643F
+2089CC541F4DD4D092B781FEA151A0C3D72FDFC8B8442376
+07B207514EB83ABE30B210CBF3A3BF3341934E57FCF0D40E
+B00E6C90ABD818666F09618A1CFC550CF704102761C6BD01
+5F40577B3E1673423854AB682A73CB983A0C5CA0AC5D07CB
+0
+1
+1BC45B86C3A59907D56F0618B7D6F3F1E860EE7B113892A8
+3CCFBA74F9CE377F184D37592BF89D118A1FA7AF911DA426
+32CF3462C11C61DFEE4FBFDE6900B2D003FB55AA4CA7C440
+C86759AF9C376D242813B3E8E80910B8485E0D4390CFD938
+602EEB60ADE1282DF9AB772CF93DB0996C0CB4E4400F10FF
+0
+1
+52205EB3104B9161FA19671D38733DDCFA9766450D452ABD
+12B39829F9CCF5B5FBAD48D6CEDD88B41D082F39E709A232
+C6B8EB1AD53971E1638E93FB5E9342A5CB619359B4AA8441
+337AEA4ED82D8BCB2F1038D1DA75E4A2D86BAE80EB423977
+C4FCB12CA7FFBBDD84F6DBC8583B12683F2F5CCF18535B35
+0
+1
+FDE4F6174A17775D1DC7369AA7A2FC17D6C8A82E435443E4
+CA425D8DFCE3359CC93449A92BE5822D6AA7E75E53199FD9
+0456D93D48F09C3A6CFA74D5DBFF939F987DE6D23D0D67EC
+3D97A9C803DB836C7C44EF90C579E1CCD404A7F0E661226A
+74338DE3506A3D182E6F2544CA36B1FF23AB8FD6032D4DE6
+0
+1
+ECE998EBB1A9B8A53A37436AA4DE44425B2614F4C37BEAA2
+836DDD201FDBCC8DF98591206457DAFE079F815441313661
+1EFC18AD4F7264EFEE2AE926ED804CD0AC4848F91E3F442C
+7946146D7EC7E84E6C964FCBAE4460FFDADB0F9F791AE05E
+95EF4B72CEE38378562CEBAE30A98704BCB78C9989005060
+0
+1
+9E6149828098BE94A892301C46BC479D5DCC62654A7BABFC
+08A77CDA841EA13D6C9A2EFE057830201D07456D00F3C266
+60C18C6602BF5519A132A3B64132FC78211A474020596684
+685FA3B7FA541A7837116F85D5E0458E72EB128966098C46
+B7A90A36C256F8C4C809CF0035FAFA63C168F89697DE65E5
+0
+1
+366B0ED86F2CBC2D6192FBF43BD223138C86D4297B44DECB
+9D67C943D5791AF22818E79A308CB0AB17FC52F52CF38B4A
+2BEBFF70091E532704638C87E18D226E6E369B083CF9B4B5
+C055F072099DE1845A30E868D858A7CFE79CA6FA4A4B8A76
+D844112F847B3B5B5995A6559B32721B010040C308844BAD
+0
+1
+8DB920A56CFCC51D5BBCCC64A795B1D2742555DE1ECC8DE1
+5585DE8C7191E49C38CE8E60238F774772FD512A3F167A75
+E674FAE0CFEE9F32B456253FDA71B5DE21524D465F4CBA42
+BDB2A77F69F5D0D9B6F59E373428E634ABE4B3B61FF8D4FC
+DC807F616B201C1BC20653E52D4B8C623B826CF0997DEADF
+0
+1
+AA89226288D885DC93F1EABFFF4A80E7CD2AAD4FCC53D135
+56673F46117E01C642F976F9D29843C979C57CA64E8B0F45
+BCAC7C8771B383BBC7AA12E2AEBCA04E5A5CB36E6A4F43C3
+C81BD3367F3F9ACA0AF4AAE14ADE7E21E2591DE713BD1CCC
+4E58764E94E80A89BC2EB26E91A86AB2AAC3FB55AAFCC2F9
+0
+1
+1FF162C20CE41580330DE5636434A9620305106BB7F24DB8
+149D737C44F422C4ABFAB3AA55E1647D2E44146C66CACCEA
+35AB91840812523CBA6C260E444C55C5E7AD339A5666BA1B
+B0E645673CB8C8C15090AF9C8B7CA7C8D338B47F46C92D47
+1347E9AED43BA15D64B9A714194332607F4CB9CF57104AF1
+0
+1
+BD594D19C8574F951DF591495257923B926260A329099764
+DAAB07F7456DE4CC22ED6E16052903C9EAC87F36DF1A02A4
+20B6FADB641FB9F709D7B033FC1367EB6F2E32F6CB600A2A
+09C45909F072E086FF6D459B5223F92A2EA24D9992DF6A1E
+E672523B34D55FA6574C1B5777DC81A5A98DBF8570881259
+0
+1
+90F6E3C694C29F6CB6CF13B252BF43687903EF58CA97F89D
+C4306A17A034B4775BE1AF50360E47A043DA0D4C3ED10343
+288C0AC7BEB707C8162DD55DBDC5E420F70B94288F72F9D0
+1AE350B2C7FECA62F2BC70D8B783CF49BD22137CE37D4AFE
+3D1EA2F9CC82E274C8E87C222505C1D1E5F38FEF7CBFAF4E
+0
+1
+1DE6AFA22C7164382CA2D55CCFD35E36FE729155006BA479
+DB6B7C2DB8E4381DB8E8943F5CB359B186F5FB3EF89E390D
+9A6EB4581F822ACADD74C87BA70DD0E1F7FAA0506C315E27
+EC8AFB5A8676367010A476CD167A93D9BA34A45D1AE0C0A7
+8B2A489C4D924FFE551DA890492F94FD4B54115A200C4EEA
+0
+1
+71A9E0BDF32827E67273F946116AF1DF9995350FAD505C0F
+3E5366E09F4798106B140B4854624CBE03F87831CA3803A1
+28983A4B11CD0FC3F1142DCD9F6FC8836A4A2D9CAFB23F2B
+D9596D548891362D1ED0630FD5922496C3FF29D4D56F6511
+36ED817FE7EFCDCD58A5A0E86E5819C08A90D8653E43FC1E
+0
+1
+227BD75DEED197B8FD9DC8C49FEB664281893577CD75F7E8
+AB07B02EDB2B1D3CC4A68251C2DEEE366E4752F648BE909F
+F2C9D594D415C656863072871A7AAD54F25158E223687141
+DB63A0555158D7C1F5F2464458367DE08161894A5BA4BB04
+02C823F37B46DFA30ADAF9B6F56A1C46269C56A6D934B383
+0
+1
+539F823CA1C31023DFBA49D86A62FB009D25FCDAA454750C
+A8D08C60C6B3EAA1FA264D3BA63CC075E00D30EF56E7F531
+65FBA52449BFCE15F1A814B40ED67C253EB635B5B79E434B
+F247BFB485B3A55DF8A0974262BF08AA63FF1D75DCFA50C6
+1DC1B726241883F36274A16043880D3F987D5D0013A7CF6F
+0
+1
+879EA30F264BAD2578BF39721AB843C72F820EC55ACC9820
+321B1005B525B14D0E747C38C8E04BFC1383C42BECBFF62B
+2FA25DDFBDA593B9411AEC14BD1BDAF80F19F5EACE3BFF6A
+29BDE3722F91B1AFC9CE7B38C6E9F6852A0C143F6EEBAB31
+9EE2249A5E36F53C6339EBCBDD6F3944B94AE32CBB6EB9A9
+0
+1
+CCBA447BF81C76F0EE82232DF94EEE32C5B11897960F535E
+4F59D29B92868A82515DAF5325BDDFA44E68A7634B0118BC
+9535B8C84C5795AFE8790DDE02C778DE8124792609015B8C
+E6D6BA7DDCA963971E2B14FFAD03D3E933DCB836917447FE
+4DADE5E162816BF2A0F21D9A1C8ED1F100A55736256822D0
+0
+1
+19EC9C7A22859087C96B483C8AF43A3E0E2A54144D998F3E
+B5CD098F67BE3BE8F3F1F841D7E5F8E566CFF7E9466CB736
+A228EAC65CF3673363C0C2089E295B169D14A59BE64AA8D1
+1A95AE619E5B9EA5379291D0FBED04531386390AD8EBE8A5
+6ACE2B08BE6E94CE0264D262BDADF9A9E2515B0AD4105429
+0
+1
+3F4FB884CC4E66E48C8DF5F1F3DA5070EC8FDD6138F5E15E
+EE408449ACA573A03DC75FAA09BCCCE36575A1C6F2429F11
+CAA308C8E1324306BFAD45437CBDCCF6A21EA3F0739FFBE9
+22A72BD77089CCE1B9C12A2879F18DD3DE15784334B9A8BB
+6F4C9187C33CF6E761BC4994D35BE12D90D88F112A1253E6
+0
+1
+A8D96D6E010F17298E41DD802D79668DB4AF5A3CEBBA7803
+B3EEA6427A3CE883A107382A39FD1C499F9A6144ED21035A
+E84909097DCB7D8BCE4C8CB5DF8F9C47CED935EB28B6F60C
+53080974EDC570B896337538F2674BEAA2B8A4E5188BA526
+658AADE8399AE36A1B24FC8964A028AB2AACC5DEEF4FB7D7
+0
+1
+4C1F71517656A8A45D956E6D1C85247EA3293DA4A3D60F8A
+91EC7496664EB9DDA2BEFD3539ACBF52A910AA5F833CA835
+0A8F1439FCEA2C897EB00ADEF88E37FF127DC88DB2AC0578
+544C2C0D0C220E2A4E8D92AEDD0104B9A0C0F6D140D383BB
+9760FF110563544C039E084F40064C3E54595341F6D2C7CA
+0
+1
+33
+eckeygen_batch 528
+1
+eckeygen_batch 529
+16
+eckeygen_batch 530
+17
+eckeygen_batch 531
+40
+ecdh_phase_two_with_key 532
+DB2116C480018693D54AD2E6D16CF576EF921887999C0886
+DAFE1F7A17E51EBF0CE943E1D048AD74D41E12E66EB1007C
+0
+921F54D17423C60D8DBB5B2A6E20AF8E1001A6625A1298A2
+29850E041A5D2C7196ADD60423932A4B2514B3BEA7DF11FD
+AFB50BD242A9FA2AB90DFF944277DB662340E8CCC8AAFBFD
+0
+1
+ecdh_phase_two_with_key 533
+024F47352EBB7597A890C07C65CF482D1E40110DA5316D71
+860667FD94CD12F3AED35CE0A2FB6129D838269C712CABE5
+0
+F515F5FB060E9290A89BC4466B24F3EDCB8A8A870A78FE61
+EFC2A41C7FD352C020A1EC67D663C25AA1C44BFF05546410
+264FFAB6E02BDFDDF993CE26C648BE0FD95E35079204EAAA
+0
+1
+ecdh_phase_two_with_key 534
+542EE0692F84A5600899FAA89536B5C1D0CD06D317CF4A79
+B8CC00B2B51316D2BEDD293AE9B7E1AE0C090882B6E6132C
+0
+D0D27379EADAF9430256B88B8BF3BAEBB94EBA887B470AF2
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+0
+ecdh_phase_two_with_key 535
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+3DF6E978F52FFF01713565335BECCE238392680F85F4FF10
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+0
+ecdh_phase_two_with_key 536
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFF
+2660384D90EDAEB2124D4C39FE96C83A6568CE9A3BA71C72
+0
+322BF678C30BC4BE9339F45D8ECB5AA85787A91399D9898E
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+0
+ecdsa_sign_with_key 537
+18DB752340B9C361D01FD6988A45D9E2822053BA62323684
+940EE15A5CE2FE0A19130F23557C4F422020BDAB09080A3B
+B33A115D798764C45FB73BB293BC40F0ACBC9D82E2678C4E
+3A11089FCCA1681F23D8D7FCA885924C066EDFA528B9D453
+0
+1
+ecdsa_sign_with_key 538
+1C32822DBE82838678956FC737F3262855B950BBD87AEB24
+B2FF502CED50C8483A19E7FEE190892FDF37CC15A6184FF6
+4C36CA45D1474939C050E6BA9F3F40FB71A3A4C063664A9E
+303F0874585A03ECE60B0BAC5EE128F2B8A63DDB81D8B461
+0
+1
+ecdsa_sign_with_key 539
+CF220EAC3D2DFCABCF59AAEBC5DF20D4E10FF4F8494C283B
+DF5266FCACC345735A616B969ACAAE636AAA3F2BC5E83912
+31CC7FA68CD4762B6CD387358361AA9E8BE736E3D35C9586
+EFA3C4997473022CEAE5E6E6C7293A14BFCAAD67EAFD6FBF
+0
+1
+ecdsa_is_valid_with_key 540
+DDAAFE3B7A710272733F573FA41F9347F63875F03AACF65F
+5E31D0FE3236409309EBC2122743F121653AC503032E4525
+653E09D4C79814D5900F9B9E4FECC6507BE3E32E0A44A2D0
+41877087C510B84F52C14EA61471F41803DE836926B90ABF
+39BE5D11F7FF0E04E0E0319D05E181DEC2A4D4EC2FB7F1D6
+0
+1
+1
+ecdsa_is_valid_with_key 541
+2476B33B463AEFD3416EADE50F4AEF1DB41125441DC0D2BA
+779066F15EACDFA58BF9A0C65B62F19AD0A4FBF87A8D39E9
+ECFEC3D1FC40F9CC9A804AEDF65C25B140CDB2C67C43186C
+047C364A8E7452313289C81C87623A23DE25040420116A98
+4E8732BBBA6D9ED77BB13544FAF080492E7294A7814368B5
+0
+1
+1
+ecdsa_is_valid_with_key 542
+0EE36724A72D2F6A2A7EC32FB2635C1BFFD669906E848AB9
+F4F5DF55602044ADB796BB871FB78C9B25792EA8F29DD556
+79FC91FE8BFF50919F5D0EA9D00A3DE282E0497C44082FF0
+C73A78307D4F3C69556CC68CE170FB8026503F94960D7BA4
+7FFC4729805F4F67C46D423F26B5B7DFC08638DF476DEC31
+0
+1
+0
+ecdsa_is_valid_with_key 543
+C876CF90263A193BDB2BCDDB2D7661D2D52C42E163AF7CE0
+43FCE73D053EC078984F554FDB91E3CBC417B7583C065F90
+EA1790C278C88AB0E8D4A421AC927D39F18F62CA8457E970
+CA9B73BE84765F7CBFABFA07A4D1904BAD34806C12EE0702
+A99014049CEA10127B64573087DAB6271759161F5CCA8113
+0
+0
+0
+ecdsa_is_valid_with_key 544
+000000000000000000000000000000000000000000000000
+58AADBA4CF22D9CDCC5600F866A9FA00EFB263C8B80ABCD2
+2F1BAC51B1191146DDE79A18F5493428FBCBFBCDFE697C1D
+4460A9773C68F67ECC7268416E66EF2BBF0C253DC2EDB097
+F8E3558C5D7BB18776751A31DA903E446039DF921CD9E424
+0
+1
+0
+ecdsa_is_valid_with_key 545
+AD243484637D6DC28E4D3130F53AD1932E34D31697C44E7D
+179FC4C77A392E07460DA5D65799807EDE97590BD4262DD7
+A71274DA001D9D9C71A4C8F3445146A91BAB77EF6471BF41
+CAC51B87EFB70BD87DECC107107AECDA053A0F97C2F2141D
+3ED0018CADAE37B98D9BC86B2E5E6698B4435C3B2D9BEA3D
+0
+1
+0
+ecdsa_is_valid_with_key 546
+6A65D5C118D18700B9F693EE821FE6378FEC2F4E662C29F1
+4F4669FFB0012D17F52F063DAE82B788A51ADDB141055BB3
+B1EDD11D028E87CF913CFF58904873EC741E8AE1873D05D9
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
+0
+0
+ecdh_phase_two 547
+C23C1F9A3638225064AF86A08CCA0288DD58687A06662558
+5081406A8CF2BAF89E5EF1ED31F61E3E903198727E241315
+0
+EBB3B769142EDE0B6A0ADE10DF7165741EC27E9BBD3329EB
+000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000
+1
 exit
@@ -5282,4 +5282,1134 @@ CE34E4879337300772FB0D0CD2CBB57402B43126AD3DF34A15B21993
 F8F8FA5EED1F1EF3FB6BD9CB61FF7782A6AC40FD7FFE756C3294BD15
 0
 0
+eccp_comb_precompute 705
+4
+1
+eccp_comb_point_multiply 706
+00000000000000000000000000000000000000000000000000000001
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+BD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34
+0
+eccp_comb_point_multiply 707
+00000000000000000000000000000000000000000000000000000002
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+1C2B76A7BC25E7702A704FA986892849FCA629487ACF3709D2E4E8BB
+0
+eccp_comb_point_multiply 708
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+42C89C774A08DC04B3DD201932BC8A5EA5F8B89BBB2A7E667AFF81CD
+0
+eccp_comb_point_multiply 709
+4ED3977B10A2CA466A72A73A931D1D0B92F6A828E3C1921458AAE16D
+07CFC9CD969FA6DF8AB1B37F06FCD6EE46BE77A3918EAB83E719809A
+D863748FE069781FFAFF47CD5138D66AB80C09F8E95C3881A91F8E25
+0
+eccp_comb_point_multiply 710
+033F61055A4AF4A677B5ACF2D0D8533DDF57A59B700C2030FF225DEA
+B1195733D648EEFA69D7F90B74DB7DF15386F69807DA55AAE8034637
+C1B3685A46B548B2893E49B6E04E2B528AB14B30D6D501A1D2DA9FE3
+0
+eccp_comb_point_multiply 711
+5B7E554C7BA6718A2D7E4D5A43F17DCCC80C1AE8282FCF215C661E06
+C31C97C56DEE8794FCB0EF3C1A9A31887CEBBBE7F268AEEF969625A2
+6BF251642EFE186C623D6888382B55B37FBF53B8F8AE775E0C14CD70
+0
+eccp_comb_precompute 712
+4
+2
+eccp_comb_point_multiply 713
+00000000000000000000000000000000000000000000000000000001
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+BD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34
+0
+eccp_comb_point_multiply 714
+00000000000000000000000000000000000000000000000000000002
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+1C2B76A7BC25E7702A704FA986892849FCA629487ACF3709D2E4E8BB
+0
+eccp_comb_point_multiply 715
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+42C89C774A08DC04B3DD201932BC8A5EA5F8B89BBB2A7E667AFF81CD
+0
+eccp_comb_point_multiply 716
+353C89292B8236053FCE7EDE84712F8B0FBD2DA884367925E0F778BD
+25C3C7F0479683637FD4C0E409BB0FEF76ABEE51A025412FEC34D299
+C915CC05CDCDDC6087DFF9A529DBAD62D8BBC3D2B41367D20C391D3A
+0
+eccp_comb_point_multiply 717
+569F3C8555A7985717691E648E4357417D38035ABC302211C3B1B4D3
+AA5A1B1351161ACED9C4D391EFBF09047658E8D11299F40BF0AACBF7
+A3A6F03DBD1419DA3B241A7C6535AEB4FF71DE1BB8DD36A93EFB3DBD
+0
+eccp_comb_point_multiply 718
+4D4DADEC1D4386FBA2CE3E7857FF4F7664A0E7270EA49CBAC3847089
+5124F3374F31E80599FDD59C80E5851DB9443AD6305A60B92E93C87F
+E7A8927C89C19EBF57C26684AE80C8608E0234DFB98B2133974F9C60
+0
+eccp_comb_precompute 719
+5
+3
+eccp_comb_point_multiply 720
+00000000000000000000000000000000000000000000000000000001
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+BD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34
+0
+eccp_comb_point_multiply 721
+00000000000000000000000000000000000000000000000000000002
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+1C2B76A7BC25E7702A704FA986892849FCA629487ACF3709D2E4E8BB
+0
+eccp_comb_point_multiply 722
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+42C89C774A08DC04B3DD201932BC8A5EA5F8B89BBB2A7E667AFF81CD
+0
+eccp_comb_point_multiply 723
+4CC0F70415183E13B085BEC8B201DAAF8E4FA7C5CBDACBC7411D2F51
+058FE8594AFCDDC52A889006EA009D46A47B94AB0C3E0202ADD76896
+1ED2B04AB8F75CA0BC931BCC539B52F22368AE8A8DF298036648376E
+0
+eccp_comb_point_multiply 724
+05C2026895FA45981E0AD7C88362532648E6646E76A4ECA974E26321
+09973D06A3BB5EBC7E28C5A4B3538EA4F459DE511355915632F6D668
+F6F83F551A76901DA0C28A0D8EC2B17A87E317DE91D06A01C323543F
+0
+eccp_comb_point_multiply 725
+8DE4B92B7A467BE5C5FB78CBE2743DA23773198348F3AFBCE82D995F
+5C913BF01DBBD232FDF0F18AC530ABA8691C6003BDE138CB199356AA
+28B1C63488C573C73D80E8601FD5E2C9CD40AA27E7A15BE79C4F1839
+0
+eccp_comb_precompute 726
+6
+4
+eccp_comb_point_multiply 727
+00000000000000000000000000000000000000000000000000000001
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+BD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34
+0
+eccp_comb_point_multiply 728
+00000000000000000000000000000000000000000000000000000002
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+1C2B76A7BC25E7702A704FA986892849FCA629487ACF3709D2E4E8BB
+0
+eccp_comb_point_multiply 729
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+42C89C774A08DC04B3DD201932BC8A5EA5F8B89BBB2A7E667AFF81CD
+0
+eccp_comb_point_multiply 730
+97B026E300FEE5831EF565A2AF63720DF7F5575AE5000A028AE94A14
+79F1E2D7FAF4F4C47AC7278F47D1B806007BAC531637DAB6B2DACA84
+09751869D9913DAF3CDB883D72B39D7C4F44DD0FB9D6C865F8152BDE
+0
+eccp_comb_point_multiply 731
+9D3C2F3DB31828414BD12FF6308C5CECCC11686D5F757D640EB827B6
+A0E6648E69BE9DD083F1FB9E21F02CC838AC91598312A36ACC411DEE
+578B933D9B29A1EA277B37F1E5BF735BF1FEECAC976D51E41D80B62D
+0
+eccp_comb_point_multiply 732
+BEF96CF6691FEA176C43B24A8FE9488C08389A3218DB54ACDAE383EA
+E85F5C4D535BA6FD9FDE08D53A4563A59F861894A22A8DC3DFCA3818
+ACB8AE2A4B0F8CF3441ED9FC251BCB5D00D7997E18D48A4FA14F9D08
+0
+eccp_comb_precompute 733
+3
+4
+eccp_comb_point_multiply 734
+00000000000000000000000000000000000000000000000000000001
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+BD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34
+0
+eccp_comb_point_multiply 735
+00000000000000000000000000000000000000000000000000000002
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+1C2B76A7BC25E7702A704FA986892849FCA629487ACF3709D2E4E8BB
+0
+eccp_comb_point_multiply 736
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+42C89C774A08DC04B3DD201932BC8A5EA5F8B89BBB2A7E667AFF81CD
+0
+eccp_comb_point_multiply 737
+D80EC07DF585A110E54EA8692E42C61300E35CF1BC8F3B5275E9A21D
+2F4F2EC2BD391473B34C0BBA7243A6FC2D2FAFA40ADF137838FA94C0
+7100EAA06D00C0FFF52ADE88E7159EBD0FC65DE09B584646A3620335
+0
+eccp_comb_point_multiply 738
+618797153A1382B230B12A0F9EF8EF5C03B80ECFBDFCCE515A0A9C80
+A5DE26867A79328C4513B829DFEBD04530358A227217D0765871132F
+AC95F378D7A068D92219C39B02EAFB31C221AC1C3D66E07EA8F19573
+0
+eccp_comb_point_multiply 739
+62397E73D4BDFC425450A570BF17B364D680B2EDFD79F304311AD97B
+496053DFFA412259A754A9D89DE9DD4EA25AB7311FCD522332142A2D
+6A323FB49F40E7600E80AE1CE65EEE4B51DD44F7E5391A8791DF8E29
+0
+eccp_comb_attach_const_table 740
+4
+eccp_comb_point_multiply 741
+00000000000000000000000000000000000000000000000000000001
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+BD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34
+0
+eccp_comb_point_multiply 742
+00000000000000000000000000000000000000000000000000000002
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+1C2B76A7BC25E7702A704FA986892849FCA629487ACF3709D2E4E8BB
+0
+eccp_comb_point_multiply 743
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+42C89C774A08DC04B3DD201932BC8A5EA5F8B89BBB2A7E667AFF81CD
+0
+eccp_comb_point_multiply 744
+B0C97126850CCA8981A6EFC3EED09383E76C8BE02D27F3132122DEC4
+62B148C24448AF7DE34287DA05BB85F0EA1A23AD8DE18B391C146514
+E07B40F4C98A7AF9AB322E7A665BEB37E260AF958479DB44AA97030A
+0
+eccp_comb_point_multiply 745
+EAE5512C3B88A2DD9CC55567454BC739CC1DF8D5A9871701B90EFD14
+603D7E905812127EA57BE4813F5CB9CD6EDCBBDADFB6E958511AD670
+81D4EA2AB3673E2ACF89B3E4D620ED4718073194F754F4B9936EFE2D
+0
+eccp_comb_attach_const_table 746
+6
+eccp_comb_point_multiply 747
+00000000000000000000000000000000000000000000000000000001
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+BD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34
+0
+eccp_comb_point_multiply 748
+00000000000000000000000000000000000000000000000000000002
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+1C2B76A7BC25E7702A704FA986892849FCA629487ACF3709D2E4E8BB
+0
+eccp_comb_point_multiply 749
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+42C89C774A08DC04B3DD201932BC8A5EA5F8B89BBB2A7E667AFF81CD
+0
+eccp_comb_point_multiply 750
+C563B1AAEF40E6A303634A7E3336BAB721A51A1D72EE378EADF10D4C
+BAA9D1C33CB8F02F5196BE6DBD2ACF6CE05B21144935CFE303F653C4
+8F3AC32DFD2FBF1047E7012F9C088C9D8FE60FA35980B5FCDE8AA767
+0
+eccp_comb_point_multiply 751
+889B1D83853514FE1422F51F4296C82EACF31B67A20EDE8D48C7FA1F
+4F709EF75B849322ABF6A5B803DBF698460C32E3D2AAA90A93EEA569
+F5B20113B342F8B756DD79FDF1AE0C245A6EFAA522462E3200541410
+0
+eccp_comb_attach_const_table 752
+5
+eccp_comb_point_multiply 753
+00000000000000000000000000000000000000000000000000000001
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+BD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34
+0
+eccp_comb_point_multiply 754
+00000000000000000000000000000000000000000000000000000002
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+1C2B76A7BC25E7702A704FA986892849FCA629487ACF3709D2E4E8BB
+0
+eccp_comb_point_multiply 755
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+42C89C774A08DC04B3DD201932BC8A5EA5F8B89BBB2A7E667AFF81CD
+0
+eccp_comb_point_multiply 756
+6AD0111A936DC2671FB29BCFB9C42BC947669AF5E9BA1C30E8F015E4
+28C660EFC0E5116DB826E43E9C7C74FBC6290BCB8DAE4588EE101D54
+464A584BC882E1A5F3100DC7EA41035A0360C09D0D6C6D7A6377FF3F
+0
+eccp_comb_point_multiply 757
+6DE80F370859E3A811B8817D5E3C4F8B33BDEFEA2AE3DD43E2D939FF
+417FB216CB2926E55454D6AA6A56180A466ED2F9CB4950212CDC9311
+32D3701D72D33BF7EFC8821233658D0C0697BC85F70ADC725D714D28
+0
+eccp_comb_table_file 758
+1
+5
+2
+eccp_comb_point_multiply 759
+00000000000000000000000000000000000000000000000000000001
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+BD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34
+0
+eccp_comb_point_multiply 760
+00000000000000000000000000000000000000000000000000000002
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+1C2B76A7BC25E7702A704FA986892849FCA629487ACF3709D2E4E8BB
+0
+eccp_comb_point_multiply 761
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+42C89C774A08DC04B3DD201932BC8A5EA5F8B89BBB2A7E667AFF81CD
+0
+eccp_comb_point_multiply 762
+6B6C02CE8AD217729B975338EADE4845544CEFD37F75B7E0FFAD6E8C
+6EB7428F6366E3B3A7A2D525D48DE525FCDA9C733EC42BD5BB1DA8C0
+777FF91409596695305E905DDB1F44FD031B483AA3541341782C8EE5
+0
+eccp_comb_point_multiply 763
+382DB6962BA1AE10FA227274727C311F33080F0EBAFF0221D609577F
+546D179354090C56ABAE1EA4855780AAF730C19679B660538151AB25
+EE5BF5056A75B077F02D1767128C0F1B654D371886F7F85B12EDFC51
+0
+eccp_comb_table_file 764
+2
+6
+1
+eccp_comb_point_multiply 765
+00000000000000000000000000000000000000000000000000000001
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+BD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34
+0
+eccp_comb_point_multiply 766
+00000000000000000000000000000000000000000000000000000002
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+1C2B76A7BC25E7702A704FA986892849FCA629487ACF3709D2E4E8BB
+0
+eccp_comb_point_multiply 767
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+42C89C774A08DC04B3DD201932BC8A5EA5F8B89BBB2A7E667AFF81CD
+0
+eccp_comb_point_multiply 768
+9006F9E9AF0C94B3CAEF8A22AC9D32B76876A0D1C8BCDBF86F14E6E3
+E2463E486E44C4B07F60A6F2B74FCB5A1158A8EDCB17B69D33A45EB3
+7BBE00F8299FAB65D6B91415804FEF81CDA6A5211548F7D31FDE0178
+0
+eccp_comb_point_multiply 769
+473D0AB84C6254C06C24691DAC811EAF8B2B590932475ABE86040891
+10243E3020BA889E4B5EA7E09AE1EC13630EFB99EE9D5439530E549C
+B55532B37A03C2BC95F2C03481E72D8D0A30E6CE1CC6BB91F28056E1
+0
+eccp_comb_table_file 770
+2
+5
+1
+eccp_comb_cr_point_multiply 771
+00000000000000000000000000000000000000000000000000000001
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+BD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34
+0
+eccp_comb_cr_point_multiply 772
+00000000000000000000000000000000000000000000000000000002
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+1C2B76A7BC25E7702A704FA986892849FCA629487ACF3709D2E4E8BB
+0
+eccp_comb_cr_point_multiply 773
+00000000000000000000000000000000000000000000000000000003
+DF1B1D66A551D0D31EFF822558B9D2CC75C2180279FE0D08FD896D04
+A3F7F03CADD0BE444C0AA56830130DDF77D317344E1AF3591981A925
+0
+eccp_comb_cr_point_multiply 774
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+42C89C774A08DC04B3DD201932BC8A5EA5F8B89BBB2A7E667AFF81CD
+0
+eccp_comb_cr_point_multiply 775
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3B
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+E3D4895843DA188FD58FB0567976D7B50359D6B78530C8F62D1B1746
+0
+eccp_comb_cr_point_multiply 776
+D44FF2E2211CC5A64F27576FEF09FCB87E944D699D0BF2411C9BA62B
+3253D3CF7DABF3504ABF561A825318214668113C84A0E1736512C0B3
+BDF653168B49D24B46CA11D825639626C3E32E5E4DA0D55903A7F444
+0
+eccp_comb_cr_point_multiply 777
+236A20591491532C81CA906740850C914FCD2BF5E0881E164F01E6CF
+A3D1AD461545EEF6443C59B61396647C5BE018E3253309123DC5E40C
+FFCBCE1E3DB0EA92E4A20B415D3B8B82C2A04DC7C222BAF8A2ED2708
+0
+eccp_comb_cr_point_multiply 778
+68E3D0FF075BC9D4C506CD391E579345508A9BFBB30ACA6A3E43E750
+7381D968D7B40679E21685484FAB59301C1AC0238B27B2C62A740F5B
+0C6FFA2B9E82FE17EDE2CAD4057BB40EC9364E4547FEE231BB02FC68
+0
+eccp_comb_cr_point_multiply 779
+A49FC06D8613FCCC2DD8E2984D0B5DEA817B0C43BFF96BFFEA995022
+90018D8B58C3792A82ECE3A30550D103F7D9534527600379AF1A92B1
+187800290F73EB9B1A78704202F4AC3E6F9DCC708BC362EAE3D54827
+0
+eccp_comb_cr_point_multiply 780
+DCD76E4C738614C3835AD74554CC5B4DA537E7FA78D6908A2FB5DBAB
+23C568555D3E7DE9225A20E515D2AB806F95128542C23F1AD7C556C6
+53605A0D1810C42C1ADAF99CDC0BBCD2701F86E5D4FCF5D681A09C0B
+0
+eccp_comb_table_file 781
+2
+3
+1
+eccp_comb_cr_point_multiply 782
+00000000000000000000000000000000000000000000000000000001
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+BD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34
+0
+eccp_comb_cr_point_multiply 783
+00000000000000000000000000000000000000000000000000000002
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+1C2B76A7BC25E7702A704FA986892849FCA629487ACF3709D2E4E8BB
+0
+eccp_comb_cr_point_multiply 784
+00000000000000000000000000000000000000000000000000000003
+DF1B1D66A551D0D31EFF822558B9D2CC75C2180279FE0D08FD896D04
+A3F7F03CADD0BE444C0AA56830130DDF77D317344E1AF3591981A925
+0
+eccp_comb_cr_point_multiply 785
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+42C89C774A08DC04B3DD201932BC8A5EA5F8B89BBB2A7E667AFF81CD
+0
+eccp_comb_cr_point_multiply 786
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3B
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+E3D4895843DA188FD58FB0567976D7B50359D6B78530C8F62D1B1746
+0
+eccp_comb_cr_point_multiply 787
+052DD219117932D956706666851FEDB0550E6AB8F2CE75D4A8314725
+F561DE7A91DD060AA2C1E7D98B3E0322EE305B777E499755DE3D892C
+7B854026ADF5444FD851F8B55B4C2E7C95AAC2B6E29E3496559966D0
+0
+eccp_comb_cr_point_multiply 788
+7C5398BBE0CBC7B87968B2601A4C0377F1E1491FA7F4B3D2EFF100A5
+B5C5B41011C74035CED261AE47DACACD6B96AECA6EA006657A409100
+BE1FEBF2497D3DAA7C585128CA60A4235DA20884CDA91F3F04C615B1
+0
+eccp_comb_cr_point_multiply 789
+E4F4D183416EEBB394A2033540F06F637A962E3DEEBA9E7D42F400B1
+71E470D67C2D12F165A1BF04BCE5168EB946C8643C0FB3DFC0BD3CCF
+3325B2A37A27D22A08C1C0F09994C2798CB246AEE0D2BFCC55C1BFBF
+0
+eccp_comb_cr_point_multiply 790
+D3F88AFF2F6AB668AFA198482B83F032ACCB58EAE0A831A2B1FA91F1
+218B562E02E587DAF52F91AFD92BE3AF3512CDE88EE1D011E6ABADD7
+66F4AF90802C3C0F24B937FBDA06FD0A8E7EFC6D004C9AD1D83B81A0
+0
+eccp_comb_cr_point_multiply 791
+EF4B4FBE39BAD457AA5917F46B8E894548EA21F3832DE0402FDB783B
+7A14CF950C2BA22B08E08963CF3BC125A1000F854A46A1F17261CD13
+734394FC81C2F4F80BC340A88E1E1349F0C1DD79A9FFBE95690495DD
+0
+eccp_comb_table_detach 829
+eccp_affine_point_pack 792
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+eccp_affine_point_pack 793
+7EAED9DD960F9190DD30AD61DC5A7960922C4F2659937B40A199F0E7
+8E5B4F1F475023D8BFB720B2EEF1F7C060BAE51514B4293F1DE372E0
+0
+eccp_affine_point_pack 794
+9D69D80E2EAA9ABAACA36A8EAAB0278A46680F62D6976E8493733954
+FF2E949EA6A752DDBAF988383B61BA700EA5305140D01581EA995E9E
+0
+eccp_affine_point_pack 795
+663743F9735D64A26433F40C832583FBFD73C3CDEDD0A0805BA346B4
+EE6253C74C3E89DF4FE5B6B3C7D33A8F1FF2FAA255DFAFA568F77880
+0
+eccp_affine_point_pack 796
+744B222468CC83A38D07B7E5B34FECDB8D7FE5998AD30771F877B6B7
+BD1EDC8A232C9CC57DD77CFF7D42DE6349ECF3EFDBDCA773E2288C60
+0
+eccp_comb_precompute 797
+4
+1
+eccp_comb_pack_table 798
+eccp_comb_point_multiply 799
+00000000000000000000000000000000000000000000000000000001
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+BD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34
+0
+eccp_comb_point_multiply 800
+00000000000000000000000000000000000000000000000000000002
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+1C2B76A7BC25E7702A704FA986892849FCA629487ACF3709D2E4E8BB
+0
+eccp_comb_point_multiply 801
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+42C89C774A08DC04B3DD201932BC8A5EA5F8B89BBB2A7E667AFF81CD
+0
+eccp_comb_point_multiply 802
+656B23439267EE4455977CFD4B1A82E65604C11C436DF2EC0A9A1238
+D81D081BCE72D782BBBDB17F3D52CA627678436F9B2883590A7CCC0C
+5F319BA422BA42BBD053C23884933483B495983D799193AE39EBDC23
+0
+eccp_comb_point_multiply 803
+36916CE9F6194BFC50FE0E25D60F72B3A6981214A5924CE97B58D109
+B7DD057479A19A6E0FA2A5166A37BCC5F1A009220FC730CCA5E276C2
+43F099947B1F27FB54AF2A889A81BA0715E6A6B36B12894F6AF66EB2
+0
+eccp_comb_point_multiply 804
+4E6A8985C5C154F7CA33737E18660554FE5669A6BFCFB041F9F75E11
+FE61351421E63CD550D947CA43F466633739DB32533C56E3D5E1920D
+28964BA8F1B877AF067F987C6E4D432EC5E3A030F95771FB0F7A5F3D
+0
+eccp_comb_precompute 805
+5
+3
+eccp_comb_pack_table 806
+eccp_comb_point_multiply 807
+00000000000000000000000000000000000000000000000000000001
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+BD376388B5F723FB4C22DFE6CD4375A05A07476444D5819985007E34
+0
+eccp_comb_point_multiply 808
+00000000000000000000000000000000000000000000000000000002
+706A46DC76DCB76798E60E6D89474788D16DC18032D268FD1A704FA6
+1C2B76A7BC25E7702A704FA986892849FCA629487ACF3709D2E4E8BB
+0
+eccp_comb_point_multiply 809
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+B70E0CBD6BB4BF7F321390B94A03C1D356C21122343280D6115C1D21
+42C89C774A08DC04B3DD201932BC8A5EA5F8B89BBB2A7E667AFF81CD
+0
+eccp_comb_point_multiply 810
+D69B3B318BBAC7A5EF9B39D69FAE32AD8F54B2282D21DFA4E57C6F3D
+5FD0E287A964D83858D28C59A530A0BC298A349D9D9F63480BC17449
+085AA0DA7AC639CFCCB583D2DF069657E393B10B97A53C1E1CB97317
+0
+eccp_comb_point_multiply 811
+EBC7C729075CA9BA315AC1072C6FAC4C17F12D1B4B8A63D6ACAD0428
+4A8A6730DC4421FDB2B8433B2BA10B943013C28098455FD43422A811
+5F42161F8BBC28F6B19114D17F9B8B5CB7AEC3CD365F87B9D1A5A3C2
+0
+eccp_comb_point_multiply 812
+AB692A5F187C343BF4FF7C4DB2039A255FEE655399F4AA30CB3C6940
+84A2CD8CA5F644896DA8DB8DD63DB01DB8FC8605810879B4260BDE96
+3A785E1F10F5E8E60BEA2ADBD51C4917A94E56AEFAA263FD34535CD6
+0
+eccp_batch_add 813
+5
+3EC8CAE233FD962A08D8840DF2D71FCEC7D5B062993E5F531DFC8ABF
+E39DD651CA007FF89180FF5B7063EE2CA361195BFB466890119F41EB
+0
+9A79143A3FA9449EF88950910BB1CB944FC2B4EA5FE4AEE5E234B53D
+BBA920D2538AC3076F72853056FDB86247D6F3362888793C90E95BF0
+0
+A111035874BFDA55932B532611E4ECBAB463A5A7712F628169061BD7
+2CDDB812ED8749C0711FE2431BB0233461E3C96A4746FF7E3C45A8CE
+0
+AD9F1A4066C56EE7861C6803416389579CFACF1BAEF0B03CEFB56A81
+BBB90A6374F890AD00E46FDFF3A712C86B211413BCB9468F190898BD
+0
+AD9F1A4066C56EE7861C6803416389579CFACF1BAEF0B03CEFB56A81
+4446F59C8B076F52FF1B90200C58ED3694DEEBEC4346B970E6F76744
+0
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+6255761DAC20A22D3102BC1FEFB75546197C3B03B0357C913C78DCE8
+8DD4C8701D77D066FE60C3F5C5D964F9824BEEB302E377790C7AAA5D
+0
+6255761DAC20A22D3102BC1FEFB75546197C3B03B0357C913C78DCE8
+8DD4C8701D77D066FE60C3F5C5D964F9824BEEB302E377790C7AAA5D
+0
+A3AA49498F31881EA1490B9324CB30506FB47D091A623A20A6DDF5BA
+390874B30352FF76ADC08C19269E094A7AA79446119C309FA787617E
+0
+A3AA49498F31881EA1490B9324CB30506FB47D091A623A20A6DDF5BA
+390874B30352FF76ADC08C19269E094A7AA79446119C309FA787617E
+0
+A436F3A7FDD795769974035D87C46382529B6E7C74DB9D8A57089E4D
+AA56AF40F1754130BF65E97BE77811E413A4BC76906BA2A079D2D89E
+0
+F0D38FC1058488C316EB7DD3A1052F7A5C31FC78F5109CDD534753C2
+418EC6B741D7CDF2EE5255637E925C27E584E8B6AC3D06A9DFF4F383
+0
+15E4417A7960B4653C667EECC0F6175DBB4B676796AFDD1611B29522
+1EC3222E6D5C41BBF084D4CF36BA034051F805094722C7B44C300FC6
+0
+B7D4A77F7415AB3F44CBB81825DBD650F077AA4BBCD14DF801475C16
+D52C960AD71DDD4C0DD89B655DC1CC9E663BDB2F596EF29166FF36E2
+0
+eccp_batch_double 814
+5
+6D734A57D9ACF8552F2A88FBCDFE6D7B8ACB44335EF086069ED931CF
+E8F6E1D535E8E789629550883CE2B7F95A2E6EF9D2812E25CBA52535
+0
+592A3129BD1CB78120C58217F19DA9A0F021027ABDBD7220C60C5E07
+1FBC101096E39D38972A37BE34819249C16C7339F58AF0BE79A2F918
+0
+5DCC82D95EF88339A44D3ABD8DAA19618D0501886B3CD234DB07A19E
+56B7A6FBE44E9A226FAFC6FFD0909C705913059F5E842B88F7E5456C
+0
+DC9EB88B66B2A5997453137F0014F93D6AE570153714FEFBB3B25542
+5DD78092A2E081C8C7EC821B2E1E80DA2246EFE97E4F7E71F5331FBA
+0
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+9CB4B378F5025975E290C7391850053F7A5C53461A60F89AF29A087F
+2C0BCCCA6B6927B79730F9A0C9A680D73BC5A993E4D6B9C927AC157D
+0
+8C458F99E00AF22442CE48BC813336EAE2BB83FD33097A378ADB26DF
+ACA510C08E16147400419747ABED2F0E93673E71C75BE9BDDC85AEA3
+0
+FD0661BB164BA1618C515ED8FC549388FD79993DBB406B00D61D694F
+A6B254076390567AB65B07F12EA8F9F3B6EA104549A95A7D70678853
+0
+0EF17592D0912BE6F05CAA91A21AE9AB344F52AA0F38B7558F67A9F1
+308438FAAC000F0D6589FCBF16D0656C71C3455838F10369EB0E76C1
+0
+eccp_batch_negate 815
+5
+DE8A9A9B9689E798C4C245A057CA79A73264DCE52BE63C0B362288CD
+20C76855ADC97D187E49BDB1FE7BF26D2063D1AAEA2632F90226C0AB
+0
+DE8A9A9B9689E798C4C245A057CA79A73264DCE52BE63C0B362288CD
+DF3897AA523682E781B6424E01840D91DF9C2E5515D9CD06FDD93F56
+0
+0F4FE04DA4F721414D49887AAB5D29147BB8F9D51C2ED36B207EFF9D
+B536F5096526380E303CABD908550B2CC18FD3B1BC7D4DE2D9D98ADE
+0
+0F4FE04DA4F721414D49887AAB5D29147BB8F9D51C2ED36B207EFF9D
+4AC90AF69AD9C7F1CFC35426F7AAF4D23E702C4E4382B21D26267523
+0
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+DEE11C65B1478140B18D5A13D8A1E9596864ADF3574A69B86DE6DAB4
+79E9A2B1B95023A3C0A10ECFB478BB92E9A57CECA4FFB9E31BDADBB0
+0
+DEE11C65B1478140B18D5A13D8A1E9596864ADF3574A69B86DE6DAB4
+86165D4E46AFDC5C3F5EF1304B87446C165A83135B00461CE4252451
+0
+10B6416CAAFD31D25952B874DF7E239C84AA7AB840DAC8A6A3853A55
+CB8656235BE55976BA634105879237945EEABDECFD7463205F859890
+0
+10B6416CAAFD31D25952B874DF7E239C84AA7AB840DAC8A6A3853A55
+3479A9DCA41AA689459CBEFA786DC86AA1154213028B9CDFA07A6771
+0
+eccp_batch_add 816
+8
+1E4820DC7EC6AA8B511507B5AF60AB47A4A8E227A903B4CE64FF0908
+2390476D6788D83D46A6EC35E9461AB2E4C26744AEA197B17CF0A81A
+0
+DB3914F73C6712F58FA0A968E780DCAF60EF3AB7EAC3079AC3546A11
+A284E53CE6E52A8FF3845F11F81CCBF6DB727140A0798A04E1C6073A
+0
+A792E69BD7CCDBAF27C58729168BD41247CD5BF84B2D9C669B796DE5
+29A06F587B85FC2EE267F9C870E3E89FD33B4F4FCF64046342B98BCD
+0
+A3B28EA467E0D9731CFA89DD804A315FA8209EDC1D813186BB587ED2
+92F059255DE4C436375076AAAF154118D5125FF9B8865ED55EF0B707
+0
+A3B28EA467E0D9731CFA89DD804A315FA8209EDC1D813186BB587ED2
+6D0FA6DAA21B3BC9C8AF895550EABEE62AEDA0064779A12AA10F48FA
+0
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+BB14D83E75D09EFAA282F25EB61D6DAD005C4EE47759ACC47078BAF9
+3815B6E94398878246261656FB78594585365E46A5442682EDFE886C
+0
+BB14D83E75D09EFAA282F25EB61D6DAD005C4EE47759ACC47078BAF9
+3815B6E94398878246261656FB78594585365E46A5442682EDFE886C
+0
+E2EFC6D8E14E6BF94C4ABFDD23722917FA4EFE65811D655D3FE1799E
+F38A67915D288965A7B093ED0582A2A595E400247FD911BB429A1E2B
+0
+E2EFC6D8E14E6BF94C4ABFDD23722917FA4EFE65811D655D3FE1799E
+F38A67915D288965A7B093ED0582A2A595E400247FD911BB429A1E2B
+0
+B2F519DA4E0B9CA0F7020036F18E0396910C272F4933964041A0AEF4
+1CA572B252C9C9DEDC781C4187909070A09A1257950AF0FA320862AB
+0
+156402FBB5810C224A5F6A4FE839CF0260CE610B25A2A065F0EB10EF
+4C79D82ADC0B79A2AA8B3BBB99A4907F698F56BAD1F4075D6E2C3CEB
+0
+954E2BE7022894627894682ECA0CBE3FA8200AD86638FC23E06D09E8
+2010A15F88D3402C3896F895E47CD56D65E4D9FA405FAA61561C3670
+0
+0D180F2906270CA66DCCEDEC072AA688E9C0C7C93439B0623B74AE28
+CFAA509FD8B306F77E17FC798C9B213D45079DF3FBE47EF66EAB4B4C
+0
+AEC1898A42E35A586C36B1390DC47DF74EA3BF09E9E2034DDC62101E
+34F5B845A1D549D8BD8B62936D51286C57F2BF071289AE6E568559C0
+0
+F5CFC130977DB7662CD5C4D6469644F997C665EA31BED9213F9A8830
+45D574CE4CC60FD084B16DBB613C73402C0613C1B746FF54F32CFF82
+0
+6ABB354ECEA37C5230EE1DC828272FAB48443C72772DE98F53157029
+B9F78CA17B0D7ADB27F03917159E79B73D83177DFBCD6577B21E5958
+0
+D22B6C25ADCBD478EE71D1446EF1A6D87DCED1AF42AF4569DD8A3E5D
+AD8B77D16F1ED7324C3B6BB23CEB7B6130B72D595C76A5C221F3070F
+0
+4CF9685E18A4DD75957C584808064628C3DD236848A7287468418818
+4821065D33D4E90E4A87A1FA85A9CE0A17B58B41CBF2441C54A7FD96
+0
+571917767197DA127F23137338921FEF041467FC16944E11D5C34E19
+D8AAB28B2389FEAB334243AADB4DBC78AA5BB43934314C6336522000
+0
+3CEF1DC1D6FF44B953E97FB8602D92593748FE01996D0CC86179A093
+8C5A283B689C68F8CEE47244EC75A9DB0C7C5405E176811A6C512BF5
+0
+84947725071A21FC3D089A3BA7F6DBE4BD8DE43936771F983608B2E8
+2D159058002B44C7F67A7F584BA7B7EBF52368D00E85433C62E52E90
+0
+4C527F66D989577373F2AD91F0083959B5DE52EB24F1260CA327BBDE
+F1FEA41CB23D6807051FC5B76F0C837E0E11210B3FB0D32DE3C5396B
+0
+eccp_batch_double 817
+8
+E0D99A634FF3B5F17B1C5E049E769CD7880A94E8BAA86349BEC2FB4C
+7AAC8CDFCFD85150A8BCAA1DA84AB6BA3B2F944C79DD4940B7D8FADA
+0
+2FFD6380110690C257BFDB92D48025FC2E65254417243D4EE677243D
+7C36336659CEE84D3802D1A255ECE845DDD1516CB266376B183FAB43
+0
+55104CF0B2FA5E9B6CAD702952B3C3D7A98A60416DB9FC9D6452C839
+87EB8A5C556BCAE6051536550B671DA9A8FABBA8C275270B1AB27986
+0
+1CC00AFB6B68D665B1604B8321019AAF2EFCFB16DB341CA4E208F708
+DB5DEB7AD6819A1D7DA9E5E404B5E6FBDA5FBDF23C6F569FD1CE7539
+0
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+E0B57DC7300F433E5133EA71AC1B3DC79070D64D701C9034DE01C8B0
+E1F35FEC06A19DAE4B7EA240EBB8AF823E9774F3C9E11D47D3C316C9
+0
+EBD96D802892316AF1EC5364F76258E9C2B2A435CA1BAB7D96037D9B
+60A7E973FF2AFDFE272EAF8630647E772F49292F19E5826724323E5B
+0
+1BC10A740E3B0449E1B1AFCD77A4B041BA007317018BB5EF1B4CE75D
+A1D4E13DF79282E227EAC441B463BFF79F8499EA22EF17F53FF4D4AD
+0
+5ED240A2B05F19904F6982F1B99D394246AE04E41AF11A9B5BB639AA
+0F75C2F52647C549384B892AADE97EE8D8449FE1375059552D4E9D1F
+0
+EFEC7CE5662CBDC30FA130D23B4B138BF6AE4A92D6628AAAC4AC5E40
+64DFA80ED0DA781B8AF9798312E9534DBA87703A4257622C82BAB583
+0
+3C4850243D88EB46E6E54FECEDCEC527944776E488C7AAB8C812D0D7
+18D09584BFD8EEFF4CF05D4ACFC201DD001BE49FF9A30AA4BEEF05A4
+0
+EF9ED1547E87656449DC10659F4C8018CC5BD2E0447F49056F527AA7
+6D3C9E55D81B574D8907AD1F88C28388616B54A102B706AE6B9CCEB1
+0
+F857BA1947A98C09984F7F83A34F901404F7B2BBF19CAF7CE3FA7250
+1A93A5E5852EAD6208158E7B51C2AD3B934CD8905BB2E73118E17784
+0
+76D06E74239CC87C673FC1997456A90550997DF16098FEAD50A1EB01
+F7C0CB4E1334E8C8006FFDEC2C695D3E649C1E7056E374C0D1E875C1
+0
+712F6F5C5336775CA2B57478F03722FE98B20F1DCC3DF84B3F76BA4B
+5A05E072FED73C21B521872723654E34F24E15FD6544740D699E443C
+0
+eccp_batch_negate 818
+8
+D7AE7F372DAD26C2419858B8F68DBF25BF3A7F69BE782B1C4903471C
+55BC93FF4C76EF5622318BE1D536577CA58AC126B5E8DF72898D8482
+0
+D7AE7F372DAD26C2419858B8F68DBF25BF3A7F69BE782B1C4903471C
+AA436C00B38910A9DDCE741E2AC9A8825A753ED94A17208D76727B7F
+0
+40E42CD3B22F7EC6C4A17D61F21565FC376AD2542CC93B33EF5CD5D8
+6E90BB2DF8B2DA2F593C23C72E939E7D01933722318B318EAD18625C
+0
+40E42CD3B22F7EC6C4A17D61F21565FC376AD2542CC93B33EF5CD5D8
+916F44D2074D25D0A6C3DC38D16C6181FE6CC8DDCE74CE7152E79DA5
+0
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+07E4BFFC057B246B611B1691B0C7D0BBC74C70D391EECC83D56B8C3A
+C1190B397FC8B121F0BD8954713CC46D1C13553B0808BB8686304DD2
+0
+07E4BFFC057B246B611B1691B0C7D0BBC74C70D391EECC83D56B8C3A
+3EE6F4C680374EDE0F4276AB8EC33B91E3ECAAC4F7F7447979CFB22F
+0
+F8E63589BCC0D1E5C9E40DE1C70E233A89F548DD1970FB638E39DAF3
+AEFC75CBEC95539CD706DB7DFD7500B1890EF35329164AABD32B669B
+0
+F8E63589BCC0D1E5C9E40DE1C70E233A89F548DD1970FB638E39DAF3
+51038A34136AAC6328F92482028AFF4D76F10CACD6E9B5542CD49966
+0
+13259F521784D25E1CD2DDA891C23FA6F881637A38C91FE4A8762B97
+D6B3695D50DDC73F1DB2912363BF16D65B5D2C296EC65646DAD27E97
+0
+13259F521784D25E1CD2DDA891C23FA6F881637A38C91FE4A8762B97
+294C96A2AF2238C0E24D6EDC9C40E928A4A2D3D69139A9B9252D816A
+0
+B58CF8FF46FD9142EF5E17485F9A8F0CE20E0E5C8B39C5644BFB0956
+97555F03FBF1C2F040D32F53695759D323F5B0A96CF30463DC443C90
+0
+B58CF8FF46FD9142EF5E17485F9A8F0CE20E0E5C8B39C5644BFB0956
+68AAA0FC040E3D0FBF2CD0AC96A8A62BDC0A4F56930CFB9C23BBC371
+0
+BF26EAF757948130650D4B9F408449B1D4F0B179A2C5046F0ED73B8B
+50C91BD1D829A9C06F16765120F32FF2D8CB95BA1BAAA1EC5FAAE55B
+0
+BF26EAF757948130650D4B9F408449B1D4F0B179A2C5046F0ED73B8B
+AF36E42E27D6563F90E989AEDF0CD00C27346A45E4555E13A0551AA6
+0
+eccp_fixed_point_multiply 819
+2
+1
+EB3936A0EAB05B6E349D7AE65797FE38926CFF3FFEAE6B8DA951ADAA
+2C06EAFF0FD7CD4FF3E2DBB620C83FDC0EBF8113ABE1A587E6840AD7
+0
+2CBAB094CAA9BD3532A26B31E83EEB30E9D982D1486BB01194CA0822
+908B0D742416DFAB075C75B49194177C61C730EA7739D4249F9264EE
+D67134972E15C203D2CDB1C3065A13B800A0D8549ABEDD664AB12052
+0
+eccp_fixed_point_multiply 820
+4
+1
+564EFC2BCB1E01C763A22E329FBCD562958187B848B04ED7D1E84C82
+2B0F5436F593912D4A5001E6A2F47B77DA364B5E61122951D54601EB
+0
+7974E582FAFA7A40D3F1D70FBDAD46218535D351171B9D53E84DBFEA
+539739860481688AA33108723A3E44424784532177CF242DC83A041A
+00297A6417126FD2120F497B3670522E11799A0A69BFB6FF34353CF2
+0
+eccp_fixed_point_multiply 821
+4
+2
+EC882AAA41E15EF97CEDC18444A5865999AA33B910202B849EDDA06D
+CCFA8D2273E9C9257112CF7585BD4E7385BDDB173D3132918DA533FB
+0
+EA436AC111886A604FA323CB4BD21FFE282785913BDDD3E723E0C69F
+446C97BAF29CD3A1A1EBF5C79A54DDF81F0FA702CFAFC9BB46B8F404
+A0DEA75EC00C8EFDC4E9CA9D85EDFD8DF72BC56413CACB560F8132BD
+0
+eccp_fixed_point_multiply 822
+5
+1
+1CF43A3FD69B29A0FE7C1C8DB048A687DC0F6493C70ABA0F3D604338
+E2FD9693AE385487E17A475B47FC4644167E2B44BC596FD9DE018F8A
+0
+C314A3CC4F37A85AD8BD80F0F176C4E9686683713A3ACB1AEEEEEEFA
+3CC082E06A83B1EBBCD658C664A46C9BBC58338E6210E91CA56B1C92
+6210D63BF9DFDD8C3E480C3E286FD74671AD8D0A3DB70AF54597C1CD
+0
+eccp_fixed_point_multiply 823
+3
+4
+2BC2A6D89DAA1D01753DFCEEC1B7BE7FD7FC91C57512179D47DC8A8A
+9E4B67D45D7DD585AB6E8D2EA6416B54FEBE5B5494E0D25B7185F58D
+0
+125BA02A10AA65787481B203DEECDE7ED3A502459C023805BE79480F
+49E8A0BB19B13C9798987652B87D0AFF2C06F734DD937B5A1AF3FAA0
+C741F6EB24BAC451B25C41CA6E88D5C630495BFEBE5A834CD545ADB0
+0
+eccp_fixed_point_multiply 824
+6
+2
+2DE0AEA1BB5BB6D0E9B7FE92D89ED7E85D0543DCA49F3438872BBE3A
+4B60FEEB443108A4F157A3D3A85C717E731D5017353D55E458430599
+0
+A980C9F55D08FC727B615E5E5786C8F86A6F7E33BDE2E9882FA15F25
+5368F6821C8349C9C5477302DE6F05B5C16BB46FD31C3F37BE211A93
+DFCAF2D06AFB55D11A182A0B1279621690480B992F7A4C509429E7EB
+0
+eccp_affine_points_validate_batch 825
+1
+55EF230D86D3B2A44C69FE9237D50A7BD7ACB48C25E4FA4AE90BC2E1
+421F166B50F03E7A04435FE3884459782CFAF84ED4814B2B8BC90290
+0
+1
+1
+eccp_affine_points_validate_batch 826
+7
+3C89BCD84578549165B0632417F737C0536EB509782167D28142B2F9
+FAE06D0489693863E31C5F44E5819BB4DC0F475ABE570F1056410831
+0
+1
+496D34FC78DCADEA1521E63E9C8631C7E4035DE18396A690F6E09250
+F17D40300368732063205E39B990BFE16F7C4DE68CF9E6993181E409
+0
+0
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+0
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000001
+5FAE38DFD8364BC6DD65B62D303C914984DA9AE1439475BD2B8D3DF9
+0
+0
+16342E0BA05493710FA0B40F1B425F0A7148029F70647D6587557127
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000001
+0
+0
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+0
+0
+304254E2A49FF1AF189E175288ADDD387BF5BF4935B038CE4A51B1E3
+E492FBC3D4DE92A7469558ABA560C21D89B1A5FE56EB2E33B93935E7
+0
+1
+2
+eccp_affine_points_validate_batch 827
+20
+342E7AC17A82E3F2AC18DBB6989F6A250CBAD69B4568C391A831BD4C
+A7C30BBAE12AA84EAFCF07A42F84B0F94606462252C2A661192CFE93
+0
+1
+4BC5F04B6612C16BADB6D0D4D7036D210D8DC49A060EF8B554895410
+BA1119FDF11987F873668368FF2FEA7AF7DBD448D897EC2B67E2C479
+0
+1
+78284D75E273F7BE465667A012BF67059C3D3CD3D71B3C31CC6A2B7E
+9C961D10317ABE0EC0A45B239B8D18F90EB982C4E8F902B91B9F2FAF
+0
+1
+9EAAA4CC501C8A09CEA31F083EB2E2D8606C656F4486D1A8AD34B90F
+9FA23074C1213D98E290ED6A0DF9F9BA15D1711A0A1E1270A83B18D7
+0
+1
+89F1DC228E45E5A0E2474A1AFCA503ACDCBD5EBE88DE47BB2683794D
+3689AA9A3513914B8CE823903C00FE2118032D33C127FFA3A4006A41
+0
+1
+D97EA3F114EC12A49A867C5EBE6F5DA75FA89C24F4F7A4F2232FEF1D
+15F8928473CB3879E09D8C1CA05E399C8E00F56C3A0DFA02C78DC97A
+0
+1
+642AF301C5E8884766CFF0585688F1C97CC7EF45A01C03B885B79E25
+3639C1EA90B446020BBEDE2D71E3ABA26655670341A6AB09EF53EE68
+0
+1
+C9A4A55A04CBB5D79E3D60C74ABAF0B514817DA7F8394B1360F39562
+AA45E9E7E829B10174565780BA7CCC382ABD0A8D510B44FC8A980651
+0
+1
+8F94AC1491CEE635FD21644F263C1BB731CAFCF8E074A0EB8A3F5EA6
+6B3DDBB73EA185AB1D719F4F65F2C418449C4F24DF6DA1A18A573224
+0
+1
+B31A6B59F70722ACD22B22F3C86D00D495E946B85D7FB392C264467C
+FA5E5911499FC7378DF089BC80F33DD6DF50BA34C88E568418EAE7E2
+0
+1
+972F93EFEED89E6C90C14E601F208560BDDC8DA93B1549F8EC243931
+8DB8FF6AD92A374807961D856F065AC9443B037B94978EB5C322FEBD
+0
+1
+94A446F3F5C32D1B76B5251F0171E0A45A3F3D33569563CA8D841732
+4612A2D9E0CAB80F03DF273C5F3D2B7DADE3AE10FD242AD1DA16A399
+0
+1
+3D873225DFD611BB95FF2430E62716B4C09CF1AE9CEC1F62B34AB8C2
+A7B84E0E56E352462FC02A407FD88EE0F70B542DB66BA02F8FCC2C5B
+0
+1
+2AE11ECCAFFB3B154201D67E5F7C2F06F294937F0682FD268F18155C
+2BF9C201BED3B7F38C9EEE17AD540A1E3479466A670047A76E6044DA
+0
+1
+B3B4D969C6D1AD909FE37B51C465FD10BC588721C53CA9CB0503020A
+9537A54FA50812F3779FA0FAAA71C36B89D95EBF76C460C5B1882C14
+0
+1
+5E800AAD2F8502D01D2321DA75559D721710EED199221D36D759515A
+678BB3F1C0887C5C70EF3AD23EF9CA7181DBC17CB6F898A00408D064
+0
+0
+F1DD7EED9B2555387601DDBDB6BF1ADA9EFC7266C01E527399AEB076
+6D83240BA0BD4FC7A192BE24B74B03EBF3E885A588B79A6BD4BFB5D6
+0
+1
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000001
+8AEF651328FD1E88DB0DE56124E23F14D5629ED956436E3FA9A394E0
+0
+0
+5BED8F987B93E1CDAD73154E114B008F70D484FC6CBE7E298C9F7CEA
+8DCC300AC954EBB9DC57FD87F2AD687997930132684ED125395443DB
+0
+1
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+0
+17
+eccp_affine_points_validate_batch 828
+40
+0793CE2F02316F64B702DCDBB11A30681D2D4B84B1FB870146CB21E3
+6F7BDBF77FE4C365EF4EBC86D86AF61440F92500CBD330C26D55554D
+0
+1
+7A53A912A705C65F7B744931F393CDE5B83E6A8673230C42FA592736
+F2DA7324F2448A162BAF77FF42C78248B5DAA5F413D494620187450A
+0
+1
+496B4841806DE73458B94FDBE3EBF1F26317BA66788275FC3851E6F6
+207B171D80D4E42DF1106C6F197B37E7FF821313C7D96BAB0F1CD5EA
+0
+1
+DEB31841665D7E8A29342099BDB3CF6DC0CA22A2CD5761E8A81E3961
+B24BCBE668912ACEBD0FD6471A788C19B925FA71D1D1125CAEB91E42
+0
+1
+C1F875E9CFA458548FAD9908E81CAB9D8D5CD68B3E42B99D240F3931
+508C7B655278F1D511327CE6E3DF034218987A6772848A4E9E538948
+0
+1
+E39A1E0F3A05E74B2BF4F71ED6BB0CB060F47869377C9F269F64DB35
+90098D922D5729B572187647F8BE9ADDF13476CEE73C6A8194F3E71F
+0
+1
+6A1FB1415D57D3473B89F67F930107BF9056D057127BD7C0CCE1492C
+048CDD4AEBB025CF195C0BAFFF196F7627A6CC581D9A19728AB1F128
+0
+1
+886544840039763F0DC1A44D7E15FFE1B763724526356AF320339FC7
+F3DDB96FBAE419F6A1728DBDC58FE062D0A64602EE71706E3609FAFD
+0
+1
+7C8F40DFCD872B6B4B055822FA9C628A587886D7A0FAA74EDB9D4A14
+843C262E0D33FAB580CC7BD88570E4761926BA034AE95E2B88AF94AD
+0
+1
+571559ABD1525E610A031E0FFD033FBD263325071779A47A86C39A2A
+D86DF28A372A23E54290C8C1794E0FFB434C38E3F0FE764C46DC6918
+0
+1
+F5F1C82DB8A8FCCBCCB3A8EF21A9FD304A68982D2D88F1A308FC7C9B
+D1AB4CEC514785ACED0DA0907397AC7286DB9AA3E0C1FB9C173A004C
+0
+1
+622611BA48DCA89F8145785E404785B53B22E088AEC2ADC834EFBCB0
+C83AC4AC3F4972F66FC23B0DF377FCBFEB96C5C6186DD8231E5812A4
+0
+1
+F3C73EF4DDFE1D648E869429260C37ED00510D8976CB1499E5273E98
+599EE26237A1B9CF00EF06E245BBC1ABB20F7153F04744041CFB527E
+0
+1
+624651424AEDC1610943A637CC96885F27136CEB78B0383CE4E97DDE
+31FDD723FC2A3B44067A5ACC23028D485237B9495290652AB2A2400B
+0
+1
+221B3CB9077563B1A656BE1DA1B57CE4CD78A646857EEB759FCE7024
+BCE500BD3EA296FE80B1B5E9FCAE01F5FE44CB7824E51F339437EE07
+0
+1
+4F3B4053D28F8A7CCEE3F74EC5BB44DBF2D9F024006FEA63F8756B39
+E5A8FE2439DCA71D63DD58CDEA486A9BEF17B241864241990AD2FF48
+0
+1
+53FF43DDA5408E5ECBCD51A2B3A66E53CE3FD5EEFC601F38DFF7EB7C
+26E52747D972E98EAC3BD155A18E66F56A51BBA5671B4EC6C5BEAA25
+0
+1
+BB012A7AB7CB74B10E967D65BE90B2E5CC084CAE7068B61426D2E1E7
+03B34C468E5349002DEBFBC97FEB0B8FAA1594D6790CB4352C70E226
+0
+1
+9AE48DE78C0EF0A52A074F97240DBDB5247B1C3C39038014781449CA
+AD40E5FC5EAA4EF968AF4A608C9FC5F896982EBA385F61CCA5A71082
+0
+1
+5C85A8DE071A31800B25CDF46927D85DDAC7C7A5D2DBBFB62A4F45B2
+D0C4A4D86B35E4B4C0680E15A7B82F52AE93E377EAC48353419E4580
+0
+1
+837EC651B4ED9F7033860013C5519EA5E494E62A8C3F897C9C865F01
+B3773F47A85ACC72D46AF9632E5BC5A15D6CFE377553F2CDB163D5E1
+0
+1
+4985C2B897B956F782148CF8DE706CDAB3C214F93EE2928FE29B22AC
+0388CB9711AE602D64293174E8EEAFAAA34C995806A0E0B780560849
+0
+1
+C324E48BD165FF77CB86B53B999F17CDA639661AF709EC67EFB9BA70
+7F18CA7A46D1816B6529E015D1A64A84A6B7D5F9A4512244EF814637
+0
+1
+75BEFA7C88B236020410A802A9E2D7BC3CC2227D26E073E94E4CB74B
+8A2FD976A3167A031EE5A089A5B048A4578339D3AC9D118AD429E3E1
+0
+1
+F9EE631AC70164406580E88C1C634429EE3F238DC8898D813CD4A440
+14E25EF5176E5C19A279DEAC161F8E0E0B4D7A03EBF1A9177B56748D
+0
+1
+4F320FB0DF4B6CBF0775C9764DD7A7B6D1C6DB79D8C5D4C5D6C1DF30
+E37AB9F20FCD266CA139A602CC833404A29C06D12DA6CDB7DA0F412A
+0
+1
+52376CCFF96E62A6F651EEB76FF154FCF9295F61045DED01A2CEC294
+4FC57949D027E2E6E1B21542CE8B62175AAA1A31C88C5E141BF8FC32
+0
+1
+24A2AC87E127AD5890D9B05216BCCAB43844A1C2BDF67051A709B92F
+FA1A00E89C34473378A5CC31D2DDAE0E74F59824A6A43856B296BD2F
+0
+1
+966BE7FFD6CF084759F87720C088B381F7DE6C748B13F8C5F967DDB8
+01D580D626730FE71EDC88AC0494E21B8F9E99DB1FE20CF9953B9E32
+0
+1
+D4427BB89E7C65440F8192D11A7CB48A2059CC39F8C20FE5A8EE7C25
+3C1467F61CBE508A73A8E0EAE0440FD2E1A086184C4E3EABA73E865A
+0
+1
+75807AE4044346E3300AF5E93E056323872881D6132FA817C655F83B
+B3AA08224EBDB3727792F260032829584C036692EE6795AFD673BE9F
+0
+1
+4980B3A2D2760219E8D2BF3AAEF5708E509BF2CC6732FD1E685DF215
+D4CD47CB17AC3A4B1AEEF06806727114C7DACA14F97CA586CABF1E01
+0
+1
+63E0D7F5450ED8CAAD2C5B879EEEFD3AED02B48AB22BA2D4141FAA06
+42E67ADBD661638C5917860BAAE5F91A43FF60AC527B1E1A0DB1C70A
+0
+1
+DE38BA4AB4ABD2E1FE0564AE387869616685DC9EF4DF813C54611085
+7D423B845C832FCA4A75AA60AE3E3F15CFD7E812F5AE61E7BA80626C
+0
+1
+15F9B4FF45B3217B375C8B3C5ED45495EE0513EE627025D62E48564D
+0A4AFEA6E1D22060BDA31CA5DCD7C2A48F651E95801B2013DFADD556
+0
+1
+5C41C40C053A1640B128A56C9CBD3417EFC84E106B671204293A27B9
+6F174628C863A97B7130B07895CD72B3004AC9AE95DB6E1FEC417019
+0
+1
+FB3153D852EB6A2CB9C292DB516639E73D3366CCE31B1B98AEED449E
+2A48C31FA4B9280412D1298C4EF3E5441E6C1483E860A5EDABF25500
+0
+1
+8E5F98F0093715CBFCAB4D7BB56F97FA7B9A19A1ADE4ED62A4F9BBAF
+2AD16C4682FF368E7B17AFFB0F778ACCC117E80B8BD262963218A3AD
+0
+1
+3A1C2630459B3797B11F32EE3D3FADAD2982026B19DF13AA3894B3DB
+45AFD7955D293F104213004FDA5E251D127392C49529DC8D25A63969
+0
+1
+5D906D511D672CCE2191A473B3E2CB6BE8CCF6F4E36EC672499ED1E6
+1749CB372B34A3F4535AE7EAD84D11CEE335D22EDFFEB09DB89CD305
+0
+1
+40
 exit
@@ -3455,4 +3455,1577 @@ CAB97DE76C199EE545E0C741D3864AACF16D48678D3C870B8031D01E
 02FD634F709BA973008BF161BE4220FA820CCAF1B6B1FCA86EC29F54
 513EA94BDC3E6E802534602DFA7BE89DA8B289E857551DC343DD6F2D
 0
+ecdh_phase_two_x_only 458
+4A3FD8AEF4784096C046833260FF04ACB6ECAC4A40997BC4E12DDEE1
+ABA0E81BCA0D99C6573CF5B6B7623D684E948467FD01C8C86768DD38
+0
+481F0833BAC0EF69EE24F5BD9A0B75D7E2B4C809166436A5B0DA672A
+623865A1E373CB15F28556FFB9EDAB1DDBEE96EBB8D1B97F24CB7405
+1
+ecdh_phase_two_x_only 459
+BDDE511C1150B2309A02353F479361D6D610B3D30CD594906F45ACD4
+042D44A86B8836501A29BCA424816B54C96BFF2988CFD82B1B3C484A
+0
+00000000000000000000000000000000000000000000000000000001
+BDDE511C1150B2309A02353F479361D6D610B3D30CD594906F45ACD4
+1
+ecdh_phase_two_x_only 460
+9A58BDCF6AE53325770B96872B41D6AC9FBB993F7EBC8F1618945F73
+DFDEE11B5BBF4BA79EEFBC4D78D629567F584A956C71D8298CB63A2B
+0
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+9A58BDCF6AE53325770B96872B41D6AC9FBB993F7EBC8F1618945F73
+1
+ecdh_phase_two_x_only 461
+19E9E161B7F12EDC751803660DD2947F443FC08E5A66E89FC008DA8E
+1EE3DD3BB043975915A1A08AA119B7CC6EA1BDDE94F99D2ECF22A78A
+0
+00000000000000000000000000000000000000000000000000000002
+58CC2F22C837A2D8472B5013FB909DA41B02059994F55040AC8098EC
+1
+ecdh_phase_two_x_only 462
+28B08D7D4B604637F3087210E656A39EBBF63761C4A5C7A222E76FE2
+48C91DD18125C5FD6FF0D8576F0BB30BBF5FB773677002AA8E86894B
+0
+BF2ED9ACD9AAE57C08EB1FBC82EE3240A82B9E9C962E49C8DC9F839A
+34D5AB8711E7594837C26DA55BF4B633D6821A13FCCC21353DE9A9A0
+1
+ecdh_phase_two_x_only 463
+CF51D09B76EBAF88F77528ECBE0273AD16AA77B7C06B519911DA0963
+D21F3F25E0FBB9320D8752C9C302965C805127D021C34F3EA7C011BB
+0
+1E0E975492AF8DBE1403FFA99557DAA2D90D4FC44535FA44CC082CDA
+2066CB7F12160D9E70F4F8EB6FBBB5FEFEB2B016A9173B0556F6D950
+1
+ecdh_phase_two_x_only 464
+DACA485BBA51CC396532E3D737DD273E4B647C37F1EBAE455ED2CF75
+A639BD2DE0064AC27B2E381FFD71AFC4E219EF434AF63FC95B934CEA
+0
+6F4D482C92DB8FB202D25EEEC5A3D2DBAE0AD02FED289CEE1083BB4B
+52047AB89DCDEF1A03F4B3F817F808A1D615DF5C9D92BDD571709E1B
+1
+ecdh_phase_two_x_only 465
+E341BDACE9882C2D8E04A64813C3A2AA5B9F71FACF89EA89E640C32C
+80F065994A3EEAD29A00443E5A6BB1A21459549DC6DA03F3C3018F86
+0
+DADCEF82D057139A16D39B6EEAA6F34505EF1E5C69D592B427DB42A6
+7215E596FAFD5B3380B49D36147468AA32DF8AB53FEF1C1B647F0476
+1
+ecdh_phase_two_x_only 466
+8E7AADB35381A12DE4F3B6E892D7AD986AEFE353DA496DF95D449FA5
+CCC04C7997286B3D0455D7460E62FE05ED13BE6C7870A9A136852AEA
+0
+55A5B23F1CDC65B8AD004B3E3A5F897F8E75AA88CA9B9A4A35B9F50F
+068267D32AEBD74D644B710540DFE83F61F80DD276401C9B427D809D
+1
+ecdh_phase_two_x_only 467
+A73D79F3D11A6A08FCFF77361DB26A60AC7E64D714ECF87A2A4EC93A
+616B09DDC54711FE2B1AA9098F3A404A56E39A846E478C9F63011352
+0
+E58F6DC4D5EA2678ABEBE235C133D11307F162DEF7D200974F30AE8A
+A37F85F0F7C3F7020128C308F74B05D59DA3458F66541C57B12DAE14
+1
+ecdh_phase_two_x_only 468
+BCEE8A4FA3A117AE52E5439F75C8709176BFDFC98B753BE07B315765
+00000000000000000000000000000000000000000000000000000001
+0
+190E5667551C7573B810AB7820D2489E8658C8EC53AA42CB543617AA
+00000000000000000000000000000000000000000000000000000000
+0
+ecdh_phase_two_x_only 469
+FF6CBF2FD6B77BD99A24F7B108DA1B07186173015A886BABDC024ED7
+6B95882E44FD8F38AEDF85A2E1DB359C3A1F7C18C9626185776D75D1
+0
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3D
+00000000000000000000000000000000000000000000000000000000
+0
+ecdsa_is_valid 470
+00000000000000000000000000003C1205FB98350D3431717F0532EB
+90AE56082A054026573D2A2F2834074814232A6E533247DDFAD31CCB
+292AD51A4B40FC2B15435E0D5C797972D89914077A7CF14412D86D0B
+0FF50C74D65817536A54EC41E962F93497692DC0513FD584E26EC5AF
+83A49BD96FB08C46234C25EA6552377B00FE16A54D9933EDCD1A6164
+0
+1
+ecdsa_is_valid 471
+00000000000000000000000000003C1205FB98350D3431717F0532EC
+BB2C63F88BBD8DEC214825BDE8CFD020AC985C8613B626C29398959A
+651A2DD852ADEF3B7EC8EB26D0B12BABF8F34EE070C40B54D28E4081
+8A81C5EDC22C0662E1FBDDF63B87C8CA2E9B06E8B67D3A5100BF47AE
+A2CCE43EDA1D78F764651ED93E21F54E5F9FA93DD821728FFD6FFC40
+0
+0
+ecdsa_sign_with_pool 472
+E69421B762AE0371FF3F86AE9808B92C00CF3D1F2B22697F8C9B62B8
+E2E0A81BB6994315531482A197E25086B499B0377DE1673E2F3915CC
+0EA2BFF923D0BFB220EA7092FE007421DDC14FC22C84D6B6F6F28A77
+1692BD127AEFB8DB7DB34BD6F9DC1A9670A2B767981D0D06E1C89DE1
+0
+1
+ecdsa_sign_with_pool 473
+EEEFC41F7E9D92C8DE287052354A14FECDABB5D75F33DA49E59F5D5B
+6AEA5FF137B530D2E14F0D18C1F016B1237CA4037E9D79CCFC2569FA
+DCCC831F32FD2529D6D803BC75E9341D2F0D0E5F9E71C95650B468A8
+E81E6459CDB460B4C5D0082ABBB38B3007658D0C9D0ED1387E392F87
+0
+1
+ecdsa_sign_with_pool 474
+81FFD99AA654F1DF765BE5DB81D9EC77A0713BA23C708DF9095A18F5
+9C7B00AE41957994F08869ACC0A7746CFFD3E0BBBA2C62FFEDEAE05A
+A8FE97277DA1058AF8AE0BD4F49F1DE44B704E65265A8407249E7864
+89A568C3915D0E17927F71813CC088BE7A92B8AEC4F6F06FF8E678F2
+0
+1
+ecdsa_sign_with_pool 475
+B9A888BA104DFCB12D700EDD2AE3B58B915AFFFE34062CB24D455E23
+3C1DD00DD89B157C15A2E56ABA33CE48FCA61DDC73E2BD194BC42DEE
+22232C570DE8764CEB2FB44C387DDCE5E4758969743EBDA2EEC7C2F3
+5DA123938C7D67F878728C336066B0409A29FAE035365FEDD82E3F3B
+0
+0
+ecdsa_sign_batch 476
+1
+CA54EAE6902CBA3E100A325482B94B639619F16282A58FA39BBD1C0A
+C1A4FFED478049F60F421B7BA51CB7CADE384752624E2A3166E93B53
+19324134DF226B16F0B87FB3357FFE23FEF841B6D2AB8508805CF246
+0
+DE8150C57F391D34535AE6993956D17A8091686A9D33BD4EB7FC780F
+1
+ecdsa_sign_batch 477
+5
+87C9898E1DECFDFB8D5FF4BDBC74CF86A74EE2F15BC6AF8EF37B2604
+89F19DC209C3C2DF0826D453DB033E7BA66C969CBDE1A555FFE1BED4
+BB6BDBCB152112CD76CC53CA5D84C1C38CE0A35FDAA0373FA84555FF
+0
+DD3CFEE36ED0A472F3F7A00E7F13BF602B1B2E6111BFB6156C90F3B5
+D95DC496758E2FE624E29BB14A04D6655CB0EF1B67C5094BA48B0245
+A7D00A216F79A940D91305F939B94420B02260993F9DC720D9FE7BB0
+187484514ACA457224359620BF70B205B30C332971CD01C8F1A0C4F9
+DA4EFC9E3A363449F932402E0FD3BFD8B8BA9EA2801BD1FC601EA775
+1
+ecdsa_sign_batch 478
+16
+DE75390AE2FF6D6DE2B117FB4EEEDD8ADD38319E16DE6BC41D0183BB
+879EE98F3A0C977E39A4BC96840CAFF3C0D6B05AAF1C63B974B2D288
+5569BA19B73E7C6047583E02F12F67ACD7F0F06163BCC70ADF5CB6E3
+0
+3CAAA7D5466AA79094B875610A2697E00D2B3905A76E7C06D42D4785
+CBD85620D71F38547F942A139A5CFCB60A721294FCAAAB86D3FBEFFF
+8D521E4CA2BCD9C80FA5367A58CBA3866004A2E141AA2F16DFE84D3E
+153D70B5A346566DCA4C3B57B8D97943273784B1C33A46F2A7BDF5DF
+583173D33362FC2F76DE56D450A1F7E5CD8CC809291FECC767D73A20
+D107AB1686EC074CB9DD91259F30DDC25A056D43EDC0488374AB2362
+C3E528F840AAA131EB923302DBB4E70EA7DF0C41C594FCCEFEE22ACF
+6BC153B17A71CAB8D6653F7D89B1D0B2C9E2521E3312409FA8331DFE
+84DD2409E3BFB061BDA00B8B5BF20F5BC3014517E56AE989F3866D39
+C60474EA24251EA9EAB8990CA68B384C1084A82F5B2DA84BABD58D2F
+7C3C5604E2BEEBCCF2688ACFF525D7E887A7FD228BA10D0764195D21
+1DC7AEEC879B8AEEB7C2524BCBFFA8E6C387C7BCFBD0C29FCD3BF9E7
+B99B180B81AF0DC42DD37FAE01A1409CA4350E8D961500C92B15CDA1
+344FCCF33B6A5887EA3B88FC0363FADBB3E94A5BCB39FFE02C49EEC8
+754D87A2F9FA44F4275116B84950B28C137832B58FA6AAFA79CD49C8
+775EB5D62B3EC9D0A439AA25005B32B52C65C5A2F4979D2F7EBA9E12
+1
+ecdsa_sign_batch 479
+37
+DC6CCF7C2845EA234D004C507313EC175335DA5084893479A86D32DF
+73790594A247DE3B7219BB40330633457D507239A828EEFA3876F0D7
+1633CC254C1475AB4D14FB4BF20CCD573E3CC251AD6BCE64BBE5906C
+0
+633E6B1E8E752E7020FC3E8A85ED29FB99F7867FBE8B74A11E756120
+60B7E0CD27FF210EE3CD6784CA3D7C74AC37779890987D777F013049
+F79FA7193D5994663D0E339EF4DFF5D21D096A532F6F144760EBB88D
+B7B32F3DFB810BB34DB892A3117B644BDED73E11BB3D5C510D7628E2
+38BD55A4E4042D4CCA3D29271E8E5C3C91DE736DC56DD21E55F96014
+7E4C716C99619778561639995101EF4F383D9ABD4981B79C1AAFE1FA
+93100E94D787340CF8631FF684515142280A533550B23D9EF87FD8B5
+0DB3B814B6E436F13E90E3E6127D86DC162A229F77F902112AB34095
+D16564AE804E93E3455B47F5493C9748D7E971A86DBC0C4213C8116F
+9103EBB249E4FC8ECC7E28805E740B589CB47862C0B556C60BAB3686
+FE31FF2B8710D9A8686F3905425B816676E30CE1A9E5E87F917351B4
+F87F628FBE5E5D3BBE4DE480599E1F828545F40B5750866DBEDEF5DD
+1DCACC26F9442C226B290953448E90254219580B7904D3A1721D5411
+E0CBD19A779838573C4DC590D128348DB9EBD6DE2A6E4D00737FAD84
+1EDA21997990B85A2EC484D34B8CF25C741E4DEC5121665673CCAF3E
+C8D430934EAC37B682812FB797AEE1D5FDF131B70303FCD8D6EE7EA1
+EDCA939862219FB3C7B6DEC353D6950A51E3BD3806035AE8AC0D1477
+D5E32D822ABD5F0802E1F9249EDA7AD16ECE62645F432C01B8F66967
+D2E3554DE172935672C1D8640F773E594893813B6085155C993EA31D
+85C753D2ADC4B9B4394C0F716A80851B9CCC7876DEF0D900A22657D0
+0D2810CD67A2A31B1593CF955BF2CD3E62788B838154C1C88D454D8A
+C2D572C54ABF4AFDD44473556B6C964BF75C1F07255415F411A9CD29
+C2C35E5890CE967D57526924CBC0D1434B6D25C248EEF08530143F84
+743E055A909156E9BFEFB617CB6483E96A3CD719CE1CDB6E53D86DA8
+1D2DF110D0F6A0DEC93049B620F4775ED3AD787CF604D35F0B099906
+F23D583436013168931E43667441962B82A1FE313DB2A2AF763C0B2D
+3F61990B21CFC0519223B7CEC190D68DA139DEBE2A8FEB24FE6C95CF
+A8E11AA5C6111C57A2BF0B2C8C3508D9C5512AD5654548AB62F268A5
+7CAB6CF9285ABDE1557FB458930C85DB6C2F53D7360ACF9C56F3CF2C
+9F68B8918FA8B2102B3CF0E63E62683AF9DCC47F51F9DF0068D0A061
+5A802633A7270B8AF1F809DDCF847E6AF3D4C14FA4AD9688E76D771C
+B3032F42433AEEE3DFB1E9A121C878D35F3BCD52F3FFFB0C3486DAAB
+4B38DE53542969E741728258640AEFEF9F9F3B2E5DB51A913622AF2F
+333EC9ADA19595E26DB1443AB1FE79E371CF0DF61EBD2EFFA4984459
+F512669950CD0975DF0272580C18D43B9E8E6426529B584B75E272B9
+1441115E9E97F1D3BBFD26ECDA7F33634AB8FE0137FDF9476C724D6E
+5F31B578C44CBC92F75F41B4B7705401255B59FA4848F24BB6A06354
+1
+ecdsa_sign_batch 480
+3
+2DE80D9C538541513219E95C84679E9B7F5F920F188658570CDAE2D6
+036C9CDDFEFEE7A97B49B2CA9EC8E5B1D39B4F78917E57240DAFDD79
+3123B28EB8D6974C8423B28BA07444B659EB4A6BEC590E720D138A90
+0
+DF2751AA129F7FEBD20DE7FF3356AF60A21BC1FD63D24063B9EF2338
+C73E7DD482B78CB8416BD7DB5E5FBAE7473BA535C957B86F1C1F3F54
+9689A07FC0A1323A9C50FA67012C4E19B4683CE8237D05407F8FDE8C
+0
+ecdsa_recover_public_key 481
+86B412562050F0F74339511B04C0A70D39E2545348B2B4FF05DA9AB4
+320630038B79BA2022CDD1FE9148B21DE53122F0324D645E8E91E7B6
+D3FB3070742505228E0A66FDE05A7E0EFF09E34F7581A3B0CBF23FA2
+1
+1904C87871683654DF32E54F296AF649B6FC5A409282C15A8E1988AB
+4D62B65D7066261E8DD65311BF8010284522AFA4168F086B374470C2
+0
+1
+ecdsa_recover_public_key 482
+076B902F7EE200692859D493F63CD47BE37CFC04DED752D4AEE5963B
+EA109B497DFEB6603A79BD3974C05AD4F5089E214F9A8763B2322E93
+350E8AB12FC67279CD1C18D218B9C9898960CE8306ED8F494A0C7699
+1
+F973601D15CAFE3181D33BE08B3020A819139EB95A275F8AB56C3692
+1F9FA5C5AE19B60BBDF9B571CECFC8597E3B3C484C438166A90F16F0
+0
+1
+ecdsa_recover_public_key 483
+5555037958907459B0D0D6FBD285B37544C3467CC7AAF548E3FDDAAF
+2146E18B8D5EAA1CA4E04409814F568F174D48C0907FEE12DAE0BD1C
+C8BC983A5F5EEDB2729545B6F21B571092E678FF56E5F7D754129702
+1
+758F98B1F64C42E965B86E8CD797478EDCE23864E0E41BEABC56103A
+3A317F9DC8549D8944E9364145BFA89609E781195DA148DB6998CC8C
+0
+1
+ecdsa_recover_public_key 484
+8AF7CD883FC13B0822068E737E8694188E8BC46D341C5BF13101F1EE
+5D8B7F3FB3EB24D6A9C923D69E9349A046186359D9E39113725E0DEC
+F5310F433795D091D30BC5FE470742E4139D8395923035ACFCB881D8
+1
+F142EAE041590FA186AB0A8F51732ACD6780B870E507FEB8F6B30561
+32C54058E9431670915F963CCB5ECEDF486CC97474924C7A76465C73
+0
+1
+ecdsa_recover_public_key 485
+EC826E6708CCD47721E7D08201831318ECB9CDB341976EB5A3F92F30
+B45F5193F7AA763A47A4A7B191F32CCE055C26D22119A7A8F4FFF671
+F7C1BFE80F4AB66A9D9E46987A9A4A6B9045093A168E2847FC3B6CA3
+0
+3E971AFDE5D9090F865AF73AE1268526F918D21B51366C2477373ADC
+4D9451B26465B74EE91F9F551D6D81C3DE5016C6FB6A5C555C7C9EB1
+0
+1
+ecdsa_recover_public_key 486
+FD7B473CC370E0310FCEC26FBB6F50960C7FC731F63E8FF312BDB9FB
+6BE05A6954626945A2E6A66FB19C89403BB11CF5F3B8EC0DE497B3AA
+A818614DD0674A8AE4E179680F460DCB90640099C417FEC1716174A1
+0
+AE8E945D34A9DD304BC732E8C79298702F7CC064CCD2C163F0E4DF69
+EFD5162EA24A72C3BCC7C0270A219C8CB632D91C80D2AD00570282F6
+0
+1
+ecdsa_recover_public_key 487
+7A003A5F24F9E9911DAC42CA0EC0CFD068595C80BA8F48C536A19FAC
+312A8D7D695BB6647B6536F94A5C9FD3415839E4912F432EA1506F26
+1389A7F6D77D926D09386B2A25D2D8001EC5240B7B59CE488364AE7B
+0
+1264846C6B4020846A2E90D79A8EC6261D280F6FC51030FDA8DDD104
+9619596F8DD1941D70CBF82BE53A0C02535F294B25AE4797E70635C0
+0
+1
+ecdsa_recover_public_key 488
+B54FDB2C2C6A0B63BB2737082C3BA6A31E75EC0D32B7E9E834BB449E
+03B9666BADA119870C0939F09D99327BE910DD8F685E7D4D81B727B5
+B8290FDEA71CD72A4AE767BC9893066704D0F11EEC8234690429BDE1
+3
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+0
+ecdsa_sign_recoverable 489
+FB76D6B61373C882B61FC4B058173FE85FE644757205C8EC35727E47
+5B6458F7522056672332D3B2BB30C36CEF1718039C638930DC976FB9
+589FB231E3384E26F750E6B8295B868EC7A57D482A0DF552F76B4A0F
+154F81FDD9C1E168765B8CBF286FE07B660BB9675196E8972508FF96
+0
+ecdsa_sign_recoverable 490
+DF657EA75F3E36CE78DFAF566F1F08EEDDEFCBFBAE885BB6E06F05F3
+02A54B0BDCA1A1470435E4C143746CBC91FFA52B7E4A140ABF5BB2A7
+A708817EC8EC8353A2454F85424B218E0610EAEB5FE72E6C2477865C
+61782859C55163F550796331210E759F661B8116C2A20897D40433CC
+0
+ecdsa_sign_recoverable 491
+F4A816A0249BFCB1010ECB146C64E2CE953F7EAA7D209CF2350EA6D0
+E6A380567484A022F953AF637B40D17107197F276EFAE4B1D92B61FE
+88708F725E5A8C2AF864F3FE8B24551A6368A4A309A57E3D74834F54
+A2587CA90A6FF1A8C8BCAE33E49BFF7E47C926673E2FB8B954FB0993
+0
+ecdh_phase_two_batch 492
+1
+535910B1E8126CE9BA31846396A6C31B203D261037FCFAFFC4D6D004
+B07A4DFC073973C2F818BBAE97A3895A56A13816AB91D05314C549F3
+031971D55584BF97D406361BB7CCC63E969CA1CBEC44E3E23A6DAF37
+0
+363636748C343A2C166C01663F455277815CA66A88B75E73753CC061
+DBDD00AF6377EB1854B3B886A406E42EAD545938686837E13F995AE4
+0
+1
+ecdh_phase_two_batch 493
+7
+E37B76025C51B63D7BAC809E7414A518532E08858E2BFDF89016EC98
+89F7BBB27DB1D85C72686A2DE88FD817DB6857182CF320070838A7A7
+CF41184A3A0E0D2611CBEC0E83353A3C87671A896E1D3011067DE9E1
+0
+CE4236022A3D4921992AF32681FC45A115A0B8E2DA371F8D4508333C
+8D6B92FFCB7BA12A1B683E1E6043546E3733EE79C167CE0970D86F74
+0
+7FC3BE5D33A434C2F12766A040889F6FFFC97A7F3E02590E495D430F
+AF26FFD1E3E8BAF2FD3B7331F7DECFCA50599B103C7657C2EF81DCCD
+0
+E47C5CECA823713AFA11DEB5C8552CC283CCEC63857435B5FA7C9ECE
+8D92D6F399B3311B3CEAC5BCF3B65C3A16D9FCCB65B989388CF7F13C
+0
+E2766F8E522E121EF63E98EE0C0528B1989206FF73034DF57E6EC29B
+2BDB52877A973730678237E64869A32390C8C2AAAA5A51C52951C4DB
+0
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+12422BB9CE35D713D9EDDCA069E5D72633B9FAC91FDC02D7A80EDE99
+B02A4BE90C00066E41AAE3D4913346800EDB2CF6326D1BA89C5A4E56
+0
+A536ABC1D1550CD767F8DA6A5A25274F25C65FEB2F75B0EB376B136B
+29B83C5AC2DC15231C16CE141AC836B55948AD100BB4CC7D00A14C26
+0
+6A46A0E9C93D0FCB9BB9F2001D38BBA20511E0CEF2B63C9A513FF466
+28E0E6B5CC7EE8A5E11A26C551DF5B2BD3FFBABFF970211B9B743B79
+0
+609F2CAF806BBDDEAB5248BDDC232F2C17CD53027705CCAF5FA44A41
+7A84BC9082B1F67CF7779BDDA51169B2E5096E320C45C31666FC5654
+0
+2C9FE27018F3BEF820BEBAEF2A24F7BD974A996CFB318E751C396E66
+96BD4ABCB4675774034D356D048BB1EDDF6CB68FA25FEC2839F5C482
+0
+86F415FE82F40B77587BD0E773B6E366389FF77620E4DB14A2EB7B50
+A5FD824A7294A861258FA2606FA6012D80305FC240769DD614781AB2
+0
+503431FC16C1893479BD9EF9553DA3830ECDD81FA0CA09CC010871F4
+E8EB34556E398EBD0E6C6D76314ABCE21EE4B7B9B41ECDABE2E2DA4F
+0
+C6FE7E1D5320383E29BE2D0729C33C7B80D512731703246A9136D97C
+6A781CEDD8985A22305DEA8B3C142D03558E60B97A5D81E2DE71EAC3
+0
+6
+ecdh_phase_two_batch 494
+20
+45CBCBE7913BFA5A2950911C6C08812BA4B78C0D2FA104162E3E61DE
+E6ED0AB0B1E7A3DC9FC1FBC3122865516601D86238BD2F299DAD1A67
+FD5371B4E5F6B1F7F3B4E71BA481284165C3430289641F851EDD5F14
+0
+9705B7DA36FE156A58FAA69EF504F37D3C012E5C0C5D0321BB669D55
+1D22AD73E62C8AB8D1E3C2DDD596F38BF4976D86F1DD936F3FCFB197
+0
+316E68078EAF31CC75B006F16E7A750348B7E89A0853A87D55591046
+33224C19BBED4B3602DA449EC0C30840677B9A87B81A5CFCA7673AA0
+0
+22C688806723BBF8B4B5309DEFF736822CC2DADD76D1ABC53A86D698
+26517F50B0DC015433015B66FD3F7B274605BA6F72AA2A719DCA946A
+0
+0F96D2E2CFF24793011F806E0A5B17884850C01F5FEEF12F8F36C8AE
+08C476367CAEDE66C97FC8D39986371A2E2D0EA0E1CEC972004B542B
+0
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+D1109B6C63A6DE35B7201F56CEAAC02F6F3B5C5F88B19666E389CA54
+E6D14E82A47147D42006E352F43AC5B3A545065E580D309EA516A49C
+0
+1D29E1342BD3CF3981720197262D41EE77E836096FEE08FFC684A199
+7D0C9A686D73677D4B055D8BD5517D79760F49B39DBD0BB303097BDD
+0
+FABF1A8E96D47D431A0C367684001114EB25848367594543417A1586
+581518CC18A7AA3453FAC69E91FDF43AFC0E1C5498983D9F9C2DD6C3
+0
+10DF83ADA2E0BA4F808AF3DCD2421549235076A563B6FACFF047212B
+D84E398F6CE7FB181D6FA02DF69B29B5A0712B151685F6162A6FBFE1
+0
+C516A317998AEAF4D55A95E79AA28308B96DB6C7983751436DA4E02C
+2630FC39DD268258D57A78BC691588F05CBC9DAF72742611713A195D
+0
+18B4D2C26D1BC144F2807BA9E324224A1FD289D58149651642A79688
+D99C53E1BAAEDD69D278B2BA55400F37DF5F261C25115B775503C3FF
+0
+0E5CA8238721FE9C3903CBB39F7E2AF20996C0CF39F8AE476944140F
+5DCC065ECB9B84F3667B8968D44476D0A368E3E3E2F74CA9500E193E
+0
+66FA397440075F7E33249C25C615A52100501E7963D0DC6B0CD9FE0F
+ACA1CC03E7D288A9EACCDA99A563929A0D194CB0E8EA3B746EECCF68
+0
+2EFEA0566B2BFF7E559D7C18182A06FCD1AAFB0E5FE680CDDBDD93B5
+D4CA14A4889F230877FF7466EE8C2FFB5952D4377FBFA0718A7BF58D
+0
+B8C98366DED47657B7DB90E188CA3B80E6F28CC88C77BBC21FACD4BE
+2759062E80D70D8FC751D567D1C4031FC94F82215B4DEED917781903
+0
+D44578E96625A41C69064F55DCCA1E6D9311953CE068E702116B88E2
+1CE6AA3CD6E365E30936C5E07A9AA81EF9E6350AC46C4EC8A053A10D
+0
+082BBBD87C6D813485EC2ACE465A21F0C5B904BD41BC8A6329666400
+61638C72FB4996CB55DA1C82D950923B98E66A10A5EC9546083BDE27
+0
+FC569136D5C4917E9C2AB5CB6849F2BE5DA81F86E8C575C6A32655B9
+4E274D80658D764508838CD90460D5BB0422C81CD29B9454F10DB99D
+0
+C00ADF1DA728F168BC674EE3745E87E4B3DA51397072FAFEACC1C17E
+2CFD90D2F31978A44A11AD5951ADF6403BC7A6103E663A23802AEBE7
+0
+E5A22810089AC53A4615EBF51C024C97723E031C210472DCF6EB3228
+6F7F4E2055E281777B50E3A7F712A78F9D11230F4488FA4308C0BAA1
+0
+F3B09489078E05D2ED8B7D7AC299B6EF7BBAE90D100A3DC8A1509E8F
+B06D4277958A5249E7C9FF0F8F41CA8125E1093041325A1DD8B0F347
+0
+AECC74FFA77D07781D0C269A66E082384AE0F7A46F406AAE56EBFAEA
+DF9AD19B1040866E105AC505FF6D02034A5924D9FF939243CAC87D69
+0
+4519B052E3065CFA5BA21FA4953F0D99AD3FC9B91F38787BBD759BB6
+6669DB2589DD4E07C40792FDE97382C73A62BBC66C91169527240D4B
+0
+DDCEBA0863075BA2E3DEDEB5F5DCBF482B7738680E7A23BE6001AF6B
+E271102C0BE18DAB1D360C48F199BE5C691CB4F278983772EC4C3EB4
+0
+1508165143C2933BC8402F16714EC94EACD0A94843E29B25D0EDD04A
+3F305C126B2B9F01381BFCC7FEDA1A91113B0E73FFA5A17D7C6BCB61
+0
+5C2B6B2AFECBE99712C2DBA58A1411BA9C3D55D5550F0701CAC1D61A
+795B32D27BD2832C387ACEE3945D0061368694FF463A50AAE4A29723
+0
+F2F913238B80DE4D0665BF4380130FDF28B899F6C49F794505DB7478
+F039D161E1B0C0FB6519FE075E49DAE8303E9455CE5E8C67D2D75204
+0
+9384B3AA215DAFB8CFA2E025C71DE616BB5B1730933C33A7FE8925FD
+0E40303329E8266AC18268B32DD6035542DB9F940D19C93EA5163EE5
+0
+B93C4AA5D6A568101657757FE556F82FBE3B880C34120FD147D74537
+7DBDC85D3612BB173376E24DE803C94E03C238345D81AEEF328BBCE4
+0
+27C273EE318BEB59F3A8F97C635215879CAFF43546890FB1B9AF528E
+BF8CE75AC61E4CE66BBBE11C13CC0A9EB142CCBCAEF7EEC0E26FF3E0
+0
+11170C89B534675D0EBBBDC854AFDEA3C0BFE1B67B60215B19ABAF73
+590614BC7632C13B13E57828A37C907AE5562C4DD8D5DDEFF130FA6F
+0
+D4D8CF7FFB196DA4325226438803D0F42ECEC2B0FE51823C6EF12B6E
+979D5B4E9DCB2F77CD72F038AE8F297AF7EDF640E66DEFF42D4D40CD
+0
+7779017E27CAFE9512D0E73ECDAEC453F81C28391F6D73DB173B1119
+F2EDD73B4334445DB665B50FA7E16C144C3BB9E3B89E602CC1C262F8
+0
+A1072D664D464292CEB9C7F2E73291EBC1852E932DF1782CBC15482A
+0504C620EBBA6DDE9B38C642DADE7B4300761B65E4532DFC4A0CB739
+0
+6BF83E263CF0273D4AF46ED73FB7EB5BE1EC68E15C27A3A79241CFC0
+86CB3669C86FF910C889E773C5B102DFA9F3F32EEDD823635D74FBF1
+0
+4423BC0F0A1D3FC09C040D98A7642138009E48999E718267A5AD7A55
+170E3BCFA8C6D31D2941FCC3B0D5F83B7DD95AA378B730609AAF58BF
+0
+13707F816EA635834938F00C0771FC3D0748F05B5CF457DE2CA6E624
+72D13BD4505515D5BFBC4025CD501BA5F44E3B22B83BC62B0C91A65E
+0
+AAF20CD40A0BA1E6C2C807820C396F6E9CF1075BE35E7EA01DB202F7
+9588CBE3554B78AB68D44E8FA4142449A1892AAD82BD9EAE1E2E6B51
+0
+2053EFC3CC694C1A2722B46D144F01EF712F20E1D9510B1C459C7C16
+ADA2F0A30D517B453A700F0F00CE9F1EB5434E4A6CF2B2B3CEA6A0EC
+0
+19
+ecdh_phase_two_batch 495
+5
+00000000000000000000000000000000000000000000000000000001
+66F306D77DC48D82F8E8C0C67C5148E6B1404CA1651915D806ECCB4D
+1FA0A3FFC0ECE0171443BC6FF30A41561F1D2BAF0DD9E1B6F2759B9A
+0
+66F306D77DC48D82F8E8C0C67C5148E6B1404CA1651915D806ECCB4D
+1FA0A3FFC0ECE0171443BC6FF30A41561F1D2BAF0DD9E1B6F2759B9A
+0
+0202595F7311615EC70FDC853545C972EB1DF127F757B0724E5B6835
+1398F3F50C8E05A09064DE04EA05E3E9CE75EF5FA6CD0F6505EF5C30
+0
+0202595F7311615EC70FDC853545C972EB1DF127F757B0724E5B6835
+1398F3F50C8E05A09064DE04EA05E3E9CE75EF5FA6CD0F6505EF5C30
+0
+DE160E1377BD397308D004AABA9F854BD3E9DA9F7C59497B5C720917
+57807DE73BA5B01C56251CE014BBE8D6CF0E2FC0B4E753E94BF27C3F
+0
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+71BDA1AA7F9ADA50E3E5CF6517D43D5A4D8A9550682D6666C2E82686
+890477E9E54D379522795BE1C03F25F48BCC2B5311396F694605F821
+0
+71BDA1AA7F9ADA50E3E5CF6517D43D5A4D8A9550682D6666C2E82686
+890477E9E54D379522795BE1C03F25F48BCC2B5311396F694605F821
+0
+8C421D1D941EC230FC24EBF69695431801323C770328B0D0E9036643
+40AA9D9DAE720A27EF1DE6F9709BB8C40F9FD7C4870992D3E5268271
+0
+8C421D1D941EC230FC24EBF69695431801323C770328B0D0E9036643
+40AA9D9DAE720A27EF1DE6F9709BB8C40F9FD7C4870992D3E5268271
+0
+4
+ecdh_phase_two_batch 496
+5
+00000000000000000000000000000000000000000000000000000002
+517E13C5EA9E2E31B608283D99DE43CA9AAE22018E19FE28B09A3F3A
+06C8261D2530F6416A4C1A580346CCAE454242052099FCCFD35B5220
+0
+06F7789C340E325724B557E1C60E4E268D10226E437B251D5F454F30
+7EDBC03DA176BF5CE28196397C6C12F2B1E0BC4D5F12CD3EE487DEE8
+0
+E9D492998C2EE92AF18BED2622E83E907A795114E98DF192E456E17E
+E96DF2E95ED449EDAC5DCB4531C6AF57EF404F9C31B03D47188FDD7D
+0
+D3C4C36597293CB45149E0518F56C6433EEFE0B56E4FD809E4812648
+70F65B5F85799792CC819E2EDBC7E871E90142D56AAEA18C2BC4C95D
+0
+CB72124112B6E6DF5DEDAF6C94670D66081E7F3EBAB698BB9DD8E801
+20418A1C068058EC85881EA4409E2484438957ECECB8BB5B4FA3FD1B
+0
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+51E14D296FB375F7356655895EC565841EA87C0FAF7F94869271642D
+CB7A5E4858AD1DEA3B2EC97AC38A8F00EFF9380D41CCA54B455083AD
+0
+9B2389116F25A9DFD95CE654B103A8434F471731163C0320502B6641
+25E1F06D25F71EA9CF847A62A601AD0F7A1168F392FD66D2E68305B4
+0
+FE64A6F9EDBF3C28E1D394994EF2A24F25264B8FFDDF742EFE620327
+16E27DEF800A93CE208652213CD70E6F53B1391401CE73C0AB518F42
+0
+0429B760DA489183E38ECFE5F4AC9E8272AE1B5CF543BB91237E0602
+7A48974D3F7AC948C88E263AEF2E4AA30A3ECB66C93C4171823C2483
+0
+4
+ecdh_phase_two_batch 497
+3
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3C
+2702ACC66F3B8ADA6FE86945308C660D66C7019F1C47AB68AE49E82B
+9088B2278674ECAF6ACFAB3FA02ABC56A1A22590E4790CF638727303
+0
+2702ACC66F3B8ADA6FE86945308C660D66C7019F1C47AB68AE49E82B
+6F774DD8798B1350953054C05FD543A85E5DDA6F1B86F309C78D8CFE
+0
+E07567DBAFF080B7801F9A3D80FE19722CBF45EF29220F6FCF45C3FE
+DD66F16F3E5A2A35BFFEBC1314FF438996B0367D52FA568C31AD68F0
+0
+E07567DBAFF080B7801F9A3D80FE19722CBF45EF29220F6FCF45C3FE
+22990E90C1A5D5CA400143ECEB00BC75694FC982AD05A973CE529711
+0
+10FABF069E37926FA87F1DC9892D9942F8AC4FDB441C48E429CB6480
+3F4571262F48AC716811C46C251979DDD60E9C8E832F0C7F179F45F1
+0
+10FABF069E37926FA87F1DC9892D9942F8AC4FDB441C48E429CB6480
+C0BA8ED9D0B7538E97EE3B93DAE6862129F163717CD0F380E860BA10
+0
+3
+ecdh_phase_two_batch 498
+33
+E126DA5F84503662B3F9E831FFCDCA992943BA4986B19B54D40D1F74
+5D170A3DF6DF2309B1EFA2B9D586FA6521D8592D9C324018AE4DC2CB
+3BE0F07630B55F6E9128B6983327D517204A582AC02B4EB778ABD96E
+0
+E4FE3AC1AC99BDECC0E4B1D26BC7CD9643C70D21F77D739C6CF31879
+207F5CD00FCEA0C4B34E49E1901D3554EB5EAC796D98B95892294B52
+0
+3FDADE6BB5EC9046C6394112D71DBBC5B441ED414D771403E888DF6B
+AF50B0534DB8364679D0CCE8C2367646CA230590F5F6D0F80ADA72B6
+0
+F866797075CCD70B366E89250463F44EC666D1F80E3BE25489230279
+662D8B8EF37BB9946A3A3FF90B633DEDA3D2224E49E713CCF23FA095
+0
+214E3494D6265DBD5B420D1A89C56B1AF6A2571D19504F0A65B39BAC
+ACFD9C25BF2879E57BDF466A68C1315BB16652FD63A987035FF5B9C4
+0
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+9A6DED69F34A8C33B54AB0BA8B39EF101267887D06E45EAD170A3667
+DAF81E3C5C4710DBEA9CB087E87FD1509EE265EFBF25212DDC42F2FC
+0
+85DA6C480494C766CC2A0863B5863733E0D7CBFB4574C62CB78676B0
+9D92017969E5E7E46B5DBEBBCA03C39AA427C74C42103351FD88D190
+0
+797B6D2A4DCAD292A217B912EBD922449F8590C9FED2B949BD39124E
+9E492FEF93A4A151B8B2D5943A527B29D93EF9894DF465B8F01366F7
+0
+6333206A031C9C1DCBBF4918DC8E551F2BFD88ED7E6BB2205C8ACF3F
+7B48D096B31E7C66C01DF46B6F6F42D79AEBCB4A820A21FEDF3FDCD7
+0
+629663CECE657BAA5C1BD56DCA1CC99628C5302E2DEC2F26EABAC974
+CE66604887FFD37A3D7E9E75B6AD596CB2AB1B1BAAF22E0BCE76E0E4
+0
+161636E7D2D1C554508CA1EABE691D8141841374650598DA3FFEE01F
+205C565FC41B74D6341B529D7498128AB7A0DC85D538705BAFF9BC48
+0
+4D1AB6AA2FE66733AC745DCC69644394AF6DB0C5C8518DBDA00F4374
+5A2ACF6530CD97D14523ACA69EF7E6CAF95798DBB480495BCE920A10
+0
+C3E4C7A29461A1562F7C5DBE3589F5BE26DD4CA521DF637BDEC8F529
+06F0959C39EEA52CC1FB12C1CF8719464F72E02BEBFE7B94F2F9F93B
+0
+376F27A5476AC6F694F636AA99986DE42ACD4F141830F75606BE84A0
+FDE54CE190C9B0F5526CE891512BF8680FBD738D68EF67D51D37E368
+0
+5075178258262D1443525ACDDEFAA0042289BBBB03975FC28C9C6C06
+32554A6A5776719EDE15FF8DB7A8E257E5C507AAE2A953333EB1C741
+0
+1BBE52D0C5E004367A6CB87930629B7FADCE5A8DD22AFB4441A4744B
+3B788DFCFDE4DED9C200EDE38BEC39E5EDBF92A904628DB389408225
+0
+5ABC56EA5319E34EDB9AFF1E06C76D1328F941FEF85E6FBD96591370
+AD2486F8CEB5D432B973A13B605489AF051E822997FD66674EB848DF
+0
+09F322CEE9C58936FC5FBE6744C5B86E61FF8FFB2B737E963D35FCC7
+E8D4298A63CE16A2DAB6583C196ABE8AF9B0C05D6F17B18E6DCBE877
+0
+22013A96001D4756D24464E6076D536EBB44D7761D0914D696DA6BB0
+45123509B9B8C19E98D68BEB284271713A0DCEBC151CBA7484008D54
+0
+B64A015946413A2FA6B5D304D436FEE6FDA4E78A5355CB02D769382C
+DF6C725E5665A0A998F931340EBCA04A3ACF4FD136B0B3F8359DDF91
+0
+64E947AF8A89D755BCDFF86DF07E8AF97C185125EF3392C0C29D1E02
+A5C14E2CB7D18204CE0EECA5D55E95F35EB7C4B3E6C222E1DCA57DEB
+0
+721E7DFEEF7405B7F31CA160CB69EDAC12B995557B17FF0710AC924C
+B375C1305A738578EEE2D310531618E9DECA8535C19BAFFB5DE6AA90
+0
+169F435A4CD95BE694D35AE9C3793ACFBB84B2392B650B02DAB8387B
+1278308D75BFC5D8EDBA24805C806E8531E5FADCA72C1CD6B2AB8912
+0
+8E33BA181398A3FA15E30BEEEFACA905700C9A057033B50FC626B8C7
+225199DCAE2F1511B12B9C149102F1D9AF60FB5634AA40E2D5C0685D
+0
+DE4F3A5AB146AE37F7D407487EA5093150CD7EDF17ED283F71BA43DD
+1E936FB607E0FB2F55754A45335DA610945DE2584CD0992CFB7508EB
+0
+659E409AB9974E3C297D2E0A647862E837BA8545F51448741081828A
+C8D353270B92101F7C49379659A7AA9A27808F3F920F48C739F64076
+0
+8BEBE2EEC8C056A79903E286A184EC4325E317940FCFE49AD6A705FC
+BF0F3C83A0B3B9D1EDAC48CF22362BB7751A997F82D49407B50461C5
+0
+25AD9AD45E3942447B638C8C7EF12AAB98DEE35B8C9FD9315F2C5AB3
+7AE2931E0B213FD75C4A76CED5192E81D043C8F3BABA4BCBC32619F6
+0
+F5CC0E48BC99F1C7548A5838E48295470563F757CF1B1DAB83662910
+6432957E93BAEAF2013664971B9679C02A5C4AC7CB56237960265445
+0
+3E428A5837169FC0D56990B4E1D4E9B28D560022E9C54A8D316C7834
+00A25F29FFC156BC97C9FCF11B3C7666167A9072A08D0C6C9C83F81C
+0
+153E3D726A3B07B45512FD0F16F34FBE431B7F44CB95D18FA22ABBAA
+162D96B282C6516A86F1F2F79EEC65FB577FF9E1979B84E16BE76F4D
+0
+726C407215C423159EE4E8DCB0DB149C3FE6BD2C82B518CA7823C9A6
+CD40071E4845AF4BC50D66A411D6F68A6F3FFEEC719E1A3F065ECF86
+0
+7CC9B0CE00F66C8FE9F4B2D50BBBED81A8C88F795AD13D9FF681F4FE
+5A697787816C8432174A1E13D6AF75EA55223CC9DBEC1B6EFB4DCDBC
+0
+A2DB01765B6866A1022E4689D6CE04D980251947328F0579F10EB600
+9A36C251AF58534EA4E46C7B50FE6BFAC7366C6D5969ED198B0E917A
+0
+E5AC2B3E8276F80D64B39D880ABAC1C863E244B6643F49D324FD4478
+E97BE1AA2D60E24A60D0D1C5236D13F289E08C886485BD47466769C9
+0
+89558023644DB08D1B3F9B3E54BDE8466FCC545DF0EA73E3B567451B
+D633C2D672DC3A58B04718E2F1A66A8A4DFD8F598517DD88CFC16ACA
+0
+6E94E9C7BC8F1678A37284F835593177E2623EFD05B075D99A1B415E
+14E61B00BAD5D06AB9ABEEF0916D586CE7DE4970FB464DD95AD111E7
+0
+BCCC3C9BC3A3EB5F54BC909E7C938E36C816A466E0A9C167D1B2A57B
+836FEF2E9454E9E4CDA2407E0672DFE95EBCE378E9578E6422AE8664
+0
+54144E28CBCC302B3E0C6D0DD4BA03694E3F7D2E09FFED88832614D0
+50A49BB7BD36D96B25AB5C106D4A72C96457021E1341EABA60DABCB5
+0
+5A4CED53856DFB8659073C0D52D3C8FFAAB5FF407EC2DA3360182FC8
+806B48DAD530CA8EE7DE52F62DFAD0A25D351C7A975633C0C08E18A2
+0
+06620D3B8EF9C0262ABA65FF18ACD84D55C42C0EEEA6AA32C05BC30F
+B287B6DD7A2600FF5E3C2CEB479D79561E70D131DC21CC06E007CF3E
+0
+A40B0F9642EDBAF7277CAAF65B0D88B2DD66BC1CA045754E3D65250D
+A99279806AD5695D07923FD666079F5AAC62AE07DF59D2B6AC3FA3AD
+0
+6223E7BB5FC8A208440B6162B55B97D8325A1358A080403DEAF50F0F
+B7BA62C93C7C3DA999AE3376ACE4D9D06D6144D71B92122FDC365055
+0
+7DD4B4A96D0D54F3F9723EC22B43FE6AB1DF0128AA3FDBED71D15342
+93A195A6CFCE2DBF93613600CEC495ED40E7AB12D5128CBAD58DC914
+0
+3458E2AA1B49AE70D5EDE9377BC585AC90BFA7A741CFA5D8C0764F99
+A8A685E016CA73CEE4067399D5FC7F22F369E155FD547E58AE0A4DFD
+0
+BA43D1B065BCA7E150A97BFFA2D759EF091767E5BD61EAF93E028AA6
+D37713F465A6C7EBEB01503E491E3ECA857B99FDCDB48C441628BD2B
+0
+EF5A5B00781CD9BB2037E39B17C5FE9947B0FA71AE112AB1D0A20172
+7FE3359EA1D644B92C1BB27A322EC25CC699B7284D5A34A3E049670B
+0
+98929853D93CD1CE902BF335C09DC2D524CD020170034EAA05358AB5
+53F75B5BBE59F42D87BD2B727ED9F859A13B6B6272DE8982A2FB8824
+0
+7C5AFC9592EFD563083DC884D841C593EB74314CE3DBD05F5DB9B516
+0BECF0EF692B1B963AEDC94BC9FE4807BBFE9B1BC9F375C2E4EC89B2
+0
+84897D7C87F9D7301B226C73A6E4A1DD5DB63BB2AB5CC1EAB5DEA1F1
+3B56AFE633B915AF4C0F67D86672A1425D6FF4DBA8F70D8931455DE0
+0
+944D7784B95D4CD035483C6AA010D4DBBD9A6318E7B5FD511A566C2D
+E1F580341B309FE900760500BEF51ABE67EC815F14E898196451878A
+0
+498543A341B2B24C337391408FF74DE00BFBD92ADE16F7CEDAFF244E
+900F81D462164CC47D5B7E2BA0BFF1F307D1B246327F4A1F9D4B5024
+0
+494B8E88D2A0A10AE70D1423633E99773469BB6FDADE1FF4EC10BFCD
+B956A1DD5E87F0F607DE37475E4D3ABB1F8F5D8C45DE50F68EF3DF0F
+0
+D6AF671D78C05370290183962AC424DF9763726ACC64FAE8AAE42CFF
+D3A2AF1AF1422F5F1DCDDFDB97DC6FAD42ACC7820BB95EBFE935E660
+0
+4546DC5D24288CC672DCC9BF6B6479D16346E6DFE47D52704BBCE40A
+C3ACB2BF3F45218CC7B206BF5E6E92DC97E381ED8D687B1474F6D1FB
+0
+8FA3D88E345B0801374FD6297B29E11919E851CE5EC2D12D17469ECC
+A88436083598857718755B23C353F04FFB6E13C3EA22C2A2D635B0C0
+0
+9CF10A1AD2D0D1D64351BD13F40B0C44064DB942CC43E906A2FD7252
+306B46DC52A6209F5F1278ABACD779C061EF1C5AB8E687EE4710979A
+0
+196C872D54035592EA453B32F09617A56290584500C2F45B8918F2B2
+0948C1711B14616165FE9594F9515BC9E55024F2592B36D0CED56D82
+0
+3B100A912191777F8CE7EE4997E14E0D5E2B49ABD16524259DF9D08A
+5F90BA430E732A2F62F9978D38BDFA1632E804F9CF2E48A899B1B42A
+0
+223904EA951075B93CCF5FBD2EBB3048DB150E20DE30D9C39D78972D
+5D2A8BFCC34537C32237099EF0F5F70A45D08135B88466DD9A645511
+0
+599CAE75E9B9C48AF3063C42A8C4F387008FF0C88EAFAD807C523D76
+9A06446A8B94452F4CF7B60A6F05C83394B7E931D19A6360CA0C2169
+0
+42A6E6A308D40E64B2C35C55642B92CB624F6A1F901900C72342E9D9
+954B8F89156D7ABABFA8FE72F3A5C71F4E1F76B8CC9029881F79AC36
+0
+961B31CCA7F30E46CFB987BEDAFBDBADB91854AF65E70190AEFCD113
+DB6220574E72E6E73840415FACE13D0C646348980A720C82C04853B8
+0
+12421A6D6F630C91F841964C033B6926D1470AE5C469E6E5B1D082D9
+1FDDEF998F9AE681D25E5F0EDD7C047E219401638A48BE0748CD16DF
+0
+4EBA6AAD953BCCBE9883C41FEF60712C30F3E4356CF81C5E10F7C61E
+AADF9FA82CE5FCB42DDA8066B489C8BCF5F47933FDE7BB3E2804D2A8
+0
+32
+ecdsa_sign_stream_sha256 499
+DDE4D8470DD5D91C4BBB8DD1238FC9854C6747268395E75973CB0027
+4EAE41ED5AFCAD9329062597A43E7A1B4F5E9502A20C807359FA5905
+F5E46081FE3E065380D169699AFCA38D003A51C748E4E22A1B0532B6
+0
+8B
+1
+ecdsa_verify_stream_sha256 500
+4276426FEC89F822A66BBC9EA50CD8FABB664C960B2B783C82C21C94
+CD0BEC01A98A092AEDF61F164803D2E3005769BA5B8D0BF0D4A653A4
+8B
+1
+4EAE41ED5AFCAD9329062597A43E7A1B4F5E9502A20C807359FA5905
+F5E46081FE3E065380D169699AFCA38D003A51C748E4E22A1B0532B6
+0
+1
+ecdsa_verify_stream_sha256 501
+4276426FEC89F822A66BBC9EA50CD8FABB664C960B2B783C82C21C94
+CD0BEC01A98A092AEDF61F164803D2E3005769BA5B8D0BF0D4A653A4
+8A
+1
+4EAE41ED5AFCAD9329062597A43E7A1B4F5E9502A20C807359FA5905
+F5E46081FE3E065380D169699AFCA38D003A51C748E4E22A1B0532B6
+0
+0
+ecdsa_sign_stream_sha256 502
+248B611BE6EF0AAB3C255B18632B9649C38A68475AFF3DEAFE9DBD16
+998E27CA3A03D59EAD85E4342DA2B7BEFE9170B79519B1C2BAF8F755
+E32FFBA1CE532CB4430084A06100D244C8B52702336F50BB2887F744
+0
+4D58BBBBE0E666FEFE5DB7EB6D289AB337D6EF220F68FDCEF2E1131B5EA04ACFD46FC49BBF951283BBBA68900AA36311A261326FAF0E3E
+7
+ecdsa_verify_stream_sha256 503
+4480DB2952F68C10A8062F624A3AE38D2E08AE46B02D2C9A2A0FE577
+6E60566DC544AD15EF0F491CFAF3415A5448C87706C75A8B77A76005
+4D58BBBBE0E666FEFE5DB7EB6D289AB337D6EF220F68FDCEF2E1131B5EA04ACFD46FC49BBF951283BBBA68900AA36311A261326FAF0E3E
+7
+998E27CA3A03D59EAD85E4342DA2B7BEFE9170B79519B1C2BAF8F755
+E32FFBA1CE532CB4430084A06100D244C8B52702336F50BB2887F744
+0
+1
+ecdsa_verify_stream_sha256 504
+4480DB2952F68C10A8062F624A3AE38D2E08AE46B02D2C9A2A0FE577
+6E60566DC544AD15EF0F491CFAF3415A5448C87706C75A8B77A76005
+4C58BBBBE0E666FEFE5DB7EB6D289AB337D6EF220F68FDCEF2E1131B5EA04ACFD46FC49BBF951283BBBA68900AA36311A261326FAF0E3E
+7
+998E27CA3A03D59EAD85E4342DA2B7BEFE9170B79519B1C2BAF8F755
+E32FFBA1CE532CB4430084A06100D244C8B52702336F50BB2887F744
+0
+0
+ecdsa_sign_stream_sha256 505
+A883BF30D96172A25E9401DD868171B8506EC0052C8AA2BA7AF76373
+52AF32A20E843E0FF39C7CE9C6D3B42B23FFCDDBBB89EFAF8A49983F
+5498EA2D17A7D1FEA9282B50A91B215A00FA38CECFC39EFFEFB4A892
+0
+40AEBE94D16F03099BA4D1CFE823DD4CF8E7F410F403D16272AE803F1A049D8EAE1541206D54743C9068389313493DB571FF33BE7B085946A26B2DF09C736451
+64
+ecdsa_verify_stream_sha256 506
+BB6F6279922FD732DEF41A5B65B1FBB909CBBF576131918F9287A557
+A8EBADBFAD624A3D1E13D0D8A632CD3EF318F43DB0A71FF5284ACDA9
+40AEBE94D16F03099BA4D1CFE823DD4CF8E7F410F403D16272AE803F1A049D8EAE1541206D54743C9068389313493DB571FF33BE7B085946A26B2DF09C736451
+64
+52AF32A20E843E0FF39C7CE9C6D3B42B23FFCDDBBB89EFAF8A49983F
+5498EA2D17A7D1FEA9282B50A91B215A00FA38CECFC39EFFEFB4A892
+0
+1
+ecdsa_verify_stream_sha256 507
+BB6F6279922FD732DEF41A5B65B1FBB909CBBF576131918F9287A557
+A8EBADBFAD624A3D1E13D0D8A632CD3EF318F43DB0A71FF5284ACDA9
+41AEBE94D16F03099BA4D1CFE823DD4CF8E7F410F403D16272AE803F1A049D8EAE1541206D54743C9068389313493DB571FF33BE7B085946A26B2DF09C736451
+64
+52AF32A20E843E0FF39C7CE9C6D3B42B23FFCDDBBB89EFAF8A49983F
+5498EA2D17A7D1FEA9282B50A91B215A00FA38CECFC39EFFEFB4A892
+0
+0
+ecdsa_sign_stream_sha256 508
+721D4F1D43A81B6B07614808A51AEE21801CCF15845C38A56E853C44
+0EC2D5884BC7993F7FE72DCBD2DD101E42CF26E73CF5B3CA0CAEC0DA
+0D8049497A496F5FA8CD9748F6C7B554AC246763CE0F875ECB70E467
+0
+AF49721D7AC0D3CE51A5F71D0C82C6D4FEAC00DDF7363483B3375D8A549A449731183E087A6F45DE77D2B32A60B74BD80FD56BF9297978C8A5C3FE82A554952A0B
+64
+ecdsa_verify_stream_sha256 509
+E5C9FB32DCF09771BD66D9EB20CAFAF8DAA2A637570CE2D3641E6080
+9AF97C770BCFEE7D13DFC6C7A218404420395A4E510EDCCF8D475E6A
+AF49721D7AC0D3CE51A5F71D0C82C6D4FEAC00DDF7363483B3375D8A549A449731183E087A6F45DE77D2B32A60B74BD80FD56BF9297978C8A5C3FE82A554952A0B
+64
+0EC2D5884BC7993F7FE72DCBD2DD101E42CF26E73CF5B3CA0CAEC0DA
+0D8049497A496F5FA8CD9748F6C7B554AC246763CE0F875ECB70E467
+0
+1
+ecdsa_verify_stream_sha256 510
+E5C9FB32DCF09771BD66D9EB20CAFAF8DAA2A637570CE2D3641E6080
+9AF97C770BCFEE7D13DFC6C7A218404420395A4E510EDCCF8D475E6A
+AE49721D7AC0D3CE51A5F71D0C82C6D4FEAC00DDF7363483B3375D8A549A449731183E087A6F45DE77D2B32A60B74BD80FD56BF9297978C8A5C3FE82A554952A0B
+64
+0EC2D5884BC7993F7FE72DCBD2DD101E42CF26E73CF5B3CA0CAEC0DA
+0D8049497A496F5FA8CD9748F6C7B554AC246763CE0F875ECB70E467
+0
+0
+ecdsa_sign_stream_sha256 511
+79FF51D816884BA7623F25C8E44CC32829B0A6373B524653AE4AABBF
+249D0E3589294E9B52DF5867A376855051CE3AA63867AB2B443A589E
+5E0755B43FD3F524455C86EE09E4F900FAE883F9A8CAF698FCEF8E5D
+0
+061248EF7BD64D411377536EA8913ABF124982847552F09EDC512DAF717EDC3CF7D3AF06D076310AC9CAC8CDB28971D6A4C6492A8E6DE52CEBD0BC6F01095E5AED87089D1EA03151175C359EA895FAA938984ED88966489F690ED4EF4EF529D7BCA7A508542A325897E6E95BE80A2EAF31CD9870247A9D
+13
+ecdsa_verify_stream_sha256 512
+DFBB4FF955AEF1D52F8F0D94A119FAF18BDA14204DF7E967C84E31C2
+905A3BABE2989225754405F7B0DD112D6CC67212842BB3C31F66C4BC
+061248EF7BD64D411377536EA8913ABF124982847552F09EDC512DAF717EDC3CF7D3AF06D076310AC9CAC8CDB28971D6A4C6492A8E6DE52CEBD0BC6F01095E5AED87089D1EA03151175C359EA895FAA938984ED88966489F690ED4EF4EF529D7BCA7A508542A325897E6E95BE80A2EAF31CD9870247A9D
+13
+249D0E3589294E9B52DF5867A376855051CE3AA63867AB2B443A589E
+5E0755B43FD3F524455C86EE09E4F900FAE883F9A8CAF698FCEF8E5D
+0
+1
+ecdsa_verify_stream_sha256 513
+DFBB4FF955AEF1D52F8F0D94A119FAF18BDA14204DF7E967C84E31C2
+905A3BABE2989225754405F7B0DD112D6CC67212842BB3C31F66C4BC
+071248EF7BD64D411377536EA8913ABF124982847552F09EDC512DAF717EDC3CF7D3AF06D076310AC9CAC8CDB28971D6A4C6492A8E6DE52CEBD0BC6F01095E5AED87089D1EA03151175C359EA895FAA938984ED88966489F690ED4EF4EF529D7BCA7A508542A325897E6E95BE80A2EAF31CD9870247A9D
+13
+249D0E3589294E9B52DF5867A376855051CE3AA63867AB2B443A589E
+5E0755B43FD3F524455C86EE09E4F900FAE883F9A8CAF698FCEF8E5D
+0
+0
+ecdsa_sign_stream_sha256 514
+18601D1248FF307C5879088FAC8BC465B3C9B45254C022ACE11ECE88
+44B692AC5F82132D8E7C92B2ABE7421EF3FB61BD510DE2DC87C136A1
+DB6E3690B29FC93F1B0BBEF37AEDFD4ABC413F223C01C6C11C9CBB9E
+0
+B64C97CF0743C2993A15D11AE6CE5D67D7421F9A3CACC8EC12452A6D774CEF1520B431E677B6047F3758EFC5203F8006FDC59166B99537AE3890FD7A86128F5AA48E487CB8469B7B3EBA32AB30A2FC6B44B386435FD507785FE87C8DF239C4C00BE85A4A540131D26E3AD44E902A64C106A2527B1B71CEC9A94684AFE62DD970F4C2E73D6D5E625FBFB1DDE97B6CD05560F79353603D2AA6BF13E9038C508184A5D0FE854B2B8B42C8BDAFC4176BC44C0FB4C34218A9F4499BA577D8EE2FE16E7E2402B9624D9FB1
+1
+ecdsa_verify_stream_sha256 515
+AE95F80EA200379DAE1DAA438C373911A19C0A542FAEDC4B73B17D5D
+A6C74EA710A4E42EEFAA638797CA40710EB7566F6757633704711E07
+B64C97CF0743C2993A15D11AE6CE5D67D7421F9A3CACC8EC12452A6D774CEF1520B431E677B6047F3758EFC5203F8006FDC59166B99537AE3890FD7A86128F5AA48E487CB8469B7B3EBA32AB30A2FC6B44B386435FD507785FE87C8DF239C4C00BE85A4A540131D26E3AD44E902A64C106A2527B1B71CEC9A94684AFE62DD970F4C2E73D6D5E625FBFB1DDE97B6CD05560F79353603D2AA6BF13E9038C508184A5D0FE854B2B8B42C8BDAFC4176BC44C0FB4C34218A9F4499BA577D8EE2FE16E7E2402B9624D9FB1
+1
+44B692AC5F82132D8E7C92B2ABE7421EF3FB61BD510DE2DC87C136A1
+DB6E3690B29FC93F1B0BBEF37AEDFD4ABC413F223C01C6C11C9CBB9E
+0
+1
+ecdsa_verify_stream_sha256 516
+AE95F80EA200379DAE1DAA438C373911A19C0A542FAEDC4B73B17D5D
+A6C74EA710A4E42EEFAA638797CA40710EB7566F6757633704711E07
+B74C97CF0743C2993A15D11AE6CE5D67D7421F9A3CACC8EC12452A6D774CEF1520B431E677B6047F3758EFC5203F8006FDC59166B99537AE3890FD7A86128F5AA48E487CB8469B7B3EBA32AB30A2FC6B44B386435FD507785FE87C8DF239C4C00BE85A4A540131D26E3AD44E902A64C106A2527B1B71CEC9A94684AFE62DD970F4C2E73D6D5E625FBFB1DDE97B6CD05560F79353603D2AA6BF13E9038C508184A5D0FE854B2B8B42C8BDAFC4176BC44C0FB4C34218A9F4499BA577D8EE2FE16E7E2402B9624D9FB1
+1
+44B692AC5F82132D8E7C92B2ABE7421EF3FB61BD510DE2DC87C136A1
+DB6E3690B29FC93F1B0BBEF37AEDFD4ABC413F223C01C6C11C9CBB9E
+0
+0
+ecdsa_sign_stream_sha256 517
+A70703893038C31ED0C6C39BA690EC283F441339CA34EC8659D00EB2
+E55CD8A3BF19E5D5558A6FD2CF88ECB92C0ABA456D68E0D0120BF003
+15C53B6B4A143453865F522F7A566C4C677DD69DE43E05D5F76E723E
+0
+6A3AF788A2415A7423E953B7CA667661E38135E150B48B65F69F7FC86901941F31FE72E80E9ED70BC300F4002D6F09CD61479D8ADB859EE4A5E5AE1BD17DF133363C14B501370E261FE95CFF725A1218F9E00C8E7D1C1134F8B30A3442ABD5BE8C17B97B4BEAB47D89202CEA667917F146E1145A1E57877CD2DE23EF48A2F500DE943E7F90551A93A637D293E9B27CC91B8936E6D770037861F23875BAF5E53D386F20D4546A8D7FE1C0705A57290C1274889057B7BB4499911AB41835493F42F861D767E26AAE0ECC005D9C04A516B7E23B73109B9918725033459A999FCDDA30359F2C2E2F337BD917D33FBCFE7D2B467940C86FCEFA3975C32F4CDA581F0A540407EDCE981AEAE3E9DDCACA3E592B8E6D4E7F0320F01323ADEC7F66127A36B10B03B906A6D06B3AE01E4161EA5C53D9C169FAE035077000CBE09C33CE907AEBAEE32BD9B6F025B52D581A4E25A285B8FBCF4209F2B7D6E405D5B52E942486F5866FBCC1CCE9B6F575C851EB53F5927476DF92BA5259F9C0C4DB9D22F62E6332C2F4A61CC8C5D118AA3C70A9CB57
+100
+ecdsa_verify_stream_sha256 518
+1E2DFC2B5B20A3C906B6E122A39268625DBF6CA5CFB3DD37E09B445C
+C0A4CBC005F6663959BA32E9625F9FCB94C54A85AE49C1A86079F22A
+6A3AF788A2415A7423E953B7CA667661E38135E150B48B65F69F7FC86901941F31FE72E80E9ED70BC300F4002D6F09CD61479D8ADB859EE4A5E5AE1BD17DF133363C14B501370E261FE95CFF725A1218F9E00C8E7D1C1134F8B30A3442ABD5BE8C17B97B4BEAB47D89202CEA667917F146E1145A1E57877CD2DE23EF48A2F500DE943E7F90551A93A637D293E9B27CC91B8936E6D770037861F23875BAF5E53D386F20D4546A8D7FE1C0705A57290C1274889057B7BB4499911AB41835493F42F861D767E26AAE0ECC005D9C04A516B7E23B73109B9918725033459A999FCDDA30359F2C2E2F337BD917D33FBCFE7D2B467940C86FCEFA3975C32F4CDA581F0A540407EDCE981AEAE3E9DDCACA3E592B8E6D4E7F0320F01323ADEC7F66127A36B10B03B906A6D06B3AE01E4161EA5C53D9C169FAE035077000CBE09C33CE907AEBAEE32BD9B6F025B52D581A4E25A285B8FBCF4209F2B7D6E405D5B52E942486F5866FBCC1CCE9B6F575C851EB53F5927476DF92BA5259F9C0C4DB9D22F62E6332C2F4A61CC8C5D118AA3C70A9CB57
+100
+E55CD8A3BF19E5D5558A6FD2CF88ECB92C0ABA456D68E0D0120BF003
+15C53B6B4A143453865F522F7A566C4C677DD69DE43E05D5F76E723E
+0
+1
+ecdsa_verify_stream_sha256 519
+1E2DFC2B5B20A3C906B6E122A39268625DBF6CA5CFB3DD37E09B445C
+C0A4CBC005F6663959BA32E9625F9FCB94C54A85AE49C1A86079F22A
+6B3AF788A2415A7423E953B7CA667661E38135E150B48B65F69F7FC86901941F31FE72E80E9ED70BC300F4002D6F09CD61479D8ADB859EE4A5E5AE1BD17DF133363C14B501370E261FE95CFF725A1218F9E00C8E7D1C1134F8B30A3442ABD5BE8C17B97B4BEAB47D89202CEA667917F146E1145A1E57877CD2DE23EF48A2F500DE943E7F90551A93A637D293E9B27CC91B8936E6D770037861F23875BAF5E53D386F20D4546A8D7FE1C0705A57290C1274889057B7BB4499911AB41835493F42F861D767E26AAE0ECC005D9C04A516B7E23B73109B9918725033459A999FCDDA30359F2C2E2F337BD917D33FBCFE7D2B467940C86FCEFA3975C32F4CDA581F0A540407EDCE981AEAE3E9DDCACA3E592B8E6D4E7F0320F01323ADEC7F66127A36B10B03B906A6D06B3AE01E4161EA5C53D9C169FAE035077000CBE09C33CE907AEBAEE32BD9B6F025B52D581A4E25A285B8FBCF4209F2B7D6E405D5B52E942486F5866FBCC1CCE9B6F575C851EB53F5927476DF92BA5259F9C0C4DB9D22F62E6332C2F4A61CC8C5D118AA3C70A9CB57
+100
+E55CD8A3BF19E5D5558A6FD2CF88ECB92C0ABA456D68E0D0120BF003
+15C53B6B4A143453865F522F7A566C4C677DD69DE43E05D5F76E723E
+0
+0
+ecdsa_sign_stream_sha256 520
+A36EF6510EAAE74AF971C3E56D97302131DE873AFF9D1B3A9C8A7572
+CBA2FACDAFF428E0BD45D00E33DAF1B6BE22ED4F86D2246ECB57ADFA
+70DE3775423A9EB08EE42976DB4EEED8028AA4349220EEF135AD64D4
+0
+834A4F4B9BC19ECE6E6B14207341BE86FE4FAF70D0F48A8B5236D488ACB75CB93FC653B22A6A03BCD102E6C290DED18AF5EDC22E8B80341F7DB4F7555853D1A60F88E26267C7CCA8EB0E81555C26CA3EFA91CD4BC8E491BF60EB116E0080B461F3A65549CC373671CD4F076CC85E7CB507AEDEAC5F1C41F2FF5EF562F6824F54
+400
+ecdsa_verify_stream_sha256 521
+56568E40765BD406195EDAC1C2CACBBE983097BCDDDB43384278BEC4
+62F3CD9F14BEA8224D342F5F39502FC15306BA000BE94756BE6D21C9
+834A4F4B9BC19ECE6E6B14207341BE86FE4FAF70D0F48A8B5236D488ACB75CB93FC653B22A6A03BCD102E6C290DED18AF5EDC22E8B80341F7DB4F7555853D1A60F88E26267C7CCA8EB0E81555C26CA3EFA91CD4BC8E491BF60EB116E0080B461F3A65549CC373671CD4F076CC85E7CB507AEDEAC5F1C41F2FF5EF562F6824F54
+400
+CBA2FACDAFF428E0BD45D00E33DAF1B6BE22ED4F86D2246ECB57ADFA
+70DE3775423A9EB08EE42976DB4EEED8028AA4349220EEF135AD64D4
+0
+1
+ecdsa_verify_stream_sha256 522
+56568E40765BD406195EDAC1C2CACBBE983097BCDDDB43384278BEC4
+62F3CD9F14BEA8224D342F5F39502FC15306BA000BE94756BE6D21C9
+824A4F4B9BC19ECE6E6B14207341BE86FE4FAF70D0F48A8B5236D488ACB75CB93FC653B22A6A03BCD102E6C290DED18AF5EDC22E8B80341F7DB4F7555853D1A60F88E26267C7CCA8EB0E81555C26CA3EFA91CD4BC8E491BF60EB116E0080B461F3A65549CC373671CD4F076CC85E7CB507AEDEAC5F1C41F2FF5EF562F6824F54
+400
+CBA2FACDAFF428E0BD45D00E33DAF1B6BE22ED4F86D2246ECB57ADFA
+70DE3775423A9EB08EE42976DB4EEED8028AA4349220EEF135AD64D4
+0
+0
+ecdsa_is_valid_batch 523
+1
+0A61E23275A2744AE16365281F9011EEE1FB285BA35C8BF78C8D665E
+0C7DD93060DBFDB28377F1519DEE1EBD61A58E619113C0E7AEAA951D
+37BD09478218A0B75C1BA30BE84D5758005A6094CE9253C7635B5916
+CB7BF6AB04302C9AC3C9619A6A75F89D216BCA4F57BDEDA2794F4344
+3FC3F31A00903575EDEC67EC446D18DA21928C7397C6AC69AA6FAAEC
+0
+1
+1
+ecdsa_is_valid_batch 524
+5
+2AC48C8E653FA539A54528E7E642E675B0259E60C9F3935E188D83BE
+6BEE89E712A8FB9811BAE20B2831FAF1E8F799A6F0395720085C7AF2
+B03A051E05F5814817476C2759795A147B019D972EAE6F8DFDFCF552
+B9A605EC84F57EAF5887BDE52D030F485885D61AE53349F029DB4017
+5446755A439954CFA904F7B9B6AE79B792FDCE21ECA724ABAB92E63B
+0
+1
+E85EF3DFAE198B664B4CB87ED2FA1D92A9FB427E27FD1A2D0C951AC3
+03124E7A9E74D16E263D561327D75DDF29C147D42E0FE70991719C3B
+5C72E92B1C416C553A2A2A9EB8F8442531DBF5944B52C21DACDB8820
+9E9B1F8674065ED544C949FE57C40AE09F1E4552928B5F4100CDDAF0
+8A5CA302F325829C2B54E18F5E0C37D6D0CC5C1120DA35538CE50F76
+0
+0
+DC7B75C72457ECEED8E4B8E4F360FA87C5E4E68AAE8A8AE21C7A2E64
+36EFB0F1CEE6593AF636C378E17EC8C6871B35B2CD69141D4C473679
+C8F5082DBA1E161F29407691819643E875E3C391229B6A15FAEA1E85
+206B0673FBE5226D3B099FC7F56A08BDFCE5754E314AD37C9964E1B4
+02E4BB748B9F7D17688C10FB98D87831E27087DB3976F20FDA4F3AC0
+0
+1
+00000000000000000000000000000000000000000000000000000000
+8B2E7CA677670EE215292BAAA1718CADF2104DD00CE732A52FE7E1E8
+C02FD25CBAF99B51D80F6D6BBEE540559733604DA35F9DE2725AE0A8
+7EAA50805EF3E1515C3C5F9655345458F1E2055A348FE47D46665D3D
+42B76E0A85EB34B895CCCC0A8C86CDF0C4A726AA54CF99550BBB95EF
+0
+0
+937E11792CB72CFADA2D717ED79701B7D821F928FA8E1FCBAC90F7C3
+311F1ECAB89B5D449E3140D458CF40765F88C5E4760E2B169336ECF7
+27D7D5D8C2023E83AFFB1C3536314C3354EB387468AB5170FF42502C
+A81234443E2695C287647583BABAD07D81B9F8CC90341B02DBB6D5FF
+D440A977D09F996442E6800280CCFEBBAEE92F1A995B6C1AAF321292
+0
+1
+3
+ecdsa_is_valid_batch 525
+3
+DE13952A80A7827012F090F9A7698642FB4D675111EDE658A01A0D50
+CD1C3D5D32A2E715CD6D9618E165BB7E7E85DB3769163F6C7FC532D7
+57F8119455B17F65B7BF237A12CE7606C5363F60A4629E797741043A
+ADBF36234C5D5F1C5B5D185F34D3C3303AD89A0F9DAD9EC2F7FB7550
+5AA8415250C0E15036FD71B350D09DB9EE844D4986ECD2553592C22A
+0
+0
+A7EF231E4B3D05F3252BE3AB6558EF88EB0693B141DCDC877A8263D0
+FFFFFFFFFFFFFFFFFFFFFFFFFFFF16A2E0B8F03E13DD29455C5C2A3D
+DF2513B66CF762508D0334F63B8BFF8CAB601F97FC21971944FC0B17
+5C95C79EE268895C199C6E96D5B1651EC1F2C6B618E93AD249391AD2
+3146DF65ED4269AF7688E52C6912118532B2B25F0E9459934F2C25FB
+0
+0
+00000000000000000000000000000000000000000000000000000000
+23C6E8755303F4DB5B4D66E4661245F5D77C1B2FDF9891A6CBE1E02A
+2067FD55CED405AE5D3A78168F4E7CDF7928BD2BFEF95E419BDABB9F
+86F1B5458137C886F282F5C651E602535C309FF73E988F9703C68DD3
+831B3E1CF882F18739955F38BD9F4507C8D3DC4E08006946D5FA7BA8
+0
+0
+0
+ecdsa_is_valid_batch 526
+20
+FA9F60CFE1DB4F65093D4794503717ABEA8CF7BB85CDAD327D9FB9F6
+227195B1B16E9B472C241F10CFC1B724EB198AC2A3C5E613CE2DE5E3
+88EB3C14C872618FB8316DFB110F10AE4C115338BF967A79E70EA55D
+7980606230A40B340CD20C12D768D3F050B20BF134813473D9FB1E54
+DC5C91136C1C25C7D1002E0C9F90639318F085AC024FF39282F752C5
+0
+1
+C257ABE3D0B240F0C239C9E246ED7ABA40C93EC626356AB4B7EACBF2
+11A6334C133E985B0E9FFD1F6DB3C72631B15FD188DB6F43AE75B923
+7BD8418F7C2E37D704754B229D0166AD6D4F84DCC7DDAD75CA109929
+095744C90316ABBB4F1F079B921B67B729EE5EBA1D5AD3617FC34139
+585C593D6D270C58352ADA876ABD956609A6951D7DC21E704E9F07F2
+0
+1
+6833B52FD0ED376EA0433A63A7E3FF330609457E296371B7DC72793D
+158772FFB64C8755257AB4234F321C6FC31C016AAC3DD200EF62E8D4
+E1228CD72D45E7D17D8D86704D1168BAC4A2652BEF722BF44A67A88A
+F8ACDD2B8482425B7FD4AB051118F452CF9B4401757F9A85C058420F
+5F320F76E92A5C6FEBB753638747A31C9F3CA2067CBBFD24EB7A92BA
+0
+1
+6883E48BD587AB2344BF5A4D5903E4989AB0A6DD2B8A89B7251DA0B7
+C0AE10BBEE36E630A21C1CE12CA49F3907358056A29B0F839F40E501
+52D1DC1053D12758E65166C59768513A15756141A649944EDFD6AD67
+4D723A8724C0E2CC7C9EBE4EB5F320AA3173A5AB0B73FC7E1426E6E7
+93F4C41A38D015D3BDF4F17407FB1E07D5D43FCA83D7357EC90FA0DF
+0
+1
+4937FE109AD473BEB247F0A3AF8A34DEB926461BC6B32D1014661815
+45F970315D7A760E54B3D0C8162EE998ADBD29E4588A1C67452BEC60
+11B0E36BA3897B3901DBF429A67B6930A624AC8D57774CF319F31F56
+B891D84DD3DE994C47D59B654F3409A8D8AC0627140B90B20A755120
+25F1DB815E518ACC48D3E1E2F5528E4CABBB0F90B36B791FA4E40DFD
+0
+1
+ED6CD3C9ADA272D3A6672B77A500A4FF847D141DF198EDB62ED7BCC6
+56B38AE126FB45F8C19CD0E8523B1FFE0BFFAC036071F005C5AD004E
+FAE2D54C1461C1D01BD2B8E4700C0B04C65FEAFCEF755E9E34632FDF
+15870DBC3710718323A38D16BFC3868591982320DA548533810BE16C
+8966E52266FAE8371816B8E4F97B47E654644AD1DAFFC24DE2E8A4A2
+0
+1
+5C771FB229C3E0824DDA671706603D9776AC0046492DBF174AF8C24F
+0A826C71F04A32557F88AA483AED2639F743253C2B198A2DEBDFB23E
+76D3AA563E46C2890150CD26C7B0E05A9DE676648D2CD02409E05A5C
+D63DC2FF02C7806339B36F6C97204FB50DF0C5BF7C6D616D11E00B02
+47B510CFDD71AF250CD538E57AA887906B35B0FD901A4B0DB495F493
+0
+1
+FD624C6F6DACA096329776E02A5C0A0393C231FA63B68CD5AE9E2204
+25FB4F8C419FA82EAACEB1458B551C6BA34CDE0C96762B3A31B7BF40
+D6FDA532B41ADD8BB0E300DF9B45A4D1D8C09AAD62F495B15A268D04
+C14374D1FC14AB89455279BD1B9F4CF516251D08843E1560640605C0
+48FB305F564BCACEC11A0D27C25CEFEDFF757B64BA30BF46B6F7848D
+0
+1
+847614F03537F23B9EE118FB10853E5AC9FA0E470E49FEA8EF519B78
+B72A922C5FE522B79A3ED9B415E204999E61CC31A9D01738FC856EA7
+C66184082F59C18EDD11A0A384E75EB158A1A17AC5E0CEB3E8A02843
+88E4D59E5481918D32AF8501338781CDB7E70CC8DCA0A0A6FBBE8FA9
+74EC508D5793B9CF7C90883AB2C8E908EF3229668F3ECF299DDA62C5
+0
+1
+A93E53864494A94396C5BFFC3522F6BC54EB9967CB0BB40A7381AC6D
+5F6B38C2C391571EC49E6C0DAA8FAC4535118D2880AAA1CFCDC806BF
+11B550B545E2F8DD1A0D6AD94AAE21086A555DFEB453E037E38E58EE
+37501C0047692792449337DE9153014D3DD869E9BBABD5C0AF9675BD
+CA54D1EE4A5000D1FF97BC64122FB6FDA23CF6B94AF4C2B373780062
+0
+1
+F64AE6F56FBC70E13E7C482204AEB7B8A413BCD9DF392F270CD356B9
+45807214B3201BAC9DD66811B02A3084EA82D5FE488DC59F213F4D09
+DC138B73A43CD19876B42482B854F22E4CE30DE70B907BC3BDD84939
+7D0B4F000DC6B1A62A6AA33AB2D3C6AD3E42DD3B645943CC8D9014FB
+48AB9AE570E0EDE25148BA29515E5F69EB3177A138C68CADCF99A9F3
+0
+1
+393213200F795A33DFCDF95516DEB09B71C201B26CA1F492CF9B0F82
+8C1589196AE27993A8ED3E46DC93B83FA7EB215DD8369FC399A2A138
+56392D89491520744056C29B82DE8E150EABD8874550D5AC0DEF1C32
+559BA5350F707C373234A79091EE3B6A2DDBD29352F637955D4C7534
+19014F8395C6CEC9B675B068405A456D5A6D0633E6498706D43FB917
+0
+1
+F808EBD6B54A48ECB47822CD998B8E121F332B85066D7FFFF483F804
+71BB3943C203020223453A71368EC82543BA0C2323DA7D3186515299
+ACFDBC5B0246A44164FB28EF93FDC559DC699A7D47E9263AD5505CD0
+38A99EC8AD03CFE7CF704C4FB032B112E0C080BFA4E850F7447FA2AF
+B8D5E9BDF6EC0A9CB32305C400A84EF4A69FFED40AB5A0D0EE0C016C
+0
+1
+5BDD425DCF91E66B0964A5CD2B4A6DE2BF7246699C7A806EA4837158
+8CB031C46E08CC7145DD70025BAC7ED0164B86EBDA94A73696E1FF13
+8DA544740BCFD12D77F643F9488449F3756D95559D607655D3840E5E
+5AC9DB1BD4B39928057865A0EDC02A0F30EC84D0D57C5DDDF842D854
+0D1619CCFB661CA77023710DEAF46BFDF616F436A02AC7081B0E6D5D
+0
+1
+64716E2A31684356359BCDCED7E02691AC254D711E6902EAA49A9AA8
+61F9A92D5C7B008132D8C00D8552EEDB0C7FE0415893F31CFF8BBCD8
+81033FF2804F56D9AB86CF78D3D785E6CDC5D0B01F6C6CD7F24EDED1
+F9D9B260C7EB1EFDDCC73EC63C7A1489F1D7F18383D7EC14834863A8
+B0D3E0B2B9F5FC63ACC991F3313A4726AB432B023AD254CCE1FEA9DF
+0
+0
+32D70ABA2CDE66C422AB2DC18A2E1853B438E2331B73C1EE270E0E26
+2A12FB92D92CB94410D42DD72255753FEF9B7672FB2753D1E60CF055
+E10153C389A0C6C04B831D07DFBD75AD160A6049CCCB1D39754039FA
+B662BFD59A5A4E19ADF1FCC449B84771E9B5201FD8C74DACEDB5A610
+0753980250520006BD078DF06ED3456C005D452CFA2B2761FC2020EC
+0
+1
+D7E168B4F41F6F144D0440E5A753C0233B433B1F135690495D7450C1
+B2ECE901A4ACA994118501E06542ED63A9A4F169F3C3D1927065C429
+05AFCD8A0A7C1BAD359A308784001789DF1429B8B0EEFFD992A563D3
+C23172A7518AF9B0B599D3EC19E55B9EB71757EAA9076C6FE60F699F
+20F327DBA222F3046D6B9CCB8D88CB03786099886200D626D5D65E38
+0
+1
+155EF4A51FCFD0C31898DF71B912DC0588EE817172E9DF178D6448CA
+4D859C7375FF17D606A118C818A733C346D2A038890F448867CB16FE
+9B4DF44E1CA9079C1FF359E49BC6AE4C67E663BF9ECAC00228F4E61A
+E0777E585BCF849E09739DC8B214F0E99D7B56655E13837A6FB3CBD9
+11AEB1B034F4CB1482D6008BCA322C8726E8346374B449FF8602F251
+0
+0
+FFF541639BD6433E0C4B75C60B0FC7DA2058822F9D066574CE5DF17F
+25772F15A61D9EF820E2EA2D3FD8645986BB3894CF33282AB48B6FF0
+4E52B69E1E55DF9A53DA81C15AC61E85F5E0B02BADC442049B31DD19
+0F2443DE6E2928B8BBD602A36C817CA2A12246773474721B6CDD44FC
+345A467DFA99918805CDAF6354308BE541D9849D3170569D531033F3
+0
+1
+2E03339BD6B82F509348B813D946D43BD6573DA863F1A3B8A4190F69
+BF07438A22B947D6180851CB04047434E391D32F9C4A2DB7CD803AF4
+909E7A6B10C2A80E15A0FAFCCAB6134307F168E3E78E1E4F0319E5C6
+F90145DBA78177D94BAD4AEEC8212C5D2E0FF60E2C64E441BFBE1083
+6FA08B8B86D8F4B76B362077FFABBCD8B6451B95A9F0FF9B46CA694A
+0
+0
+17
+ecdsa_is_valid_batch 527
+33
+D7E82BA9B65B7636BA55364E397483ABFEAB2DF7DB698B1EC133291D
+ACDC0731634509C8C68E2945E1B76E53953A43064873C5EE736B6E90
+94486ACF33F24A5C18EEA33A4D0D05FDA0C3414E45B9FA82D46812D0
+821A846C05BC2783B15C0CB16D37B779CD81DF87746D201DA03869BC
+0228D5A1ED14D594C18935A7C72315CB9E38ECDD934036F0FA962216
+0
+1
+2DB709ED70F244C50A406B7714AD6BE5CFCA6BA072EC0A4AC22F3F09
+1ADD6C91A927F739F2482CCFE9D0DD0F949325026813396D92E387C5
+205F52647B1AAE45F3E141448EFCDAF707323024545CCD82EAF376A6
+5C2DD2742C2202C68280771F3627316A407BC3BB1CF75B66721CEB05
+BB1CB2A795DA774B13934A4878F3232D1250E2D12EA9EB897FF73000
+0
+1
+1BA82D90AB2E18E64A347192CB4B63A7E276FD4F887B9A0FABDD35D1
+456BB0B2D4D93ABF5F2A0DC9DEA5CF653E5EA135AB94AC3E4C1D0D9C
+BDCC71380B071406521EB97A98A054B670480296553B63EBABFF2949
+4D317C67756469AA38C168785671A409780650BDE475B868FE40D31D
+A613DC58061447AA772ED474546A58BC562DF4018BCC411C10628654
+0
+1
+13F6BC7024E1FD755637750174B217A005D2218AB8A17D6B2A5E3E48
+049FE2BDFB26013D3D6437ABD195834D7A351627FC13352CB2C40C56
+834C72F6F056F0B1695C35F142B71A8D72E4C630906C2F119F31C134
+6EBD2FF8C63218DC27997D743F20D3A42D5EAC87DD895A8638E2B330
+BBDA95AE4043590175A76523B01D7F2352C78A12E8728809453443DA
+0
+1
+15AD8ABAA3F502DB220EB54E8677A27E80CC7A43A9D6F0A2B607DFD9
+B834906F61652CFF65E5DCC60707B99D7CDDEECC9ACD6C31E91577C5
+E7BDC08484994BB3A33C3B78FA4C14B27CB18D3CC49206F19977B9E9
+5091AB9B15F5AE46ECE060A3CFEECE72CC2B3B92DC5CF9637C6066F5
+B98F1EE9A649613E57B0BE3ACFE7854F725EB5A0C4793CE821094A4F
+0
+1
+A90F5F187D90B97C0F64CC7AB81306703EF96FAD48533D92789A5B1C
+DC1E185748DEBEE898431986BA59F394B2E696CE8B1A3F8A441B0DE9
+F51AAB5ACBFD8CF40FE1CB5A4B81ED2CDCE63ED3BF3E94BE6702C663
+5E200C329CFFC727FCBAE810924454466A4B5AF2915873032C197A10
+B3C6158BD83D06961A2220267B2D8CCE0D2192F87F6CE4A7485BFE02
+0
+1
+27EE296781DA9946B9D13CFF24CA7D0A08254F84A7686529708FC006
+6A49D04A0DC6D0CD1128DC5A66B3C089EDFB4E6964DFE7752043833E
+1A16FECECD3D3561DC7D3A376F54AE99789247C46D7958414AE95C7A
+F3A04C83DE9684D3F8929699EF62618A9E61DFFF7DC653E2CC2DDCEA
+9F7CAD80F16E2D63D619E28078A1495F6F76A667AB00ABD203374E9E
+0
+1
+AC23400AE329ABADAB1C371E9ADABDC6B345AFCC936D47BF0D9A57F9
+3A58DE242966D50161DE902D1851FBB0978E062AC48C4B73B4C891BA
+39CE1C10F1F387272102195677795BD96F8DF78E4949E4C012A2D56F
+0E6221E0E54CBD7430705ACEEA766AC09FB436991DA9874278693965
+B87D33167D4331B75546788006FB369A839C94EDE7A32E08DADCB932
+0
+1
+EA24C899EB36E5F1BC5E53BE382A74B7071FAF90EEE98596DBD932EA
+53A595F8E9D6BE5E9FFB0010608173566ACFE265B46F73FC967A6148
+1A47FD9096A5146B62B75E9BF57899882792E3AD5D25785C90165B39
+9A38268784DE717F2DE5E48828A56785D17FEF189F0340C8CF5FECFB
+A474DA522064164B2E868878AA929875FEB571A9EA17B679BDB263F6
+0
+1
+472543FFE8E7CBF370A3819DF30A00A6491FC2C2E9B7B210577F5B4C
+D8A914F5509E516AA83EFBDCA81DEF4B6AAC7EDA88A3638AF6F48AB9
+70EEBF48D90C154A5F26E8BB01DCED6D63D0CF1A8490BCF3B60BD782
+6D94437AA277205C75901CE3F898242429716BC041B72464DD530DE7
+D8E0D18448FA6EA0EBBAFB01D914335CF6DC7854E39F9FF9045090F3
+0
+1
+47AE1947839243AA8DECCB62C7876CC77327219D047E52EDA54616C0
+815EF89C542B275042F3EA2A98881DAFAFA3FE16336044A64F743CDF
+E049ABD0EA96DFAED48D4D6630C64AE41650015C5A4F6AF2EEE640B2
+CB30EB308101F865ED34CBA9D94BE8FACF133D8AAEC0959D09B1A33F
+FAE327A2341AD58772F92B3EF1234D41EE7F1DB76B32B0DB44C61FA8
+0
+1
+80398B529CA7D0D927D8F068B580A76E91CEC04BB101CF8CD1EC3310
+1286AADADDF8B3984C2412D63EB1F63558F4CA997ED4D6FF30C6D209
+D22D152D7A8519EE0FADF4E8198A92E73450929D83E79F30F9A72859
+BD83D8B0DB3039FF22811D65E80360BE62E70CB299D5DF27EE526D83
+8693F9B03057FA6A30062B65133E3E95C92010DB53B3D0537C2899E0
+0
+1
+FD54284AB05543463E412EE6E85ED951DB0EE850626CD59DB3E62B2C
+344024FA0276AE70BA6C0707CDF7D71894E6C0AFA57B1617D7872025
+E4C8C49B44E12153EC8B493C3FBEAFA6BFA8BBC46A7E147151F1A94E
+46BC4408394B26023FBDF562A25E7D7734E474283EDAF305DA2E39DC
+3A1E1E22C689196A82139FC8F88B0B253268E7965580815DD9336B9B
+0
+1
+E27F6D3CE81159972EEEB9419536DD616CE75CB6501F2A3E523A0C72
+CCE3A475B7317F3AD4620DE634C109F2B8626411B98B820F9237F1C5
+3B8CBB78D0B84D1B2BA3328B917EE92F6F0149B7A256820227BC0766
+F7C1D14A72F712AD770E16E1851586C2D2F80A51B98E372E72C61A0C
+0F9D32B4D2EBFA5EDF560735A798D63F8BB995D45E28F3D8701DC467
+0
+1
+78D7BDE1A0036AF07359529DB29E245079605B33A9FD04117E054F6A
+15E022DE14820AE00280665726DB89FE74D2CA2D88F4D080DF12C6B0
+902415FE534283ABF44E59214CA07EA90DAEAF91A5CC1226AEF453CA
+42F88DD43279F468800CB1CFAA1E99F8F06FB7370F90199C651C13D5
+08C087A35D643CCEF8D29B9B1C0EC7B21541E01B2C2ADDA5212C7123
+0
+1
+8F8A797DE9F157769ADC75B2CBB42AD542931FAAA2D3710CEDE81198
+77B0142AD58AEF250726ACE2356E91678C73966DD7D4A58D969A21A5
+9E7E97EE5DC5E35ADDA150A9BA43855B86AB703437895620521411C6
+740F3F53BE2A63CC02341F3BF5F588A9ADEE4826BEB5BFAC17C382F7
+29C37774C0983DCF2C7B367943E8ECFB1B9DB4EA0271E41A606DCD09
+0
+1
+18B0FF1989A805FCEDBD2F335E10299A5B63FCC50301043AE5B26F34
+BBD3F31208E0D7C8BC4F4980943447CE3E877E6B75CDF72DF4F8F273
+114882EE23394849B1BA0A71A335F0C1A0AA1AB0A8261CAFC05D5491
+1866EF0F27C8FE8B4F73B3C6D82B2EB50B1D53D37C63CA0EC4DFCE40
+C6EDFCBFD842203A1CEB7CE3293AAB0E75D5DA588ECC0C4600CB04B1
+0
+1
+CC8B3258F36F97F03BFC675410E38196301D6535DA4746F5E6ABF04F
+BE7BF4B0B751B327AC65F390658821CFBAD03CFD3471EBCCC6735EC7
+4C9783FC660C07AE8C52142E4C256259C834F7C2C2B6855D4B93616C
+EFAA06DB9366DBFBF099A258C8CBF6D64342E1402E38852223F34BCA
+99F870F44D0A0F9C19EB89E188962760648C917745891B40DF0DED63
+0
+1
+77BD4E953891067FD3887AD7542733AED650CFE304EBCE909AA03DA5
+7DCD5D3EED82DAC9389C9BCEA399A6E3C64E9B774963177070A9AF68
+A6F4D9568337FCBBA61BCA18D62B17BAC9E7FBA6CDB7AD6F8FCF8DE1
+9724128541AD4A8E6207924ED49E16965A3BF168B4634B3223F8D4A4
+006062C48F5CA7833AA8CA9311F0D31DF3FF5958E77C3F88DE85E172
+0
+1
+BEC44E7F6585A2DEE479DC190224A75EE9847B5DE1D5A5CC86140E55
+E76D03FB731D64FB7228A5254C99D8DA50EFDE59EA52199E8B14CF5D
+D5A7C7CF77D9A926A530A256CD6EC42AAB78F79C90A712F51B30F729
+92E9F5DFCC8FC102D3925D0DB7A68D067FC831949A85C2FFED608631
+17E9F9AD1C6770D030B7263A000B546041E47931F3E05A5D96B91ED7
+0
+1
+347B80A210E50BE6CBB85BFCEBE5AC6849941A2D71A655441ED36C16
+6C4A2E242ACB918A4F98BDACEBF16C72D335E62561720F85634D6A32
+2872B5077E43A4ED58753159E3A6B6E04E9BC679D60BDB435B39B6A6
+8BAD5D2BD0BE649B0AA549EABAA9324E9F38FCB3976BB95F3858F8E9
+654211449286ADDFC5BDE36D74BB3B78D96410CA9C000CE0186FB4AB
+0
+1
+293D92B4D064DA1A81254C4D3F7EE42423310F4656B7307BE7EE27D4
+3E5E332859546DA0B378F16829B0B98FFB48CCFDBE4F5E866DA37DD7
+64E52E782F265F7FEDA9741E5FCDA0A459399CF535C007BABF6FD62D
+F64E5BA4781EEE60E32A214FA2A5D1DA0C9EC93CD60A96733E57BC21
+CC21BA92FBD58FA39475D0F04709BD61F891AA181F68364074EE9F33
+0
+1
+78125303699C4D5404561BD195474028C6438078ABFCB879166677A6
+58471237E99DD0F68081EAF0DA51D4A3ADC5C7198A9CD80C3650E4A1
+9E87CC4DC64402EFD7A80FEEFDF17FC7D370B6FDFF371CD591D15745
+68C04BC1655C55886A1D08E7857BBE8441C2AC6D3DE840D7CC1AEFD1
+684380C41410B7EAA6D1F317868583D4E1F39C81ECF2F859977597C6
+0
+1
+A077BA2605B899B6014C21EA90400350BA62698B237FCB6487B89C06
+E264E798434AAF768C8AFEA551667BC839760033A67DA7A7723F6EF7
+FFFF0377BF16CBA0E67EABB7880B2E78ECF05ADF3163559E2699C1D7
+D1D05F404FE75F12AFF1761835EDB6C1844BDE2D58A28B324AF5A7B3
+8BB22E58BEB8E334FE4A48D04E15F57E070104B98B647411DF8B915C
+0
+1
+6FCA8DB04587A4E6919A9D2BCD3839F71C0974514AA1220407639E09
+0B013838C7CC4D61E55A4F0000E643BFCEB27DB2DBAF940B878C8AF8
+7E89189A03D826C525D88CE5BC8CB45A5E4D73A461F417171D519896
+AECC94F18173F58AD9513FD143CAC803FC7C78290F96E0F770CDAA0B
+763519506DB4765E63989BFA199D0F0941C869F09F796A9F1EB15DCB
+0
+1
+486930349C87984A5250FC1089D891393FCE745A2761D01AF8779DE9
+19EEA4019D0222C9E14474345D6B3255CED9A7ECCE2511559A28CADA
+15110D2F69B285694D99FBD980FF33D03EE262D51C975CA1307B9313
+1369217CAC9829BD81E2184A3D8FE1B4DEF2D73930458226AA30C31F
+C66ED57E8D96FB09C90A8BD3FF07E33A6F197C8A17D912AC3D8A90E6
+0
+1
+A2D2E4146F23A0A14F51AE9BC0ACB77251F5E0D02E0A58F8CDD7966D
+A33F844C191A291FFF7832DD31ACC07FF7D6B59DF8994C0CE20ED732
+DF47A64B99A623FA1301A52C18E04D95545E4EB0DF8EAB317BBAC09C
+67AA15D62BCFB9EF140757768F008E9B36D8D7C5F1FA4BE718458A61
+C9B33A0E37C6F42B0F5AE34E4C4076E7ADAA6B01D76415451E6AA3C0
+0
+1
+BEE52DD367DA5AE87404C6F83E9E9B2B0863BF1A00DDB722BC7371B3
+F34F998DBC6BE538B6BAABA21B3F9A6C999CDF0982F727D4463BA8DC
+F1A853EDED294AA0B5D725CE296A84633E08CDC4622526F2815BB9C9
+3A368E64373C0E8D4CEDF0F0167771A5E58AA24F0D8EF614FD0D570D
+06C7805CAE7044AF9A5E82A4BF9B12A3DB030DF98FD7E036E679C9F9
+0
+1
+05C1F39D5B1CFE841728343233BC8303E314C2489BAEC65922F9747E
+7BA67BD59DB5906F91B66D483A4E95634BB386CB7C3D8558ABDD8025
+6C0AAAF3E9B275D9EA64CB4F6CC5A7BF9251E2CF04CFD8578C449478
+FFBEF76C7429983229B4AE8154C34F4A4595F32CCAE29664A50BB307
+B2C41272F82BB701F32FF146E39FB6042EEDCF6A9F2F45938057393C
+0
+1
+BA540028F571F07393C76B2CFD9E98F568897489B672C778F06875DF
+80663BD258403D2F9CD7E1DDD4D2FF59D842DE5FD770B40575DC0BD1
+406A3BA6D67802DA053B591D6AD03CE74564620EC9BFE059B242B804
+2DD3CFDCDC8E2DACA06F8BB2D0B75ADCAA2E57AF1003478273BB6389
+690209AC6A68BFDC366AC9077235A3673EECE5ACBE7E77CCE514E8F2
+0
+1
+AFA916CDF8858255B7A9897DAA2647B7D9CE6A52E776876CD415DF3E
+5CC92F421989D849023B992F85F70D976598EE835856D09A5929E636
+E4B2FBE4B773E690D27D1563AE5FCA27AFFECF0D8150E6DFC7E68247
+3A456DD6B73BC0DCD8AD62D3C473F114D2A33BC3391C85413C583E6C
+37D6E91E8DD1571273D65761098EFE2E77F0EB577B492E97FB5B599D
+0
+1
+AD6B1281F100DD7847F0633C2ED837CC465FF379D9E63B2881DA9BB4
+AB8BCEAC71727C75AE87DDA57291F6707922D0D5D3A1BC443381D005
+0081BDCAD548BF0BAAD6DD89C410962F989D337C48BDFA977F6C9858
+EB54BAA2BBAFC7600455E434FE6CEF81D54EDE62F8E4E189CCE5ACCA
+3BEF910226B2976E9FC633CC8B728684EDEBB350D579A9B89011EA4D
+0
+1
+C7DD5C6E4F6CFADEB6B8BCFE5A86E9648B530681D0B7D739B8264061
+EBE9AD7C470E4B2772EEE27DD45610B713440C6E1BDB1F6F2034DE2D
+2D3F591633BE7C62A6B0BB02CFD4F432A958A1A23C200D0A0D005539
+4C3638C1C18D0772F66CEA033D8F2029FBC66BFBC777549DC14B4012
+DCF4BE97FAD04786746C10D4CE9F1EC6B6E4CE17A34DC8787C3168FD
+0
+1
+33
+eckeygen_batch 528
+1
+eckeygen_batch 529
+16
+eckeygen_batch 530
+17
+eckeygen_batch 531
+40
+ecdh_phase_two_with_key 532
+4B0018013032C4FAD2904488E2DE79F864166B78431276A92885B4E0
+17ABCEA2C304F78E7E905F15FF308404F0FFF16DD3A25CCDF5B963D8
+0
+3C0846569F3E8E4BE0A677BA0BF39892DDF99713A2B1C2E3569D9F19
+BAC585C23860A8B1997D306A0CABF092E8140D8446CE3CA744FB3C98
+96EB52B5A5A4C5BF956ADCC71E9841650DE1334258B3358C3E8DF7AF
+0
+1
+ecdh_phase_two_with_key 533
+F3B1C5F613A51293ED3F2FA00EE1D658425029E63A13E1E342ED68B3
+352AFCFE02D96AEFE4146D672DF69262A5C12B1C0597F081739E0AA9
+0
+E57FC84D9CD6BD083D36D5BB4EC32AF78C40454EE11681D90DCBDE16
+CB875E8F140E4BA1EDF3BBB269FC7E5F3842302334501CCBFBF8F55B
+04FFD061E5740D93AA695072FE4F57395017E5B2007464A22068656C
+0
+1
+ecdh_phase_two_with_key 534
+B53C9DE6E268A447775CB5131AEF842AED51FDE107262DE9DF99A081
+D8070AFD81472FB0C8206F532C97D3DA898AFC8CBF20E3C6DA5E402A
+0
+7DC2D21F901E160C14A8F66092223927FD59461ADBB9A3879E75F3D1
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+0
+ecdh_phase_two_with_key 535
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+7D3FD31CC27D551AD823800C9077551B4D851B3EE817785D5A8EE104
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+0
+ecdh_phase_two_with_key 536
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF000000000000000000000001
+728DAB6214A03F4C55A123818AAC23959A6D64E01EA4BDE5A7434B8E
+0
+6F40D3900493A30DD2DBB830742A08F7C96F7859A727E7E1761570ED
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+0
+ecdsa_sign_with_key 537
+766A675A2ABB1D2954C39A26CBD722F15A290F703EC02A05C144896B
+1D3786F2809CED737D7DE53FB46AEB0BC8A3814D49A20E04CA0AA3BB
+0A45EE970706E7ABD4345A6587679513A539450183316CBB1E7C261C
+FA60344860275FEDE2DFCEF2AC10FC3456E4501FD30C69F8B1096C14
+0
+1
+ecdsa_sign_with_key 538
+B06DC7EEB1FDD2DEAF9ECA1B8B7FE81BA3560E9446DB8184FA2C8F8E
+75E531BDF0900287759FD591ABC27D201922B491967504FA05C8B93D
+CE4CEA6CA13B44A184DB39193C2F09334804F2F9AB056DA241D40C04
+29D728E8D9E0C8526E0ABAC95B0EF93BE9A7ADE988FC792DC90772E4
+0
+1
+ecdsa_sign_with_key 539
+623A62AF7B911D898AD117F043651C86C594FBAC0A77844F497C6A88
+ADFA4180D2F860A1307501D78F692F11F68AD3360616B53CEB30F13B
+718931453F9341F06FC6D62D4CE685F5FF44DB8170A9BCE58248E113
+7982F5777C034190C3A39775A3EEAB623BF3A68759930A867742A4A3
+0
+1
+ecdsa_is_valid_with_key 540
+F8CA41234D0B199D09E4D06C0167A7B71EF5E7E984304DE256B99E07
+C2860EB110D76DFD3609B02020510946C068670466B3B6EA194F0717
+5CA994BFCA70FB81BE8C9510898319A47A318C739952A1BC970A0004
+0E6C91D6AA0894D95EF0C24D4EA60FF22D3FA8B3D19D633E54DFFE90
+0CE2E343B319943EA928A95C7BFCE4B3506B1893D057816B88692724
+0
+1
+1
+ecdsa_is_valid_with_key 541
+73EA6B11F83C89A11A6871061788CC2A0E533D06B3275C03A58C26ED
+E968D716789DFCFCF0236D99CBBD717B29C77BC6A1BFA4627DCE9286
+89FB5B5E552F79FCF40A910567B34AFC4E144E4CCF22B504832C1BCB
+E3DE5DDAC06140794D9884C3D74BF4AA1CA7F2558CA514E5352E250A
+AEF626EF2B647F115D528BE56A2F6D3496F3F0D28FE44CDDAA660117
+0
+1
+1
+ecdsa_is_valid_with_key 542
+4BD6FA8CB595F9A648E526F2D9CB31F34E08B278272B22D8E7AFBA6E
+BBA3A6699C8A43BF88E22488BEF9D8CD69427C3ACC8E04F95DAE0414
+CE9E430FA249BCF76450C492ECFB7E240E753A22DD7A39C195349571
+2592989290A6EABABEA60C8474F7BED52C35FC45585000726DE9CA03
+4729C8DA4D0727C219F60BE535B5D2D89F8080BC6DEDE95997FB4D7C
+0
+1
+0
+ecdsa_is_valid_with_key 543
+8C74446E7972587AD5992A55FACD98F331C07759F5DE3700AD770306
+F5054E447593BCF5B3C459FB715E17D662313F50C80F5ECFD0098B8C
+27C035B80E057A6DACABA24BDD63B3C851448A3770C1759CC6947689
+B1B17E82DF96AF7E34BD37F6E1175BA9F36DC9A0968958947287CD1F
+1889E6AE4C733200BD5F7F229D7678D328BA9D778B278F888F82B65D
+0
+0
+0
+ecdsa_is_valid_with_key 544
+00000000000000000000000000000000000000000000000000000000
+ACA86DA57EFBBC4FE49F5AD571ACA9C79FDC329C3C4DFDAFC9CDC2FA
+562F1B2A6C4F79992B7498F8EEF324861FB485204D9653741A3DEB6C
+BBF14A690F3F4E48627ED5E254C652611CC05CE3C335F3494489B066
+582675F33D1F14D710F6D0F9BF48F5F00F097671EE328F8BAE61C7D3
+0
+1
+0
+ecdsa_is_valid_with_key 545
+326ADF21384860ADBA31EC119132F76344412E8D1227C52990C0931C
+CE0543FC0A425D9B80F82C8B806A41F9D1CE1FB894EF0964554AB14A
+96DC8A0298385A9DE9FF8493F7E611DADB17EBEF611B28F4DF9714F5
+2A9B4E82CA7BFFCAA41C3E19B6E1CA8934A9C2E3F3B8DA6676FF4D9D
+477A891E23B88F33A6C885BE702C75C68821AFBB3B89A65C80019A62
+0
+1
+0
+ecdsa_is_valid_with_key 546
+4C5B84D514B7598BAE5AA2F57479954CF15456687BB913009F58BB56
+39B0F13160B38411B517D25900F2BE970E5C51AB84367C876F084E33
+99127987EE3E73852D087ADF76337A4D397393FC0F6DE59569388FE3
+00000000000000000000000000000000000000000000000000000000
+00000000000000000000000000000000000000000000000000000000
+1
+0
+0
 exit
@@ -5282,4 +5282,1158 @@ B92875A642C7A979DAC2A2EA4357E5858248B951D69C56DEFAE1A5BCF3640F93
 68BD237F91ECD9342CD6E28E6A5F3A97A68F859BC485D2AAE9B3CB8F32395446
 0
 0
+eccp_comb_precompute 705
+4
+1
+eccp_comb_point_multiply 706
+0000000000000000000000000000000000000000000000000000000000000001
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+0
+eccp_comb_point_multiply 707
+0000000000000000000000000000000000000000000000000000000000000002
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1
+0
+eccp_comb_point_multiply 708
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A
+0
+eccp_comb_point_multiply 709
+2EF7727C0ADEF1A1FE3AAE2BFC3155475848EE7510139B6DE1480A2AD388F55C
+0DDB08DD8DBD1FA30B9DE8074FDBCBCAA83B317F06BA892AF0984A3C6DEC6654
+CFE9E715DFE792819A35E257344E063E4F23192A5BF7B93C6DACC5D5870A6021
+0
+eccp_comb_point_multiply 710
+765DD02DF32E711923218CAB3B947BF34B610A78140DD95DDA0121E110035846
+38031C81DD21C81429DFAC6138EEF6209AEDA5306A18B6FE9D4CE0641FC2266E
+229F6F0CB64B82A09FBFB320C8BFB44E706F1BB54FD75F32073F5D499D722B4D
+0
+eccp_comb_point_multiply 711
+DB17118A5E54CEA0984990BC3B82D8501A3C2C637A3FF8DDD30F49C59AD75609
+784D6BCC55E85C31427506601FF8E8C7E9B84141781F60B3D0CA26D46A10E3DC
+A70A5EA34AB6C6B06E5D4FA540071C4202D7B3C5FDBB768EB64B96E57015CCA9
+0
+eccp_comb_precompute 712
+4
+2
+eccp_comb_point_multiply 713
+0000000000000000000000000000000000000000000000000000000000000001
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+0
+eccp_comb_point_multiply 714
+0000000000000000000000000000000000000000000000000000000000000002
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1
+0
+eccp_comb_point_multiply 715
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A
+0
+eccp_comb_point_multiply 716
+77AA1C9688F319594FF223C3294BFFBD7DAE238FA8B4D62507C6406747C6E6DF
+59F0760F95B8851DA6A2AD82F083A4A450755BEA541FF45E62FDC8E7271810B1
+2725BC48A63D958A641EA9B9E4C1C7C3CE30DFC025BE01750C5053C2038444F2
+0
+eccp_comb_point_multiply 717
+34165E6DAB994ED74DD1D50FCDFBA7B96FEA036BFB712A5FD4C7D7CD36BEAF46
+529C9FD67AAC84C2EB16BDA353436DECED48522B91BFAB34DE66F7E3EDBE5783
+2EA527032729B2E085954EB4F3880CD0D15549DE1EA308AFFE78F31370260675
+0
+eccp_comb_point_multiply 718
+FEE091CF5501C374B7247800B7FBE94A2675BE91CF70964CD120F62282675DC4
+409FEF219DF259387C4A6E65C7459E9402CF60B4763A0D2A5C1046B37338FAD1
+F499FAA8CA6D1812F7850071CFE9B6551B66C44166E26CCD8A1F25260732C8AF
+0
+eccp_comb_precompute 719
+5
+3
+eccp_comb_point_multiply 720
+0000000000000000000000000000000000000000000000000000000000000001
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+0
+eccp_comb_point_multiply 721
+0000000000000000000000000000000000000000000000000000000000000002
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1
+0
+eccp_comb_point_multiply 722
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A
+0
+eccp_comb_point_multiply 723
+9BAB90EB7827FA141FFFC2973A0FC9EBE6B2E7110EDC2F69B117475F918DA2B4
+7096C8A3570300C4F3A03AFB910BB865036BFFBEA284151B3A8A534F97104419
+2CD9987B7AA057C3A08020DF2A53FB74450B9B07A6AED370CBE1FF882D51CCA8
+0
+eccp_comb_point_multiply 724
+4E614A8051624C066F08B5913E7E1AF4144B449FB301BB599BA82AF19D962D46
+FB47BB6EC04FDF6617B3EDF7DED8717B6EE55D139D0A64C3A6D9533D9257895A
+FD55CEDB74A2C308BADFE7D752791F95BBEBDF18B2F31900AB0F4451BD9A5E8C
+0
+eccp_comb_point_multiply 725
+EB8B565A5FD915EF163A93E0E3AABE92668D87791A7D3DAC204DD0820B2DE214
+C0E357A42A47CD7BA5C2E280763FD955641CA34F4FC95A367EC500BF12524F7A
+EDC8B0495CFB20A60889B44BDB3C0E0D28C05BD246C5A4599C55330F41912840
+0
+eccp_comb_precompute 726
+6
+4
+eccp_comb_point_multiply 727
+0000000000000000000000000000000000000000000000000000000000000001
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+0
+eccp_comb_point_multiply 728
+0000000000000000000000000000000000000000000000000000000000000002
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1
+0
+eccp_comb_point_multiply 729
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A
+0
+eccp_comb_point_multiply 730
+05326831F4DA2A98B5AA5BFDBC996A3D8BBA3348C0E020B22A79FDA03440543E
+850931D8C2BD9538F66671C1D7ED800959DD31361688A4DE78680A66EC392FB0
+B350A3C59C922AE64D908266283D2C5561DEF3AC0DA9E77C8A502059ABC5BC3B
+0
+eccp_comb_point_multiply 731
+8564A99C98F9ACA5948B699F0CEFFBB3EB6E584271ABB71AF0F941192FF94B95
+27AD965620AA352819C5AF58EF61E1D90FCEF2EAEB9303DD83CD238237EFB394
+49F1B00D2A8499D7010CDA708C6729AFE4D3F9B33DA295E3A710C6F173B27685
+0
+eccp_comb_point_multiply 732
+EE17902C47C28E5938CCCE540CFB7C3E9A14C06871A1A69FD9C3B040D186BEDD
+D8D86E64EBBFAEED6D6B7B6F1B54D15FDB5120F8E11CB9E086951050CA400473
+456CECCC4254D5B0D5E0E7D50A7BEAD1FE3A793D503D65D25F4B06D64AD932A4
+0
+eccp_comb_precompute 733
+3
+4
+eccp_comb_point_multiply 734
+0000000000000000000000000000000000000000000000000000000000000001
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+0
+eccp_comb_point_multiply 735
+0000000000000000000000000000000000000000000000000000000000000002
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1
+0
+eccp_comb_point_multiply 736
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A
+0
+eccp_comb_point_multiply 737
+C424C12BFC2314F18BD6121B992E95F48EF50C2918212EC533E24BAE8A54F8E1
+A542A511E5ACD74950784963E91F64A39F47C186441D5A1A246BDD3B7D03476B
+352B964D11BFED06F8CBDE720886769371B15BE8D7BE21721F4B673DD113AAFD
+0
+eccp_comb_point_multiply 738
+B224F66864536131355FB67480A1C062A286282E546753B35D9B21AD7193D245
+DDB01861E96B91DCF4D2600204E5ED795A4BCAE3939EA836524AE0FF01BDE9B4
+75AB886EA5620D86AA441C818D6A54F152D944E94378AB9946F05C630E58744C
+0
+eccp_comb_point_multiply 739
+B9F49F9D334FCB158568723B3D9BC71C59805A5F0228B625296B3F6B30D76E04
+1BD0214528975CA8B86C8A2017E3C0266390ACB0F38A950961DAB550709EC7CD
+1A208DCE5B3F524ECA640787D7BBC9FD98278375F5B49F548671220EC1A1A36E
+0
+eccp_comb_attach_const_table 740
+4
+eccp_comb_point_multiply 741
+0000000000000000000000000000000000000000000000000000000000000001
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+0
+eccp_comb_point_multiply 742
+0000000000000000000000000000000000000000000000000000000000000002
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1
+0
+eccp_comb_point_multiply 743
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A
+0
+eccp_comb_point_multiply 744
+CC25253360A5DF0E28D5975D5FA775C17CF839CECE751B8DD5F36B01C3848C3B
+15C02076275D8A7F08B6E9671442D5B1CF3C95C98BADC60DFD42876F3607942C
+3CE0F326065036132473F285F7FD742382F903206F6C088CD9437E69C97A257E
+0
+eccp_comb_point_multiply 745
+ABBC6A27A992B27E811D73D2E0B3868562DF3319F4317F2CD62942DE41EBBEBD
+BB9A752A3AED4F8F4C234CD47F86362A9B57FA8496AC72CC10F5C2B0DF14B147
+15A04E08AA4A5D4B022D91B5068BB97B935102CBE3B02A2442FB4779CBC65BFF
+0
+eccp_comb_attach_const_table 746
+6
+eccp_comb_point_multiply 747
+0000000000000000000000000000000000000000000000000000000000000001
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+0
+eccp_comb_point_multiply 748
+0000000000000000000000000000000000000000000000000000000000000002
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1
+0
+eccp_comb_point_multiply 749
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A
+0
+eccp_comb_point_multiply 750
+BFD908DF3093BF1C9650D581C46DEB034F0589B22C20108D3AF285ED2CC9B5A6
+84459A6EB227EFD636BE978B095000109B027880F220A2B0B46C61363844DB60
+323E717CF6F7EB3E0CDA5CD2B4719AC875697947E57768B595A65A82D28B98EE
+0
+eccp_comb_point_multiply 751
+0FB81A9F329AB4D338DC23A107F32A19F1D212466BC918B7890DD20CB0448122
+A22202FD5D6DD54883F9E7BEB8E1147AA86296AB26737372424FF3B52A95150F
+59EB3ED112138FDE4EEE04AD65F48735F3A18E3F6AD7F57DBD837AAE91B402E2
+0
+eccp_comb_attach_const_table 752
+5
+eccp_comb_point_multiply 753
+0000000000000000000000000000000000000000000000000000000000000001
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+0
+eccp_comb_point_multiply 754
+0000000000000000000000000000000000000000000000000000000000000002
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1
+0
+eccp_comb_point_multiply 755
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A
+0
+eccp_comb_point_multiply 756
+E56D90D7C2F9CFC5B15C9F28ACB53FC35BDB4EB25286816BF6719226E9D0CC4D
+872BD55B4A79E6EE7CDC064DB92D68685DB8D41673BD76E52FAB215296595740
+47FD8131E097A7A0FC5076A04361595A9B64CD04F87117592C917B99E6CC80E4
+0
+eccp_comb_point_multiply 757
+7F9FA7C1BA1DC2A12623B6BDDC34AA43D0A4B6857FC6B3B21B360CC066095935
+5ED7CEACB14948894DEE4C9C28CA216D17413CB11A2D24FB7FDD42042B3B54E3
+B75622D1EA3FDAD32B37B68B0908F749936B1FAA983D02D9DC964FF1C31DE534
+0
+eccp_comb_table_file 758
+1
+5
+2
+eccp_comb_point_multiply 759
+0000000000000000000000000000000000000000000000000000000000000001
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+0
+eccp_comb_point_multiply 760
+0000000000000000000000000000000000000000000000000000000000000002
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1
+0
+eccp_comb_point_multiply 761
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A
+0
+eccp_comb_point_multiply 762
+78F588B9C93EB5E4F568863B692734D6D1999EF138487FE1C01FF328830B46AD
+0BC3C30EACD98E515D8594F377D9B972B872AD4668FA4F51C379ED7C144F8FD8
+F588821ECB608BFB7445AD0B2598403068A1B7EB2C043F35104E5BD68F995732
+0
+eccp_comb_point_multiply 763
+B53D4566964BC1D04C9F5E6DC1B9AECF4E9D2C57C0983B6D24C8316184052A96
+05289A0ABE6DD1FAC300DE882E731D8ED830E8B5909261C2BD4A5DFB1CD9F4D1
+89D3900C0C3F0D231682453EB5B6531A1AFFF478BE5E017084F9323B5D3736A9
+0
+eccp_comb_table_file 764
+2
+6
+1
+eccp_comb_point_multiply 765
+0000000000000000000000000000000000000000000000000000000000000001
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+0
+eccp_comb_point_multiply 766
+0000000000000000000000000000000000000000000000000000000000000002
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1
+0
+eccp_comb_point_multiply 767
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A
+0
+eccp_comb_point_multiply 768
+E5308181C6F918BCD933A5C99E321A50D22A8A6265B4958978ADC6ECA5293A5C
+260BEFA31FD7C70E7835E257A8C546DD9BCB335DF9F09AFE0CC491999193773A
+BD95C06FDE4090D208FF0FE32837CEA50378E9E8DD46061CB7DBB24E8A7789AB
+0
+eccp_comb_point_multiply 769
+439AFF79239CD57FDB8271A35E0345C9E3C041BEF0088304BB26D5D9196419E5
+8F35AAFC6F2C7C66E9960EF4D3C79A2C0C5D6FF3B2CCE8E44785014D5E1464B6
+A3D6CB488C4AEED9FD7B90D7099D7151BD81952A49209EBF7A50CD55196A6B87
+0
+eccp_comb_table_file 770
+2
+5
+1
+eccp_comb_cr_point_multiply 771
+0000000000000000000000000000000000000000000000000000000000000001
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+0
+eccp_comb_cr_point_multiply 772
+0000000000000000000000000000000000000000000000000000000000000002
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1
+0
+eccp_comb_cr_point_multiply 773
+0000000000000000000000000000000000000000000000000000000000000003
+5ECBE4D1A6330A44C8F7EF951D4BF165E6C6B721EFADA985FB41661BC6E7FD6C
+8734640C4998FF7E374B06CE1A64A2ECD82AB036384FB83D9A79B127A27D5032
+0
+eccp_comb_cr_point_multiply 774
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A
+0
+eccp_comb_cr_point_multiply 775
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC63254F
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+F888AAEE24712FC0D6C26539608BCF244582521AC3167DD661FB4862DD878C2E
+0
+eccp_comb_cr_point_multiply 776
+D09BDC5ABD59595BE6031DF76E865BB6EF4FE91E5EAEB4D07A18F3F2369D22E8
+1D6018B99723FF772B2B92BE36923381495B9E8496AA06F88BD1ED097AC18128
+B5C1992B8777FAFC27265E418C9C7EBDD17C42F3389CD66D09A661FCC04AAA14
+0
+eccp_comb_cr_point_multiply 777
+EB51DC34A01D485AA956127D6152135CF54A54E282BF7E4A4CA864D89EBA558D
+DBB62CF0170AE02A2C870F8232AB3026D9B4AD0B2E0D312643530ABAC64E9C9C
+7E0F99DE20DAD80AFE1CADDD11C219EF576214F61161962B67B9BF613DBCF924
+0
+eccp_comb_cr_point_multiply 778
+78AB0B0FB1D90F85D4C6CD05A4D0DDF4CFE5D453CC1C22C94D2953F961DD0C8B
+D6E6483C5B5D184539D567BC9A99EE2581E09E123B82918A4B2548123BE44169
+B6D285EEE512165953829182552CFFF04226929308D52FFEBF10EE9033FE8339
+0
+eccp_comb_cr_point_multiply 779
+4BC2A218F4E863F1289DA932B8A3669C237EC75A8494E9404F72184C5F8B7C2C
+1C4406BBD9308759AB13234BF7D5E9A47CA4220C3ED0A41DCBEF8AE9623831E8
+7D2C43CA5DED7203EDFCFF5253921CA8862042CE2F803D7C3663AAD500B782FA
+0
+eccp_comb_cr_point_multiply 780
+C5B8E8941E9A133D3055F761B0746935053CEC98521EFD4FEF673646875D8E9E
+5231A339736AF91687A4DB5522CDE11FA84ED2D3FDD3D494F4266BB27D899900
+CE32F60459E7FDE4E35CDD8217A10E9E7EC250548195438F20E843078408AB27
+0
+eccp_comb_table_file 781
+2
+3
+1
+eccp_comb_cr_point_multiply 782
+0000000000000000000000000000000000000000000000000000000000000001
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+0
+eccp_comb_cr_point_multiply 783
+0000000000000000000000000000000000000000000000000000000000000002
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1
+0
+eccp_comb_cr_point_multiply 784
+0000000000000000000000000000000000000000000000000000000000000003
+5ECBE4D1A6330A44C8F7EF951D4BF165E6C6B721EFADA985FB41661BC6E7FD6C
+8734640C4998FF7E374B06CE1A64A2ECD82AB036384FB83D9A79B127A27D5032
+0
+eccp_comb_cr_point_multiply 785
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A
+0
+eccp_comb_cr_point_multiply 786
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC63254F
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+F888AAEE24712FC0D6C26539608BCF244582521AC3167DD661FB4862DD878C2E
+0
+eccp_comb_cr_point_multiply 787
+D8D0B92C40FB4408EB9632628D84419F94E0D150085F041E8FF057BD55A9142F
+F7352DAD685DBF9F70DA7DD49D0B231EE245139D25C4F5DFBEDC8DB1187F2D73
+C94A528F0B01C86DC57467A824FA40C3DAD5282F355B4F71EF0B70EF3615C27B
+0
+eccp_comb_cr_point_multiply 788
+B42271550976F0A7881D2AE3A2A9B702D2A03039C99B65D3B9B75701644A4DD2
+CEC8B1973968CE8239DAD9E90A6D9E3CAC1C9FE6875C721C3C86CF6F608D17AE
+CA44AEF6CE171790B75E029A9D18A011E21EFCAF4FCE4CBE4EA7D726B0F3941F
+0
+eccp_comb_cr_point_multiply 789
+9CA304BF7F19D487985428B9D2BCCD4424E8DCBE01B78A8EA878B3017157EC9D
+A91EE7C15088F8B6BC9AB8D3E262045849E2CE4CBA52248E54E0781C68DF0976
+D35FDAC29DAFE85A97EBB4ACB6E3A1FC5B97057E2FCAAE3DD30C94861D74F405
+0
+eccp_comb_cr_point_multiply 790
+22232DE1237AA88C8444C0E0D2B494667024C61D43BFCECC5F784AEAD9B48458
+1330E49E88091F929E2BA8827983CC1E5388B354D153C93212D4FE4504603B8D
+DF4FADB74F5DD6F1A42A6E1407D5D9A16E31B740549332D6B965F8948843F3C7
+0
+eccp_comb_cr_point_multiply 791
+5513BA1FEA45B0FFBFDB0F3412C0BFC38705EC7663C2EC28EB5D65D0DE0F5577
+65C6B04B634BE6E31CE5B16BAED204C9A9874E96DBD11D680502B6D48010822A
+F4679A0272B08D3F519D2239E0F8ED30FA8B5012502B12D307CA81B063FF3B16
+0
+eccp_comb_table_detach 829
+eccp_affine_point_pack 792
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+eccp_affine_point_pack 793
+29832A16CC723E993443FBEC3FE206164734D67C917CB9A80366E9FE2662F749
+B364B1F3895809C5100F20AAF0273AA8E8E5A92E197A9E8A9A619FF0F9375CD7
+0
+eccp_affine_point_pack 794
+FC0A553F48964EDB08BEFFCD94E8AA3551A06CF57F2A40F6904AE939D5BA09C1
+C39C01A433AE9A7955B9A1B5BBF20E3073322DE776F276FBFA3AD0834D59EDEE
+0
+eccp_affine_point_pack 795
+B7844C2F52AA68D288FE5C3D9E1A247B86308932C2678E867CD149FEF5EEDB85
+31461C696F8E73A18E4F9219BC25A8340219C26A908C4902170D44E395009482
+0
+eccp_affine_point_pack 796
+9ADA99796B92BC7E074DD397D4D5A0A824CB129D94C44FC19B40036B77ADB65E
+DEE1C80857D818FF656739C66DC221D5CBAD8A26806F44202BB2D485C1E03403
+0
+eccp_comb_precompute 797
+4
+1
+eccp_comb_pack_table 798
+eccp_comb_point_multiply 799
+0000000000000000000000000000000000000000000000000000000000000001
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+0
+eccp_comb_point_multiply 800
+0000000000000000000000000000000000000000000000000000000000000002
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1
+0
+eccp_comb_point_multiply 801
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A
+0
+eccp_comb_point_multiply 802
+9C93E20F7F869A510ED64ED479C6975426E10835DAA59317FD7A0FC2B6A54C4E
+883788DDFF78FB3B63CC80085343E967F42A08CB15B9A9FB7D5E588B66E60C31
+0CDFD8F2DF4D39B6B0D3EEA3AF17E698CD6E4366BBD40662090EC1C47CFABA93
+0
+eccp_comb_point_multiply 803
+7D815C639CDB4E05FB40FCD35F55A287DC418E27472B1C088314A4F7C9D705CA
+3B411B43C05507CCC414F2C0CF6A7591FB7566957A7945375260820D4D70D11B
+DFF3E16F263B9BE04920375EEEAC0A261019FA8AAF0A7264ADC25CBD1983B482
+0
+eccp_comb_point_multiply 804
+CC1BD851234F72397C44A78B1CAD5603DAC3DED209BF5AD4973721C1A2DFA031
+B29DBC68306B9F68C6C7AB06AC616B79E36088BD2F5958C1D6D9470E7CD00860
+427E7DBF52892035134CB40CC9C511C047DD57B6495CA7F567C41BF164DEA933
+0
+eccp_comb_precompute 805
+5
+3
+eccp_comb_pack_table 806
+eccp_comb_point_multiply 807
+0000000000000000000000000000000000000000000000000000000000000001
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+0
+eccp_comb_point_multiply 808
+0000000000000000000000000000000000000000000000000000000000000002
+7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978
+07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1
+0
+eccp_comb_point_multiply 809
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A
+0
+eccp_comb_point_multiply 810
+064B08D9C47D94A8D445A261F920A6517F669B72B1633AEC9B34000AB9A201FF
+8FFE75FC4B97189F4468D7514802806ACDBE127AFE8BCD17514F90C9BDCC4B14
+959FF3A753E3EF6EF21480D6171672DD4BA8310AD6C1A8E7247506BC9A748599
+0
+eccp_comb_point_multiply 811
+3CC8D5D159440BE47849CBCBFC2B18FFC8197FA8C3F7C36A7D608AC141378FBC
+EE9A8C4AC40F4F8AEBBB29EC083A031793D0DEDF2E7B2923A991CF5F145FBB3E
+B6D74A92B2AEE9A3D38F489CB0B73002664710711F45EE4F39DA55CA9FCF374A
+0
+eccp_comb_point_multiply 812
+FE3E49BD2D15C3157222BA4948533A7F952B0414600C77A018C64DA602DD1EF4
+964741D4CDCF3073F05687C94E371FDEC0498A1503EE8FDF41DF40B09B046B00
+95952EF6A0F5A0C83006043650D96BCC847B553ECEFB39809AAC1CCC78D89A90
+0
+eccp_batch_add 813
+5
+3C22AFFC632D04028687444665B9AEBE6DBEE676A21E1FA91251936F82D00045
+4D69682AEF790641F6C56DB6C91A2FF0BDE1AEC48DFCB12CB7B5FB75B238C41B
+0
+BBF362FA249258F73F4739C520463D45D6A4898F3304C7445AA667B09A020A58
+0F0AB98670CBE3C6B82196318911B69FF9F397032BED10FA831CADA40C230323
+0
+0DC7C31FC3C219CA1838D4FCD4ED6D285FC85628444A45A54217AFF95CB27F42
+354A08E1828EB046C5A75DDD8A75BF7A302D3FD1580455F9AB734B8B6801DF5B
+0
+8AABC7144C2745574D30C7DC0CEC1DD6B5C4872A18B188BBBF12800E0494569A
+5569401545F8B370AA00A17519B59916AE4DD1A84516E6FFA6D24D4178FF0880
+0
+8AABC7144C2745574D30C7DC0CEC1DD6B5C4872A18B188BBBF12800E0494569A
+AA96BFE9BA074C9055FF5E8AE64A66E951B22E58BAE91900592DB2BE8700F77F
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+D09CE7FCFEAF9710F7F0897C41C6B84B7F19F35F337D93658C45EABE34E1E51C
+F049B3F5586C47FBEAFAA9ACCE0915A566F616D7642C04DEBE8F88193F5AA61D
+0
+D09CE7FCFEAF9710F7F0897C41C6B84B7F19F35F337D93658C45EABE34E1E51C
+F049B3F5586C47FBEAFAA9ACCE0915A566F616D7642C04DEBE8F88193F5AA61D
+0
+3EB4DDE49E2F8A86F8EFCDEC050A9479D4D30BBF1B857347D426FE57E16955D5
+36082A3064465626C4380F243289C708C2EBFD1EE7670E6414A79EC4A5DC0981
+0
+3EB4DDE49E2F8A86F8EFCDEC050A9479D4D30BBF1B857347D426FE57E16955D5
+36082A3064465626C4380F243289C708C2EBFD1EE7670E6414A79EC4A5DC0981
+0
+38F59BA798B7BB90D5AE4EF616C243F4096F8912A285D2DB9AE487DBE0ADE121
+8020116C9C0C87B9435591808376A770B6BC98CDED846E976FB604F6674C9053
+0
+A842313033541B492228A2040BB1A6B8D1C4E17450C24228CD083DAFCB4528C3
+FE5F5A37EAC8E26A95CFC54133E3337809E677B966E92721344187A8D397F925
+0
+91DC57B5CD2D47D63085C6ADA90E996A6549F27AE926D335EE22F2C5B96F147F
+23E344F75D94F8D8A408782269A2A3AA21B36AF4455F0E1BE0607051CEEB85EB
+0
+393ABD456FA6D0B73ECEB9FDBC5A181661DE543B98BAC2FE949B97AD9237F235
+4E32254E4ECC6478DCE50EF2C79DC1265911C2FB9E9D2EDE1DEEFE90B2F0DFC2
+0
+eccp_batch_double 814
+5
+A48F91DD0C2BA3E8A78D70EDB016F9ABC186DCEF8CE9047F847AF88853083494
+77BEB4AF16A964831302A0FE435C33C2B2DE2F4AF8F269BF6586134AA3AA2E0C
+0
+5B68B0E0D39C29C09E6B6738E8F61820A5230A9283A4171EAFA1418C64BFE379
+A91612DF62DC61F42AEB511574B612C9E26A2B0D2BD676D18A1EB01B152BB8D8
+0
+0B625057073C27E0AE0E4D71DF560D6DCA64465FBD9C8706296D1FAC5AAA9006
+CAC1A01FFB5B41168F66BEB81C7B7CE5E078B2E53020A899C7BEC1519F8F6306
+0
+73D4D7CC6246350C2DE84C1C61881C3D222598B0566A62AD9594D58F7E5F786A
+FD982A5AB47C70C006E202DA4F48C98641A331A5442316B0FA17B17131BE2C92
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+86A10EB9ACD8F5C1C552EDE1A34B94AF892E98BA9052942A1B1CD4ADC9BC3026
+A4172F2D189379B05569EBBDB197C469904DAA9EA4D2349377907800480FA316
+0
+B679D8CEC836CA8B10924FDC21FB8C50391F91F56DB461E4EE74AC58DB9ADC96
+DBCC6FA69697D706D96490CFAE89203CFE53CA7FE33F065AD18E3930358792D3
+0
+A4A97FD9D1D7BD0885ED97ECDED02DF00DD0906099FD813BB2F6FB7D7108AC06
+4A0FE0A676ABFB7C68A10FD356414123FBE5699D999226FB2BABA736B707EFB2
+0
+38AA255B413280E617E2E633F8B9E3E06CD182011845B2642BEA1A6E9E250462
+07C472DF97CBA7B3E363B2E45D5A10AFB91F9A89274B9159C52EE1EAF386E634
+0
+eccp_batch_negate 815
+5
+44A2DFD80F842868A626B31E3A08250E7AB95674E358F0095257752E9E9DDEF1
+CF6AAB8651796EF9FAA6E0551BB5A4FE022A56ECAFDC77E17A68C96046C1B65E
+0
+44A2DFD80F842868A626B31E3A08250E7AB95674E358F0095257752E9E9DDEF1
+30955478AE86910705591FAAE44A5B01FDD5A9145023881E8597369FB93E49A1
+0
+E6C818B273DE211B13778D93878FD5092FEC26DDBE8443ABC5E1694B62683072
+3F808F34A03AD0E4A0B40C934311534F6EF3DE142556EE5C6CAD43552E722542
+0
+E6C818B273DE211B13778D93878FD5092FEC26DDBE8443ABC5E1694B62683072
+C07F70CA5FC52F1C5F4BF36CBCEEACB0910C21ECDAA911A39352BCAAD18DDABD
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+70E4569D0EB5C5243087BB99E38E400ABFE09AAAF54C7723F42D7D13007F72D1
+BC6FC22DFBDF22149748BBDDEDC9062AABF5C25234FC7736A16076B7AA49BF18
+0
+70E4569D0EB5C5243087BB99E38E400ABFE09AAAF54C7723F42D7D13007F72D1
+43903DD10420DDEC68B744221236F9D5540A3DAECB0388C95E9F894855B640E7
+0
+7CF45200715D1DD76AA74306587712E15B5702E89DC00E6834299199CE6F15A1
+D53ADF601E4C893C86B6C1FBEEA4B821E5DEE2610E88E7471F16F0560AABFCE7
+0
+7CF45200715D1DD76AA74306587712E15B5702E89DC00E6834299199CE6F15A1
+2AC5209EE1B376C479493E04115B47DE1A211D9FF17718B8E0E90FA9F5540318
+0
+eccp_batch_add 816
+8
+B8B0C9D1CEB1EF162E51C01B6403FF5C4B31C15175846EFCF14EBA5E90E077F3
+5203578BF55320CAAC781AF3AE31AB8AD1DEDE8E6BB44ED339D2EF159F524A54
+0
+5923EC8980AE5E56D4CB8BDD047DB1E92A67C459E49AA16B823E1A91C3C48E05
+51D85CFCD570BC914D801E6B979D06C29F5AB56D09E737FDB73F1EA51FE04C09
+0
+58480FB40642A54BCA3ADBD85EF6FDD4A05985E95450181D396A823BB4CCB8F6
+53970573E0FF1DF4267521E2CA1F67391329513F654514082BD6A7477E1A423F
+0
+F09143A83C2D7AD91491E51DCCA2E752EAE494821C7AE4B8D53E6FCB5A5B413B
+634F0DCB1D7B2574F1A00D4FE4B95AA569D85225DE5159DC03E1C7AAA890403C
+0
+F09143A83C2D7AD91491E51DCCA2E752EAE494821C7AE4B8D53E6FCB5A5B413B
+9CB0F233E284DA8C0E5FF2B01B46A55A9627ADDB21AEA623FC1E3855576FBFC3
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+EC5108D7DCA2C250AA7AAC0F27A6950DBB0040A6217757EDD1442B3CB0BBF18A
+40DCDF4F2ACBA8EDAEF591513E632F25B6E56418B7D6C31D6738A56C8026C3DA
+0
+EC5108D7DCA2C250AA7AAC0F27A6950DBB0040A6217757EDD1442B3CB0BBF18A
+40DCDF4F2ACBA8EDAEF591513E632F25B6E56418B7D6C31D6738A56C8026C3DA
+0
+9E7D63E6D913415322B0ECB45AF04E38F6DBA462F4A9693014CAB1C91861CCF3
+B6CDD99B5ECB0FE8081E981650EE8F82038359387F7F5728E4156A47B69A0F41
+0
+9E7D63E6D913415322B0ECB45AF04E38F6DBA462F4A9693014CAB1C91861CCF3
+B6CDD99B5ECB0FE8081E981650EE8F82038359387F7F5728E4156A47B69A0F41
+0
+C0CA633A8DBCCB4CF14974F616DDE8519ED2E416113663EDD97322916018176D
+841E6DD3FA506EAAB672405D1711113A34E103C9607547D48F25EDBDAB2CE560
+0
+B458F4127187460F6CF4ABE5825707C9AAB29111FD8DC261E9BB0B6C07039C2D
+D3026E2EB6DD982129CADB6EF275493F80A80A37A86921EFF9FA2F6C33CF18E2
+0
+AB3BD500814CFBD662C39504BBD180C18C12936BE312587A0FCD0E064B31188B
+747DA1BBEC4E4AF99BE2F1DE4C5AD1CF8B063A896CEA367A76DD1A1F8908E296
+0
+A547AA269B31EE53D6A96A5B0E1D81C473F5896883680E8492B86D141F4A26E4
+7B1AFDB3A0FF47B463FD5D92466AE3815BB42BA43C8A97AA221E3A3865BF5B87
+0
+11242A8ADC35E141219C1688E016073B381D88794CEF34782CAA89DA0F90A34E
+04810E896DD778BD6C4FC103DD20FE6AA0437B52660B251A538C0994731F9F1F
+0
+AB3F86BDE41EF5C0BC532470C53ABDB4519E7B8784D7E16D530E001B93E5CBAD
+F1DECC898BEEF142AA762104B326497BD4B986308E54BA8F6CB677553C71B590
+0
+109DD06CCFAC0F956BCF3845BEAF3B3491B61B7B9B0E0FF3BB2E4A905A9155E5
+3C61B88386C9032A95F0A0A7C751AC1F0EDB9B4FDBC5144658E6F2CE0196110D
+0
+C956CD6A36BB02193408913B4EB25C00ED7FEABADB9ACFA9983CACF939ABD47B
+07B49EE63F6A9D9C1E4FCD106D3F05694B91D4B16C19B31EEE1F591871150A23
+0
+72AED82F401E77A0FDF45A32891AF4A468704AA2988EEB65D570C16425E53285
+E97ABA21FA562F7BB97A11538B7E9695489F15B2ADF8DC75B809ED1FB0ABC1E8
+0
+3CCCD3DEBC0711D3E5A35276A28E4152541757501246FE268C44069B7F428E24
+B9C813CADC3396A51CB328F5D48932C96A43330D68AB0E9B62D281B4696C63B8
+0
+4B05027A5219DC8D771E17BFEC3F70603F8A0AC70C803EE24BF25D62DF8E58CC
+5372CF3F148244A33464A72846D1D02C7C8FE56378018A83C8AC6AE0AF18B410
+0
+71ED02ADEB647B3524BC6AA218C832A3E055B4C25954098B9D49412B7BA7EDC7
+F4603F9795866CD406CAFC251FE25BCE54CB64A3DB121BE3141B6722E2ADED17
+0
+73627888C849AF0EF117229F2750005D2572B508DE5CBACCA054E43F39DED8FB
+7CCC07A7EFB12CD26A8C3F95F54AED1BF32F9AC3711769292D611BBCF85DF85F
+0
+eccp_batch_double 817
+8
+0C3B2A612AA15A27F8D6B5288B6315C311EF703B61CC908F7C86F10CEBEDA0EF
+EE09CE5295AABA4664232FE46807D3700839634940CFC51E91AF6B7AD26C70A4
+0
+68DA2F15021D597C73F29E5FC70963E8F0D9EDFCCA1701126B4BF622554057F0
+D338B382241591F944C3EE0237541265275AFD977AF5FF7CAB228894905730BA
+0
+67CCE3A3EA818AB5F2FCC7C0B08B4602F896964FF4BE3787DBC7A46E53C58023
+0A5E1BA4D72B9388BD0627B2A536898915C50E6AD04E10F9D299D4E633598326
+0
+962E4BB6AEA5E4B66A937332FE2EEB44F77821181D361DD2276C2420CF275176
+284CE1D1CE81D0FC314A01AE049F2CA698637765BC8E5AE4DE0DA591A2754FF3
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+2B76BF5C254FA16363695B91AAE27EC7847572D6054ED1A5D5786AA69969E5BD
+D7CC3B0C94241C04BAAF2054BFDC676CD69BA09C153F05931E8089A0B398787B
+0
+3AA1186327BFEF80B357FFFBBBCB7059961AE16C347868E52AAA69737A3FD1EF
+F9CDC54D71E5E3CDFB49D6CEEED40F394041A9DBF86F459FF741326DFF95B980
+0
+1D861D90A9D3636D168268C85DC2975D216FB1CA5778EC230A773C195D9B225C
+12D08E3B4E5799CE58A526B71A81E95E26C2B6DD43D5F80DBF6C7EFA12F37803
+0
+2799DFEC283D3F9568A3C3A3ECBD1A0CB18AE7240FFC045134FB5BBEF13D2C15
+E4C851092EEE35D4D0A50E43D52E6590B105B94A6D47AA1FBF8F504F19DABBC6
+0
+327CA7E9CB4F82F33F3976D3870ADDA11F2CD72D0D596AA891D0BB4B04BD8DA3
+A05B7CAF732088D69521378B76C22C1417A2BE0D29BFDAE250BFFD02AF810386
+0
+B13385BC86DFE78C5D7B9CE792865EF649E47363A45F058248911565787484A9
+05A182D05A04F246351D951EBE74208954F7D88D48D7D4831333965FB63811D4
+0
+2A2301F87A7C780209156240BDE431D72F62059071E872D8846D1381BF8571CE
+39A3029F095146442466212283C0FB6E85C69183BC673DE47230B64B7F031FF2
+0
+C1FC03C8109D7D802B3C7B0610FFCD6CCEA2310E131AFE91DDF41397619B6729
+502F395C075DB6AB89355E6EEECB886F75EE840D38D0410643AF1805FD98904A
+0
+F921D5A22CC8CEC331EDDFA114C5A6E6CE8546A112502F20F8936A48925E60D6
+EAB48F1D481AB8F399C29BDFFF46121F303CDFD38C23CE9DEC7F1954171C71EC
+0
+2DCFA2FBF292794EB7EF9E3DDEDC982BA4E372F2AB9941E844BA93CEC4A2C46A
+5C3E5569C276FBD8E69709454A79392362E0AFED63DB055FB4A2F4C098235219
+0
+eccp_batch_negate 818
+8
+496CF43C7F593B8D5D83B92DBBF0FAE8E4245A38C059D9C431E8DF1EDC85E289
+3991A2589BD4626C7B08E3FF4B1ACFF0A78B57764A688A1305ADB92A71ECAA47
+0
+496CF43C7F593B8D5D83B92DBBF0FAE8E4245A38C059D9C431E8DF1EDC85E289
+C66E5DA6642B9D9484F71C00B4E5300F5874A88AB59775ECFA5246D58E1355B8
+0
+5BDB52817405719A2BD076EDFB4EC1BE0D9F4F54BE027D1BB9F3CC593C5C2C6D
+2AC77AB8413A43F1CACE463F507A0173F7C1FCCC123A9A3D86DDB7D046977573
+0
+5BDB52817405719A2BD076EDFB4EC1BE0D9F4F54BE027D1BB9F3CC593C5C2C6D
+D5388546BEC5BC0F3531B9C0AF85FE8C083E0334EDC565C27922482FB9688A8C
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+D06701492A55B893987D425C0A5867540ECCB503D12ABDBFE82DF193510BEA08
+A207F4D3FA3C6D33405194E277A8C3A545F43BF74C32A2CE7085D478FB6EE851
+0
+D06701492A55B893987D425C0A5867540ECCB503D12ABDBFE82DF193510BEA08
+5DF80B2B05C392CDBFAE6B1D88573C5ABA0BC409B3CD5D318F7A2B87049117AE
+0
+016F47A100833EC01BAB95AD28B5C19596E6D00EE9E5FD987760A1AB108211B1
+6BE721DDA037D45DF0CF215E77B562E65EFC23C1176C63263CFDBE90FF475A37
+0
+016F47A100833EC01BAB95AD28B5C19596E6D00EE9E5FD987760A1AB108211B1
+9418DE215FC82BA30F30DEA1884A9D19A103DC3FE8939CD9C302416F00B8A5C8
+0
+6D3851AA71B4E5759FDB19E0A093A5B17E5A7BF7B37A0C9EE17FBAFFD8A89838
+5643BA439020B940B026CC879DD7654DA6F8724B1C1F94B91A3BE1782EF8D662
+0
+6D3851AA71B4E5759FDB19E0A093A5B17E5A7BF7B37A0C9EE17FBAFFD8A89838
+A9BC45BB6FDF46C04FD9337862289AB259078DB5E3E06B46E5C41E87D107299D
+0
+43DBFE93FABF18FA531D4B57E49A7EE5DC3E944C8F806F862A04D3A9C908B127
+2CB0FE4A43D06B22686D6171574BD30FC665BC7B4C078E4925CFDF2E95C85BEA
+0
+43DBFE93FABF18FA531D4B57E49A7EE5DC3E944C8F806F862A04D3A9C908B127
+D34F01B4BC2F94DE97929E8EA8B42CF0399A4385B3F871B6DA3020D16A37A415
+0
+1BF9C769B17E677C701B7DCF4B819231849376FF351D1794832665652CE2F646
+CA64ABB8BCBF1872069EF1D8CB1A588A54E9540EBB66959B19D961AC9B6FB055
+0
+1BF9C769B17E677C701B7DCF4B819231849376FF351D1794832665652CE2F646
+359B54464340E78EF9610E2734E5A775AB16ABF244996A64E6269E5364904FAA
+0
+eccp_fixed_point_multiply 819
+2
+1
+8B49A9207BD5AB3D43ADF93AF5D48D49CF27EA2C613209A511D646FEE3C84366
+0FAF77278881F27C2E943B6DB0B0B1B8EA08CE60D5E497F8B5DCCB0829A44C5A
+0
+4348C7AB805EB48D1E3984AC4502CA96293DC0B40EC913DCC986752688446867
+63D5FE946F41DFE32C859579D10D7D326E7B289ABD09C384EED23E69BCCF3370
+4DCBF5505A2880CA24573719589BDC183A30972903AF465213D683ED1499B8FC
+0
+eccp_fixed_point_multiply 820
+4
+1
+C5CC4C655C6FCA7CD7972AB9FACE96215E186A1166DE550590E7A116690C4414
+6983520DD2EFA73245244B06908E41B081714CD35B7D94D0FB41CA7E67CB7394
+0
+77D9BD6E276C98F4C692B150FF05F16FE509C439B1B7FAD1A52648C3407B5483
+70537BCC993BB9254D24F58D8E40A9B071CEDD7EAB2B697A9C92B878BDE8D316
+BB1E7ED74EED54F2D9CE803B35691EEFFA2C4CD12D6A4F2F5DEA6364CB543EBE
+0
+eccp_fixed_point_multiply 821
+4
+2
+FD23C28995248526E5E889B17B05E406D5A8E47536AA20A559D9DB379188BEBC
+3358FA9B98D7B5C38D364A30BC313D34D8A142824EABE3DB8DAB78A7001CF25D
+0
+2C213BEF98040B725363ABE676FD7E8D1C64EB9C25D5840EEC0B7119FD168B65
+6348DAAFFF3938344A68FD59D64862211BA8787BAF9D0DFF19AC94E47D540422
+B5A37A27304AEB5639CE3156564A510318F8D6C6509A1036D9DF5B25F983C2C8
+0
+eccp_fixed_point_multiply 822
+5
+1
+7EF81F39EE7B7B95DCC7C58F73E7804B168879E9F6CCA5433F525F58F481CCDB
+23CE97CA432481E28ABD42F5E0B48269AF3E24160F7BC32C66BEA78BC69A5513
+0
+91AAB7519AA39450F94B0A60DC671138D426E6BDBC08E3718D9056A2DB9BCA79
+FEB12F883119266A59E307F9556B8ACD2CF385D62BE74DC8E0E6631FA28FA494
+8B61A722CBC2877DE32663DB3496B1C346482FAD4AF726AAF91DE315134D5E63
+0
+eccp_fixed_point_multiply 823
+3
+4
+997540E94CD97DF4381802C3607C1753E9BAE7C90D7A539F5304713E02256966
+F1ABF1427D3EB251115A67B4F0A59159D578DB71912982C43AEC0114EB5ACB7C
+0
+6693D28A65CF2CDC133C613525239F262B48F9C46457F288A14138B17E4D3AD9
+345A22723F3E7F784759CEEF7549E4B178D27DD12CA76DCBC7F5CA5F2168DDE4
+7C98AAE895D7A2836681CB05D771AEEB914B94C993FE229DD54C456F3BAD9A8A
+0
+eccp_fixed_point_multiply 824
+6
+2
+7991FA904A814A28697280277F34A651CBC0B1D9D6D0897FEF97DA4EA39DF09D
+DD9FC21A1DD274567632D1BF7BE84CCC9131E922E596B82DCBF1BC5046F5F363
+0
+B2777CEAF47E19BD9470A306E106B2B169016B7D37C8F84576823D567416894F
+1C5A7CA952F155B37A455EBF1E7BBC5547F36FDB636965A689E10E2596E29A8E
+19627A0A24B3A629D6BCBE46962084D2DB49717B51AA4FFED987AF8B87B6F01B
+0
+eccp_affine_points_validate_batch 825
+1
+C10FCF5AF108D2D70F429AB8DB7C6EF314F5C93381CC7FB4680D3CA71EE3586A
+BCE4045A899C8B023159B4E6A00BD9F7EB420F9E8D757DEA0C922C944819FE99
+0
+1
+1
+eccp_affine_points_validate_batch 826
+7
+91386CC499B81E4DE62000D67F80965F117C20CE0D415FF3200607C35304432A
+2437EB71F596650FF927ED87C92E3EF38CDFCF04BF5CDF5B154BD3ACDDCF6500
+0
+1
+F8A35E912805A337E93CA24B6C0A4A910369B26F117DC4BA51999BB3510A7A83
+D85CA12EDF7DF96045BC265DB9868DEC0A7CA8C896AE1990B30C5DB188292C03
+0
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF
+166F0C6FA591AE6E2F5CD21EFC9E12BFEE189449ECF7FA63E9E693AA273FFA46
+0
+0
+AC6140F1E7520A3CB66BF688F6C36596C8C865B527AD8B953A19EA2572F57ABE
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF
+0
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+0
+0
+399505D8D2048B4D00C7E88418DA109C1F22A26E51C9DB5153689A11E6EF5A21
+42BD47FC589AEF5CD075DA8D11DA9CDC5D37153840B0C998C17D167157FC2D5C
+0
+1
+2
+eccp_affine_points_validate_batch 827
+20
+DDFA96CA784407AEB6CF56686614A2E167B3CF30300CF6311BC7C693FB5FA317
+85F688802795CD54FEE5FCA87E4937D35A4D5B518F53338508B97B0C7DAE1CD7
+0
+1
+776DEF4E868556573184605E9866910A3D73FA757380EB88F65EFBBED50EF287
+DD96ABA2D07F85C9DAE729764F11054828D849ADEA1CEAB512F87F14258D2549
+0
+1
+9C0629DD030DD90C912D78F5E5D571E2EB903B20F5BEFCE0F5E2AA3FE8D7F390
+609DC8576A166161D8107E246CD331F8B235D2377B3E2A5F98C864D43ED93222
+0
+1
+4898185F53DB64FD50E44D2663D1C718234866A9803D16D5F3AD40CDB92920BD
+784061C603CFA4C4E84E026912645836B0817F2EB1FCFC475C775F718B465E96
+0
+1
+461127E945AB20C98D67CD1108CE1361FA5CFFBC593FC914E10EBC2D0FB0C757
+58F10D1606ECB9E4AC46BCE5EAD4B67482E9897AC4500F02D76D04773EAF54E6
+0
+1
+0D422D1AE89295BB11BE57E32E712124B241037FBF4710B083080541E6E14F87
+75C59D45BCAA6C442482C0C9970D348CD485C6E0894562CBDAA114251D7EEF49
+0
+1
+5B5589F08FB44385C0A63C307BC147FF61ABDDFFDAFB4BD35495E3D21E3E610C
+8CFAF8C8E41B422B2B52DBA05AAA3A6317631FA468DCCCFD29C39C53C2CCD1BB
+0
+1
+5527C10D07D4FAAF30BB0C2F055FCE99F332F12BE419191E021994F1D561A64D
+1BC373D033D99F09E0ABC3BC196CD238772158B9DA85CBF74944348EB6FB36A3
+0
+1
+57C2FA80D930C0D183F4681CD26BBB9421165F70E41AA074E2C892A2BA8BC44A
+86A01E5570761B08F4F4CC414E7387B9C3D4E3071010DD555706AEA6429109EB
+0
+1
+BA8F3311D592F31EAF71F9772BCFD12711AC4C2880B40B7D34BDE32394318A8E
+74C9FE166F152544F449D606015B9EFD207942BFEC08A1625B5FB2D553525C31
+0
+1
+ACB78395FA84C609C9892816CFAEF00CEE085ED92304E9806776928C839FB1DE
+F2DDF279E41C0BEED869E71A5C318D40C79C0778052BB1BF38EA9081288FB526
+0
+1
+8794162B31170AB23E1F99C4F9A43DDC46889A38ADBA02BD531E924438FDAAEB
+F93C2FC975D9210AE5CEC5BCC2824EEACE93E8FB484B7223051D98EDA84011E7
+0
+1
+4396998CE06154B39EAF5630B42C93B149DDCF99988D7902F9E2BCF25E5E210A
+ECCE1612FD353289CF35B82AA6AE0B3B27E636C26C63FC22802B7977ED031B2D
+0
+1
+3410089B85AF1C0389A2162A2E23DF64D65F96038D237C5BD8D2B472FE8D4D5A
+BE8695C3FE1BEAEF6C36FF5857DEA38587598B39EB4D943090D60C879F5A0F86
+0
+1
+89F662E0F620A9BE95B974B4EF8C622188B0207BCA504B22EDB4870699EC47DA
+069CEC9E73296BD7194B60AC05A1868D1F0BDACF908743C2E5C9FD3D8D268FF8
+0
+1
+4D783522CEF8E353AB422335147B8F2453DC596C9376FAB30D9D065B4CA66584
+6BC2C7803923CFC38ECF3A1EA9D04AF09A98B44D0FCAB83ADC5E667AF584862F
+0
+0
+23475D626B2357ED9BE7C80C6536510E0A547270BFB4FB739F6FE45A1C976EDC
+4D7F3F58099329B2D9C404271B15172D3D7811FE43F812EC95F42A73C87AD97C
+0
+1
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF
+4EE5677786EBC6ADB637B79660FD5728B26A1785D9991D4D2A46D3A05562A7C5
+0
+0
+160A6555C04280429CB7C899BD1AF7120DC273AF5B106490E3F386139EB4F4E2
+91CDB28856154D2F9F2C63DFE40A36BE2B29EB77D885E7B8FA42CDC9B7EC514D
+0
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0
+17
+eccp_affine_points_validate_batch 828
+40
+7C389C3014E0E3F9EC4F38A741ABA15156B6C4AB5F30F0C1975B42B1BF2E8B4A
+BFF69206287558011EA5F782C1DB64C205A2E3A7456D7205CDD32D615B462A59
+0
+1
+B2E0C8A58FACE51F6DC7E4E287138F038583645CFB2166E9F705B22121D21267
+400D824BDE1913A9114C1C3584067EE6699969C3DB9E7F6DA901301291F41DD2
+0
+1
+9D4ADB084486C9FDEA11B6917306BEF15658AFEA07312E5E3B1298A9BB0E43BB
+664726F05F7703BB791F3166420D1C21E72D5AA6D1BBA4374CC27FDA077F4DC6
+0
+1
+2EB08542795432816B4B3B699763290119E8C61647F751B203F67582EBE23ED5
+AE9ECAA00C33FC6F2DC50093F0BFCA9DB06231B2CDD81630EA38147F46A28291
+0
+1
+3251C885407FCC3EE7CEC31B80A4DAB13FFC71B2F64312D1C3CB719E55DE5B05
+9C37969A30C71F5508B18277D8E882DF9F17CD07AD44E4E18D56D2EB9FC34E5B
+0
+1
+77E1CB1AEE6B061EE1AE3CB1265B3FA63462DABCF804F51DBC9D2BB28FFC3CA4
+844B642B7A5E8ADE7C913F643E2712BB2646BAC2BA9B146F30EBCE0437F9CDC8
+0
+1
+ADDF6491CE66348A57F65594BFB36B1E60C9D38771C43B123693C7C8B9892E24
+5639D17466693E970024D6F6F0CCFF7D733026DA947B02655FAE0D964BC8619E
+0
+1
+631F119543A5CFEFCB2528FEF20D6C7B28E1FE11237A651433A8822149FE1844
+FCF7503490D73A596E06C3965C564C398F560A1F5E24E04B4F5CA4C7CD705C9C
+0
+1
+8FD6B52AF2D7A4C29417E5D4DFD9E0A75A85FDB91D61C7FC40A766EB8CC7BC9D
+72A7837B8F5CAE74A5DF989E08BE44F7CC823D5670D0D39C531E6FA0815A4BB4
+0
+1
+151AE4EAD53ED961522EE343110E543775EA2D62E75F5E9A3502E825610C0BF0
+B5C12889D9D5EAC4E04DA0B0DB0907542341BBFA6A47DBA07127DB4C5562A3AE
+0
+1
+E5EFB313BDFFD525781BA3E26C0C653CDCBDDD77E0518ED3E3481728CFB4AADE
+A52721C159A1ED417016C17168EFC90BAEFA6CC20F220C32318A615A0B5AE98A
+0
+1
+3F5FF89562F9C14B7E798CF9E3CEB8B8D43FBB5156982D43BBCCBFE9BF0BEB93
+44BA8B828DDEC1BEA6C863350CCDB40BB57EEEEE7FA978552DC89167A8447590
+0
+1
+A81E5BB83B1304E62DBD353D2F541EFF8829EE58BA6A4B03384D82EA0FDE32DB
+0534A873AA89475D26FD73CA485C753D1C34481C9A3F33BA1A9C8FD87085F920
+0
+1
+74763DD577D95710B53FA20650C482E98BE3E192E0BE0576BBD58C9BF6AF2486
+17C34A916ACB6E2F2453854668A7FD89643009BA4A4C85FD93F450CBAA30D7C2
+0
+1
+C31DBB4CDA76A5159544B4233DAC9C22A553062B0581CFBC12639FF5BCB9030A
+A8DEF9308B931A2A0BF1A3845E9D654A5C37E3C1C82558E411C4531947D6720C
+0
+1
+CD779335039008C75D42268A4D4AD1246A430658344B45CF073A8B9EDB477946
+5EAEDC7734E480BCD51040AFDDAD83858926FF261D833199DAD0E13F44CFD556
+0
+1
+83106AADAC68DA9C9DCD22A48B2079963E92D0928862A00A99CCD3628D10E421
+6DA853F9C640394B6945E61DD9A2BE599737C048B279E638D903F84B928666B4
+0
+1
+617FE8791F960BBF1FF45C7FBC6612E75D0DEEBB0375E3CF8143B18007EB7BEE
+108A9A75E4E8763AA33FBB49E4765A0125D7B19CA74A349D690B031880E9B15D
+0
+1
+2326C196D4CB0A882FF04EBBD691041957B333414991E72D15BBF5BDE08CE4B7
+ED23F0FAFB6FFB933E3DE69B28B267843CF1DA43FC6108D98D9BB020CEE0D660
+0
+1
+3C3DA4AE077BD20A321936F913886F82FD9E3257552C08F3E6C2C9F7D078EA1B
+8435F1DFED6D04A98BACE5666C8AB6F912F95CA07409F83DC45123BB2BAAFE87
+0
+1
+F33D057E190E9F84931322EDB7051A3D6D4620104B9E48B21F92F4545BA820E1
+DFFFA6889F9D565672932C1836C9DDB29966596A4ED4C74B20A0F46B8F13EDEC
+0
+1
+7E012E08BD055F52E46FA7D9B31ED5F43522CD6E4C5D64AC1DFB1189716F3AA5
+A8FD089E6906B732D90183A117CE9AC83ACDEA4876B82910833D4442A315112F
+0
+1
+9ECB75B2389DF28265CDC5231420440E4F3F20726872B0AFFFAD63C5197D1AEA
+D8C449F74D7462859922B9EBC1D48D2A1621278498A919D585774FD51FF39AD0
+0
+1
+0B33234AFEE7EBF12437A5F59FAF895FF94013EA254B14B6D9193D5EE92C79F3
+233C4F9485576177C74FBD8179D85404CB95F304FF0649BDE25528B8C3525F44
+0
+1
+B8D096B9589FD7D2465B84216A29F4C7BC0047BE97D5023D1EEFED02A48EA2EF
+28E2807F8DCBA6069AA39A2420830AFE50049F39255276D854BE786797654767
+0
+1
+00DF1F4E8F6FFD6628A6779CCA245AEFC6750C585306E0EAABB74BEB154F5FDE
+62CF2D58C92B7F5DD24D3A749B19F76F80C67B6BC1FE072FE56799705702E514
+0
+1
+71ACCE1B19274E55F773A3A0CA1A2444070B62F1E85738C5BC41AAFBFFE51704
+779C3D49DFD3270348416A8D484459E3F460A9721AE439808F8CC5DE86D88B5D
+0
+1
+489544B37411C033608F2D54EABC97DDC96B1C306B07C4ABECE54358285411C5
+2CC84EA164EDCD541A94B228848069C16E59671AA3A5AA6FAD1105FD3FF7F6F6
+0
+1
+2B8FFED496E3840808AEF17CE50ECEFA7372663C5804FEAE615482DE2EE15012
+B726CCBB4400665A7B978923934F64C3798BCAE80DF32FB478DE972A4B86F96C
+0
+1
+B84C8577BD9B8D43F1FC34716B0CEE2395C0550063ABF9C294C0AFF460B447CE
+822EEB9D65ED16622F5DE7EC293E65287E66AFDECD7557B76146FACF63B92482
+0
+1
+D41998320078EA4BABC5A6D1002AB15E8F363186DE26C827E52350CB4C9A99A7
+20D6CE977155958C7F43D2106B1E0AA2945702242C629DB625FB37614DD7967A
+0
+1
+7CCD95ABF81257E0260D4D97E165C6612FB3BE280314C8B7D93D1A387D8C7B84
+7AA3728F5511A354234B2FC11F585D984F27210E821BC4063648867754C9E2F2
+0
+1
+325E318AF6461E8EEA9C280715366915E3DC314643E4B2A51BA7F6997E62C2A3
+6625396198FF87E23609950B0842546223091258E8028DF54A14FCC4FD2C928E
+0
+1
+40A4EC1441138F3E7EF3881F84A784AB527BBBFBACFDE57A2A65FFDC8F4B4859
+3AD31B64A42C343C8F3FB40D55CC3A6500CBB6FF2A002EF06B1C192A6002BF9B
+0
+1
+409DE45272F8D0C040C09B414843B28DAD3BC374021E765D63E399084FD6EE1A
+7E57A8B3D406D5827F5A050753791EDB6180D4B0F17618A81640A6204E9907C6
+0
+1
+74A2BE323F881F6CF5BE56C9649BA160F5C3575985EAF149F851ACDE9DE48DDD
+69E14E07778401296B4BB12FE0483BEDC6B622FEBA6D6AF296741471E7DB6D13
+0
+1
+FB289D847AB4E72279A7694271FD417080223542963C6E1C8006C3C9C4C01CDA
+99B71961BAF9433B98FA969496002E39C2AA0497F49DBBDDB2CC1A9B153B64EF
+0
+1
+5021E5F8FE337D7862EAD45F78794BA97B9C9FDC74352A380354C271D63F2B61
+D4F7302B02C23B0DC13C85E9D9E97B9020D21B56BE84EDAAD5E9584C8513E879
+0
+1
+C5C8AA60C8D6424FE4BA46519531E98048B14E4368EE6241EF22A0268C367014
+7032D051753228AF32B0C27550F2242F29C2B79B67131DAD562EA360700A35E0
+0
+1
+BAF30DDC3312B1D6154FE2BA6B84F69CA8F6000439713B5E36C258896BC6BCD9
+9D78879445B9FB0FEB40875F44B36F1B63FA5E680831068E41EC25FF80F272B1
+0
+1
+40
+eccp_point_multiply_public 830
+8697FBA813E4A31FDFED4EA07DB2AA64863B7E5C51BC6433FB4821246FE13F9C
+F88B97B18B9CFA160344CDEB3AACA5DF51485E3BAAD845A6FED298038E009BB6
+0
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC63254F
+E45D616E42F37BCFFEC025BCB4FD8AF720CFC48DEAE124C28D422643E9E27946
+7C7A948154EAC27FD4F9748B5F51705E7743263DFA25F9CDFC6E013B830D94A5
+0
+eccp_point_multiply_public 831
+52AD6B3CD43AB6B82AC210240DFDA6F27014016A6A8F55CEC0751C50123A10A7
+1F57C9911696FE7664F12DD32B4F966AE53DCD2D0729B57D0858203C1230CE11
+0
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+52AD6B3CD43AB6B82AC210240DFDA6F27014016A6A8F55CEC0751C50123A10A7
+E0A8366DE969018A9B0ED22CD4B069951AC232D3F8D64A82F7A7DFC3EDCF31EE
+0
+eccp_point_multiply_public 832
+C177F1019A2D855A11615C6748E50C143A94D36A09DC1ED4C5DA45A755F9B045
+1D70EDBCB6C89DEE2F96CBF2C9544B3A3838D01C10E2A67E9FB7961CE9E97770
+0
+1744613CF4DF0A9B5738FF3710BA1F4CFB3EBAB753B26F554456C1E5096F4BBD
+90A0C370A1C1C28958B3F58A37DF5B462CB590FF65298E06BAC32FC21F485D8E
+B9E9439959C9C1AB288562C8FAD35403B9AB912B435E47D11610B1BFC8250391
+0
 exit
@@ -3455,4 +3455,1577 @@ ecdh_phase_two 457
 69754E6F2E6754EC6E9943A1233B51EEDDCAE9F9C95819A1725A240D386A6858
 B0D902E04E3A344DA2B54DD56366E9DC0C77EB559731B0F04259759B71B77471
 0
+ecdh_phase_two_x_only 458
+19FD73D1E495249A016D70E8FFD7F9EDA0517A0F1920207D4334B1300C0F0CF0
+4812AFF57C971429B3CD14980AFD5DFD7CDDF5D3E0DFD4C26F63041DB8234A11
+0
+49336DFC0AD3510FC3222AD53975EA9944E811E3B98E8163F51FA3EB48341D64
+3B335B1C625170676F41FA5A532CB29DE6A81EB56529E649B4ED061BD587D7DC
+1
+ecdh_phase_two_x_only 459
+B7D1B1FE08AB23F1A9F094E14F7FD726F4250C09EEFB8B102F5D748148B00B7A
+43D2F58F6F3F1E8DB597247312CD2B7445C68E2CA67BEC871B0F753ED60DAC33
+0
+0000000000000000000000000000000000000000000000000000000000000001
+B7D1B1FE08AB23F1A9F094E14F7FD726F4250C09EEFB8B102F5D748148B00B7A
+1
+ecdh_phase_two_x_only 460
+E8E8D6E364A23E1A6A8A2E1F09ED1A32AA7F521C2FB884B4724CFEE3806D5C86
+33355C566EA3563A9F037B34BD6D74E055C8AA22587997EB542C503A93B019C7
+0
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+E8E8D6E364A23E1A6A8A2E1F09ED1A32AA7F521C2FB884B4724CFEE3806D5C86
+1
+ecdh_phase_two_x_only 461
+E45B131918C6E7047B97E5AC9D2ECDB09201CCE66F2EC10C6CEE32DC7F1F6069
+BACEF1B62C5020D12EE97DD52C07E26059B06E42EE255A2A400121D80BB825A4
+0
+0000000000000000000000000000000000000000000000000000000000000002
+C87B5AB99AF6E7DB290AF74B510FE6349988E20B55BE4F0D7A8FF7FFA35EB287
+1
+ecdh_phase_two_x_only 462
+DA3D7E19E50D3523F33094C614B7BD770F6C4CC7DF8493AB4D4223DE9AF18DC9
+6CD183FCA696AEF9BCF3A0F85BACAC115FF8E82DA83CCC040BE5CC1EAAED9730
+0
+A374ED9D71A6C0B8743C9826CD1A929160EA6468F36B38EBB4F2F4AFAB1319D1
+8E8A2D5C174020DACAAFA5EE54D2EBD4BBFDCE2946BF686031993DADC10E2FCD
+1
+ecdh_phase_two_x_only 463
+0C7A0C985A91435BDA04746CD7176B41B88F7DB62D7810192CACE80C9C10EC96
+AA50EE32A8374867EC06C382C8BDBD9D77BD7D473F33BB3CB1273141A0296729
+0
+5459CB3E623CCD702FC94DD629F9C5DE1A8395F40878BEC9D33EB54637ECDE28
+55C12C696055CA8732634742C9323032FBC388EEFD1519A39886B8CEE3F7F7BB
+1
+ecdh_phase_two_x_only 464
+A3733B31E8D689806A6268D65FE8CE98FE3A6AD3F830CBB3D4D31E55B282BDAD
+7425421C72837A06F30C6ADFF650ADBF8F7125FFA982A273D06AE70CB7FB219A
+0
+259E8041E766E43D6A0927ED85BACD9EF2584B0722A9094ECC11779E18D044F2
+16C55BBA598F2B21F4E04A687B0D96A119D6A43E4BDFDFBDE8498BF5E154CF10
+1
+ecdh_phase_two_x_only 465
+4C97C7F705301C857D3498F3A6D14BD15EDD044B651FEFE53E37B2C0CAC2E511
+8ED195207803244ACCA42745C00E5B7C07BD1614DB8F89E4AEBC4C37B2D4EF34
+0
+00E6521C61F4EF7471348C4E87EB2C2890BCE8F7E638992E181112C3FE22369E
+D6F1135EBCBC092F4D398AD639183B0C53DC7E335C5A4D0A9576722DF6664642
+1
+ecdh_phase_two_x_only 466
+C30B54E53F5082A1B0C9BC8F7AA0FB028662C7D77F3EE3B1B7AD581F09AD68BF
+3696E0DEC9C062F43A2532318E2825B71095A55E902FFB94283B7FB67301B973
+0
+6EC94AAE8B2DE286FB0AF9F68A45F0D82E10A9304F803A3FDA2C577C81B474EE
+9C241357D1009381B85E7EFD6158187D88405A7BEDF24657C26F5B81F711272E
+1
+ecdh_phase_two_x_only 467
+FA6C9F9AAA0BA372E406F90AEEA0E8B811CCECE8ACE1FCACB1FEAEAB36887A87
+1CFA5555F9F979A396B2E6D53BE5D47306682034A6E35490C9F3FE804C997D1C
+0
+F7C544D04DA25FAF7BC7BDCADBC62BE22B43C5BB4DFA4D16039593C740FB0790
+7E031EFE41DD43D36D496DD3586F161AACD7DD31AC20FFFDBB622B144BD4C089
+1
+ecdh_phase_two_x_only 468
+BA03A6F68C119E5C3E04BD06510EA4D96E7778B107EFA73C3281875F1E879876
+0000000000000000000000000000000000000000000000000000000000000001
+0
+408127093EEEADB3F6269C95D2BDECAC0A16EA63734D0C064E52D65531D8DA7D
+0000000000000000000000000000000000000000000000000000000000000000
+0
+ecdh_phase_two_x_only 469
+02FFEA0EDE3F3CB57682FF68EB01FD8B29FDFAB06D7F28F538560EACCB781A17
+D03DAD88BDB26040F0F5AC6AA177CD973EECF2A806124CEDB26E27E984BA75BD
+0
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551
+0000000000000000000000000000000000000000000000000000000000000000
+0
+ecdsa_is_valid 470
+00000000000000000000000000000000304D978712CB0206190D6C88796A32D2
+427E300F01F0C1BCAE47EEC06318870B7132BA5332A8685ADA68A63A67FAF562
+D03D0857945AC0BFC92FBD213F1E8FB7381FB202B8F305659543F4CCE9011AC2
+9D9425695B63C8299CF356EE87917203172FFC102CE110EE416302CA9BBCA9C7
+F04126C415FD24D396673EF6B416B87A486711B86EA055A843E0A40491AB021C
+0
+1
+ecdsa_is_valid 471
+00000000000000000000000000000000304D978712CB0206190D6C88796A32D3
+F2FA1A9F1DC4628F1834932414552EB8AA4E8B3DF566C27B049DEFDD2C4F2B10
+9D5B89AA7C44DACEE4809FB5B304A0C420FE25670639D5132CF0584AB31B6B2A
+32F060CB16718070A6A779691920CCDD699C5A1F257E236C0D7D63490258E2A0
+07AF732F2AC86116B02A9A2A991FE1CD5865C77515144DA2EFC3222FD0D8763E
+0
+0
+ecdsa_sign_with_pool 472
+F07244E0904E8E24894AAC0D2B8E9E597D24B28A591D460E61666B4C9FF383FA
+04266B1B8B81BC09B6C469A1F0748B006F0B9A045FB38DF8FEF785453D580C63
+337E8184D0E707DB4DB79FF2FEBFF04C9D118DF47C80AE29BE545E8C278AAD3A
+602D361D7C8A8CD7D6DB72114944A64BAB38B9F92C83E3D6C9161D851AA5CC5A
+0
+1
+ecdsa_sign_with_pool 473
+E8EFCCD723E58FD7C5E6F62825C72481F594E16E5AF7A527B96AAB6EB0A32E0A
+3946FA3935BD887674559C3DA63B8B211950C4E415C7826440F31B2EBA650C0B
+F42EB5B3ACE0E0CEFA177B54601FE1A9B565AC6F287B4F2993029D5E97F04555
+303535C03302F4056F1D8484487B7A5DA9AF09DC82E4BDDADC01227E22B1EA52
+0
+1
+ecdsa_sign_with_pool 474
+B0E452AC4CD4A7108A4E133B00AB3E464B8CACD547ACA388E37E95F546D24908
+CB3544BBE7C8697F794E8F8B15E5FF89A3E551958A4EF7612E610784CACC1873
+FE315CF53D1C6E21BD69EFFB8C10DF346EF786FD9D20C37732D4F82A500219C2
+9587AD8C2791B49A78CCFA7DED1AE0F802FDC9EEE7F804494D60D26FCD064DFE
+0
+1
+ecdsa_sign_with_pool 475
+2FA143086028C6B5694A0A304CCE0AEA1E0FF081AFD53430601482F514787A60
+BBE9812A7F68917308BDEF1C4C81E37A0F44873BE5D8F09FF3C6E8148F510A93
+4A78CF38580E7B0A7226A7C596F99D967265BB1A67246630977E77F6615074E8
+A871A143E52545FF01A7087D25B01BBA59F87FBF3CAF112F6DB5DD651745DF23
+0
+0
+ecdsa_sign_batch 476
+1
+CA29FE12931D7E4262EF884417AAC0257D99620EFD123C1555E2F0680188D55F
+509E77E6088604F9616EB0942820F1BBA028E9600049ECACAF229FF0CF995E6D
+A213E8D1431AB43CF41DB084262CB542CF4F9540E8A32B3E65578F8CA83BC25F
+0
+4335B12BAB963DB95B1C847E636F9E5DADAD3E92C96B86B2F4D6801EB75C4DCB
+1
+ecdsa_sign_batch 477
+5
+E2DA44365EF2FAB1D672C8DF155E311BF2E25582997950CBF9EDE7A44B9ABA51
+5054FF68E43748F7B30C09B427CDE05A0686778BEF921BE01901751A749FCE44
+DAB8FA7502AF906656FEB9C66D63B646525C8E4B5407C2F2A27027C50BE5C35D
+0
+0A13AD79E852E0C4803C9C385B5CDE36BDDDAD6980B954768C1A04BF0A4C9AAF
+ACA7326851A5DF9E6083BC303320DEA8FBCD771DF235A0A289EE43B9945F8DDA
+F91B06B267744FAE6047F38F79DA0880A9A6BE17781E225220DED818B1900732
+56AFD46A6CE303D154177DD16AB2EE2DB0AF9D9F9B4FDBCB861B8E87E822B31B
+E1DA60A45D7FF8609FEA137B6F3AB1F281586EC8E2F22F50C9C80A4460358DED
+1
+ecdsa_sign_batch 478
+16
+A845C48756188230E432B792FA4E86785B3736A505253CE41B719883C7080737
+C55C32A2D82F8BB6C712C216A8C1136169217D62A5E1CD8FDCBFE1484A31B1A0
+EBD985735AB7121589DFE628C3115DF2FE57712D7B3CC66D504A75B6789DD8A5
+0
+13901CBAF4E30CA3BABAA74FF3354798A04543C8EFCD4C88CD771AE759B68AC5
+4F763D73588AF3BEBAC613B79806B7DCC3D3BA0738E7AE971B38C0DD08B8B9E6
+3EBAAA0014E9831FE5FAE67494E3F92DDF9DF7B60E775227737A8BDDDE40169B
+84D1BEDF693668E15AA90BC51FEBC3CDFD5A3F4136FD5A5BFCC9CA2310FC4D34
+474BFC1658D6CD9433465F1B789E03926DC58DDE6F6E2A8F2B4B8E501D5A9041
+FAB6FCEBF934FF586B48A43FB3AE279CD464A1FF45783347A4581FFBEA4423A3
+1E47F4DA46C0E1BCFF55B46B2B2F66AEADC76BB0711FF7B0182559048237DD9E
+DD644CECCD7FAD9B3E3205DE26F8B7CF73D851A78B1EF0BD381F6AEB4CCA0515
+69543E61E5DFD1E5536D3F34A56E34B100FC18B09E6255EE8525A88418D5E1B1
+6AF30B442FFAA9B0C70B12CADDBD1F4D350590552FB20182A03DF8A216560EB4
+131ABC007D3FD617ED7EDD3A211A3EEE71887C6DAE55BAC5966D5169A3F53D05
+07DCE8A185E85507F5F1786735F57CC4D58F560F74DEFBD2BD63A7ED3413F815
+AE70D18BE435A5AFDDACAEE726D2B3915A61DA233865EF9534AA85F1B26826B0
+E15381CFE89C93CC838DFA08F42A85A5A5A6B73D6A6559437A5A40676DA66353
+B579CE513195FAF92CF17408595E2FC269D6EED81C936FD178E6C670402D1A0D
+7F6CE4947DCDCAB219CC49EF3806DF237822F63659BABA0D1B6C321C8EB80CBC
+1
+ecdsa_sign_batch 479
+37
+B406876EA6A5F3FC96BB8F474CDB17B2D86F05B1EEEB0157A692FF9C6BA7E24A
+644098BB5FA3F9D5A0D923D7D953A7D1C18ACB4E0C7689B1426D5D728CE09606
+D0C6E04C6D42ABC3EFF77A02BCC80C3367CAE312A661CDAD14568E15A86094B0
+0
+89A848F81B506E850751A7969310A08661A9BD96FF4EC71B274D3B6929B3CF75
+F721EF6CF022A3360AFFC38E68BB3CFC8578C1A2552213BA5D839D6FF70A1239
+93EA381ECC104987D8EC222A23C25FD2301B49233EA75739D7F281F12E908E5E
+1F6FB74354D2379CF344D2B52C76620C8DEA9D6F4AD169F6B30D133618220100
+FE7DFBAF177A6AEDB3A04B9EAD80E18BBF094063B2B72DE0DBFFF7599FBFFBA1
+B0284D2536BD42D03EB2CB840C5A7EC201217F5B9729E9B8F3C059C55F3B4A2B
+B91A81553F4F760C8A2F41FFB6E9B72491F3FBCA8E6F360D96D624976EBC2CB1
+7E443F3C7638E0CB47143436FC6113CD32DF350C74DD36461CD2B5CA11B54979
+A00EC6D456AB41D957FFE2560A09E8906DD77D4DEFEDAAEF8C8CFCF54232FABB
+B3E8D85C6685D803FB471FA4BE5BFBB8361EBC59E911794B1D67E0F067A9D653
+7953350343A708DC4C716AF4AB5970B16809429C6BC56A7A2FE1CF2B96CE0A4C
+A680747C4F4EBBAC0576CC94EC138330CA4EEEF649528FDFDACE9D004BCBC7CB
+2CCA92677888FA885397CE15F8587E686973D6AB503B060EF3E6838FC8D8F3E4
+3F400573FC219B35549B6769165FB2DDEC4D284CA8D19C6A4EBAE85CCB37CA72
+000E153234A1712302A713957BA50065E657A01B0CED5E0266414E8DBF7A3858
+6A5C9798CE048CFE42679F0C56167DAE0940A200D75E8118B12BC3C4852B9D2C
+4A931B1E8647D8DFA969D7F50394F55B501F7C3C6CCFF33F72590A761ADE3E2A
+E1B86B8C29E0426BC1C61FF60D74D468E101C2616A41B62295079A171802E005
+55BF9385DEB4337AA04AA2779A0FB29067408E6F69F03750203C05314CD74A43
+F3419C7C905886DD5BF5E469F21E823619A874C67A675E0C50A29B4A7E028098
+03AEEE8EA3E629AA586F2FE54F77B9C710325D8CEAEF26C367531F69C141FE6B
+F070D3026E4892EA96BFCC1DF3A70940325A61370A04C8ACC3ABB81B4D0C7592
+2B152F8975FF23B7847B74132B25739DED046DD3828D4E527CE05F3CD96F045F
+648E20301739A98799D6E201BE60D19B0F18FFE6DAEBBC0C6FB8D80CA1A7F7B5
+DB36BBA89CBF7B8F4F22CB6B4EFF27F52C763B284B69F7EF912CE68E3F863DD8
+491740B45FE533814C0E0E4341AF21B1AD019139533EAC12A525345A8560075F
+39A0DE49A182B011CF32815F260DBC8F1ABE76BC70F7EF647042BE8C820AD74D
+44A7F02C2A9A28AF570A2F34B9CE4A0F24EC5DF61C36CCE81E3BE7B6DB74B4CD
+E2B5E2704CA1A9E590DDA16097BA27E19C765E8B137E735FD4DDA6FF9753D1A5
+8BA02CE9D0AC36D0B735C97440A1F5B84598A938EE007E5751F11D2055E589EC
+ABFADFB878BBE2B7D05C169375454202152948C66E7A4D9A752EA288C269E658
+352B9FA5AC99831A50410AE64122CCAEDBC27D7F49DB8CA8498801CAD2EBE903
+35724C1CB2E9CC0C16224F29F8A4C77C17ECCCB0FC0A58F0C74539F2486F8579
+E0FE8DC347204215D70119756214DE1D7ABF2792D9017F1B800BD2690E31B2AE
+2B4D77261AC46E0674FD2DC1045606275902B53F46DD389BE83DE1804372F885
+1A78B7A53447E39B53F6D7DC03784DEC6B0F0B08DA38C01D29AE1BC54F391D5A
+3A81DDD8E2AEF6B5E516C8EEAC8D3524976BCCA626CF90637D8B8B084E486C5C
+1
+ecdsa_sign_batch 480
+3
+2CA2299E107BAF647635D97A5F91B130290657C0F330A4D9EAEE2C272B684192
+DF4582C384D41134FC6B8EB2F587198C65EF1255A6FD562F2A91E675EA1CA1FC
+86A6A59AE2EFB750FA889EBE993A5AC792E949A2EF7AFA34B6C5AEC5A2E60E35
+0
+15C7EE154318087258AFD83D64D37B9332F958D14721997ADD5CC8B06ECBE9AF
+AD995ED2C28038B831A78DAE33ADADB8DFDE0E5FDAA385DCE07F4B1E227E6346
+1DFA538C56C348299ACB503D378EAE94EF1AB253087148A025F97000F1531177
+0
+ecdsa_recover_public_key 481
+C470A4B86AC076489F88C731CECD1508BA0302A5F21DD238C80E41F3863A29E9
+C2BE63EF6B9678525BF158788E9498292148CF39BB71D13C49D0D81720ADE64E
+76DE357230E614CE907FA67EF3737DDB45A800DC5EF19B4A91AEE1691743AE6C
+1
+3CBE27BA08B55AFF67489E9A27621A92CA9D0ED4872434F0D1F7FEFD0DBB191D
+55FF37D17B6F6A1F5D89B3D2A6029192AF82820D8C2A2B7C7DE9EA9594F8CD0A
+0
+1
+ecdsa_recover_public_key 482
+7DE64A1A4B119E2F4E46C249D6C2649D7FA389FE83141E1054DDCA19491F56CE
+8CFF4A42FCA3EE4E89C006F82B675A32A3A7E1D267EA5C2BFC64CDBF15DF9CC2
+9F926BB924FA5A8117AD6023F4C84337750BA7F077F2A08F3CC5958D78FBE562
+0
+218F14CFEEFAD639542D9E5200BC8BEA3D8D611D87F6F37463C44D370C4F2F63
+636829F4ABAF3C706D510DFF2F1F754762CFF9F6AF2540D86B35D39BFDD38872
+0
+1
+ecdsa_recover_public_key 483
+8EB3E701C33BB2847481183DABB9991529B9073051A4D3742DDAB0E1ECE3ADBB
+1D0C9400ABB696E5E4112AD762EF688668B0B3766342DE3ADAD428218C1F4559
+6E72546DC1ABBA2CBD9775A160B1CF2BD51604081DC617F2BEB1BD62D4DA91BC
+0
+8F68F7B0AF696532CED8A4CE05E7B06860F7B85938E470DFFC5D369F72143E75
+BF4A6F1A200BAFE5C7DF06E47CFC7C3F5D7283D9CFB87A63DC0403434096C4D8
+0
+1
+ecdsa_recover_public_key 484
+D66EA6F25F56FF7FB77E1D270497FBD7E6973C0B56209B19A83A5650BA94231F
+FC13D02BB77CD7D55ECBBB66783EB481347A95135AA8C01C025F7AE14A378DC9
+367E9EBC10B98C967E0FA0D651027D779AABE31C580571C2AB11E830A9D660BB
+0
+C4F3A2942B2E5113631768FDD3DE876A67449E003A0842E951FD324BDA5AD6E5
+3EC9CD9043EEED17D380E12D9D596F0247BE8F7350D544CD2BF7B29D6C0483F7
+0
+1
+ecdsa_recover_public_key 485
+812F191EA78F78F48E40EEDDDF245FA5B2CAA68F06ADD30FA90DDCE6C3EFEDB8
+D99B6DA7F2F623DA4ADB006730CEC8149A18C01FC97DD2B8A36020266B6927DE
+9AC457804CA83C52897795CD41FECEBC903F68E656F3C043BF3EBFEAAC7DE50C
+0
+D65A77B1ACCD18A8FAD7E769F424475540496C1E7F918C4C9289C229FB55DCEF
+BD053C7FA23F8BFA09CB84E64CD1536673F4744DC7D0298271AFB4245815E54B
+0
+1
+ecdsa_recover_public_key 486
+23AE6D62203F932B2884AA91AD59A3C11873D76EC6B9C1AEC46E241DF34A373F
+5AC1651169CED5A1EBD5545178786F686399FC6CCFEBBFDF5566AD3B7EBB840C
+A9EE7F0D083CF15E6F01DBFF8AA31F447D894E040B2FEAA5D8A0E002E7048086
+0
+EF16F9BC7C2D60156332DC485FB452B2F1E55AE5E42A9784E2B23A56F1199E14
+BB4C526C809740315989DB4C2FF1E375BA3A2AA1EB5E723534D165107498B82D
+0
+1
+ecdsa_recover_public_key 487
+479348A0CDA35B159226924F39ED6BFB1EDC9D38DA1D44F5DDC7081231D4A6A1
+1BAB9F7B8CE7B37673816E8978F87C477FCA738B6D57CAFFEB9FA9FBFD70AFD4
+F3E8DF0499A33E258D061C85FF10D2334CE2DB0329D73C3D0200DC34CC76771A
+0
+EF4BE85D44C9D7E089CC81A4477F5425E20CCB6B390728EAE8F10C8B0EEE8B13
+FB3481D22429B4ABEAD6A821DEED703B9A4CA0C4A34151E2A9DD960B9EB344B5
+0
+1
+ecdsa_recover_public_key 488
+FFEF870E68F56653E6A903879E0A5CDC5F5A042822C03EFE947D9DD7C6EA1D06
+5604AAF0E592AE1AD1DF1F21F4F0C04F14A7EA8326E3A1B45F826CA3031F27A7
+BC2A4A9B3A6860571B6DAC6444B6BB674FEDE42A89929BBE80E2A48E71C53793
+3
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0
+ecdsa_sign_recoverable 489
+E89873D9D4D9B35469F8E08AB7DAD6EF80A2004215AA3FB881EF0B3D91FA9AA3
+4692E3A0C6BD1B9D484E709F9A6457D2CDD5C6ECFE3B83FAD42280BFAAB1CF92
+FDC6CA42D57E78B74E325BD2D4EE11AB43A1F0645E24EA728419596791CA3CAA
+BEC20D26E13AF196CC64F83FCC6415361FA1AAF5D9C256B7ED4A68378039EA73
+0
+ecdsa_sign_recoverable 490
+4103CAB48AA0E2CECD29D4390B0AB5936D65E3379D947387B218E6FC200718D5
+9ED33C55DCAA9E6D6CF7ECAC9307445F5B1194995E6F37C148B4647CE714F28B
+A83AB7591B8C16ED65FBCECDCEAC156AF9A61FA61FBDD57C53927916BE81A8CE
+C094F64A134EF890BB9E193870B757311F585F2742F4365E130960D588ABB5BB
+0
+ecdsa_sign_recoverable 491
+3CF1B93EBC795E5860CE56B08A02180913B6C200F8EE66F2014F7B18CEE40BF8
+175694ED3AC0A60434E85AEC14F4F0E26C147D675B00EABEB4114E1CCA7895E7
+F963C003180C64428A8C5BDFBD0A4F9F7853EBCB2F62E820DA59AC475D6948DB
+774D0EC08BE539CCC466E8ECEBC736AFBCE4F8439F7AA94AF50D9D1D8D80B823
+0
+ecdh_phase_two_batch 492
+1
+457773B7A4302BCAA4624D40EA974391EAEC816A8524D47478FFF38C32CEA337
+AD5DC976A17DE2819A5B09DD00419C9D8979A8A1E23A085A01EB4BBB00957D26
+88156BBA3C020704CABC08B4EFAFBBA444709B0E6BD7290285A3A8F937A11239
+0
+0A384E4080F518DCCB25522D160F903B749C0E6C630E18DC21D216558F6376F3
+B61C84C455CBF0AD5E7DDAED8368FADB16AEA6625A1C9D15F82993771B450B94
+0
+1
+ecdh_phase_two_batch 493
+7
+C8C2F5E52848D8CC6D17F3CCC314DE32196E585AA596EA7F966A114C48C46531
+A531D0E2CFFCEA586BED83A2A8673EFF741EC89F4137E1530B78FB16CAE90CC6
+765EFC835EE2EFF1BE06074F193D35D2A4FFAD784826BFA463E4AAA613F3ADF5
+0
+D2C05EE9EB1C420FBC32EBE02F0B93E58C60010097DE47ADA4D7670E8E3547DD
+ADBE70D5E2B2F786C6A13E1A3057DCE181521B5F56F674E9973890E0B6B1433C
+0
+39DB24B2730AFAF7CA9FF564C576F5688C6175716F2E013CEF9D93F5E49F3F38
+E0F674FC565922478230A3B798D092A2C4D16094AC2D2EF78F6FBBE1F35E0A97
+0
+3ECB8390C9B5F57E4CDD2D2E4CD3C9C1CAA0C963D540823DC64E9B403FE76E2A
+5F5B4C7ABF209462A3EE20DC005E84183E1B0238D9E9AB6331DD4191ECD5D997
+0
+F052324D2A5D5CBB78FE443A3736659A967790796622BA3D9BFC35FFFB61718F
+34BA50A006E1F2F94F641BD80F41A6D16EEAF87646307B39E268B60A8C231C51
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+CB5B1311AE8148D896568A463BC5AD5E19B86A1E3F79CA34B1F0EDC0598F5F43
+5FF04CC2A2BC884A9CEF01734045777DE7775284765833046CF86519A7EB802C
+0
+1EB37AB9BC627DEF1266EE1AFA71CE70DD3C1ABC54EC9EB2B36260539040027F
+92F33D7D3D57156AF15025A50AEB8BEFB4A6458CB16C29298CD83F37501261E9
+0
+148D94D1FD03358270EBF75FFADF3EB44AAC0A89CDE45CACCEE896B68144717B
+2B6F791A97BF439C27A49BE8852A033D89D8C73E73417C78E1B0D4DBB89F89F4
+0
+330F196F4E01601181B0F30BA06F02E7B8D6229BA26F4F1F60C555016FA7A2E1
+129D2724C51886CF165A3A039CA1D9CC9308B4271E6ACD6931CB7EE544C63403
+0
+FBE65E0F2E0CB5637BB8A96C1D02F5FFF2B32723A1BCBD0F3629BC345C26AF2D
+319606B711ED24CF66F3E65B5B99AA4302D0A0F89165FE96C9E1E9F601DC3895
+0
+D8B2C278CA09F86187277C9E1B8AED2AB4A313FDD0A6F5D5AFD376112392B8D9
+6E62BD05117EF53F651A4EAD5DBC9EEB757C532B5700A6294C8CCC39B3B147F9
+0
+FC5993C2D831EA031BC19DB785E28EC908E5FF2970DF945356824DE6D64FE6EA
+FC9EC1E45C921D402EB09612E12F0FF7772A87851B489FB9D074EF720FC7BA13
+0
+441C5A47DF941CBC962C7465A7340B1BF2CE731D158F37E0F4F5E3F93E593024
+7BA8786351FEEDC8A980D062E1266153EB4B095F8795B15A0B773C2F51D32228
+0
+6
+ecdh_phase_two_batch 494
+20
+DBA5F18698E416B40B629D55F8F0668AD8B723F663147437F7C0673DC711740C
+701D295DC77EFF086E004945C266C25918BDE35ED6C172634293C7AA944429C9
+41A8B9362885AAFE4EE24FF46D458D642A8D41ADE01105BCA674602B47A30181
+0
+54124DC5AE6AA57FEBDB6AF3E8B821C0E335E0D42A188C11E1C796A4FDBE2EF5
+98D918C160BB11FFF578A5E99FFF7FD9A737C09E289F5E24651C0E8325FC9496
+0
+93ECB6DEFEE3183BA6DBBA62BD6C8A6736072E65EAE37129D547C5C4166552B2
+36DB6C2652D0A18FD0E1D35A437E4B7F4190FC3959E8F16BE351E3E1BDE14DC4
+0
+6C4843C3926195A2FB70BE0F472198B3A75F2362324DC471A9716BA75994353D
+BDF2FA9E4F06880696647A75E7C8216D675FB2CBAD76380DFF6D96A875C155AC
+0
+3ACA2242E62D8D39AB071E45D0F79EEA6D85DA20DE696917461E010179BF0D1E
+BCAE06572403F8D3A8B92E47A95EEE36765AFFC8B7856E406EA6196D61139DF3
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+46BD7A38818D41157302448B93D7ECAF9F0073CAA8F026F214832BB053BD15F0
+56FFFE71B6D43900C9782A845B7CFED126A0E8E9F48DEB390D2C0D38D6BB3AF7
+0
+E89B59592EAD377F4628EED5F91A99D40EC381BBB2992533978DD6B83470B613
+95CAA65C84F227321312229A2B2BB7CBE2824149B09D6F55B714818B1C5858DB
+0
+BF7A96B6EEA1A2CB12A42EF1F7131BF69925C61F5B1BE1264BC0103905FDDBB5
+4EA98697220901DBA3659D655422427AD82B274B2FA9830A811D885971AC8FFC
+0
+6F861A7DDCBFD7F8EE19A42772B762100B9644B9FBE20F63F2174559BE4D89AD
+E7286F0B4E3894F612E30C125E0CB382E042E0E6E31901C617355544BFC96F23
+0
+40CCED4A5962546D24FCBF4EE2F667F73ADC512DB2FDC70BFC4A31F9DF13CCC4
+52DFB338A1A1BC99A9604D9362644A89184F46EF0A4C8C26F38112363E4A3ECB
+0
+4347625D0247B8787BBEA0E7E476B38FF7ABA50866E976E134130F4F53E29495
+1A33F70427ECDF9D6947764F581E4EF80BC4A128B3682BA90D5E22339744E929
+0
+77C8689870D00B1A0DDBD02ABDB3091FB25E7FBEC504B165D0DE0778CC58F1FE
+A31C9DC96FC4CC43CCABF43CDC56275C962B29A5B5F8BA8DA1A713E7F502318B
+0
+4E9DF565D7FACBC63A1C98C4320EEE959EAFF864986DABACCB7BD26B68D0A7AE
+3F185B390098110EE001648E2E4DCD471776F8F91E2771FC8EE53371A1D3C92D
+0
+3C8FC277657E98C94B4383F0511BC6359BB9401775EBF937D1007AFBB470A259
+F3C53432CF98AC31D3C92E9C57744546BD3B42066A720644F2B7817BCBE68666
+0
+CD9FEBFDEBBB6219899EFC0C8C994B48D51477698E26EBE7F206C2EF913865F6
+BEE2657C0BB9B0E3DFF8C43134BCA32F3BFB7DE0D3CB5AC0357BF5D007401229
+0
+C229701DD71D5C390192153EDC7E2F1A2430A07F92B63CC2A062DF0F9C4F73C3
+F4B112DFFE1D7FDA639298F9D04DA212795AE4EEAC85A874FBA076CBBCCF70D3
+0
+CCC17A86DCAA6A1056ED6B65674E9D990602E23EA46288E36FC318D42F2488F9
+1067FFB9A5AE4E620B32517203DA78BDA07EEAF97A7F8CA2D90D6BD0B193E67D
+0
+4F57E36BAEBDE24414C6C585177CD371FDC0CBE614A46D71C7400A3B62973863
+0AA23EA81723EBE6393DAB9AA7B51DBBE5C58553F821E2988E7F84E9A159F38C
+0
+E0288E2E9510F66B5567F989DB4AB1C7DF6FEC674AAFD80C64AE28F390661F76
+F1E9ECCC246ED61BDCDBEB4C14EE1E0C5AE7977294DBF7BC09B013F772DF1ABC
+0
+03B8C47A333B5CD7853556030EAE14A07CC2595173DDC04AC7354F8620F5FC38
+E6330478CDBC1BABCB7D07933F613A56872BA6087F9034D15BC117AA578371FD
+0
+2C6A0F743BFB511BF647D8FF74690C17E9218DA26359DB8AAE92A6C060801914
+80584184ABFEAED0966A8CE520BF83DAD3BC6926A4732CBBFB56F8B59FB26514
+0
+FEE29EA215B068F1E39C0944C802DC507E9A4C9073627A082D843B3D522CE371
+1044AE845D7ACA83BCA7D5FE8C0B1580E451CE78C577E85C74889B6827894941
+0
+9A5FB813E9437850E246206A7CCBD0D001FB1A04ACB05CE005473F43B63A0C4A
+C6C90EF2D46E9F2A7D8AF50DEB40BAA021C5805C5E418A130AA4085F4D5F4A08
+0
+487F2A137571B5CEECD75B39122F8F081D4B1ECD5FCB4FC8BC8EDCB4C12482A6
+3A67635EA69E4B8303EEFE61AF35E5D4F3C9D6F6291912FB8BE928A2A328BEFE
+0
+B02D925DDD4AD93C853B8142548634D117CB7AFFB06FC7FD19E233E4CF0603ED
+17197A2E584B2E160055338EA8908C76AE0AAB2FCC96AAA6A623A8D1698F9422
+0
+679F850D542E733C4746CD9C83E7134D64C15F23D3152B9F27B0B5B59546B607
+57B6EAA9B9A6A04E0E40B534FB2B9B53ED393F1627997FA9C8A9A6C3C067CC27
+0
+2AB5392322B8D2B34FCC7B055E2247688BC6490CC11A356B82FF88526E210A80
+0BC183D0190B8EBC4F7DF53B229EB73AC9C03E75BBF49E46746CA2863C3AA310
+0
+CA94ED7CC5EEF0C1BDFECCFD9800ECA12C3CBF13B490DB1736C318A5C23B4C16
+6EB38718FAC55756BFD73B9BD167E066A6EA3F6EBE3325D83AD3B419E74F9674
+0
+C94693EBDCC264D24B2F23195ADE43080486166E65847C395C1AB6E47367929D
+7D8815F694FD6FB5CEA9D1B782E380FD690E33C74FC54CA8407BF3C2A5618DD2
+0
+6D2313E49FAE314302E3388B61EB406BD0E8617A0159BCEC6C8B0B3E60BB089F
+7CBDCD3BD0BFCF8FBF6B38191D474D5654FEDDCC9534A0B88E31222D834FFF2E
+0
+C88A3497EC455DDC873B6C5694191E525AACF8D388897D59B15825A8A4EB011E
+FC8539E0246E65220265FA5D0C1223734F9115E86101BDBD0F7966F20EEA9678
+0
+0344395328D5ED252A27A2EC8EB2531B264CFFB91A0A0F40A51AE5B97D00BD40
+FCBCDF17FBE1DCFF89C1C5DB47F7D7090431B506633B66512C30ED7F9A321980
+0
+0CA898C27528562629100CC720C738B85FFA7535E23B2BC481BF0933E5D4C93C
+336381AC9A9F45E72173E2915DC8D9B99F50FCD6AD85B6500E296BF74F2236D0
+0
+0BD30FF2920DF69552A756B24E2FEE3DE9157C4BA732C19C4F5F0C6464A9949D
+225F1FE6294431EC7C0994D89F8149A47A95A77E0E6C6B4D5948129A926B4287
+0
+1D940EABD2B41A070A8D38E2607EB9BA52AB5E28CFBED8AEBAAA2BCFEFE4FE5A
+ADF58655258F592E182853B0212571FB6BCD0E5BC1AB1ED355172C8C4C2360C4
+0
+36CEFEEDDDBFCC0601E1957F0CD20416576B73CC338458167B1E4F31B8529B26
+3FA9ECD04CB11F35848265DA8058C131BD39C07B1F3B10DD244C676141E6D4DB
+0
+E607725A49AB0B059A8FF12B9A34F4791951B07F76130A70C014AD192ECDC70F
+DA62FD80320A3B84B42C063679EA80A44CCAD09FA512AD17BF5B1BBAC8DB509F
+0
+B1C51FEDD1049B4E291070DF981BC5A072859662D5C04AD71ADE2FA512998AD5
+6E78147757B170826C3E09D802B5D039C439D592B4A09F17AD664DCA9095F97B
+0
+4E56077F66EBFBB459554D072F045C6440B6A43EB542EF1592AF4E06EAE8AE76
+1B40ED859851316912368BE68D5CBD3273C17539F5C9C43350E527022332EC38
+0
+19
+ecdh_phase_two_batch 495
+5
+0000000000000000000000000000000000000000000000000000000000000001
+CC6445B770C88C2C6D2E8A0A808F257A846AC982700D3A72C6D0BCB600EFD154
+202B44E2AFACB0F4460CE52826570172531C31925EC6BA9FD013B0D9C5C83537
+0
+CC6445B770C88C2C6D2E8A0A808F257A846AC982700D3A72C6D0BCB600EFD154
+202B44E2AFACB0F4460CE52826570172531C31925EC6BA9FD013B0D9C5C83537
+0
+8320BF174E226F81A80C462CEB54D1B97B99178669D91039E7E121B230FE1B12
+05BA36F2C876A620F93A8073E112C2438BCA5271730655D7C2A40D1226828BF7
+0
+8320BF174E226F81A80C462CEB54D1B97B99178669D91039E7E121B230FE1B12
+05BA36F2C876A620F93A8073E112C2438BCA5271730655D7C2A40D1226828BF7
+0
+8996C04884F09DBE78A4F3809045200FF4DFC09B3703655FF15C0074E9AC1F75
+8DD833BFB7D2F15995FCF2FCF93C8EB5E1241238A33D8C675EF43BD22A20D922
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+D6F8590EEF9E8DF70AA332DF1B55238477AD6D838968A24B0FDF3B66CBB89659
+6C998BEF9888E19C3D00632E14D9B3F879EDEB7F15CE79CD48313CE113F46D4B
+0
+D6F8590EEF9E8DF70AA332DF1B55238477AD6D838968A24B0FDF3B66CBB89659
+6C998BEF9888E19C3D00632E14D9B3F879EDEB7F15CE79CD48313CE113F46D4B
+0
+77AF18FEC42EB1E3F115984C18987FEB627375EB043F8C6BBB834E53844CC6ED
+8BDF643D667657B349B282ADDE0D94AC8B97F75E7A3671E49F5B3C25D6745358
+0
+77AF18FEC42EB1E3F115984C18987FEB627375EB043F8C6BBB834E53844CC6ED
+8BDF643D667657B349B282ADDE0D94AC8B97F75E7A3671E49F5B3C25D6745358
+0
+4
+ecdh_phase_two_batch 496
+5
+0000000000000000000000000000000000000000000000000000000000000002
+FE92F7730BDFFC9ECA67B14B5B83CB24469D98E687BEB46E0FD3C91080FFE228
+A535F0EFC13B26DC35737A9E7AED957010EF830A91D4FDEF59B5820E6A9B439F
+0
+BDB9FF19032036B7D91E31EA5D34CC640E1C96122C67C2DCC659B4F3075EA8DB
+9082F67E78667F3499E104BAC08541257FDBEBDE17CDC0F7A2F429266FD1445D
+0
+873C3E15A99833861339EF20447662D21C41140159CF3CA362F2E4D91A4652AB
+125E686523B3018470B0D5196DA7DDF4E88F8D43A654BC7FCE6D2012030B5100
+0
+5D749B8412DEBF531FB2AA614C0F6785185226347ECA8EA747D6208635C9B129
+EFF80502A31722090E6E9CC7F897698618386CD843EA129A4D0176A483D61D5C
+0
+9B27A38A6F1B2884631EDAA7A0AA44C82FC98C60F2300EC31E704F891B52CDEF
+9E201A3CE716358B1033C5B425432494FA4597D151E95396602C9113FA3067E0
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+CE0AAE2A688CCC7A1E9182A65C40C50D6525DC6535DD1D2214C9DABCC83CAE60
+69FC807743FE974E3CE18C4C5EBDA3B341B4334CB5776778ED3CB56D3516E09D
+0
+CE8223D7B14E930BF3358BEBC353A5D9CF94FD8CCAFD173B3AF905569DAF0959
+34D0C3E4FD7013C18620ABF349270E7968AC43A66EF071EFEE59ABCE4A9455D9
+0
+6CE86326B12EE6410F325243B3F65C6F045283B9BAB52D8E56F2415B48053382
+4318D66B0F698FF31A7694562D820DC2759AA494ACF82FDE069D7D0DECD87545
+0
+D677AB66E9023FE53D06ED464965DA56C6002856D83E0D360A90BDF0F161F428
+0D17E0591729FBBC2E63E0A09532B3E9362A4A4B7124F3FA9887BB2BCD82E473
+0
+4
+ecdh_phase_two_batch 497
+3
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550
+1DE2313DB72548F7D0297610A13CC7B0093C7F146856C0994F6B358E427E044F
+D94C82E921A9F6288BF53650EB2487C6B90F0E8D0EBA9A781C1EA54DE0839F6C
+0
+1DE2313DB72548F7D0297610A13CC7B0093C7F146856C0994F6B358E427E044F
+26B37D15DE5609D8740AC9AF14DB783946F0F173F1456587E3E15AB21F7C6093
+0
+F494309A382C563D6B3E58F960D527DEF408288B02E747DFE424FEF4F583E75F
+FAE70B79F949AA4AEFCE9BF450711971FAFB8534F47D64E5BD9017A52A6B419C
+0
+F494309A382C563D6B3E58F960D527DEF408288B02E747DFE424FEF4F583E75F
+0518F48506B655B61031640BAF8EE68E05047ACC0B829B1A426FE85AD594BE63
+0
+CBD1314D20972E04E0E6BE2572312E73707099B40273471B71095A68FD4E0201
+CB10C1A1470E297B7705D57A0682AEC82F024CA1059AA9512B9895A797F83810
+0
+CBD1314D20972E04E0E6BE2572312E73707099B40273471B71095A68FD4E0201
+34EF3E5DB8F1D68588FA2A85F97D5137D0FDB35FFA6556AED4676A586807C7EF
+0
+3
+ecdh_phase_two_batch 498
+33
+693B9C9B06761240FBB5DF8DC46AABAFAE370D6176B801C1B72A1D75BF2D4C89
+E42F8C3E89EF3C2CFACEA214F15B579D7E37CDCB4C700269AB6EDC9B325AEE27
+73708FF39613C4AA4C67C02F2DB6397CF35217CC616F5A2368A072D4ECFFF9C6
+0
+F5256817CF2D1983AEC49A3600F7239500F2957CF7DEC13A9ECA395DD38A1334
+BC42FF32125D1B6154719214CB5E6B328F258E1104AF00F214CDD2CF6AB85600
+0
+4364AB3577C21BCD0088B57B94F75FE17139D9C4B3D8120348CB4ECF2757BC60
+85E12E0E4A816D8E4078FA0448247B34EBDE900594255AF4C8ABD593DD827497
+0
+7C78F8F0544DC6C02A54F0F05F2315D1DCF996C73BCEBFF0AD3929FB9EFC5916
+82C0C04AEECB769A74B366AE6097B169E8E3F2B8D66699391C7B726D3C117287
+0
+8EC36913B3F722B215BBFE0642D681C72FFDC01164DB15FB485DE4E5E90884DE
+CFDD2D129EF9B2FC3A53458B187CB47C0C35C65D1839136C3AF03C802AC8048C
+0
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+F92F226530CD5223CF0B28707AB15F2C7DE58B9CB1A4CD6CBB304093F36E9577
+4568863A4B87C670893DE1FD868CBEC264A0B9513FF266AA6CEB9EBAF93E1130
+0
+C073C13E043B8B7DE959D80E4D0041BC9C7865BF181B7EAF2D1D1D648065DE37
+4E90B90C583FFDDF8FAB7DAB0F4B5FD64703041E9A9717538AD8CFA8D49E8763
+0
+18906CE615B2BAF82708344ECF493A8E50D689481E4CA45ACC97121D6EF4A2BD
+0688D352B0D8915A3FA9071ED571E36B61148D0C51FB2D8AB1A7D0EF890D3843
+0
+D901111F47C9B3279ECF3D6968CAA69A3EF2DC89D2F451D2E5DDA8527D8F4779
+4D2588C68D1C8FDD055D15EE68F1BED24306B31609BB1EE9FA574DF1EAACA78B
+0
+8651A8EAEC6B38A2E8D98058329B40FA498555E128071D9990D59285E934B72A
+64FEB494914ECED0011EC4E16EA3D53AF76DB6B6F49401C9F4952E273E7B5F34
+0
+6AC04B7B9F5522C1D973D2F0D06DAEB2FC4E8366C15E639E8715A4F19447E789
+830CA6E116BC892E446584FD4AF474C3777AB0359DEE3842B173F2DA66B7DD5C
+0
+C98D07375523CA8CED2D9522CC90BFD390CD57599DF259C29BF3A8B878FF42C1
+FDE77D183660CE91D84AD2A5D1BE613AFC33704EBE234B03DBB8AD2D8A83DB6F
+0
+B554108A69BB695D5CEE0A6340E9B9B7177E935040624CFCE5D3427031F8637D
+3CA6BB2BAE1B5C661471CB48BDF1A33E787D8504C0387544E458BD6B7408164F
+0
+EC2BE46CB09E72542965F225B770E6DACF3963E298EEE1DF0E74241C24848AC3
+B23B1C78286DC8D7BF58329DF990377CC7670899A1A6CEC9865C9FAEBCD93653
+0
+2E62777D3991767C3CE112EBE3EB0E484C8717E07E52896C15FA01184AA4FEE1
+C5A61ECDEED811F75D307DC2EC7BB1C01F2B154A6441E3D89E85D9AECCE1F9BD
+0
+95B78F7B5EA9C2C1B80439D0B1539DEBDDD1406FF91F943A814D709B4E70FA8B
+6C7112405E29859C25DA21DB649DF350E30D8B89794011D59787C02663B00EA0
+0
+6A9B5DA7169692A1D101624392BEDD1C020DF8B12A8A1BD4323331142B4FB34B
+A17734758C2421438B80ED34628C9055CE3ECB638DDB05B6968C240ACD24645C
+0
+D2A9C14CC1BC5EE0B1E1D8D27059AD0F7FFEE96D1F6097835201B2A13CE1B887
+7F259B002F0A254F9A8F6B399FD7A8D22E92A8899A31BF49367FE15B6E99F327
+0
+8AC392758F79274147276CC08FF6DCFE7AF50EC0B03FD1035B92C99EEED4397C
+96CCDD17C0BB44F14B89363BC35117075D0CA5DF64BEACDA2FECE3F5D823904B
+0
+8C8224D47E17C6566D2B362A9BBD0DCCDB094B030A56EDA06E2F5E2D8B231134
+52292E5A7044CC52B89962CCB960B822D697C502CE1C11259A1839DF6EAB9854
+0
+5D6D1DB42C2B0B1C437E64FA26AAAD1C7A58EF0365AAA019A7D8D5311A063D67
+83721E7758A66FB2BD49E17862F958156726D6F7179435F1503D6939A26B8E64
+0
+9A23079FD6E1ABF95DB9C11FEF34632354F129F3BB02AE5E70108814AE1BAFC5
+005DF08AF30A095AC2D2FB599A053C540587AF3700090FC51CAFB73CF3EDD367
+0
+6A0CC5AF5C816E2FFDD9DB7D78B9C4BB6D62A41188F3DD0D4E9AAD69B96E4F84
+DC837AB7048758DA67BB38888C6EE98038684FEEB77E1BC0C85A1D31BDECD063
+0
+1AF2421A270DAE8BF9819490C043A5ABF6D1A71B721345DB5CB00CA42F455304
+89252398EF228C7A1EA4BBDF65A6A55A59A49D84FE54512A56232D7B3E4AB85C
+0
+C1A598E82AB09332F44A31615E8AB3F8C362592958F40A04E5A4DEF812BA2098
+DFB61E4284BB7821B7AE2C86EACBFAE193DD9BF3A5DA9942EA6F93DCB919BC81
+0
+58283BE87DFB367237FAAC033742274EAB28366A23937B1FA5C37F83613E30D6
+43773B9E5F481380C471C3F39D8F580F3BE08E98EBF5842FDA5ADC1FCA5E4E2D
+0
+5EEA6E69B87EB17A5A65CCBC37F3CFC0FA2FAA681F4AB230C55CF7DC13ADEEC4
+3A59CD1CDAAFAB70AA00E3E37F8CABAA45970D9EDAEAB65C083043B3962F7F8A
+0
+E4F0665C795072A9249E37E6118DE1BAF696CD36F04D3C85E621B00ACC351E7C
+6876A47D278A055A582BD0D63C4748F1ACCEF48E06D2E47B04E43F00C840E566
+0
+95BD90EB098F12C6338E6ACFD8BAFBB3EACB8BC27919B9E6A678AA77D37382FF
+288F6A9E8863394FB4B5BE06598AD81FE82C1A994D0F23DA49F1B4EB46DB0C81
+0
+53A4BD897E95E7CA9690C68C23C2D4E63D964BE15C0CEBDAF6656D5753510A63
+5BCB912A71B345514B5E1319ED0CE183961988568F649D3CC8CDCFF5A7DC05BB
+0
+3FFF02EC4443FC3B5BEC2C8FA413166608B2F0F2F9DD23B2E4ED0D2A88DF9840
+706AA3C566126B14F3C07A774529C176EB5189B2851465EB3B923EFF260AD5E7
+0
+648C2B994C82430D1F0ED25EB9D1888DB0262CA1B3D53305B59A6D3AC5E50AF6
+6D59CB6C1C5FDBBF84FFA190B04F2BD9D873A687196D9514D871F41C26595EA2
+0
+99B7B14B0EC6FEC94A494B750399075D9EC26702573E30C7150DC6F347E7871F
+5813C470C594CD181C8CAC4BF175DD7A692226556D51635F548B01EEBD04B2AD
+0
+43B1CD346BD30871C30C4BE7843DE7D0F86403B3249E95B16AA30CEB8B56B4C2
+3F71887878FBA5E465C3D192FDFC8F9358F737586D306615720B5719F8E47656
+0
+C3EC4454F5CE1E01CA506E14614A09F906E1142564737043053BB38D84DF54F8
+4491F61FA040341E69E3679A6B380EFBAC915C2937B3723C6FE64ABCA7E9AE0A
+0
+787E87B1F90383EC9EF58D739719437F848116E82565E1C092280C84D6A66D2D
+F7B1120E92B15F3BF25065203B69D7020BB4152B062A30E941A10E3B097FB871
+0
+2466D28E30FA6C70EE1BE99AB3D53E0211869C5DD99458DDF79F6BAA727E0667
+1A921A674461A18B19130291B07EFD733FFE394B44DA46E1B7E231BE31F26938
+0
+98B5F48C073245E04909CDD067F59A2929DD525235DC16B04A8A177C433B3E1D
+9AD12C320185145624DF0CE88F031E694FE4DE5B5E18900EF8ABC9E0E66174E3
+0
+DB1E1F3B8DA14B10D2892F6BFE28912252BC08A292A3D45962165AD5E2834DE5
+529A81502467D5325189B4B8D151F454CC536637B774F2BC317DC800EE192572
+0
+5AE1B48B8304C2B2FC350A6D82D2D89D3CDF511B8A2CB0CC8217174A65CE1BC6
+25BF134C17FC1A41225D0D1ACEFF35E104691AD6AA841936885CF9EB92E59A90
+0
+4AF83B43267E75FFA4ABAB330EAFB7114D8BDD94A2C63F8B6E87535295A1A8CF
+E34149E9A47BB1F9DCC5FFAB2CD91C08BFA83991CB4583AC688516A36E45C200
+0
+96E0D9D2B7E259CB4843DE1186B3BFB1C54E5CF53D14B77C2890E48F7DCC16CF
+87F2A53E971E32D1F4588B78890D7811454F91D9A66C9866975F44D29F06A22A
+0
+3094BFF246185D77B7C5949920DF905312CD748E9D9E57162A633110C5D845B9
+20EC9CC75FA7BA495733A78151FAF0970441FE6DBBD4E0841E44763BDF563D9B
+0
+B3D1A2605B21996C7EF2292BDE7DA547308AA04F9A7D1EAE7886700255862105
+DC8F74D4F577338745A057988A0597E5B228879C2C87067AA73F0552A789AF7C
+0
+E2B27DC20D47EF835E2000F906430469B49FFD5746E8A3F2BB375D4230892E3D
+ACA2017C4DEDCE99A15B7373C37F2D27A073C671EAA0FDFB48591D9E65FF7F1C
+0
+B3CA4AD539AEE57047240EC3B3AD837F626768C1F36B38C669D2FEF0456B0DA1
+D07861826105A3C7947289A26BBA21B012F57C41248D9EFBC7627AD8E9C37A42
+0
+64541443AE80EA259D9EF7EBF12E68C72436663C6740BFF24860578BE45E9368
+94A7B1A989E30687ADEADE501F4E7B3B4E14239C760417C59ECFCB906607BFE6
+0
+A72E2464B3FCE15CB24AB15C26EFCE0320693B570C9B7D9579D3783C0BEE6181
+A75F7ED577927850D03649C84810ABCD5481D8CB3E9CE489C0E1C30390BAD591
+0
+E0425D3057EECFECBEB26297098768D83C43693FAFB5F98283ED3453E4673A52
+34A1EF3A197FEDF06D47C7213CAC784CF872EFE2A4967E6C8EF7A21A52C17E3F
+0
+3E55FC9AD81C3A6A03C6E95C653017346A2C238E8DA22AF61B6713C5FEF48E17
+D62442E197BA257E5ED55CCDCBCC57F8999C8F97A289C62C8D581D8D875D88FF
+0
+DF0DF26F804718E32276BC3C4809B18F25E3088159E26E458E319BA05CE56A09
+C6E82BD4767A27391362A4FDB1218293730342C39136F3E9D47CE91298ABE724
+0
+BA8B3782AF49EE5F15C9C263067533D7E4A5C73828A7208967A5AD1BC81E8719
+388DFB5CA04F41AAD9BA74A5AD887E527F97FEE80F75CE57908444284984DBEF
+0
+529B8D3705965E4C83365C625133EC63177F49B684414182DAE82A6BEF0E47DF
+7CC2ECB195513E94BDCBD89812FDDA36CB080359D700F3DC4448D17EBAE934CB
+0
+FE47DFFD4E0F424FB298DAE5064108ED6DAC46E6AFB6B8179105C78D6275E42E
+6948EB774C7B40F339DDCBF8EF192C93ED81B87C18BB1BC63A9094CC136835C9
+0
+04CBE42736DA67556A8D1EB777C924EC728AE7C8E8DE2B1314DE10B8DB4FAF63
+8CECA312E7F5050BA07D0784C9ECD72E66760FAA3652F5693CB061CC914F0D4F
+0
+FE82C740E3023A76BCA18A1A5D6CA1A7BF487606E8462749DBA90F75B5903610
+EEDB630C42305C3823A3C0A6E32E8E5E19B5D289DCE5F4CCE96589975B433DE4
+0
+10AAADDED23CA99F5DD50EDC2B127A900F54BF28B566317FA708F4DEE394DFDB
+0DDD9A98A223996F6172EB039B287974914054446C1242D57D9F224218E5A13A
+0
+C5931E4824D741EE014B0F9DFC985C77AFA4906B9F0B1C841700497CBD96D2DA
+C2A0BEAC1B5D5054D782BAD8DE6427F9E45E75DE5C75CFA2404DD35FE97FFF5B
+0
+6094F5898A5A7CB5DCEDA8D15702F627C599EA3E1797E5534FEB56B0F97CB1C8
+48C0A72A75B1638CD639D7848B54C042AF8840BDA0A9B0CC9973F0FBADCD5BCC
+0
+BBCD2EFBC9EC5530F0C1DC346D663BB8947664BAEEE40DEBC085E0A66BF224E5
+23E8FD042A0521ED4084AB269DCE439D407768D3372D489F99C48373E695AAB0
+0
+B0E161DC70E74150BEB96304CAAB5BCBA07510A3958C9552C97F50ECF8A243A9
+0A1BADD09F5962E1EAED46C9A0A07BC2D747AC69C4EB6438052767E03DF3C2BF
+0
+A190CF17B22B4DABAF71D98BEB59D57EC8209AB228688A05F64B0E4A0EB84277
+2BAF3346FAB39C59C4CFE45D3D032C1BCAAE64651CABB7176491D3B46CA2B44F
+0
+602565F494D7F5D071D9C47DAFD5D63D8D87E1657B6C6CC6808BACB11EB34B01
+A7686D9D129A8155369AF7A297194DA2B185E25EF7216F2D20B8CDDA2A12D1A9
+0
+ACC813E952C9AC9BC2E7FFAD3A8AC90D5544C2BE335D9B97376A17411FB39603
+F46C61A3A5D7E7C05323CE8A8A62A46E394719BB714E4EB5A69E587B6A988552
+0
+55EA02082AB9DACBC46773DB7EA465928B9F78322487D84F20F9B6A3A570C9F0
+598D48EE796752DAC3FDCAA52BD2065BF91625BAEA342224639C1F2451CC2C0A
+0
+32
+ecdsa_sign_stream_sha256 499
+8874D8B5DDDB81CD712802E4639F22199CECC8ED826BBEA68BA45FE29771E709
+5EC796A10550F8F2D842548A6872ED0AD2089AA543CD0A3A67AA602CA3B6A8D4
+942145268379648E67C9A1FA7FA1BFEE7B8EC582A45882EF8CD4109828C40E1F
+0
+2A
+1
+ecdsa_verify_stream_sha256 500
+5EDDC703CC868B05A9FCEA782B7DCD0331341EBE55E73712691BDC90034C7808
+875B55CAEA91BA5076A3CDB8EC46059B6A52B283B2D9C7A924771BA05E160FFD
+2A
+1
+5EC796A10550F8F2D842548A6872ED0AD2089AA543CD0A3A67AA602CA3B6A8D4
+942145268379648E67C9A1FA7FA1BFEE7B8EC582A45882EF8CD4109828C40E1F
+0
+1
+ecdsa_verify_stream_sha256 501
+5EDDC703CC868B05A9FCEA782B7DCD0331341EBE55E73712691BDC90034C7808
+875B55CAEA91BA5076A3CDB8EC46059B6A52B283B2D9C7A924771BA05E160FFD
+2B
+1
+5EC796A10550F8F2D842548A6872ED0AD2089AA543CD0A3A67AA602CA3B6A8D4
+942145268379648E67C9A1FA7FA1BFEE7B8EC582A45882EF8CD4109828C40E1F
+0
+0
+ecdsa_sign_stream_sha256 502
+CEEE8336F0E2BBB2FE8ADDC57CE4D3E64F7668060891B34D2A60160DA91D514B
+356A3CC78AB0C6AFC06F7467E33DCA33366A3870C93B479CCC6A4ED9F97955CA
+821A6A598E6368CF5FD6E75DDB9B0B8418B308382A5CCD84C5E19757375B643D
+0
+D2A561520A97D2E38BA6981FE38A7299E20912171C8E9DF1B7DE5E2891FA8318F47DA3434A7A5CCBE3B6B4E816542B10F3A4A2F80451F3
+7
+ecdsa_verify_stream_sha256 503
+11FB6F23539FCA7B3B3EA0AAC7CC1742EA70A2C02BC8520D94452AAE86AD87B4
+32204F94DC9CCA6ED9BCE0D7753C2F1F712165F3BB457544720708C089808E53
+D2A561520A97D2E38BA6981FE38A7299E20912171C8E9DF1B7DE5E2891FA8318F47DA3434A7A5CCBE3B6B4E816542B10F3A4A2F80451F3
+7
+356A3CC78AB0C6AFC06F7467E33DCA33366A3870C93B479CCC6A4ED9F97955CA
+821A6A598E6368CF5FD6E75DDB9B0B8418B308382A5CCD84C5E19757375B643D
+0
+1
+ecdsa_verify_stream_sha256 504
+11FB6F23539FCA7B3B3EA0AAC7CC1742EA70A2C02BC8520D94452AAE86AD87B4
+32204F94DC9CCA6ED9BCE0D7753C2F1F712165F3BB457544720708C089808E53
+D3A561520A97D2E38BA6981FE38A7299E20912171C8E9DF1B7DE5E2891FA8318F47DA3434A7A5CCBE3B6B4E816542B10F3A4A2F80451F3
+7
+356A3CC78AB0C6AFC06F7467E33DCA33366A3870C93B479CCC6A4ED9F97955CA
+821A6A598E6368CF5FD6E75DDB9B0B8418B308382A5CCD84C5E19757375B643D
+0
+0
+ecdsa_sign_stream_sha256 505
+3D611AC71BAEAF76CFD7F43306FD7664904F10430068BE3DB04934818FFEFE59
+5BE22BB68D867B633F1026502BE8AAE3CA8FC50A6CD5D2E5D92963985913E92F
+5EFF6D41DC14F7D30D5F58DC0E5DC8BBA34C5059C37E978E16A4CD8773D54C04
+0
+0AF47E5A363691AA2B0488B14C67A0EB5EAA1104C03A113D1B05B06C38A9F0661A117AF4094A45FA17DD1C2D092C0A04C6681DA2C46F83D8CC6C9BB43BD91494
+64
+ecdsa_verify_stream_sha256 506
+464EE3EA4D784276153567BCA35A0075B7A0927455AD143A1A717849CB648553
+B99AC6BC73CB83E3360A071A9480936F0031309D1F704A6533E467BA6B2BC7F6
+0AF47E5A363691AA2B0488B14C67A0EB5EAA1104C03A113D1B05B06C38A9F0661A117AF4094A45FA17DD1C2D092C0A04C6681DA2C46F83D8CC6C9BB43BD91494
+64
+5BE22BB68D867B633F1026502BE8AAE3CA8FC50A6CD5D2E5D92963985913E92F
+5EFF6D41DC14F7D30D5F58DC0E5DC8BBA34C5059C37E978E16A4CD8773D54C04
+0
+1
+ecdsa_verify_stream_sha256 507
+464EE3EA4D784276153567BCA35A0075B7A0927455AD143A1A717849CB648553
+B99AC6BC73CB83E3360A071A9480936F0031309D1F704A6533E467BA6B2BC7F6
+0BF47E5A363691AA2B0488B14C67A0EB5EAA1104C03A113D1B05B06C38A9F0661A117AF4094A45FA17DD1C2D092C0A04C6681DA2C46F83D8CC6C9BB43BD91494
+64
+5BE22BB68D867B633F1026502BE8AAE3CA8FC50A6CD5D2E5D92963985913E92F
+5EFF6D41DC14F7D30D5F58DC0E5DC8BBA34C5059C37E978E16A4CD8773D54C04
+0
+0
+ecdsa_sign_stream_sha256 508
+1AEB8B046871096D0B7A528B338286DC4B1E3CBA28578AAA05D77AADAAB27E57
+DB2791730C8358D7A207A0BF1FC68666F379A481F757681EBB436BD8FF5AA76B
+5A80102F25C951ECEA56548BCC94E6FC10FCC4FABAD6E5F69835CF14B28E1255
+0
+AB150C8BD584EB93A647978E35DE732993F8EFB63DE82D03E47A6E2163085D1A75DD9C4BE1C537D1DD7D45A5BD076E32B2E130BB3089B623C563FF95D1C774F4DE
+64
+ecdsa_verify_stream_sha256 509
+9CB1C12EF26701075E48CA6236EF38D02EA27D4A11CADCDBC82A063ABCA8B7DD
+73570C74D6D077D4306CF7EB2B221003DB43565C4A3AA06DB906C40589D130F6
+AB150C8BD584EB93A647978E35DE732993F8EFB63DE82D03E47A6E2163085D1A75DD9C4BE1C537D1DD7D45A5BD076E32B2E130BB3089B623C563FF95D1C774F4DE
+64
+DB2791730C8358D7A207A0BF1FC68666F379A481F757681EBB436BD8FF5AA76B
+5A80102F25C951ECEA56548BCC94E6FC10FCC4FABAD6E5F69835CF14B28E1255
+0
+1
+ecdsa_verify_stream_sha256 510
+9CB1C12EF26701075E48CA6236EF38D02EA27D4A11CADCDBC82A063ABCA8B7DD
+73570C74D6D077D4306CF7EB2B221003DB43565C4A3AA06DB906C40589D130F6
+AA150C8BD584EB93A647978E35DE732993F8EFB63DE82D03E47A6E2163085D1A75DD9C4BE1C537D1DD7D45A5BD076E32B2E130BB3089B623C563FF95D1C774F4DE
+64
+DB2791730C8358D7A207A0BF1FC68666F379A481F757681EBB436BD8FF5AA76B
+5A80102F25C951ECEA56548BCC94E6FC10FCC4FABAD6E5F69835CF14B28E1255
+0
+0
+ecdsa_sign_stream_sha256 511
+C2BA16E401C3025A618A62E854E18431E6787C16C70A5FFCEDEFB4B2E73E5251
+A23330BF9295294162FC116CE3A48C9BEF033D75955A6D5BA26F1D1B3C1FFA2B
+C31BAC3F3A779EFA1BF573E9CE3B463866EF77AC5767CE0876797698D1BA088B
+0
+2B306564E632B1DED80FD47A947175E196416D4C802290358ACA14FA8933EF9AA5745BBFFAA539D0BC4C9B7DAA276464AB844240FB384FCFF59A81DB1C805CB3A1E867A3A56DE3811064873156BE68F67C12BE1691D8AA6F9DEF792FC4AB6A38C7258D01CAEFE14922B42926B4A20B69D090998013397B
+13
+ecdsa_verify_stream_sha256 512
+8A0DCEA642C24CAF693D3FAFCC7C1B26821C9A2AA6FAF8379FA63279015529B4
+B7E9ECD677EDE5EEB4ADE07D5CB6B9967C3400D601D2458DF32E0C9F6DC2305B
+2B306564E632B1DED80FD47A947175E196416D4C802290358ACA14FA8933EF9AA5745BBFFAA539D0BC4C9B7DAA276464AB844240FB384FCFF59A81DB1C805CB3A1E867A3A56DE3811064873156BE68F67C12BE1691D8AA6F9DEF792FC4AB6A38C7258D01CAEFE14922B42926B4A20B69D090998013397B
+13
+A23330BF9295294162FC116CE3A48C9BEF033D75955A6D5BA26F1D1B3C1FFA2B
+C31BAC3F3A779EFA1BF573E9CE3B463866EF77AC5767CE0876797698D1BA088B
+0
+1
+ecdsa_verify_stream_sha256 513
+8A0DCEA642C24CAF693D3FAFCC7C1B26821C9A2AA6FAF8379FA63279015529B4
+B7E9ECD677EDE5EEB4ADE07D5CB6B9967C3400D601D2458DF32E0C9F6DC2305B
+2A306564E632B1DED80FD47A947175E196416D4C802290358ACA14FA8933EF9AA5745BBFFAA539D0BC4C9B7DAA276464AB844240FB384FCFF59A81DB1C805CB3A1E867A3A56DE3811064873156BE68F67C12BE1691D8AA6F9DEF792FC4AB6A38C7258D01CAEFE14922B42926B4A20B69D090998013397B
+13
+A23330BF9295294162FC116CE3A48C9BEF033D75955A6D5BA26F1D1B3C1FFA2B
+C31BAC3F3A779EFA1BF573E9CE3B463866EF77AC5767CE0876797698D1BA088B
+0
+0
+ecdsa_sign_stream_sha256 514
+CB461AA21F79859B2070330E4848C3553FFFA0CE02804A7A265D655C0BD96194
+B99E0178FF25A38132894D8630B3C837BEFB9533E9AFEE4A015DE6BF460709A7
+99E436F1F68DAA0001EA2C7B5D42FC3FC1CD337A302BEE5A12963E1FABB86085
+0
+0D0FFBE80333AFF240A8D682F56D0D80644505748C8F77746117197EC36F5906493B5C9FB0236B6C254EA4624928031C6DDEA5556C4D82E47B1E65754016C9812B55F9EE7022825CB581B8BFB44A59EAA0CD4A041F79EFD3004384D52E8D58EC550F0C24113619B5E216104DB725493ACC81F418F971BCE0F9E4CF9766D56E75264F61F329026713A8ADC0B907CA93D5796E6E73C6B921A2A3B28437BA5BDD50EEDF3721C98632E6C29D432C12FB29AD192553FD41F73288D0F28DA39A1CE77CB79B3E7C808B622B
+1
+ecdsa_verify_stream_sha256 515
+3DB0BDDD9509BBBF4385E3E078ECF5D525F3F46FDC6EC5219037AB1647F803B1
+3E2857CD58AE7E0ABE8B1CC3869C5302897F54E107FF7193F6167CD8D1172704
+0D0FFBE80333AFF240A8D682F56D0D80644505748C8F77746117197EC36F5906493B5C9FB0236B6C254EA4624928031C6DDEA5556C4D82E47B1E65754016C9812B55F9EE7022825CB581B8BFB44A59EAA0CD4A041F79EFD3004384D52E8D58EC550F0C24113619B5E216104DB725493ACC81F418F971BCE0F9E4CF9766D56E75264F61F329026713A8ADC0B907CA93D5796E6E73C6B921A2A3B28437BA5BDD50EEDF3721C98632E6C29D432C12FB29AD192553FD41F73288D0F28DA39A1CE77CB79B3E7C808B622B
+1
+B99E0178FF25A38132894D8630B3C837BEFB9533E9AFEE4A015DE6BF460709A7
+99E436F1F68DAA0001EA2C7B5D42FC3FC1CD337A302BEE5A12963E1FABB86085
+0
+1
+ecdsa_verify_stream_sha256 516
+3DB0BDDD9509BBBF4385E3E078ECF5D525F3F46FDC6EC5219037AB1647F803B1
+3E2857CD58AE7E0ABE8B1CC3869C5302897F54E107FF7193F6167CD8D1172704
+0C0FFBE80333AFF240A8D682F56D0D80644505748C8F77746117197EC36F5906493B5C9FB0236B6C254EA4624928031C6DDEA5556C4D82E47B1E65754016C9812B55F9EE7022825CB581B8BFB44A59EAA0CD4A041F79EFD3004384D52E8D58EC550F0C24113619B5E216104DB725493ACC81F418F971BCE0F9E4CF9766D56E75264F61F329026713A8ADC0B907CA93D5796E6E73C6B921A2A3B28437BA5BDD50EEDF3721C98632E6C29D432C12FB29AD192553FD41F73288D0F28DA39A1CE77CB79B3E7C808B622B
+1
+B99E0178FF25A38132894D8630B3C837BEFB9533E9AFEE4A015DE6BF460709A7
+99E436F1F68DAA0001EA2C7B5D42FC3FC1CD337A302BEE5A12963E1FABB86085
+0
+0
+ecdsa_sign_stream_sha256 517
+F46963286DA22B9134F2A9144FC13D5921924D2AAA88DC1822D6F083C9C54AE9
+501C38C3BA61B0662D6A9A98B9D1A3E7B64D01A30598589479228DA8E8D98F6D
+DC8C9A9020AE99CE14D113121AB7D95391234AD7549810E2A77755E100080514
+0
+E6F76C0C711199B5AA57582C84838BDA37926028E4E883F98B2BC8CBE136693C34DE67A8FB5128B4B3F75A95B4A70D0B90591992915A9F4968DB562A09300F8549A3425A3959BC6B18D7F52B769FB2D4E7B95632115F6012803585E5E5BFDA3E1EADAFB60AEDBC3A18774FD4D4D9D34BC7134C6FCF77FBE2B1C773343BA788E4CA194D26A5B798E481EB85EC7B77BFE9601065E1483CADDE20C695B01939CAD56FC6889B272315D479BAA669F400BE55CA9DB6DF360DB079AC543A44345C03ED77FF599C59777D0EF6D7FB6C0048E0D245AFF71D6B1B94F35F005A5465A4EC2389F3D4CA6DB6A561A7A31524F13CFB07E8008EF7B87452039BA1775D282D1B4D086E59309D895C098D83B52B2E10DAF615888CDFF84D62C6F8EBD4546E9AEE4ADE92EE5D3201B0C6643F86F3DB2836B974CF5811C1A2DD4471B15C633D7BF5CF039702BD63E327425884C3B23B8091CBC0F3A8ED5482AD83AAE91A9632283A4F211BAE6E5F5EA6370420BDA5185629A2D197121066C763E7F60188D4E062ECE95EC9D3D262D522E3BFFD0C4BB609D4
+100
+ecdsa_verify_stream_sha256 518
+BB835D881F159DBCD57E2A2EC785A7FA385073E9D83D0293AF90393A4D62F213
+4AB4725DB9B6F8C9A05B584176321EE93FD5F542C9499ED190A9B85E3155212A
+E6F76C0C711199B5AA57582C84838BDA37926028E4E883F98B2BC8CBE136693C34DE67A8FB5128B4B3F75A95B4A70D0B90591992915A9F4968DB562A09300F8549A3425A3959BC6B18D7F52B769FB2D4E7B95632115F6012803585E5E5BFDA3E1EADAFB60AEDBC3A18774FD4D4D9D34BC7134C6FCF77FBE2B1C773343BA788E4CA194D26A5B798E481EB85EC7B77BFE9601065E1483CADDE20C695B01939CAD56FC6889B272315D479BAA669F400BE55CA9DB6DF360DB079AC543A44345C03ED77FF599C59777D0EF6D7FB6C0048E0D245AFF71D6B1B94F35F005A5465A4EC2389F3D4CA6DB6A561A7A31524F13CFB07E8008EF7B87452039BA1775D282D1B4D086E59309D895C098D83B52B2E10DAF615888CDFF84D62C6F8EBD4546E9AEE4ADE92EE5D3201B0C6643F86F3DB2836B974CF5811C1A2DD4471B15C633D7BF5CF039702BD63E327425884C3B23B8091CBC0F3A8ED5482AD83AAE91A9632283A4F211BAE6E5F5EA6370420BDA5185629A2D197121066C763E7F60188D4E062ECE95EC9D3D262D522E3BFFD0C4BB609D4
+100
+501C38C3BA61B0662D6A9A98B9D1A3E7B64D01A30598589479228DA8E8D98F6D
+DC8C9A9020AE99CE14D113121AB7D95391234AD7549810E2A77755E100080514
+0
+1
+ecdsa_verify_stream_sha256 519
+BB835D881F159DBCD57E2A2EC785A7FA385073E9D83D0293AF90393A4D62F213
+4AB4725DB9B6F8C9A05B584176321EE93FD5F542C9499ED190A9B85E3155212A
+E7F76C0C711199B5AA57582C84838BDA37926028E4E883F98B2BC8CBE136693C34DE67A8FB5128B4B3F75A95B4A70D0B90591992915A9F4968DB562A09300F8549A3425A3959BC6B18D7F52B769FB2D4E7B95632115F6012803585E5E5BFDA3E1EADAFB60AEDBC3A18774FD4D4D9D34BC7134C6FCF77FBE2B1C773343BA788E4CA194D26A5B798E481EB85EC7B77BFE9601065E1483CADDE20C695B01939CAD56FC6889B272315D479BAA669F400BE55CA9DB6DF360DB079AC543A44345C03ED77FF599C59777D0EF6D7FB6C0048E0D245AFF71D6B1B94F35F005A5465A4EC2389F3D4CA6DB6A561A7A31524F13CFB07E8008EF7B87452039BA1775D282D1B4D086E59309D895C098D83B52B2E10DAF615888CDFF84D62C6F8EBD4546E9AEE4ADE92EE5D3201B0C6643F86F3DB2836B974CF5811C1A2DD4471B15C633D7BF5CF039702BD63E327425884C3B23B8091CBC0F3A8ED5482AD83AAE91A9632283A4F211BAE6E5F5EA6370420BDA5185629A2D197121066C763E7F60188D4E062ECE95EC9D3D262D522E3BFFD0C4BB609D4
+100
+501C38C3BA61B0662D6A9A98B9D1A3E7B64D01A30598589479228DA8E8D98F6D
+DC8C9A9020AE99CE14D113121AB7D95391234AD7549810E2A77755E100080514
+0
+0
+ecdsa_sign_stream_sha256 520
+606C5D875CA5EEBC426457FA108E9E230CE11C024A411A6F9A31F8100E3BC961
+31F630FFB0F554C94B13195F73CCC50C0988C00B231C7F6E7FD90E019FE275A4
+21C676541ABED5353A7BB3C26AD763BC0C8A17542CBC549512DACAF6DBD51462
+0
+300E276171E957A10B06636F3C6EDEC81EFEE3EBE37C95517B09C8A8DBFF11139607F5EAE13A6001FE366491A5AD64841240C74F1CE8700C45C8247F250C117F1F6C0B77C70644B901F26955E131D0B4A7B38194C7352ADC3FCA7BF2E6FD62FB21706065D48BEBDB39133BC7FB0DAD694D0D5B174B8880E9FA3A3982468D4104
+400
+ecdsa_verify_stream_sha256 521
+7557847F274450F33018F284EC17D4CB1559C37A315F64DE010F96A9FF1B6572
+4DF996C7F19EBDFDA22554C3B9111150F116A45E2872F01C94E90030EA86D1FB
+300E276171E957A10B06636F3C6EDEC81EFEE3EBE37C95517B09C8A8DBFF11139607F5EAE13A6001FE366491A5AD64841240C74F1CE8700C45C8247F250C117F1F6C0B77C70644B901F26955E131D0B4A7B38194C7352ADC3FCA7BF2E6FD62FB21706065D48BEBDB39133BC7FB0DAD694D0D5B174B8880E9FA3A3982468D4104
+400
+31F630FFB0F554C94B13195F73CCC50C0988C00B231C7F6E7FD90E019FE275A4
+21C676541ABED5353A7BB3C26AD763BC0C8A17542CBC549512DACAF6DBD51462
+0
+1
+ecdsa_verify_stream_sha256 522
+7557847F274450F33018F284EC17D4CB1559C37A315F64DE010F96A9FF1B6572
+4DF996C7F19EBDFDA22554C3B9111150F116A45E2872F01C94E90030EA86D1FB
+310E276171E957A10B06636F3C6EDEC81EFEE3EBE37C95517B09C8A8DBFF11139607F5EAE13A6001FE366491A5AD64841240C74F1CE8700C45C8247F250C117F1F6C0B77C70644B901F26955E131D0B4A7B38194C7352ADC3FCA7BF2E6FD62FB21706065D48BEBDB39133BC7FB0DAD694D0D5B174B8880E9FA3A3982468D4104
+400
+31F630FFB0F554C94B13195F73CCC50C0988C00B231C7F6E7FD90E019FE275A4
+21C676541ABED5353A7BB3C26AD763BC0C8A17542CBC549512DACAF6DBD51462
+0
+0
+ecdsa_is_valid_batch 523
+1
+D103BE0851E01A74734312D583A68F7A3530DA3B5E389FCBF621C22B45728AA1
+EB3AFF8E6FC31B99CC4E71FD8FA50B6295230BF515F0673D87570BF5D954FF79
+E82DAE113C41A5FD3131D755BA435C3835056714545091609AADF8CC4E6A20F1
+3C5BDF7822A9FF3DC209988DDADC9BBC88848E887623370083B09CED45740C61
+244A70A44B76BABFD14FB046BEC38C1EC91B1EE014D44911D833F5F813AC2EE0
+0
+1
+1
+ecdsa_is_valid_batch 524
+5
+7D5AE80B1DA29473CB7DD24C2961DFA114199C50670E80B33C746751B9494754
+2C90A1CB7E8BBAAA21622BAF901E033AF271C45378CE3B960A1763F290CDABCC
+52A152494A0557A40F0A05AA33656DE8238BC838AB8BD781F4D3C83D6EAAE8AF
+D878FB2C8274E400B03A8D277385855ADB6C76B28C565160D773796EB0F5EC61
+8DBA70A8C6E1279BBA42E75871EC55B63B69EC18A3D3B9FCFE93EF1B43295738
+0
+1
+8969B1B133AD68146A1D2B7F17B30843BBCA0E418B79CA21C83D25983FFBA3EA
+A7FA081CC3B49116B4CD8C5BABBB78B6AAB3A88DC0C5BCFC6737B8ECC812ACF6
+85B0536A7BC3D6C93FAD2EF5D8FFE96C0B287FB1B0B65FC257A3E1798E4AE04B
+79C9AA4612512A4801A8383F696B9ED21EDD87971D05A6C865E37E057C34C776
+8BCA15600C8AE8ED44EC93CFD08FC8B95F7AC132CFCC732E48EFCC10624BFAAC
+0
+0
+154A5340B0AE9BDDDB658F6AC1B6415C6B3BE4E0E054E392F29D82A79DAB80FD
+AA5C550077E98102EE54AB28205306924B12DC7EAD91D958957987E84890007E
+C64F6D22AC7464D9CD33FD0203F1F1E4D6EDDCDE91BF28E1F2546CC1175A1025
+EEFA8495A413D3D3DEF5CB5B15433275A592DB976726D3E62F01ACDF4B114802
+E7439CC8E6EA7C469A1FB5E7779284CBBA24ECEC466373C7E2E663058DCE5677
+0
+1
+0000000000000000000000000000000000000000000000000000000000000000
+0DDAC8A26349E56EE159F3DE2755E6D4142BEFFE4AC5359EDF7691B2F3BD9E7A
+B47CEBAF38B5F14342A38048FBBAC09A0172A473D281AC626A4220ED6CBBC9C3
+218BBA08C9E26D8F27561119B10E27FCA707C6E3F05655331004FA643542CC9F
+B342D1BEE5F14723F3D46CCEE0FB88AC1667DD908F9287DEACACBA5F12E451B3
+0
+0
+0EAA3544C94BBC5896AB5B5FBF4FB14611C16AAB80018F3A700469B41633F171
+BAED1BEC19C1F68535E1C5B40B9BF886E7C582DB0FF0FF03D296A669C91C0EBF
+B7FCC73BB6CE4BCDE5D38E6CA746B8262A586840233527D965D49C11A0DA8C5D
+0ED03334B985B2D6F6BFB4C397F75F1B634B2C74F0FA2F7C0F7A6458899D98DA
+191F0C324A76F78603ECC3F8D3B6AE143F2B0285FDC5E0557E29793804ABAF4F
+0
+1
+3
+ecdsa_is_valid_batch 525
+3
+5BDB60F07023108DC2608C9B950A19D2A3B09E4D252248AE35C57FA505F1DD31
+8FBE826EF8721EE83D974E4C39FE1E0599C0CB4AEB37AF8C5C9B150E58DC9D17
+2677E890B77EE25675831DA9C420A4071D2CC4AB12F4A2E736AC92997258A8CD
+9A9BA541842F625D80EE85B3ADFF94E5EF56B477AF204C62A6E9F108539BB70D
+A4080E030814F2DED866EBC6CE41274905685ECA00B16B6B407F1943362F25A3
+0
+0
+394F0651B304977A34E90F21B51CE5DD75775E57032E6BF7A5025161A9F0D35A
+FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551
+E96612210264EE7E1A399724AEF3A0D07CB49D0D5FE58EA68DC4766EE5E91AF6
+2D444D9F7C56C22982DAE0F9DB3EE2C6712228A27C8C861907154756826A55DB
+BE15E38D472053BA0BF2F8566F807EF4F95DAEB5FC6899907F379547EAB1CEF0
+0
+0
+0000000000000000000000000000000000000000000000000000000000000000
+531ADC033FF4DF6EBF6A9DDF3F29E574460ABC993EBA3B29F6DD5CDF8F64FE53
+FDF78CBCE7C5A0F6D6845AAF3B4F070D3E6B2B1629BE29DFBC3678BF8DC2550A
+88E3C16BE449F74EC6027DB04FE3C1EB35D3A3BDABF909D6134F92E1204B045D
+F1F37EFBCCE6BDE148E0020E7A22BB6A9959AD663607DAF52B0A211889BFBF37
+0
+0
+0
+ecdsa_is_valid_batch 526
+20
+6368E4AE3C69533C8E24A26CA8EBF80218D654BE13D3C4E4AE3B90BAF10464D3
+97015CB08DCEC828C10E6EC6B31256048306582CA724C3D3670FA19813814BF9
+F2DF6007041425431EF7B070B685B3E488DF0B6FD1420CDF6893D7FBE0568D55
+98C763AD9DF4BA3A2EF8421490007C52F0CAB7407A621F5DBA7867E0EAE079E5
+70B2E4F6A04EE7AF785FEA9AD329B7CCE6A2176F3F5D62D8083E7D3C99124B3F
+0
+1
+BF4A9885F283092802B48915A9BB813D63A766C271860F429B067C71C909EA77
+A4D4D668CD938F46BB5C68A055077974A7C35387C8B7FEB81AB97A5DEE2206F8
+76A0791B129894AF2FBAD22FAF5D91228641E09519D6B5CFDBC31786923AB7B2
+051E5BC44DB96A7A67B729D3DC5B158D553C0BB11A4540C0FE2F447397F39B1F
+E440483D38DEDFFCA0B0F83E3CBF021E6F962B25B4736B48C6B9BAD0629DD2B5
+0
+1
+3A35DD3F61124F083FAB5AC74F837FC5689B1BD789258E908DBB84F05AAC33D5
+AD19321F2F1D90B2A1D63C53318F9FF56C1C1845277F992AD755CD72B7F8DEC5
+C75B9C3BE20287C3AB13A7C64A932462709A21D5EF2B92EB309E89162A4A17C8
+B50A0FC564CA1C2F150E965C86C917C73885424330802F2B8A8E5F5B0EAA16EC
+F9FB9DB4FE38A6BE9AF925171628D0CC3F0BC641D3CD8F7672BA045688DAF922
+0
+1
+C17DEBC0805592745C10BAB5E3DDCF956AE32BD15477EC6E2D452FC80D37D76B
+B42D91C075448B2053EB9D9A4B5A1B750CE24A28A8FEBBD72D1241998EDE4AA1
+C536A84A5D41E9A12021FFA3860CEF9901DD8BB21E3B3F8D24189F5AD25558B8
+CFB85E81F0DF785C728F3FF4E48E72F5841944907855BF3142709ECB8BBFB2E7
+F1486C73F2067A27E391BA016FC3DDA21C0A52199C88B1CCD5E6232224EBCBE9
+0
+1
+27503818C07986A280E46CF7B1CEFE35D5E150D000CA246848B020D7DBA2B607
+9FF8CA1D325EA415A15EC5017E8D135DC86B2861F6C40CBE1E9B279139E52494
+283333C1D85B816749FF1D887C5E84738230271EED79732484293E99E07301A4
+54FB8AD09979BF6FDECFB357BAB4F61ADF02012910F75B820E7B751672A86CEC
+0F8B2E63682A0E39B31920134564215E28AC66C279AA19DD7AFFBC95B6DD6AC4
+0
+1
+E25D3F2C0152F43199665215A80464FA306F45FF7EFA104572A0174EB3C65E3A
+189CDF589F0E9B88762E84B2F43A2D82BF43F338A7CC26C850143C8EA8B5587D
+556027D5AD48093970D95294E0E1D12C058055B90433B92329529053757CD861
+35B6D92B5DF9B2E1EEFCF118B09F5A58A968135757342E4A2AF0F4C9FCDFFD38
+2CEF4F5D385FD03FA2CBA77D8B51F056EB91B3BEE20A0F663BFF27B7B3CE6235
+0
+1
+D1B79BD9379A0517681B321990352F999529C57D7F3894979B611910CC1D918F
+834F1263F69C0B0168E1CD24F1B2C63BD443A97115B263E9E4C29432666191D0
+3A55B6B723EA5C78B24BB5E2F69BAE64794B8A12790347BDDF0894F4582F17EA
+E0BAD2C93F3F5FA984BF4663A95652B29789F7353059C6C3D572630FC73364DA
+834FB06D401D8E5CA8C58C25ED893613C54C18F256B6F652E17640E79DF9229F
+0
+1
+51A1FAFAEC6AE428C1A0B408B9F75EB08752114281FFB0AD85FF592101955E58
+DFE9C28207407C7D5902D9092A7B352BEDD304D8452445D5E5E82A81D243F92D
+279D54BC4537A4A3A23D8B358F4405EFE36D8DBE42C7888E739F2E879FAA49DE
+4A2619E9DF42895A60EE89FCBA4D8A303F06B87CEEACE5E647BD51AE0588ED23
+8758D507B88A1125807E706B8F5903A9097CBBCE2DA39ACA50080E0BB34C9A9D
+0
+1
+A433CEB7BDA30AEA9776D6217E451321D6E259EE672298CF9001B65955B855F0
+4BF2E39D5A908CE03267F5A1F2C9A20537495CDD81CA54170D542A029E564E70
+C54A2B3FF2F1107B7678A01AAD47A71E7F3B3DF6288A0FC067846609B9C2F320
+F0621CEC598D62C53237D16E51CD9EE2AE2F96DDDDAAD058D07D81122B0F4334
+0BD19ACFAD660A6551E399C21DEA318944E6289DE1F6387409E56837608B1994
+0
+1
+62A08C47F891E6AA9E4C75D5BB4A01EAD4C2EC0C8272C94D07F38B4A8C4789DC
+23CEDB7EDF0D9120F3AB173773A1FB7115B90A108DA8CF8A33CEDFB3E0598842
+3E715ACEFCB258BE0BBE8C462FAB1A5E0C3D451EB3B3A9F7334EC0085778E587
+5303E86A33BBD1D8CC2D2378925DFAAF27DC43C2FE4B766A57BB57F96E124FD0
+2F207819C5882AC434F7D82B2A353AF19051A1E63B1425598DFB1C4BEBD2F13C
+0
+1
+AA8F815918CF9E31924CA83774BD98C491B08A9ECDB314DB3966CCB777639B00
+B5289A512933CE1D2DAE37408CCA90EC07FF22F777B1C3042F1481CAF46B53C8
+60717B70975A714AF93E11B576D30AD4E74861B3BB87B40730A232E9684A41E2
+9B408CAECE40F85CBC8108E21AC2BB4C1C3294A632EBB9581C1A2C520811A914
+A9FA0D4495F41B8BCEAF4865353C48A5A3EFA0F6D371C0A10EB99D7C7C348327
+0
+1
+49E442886C5125C96FBB21276EC4060AF4FA80A834AF767EC46D3DE23C41C36E
+91AF3A9FAB5C051D3AB1C6933D15A2080FE597B43A572BE93309D1DFB6C8F9CC
+7B80EEF9359CA17C96C8CB27BBF5FFD71DA1EC439AA3DA00E1624BF7902A4156
+425B47551A376F01C730C7DCE32B5BCF4BEDA59A076DB7520E255DA13CEA4516
+052C1C948692FEFA31973BE4AE20B45566C3789F968ADDBA35776C442454C79C
+0
+1
+F644AD9D8402367D8374A920A3735D00A470103BC7B0DE6EF3AAFB38B3037F44
+6083D23E7A6D24D5FA32E594A0347504341615BD37716A6F2D5D16A37F00BD21
+3DD554D51DFD53AF2EEB7C3553A6DE7CC4458FCD74EDD55B3912DB021003BCA9
+45B758B793FC17925FC50A68AEA673DBADC6EBE384BD9BDD2C19DF902ED755FC
+20330AAA43E4F22BB4FCED162E8DEF59B3E82CC255F762ABC84784D51B71EC22
+0
+1
+324298BAE55CF53DD86E0D0369EC2935B89064247FB29700FAFE5FD3EEBB9049
+78093FAE29952A2B20322B29305DA283A9E88C0FAAE9CBDD0DFCA3343BE35FDA
+E04C773C0CA0D4272D9E5455F8C3E3FB9566471EF1108BD845C065814077FFB2
+B4FC48BE7F1D2C54C7AD2EF1F337C60DC8DE8350FCDD7FA33360CE72BA18207A
+2F77E428D72ACD66E273EEAE28410EDCF92C17E2AA14679DBE15A8FD2B99D728
+0
+1
+612CFEB66652DA01895C5AE5767ECFCD9280C746329AEC56D077D198F86FAB35
+1F6D000C97DDB8EDF55C444BB7B867961BE3D54796E06D39AB33ADBF213D310B
+33C992C9EF775DB86AD60DAD26E65FB7F9F4F2D6FE0AD8A99059AE8B532AC4FA
+753BDA99C1EC0A4F4CBE1877F321813C021A37DC909736033951CED4EF0938EA
+765782AD50E6254848E7E3ED3CC089153360702BB7766FD14355542ADD8E1280
+0
+0
+0CF8A860CADABB4C37C8A8EFE1A99AB43F39608A71EED1A4A23078216A9709F5
+07301BD616BDBCED69BC9D406EF8E0B40D0B40004F0B9BCC8A181316E777187C
+F1C759B91B689DAF74C02A7353970A87CAEFE9794D1C1225213190D246E17A81
+54859F76ACA837AB98496EDB77FB252AA3EDB171E4608CEBFB2CAB0148F15636
+49C2A82C92D8ADE89489E57F7DC311FEAE0BDA6CF414E2AD12E7ECA02D76F83E
+0
+1
+A5E27AB3E28FE8D87AEB3BF3CACD18FB3365102DA6B6D32FFB092DA52357FB5A
+EECCB8AC8457859391C9AA45E282D03EDECEB6C697FFE3D656A9ED5C1354087A
+FBCAC71E1F56D4E89F23FF722DD5B70E979913781DB5AFF08F7457B477C54DBD
+B6BC7F691796E6E0D6FE2D8589D14AEF7358FCDC8072F6EDCDBC56AF141A0F02
+99038474E9CDB83003F9AB0AED1EA31C69BDF488FDA39307019DD63946A8DB33
+0
+1
+F18C79CA0F02AC9F49B889C79AB7E4211B2041AD62EA2BD6CF68780CADED9DE6
+F27C8CBBC719D3EF1F0B59BB4023E9D0502B1257BB7A6F010F8E0AAA8C5EBC9E
+525E90ECC498250CB9EA7DC8892CBBA21478052B65120E054E323744FBD8DA02
+84334766EEB6F3FE7CBCCA968D63889D6C2B1BA8B17148C9B8713B4D2FCCDDA7
+3E7B74D7B420F2928A67FFD5A345554654A58C8EE9D17D21B7431D0C23FCEFF4
+0
+0
+392EA5CD34BB40A842BC2661C2DD47AC60373E60FAD6F53E1AFB6E9787CEB204
+6D8A525BCDEAEE970FFB73E9D37AD9938A4F4D5AF8C4F0385E7B0D2CA099B0B1
+A887F9A775E470F59A2F1469F882B36947BAB1F8939B211A127AFC6852B3990C
+15E19F5EB2A5F01EBB07F9DECED98A147B10AAD8FCF45D3C977995D202D18A8A
+A94207843D47FB3E6A560BC63AADEBA06114D3D6738EACA153D3138AEE780818
+0
+1
+F88742CE910352A8929F8A5BB181040E0E582F548FA0CFAA3B7573FDDBE541CD
+8499110AB193A026B8591AA93153D7CC1D2AA557BC95336A09B83AECCA899E8F
+A1752D34C20C554040AF8AB754E091B55E8B1666E1619308EF44409491E2FD3C
+8090C327B644DE8B9481A93FC8F1355F8E022C261D5EB7519F83FEF02C57590E
+52351B4443286715B46B956E416E5AD15A6EAA1ECB522E8A01E8314A672C6785
+0
+0
+17
+ecdsa_is_valid_batch 527
+33
+D78D84D816252A5AA23B690FD991750879D707AE7C2B14C443DE5E7C3DAC1104
+784CD8DBEE8B9ACE71D92C66588C63B72F5B64401FD3FD2341F094DF6517849B
+F78402E999FFE9E00116901AF37BC51DB6ADFE9A570BC5D5FFBA72AB93F389E7
+F122815B21B71CC80D851B1BBE54DD7D58925585B6A5BEE0FE677669B6BDEE70
+095B238C5779F7A86FFADA96D227F883D41A6319A9121C0E82D0342DFBEA88F2
+0
+1
+E7BFC71EB3BF8FC7166912D4F9888425EC1043504008964A89B69049B4408964
+0D09EB7899654C18577FCFCD19DC170BC45D4EA61A402FC9ABEA23E312D9F44F
+B96DDE83954B7BCF2265421962614612B141263AF9074B5A8B78F1EFD6F8FA00
+D1D735D9882D0A38109F4EF98BDD3AA46F4A609BFE008E432A8AB191A5D6B911
+87DB827CA37EA3F2A6E5C607B74485C710B0529FADCE6E2831A696B1F837DC14
+0
+1
+D388D987DEB4FCFF4C2BFB34E6D489CAE8FD102897B86AF76844A04CF214C6C2
+8279EFD28875B3A2143F01B135F6CFFC9E0196D51C9CAC79E57F1B5E379A112C
+984C4E91BE3719C2FC9B5F89D6113DE318BD065BA4E5FE094D510E72C122BC77
+97F50148D3F6D8659C58C99973CC2BFA2F636094BD6FC58A759DB9BCF7142379
+2A10752D00C29D79A632D44BD60118E31F31E591E654088D354266E3D4AD752E
+0
+1
+26F12AB01CBA115323BCD3A40E80DEF7EB73D5FF7C78DED0DCFF80275AE921B0
+08898740008B8CB777EFEE246DC7A4ED9E13721D33114AE80442DB3DB6C7AA30
+6F50CD58FF768818EBE12609FDB7BA347744B9F86988E4BFFA0BD813F84BCEE4
+44AEC47105B1DF8D15D8B26B8020BE730E76063D7195B415A90AE972DA4B50B4
+8DBA52ABE785C62272E9CD97CD8A4E006F08D37BCCEAFF4B18D70D7CC4B0D6EE
+0
+1
+7DC21C00D98F4F58ACBEF7842E3C1376161313E96201301ABFCE96AC11F28FE0
+C5634D50FC529B227D9C40106809CE075B25DA8BB2E5894775D27EC65DA2A6B6
+B9AF6C289A9D12F0C8AF51E5ADB0C3D6C48854B35922E32386F0B603257B60B9
+5F15231436F4468E6E579D8004136E0CF1197421859DBDFF8028DF8FEB5717CE
+BC6C796765FDBDA82EB5566E0F9D25138FAA3073F276537CCA0BFC63D2E86040
+0
+1
+937B708A38CD06C0D9BD19F0FC2FE25D9F21E5E5415BD341358F91CF13E7B24F
+E1FF36C8C8840E8993A2A34A2A89671A5BC15819D0DA01E645D7D3B60FB21B37
+E4FA54DB23A83FAE344884B72546541EB122682093F45AD74CC59FA06CF3AC1D
+6A41B438A639717140A07E28C867C7D1BB7CEB07CC2ADB46990B6722FED3B225
+3530DE15879A95C3BFD00C490D484D93DDBF63AF72BBEE604D28F0A4A26E4FC2
+0
+1
+963EA4C7B47C1BBD375D5AEE1D42D2A208B1D1ADD7E0BEF0E7387221C9A0C0E1
+03FA5FF807C979418E6ED9BCE6734B3E74259B4370016519F2530CDED8E29444
+1924A889044CF1551FBCD893D61A6D8B4E16E0D2491B028EDDC0895A9F070203
+DF1FF2EBBC56B4FFABC94D89593999C7A5E2D2B12131EA90EB6A6B9E0360F956
+F0E3AD4D764AF020A0886C7CCCD4999397F7025709CBD6D793E412A7401E333E
+0
+1
+CC80B8079E07C4251856A677CEF70F77E8457145809476967D0C5C1166D4897E
+6867287EF65CF6C30C3A2A798CDF6F39511576FA5A317A7C75C01158D9E7DFE5
+0DF3D208E360DC44935D9AA97A19A1A5B97A2EC8748AD6BBD1F2D21D42D9E5A3
+A90619F06B1DACDBDD9B298A87655DAEE424BC5CC40007C20749A56757CEE1F5
+C1FE4DC1CC3BBF1F54A9BD3B8C4A91232B034A0485868EE76E778D17F5F53E44
+0
+1
+94BAB85C1B7D37629A56766F1436FB9D0948CE22D00677FD0854DA862ABCA222
+4338A8203FEC85D3AA5095B49858F1BAC208E1FDFC3CDCE83B51CAD445986087
+D4846607D15151676B009A2FE889E2A1C5E4599F39FB089BA0F9F240E53A2586
+3E9615419D89B54E5E565038A5EC13364584DAE89E0F3DEBC0B7E042AC026629
+D6D0469FCF81BB579648D0366E9811A61D4D95E85C9CB3F1F50A190623453203
+0
+1
+C45FFCDA7718B02F22B05EC990C3ECD65EC86BA4733A9B98BD3988156725366D
+FD3AAE6F8F4915FE83CAA6D4F6B628F3E13EF8837349E80E39B534C34EE8ED87
+821B6C76D130475B5804A184B4A1E934BD60A78F43D50908459B325768FEEA2A
+E844BBD54CA8F7907977A22A7226C25B0186C81ACEE90184A74C82185D5E146F
+E41744D1E4608C26FEA45F20934691CB553FC82F681F78853700EA071FE96D34
+0
+1
+B7E1BB28A57E9C06CB8F1139009D71DBEF7F7924DF55E2C575B10F1D6D2655B5
+359EAE7BCB4123A6D4FC4F2AEB2F0C2550A9BC72254B6101C7A93AB0D8BA1229
+66692C34A1A4638515E446C247048799F9D8021A21CD1EC25A311EE42428A0E8
+ADE44874485DABE95AAC82742997E7B242D838BAB9C183143C1F1739AEA99E1E
+8C2ECC695C2141F69BDB256AF79E25F7DAB0EDC2A97799CCB990648946FF612D
+0
+1
+F42C7E6AC3D65F63CC3963C12E08B4047A2155BAF3238187C91AAEDDDA954E05
+4FE20B438317FAA3C65C67D78BC0C3215C52982B22669F1D0713F998B7EB1C72
+FF84FB90ABBCC19DF2C3D17A53F796D9E60F8B9CEE33D0912A110515D4FBF79D
+4FEC3AC593EC66742FEFBC971B28CD8DF4FE97B14A270C35034BF98519A11D0E
+FD91343E252DD3FF5CD2C4FAA7AD00C232B69A59895A668892F0998199B1876C
+0
+1
+0EB1A6BFCC2B6F7A04E26F059AB45DEB4A4909A88BC0443A9A8043337FD0FCC0
+4EBACBBB61D4451BE6750735C1FDC466396E9E72EA40FA03DC70762884E32858
+367F124D7ED6701C6234573B15D075FA7CCF1E83654646B640EDBEC89586146A
+1DD5A81243190F4BB7708C4AA4CAC169349ECB194B94B0A63949528F59CC7D29
+3C419644027D9C4B62A259C06130697850AE7161E7A05F32F969C9C8DAF297BF
+0
+1
+513F9914C5DA426BAC3D8753EB53883198B5FC19658667CAC0A58A5533B4C21F
+DD30C3FDECAB4DECD5D1FC12903B059B646889F054FD705E85C569F67FCF2267
+F05540C783A7B5C50ED59F695561EE78F27FC0EF0485EEAC3755ECFF32180D34
+5E30AE81D4E070A82B7AFA44D3CD9F4D7B698B7A2EC7F1CCD5A36086FA2875A6
+AA91DE7561A10348B9927A8C189C8A03136E747B971B0E4AE02F96E3CDBF091F
+0
+1
+494E1A0BED4ACF648CCC2AC33E0CA33488C43D4294EA65C8D772EEBA1B1D55D4
+3188CF13D14F7FC082D44166BABFD25F2BE1A14DEBA33CCBC6F5787928186C6C
+00DD406BAA710E209A6F3D64A82F056D1ED9CB9EB52550B1589A4C6B5134F6F2
+B6E0C26576783E688BE012802283644D2221441FEF37AA833DB4413BBA549E18
+539B9B7DDF98B6EA6F0957781C2386A4E73DACD572965F866BCF24EA755C0B99
+0
+1
+B90C94AF96CEAF68FEFFBA36B6792EB9AE9D477C4AF81810353CBFD03E492E47
+0BC2FBB577B1B72AB2057D5F935FBF7000DA85F5254C889F1FA0C6B99F69B346
+B47F1110FD67EE1462C4689DF3F9764FB5B6834FF78842DCA0F97793CCCCE417
+68E9B62073751C2A4F2A66B5BF52F3C11986D6C01EA655182BD72B5D2E6A7D55
+B28A15A1822346A2A9A6F37F06960233E2FACB653FCF0A133370E9EEE13144D4
+0
+1
+3EF2D67C45C66F9451C183DBB17F8D0069F7602DF6D0305C6F8BEACFF2AE25EC
+CEC127DAE7E76106F26FABCFD426DA68508D48D6A556872D2B39DA9C2D53AAAA
+AA12C7D90C84B7F32488CB30D8D3A8806C4FEF253C701AC8C72F83168ACFF013
+9CF345F95DE37D61AAB341EF2BB67980D4DAF3B8036D081B31911CA406EB1FAD
+4020DB17F932F2F77A870833A6DD861C87D6FA571E8F539EF0DAC233DF9AD5F0
+0
+1
+530B0132D3C0E134108335E11EBECEBBC60B5585750AC44FEF072FAD31451375
+D6ADF8BE2F9CF9A470D334CBB1F1744536CAB8CD1D1D18049457B90D26E53E45
+8F86A23F652AF371F0FCF396D3D270BF0D2CAC86F282EEF3483F027983EDBE80
+6FEB44DB249209D3CD11C980F2081ED6D9A13283816976EAE15B30027B8892CC
+3F865A0D57497EEBE833D5A230477C044BD7BF0886A3F7A08938996971C3D6B1
+0
+1
+FC0A7FC6B5508A3F3208728A684B67F8348FBE095E1A84BB590E575FF001D958
+F27612A5CFF86A705378D7EDF2719807AE9872121F7B44E3555CABE2CC77BD12
+AE4024EA2CAD92FC38473D21D723E9B850FB7AC1C2DC99AE64BFFD61C1F54824
+0491390F3DB59A16758B8FB17F52EE33EB4F50CD66D4370FF2B7C04DDAD9C922
+0985A1B926B7BADD0FE62A145F6F96151006541AB1B76D401C77BD8C44AE5567
+0
+1
+3BF62C5C8C090FB761FB2973F8837DEACF349C047488C648914E715A1E4804F7
+7E871B1F4443DBEDDA571A7F064C0AEB60CB32A28A756D2C19DD805162450AC9
+856157161B5D3EA835ABE6569C4DA33833B8D70DE236B7C391B24531EBCD543E
+FF811187AD9EB21784C44A5BFF0556E5742178DDE2A532357A79509C45919613
+E18ECA9C69B085FFF41F5982D269F8924863256BF0E3461557EF29E578ECA588
+0
+1
+6C81D798C480602E11D1B91B8F127EF2B6E99A1571371AEAFF6FFBC0875D21C9
+F46F217C26040BBC3139A7F5E6FE783B71F26BF9237C7B459B4CFB7DFCDCD244
+BF672DA1836207FDBB9B2E5B27513C1FDBAADAF0012FD5BEFD86CF672F3710A3
+615ED20CDB2AD19170C01251C81BA94FA7DD3227896AC3689A23999B883E69EF
+308C2783BA40C18B612DFF572F3AF9D02CDA70E42A13E4294A224F1149C74EB5
+0
+1
+37256C85B9EC61A60D388724F6F5FD61AFCB61EE22454EE1E346D4A6BC58DF2B
+7B94B37457C9BC8AAC98F24A46131661939427E71F03F4E946FBAF894B688ED8
+A4C96C2D8CAD7CD088C2A0689EA65E70E6EC07F7A484B1DE3E92B4E3734DE5F8
+2C83E2B58F281EF57BDD054B2084CBD17B14C1D8D20BA2535D7CF99F4AA3D824
+056DEFA3CEDFFC4F7D18489F29A771045C27FC75131E92338D5F63E23D2E293D
+0
+1
+C56F58A63B41C929CF7045D0553F7A9F90FB8CEB7E7743EC6070BEED9605E29C
+786E9ED312463FC01E25EBBFAAC60F1E49571FA7C7147BB348AEBA84C33F2F4E
+D0843E78D683ADC344D96096BA2A6D04AAA580DC3D4C0EDF93F884DD153CD6FB
+09E578D01170FB07BD1C67E232961D98F91D896B471DE09F2A584EEA6899A695
+0C232CC5B6F4660A881E8779DD603D4943CBDD633D5F242551BE8714DF81B725
+0
+1
+8638D9A8E4E137ABB59866C1181A98DDE55FC7C0E0B822673910C3E201358ADF
+FBFE7DC4EFE4BE395B56AA656CF419E08E0D96CA8FFA5C35C1A73A890633D586
+47C3763A92F56D532CB2D6E6E0A6E61F1B44E31640C6EF796D1831E385CB551F
+04D713748383155EF405417DBBD1BC9265BC26F8B3D7D551B830ADD1C9F8697A
+FA45C5F94F5C13527306241D2682BD965EF182D907352B40C92F571BA94E5279
+0
+1
+24CDDA5A3FB71979BD949D8A0C70CC00B565D0095BA1BAA438B17C9A6EEF51F2
+7AAA28B8B763517AEA4EBD7B820760E56AA526CC55586FD29A812FB8B91B3890
+D9DDC6C0D95573D73039B165836A1022A0CAE5DE26E64D118D5829A11D98508D
+2CAFED33F01F8C763C99A447E7ABB273F932A185AC720E60150848DA87FA1278
+87052D391E3C516E519077162CE48186EA7996C03C8052AB1C8439685BD770B0
+0
+1
+527A0218A62C976E931D0460E5A36BBE9C7DC886C711A6C97C91C7AED0ADFEBE
+8F2A90BC7FC0A7A5BE82728BD6887F021A14CE2ABBC9A7B45D66002B4BE2C55D
+A254C1D623CF7E725D631A80F294D05E7F368C978E65DB8E702FDD5164030CF9
+983DFDF147DEBC43B9424DEBCBDA931A323F908FE7A6C8F4FCC1D634D77413A1
+FBF7AA25CA4CFD38E285690FC41F04128931DFDE6A34D353A681665BAD5C3AA9
+0
+1
+33CD99292FBDAA76C547FEC75719DC3F9CBE6F7804ED8A507E7E376ADBA44431
+0CCC2EEBB54CC3D6FBCCAB4E5FB7AB1AA31AB0D67001C2AA4DDAFF0B591BE108
+C43A8A40AD26C99A8469CF34905ABE782CEDBC3AD374BCC17092A02299D3B07A
+E147194BEC4CF7398977A9C1D3F0AC2E9F6A79EECAF335CF2DD26DA2DFD9D7E8
+8AAC5CF632BF101F4BD6BEC2A4FCDA7B6BC5032BA258977F5F5E47489D9C1081
+0
+1
+1202A5FFCC6A591A0D4FD5478429E05148E2EAED25A3C0C2F7E88707DF6005CF
+80A8C4B18D89AA7AB4E4E942B8BC609706EBEC799035FFA8269E6B37CDD5B7E8
+501E4C70EF10A2B1D534F342D892FF2E54B5F46DC07F74749F84EECA2A48A36C
+ECACDE2AE484ADFE0F1B570A5E936BDED103C23E66B8D470575834F5DF4D15D5
+9555F0A47D2C379441FF66764B819E28A4545C13E007FD2D4E2D991D41BFAF50
+0
+1
+7030065A7E29D80B20FE6009865D79408BDAD0C1B6AE2822B7F8133CCD6CE006
+FACF3B492F416A0E41210558B580D4A64CED2AF11E62D7E9A013DC66E07AE0A1
+8730097F0F7849CC2A3439305D8636667614E482A81ACD37E473D518723E0DC6
+35654F0A1FE28706B2B7FCDE11A54E0931A5B457FEC4AD9314DBA24D755D7D8C
+5666B0ABAFF2FCFE00001C99D26ADA611B07DE1EDA60EF7093FF826A36C24C58
+0
+1
+0FDF1D8A052AEE9A55456A88994A5511A8E9558E8FB7B9BAB4A745A5BD4C9736
+F0B5AB9C5C41F36485601283BB342266FBEFC226ED423F7A4B7BB98943F6C189
+1333558A4B567B092B6C8E0BA7083E0A333FECDF1FBF8FFB66DB46915D841562
+6FDEA2DF1BE0F6ADCDFB3B033B045008CC0C4B300F35DD6561FFD76656301963
+9DB43631E9969928786CC807A679782F562441C2EDEDFDD309B48B85F500EF84
+0
+1
+B90D5FACE66FC7A986FA23B02151350129EE19862B5557F1554167F4EA93ACBB
+96240BD29518793DA6F600A38AAAD048878EEA6C69A965B04BA2B2246C2BCF98
+B04F94DDD0F983D90A80B0D36695A4C2F2F19421D5A297CACE25F61EA2FA6EEF
+85CDDA6C6ECEBBC2969029917DFFC85AF04DF57F6BD0119C5DF3D605EBB7B67B
+180E86336EB7913BC0599FE83F1F7B4548F348DECC1BDAB671CFED42C779C2DB
+0
+1
+472C4E6B1E3E4BA31CC284D1C96169AE3F05A15E8ED26C4DA89017DBC12C9558
+7B730CD4E016D0AF0E13B53BACDA51C9A7780640652026E52BDC13FE074C0B63
+91964BF93355CB41793CECF2ECA0FF1DFAB565A6393970F28194F3D1B8A13253
+67FDDE56C29A64FC4B54B546E197F43B3B1AEF53D806A59F4DDF5119779EB4C0
+7299BF6701F88B5028D35B8F3111BA01F258A2696F48933F6A4803C4A799372E
+0
+1
+6840499AA8A66F25FB8D1164D2DA4122D5382665E82703AA8D35E930D7D7842A
+51B74517EE9E0E0DE146F6A05A578808D0A944A81F34EDB7633F6CCFCA92760F
+CC1350AF00FA96F2B4C82B2502F642BABAEDCCB9526003B7AF07F85BD78B1044
+71E1DFC08CCC3BD4AC0EAEC2A19E97BD644B60583899EB22967879A19B2E008F
+181636E66FB015F87183F8BC8856A84E6B3D94D627BFC8AEB358C4A37ACAC2C4
+0
+1
+33
+eckeygen_batch 528
+1
+eckeygen_batch 529
+16
+eckeygen_batch 530
+17
+eckeygen_batch 531
+40
+ecdh_phase_two_with_key 532
+7404F7626BECDCC1DA241D37649010543A44DEFA3819A96F8FF403E539111821
+C9189C8A371A40E2F56C365C1193ADD2371EBD193536E2FD82FBD19454187B7B
+0
+5F8A0EAAA13901CF7482FE69BDEA5CD97FD3EF3762660CAE003172E4639CE6DF
+938D108BE11199FC52E5731FA0A90640EB8D0B636C60D46C7280751A4B59A290
+EB612E9206A6909CBD438277250233C46272DE8762269A270DDEA9FC397726F7
+0
+1
+ecdh_phase_two_with_key 533
+BD9603DC22A3F4525E10982018DC05528107C6C313627324B5EE4C7E226DA07A
+3A6B638B664E4EA333A83E20D72793E6B83D086FBCA43FE855696927EA80C3F0
+0
+2CC1B8AC9E068C11DA1718CA1AB0F84E8CEDCE5CE3DE8F4DF0E2F6376975B2E3
+D4A7C6FE613E5D515F607E9DE45B64BF1E64DFF96B2180F13852AFA1D6F77D35
+6D1AC277FE26FC7FFDEA3FE25870AED439E86BC316D061991B209C69AC977CE3
+0
+1
+ecdh_phase_two_with_key 534
+4A2B156E8169487A9AF2C2CC1A692E381146489989A8411DB72C21FFE901F641
+F44B973833A80C360990717F1C5E37EAE0CD85CB4ECE682858187E25F6A69BF0
+0
+32573743E9D448FBBFB9F6916EBD7A8853D04C3D817177738646C5D1653FB470
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0
+ecdh_phase_two_with_key 535
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+CA7F4E737C4730D640A3956F1AD6FED6A638BFDEA6625209554374637CD4A7F2
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0
+ecdh_phase_two_with_key 536
+FFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF
+4146532E01BB25AD3AA5C65EEB4B6E0EB2A0951AF61BC8717F210DD2E49AEFBF
+0
+41F743B981FF07CD35F5D36EA4E1AD90840B4F1F3967B76799FF4C3714D19236
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0
+ecdsa_sign_with_key 537
+664AE507DF74DD0096CFC0ED01CFE40A795C3FFC9C51C26267848E8A3DC697A5
+B210CA507CFF7E5E2D616987B83A016F497282F70FFCA2038FE96CB7E9CED586
+97813B7E11EF09BE2A894827A3F95B99B70F4951DDE9441A12B570C8641A51CE
+6E082F08277D4EE0FD5790C49E1B4FF53F755867FAFB358608E57672E88EDD15
+0
+1
+ecdsa_sign_with_key 538
+D836470D3D2E1B531B1B924597026B8F283610BD107573FA567D56781B51AB5E
+C9983228CD18F8DE5FC506018DEBE923F5CF3BA5A014DD463C3970EA9BEAED67
+6B1CF7C3939F684E44F9F502CD4FA082EB7E7DB966426602008552270A987AC3
+D5289B8243C6213A39D7359F2BE5B911D581AE015F43CF5C2B45DA7D8179B338
+0
+1
+ecdsa_sign_with_key 539
+1F2DF05E592B01FDDCBD8AD964CF17EF96CFF2FF203E429A17BA7D7B13C5990F
+2A584BB8B80217652B0BDF0883D5ADAB24476B0C147908412EE7FEA1DD8E29C0
+6C32E58D10245A2E938A2E9F375A191D918F847F5C38E9C86401E9898DB1BF01
+77B557CA35579089DD291AA01C6CD4CEED4A09592F25188B9C10115C07E08CAA
+0
+1
+ecdsa_is_valid_with_key 540
+11DCC51E1A3008B374297B753AA1B4713CE6E0F3856A325A1AAB9FBBDF21529D
+33B769907A5D2D3892E5C5F4D743DACE249264C335778DEBA349ECC5D7456D12
+33AAA31D092949EB1A1719E7506C786EA4345D221710CEACC4C51BDC58CF85F0
+E6E99CBAE5CA00E506B20B3B5F5F28F6D528AB4E2C40AA28F6A10D5E9F483C13
+0F7A645F7B2A34AF03073B2E81110B660124FD4E68E5E48619ABDB0A44D16B49
+0
+1
+1
+ecdsa_is_valid_with_key 541
+A58046997766712F0328C316E980B688E2AEC713F6C35869D917A314DF185291
+728F0D0E228CD83E8FD9603DDAE05AD00517657ED8DA8BF88F55F22C045F6746
+E694ABBAAE1840B7C51202ECC0BE3CC492948ADB8BC41EC381979B766DD0CA90
+577497619C05DE740A830FA5499DF213F2B8AE413F25D8981F2C9569D622CD21
+A71FA14555825F6F6208ABB1D29C8DD10F4E2F14AAF8B5A02A01FED5DC9D5250
+0
+1
+1
+ecdsa_is_valid_with_key 542
+AE42DC4460AFD718115B171AC30C28DF03CCD7E16954F2C8956E534448915C3F
+569363912ED51888A2FDD9A0A99E25EBCCF69A4E51195584FFFE8ECC29D5BB95
+C5FA43CC7068729819E275E1E6B7DD876DB3E750F038FE739983DADE0C8FF8D6
+FB0AB9CDA229AC0F382D178C76EEC650B78B104760E00F31480EF6333E1EC345
+0C3EAC6FEA5902FED1E8BF0422F8D077DEE9B02A08F15650C495C212C8E2B0BA
+0
+1
+0
+ecdsa_is_valid_with_key 543
+C4E653DEF1873482E8B9FD945BB20E434F2F619C6772B0B8E18E87C668D01DEA
+E52DBE880F85B0928DD813882463459077218374F0476AFA7C0DE82CA9F77CE2
+7998D3EE849895E8ED014751EA1B2D4BBDCEC5237803875268A56C10AB3BCFFB
+5363E20064C4B4E5DDC1E1813CB8D90A1B87352AC28BBF9BD62D03D877C813C8
+2DF067A98E613F3EF28AC2ABD9CA4114341A1FC26066EA7A47C50B9C1E22E2AA
+0
+0
+0
+ecdsa_is_valid_with_key 544
+0000000000000000000000000000000000000000000000000000000000000000
+3294C02A2D77A61475CABBCBFC305393500066B3756ADA7143C3CBD994D08947
+9AC9225BE79CDFF2D673EDE1BF2005FF0C05B6B31295522A4A00CC5DC62B8CE1
+CF51757DB601999B647006FFB97BAA1EE9A0B1FC0F0DA51EE3A0BD31621F1084
+4839C9534F13BB1401A78C1B63B708B45A0291FAFAF0F312469EC2E94D290E2E
+0
+1
+0
+ecdsa_is_valid_with_key 545
+0F7B923578E3A4496A86F9CFF015095058CC07C50EF1674523146C95F84F80D6
+DA9778C5FD199D7E709727FA54F93C6446986D9BF067A52F799C8B0235CD860B
+BDDFC93FCBE3DEAE08D783209DBEFD277288C091F6DEC37033D0509822344203
+0C812D0A351AD7F66BBB7A242BC0FD483F6D1C7456DA1350F23C0BC9B8580973
+E0E4E68B08DB8F80E7F644E5C8242510197F6DA69CC208DE414EA81CA85A3504
+0
+1
+0
+ecdsa_is_valid_with_key 546
+7FC5C07390F0482CDAD812C054A57DD693C13D51F670E502129D6140409D574D
+7F0089460C844F094DEF11ACD17336147381A77CDF18417FDE445EDFCB89E57F
+C40006B830D459C764A334840624F06EDF67EA2D0EF8347D67D0CFD345444186
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0
+0
 exit
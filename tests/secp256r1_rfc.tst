@@ -7,4 +7,14 @@ BA7816BF8F01CFEA414140DE5DAE2223B00361A396177A9CB410FF61F20015AD
 6FC98BD7E50211A4A27102FA3549DF79EBCB4BF246B80945CDDFE7D509BBFD7D
 0
 1
+ecdsa_sign_rfc6979_sha256 2
+73616D706C65
+C9AFA9D845BA75166B5C215767B1D6934E50C3DB36E89B127B8A622B120F6721
+EFD48B2AACB6A8FD1140DD9CD45E81D69D2C877B56AAF991C34D0EA84EAF3716
+F7CB1C942D657C41D436C7A1B6E29F65F3E900DBB9AFF4064DC4AB2F843ACDA8
+ecdsa_sign_rfc6979_sha256 3
+74657374
+C9AFA9D845BA75166B5C215767B1D6934E50C3DB36E89B127B8A622B120F6721
+F1ABB023518351CD71D881567B1EA663ED3EFCF6C5132B354F28D3B0B7D38367
+019F4113742A2B14BD25926B49C649155F267E60D3814B4C0CC84250E46F0083
 exit
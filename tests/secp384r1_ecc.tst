@@ -5282,4 +5282,1134 @@ BBCD431339F30E879AC2E7F72CAF5B59AE5129D36538B7C3DC327FE02CE3699B4D01BE916FE122E9
 50E7350FB00FB63C682F9DA99371AD7452F725194CBBCABEFAE64ACBD38BC8C68FAF4EDB759672BBDEE749B5D23812DF
 0
 0
+eccp_comb_precompute 705
+4
+1
+eccp_comb_point_multiply 706
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F
+0
+eccp_comb_point_multiply 707
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+8E80F1FA5B1B3CEDB7BFE8DFFD6DBA74B275D875BC6CC43E904E505F256AB4255FFD43E94D39E22D61501E700A940E80
+0
+eccp_comb_point_multiply 708
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+C9E821B569D9D390A26167406D6D23D6070BE242D765EB831625CEEC4A0F473EF59F4E30E2817E6285BCE2846F15F1A0
+0
+eccp_comb_point_multiply 709
+9506D39512D3E158984E7BEE3EA816A210F12673568B00EE78728BAB6147E40BF6831262FE863A49E88EAC915264C752
+399919D5417E27DAB69EB8281CA83D2E5D23BFBB8F0472C86CD185FC6812174D2CF90DBEE76F956C81C08604AA178209
+5A7FA5B173F6857E183E32AA460D969E498DE6680540E60AD979B104D04377535EC05D38CCE58B28EA9CAC1C3041D874
+0
+eccp_comb_point_multiply 710
+FB088DE79AD4D71BD4F8FCA90C02F759214F59A2A1C80CD0CBB9EC2EB271C13C0C475E33DECF2D19BBAE16E1C3F7F23B
+67E4E0D4382CF0BF9FDC20A2FA36E685B1AC97CE2F86F38E7084A888FA48A16A6BD248FCE76944DD0C0C2F875679B3B0
+9E3B7448ECBDEA043A9A6A45AE499DEB0B8E4243B39F9E0744D2688DD5E66A7C971FAB2A1CEF2384E32C8460B82AF726
+0
+eccp_comb_point_multiply 711
+D98A49F392D5CE8CA879456C4EA16A74225FE86ABF8FD635A8A0D20F1A84D80072A0A37917FE615F8B641C207D65B2CF
+FF5891BDF86954BE81C8D737EA0E491ACD016267C0051D7691BFB997818CFC54B4838DEC389C6C3692F954EF8F15BEA4
+42DE37201AEE1D86BD4019D8FE2E3DB5FD90F614DA5A0714D52599E65D93B405073624548703E550E21C5591D3A2359E
+0
+eccp_comb_precompute 712
+4
+2
+eccp_comb_point_multiply 713
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F
+0
+eccp_comb_point_multiply 714
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+8E80F1FA5B1B3CEDB7BFE8DFFD6DBA74B275D875BC6CC43E904E505F256AB4255FFD43E94D39E22D61501E700A940E80
+0
+eccp_comb_point_multiply 715
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+C9E821B569D9D390A26167406D6D23D6070BE242D765EB831625CEEC4A0F473EF59F4E30E2817E6285BCE2846F15F1A0
+0
+eccp_comb_point_multiply 716
+5607376CD519C03261E1E53F8A544387F6C015A48785B79DB7DA275654E6F2E5B3A405CDFA0BBCD5EF43FF1E7C6E1C84
+910B9EF0273CD77172A7DA1094A054F6DB3107D92CB855FE1D35E38ABE45A71741612E3B770FABECCC5D4390E0A7D957
+218030877965C28958A35859A51E2796955BC1AD0B59B061664D40CB37117FDFD68BAA3F02D72FF502EC105ED667DFA3
+0
+eccp_comb_point_multiply 717
+CC53F1764D0EA9ECF14288F27B7145BABE4CE5255C94357D58783B297FF820A3103A3142EAE563E7FDD754DF9F5C6AAD
+8A04F4A10464528F88D0665E31950C759B7EDA03DAB66E0E3317ED496A66BB32B024E166FA08C533C73CC16802101487
+DE59455AB25EE8384C5E6BC7EA400120ED94980B7E44BC1C71C6DA7CD873FB042C92D30CB2913ED87A592184951991BD
+0
+eccp_comb_point_multiply 718
+FBD91FFD8E5D11EE9D3130FBBBE2A007873C8A76FA1A004438A6A7F9A76B8D3FCC434BDE9D6DC83F3026FCD17CD4171D
+BE3564FA8F92418C208040BF0E9DA26FBF2CCF7FD8155D4D4745E072C52D6BD746228FF18DCA6B841877AEB527997CCB
+992B161AB284A725444E4389FCEFB6ED4ACA3CF1B5FF09E9E3192A1F5D93E39D0F055D1D35C657D49395C74B236D1E87
+0
+eccp_comb_precompute 719
+5
+3
+eccp_comb_point_multiply 720
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F
+0
+eccp_comb_point_multiply 721
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+8E80F1FA5B1B3CEDB7BFE8DFFD6DBA74B275D875BC6CC43E904E505F256AB4255FFD43E94D39E22D61501E700A940E80
+0
+eccp_comb_point_multiply 722
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+C9E821B569D9D390A26167406D6D23D6070BE242D765EB831625CEEC4A0F473EF59F4E30E2817E6285BCE2846F15F1A0
+0
+eccp_comb_point_multiply 723
+673A1316C3A9ACC12A387652A47D2A164B96EA3EB1177DCC4EEC25C21BAA8B5D5963DF58BAAED5A939112A6F3D73393A
+EB1030BDC362C938D7D64BDB18EC8E90C9966394F33AFFB47F561D15CD292E8D466F706591B2F72A1D807B8177BB4A32
+30C919084C405F7345C661B238D462B7EE71CA3C4901431A6466E17EA30D216CCA3815430205202F1D49212713B562A6
+0
+eccp_comb_point_multiply 724
+0A88963388B06A1D762BC48586C0CD321C08EB9A2E01802FD540ED98074671F44308995F6B8F28D9443428DD7D157702
+3D8E224A77686A5677E39C3EBE2CE500714026249C258E820877857039AE7C3C04BAF02BACAB1346F6FFA68D19813ABD
+1CC1DB48CD6908C1551F5CCBC77DEE83F589594C891533431FEF93BD26E7AB0967FBA3B2F2CF8B158346BD7C1023EE89
+0
+eccp_comb_point_multiply 725
+C6F1A445270344301C5E964D1953B298EE0088794341DBFDC8BE78B63DC10ADED936BF5972439AF80E880614C34BEA9E
+6920446E3FE9984F8BB5E50DF77D4976EA4AB00ACA45776FA668AFB43F83608E3258F6E374C8BF256AD85306E49A3A9F
+495EB147E1DBFBBE53BA3A4CEB56B09393BB5571F237E6D87ADADDAD85182E57D490B6107958CCB534B935519E905F58
+0
+eccp_comb_precompute 726
+6
+4
+eccp_comb_point_multiply 727
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F
+0
+eccp_comb_point_multiply 728
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+8E80F1FA5B1B3CEDB7BFE8DFFD6DBA74B275D875BC6CC43E904E505F256AB4255FFD43E94D39E22D61501E700A940E80
+0
+eccp_comb_point_multiply 729
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+C9E821B569D9D390A26167406D6D23D6070BE242D765EB831625CEEC4A0F473EF59F4E30E2817E6285BCE2846F15F1A0
+0
+eccp_comb_point_multiply 730
+423EE459EE2B1DD89E98BB1AFECA71F96EDFBDE6D1D4446691005DAEB577B467CA1750578D20D7E44C3D92333E81E76F
+E4A555B80EEB38A97E2617CB98BE70AEBD1C552DC542A3A6A7958FAF092CBA73F87A5107C327A986355CC1E1567F778A
+F23EB59156B77370A353BD14FCC88FA48A23917F008C20FC6CDE3D27DA9D8EAF63A0C3ECA796AE1F97E87CF16D9DBB00
+0
+eccp_comb_point_multiply 731
+1FAA775CBAEB592BF74AEBC274E12B92C1347A390E42D4E7A5073D9A2C88CEC9D78598AE0A718A4588F2030246386B9B
+83DBC66A71C51B16BCFF6C3E83AAEF07F81FF9E1297B5AED81E5305D576A6EBDA80D7311A82B5197519B51266050150D
+34166D8C33CAD0C449D91451F72957CE7037F58F17977B8BBDA8E654183ED7AFBD82E5B86D966F117334216A8B4C0A15
+0
+eccp_comb_point_multiply 732
+1C3C3076266DCCBCA3651B53AF67CF5356239C88E505FECE8A316A1BCAC8767AF5B15F563E8DB08BC62A6C5515D89559
+1854AD5F09C4552A091E5746582CC966C7CB39F40A981B9063FF6016F6988C05789365465B689C3BD8C2AE063C9DA712
+B67528B38D0B34892DE1534E28218C8D6BE0F693D2CFCDDB10A1D12453C89F1F849756DABBF3D667212204B260240EFD
+0
+eccp_comb_precompute 733
+3
+4
+eccp_comb_point_multiply 734
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F
+0
+eccp_comb_point_multiply 735
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+8E80F1FA5B1B3CEDB7BFE8DFFD6DBA74B275D875BC6CC43E904E505F256AB4255FFD43E94D39E22D61501E700A940E80
+0
+eccp_comb_point_multiply 736
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+C9E821B569D9D390A26167406D6D23D6070BE242D765EB831625CEEC4A0F473EF59F4E30E2817E6285BCE2846F15F1A0
+0
+eccp_comb_point_multiply 737
+BB4A5FE856E30D0F7E63B92041A2CA4C885888DBD12CFA0C0645AFFF3A471CF9BE012A3405F3CB89C1EC2631B8BC667D
+BC81F0A5632B6C54912D9AAC90EEA5B0B464D0113EBCE091B456ECAA58BBBBB7BED7268DC9A430E07AFF5A9966DB6B2B
+548BEB4F9707F87A6E0AD4DAA5AD8A2EEFBA08C449A8C0A6AFEA40E1BB44DBCB862EE443478A0F4E650DD7064C59DEBA
+0
+eccp_comb_point_multiply 738
+2DAFEEA31FC5B1EE187B84B5AC1870654804A8745F9C7D8A05AAB9F788B42FA715CDDE0CA16AC3F36CF2A4BE00BFE2AD
+BEFE8F35A06DF8486241037C481EE3E6B855730A885EB9E7402DA86FCD4BE46B300748A27438F7CC2788425518807A68
+745C9F9D09B71A33910A90C726EF0CE13D9CDFFF71A4E9DC3F240AB4D1E02D6ED8AE14ABCC5AC1C2CFC7F0ED4AB80F80
+0
+eccp_comb_point_multiply 739
+A53DFB9CD48246F27C8E6494490CCD3E8F68448604E4629D2D2A8CB1267CDA63E2A0C5E9CB5F280C9C8829ECD56C23C3
+B90EA32DAC1190B84E955222A101EA544238B71F16FFC72941D7481CE44C0F4AEB8ADFA0CEDB75485B58D78745FD8C01
+673FD5EE33304D66DC84637D0FACC8A2250A77E14DFC2087671B7CBB39D937C70819AB1E496987C30E2B16DCDADC3325
+0
+eccp_comb_attach_const_table 740
+4
+eccp_comb_point_multiply 741
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F
+0
+eccp_comb_point_multiply 742
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+8E80F1FA5B1B3CEDB7BFE8DFFD6DBA74B275D875BC6CC43E904E505F256AB4255FFD43E94D39E22D61501E700A940E80
+0
+eccp_comb_point_multiply 743
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+C9E821B569D9D390A26167406D6D23D6070BE242D765EB831625CEEC4A0F473EF59F4E30E2817E6285BCE2846F15F1A0
+0
+eccp_comb_point_multiply 744
+772E61303E5D83EA6ACECA42ABC8A95928C5ABFF6D30EF089186BCF972C01B6FCA60B4268B6EFDF934BFC0E3855D3D54
+3741062610CD11DD547452193F4ABB0F020180864BEE55870966703EAD98BBA3E16DEBF972D0A2992276FB629867CF6C
+0EAEFE18FA6B620AFF7D980F826A5ADF6A9DE8A6762A4157E3296BC0DAF741A10AA1BA8E969BB647EA085884AC1254FB
+0
+eccp_comb_point_multiply 745
+AFFBE1C168385E916F7CFECE03DE4D73088AC0C6F6B42E463C6E50B43B3817EA77B4D4124B5B16D8EBDB8295DD9193E1
+4D0D422B01C7C054393E65BB8E9B8D0A717C9C5E9BE6F38CA344C1FCF2C9AC1E218DADBCBE63F7D0D5926C13280CAE2C
+B42B5E29E8FD10758974E3A8234992B733B75A10A4F04E85FE55D59A30D8543AD50219D97546EA4656B83776CB20ABBD
+0
+eccp_comb_attach_const_table 746
+6
+eccp_comb_point_multiply 747
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F
+0
+eccp_comb_point_multiply 748
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+8E80F1FA5B1B3CEDB7BFE8DFFD6DBA74B275D875BC6CC43E904E505F256AB4255FFD43E94D39E22D61501E700A940E80
+0
+eccp_comb_point_multiply 749
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+C9E821B569D9D390A26167406D6D23D6070BE242D765EB831625CEEC4A0F473EF59F4E30E2817E6285BCE2846F15F1A0
+0
+eccp_comb_point_multiply 750
+A5F7747100E92284EBF13C2A811754EC8595D36BAC6C2A85D9AB78E4D45A6EF02335ECC0709A4DC54098E8268D75443B
+7CBB61F5E83275A3A55A82D54118B7FFD13B33A21A8D32CBCAB7AEB38392821B9EDAD32CE1EB14D7D9569BC3A34F250C
+BCC991748B28EA733CD7BE8B555F2B39B6EA6087CCFCBCD53A0146F0F216959933E903C9F6DC6A5D4A0A077A703539F8
+0
+eccp_comb_point_multiply 751
+9E77135E1A45B05C8E801AF6324A9D85675EE119383700CF15D6239B5C1D57E2AC9AF5545D90211C7483CA24FC1207C1
+04F5F4423A9C8C8CB3195E68E593CD98A2C2A920E1F376D79CCEC9E70888411C597FE0F291ABB4D36452C2471D4D94E8
+DBCD188BF4C3A36C7526BFF0A15EA24331E0EEB5D14E46B9DF7E04222DFF6B186304D6D6E4EC576081FF50ED12595D97
+0
+eccp_comb_attach_const_table 752
+5
+eccp_comb_point_multiply 753
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F
+0
+eccp_comb_point_multiply 754
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+8E80F1FA5B1B3CEDB7BFE8DFFD6DBA74B275D875BC6CC43E904E505F256AB4255FFD43E94D39E22D61501E700A940E80
+0
+eccp_comb_point_multiply 755
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+C9E821B569D9D390A26167406D6D23D6070BE242D765EB831625CEEC4A0F473EF59F4E30E2817E6285BCE2846F15F1A0
+0
+eccp_comb_point_multiply 756
+2726297B1275708472748E04A70F987D9B5F124482C7409EDEF98F094BD83CE2A5212422AC28E42F1E4B9DC321A11DF0
+E2B0E0DBF9986D7B85A20DFD1F3304AE68113B90B06E00CB1D98994E2D8588594ACEE481C325181A6BFA437103E0E5C6
+AE1BAE1E055E0E743CDA8F0B291AC0040244D54D8E6267F8E841DE33BCFD0173066F4C2B3502B2BBA6E0F276216CBDEF
+0
+eccp_comb_point_multiply 757
+F248FA1B51CB726E81A1CF497377E5AD1641CDAFE34C64E785616B45CE09FBB52BBE726E31B9FD8FC399190FC2902E93
+B73DFA80A8BBB0DE0B79846A86629260EC34DA9B5E7E6C8B8739A91D67CC53C0DBAD4FABE310319B5F9E506936C03FD5
+A84BDEB2C6193C4EA8B02B83C2E1A6594B3504B19243BC26D6FF8A4C897A8A40CE63021AF353ECE83C2F34F525762E57
+0
+eccp_comb_table_file 758
+1
+5
+2
+eccp_comb_point_multiply 759
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F
+0
+eccp_comb_point_multiply 760
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+8E80F1FA5B1B3CEDB7BFE8DFFD6DBA74B275D875BC6CC43E904E505F256AB4255FFD43E94D39E22D61501E700A940E80
+0
+eccp_comb_point_multiply 761
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+C9E821B569D9D390A26167406D6D23D6070BE242D765EB831625CEEC4A0F473EF59F4E30E2817E6285BCE2846F15F1A0
+0
+eccp_comb_point_multiply 762
+6D0E7B78A7C4C9C1A00BF9536A433ECA29CEE26C65DA283B8D56E05211BB691ECD4CD58F57368A18B045F6DD26666A1D
+3DA19E9AA88E90141B02C542E574F8F3193CED5970F4F8E0FD0FBB1CED4B849AC55A9A679C19F7BC1DC82383A284F4C4
+DC1BEEBA1D9F8CBCE8A23008593EBD8DA267784B6D82D8FBF242DD0D88943D7581C9C99FB7875EE0AA5B1D2BD38BDB88
+0
+eccp_comb_point_multiply 763
+F92AF21FB2F4F1A4D82D50FFDFF93389BED7CA14522E65D027DBA324A8CCCACE9E12E819EF6EE5C74801494177724C57
+4ED617C0094872E2D6A7BC78E6BC13788946946E1B0F0F3E1DCDCB985FE7501C3A4B81F4133C3F96C3CDB8D16569EEDE
+BF87E18EBB356E9CC030B1221ED02A34169157C0A2EBBA6FCE9EF17CCE3EF96D3F7109BD80F912DE258628D39E64AFCA
+0
+eccp_comb_table_file 764
+2
+6
+1
+eccp_comb_point_multiply 765
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F
+0
+eccp_comb_point_multiply 766
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+8E80F1FA5B1B3CEDB7BFE8DFFD6DBA74B275D875BC6CC43E904E505F256AB4255FFD43E94D39E22D61501E700A940E80
+0
+eccp_comb_point_multiply 767
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+C9E821B569D9D390A26167406D6D23D6070BE242D765EB831625CEEC4A0F473EF59F4E30E2817E6285BCE2846F15F1A0
+0
+eccp_comb_point_multiply 768
+C14AA21FF8E91F2B03E527EA47429478ABF04ACB34892C84ACA19E43F73326FBBB175C8CBBFDEF56A29119E1F7A223E0
+AB423F8FC0DADDDD6B1E0C37FE3B7D1064277FC8FAD2E67FF8F2D4FF234A8983A3516D4D5FA1037CB40E0A5F319E2540
+FE850D23560AC33860AF40BA50C485C6B274FFA8FCB335BD13405BB450E49C2822DBCA37E2A6C717DDD204BF180F87C3
+0
+eccp_comb_point_multiply 769
+026DB6CFEA7BA6CF4A4BD6B5269926F06FBA26BF22CA60DA8C6D7589E90FF1B26A12DE8FEC7B3EB66605BC1D0599B27C
+715A079F1B90308FD098AE3D77CB052CB85F1D23AB1CD6EDAC0D45397D6890B5547CA79F72DE87EF5571D135210D3D76
+9609CEBC8AABCC2E3DCD87DD2C3803230FAF77A6EE88820C550C0B5AB3E8B81BF8E1F7648C93E1962478019DD2798527
+0
+eccp_comb_table_file 770
+2
+5
+1
+eccp_comb_cr_point_multiply 771
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F
+0
+eccp_comb_cr_point_multiply 772
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+8E80F1FA5B1B3CEDB7BFE8DFFD6DBA74B275D875BC6CC43E904E505F256AB4255FFD43E94D39E22D61501E700A940E80
+0
+eccp_comb_cr_point_multiply 773
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003
+077A41D4606FFA1464793C7E5FDC7D98CB9D3910202DCD06BEA4F240D3566DA6B408BBAE5026580D02D7E5C70500C831
+C995F7CA0B0C42837D0BBE9602A9FC998520B41C85115AA5F7684C0EDC111EACC24ABD6BE4B5D298B65F28600A2F1DF1
+0
+eccp_comb_cr_point_multiply 774
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+C9E821B569D9D390A26167406D6D23D6070BE242D765EB831625CEEC4A0F473EF59F4E30E2817E6285BCE2846F15F1A0
+0
+eccp_comb_cr_point_multiply 775
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52971
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+717F0E05A4E4C312484017200292458B4D8A278A43933BC16FB1AFA0DA954BD9A002BC15B2C61DD29EAFE190F56BF17F
+0
+eccp_comb_cr_point_multiply 776
+F6A913076CE104B7F94D8A06248B646200D3CFC279EBC231F9AE483D93D3BCFE6852DFC331915A6B06ACCF34D633EEF5
+E9256B386F16D429AD016EB4213A8929C0B3AC0437B211695DFF4C42C820C72B2362B8B3ADCC3FB7B000377783EBE916
+EC34A9DA9FB1183BD1A9EC5CD3FDF4D48AA2380E293A427FE75F1DC619FE4EA673725623CB8159C8568F243EE675336A
+0
+eccp_comb_cr_point_multiply 777
+038EF5CF9CBBF060E348DB29C4F057B94C8627D8C2A16C654AE76106C2442A6D3FD715396174640110687DD8F9064F44
+0D55FD6C24E1DC0D110C213871F1E99EA05E3D5B42A4BE0B37B50E81B24E7DCA1EA38A7860F0ADC19700BC61D33B7D90
+070A26084B0D2514D8DF1D4A91B7C33A519F2870A8E86203215D929250F635029E9AA1C7FC0C50178519F744EA302953
+0
+eccp_comb_cr_point_multiply 778
+F266A9D77D34BB035B2D3A8219D52CDDA681F80672916874C3170BA67A86D77300AB64515798C0FD508D51A6E6FD1E0B
+26490029B4247E3DD9D79D89552B79F672A00B5C359806EB6DB5F1CE431735171B0A20AAEC617B0F3163C7668981A77A
+C1D43AE8B732BD44AAB8D9EE6D3602A2F9B87E51DE95D56051FD656BC32A1F4B1B5CCAACDF3651D51F05F5B25D1A2542
+0
+eccp_comb_cr_point_multiply 779
+31C8369F1B1014D763F39D147BEBE8AB5521E18D3E2168F31E4907862D68B2F1BA5A0CCC92FA6D857A2B66C7C32AAAFC
+4F19EAEE1EC96ABC24B43FF5A9238C961D26C3BEDB3D194CF3A7E273F237AFC205A00A698895C0CCF1551487931FE0CB
+7DE60AAD357FF8E86385F9D8C373E4C83B170647F274F07831C4EDA44D58CA0B8049F627F70E5D4527EED833E62B0C28
+0
+eccp_comb_cr_point_multiply 780
+5809E2358488F740B3BF864B28A0E8D02C1867841D4799F3652A122E1B465EDD183A7AB3BD3E99B27A02B648335EBC3E
+B2F4C9B754369A4EE70C819015FAD6757616980E3A82E07E50F6910D7F0D39C2CC138B85A76E858147152250499007D6
+81A72B31E8B6BE7EEFCA2D215BCFF5E8942A4E37F6E2B3168ABD20C22463314699C7FD51DB20A5BE4C646754E26A32EE
+0
+eccp_comb_table_file 781
+2
+3
+1
+eccp_comb_cr_point_multiply 782
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F
+0
+eccp_comb_cr_point_multiply 783
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+8E80F1FA5B1B3CEDB7BFE8DFFD6DBA74B275D875BC6CC43E904E505F256AB4255FFD43E94D39E22D61501E700A940E80
+0
+eccp_comb_cr_point_multiply 784
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003
+077A41D4606FFA1464793C7E5FDC7D98CB9D3910202DCD06BEA4F240D3566DA6B408BBAE5026580D02D7E5C70500C831
+C995F7CA0B0C42837D0BBE9602A9FC998520B41C85115AA5F7684C0EDC111EACC24ABD6BE4B5D298B65F28600A2F1DF1
+0
+eccp_comb_cr_point_multiply 785
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+C9E821B569D9D390A26167406D6D23D6070BE242D765EB831625CEEC4A0F473EF59F4E30E2817E6285BCE2846F15F1A0
+0
+eccp_comb_cr_point_multiply 786
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52971
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+717F0E05A4E4C312484017200292458B4D8A278A43933BC16FB1AFA0DA954BD9A002BC15B2C61DD29EAFE190F56BF17F
+0
+eccp_comb_cr_point_multiply 787
+5F6DFA17B93D3C02DF77BF12C675F39EDAA370B4C261C92D2A6B59AA90FB591CAC89769AAFC47997E4279D7005755863
+0869614AA8BCBCB66484CFCAA85CAE7C9D0D63D10C4DBDCE556AB4B996E0DFD367561DECB72821C89E84D26D382CEAE5
+7CE40FA5D371F7FE04E553CBC7FEF8707E208DE5AFE04A5F7F51CEB4BCEC9969B2E9A323F9B087908F881A873DD712C8
+0
+eccp_comb_cr_point_multiply 788
+9FB8E48BB32FDF5D315CD6293A7C91AA93BEA053265032BA59C3D23A9907836130C10FFD4DD7A289883E004684786DD6
+BA549BB18CB8E990E0DEE5352E7E5CDD2D052691DBE8E5CB6FFC72EA26F43FDA2CBBDBE812D6D71CE542544ED3C0BAD8
+28AC799BD4067ADF81E5DF349BD5EFCCFD76F8632C03D3609994FA1DCA05D18F7AB452C354885086F8873D714F0D94F8
+0
+eccp_comb_cr_point_multiply 789
+80726D3AA62BC1E7525095BF38FB0634EC152F7F99375D481F57AC3571689DDF24AA335923387490D69C1B239900ADF9
+E54DA00D9C297A92196602586ECEE489513FBB673AB522A2EF98A9D41CA0A4716D3FCF8641ABEA201586F78DCFF01B36
+6C308C20C2C7B3B59050D8641690EB5B2B42ACE48CFAA596C6834717A79F4987475897EE1DA46FF6FDF3924826F85928
+0
+eccp_comb_cr_point_multiply 790
+BD1DE3E86A18D5C4CFD68B64B81F31D106762FA949B0CFEB339C02846A3E271F4D2329DC2A259D673094133D24B1A914
+EF083F8E297D64FEAD722D2C4B648A3F181CAEC0F8533A3C89DC9D42E48AEC40836591ED212FB2E50122609182BB827F
+4983761809E9CD6F2587CEEA00075F7EC0117F1412EC9A414DC73841FA32F129FD28B6ED1B5F60BC598C994D2E6B3007
+0
+eccp_comb_cr_point_multiply 791
+F7892F8945A06F0E7AEA25ED1EC8BB55B4D656A8C5C707F6466C6477D59A6F63664E098FD18D9A2D011111F64A1E6649
+3DC6A1E18AF1FA30B220AF79A4A97404A6C97D67C716AD8320DF6D037DD428030BC93E0A1D4B7D694587BAF12C91C823
+BA1D8D59100FAA095DDAE9E5145063F4630F2BDE0B95E23CEEAE8DEA7B9A4BBF813EED293DBB399420AE0F4268BB992B
+0
+eccp_comb_table_detach 829
+eccp_affine_point_pack 792
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+eccp_affine_point_pack 793
+69C927418DF6FF9BC3299912B044C08FF88B4BC6F6513BBC10B28C20E2CCC16EE32F1F4778EB1CA881C911A0F34174A5
+F26D7AF3D87B6002E458F907DA6EF152EEE38996065B198C5C37C3619C98DAEDB5A9968710739BA2F9FBBF99C2F8F3B4
+0
+eccp_affine_point_pack 794
+50F6884EAAAFA21B4F76B24454A473C8D7A5C702A1F4C4C0CA05E04295F6476F52E8BB32B8A62CC3A674E58A49D4F614
+F8E9211195D0F7D35E6010B6B594B489CA9363B402B0FC13F026AC9EB78B4D660965D9CEEEC49D9A5B9A58D868206738
+0
+eccp_affine_point_pack 795
+6A51A3050523FC5AC81D852AB89E7CCF6F619108A2BC0D8006F5C44F36D5B145E99407F8C4FE9C6CDFF332F082A24883
+930BC51ED8B5C8D1AA0DFC86F92539ACCD509C0D562A2082F87EC95AF5FC6B8DA6BAB3FA36EFD8D344271F2B904A499F
+0
+eccp_affine_point_pack 796
+57E3524046FAB3F783E570C2F44BF1A897B360D97F7CFBD3A5AE9908A9701D2F22D1FDF83FE0F050419E791ACEB6073A
+28DCD456E5B95F27B8BE847E530E1064D64D468F2C64590EAA39B3084A098F1186959DFF1EF332F4331EF8D455BEF350
+0
+eccp_comb_precompute 797
+4
+1
+eccp_comb_pack_table 798
+eccp_comb_point_multiply 799
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F
+0
+eccp_comb_point_multiply 800
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+8E80F1FA5B1B3CEDB7BFE8DFFD6DBA74B275D875BC6CC43E904E505F256AB4255FFD43E94D39E22D61501E700A940E80
+0
+eccp_comb_point_multiply 801
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+C9E821B569D9D390A26167406D6D23D6070BE242D765EB831625CEEC4A0F473EF59F4E30E2817E6285BCE2846F15F1A0
+0
+eccp_comb_point_multiply 802
+BB8DDA0F1E6A5FAAAB0632F4DA66CAAA0AC102422A8A41B9C5C990AF946A194A611AC26AB0AC39794AEEC4F8F1585174
+D517CEC1E7F0B540A8BCC306CE3B6277B116AD91D1F8558F3D8B08FA345B7AC4D2C600F5E9F064855626A8CD1E81553E
+4818002A935B8956091E0D00BF6263DB778E79730FA01FF08754A9B326089E406CA1ACA7047D45B9F0501B8F39A3750E
+0
+eccp_comb_point_multiply 803
+4E9526D4B609DDBAE3EC6D316CEE9BD7346F831E4EA45701E1E9D7C46175A1F53ED9C0BC240058353529619F6CC48357
+312492C559BA2AE876FD704EC3104CA6858927E2816AD7D34CCC04A4D62E1D96FE0AD0D9B30224F73CCEA33DB0A8EF8A
+57A27289A1F7C76E13BA77D2D461C4A552A35CCC0016E563C99DD22950CA53DB4AAFA862E96DEEA310F497E8B7C94AE2
+0
+eccp_comb_point_multiply 804
+78E6BCB708710D0B09AD2AEDD3C4D695F072A1FBBC30311544FAA147C7614C7DEB58A78F3E24BA7D9658F20B8AA34D2B
+5332C024E77A815E977F72BD13B733BE46EE531111205645610EA374B998D66A1EA5EF6153BD98A3AF99CC32B5BEE915
+53E96EE7450C4365A96F41DAA8EB194293E4C8DFDC022010702FBB93C0234097680AD32AE834197F5BBFD92C7A60F97C
+0
+eccp_comb_precompute 805
+5
+3
+eccp_comb_pack_table 806
+eccp_comb_point_multiply 807
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F
+0
+eccp_comb_point_multiply 808
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+08D999057BA3D2D969260045C55B97F089025959A6F434D651D207D19FB96E9E4FE0E86EBE0E64F85B96A9C75295DF61
+8E80F1FA5B1B3CEDB7BFE8DFFD6DBA74B275D875BC6CC43E904E505F256AB4255FFD43E94D39E22D61501E700A940E80
+0
+eccp_comb_point_multiply 809
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+AA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7
+C9E821B569D9D390A26167406D6D23D6070BE242D765EB831625CEEC4A0F473EF59F4E30E2817E6285BCE2846F15F1A0
+0
+eccp_comb_point_multiply 810
+35E793B85D2778A9B3BD6F39D059F0216F53B97C33C09C658953033F4242F74D462A7891E53863BED3EF4B0E9D5DC3C8
+96587D2E837E9A108E2675BBE0ED4986FAEC6644D7E4AC1EACE66170E791BA62FF0114DCAAA2CD314AFC0630B9EDE082
+A911853618FDD3551B2407C901F0566FB9CD36C07455BDD48C7991738D9B00F33DA308601CD998B9140C2201D44D673B
+0
+eccp_comb_point_multiply 811
+4C0A0717587A0130526ECE7536E1E8063D7093D732CD3BC5B50F023B6257F1EE718EEBA9D150AB6E088BA72F66BA78A3
+461F7E0FA179102A229DCDF2EC172F1CEC2E2D55E409587955A9BA2FC5B49F50847335BEEFF016C2AE002013A4A0DD65
+0AD4662A2DCE7BF5E26F58E08F9F47D15DDBA4E143A6DCFD8276BE4064D7CD34BE525F35D940C1B5761BB78F4DDF5CBD
+0
+eccp_comb_point_multiply 812
+B18FD6229FFB1643E2834E893FC09D4AF8178BBD10E2E045374C10C2C56406521CC0B7905E45FC87F59A8DFAB2A787B9
+707DCC3C08F1C7583501E2133E1F4A230DB74E952B3016423F083F2E14895F22078142439CAB71A7E7F20BBEBA4E9745
+1B8F862B3772A4240C3621B55A7C5F8FD369CCB6FED132A35E80E7582856B3311601468D47206037E42B69985E9F65E9
+0
+eccp_batch_add 813
+5
+CEACCDEA5DAA8F480BE81194267ADAD6FC73F824D16B83797B70AE88C3ECEE949ACF51BA07647F538CF1637AEBA5FC6E
+FCFBBC52E0E388FF1D88EEA2E41BA422B2BE3DAB92DFBBC393BD85432F86B6D1F71C2A5C797D0B16D8E09B04C8702DED
+0
+95D8C6D4660A8FD891256E82DFC94971F9562CDCF22D88FF328DACA70978A8D557D7BE98B92A12276433DDD7CC5E8772
+5499A0BEEF060918DB2BBBC8C2B680738A574DD35485BD7C5B3C0663BC083F45312EF0C0AD5E7ABF8DC46EA16BCA0C46
+0
+9B86F91560FB74B20D6C7FDC1BC38818ABB8C2FA32850FC34240A3B0F738762560F17370805A8DC3089A86F74426D885
+24967735C5BB0869F1319791F8D953F41A992DE67328B57B2EDFE3143620FD1167FBFAAC31C4E151C5C09006E72936B3
+0
+57D040140EC4AC43786319A1563AAC4703412D00A8DCCB972CACF9F6433B48E5F533C1F53C4578112A8E97DDC1B39BA7
+94F9A0D63B30725C8AF16A2C46221FD972B3B9A261A59162E7F0B388BFB1997E1D1CE3537D5BFCCD4F5D0AE8EB038E28
+0
+57D040140EC4AC43786319A1563AAC4703412D00A8DCCB972CACF9F6433B48E5F533C1F53C4578112A8E97DDC1B39BA7
+6B065F29C4CF8DA3750E95D3B9DDE0268D4C465D9E5A6E9D180F4C77404E6680E2E31CAB82A40332B0A2F51814FC71D7
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+A63E25681AFA2DFBE1B3D933384084A34CDAD0DC67450CE85F8D89CD19F5401DCB6C694910DDBE47B8D4E4A6D99AFDE9
+B43FE9A3AAAF1E268265A92165C11933FE0E1F3F805C7A1DBD5291DD42F868233DE464FE3A8272711AABAFEAD7E5FFD1
+0
+A63E25681AFA2DFBE1B3D933384084A34CDAD0DC67450CE85F8D89CD19F5401DCB6C694910DDBE47B8D4E4A6D99AFDE9
+B43FE9A3AAAF1E268265A92165C11933FE0E1F3F805C7A1DBD5291DD42F868233DE464FE3A8272711AABAFEAD7E5FFD1
+0
+7D7D73BDBE9F7F64B45431CF8785B8FB2A90254C1831D4FB62479610353CE141616A7A4F69A3D744574A8B4F3DA2C583
+09AF8584E91DBC778854C1E67C1E163037F21199CFF0BFA54C7065A3D30550A57F293B8875125F0092DBCCEC8F3AA845
+0
+7D7D73BDBE9F7F64B45431CF8785B8FB2A90254C1831D4FB62479610353CE141616A7A4F69A3D744574A8B4F3DA2C583
+09AF8584E91DBC778854C1E67C1E163037F21199CFF0BFA54C7065A3D30550A57F293B8875125F0092DBCCEC8F3AA845
+0
+5F86B648D0CE77F811A5665ED2407CA086B06100179FC63111D8F484A93B484C5226DA12AC893BABD233903A14C00BE2
+22FFEB41AF60DC4D71D0D17D849F576DB1ACEBCEF175270769F1030D5B139AF321D569B3FC3B75955E28E837A78CBBD8
+0
+03D768BB9C36DC9BCDF428E6699E58D2D672FF45C62BEFDD203B49A43D6D6C625F8FDAC891B73CC06C5A54890973B7C0
+E98DA929F6AFB5973CBEBF424CFE9D44CA31213F6DC377FC779755A845539FB79B8003E32FEAE5B358406360CC5871C0
+0
+5A86F96BBCB38D23EF15C0C9F365B134CFB8B97F679571C8CC77699DCDB0A3D6C0976CBF78F4CEC8F84A5594DCD17B46
+2B0F21424BED89BD1BC1DB22937D30A79EE8E757127DFAF482B736E9BB27A6A4155B2968C2DD0C0A174ECA13DCBB5280
+0
+9D6922CDECF5FFCABECA711FE470C31080C4A55B4572FE5C6704E7D7D2DCBA9530481D3011056324659CB5E03BE61811
+6094388637E3BE794986785A363E9FABCA64C7D6FF301D963575F1E96309FCA0172FC2BB19853E56DC39BC3897C7996B
+0
+eccp_batch_double 814
+5
+462825CA45DDFDAF89120F7885864D9A19E4E3548193F9B1E663E923E2D71A2D6FA7072578AC78C146744DE40A97258E
+809958081D157B8B2AEBB2C81AC228A8292B5D0BCCF77990F9D88110EF63157E80E33D1EEA238E4EB2ABB666D90058AF
+0
+FD0CC07D5FE0BCC8B328E101C80BCDC11DACDF228BC66E76F3A689D97253F092DE79383484EE94FF3E31408573E4302C
+09D83B0F31DD9F9103C698966C30E274AF55DF53082E94C2469CB83BCF21DAB2D229AC62833BFD107C9B35089396526A
+0
+D453A60FC4EF8C8A3294888037E66BDFC045F3270FFEC4467B9CD3864082CE3803E88BAAE0161E24DAEBE8AA5FE8A199
+ECCF92AFCAC0DF9A2278CDFC4FB15FA825216C9C20A6159CAC65F0C16998F25B16C8F84017AB72188C41AD37F1AD8458
+0
+603674DFBEC60D2C0B98DF8A9D0F103F38EB98AD0C7E773066B575462180C5F28BE1D8DD885ADC07B93360126318AB46
+823191C15AB546370A40458889159D754FBAAE02F754CFB50DAB82979BD03763C20498439C595B17DD5D7289CD475547
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+6AA4E4726D1E0CDDD4861E3277E6C2672C3B270A03F9A42D0E5CDA925A4561656374E3BA41319BCF507DBB30BB2E5542
+D265AE3D7F1EBE0E1C48512DEB16979E0234BD23F4F32820B2F0A88E6ADC4F68017DD4786256FF611275DACD93D1D7D3
+0
+D440B2AC2A1D43E3A571357462BDB29FEB905074E835122D0C32E6AFC1248236BE4370B69A38F80A614A1F93E741FAF2
+3A5BF7BB68614FC4A09061ABC3AA9C386C7FB12FBE5F14EA3EDD436B1933A658761DF74C01100C988F512C03453C3EBD
+0
+315170B2F0814ED159B20CA741107E5332AD15C0F66C828EDC05C3224D7C16F71D975C1151E6306CBB24F5CE5C57BD41
+675FB201855433EB853214D7195456A62C682689CDB37DC38C85E76367EB1D68444021FF88C178D7076DA741912EB3C3
+0
+535D6E5E2FDF014C27432E35E71F5359F883E6B3C038623440F0DB8C821E6E4BA3AE9823738EF6579623E015ED334EBF
+690E664CF92D7E32E80B4F16BCF059A3F0097AA65D6029892E2EC756E269FA25402E9E81483C3C3CA0BBC74C01DBA5C4
+0
+eccp_batch_negate 815
+5
+AEAB3F4F3E3D3567A4A64EE5D5C8DB5A3D43E9A4AC6FA421BEC32B08DA9CF3E5558DD8A559E5A1F3798A9BB751E35AB2
+4DFDF31C3D2C2CA685BBF80A9CE281347E8A697831301EBF8DA67144DA7CA4A47DA5F6F8BECD48EF2F7AC0892E96327C
+0
+AEAB3F4F3E3D3567A4A64EE5D5C8DB5A3D43E9A4AC6FA421BEC32B08DA9CF3E5558DD8A559E5A1F3798A9BB751E35AB2
+B2020CE3C2D3D3597A4407F5631D7ECB81759687CECFE14072598EBB25835B5A825A09064132B710D0853F77D169CD83
+0
+6D4996863A6F674C91D288864F0DAB25439A09377C619FAF823711A696EFAFB61019F6B9DE6E1E90184ECDCD1A19D2F5
+3F0E7227B7C862E2F147B62D4BE73926328CBE92E96C87F3407563CADDC43B1D983EBB6C21ACA3A374C797A3179BEC68
+0
+6D4996863A6F674C91D288864F0DAB25439A09377C619FAF823711A696EFAFB61019F6B9DE6E1E90184ECDCD1A19D2F5
+C0F18DD848379D1D0EB849D2B418C6D9CD73416D1693780CBF8A9C35223BC4E167C14492DE535C5C8B38685DE8641397
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0C738C9B635832A1355366B244D96E88CDEC3600C57847E91A0B7EC6477CCFAD6101C111FE6F14182AF6B724D403A917
+C465222AF01250973F606FC594629D91C5888E0E37BA1236805E9F74C88B9F16CA3FB96537B949DCEF9A916EE40A6541
+0
+0C738C9B635832A1355366B244D96E88CDEC3600C57847E91A0B7EC6477CCFAD6101C111FE6F14182AF6B724D403A917
+3B9ADDD50FEDAF68C09F903A6B9D626E3A7771F1C845EDC97FA1608B377460E835C04699C846B62310656E921BF59ABE
+0
+AA018E1EE1C50C7D20FA658910290696B9C68A23F27D000213953C6882E351927A38C2C1AC57E297D474809C59607070
+F3DDE0B1B3E6F2AECDCD4FDEB5E3DCBCCC5D047E0AC865A03DC0E1C3F3B6BAD9B8C0E094885094171F8057250A8421A0
+0
+AA018E1EE1C50C7D20FA658910290696B9C68A23F27D000213953C6882E351927A38C2C1AC57E297D474809C59607070
+0C221F4E4C190D513232B0214A1C234333A2FB81F5379A5FC23F1E3C0C494525473F1F6A77AF6BE8E07FA8DBF57BDE5F
+0
+eccp_batch_add 816
+8
+6F20682202EEA14EA22CC4F99BC6AC9A508F96A979979AB180E818C9BAFBDC0CF67CEDC536FE69E3AF19A934A4120865
+01D8EB67E31578BB437C6D82DCF2EE17BD823EA1DC7101859C68CF9ADC5A86881E831CA012195E3B0BF17FB36CA1918D
+0
+68639E1AC14B2E6FAE635E3C54D8B927594358F3236FF9FB309E8560DCD56637F92A2BA7FDDEEEF64EE5CA21D81988B0
+0CBF95D8C823A2F0A7D8683EAEFA25B23D8877613C326F2BFAB6DDC94084FE9DBE0B3D7AD91A05E561F96289CB77150B
+0
+1A3F63D52C8FDC0D8F65AAF4DB3FFD8F4601E71B167509E07B4DE53BCAEA9C8EC5CD4F25D4A7B245D3B9F2E7E8E4E500
+1198E98A1BE0938AE9F961FC56C58C213E5B829F91B4BC36A8FDF246CBB490402850C9EF9317E2CCFAE8F5B67B5940C9
+0
+DCFB93229F2D75168B643AA7CD499F2A0C51342E64C3379FCCB4D8FFBD251DFDF03DE78BF63C165B83C19DAC028F1CB5
+669F81A79627850604BE3D382E5D61B7116A17CDAC27946B4E511B24E958816707B832BA93AD51EEE6FB3911ACD9650B
+0
+DCFB93229F2D75168B643AA7CD499F2A0C51342E64C3379FCCB4D8FFBD251DFDF03DE78BF63C165B83C19DAC028F1CB5
+99607E5869D87AF9FB41C2C7D1A29E48EE95E83253D86B94B1AEE4DB16A77E97F847CD446C52AE111904C6EF53269AF4
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+68E7B2187B79981F2A750C6F4D34E18FBC46B0E5D8D7C7B32A07835AD9B8EEC0A00AC1FC9052F74CA5A200596E81DC0D
+9686B12636BAEAE1638127344F36A18432931D5894CDCD7B1E3FC30E796F13B01763AEDD667A0B5E15BAEBDCFE4E892F
+0
+68E7B2187B79981F2A750C6F4D34E18FBC46B0E5D8D7C7B32A07835AD9B8EEC0A00AC1FC9052F74CA5A200596E81DC0D
+9686B12636BAEAE1638127344F36A18432931D5894CDCD7B1E3FC30E796F13B01763AEDD667A0B5E15BAEBDCFE4E892F
+0
+6AE2713EB9DA948EFB06DDCF79B6BC130104F29D84AB2208D2677008FFE282980C6374C56A62F313CB595B609C9E3E36
+7F26BD51401142A73595A726B1B232F7A1715C210C49D59C68B5327D1704C3B699843F99031B121B179EC5A4FD276162
+0
+6AE2713EB9DA948EFB06DDCF79B6BC130104F29D84AB2208D2677008FFE282980C6374C56A62F313CB595B609C9E3E36
+7F26BD51401142A73595A726B1B232F7A1715C210C49D59C68B5327D1704C3B699843F99031B121B179EC5A4FD276162
+0
+4C870BD96EF8023B3902EE0BF87B337CFACDADDDBD245B106999F97582473F4A5DB7D74634F7B9487E82726117885260
+1B3CF7A0B6122C7DC425FB75F7C1F1AECE94FDE7598DA5C27F8F7A641D2AC404A8813227F64524317EB9D89B4D9972A7
+0
+355A790E6A79F870F95CB8F41615A3F8A36F305EE01393520D93FE38D07CD9724A431790E5BBB49F399E4FE6330D2A1C
+836B146F22444209736C52567190FB36AD884F4F9E06032669C0F96C8FA14393654F4067CFED3632B42FA3771017B68A
+0
+EF01DA4F9A7870BA053CAC654E4F0DA8477A41A9A6A1B96EC566E55A414EE0611DFAC05F61CE63BDBD3DFD8BB1949CB2
+334CDF0B181E57C8ED1623D554B65A2011609E04631F545C71E2FB8CB16E71B6E1B291166158AE4448587A779498252E
+0
+01F1323817D4318AE9FA1372054CB6624EF4FF4DA61C07F6878B796A4894036372DBDE3F65A95561AED8B344E3BCCA51
+698C886FA1E0DD7633F6B57A26C36413DF05D065C18F28884B477FDBB2667CEF90DA1CF94B0782486E1B04942E94A97D
+0
+AA6D9A96C85FFDD5992305C4A78C7EC6CB9213DC6FFBED44E21F0AC46B1455420089429D44C8C0527C3F30BFC56E0BDD
+56298225505DF02DF5CB76E6A0465C7EFBBF0ADF5C3E1765BCCBD53980E7903E7463B0203C427C0C066B513AF06FBCEB
+0
+0F0E8E8029A442C55A768504B06B193FC438D1D6A60B6E7F7A1101ABC25C0DB52041D0B420C527821CCDBFAA1C0AF41A
+A614EFEC1775C4AA362BF3C994F53BE4C28D98F4AC43C164C2AC708DCBD227F380AC5648F07A589BED1BCE46078F8C00
+0
+B3C61253790D541DB72111C35D44D12CC2BF62DDF2D751761CEB8D7FD8E19FDEC61E80F0BE312E1165A26867F79CC547
+A2E0F8474751D8401EC72FAC5E7176383314F43E4C219CA4665C9B7E59C94AFB04DCD3E8570BB7499C6508CED2C38B53
+0
+F3D282B93DE3A090675DD767D9C6D0E9C44DAF0D443B8B8315EE9E5EA86BDC9D9BD787CC36B355A90F70672B938B3A69
+F461AE30DDB1076C38F2C72D71EA4DA16BA4E4251532B2563DF8ED43D3DCFFE2CC1E60E729969AAABBA629E800155558
+0
+0A191FF6D34B5BFAFF217A313383933165CF5CDC6E0B890B30BC98C1E3B0C311A53C2608B6318DCDF8CDD3F560A6983F
+821150ECA62CEF8303E3B608237C2EB496B3D9050E4A2D4D0B672374AE941B8A5B2C11F422475B897B85C5EA9E501EA6
+0
+CD6DD9278AE2CA52F9F98ECDA38606EA4435F564451D7CB9F4DAC79904966744587C41D3AA2DCA3B90A403E178FE243C
+3B265D14A4C94F97E74B2ECD4B52199B04AEE3C0092590B1D60ED66FD2AEC2A1565BDED579B9CBB8A1C166A0145ED43A
+0
+131836656B179578470B398E3942C69E12689FA9C0D0FAA651987119E566391F3BAEB28E6AC2D3C2D544FB4A7EB59103
+81A6C14E995BB14D6FBE8BE68CA4A154EC16D4234CB3B2BE844F104195963C96F6262B17951DE4A9B0A77111217D6B64
+0
+1291DC9FF8CD982AEEEFB2A4792A1CD6FF0713FA70527989B4362358995996F251DAE515406B84D5DF268D77F5E9252C
+8CD3378203860B0BC9E3F9F21B2837B55DEF02A3B93E9F6146B83EE1688C03D014DC56AAA23C6506454C826E01F371E2
+0
+238D65C411761925DB886DC21693856B143F4532C8476456E59CAC13A5D8B5040F3634E974866DAB3390CB81A8227EF8
+42219ED0607BE74D161C845C39DC8C5F8470EC06A95203C1AACC2AD29226E3D70B72510BEEEC6DBE454180398F737380
+0
+eccp_batch_double 817
+8
+FF6727AABABB037B389779B0A8DFCA70A463E7BD52A421B6ED1FC27B342441F1CA61B54D8D79595950280BA2F4C7CA67
+C362EBCFA92611A7104FA44A764AB3749A0BB67BBE1B59964AC9158CFF6734DD37F58DD00A7B1B3C9330EFB775CCF7E8
+0
+962BC187C05EE1670B3E96DFA14398E5C7ABA253A70DD4B87BA448E340F0F46BA1A9ADF50CEC2D84F4808574E2135449
+A3ADD51437F917658AC096B6F12A07D2A28061E3FE7E21B87D008360E9106EDF757079A839F387712D6222637811F3E8
+0
+8E80EC14E38EA696910671EF82F863BF5F0C22F09D097EDA94A659138270F4716E79C7CDD07B3787F60A464A1652BE0D
+A7D04A27755933F7612E366AA26E6B7637A374A32D4E2D90D3DDEBB1DD3D01E282AED21E4F335ADD86E08215BA3D3E20
+0
+389084C091C36F86619E068B8AA836E5B590104AA8A33123E872F90FAF420AC4D8C4C951ACCB78900DFE528814C6B612
+F9875972C7CAAC3CFDDDDCA02E48853790A1AB97FB1D88AFB04F322E37B474B75DA51260135671655FBD610C6F528EB8
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+824C3555E00DF91C71C3A488C34B770C12C1BDE4E104085445302345EF4F0E58A18D17C9A1BDDC289671478D905A51CB
+A2675374F99D80781EE32907941CA3CFEC52A7B581755C85D7C474910061E48FADE514DD1D77AE2C369F9FFA49ED11A1
+0
+CB75C51BCA8B4B567744400C69457DB57A17A40F8558A96002743647D8F39B24D2456413FA4163F66F3A4A2194C583AE
+E9E142FEF2FD721C2F2E3CA4FBE89AF1DFDB6DCF41C3B821E5F04BA8D566CB964F88FEE7334B505DA4E32B590F4BD3C9
+0
+D9CCD28BE5BCBD2EE9D0659C1EB01D5D5A991E3866B4C02D7B0FDB2DAD008EB8B8FB83AFE50BF3F2CC18E77005AD6EF6
+0366F00CD734838AD59201AE6D440B09CF2A2438FBFE290DF867133DF1A74F61E0E91F5908DFBCEAA3EFD4610ED4E8D1
+0
+AA025D6E67095950BF2C2908E9E3FE3B983663DB68602165ECC830FFF4BE4372C7650F8CAEF5081C8D71B396CFAB8522
+EB52BD64A9109DCDC6B319E078DDC198FF74D172E4465AED6B1D8C848D47802D7BE54D2EBCBB4278FF896D0C3C1A333A
+0
+283F985B15ED9DB19E4D5AE49DE7CC90719AEC2F68A48DB5A5FFB535864747A688E7B34E1C535102589BAA66A4196CB3
+AD327990DD197C6A286DDCEB0E3AAC7BEE6CDA2B6C1DD9EFB8A9F106F16AF01686164F02BB133BD3F6451A5776709A29
+0
+5B34A201881C55452F8CBE189C20933E4B468289552EF2946B45D1DE62E5684C3F91BF18BAD2B512D55A0B8ED1C800EF
+6F0ECE5681EED2AB300BB3F3D3CDC8A52038A6E6E312384BA74FBE4FDFEB742FB3B1F859393D46D3F4379DC6DBFB9174
+0
+17B819A330765C0B35A3099AE7E8023039BA7FB1AC6AF7C165CA1139AA0FC3F0749EC16357347FC66DEC8F7A5FB059BD
+1538B7910B7DC5E4D0B77528F8EF1BCCB29AE219DFC0B151B5966DCD48C34F4864561C61BD6653A9FD17B38CA7F9DFB0
+0
+C48CA646B7E0F09AD2DB38230F04A2E6E8EB868A7B1B2A5B623D6DC7C3099303858CD0A433074E472DFCBCB0A63E656D
+279D0C1842FD9781F847676A4510EFE00A443E3D647599E62A33F9ED9ED7C3CD42AC34512A582C97503FE03208BF9677
+0
+5005D52EA3F5174D5379532E635D529846E6AEBCC584AC8B1040AB621703D705DBAC29B1409254E63F72AED7418FC353
+7E5BF503ADA0E8CBD1723F37FD9D3E9C5C25C7E311D0FD67C413FBC15CE1B4B612D3D875494F77A97516BA77C621BC9B
+0
+1A92B1955EC7AD0450159A0E59A4D241D47A465812FEB69439232F59BFCDEB3C736DDC55C8FAEC80F855EB037639C406
+B60F9445919B6A2BDFD01CF3EE3B91DA2B8AC4EC3CE412534674AAE5E447ECDADA1DC3B632EFA7873F1877396701350D
+0
+eccp_batch_negate 818
+8
+72AD5185DF40CD40BA27663F0B917954E7D400C9C7C079D159649E027B65D872ADDD7F392EDBFBE77B62EA5D0086A34F
+5138A3D3957F271529F6F8337C92E8D7FD8C0A2563CE56F93DCE242C22119ED738ACFA0EADA48701393C3CCB5627A34E
+0
+72AD5185DF40CD40BA27663F0B917954E7D400C9C7C079D159649E027B65D872ADDD7F392EDBFBE77B62EA5D0086A34F
+AEC75C2C6A80D8EAD60907CC836D17280273F5DA9C31A906C231DBD3DDEE6127C75305F0525B78FEC6C3C335A9D85CB1
+0
+C8109A332D0A7948A508D74F7B90A70CAE7C0792B14B4485284CD49F914328E0476618E95245AB35AFD12835D5A7141C
+59992A0D72718917507014ED59BD6CF62BF912748E35FA250F60AD1C069F2F20CA30A2D14C0CF307153884C57E5E1233
+0
+C8109A332D0A7948A508D74F7B90A70CAE7C0792B14B4485284CD49F914328E0476618E95245AB35AFD12835D5A7141C
+A666D5F28D8E76E8AF8FEB12A6429309D406ED8B71CA05DAF09F52E3F960D0DE35CF5D2DB3F30CF8EAC77B3B81A1EDCC
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+F54724007643133392487F32056A4FEDD7BD67F3CA45BCCE9FE0BAF230FFCB4D4FDFBE0D2CED32FB738CF6BE833936E3
+0E979A33F4418E3AFB2739526D1E6CEA6D3C2CFE42F424BD124B6017531D6609F965F12BDC3B64839DB2D8439ECC6E01
+0
+F54724007643133392487F32056A4FEDD7BD67F3CA45BCCE9FE0BAF230FFCB4D4FDFBE0D2CED32FB738CF6BE833936E3
+F16865CC0BBE71C504D8C6AD92E1931592C3D301BD0BDB42EDB49FE8ACE299F5069A0ED323C49B7C624D27BD613391FE
+0
+9773348823CEB211808B9D37C89F289F57E6B8160F61DA7851C9CB8B33AE454EF2FBF0132736429D701C4C7210ACB796
+6FF750229F6BA7BED2FEDB4948660A15F732963E5F23F01CFA674871EFBCF97C26B90C1D2F73BC644BFF707942D3BEED
+0
+9773348823CEB211808B9D37C89F289F57E6B8160F61DA7851C9CB8B33AE454EF2FBF0132736429D701C4C7210ACB796
+9008AFDD609458412D0124B6B799F5EA08CD69C1A0DC0FE30598B78E10430682D946F3E1D08C439BB4008F87BD2C4112
+0
+3CC0C7E359789E10753A54C6882E846D035362D36B3BE4DDD4F8E7B1AF985886B9F737E23CA04734BF2747E7D591AC8D
+AE087476A66E833E7C38F513C542C0220910BCC6B80324D8E0890AF454B6B1E6D24A8621BE36B281687B28AC0F2AC2F8
+0
+3CC0C7E359789E10753A54C6882E846D035362D36B3BE4DDD4F8E7B1AF985886B9F737E23CA04734BF2747E7D591AC8D
+51F78B8959917CC183C70AEC3ABD3FDDF6EF433947FCDB271F76F50BAB494E182DB579DD41C94D7E9784D754F0D53D07
+0
+8BE041CA391BEFF219F04518E33617B43B74741645AD1B6CA0B78A50DB776C26C3EF1C75DEA78751036201020EBCFDC8
+59724CE5C03A99B5A75EE6219E911B15EF2C8A6E5F9058E341A76CC44381CCF383020E49CC207E1FCBAC0449947B0144
+0
+8BE041CA391BEFF219F04518E33617B43B74741645AD1B6CA0B78A50DB776C26C3EF1C75DEA78751036201020EBCFDC8
+A68DB31A3FC5664A58A119DE616EE4EA10D37591A06FA71CBE58933BBC7E330B7CFDF1B533DF81E03453FBB76B84FEBB
+0
+5A4999CEAF7CD82F8633EB945522033EDA98684106A32E2F1BA657A75305E9B5AB7DF17B6B6130BFFFE4A53D6924C389
+34632E2660AA20CCF928F682058BBDFC49B2AAB3A0401C66F5C95A13ED70C979B752446178480591568C7E5A474A3090
+0
+5A4999CEAF7CD82F8633EB945522033EDA98684106A32E2F1BA657A75305E9B5AB7DF17B6B6130BFFFE4A53D6924C389
+CB9CD1D99F55DF3306D7097DFA744203B64D554C5FBFE3990A36A5EC128F368548ADBB9D87B7FA6EA97381A6B8B5CF6F
+0
+eccp_fixed_point_multiply 819
+2
+1
+84CB366CF4EA70E29F5A2F74BA0F84033671601860E5E0E5186A20706DD9592EAD2359C4D44070BC7742EC2ADF7CACD1
+D54A38722239B20767CC4B5BB5666B4B69D824FA19380758FEEBE37E28AB38BB08C9AC3CA27904BEABDDDB3F76D5DBE8
+0
+73496E48C6CC36371EA2BFB1E1360C37014CB59647DFE6D81C049429ABEECBC84E9E5E14A2890D0D81EE8062B8B984C4
+3AB9E3B87149E4878272B5B312B4D450F1F1EFC6019B90A976AEC8F7420928603200DF6380CDF28339D73A2852A60763
+D0E9D3FA5AAC70478EEFE8D9A3FB29B110F970CF262B6A0746D5A4E5CB6B27A215C3F9844730AC4E131E3F3A4970D3A8
+0
+eccp_fixed_point_multiply 820
+4
+1
+D5488A8DCE657649D990857201AFDC7C994610F73FA8EFE5248CE750D45BE60CEB60D92A44A3F78F0D99310DE4A0B649
+1B71569ECA60B79183570D7959B50E269D40D4E7EFAD6606AC0F7E01D760C21B088EE808346929ECBE88E7B5F858A810
+0
+5A635791E44654E8FD1A5470E214CA86C1BF034A4C271AB4A81717CAC7CB4978D91B8F09574C4D135786EAFFEFF87CC1
+50627C81C1376211CFE302993CDBB45B1990ADC62031BF467D1841719401769A8E7C7C570837C70F772E84F32047AF97
+0046A0717E2200F2B7D23239079661623B0497E06341D52C5B8171005A6E857F9BA334AB6C488D51684395D6FEB6E0E9
+0
+eccp_fixed_point_multiply 821
+4
+2
+285050463783E8E48C598E475960690B72E3D550A7CAB1BA965778B761797E751140CDF2C31DB9DDAAC368045F5D5DF1
+8FE89ED6CF57D946DC530B57FB74F4ED93D74758BC35CC7CFE25B0DFAC21991A43A65BB1A0D8715B6550C9230F06C586
+0
+F013E5BBF179BA491881B84FDDD3717765235E0B9A0938099ABDCF98DD65507793D67C201974F9AFBC46337910101748
+86013DAE4B373E5270136663F952CA2431AA0C6F8871559E8A98ED987E2758701CA4BF64E948B84091A977B0EDBB5F78
+A38C2847A7CB5F4663A93606B4D0E3640BCB66B8CB5DFF628DEDCC973DDCE24E8462EC5FCFAA68B5A6BA989E00734E06
+0
+eccp_fixed_point_multiply 822
+5
+1
+1B170BD2CAB8F4673516AD3B0621221445498E7A4262F0B775D6EE3D6B3A25105BCE20F8EB13287CED8DC2F85E2534C5
+5EC3145C0BD183D368552436ED9829B91F680E31A43E94C3FCA77F8485F690FDD2389F53D42EF22D9A5F353977A227C3
+0
+3D45F53C0B6BFD2E2F8FC83DBFFDE5AF4D4D3A0AFDF0DA91DBCE358FF6709501A443C5A9763F7C81A31B46B218A5E8DD
+15E9A903B6678E35845ED46FF0C7B8D2A799AE390726DF55C5CC6AEC9D36F9F4D22ADF043453149202FB91DA2BC522A3
+2F19E8D813B8112C76D36A3581495E7DC0BCDDBF96766901DB81F6D91D8B919334DF8F19B8022609E7CB6E7925B21F18
+0
+eccp_fixed_point_multiply 823
+3
+4
+14B82C8F7040DEB2A67D3EE8D3531BE368723C1D20DA33EA64E8325398D410B16A06834A05CEE689AEE53E2221635823
+C441AFB679DDACA3E402B86E718018132E7139F616550A28CFA7B4F8F25E0008287D7C560020712EA00B406373C26945
+0
+8EFD99E3B3B9154112973C9E3298C04AB5C2441A396BAD64EADC9F792FF3E3FB6033B4687589BECBC6A17B2B1C1D822B
+206B640726223F45D3B1AF46A2002AA5C14E0754E30ED532C44E3C30A44CABA32E1AFAE5CD7AA186A0EF73139661D8A8
+B5C3D65C5643C068EC2AB32B3FCD08EE34531F5E3D4322B6C3CFC30BF78DC4F7981D49ACCCBBA16B4A67330AEBEDA058
+0
+eccp_fixed_point_multiply 824
+6
+2
+696920FE125FF37C29337DA4BE8274E2B818E20079C1827EAD8D8EF440550003877482229B9AA9536847E30B4965162C
+782CDAE237B2620689B888CFBC44B6C2297D855BFAA913DE24AB879E15FA4AA294E6C998072DDC84E697011AE261CD23
+0
+4D8F13E5DC48F8A18FECFFF52AEC7F00CB3C78A67091F459DC15F4F2DABBC60BF94929B75EC25CB24E53F8EA82F89B33
+08813BB31395A27CB292B71A74538504ACAE302A14A6919D7B29E99D08A30E15B0EA735D8AF940DE9E661DAB6C1F5EC3
+C088E3DC4E9D6B48D57FE6B710B30B486EC6E2C085FA5BFA60B22C4D27065ED8AF98F222CB865FB76C5F6FEFB45B6321
+0
+eccp_affine_points_validate_batch 825
+1
+2E59BF5377DF4B66AFD99CD167A764C14AF2C9590182E7C576B395F11A0B58D62F7E7E5E8DF50813620AD630C494DD05
+0192BF80BF8FCCA3D42DF2F7ABFCE58E59148064097990283FEFCD624D93095EDD774F81C1DECDD8D8EC8FB62D30AB72
+0
+1
+1
+eccp_affine_points_validate_batch 826
+7
+70D87F77063557F9459F887A8083D0DB0FAFAD202B6B95B24B89EF4876599B4BA140F9B08FD3BB9C0EF55A670C69313F
+931F8D6C9FE6C4351F0C6FFE3ACC836516F57F7669D80B169798C1E8BE7263272EB6CA72F4A1D4EAD0F19824715947C9
+0
+1
+B6337AEBEDF2BF14E68A46C4CCE14C43C8E8CB6FD67EF3CCD53066248C9A94B1F59A1F643B4EDC3E3F3310A6A511EEAA
+44CD542EFF06B215D8596B907D75175B284242D6E0082FEF246EE68403D0661E2291650451265AE46131629CE674C7E2
+0
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFF
+BBAFB34A5FE389B24936C7140C01A1F9B7ADEEFE1D6FCAF9A16E1A28C4C7FCA50F4F6F310928AF09C5E23229B5C2AC55
+0
+0
+A9E6CDA8CE6475365A8C78F09C559477808118722E8609F7DD62E5F0CFF27BFDF0331E46E20B02332086AAF178CBB32C
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFF
+0
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0
+0
+A39B1F65BA5A2EAC560EA598A90488DE61F381F68CE1591F0909BB80A09339979B49CD1BFFD2F41A98DF4E4592229A27
+DC7ECC1455ECE3B90B85187CB2502F70B6E10A5B2C40FBF28304BCE2FBC5081071A40C81F592CE4F2BB0E1785A7CE9C9
+0
+1
+2
+eccp_affine_points_validate_batch 827
+20
+98CB96A46EB3F24412D04E99843D1BFA3794A3E7F7CEDDC78FB026875043D455D5C59547AC03AECE82C137D201D80530
+0C12EFCEC3D1CA335C9D9A16C32A3670FCD26A7CE5C5EC749C30903AC6A435E601AA0109F83DB91CF537F957BB5900F8
+0
+1
+62284B2A656C1B75585C969EA12024B14FCD51216A94D1115A8905BF94DE4E8DE37D11EC6E7327C6F35BD81E9EA79774
+E513334326E0C355CB68334CD0C765A63DBB9F0A1A8A601289F45D676381297D7CC0A28363F84B81251348132EA811B1
+0
+1
+B9D417730A85F7CB8C925DDF6D0FEF9ED1624363CF895F84E778864716BED24160C7C8B279D441E1820C32C8B1F396AF
+B24D107C9B47033F180AA300F105FC54658C0326F14A937D68680AA1B959E598B125ADBFEE8B771323EB843F4E410BB5
+0
+1
+D116AA044DCC56F937FAE36630BF81469369118A71FDB350F47F4A32B50F4A8E7B31FC1AA53E7A499108493CEBB89E90
+DE7340FEEC65304A2FA57269F03228865F984C4F18F958E466E8A2CBC2DB5FB683A1CE8EC28740D89D692FFBE2BF8B9A
+0
+1
+21C188D3962275FE273FCABBDEC6E25AD16E7D2294367210146A1EFE2109461904FD04D9B069B093CF598629DB235969
+873B254DF6E7FF910A44082E0555633C82BCBF01157AF90CD6BE96D10F6AE1A2B75D1287DA1D5306B66C86127423ADEB
+0
+1
+85FDF6F244DF24FF42DED9A194753452CDE164C1201C707EB9BDCE21342030759B46643F03E6C44C4352869F02C0E96F
+24C6C73B55B6808988BB4AAF1C8111B1BF540CFE3944D65EFC412E6497CEB1138BBCAD0C846A60DA570E3B1CB68A9D36
+0
+1
+80633FDE584297BB4F3903E36257B371C5BC07BC091CE80A0837DD583BC4E87B9F4BE64E70F8EC65BC973BF44F304D65
+2385DA99DCADC60607B561FB2A1559D8D0B1D83A3C4B65229CEC3A97575C33376BE80040005B46C453139D7C1B1E3C77
+0
+1
+CCEB7422070F7F9AB25E385D5C6C96B4AE7DD62FA3F9EA24C3C9569FF853AA68ABF7C577AFD7E2E95F9F4FC8F97AFBFB
+E371C7075B23BFE3A26C5125A74FC39D0A582BD85F4A43BFA0B74778E38F0EC2D5D065A8E8B9435A513FECC40B4825D6
+0
+1
+5DF2E6FA309C7AB394600D4983F385632FCDB08050127C1F4E3CB994737FCF19B59030019755A9CD9C0F0F05A5C60CF5
+0910F2F3762AC9B2BACD6205E01E9A2B0928A9CAD97282DF8EEE79B8619CD8BEF32959FAB87348B09E9C4FAE3887A0A6
+0
+1
+BD87DC433B602A4FBCB196F116A96F835EA8E7AC873C86FD7285FF7F76A5B1C68F4A27DF55F4C23E0655A4410A26FB0C
+3B0C0A090CA91019F0E483A44EBABAFBA16517B1D8CCFE1B30F8E1643BA12A74A2FA8A070B8F7239F8CF7FF682C7098C
+0
+1
+3C71AA1745F35071331F6BC94DA7EDD0EDD679B72FA01B796E91FEDF9B635E0EA230928B962D61F13756286ADF8FD2FE
+451C1EA6E4976A3D97271CC02012CB40E08894FA5004617F684FA26E835A3C3786BE8F6A4B8EA78C22B0C56ADC52F64A
+0
+1
+4933FBB1071451AB3A87997167873E4F611CFB814CE862CD594F31C567075D47BF55E7DC7EF876042689E8238DF2A829
+94BB49CAC6F9A2DB1448FFB9320AB7563E509749381BC0B708111124C6756DC51640E046E2DCCCC8E531EA6A697E62C6
+0
+1
+1180E7B8524FD7E05D215EFD477D312D6CE7863FAAEABC6F1410BECDC5146A505D4E3092757B9FAC7020EE1F6B086A2E
+AD54AC6D5828089DA23C43E612131327E72C9DC38A95AC48956196AC05AFC578C04FBC232BB388BD0E429FA2D02D7823
+0
+1
+F307F9545DA8AB4B7E2C3CDBB562E4B89C9F8011B913F5AA7A0A1224527E52F95114579F13E61207C22DBFE3CC35BEAD
+0C5E5D54E56451A574E3DBF123CA7F5D01442AF50D070338884CF6B4DF8504E3110F267C19E6549E8345D25324427BD2
+0
+1
+58C3D1BD190E7C9C87D8F135002FD7564326F81D0980F1016048F423A9DCB3A7567650E85B3A71268F223EF5DAD2CB6D
+362E57ECE291E7435A68D3CCA2B081FBD9A85B41CC4C4E2128A715EA18FEAB1068BF55904655CE53AF5EBDE2117C5E96
+0
+1
+7312AE815560E5D366342E532FAC821B09004D4195E6E6FE899955B701ED00989E97030F1EF77A1E34931FB2CA1EA6E4
+4B777454E2564FFD98D644D6701C51B54A1B3914257EDC8B28EF1B8A881EC579057A84D9FADD33D1A8C127184E980D5B
+0
+0
+7541AD69EFF29230715A4B069398A56D6E142C062B0C572FD54F0DD532DDEC2FD05FD6F90AB1A784393D074219D379B3
+21F4F283061453AEFA5BD6DAFC74172DB85743B46746F4F792D98614AC963BA3AA616D12A8DEDEE7715C69ABE6E5E1B6
+0
+1
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFF
+94B24E346EB34670AD0657C77698450709F2E3B5A69575B0C939324A6F61BE7986D64D75FB45A79697E722BAF4A0B12F
+0
+0
+634863B4BC7F51B8B288F2A9E97B40FACBF31E91A642119DF8F4EF72730179604FF28B88CAE65289B96AA849C039ABF7
+CC18CF0920BEDC0D3A8A3B5F7E7D1BC1F6C498181F9D5492E4EE64844502F3B5B482B8404CCB5B66AA8997990173E415
+0
+1
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0
+17
+eccp_affine_points_validate_batch 828
+40
+C4D27B8B356817CEC4245BA0F649ACA826CACEB07DDCE9E195DCD7EFBD447400B253BFEC34DB0DDE7EF8860BA7D6DEA3
+0A6C3A560C56175B8E6DF43A4B73AE995F6059B3B1D3CA858BFA80A39223229822E8875ABCC2D146B4BE2FE7D1F5F407
+0
+1
+218F77C6C9F83B70953B1EBFE42B89F825A79416F9F42E53AA524DAA442CD929B7DD0A96FFDAFF592ED09E8E508EAF86
+413245FC40E6BDADB4DB2AEB1897CF29EC39017166C8D522FCB311AEDDB076B55180D7AE2B5CF76C372D191B2184C670
+0
+1
+8EE2A27F98369FC73B42B33C8B176EE86E5E86F2ACB533C343DBC7751863A7E12956EB1ACAA809C0874E77EA1E058835
+D466F3C5CEE9F6D0FF858A5A8E1956281EF036352EE2119E894D705D5D9373325BF0EDECDCCF04EE83DEB711ECB1B53F
+0
+1
+413F965602BB5B6FF3381193F345C75F08C8B1EAB18D784606D1B11ED3DD3D6975B58AFD2724F4F6DB15E337422DFEFD
+952373A86479C15AC2B567BF4285DB5AA87295A97E81E84C16858CAFECA40E4A7B7F6B51FBC873B8B472E1EF90C036BD
+0
+1
+C4A8DAA50BA51E6C0CF1CBDF27ACEC24CE0D66CAD153817C98AAC6D42E65423BE21A7B020A68889960A46181767EA03D
+BD8140A4DBFFDE193724252BB00A4D7FF5A3FB9ACDCDE6C59524B01F2E08BF297FAA2075E558860F5303BCE27C8ADC70
+0
+1
+023371F8C0BC3DAD45423A276A1D7D7B9C9463DED3F84736B33BA453CD41D08847772ADABCD92F614E5650EA345FE903
+CCDB9B7C07B4A2383304269331C2A54AAC5DF0D5E30D85E212D84E7FC263AA1197149C60E07742784BE9A9F43CFE4A21
+0
+1
+F54D65C1A251D883580924A69465BC9ECC8CB76485F57A92E29F213362F09044F5E56B47E0B7E0CDC6E9C61C11BCA1B0
+78D868F5CACA95DE5C00BC003205A5262D09AC814BA556846EBAF79D899B1C2F585B29A871B282B45FFBCC83F6FFF36D
+0
+1
+E1F65F37C8251E2EF3A649F429578F6552D68CCFB4A1A4CF71DD00623515D5E6A822D61957D112E2FEA363D54A751DC0
+1D38EFDBFF72D280DECEE0DF2B4B4F4A1C59B37D2AD8FFB43EE13F94970B94E8933FC1070AF20ED560FD61C49CB54F05
+0
+1
+E533E01E417B0F203377C551505C75BCCD81435BD504C3E022073EC4B298754C478CDCD72E74111BF6D9E3DE4955B4E6
+E4D9AA96029E664AC50A71D04A576A312087E191B23D400C4462E86FEC48B0D8ABB6A0EAC50EE60143CF56E4E292101B
+0
+1
+30C8ADDE10CA2DC1EC17FB5E047A59127378127E7EAC697A00B97A73E38EAFEC905082F2E826C94CFEF5134F9D19FE58
+D9668E0D7711C58097679BA11D5DD8276EFAB8DB1C93EB4FDE9A576F02C5BD1A70DC2602B05F7F2D2DF8A0C69771F53F
+0
+1
+6C11AA60E48ECCAF0222DDDCC58BCBFC5ECA493522014999DC10E0E4C76BEC821ABF6EEE4CAD5FD540B44AB38CB66BC7
+0214EEF34E058615E2D6A77AC542BABF6E58A0932172A14E1CECFF9BB0C9887C94D6C14894B6AD2CA3D36E26FB8299CE
+0
+1
+9FE08102F22949E02D7A8C55641F1B24D50C3407D40D7C9FE7613F763FFDD6347A6A1B9298A32B7A1AB64496C4DF208A
+4115C0F6E35317A6562F08ADA023C434B0FFBDC8DF7EFF753AA31AB1F1867C82D6776C106AE32D5ED75C34F2D8E8B87F
+0
+1
+C7D2FD64B4CD659295742E40D5AAC7440A65516FDD238B3CE9560A9039894D0A76176E9DB26B5D1D3CC0846E5243604F
+8471CB04D3E842457AF54A5BC02A03B52ED8BDA7AF7261130EA2CEEA55B6E4DD0B0AE92E786BD74FE1ED16D488BB7A64
+0
+1
+DE0E128202E3700B1D1EC395B7918DEFF4BDEAB1B60C499D265DEF3C3EB29ED493E11991A6BBA9A6F48F94020AE04BBC
+017168C2E72048D3841C5BD03DA3D23DD3E2A07E21ED64553C01130163C53D846CB28136B231E02939F51FD4A06C6CB3
+0
+1
+BB749A2383909BE68D365163EBC168D6CFFE8ED65DA41DFD28A5809D14A3BF259A66DEDCC4B582D940F521E939AC1CD5
+0074BA439281D184273D58506D8BDFE4D5A12A7D3EF06F532A61665062CAA53C289FC7CE954B8B51BD3E93BB5513D1C4
+0
+1
+F99028210D33C51FF084B4E30F67E0B52A2693112DA60EFA58F19106F03D24876125A09497711A130ED2E4CF6DA00A68
+3037A0413EEAC1B3DFE51303D261844F7E84341E558DE779B6677A82D121ECBEE1E65B9DC80DF589BA594987129192A6
+0
+1
+B1361E82B22554B5BF2D784D621DB512829024490893FD920A73F74819346BD57F3C281CA6389E8A9B263D0DE52FDE44
+8EC37B4E489B694965D676A7E747D9B8C34AD7F11DFEF79D862ED9F3A99163C69418924FA48B7CE1A64C9AABF0523F71
+0
+1
+D3F784878FD0C60243090A4FB39CFC74261BD4F74462ED28F060E558CE61B7B62EC8498A4C4DB01A1FC5FBD9EB2F9179
+F724849E6C87D35E4F107E9B58CB3068F55BEC89EE46DEBC78BA69F883FCB331FED19C22FB940724C4D14EDCDFC92344
+0
+1
+348B446A0D17A2B025AAEF9426A3ABDAF476628FAF2D2485690597E9AF6AAB9C3AC1197BEE8F66CEE20C6B3BA837AF39
+4E7B554845A94A36A9AF2A705447BA2F9E9A9CC1EDEFC0AC66133544758F9A8FFFF721D12E77642C37B87BC57D341F0F
+0
+1
+E66BD4FFAA95F220F1A36B16C67BDB5D65DA11C2E5F6CCB170E0EBAD15C2EDF2495C2A1E4E1C9BE36DB42C5147F33451
+031852074C177F981DCCC41D69EC5B7BDD1626B872FD6918C59B5230D0B6283A69138ADD2EFB432FE8153461B9EE0699
+0
+1
+16F13BEB3DB56736B3EE6345ECEEB53EC70740CC96BC579308C0319A41D137BF7D20F5FC212B97E263C7B24107E531B3
+9A16842A7AB7841FC3D012DD9E66B6BEF7A32FA1B0CB6B22A4298FC1D44B3C86EA5F4A25404FC2EED2CA6E9F22B36A00
+0
+1
+AA297BFBA06152770E77D9909133F9538441471F1F5A03772F8EF1E5E061A243D4DC9AA6B0BFBCBF4BF78157FB69205A
+8A7C62ED0760789A83D47D0555048C0C73A2729DAE6D1ED17739E623F218D42A7A9061587E04A4660645A29DA862DA88
+0
+1
+4FC28E1769311F82D755C6294AD0DE9CF328AE900F7EF6196CF6144D92668D343FE0F1BBBFD7B87C4D095930BF6BD25E
+02603A24056E6A6D83FA491097763CF153B4B9DF8E1C3A7F087A151A223987E8D90F32F604EA6A650C37A5626460819C
+0
+1
+2AEA6480A0235C6062415F1FCBEC9A096276119F90373C6D03FD3D2868E640BB26B8D383BDB9938F964085443BFDCF3B
+36FAAFE5C9A7C8CEBF2428A1E5F740945A3CF9FE132F91C289695A021EBA0747DAD2CC99F5924C7B9A1673F7375038DB
+0
+1
+0628A82EF0FB822D82A3EFCEF1697290D4F93CB89D0DC75941BCE47A702F17EF59663D13642157B6D59007CBD9238C56
+DAB1143780F067EBD1DD7A09BBEF94611E378D1B39734F82B766F6CAA0AC1F61BE02D0F00F020D8260E140278A45E3AF
+0
+1
+B1C41603A97EE1CC1F88BE838FBAB3B8B4181E89830A746DA0AFCC9C30A1A15D6ACA5DBFEBE77DB24CE2209A93862602
+6FECAE03B4B3F3A3F231AB88F294A948FDB0081CADE9C7C0CF1FFB338C3FA5DEA4E25122B9B3232D7C25B638DEEABFB1
+0
+1
+4CB50F6B0D2ADB8FB59C8F0F030A164434085EED80A422F65A5244DFCCBED7D54897492D07EF1C96D3E569CF67F988F3
+3AF2DC4EA032F127EC9C6F10B2E5A98131ACD86664924522C5E48409A9A7DD86CDF4B56BB78E70E6713293FA1526B552
+0
+1
+4C1C57B08F2987FD5A5AF8813C3A17707630680B6A6BFB040CA49DD0BE7CBD72BDE19A53790101D7F9E779C87FCF8449
+44BC8BDD651C6AD535F0CD420FB2815BE4C4936E33980CE07CCFEFC0675BD7AE4EE325531C0105019E90FC0812DC9BFD
+0
+1
+AE6509FC2A6EC179FFD7DA33CF6F41F80B29053887A91493B4724D59137A2209E22EE0DCF13AA4BC7D33F61400D0194A
+AA0B53C4C885EA5B9B2D5EA8E132011FCDBA40E93EBA7ED26133C0CE50EA27754640E792D7354996CDED7B27731D17A2
+0
+1
+7439859695395D4F818235F91B91665582B97CA22BF99BE6A87EA8989AA77E23083D8C3BB4F9D337A8AAD3FC2313D568
+F7A643844337EF25B39ACF833EED4DC810D25D7308E68FD4174C5B533707B045BA3E5A212356A30A3D2A0F1B74F351D0
+0
+1
+4C467649AAC3DF9B033E2FD647E2774C229E9BA236F285AA3CF476E2AB4D40C078E9AD4FF85E4BA5008E66DF26D7240B
+FB9007B179823EB2BCEDC5425DBA80B1913902B3F37911B69092C068EBC7494AAC634A0C7BCC150CBDC7DF0367BF8E14
+0
+1
+863D5A35D72BFEB25A382411DD2C857D9E46A1B8D733E4FF6AB6BD1716EC01DDEB6ECBC7EEA555F840CC0FF651448505
+997F1E825BCEDA410B72B1FF3362F1F0738A438ADC9FEA4170FAB66ED7FD2884730FD1472F5CFF7C705817A7918FD8AF
+0
+1
+1276195FA25A0AA914D937CC4F862C45A3B418FEDC9D89B6BA4B29811BA462AA7293058E2EEE0480DF62AA0579BE0718
+DA29825EC50684CBEB6AD43C1EFF7FC1223C2A2B8EA203911DF196111622287B6E7418EAAD135A7E0DAB3656BF210361
+0
+1
+70166893592BDA7F42FA7A8275ABADD59FD9C4830CBAA435BD6BEF07098BA28B54C9E36840B99BA974D59577922F7AB9
+729495927CBA3CD8FF1668E5CD7A1B12801DE4961C88204243E1B282F0FDA26B72F7408AAA5048600AC0F64AD0112121
+0
+1
+26F1ECF48583CE2AB19909E52C0F1796354D3291B5E094A0E97DC5DC73C3E8B42F69259E529A1FD74A502B7C4787C960
+ED06E0DA791BBEE2D1F0DE459A49ABF47548508F45607E6E9469DFBBD33D31A2D42B8BE8FBD531577DCE2B35E3B0A50F
+0
+1
+1C9D67CD090FE373C7D1725E61FF35A93E64C983F904069934BFCBA498C280E3FC3C295F21147BC06A909B866C96A151
+70D6B28D64FCCE9C40DA4D4977E746742EDA9318BD40486E806B9C0C6ECD35388B03FAC652F4AAF201D3C038D0053CB0
+0
+1
+80B8E7C49F386343FFD46B020A416E452FB1F3ECFBC8F92290699BF767C519B48CF46AB0AF9A436DED9A277480864FDD
+747306E5BA122C1F7E8EF312219751A071BC6BE83D1115F82565E6F6BBC39E152659E3D62D11F65F252F0EEDD6EDCCE4
+0
+1
+854AD5D60BB1D9AC3B081EC3832E8B6C9234C7CD6A3695558C3C5229059B7E4EF2DFD5DE7F7DFC1BB3B25D0FAEE0D67F
+AFAD9860E2451E3381C07FB9853A7D3712092C1496DE7A9D8CDAD03142FC6B80D8E00688BCCA3A4A083F467603850874
+0
+1
+D1177B65A3A257C6BDA29FC2B97A323291877F5F157DAD54DCAF8290FF0B06F2DE435CEEA0DD95E7DE91F34071CCDBCA
+1419198C10D7EA548E77218EB07C301233EC95990ACB4029DC71F2D97560129E2B1DF504E744D3F2CD7A7D7AFBEE6C01
+0
+1
+9967B5B9C5E22E9D2DFBAB295EA4F9FBC26D568BFB7226B2CB0120495334EB5A9A539555C4D3FEA732D622D360692D38
+FE628AA3112BC331CBD96C21FD98FAA8AC57D7C49642BFB0BBC4102EF60F4E1937C679F13AEFD1F058EA6C06C3FAAAFB
+0
+1
+40
 exit
@@ -3455,4 +3455,1577 @@ CE70DF11EE06835C5240F7393D370CDA92698664098B03F6499D2D7AFEE3560148D2923AF0DDBA78
 9000DF019A1AB9EE6A273D351951272B534DB8677AAB8B976D3CB84E2182CD6BB6DF7B290F371EA5E13B1365448AE997
 95EC5D8F9D4CD29EF1B1501FF9A1CE1037DCE0F8453E67DD852735CC25383C5EA4897B313E49B5FD43656A5D2DEB1FB2
 0
+ecdh_phase_two_x_only 458
+8B7287A1A5143893CFA86F3953AE81C5A918479E71B801DE716B7D67513ACBACD28DD1FAC779F2EF64469C12A214DCDF
+4C87D508FFEF379B6645D7E50DAB116B5AD42CD4E24870330EA99AC0577FCCA5414FCD2CE4BC83518041D0FADA7DC8BE
+0
+AA35327582C04946D57B75896ED790071BAC01AAE71E12FD520484FA510ACF478499F32E6AE80DD6D2FA84320FFB8BCE
+CC39212DE6BA0911219F1DB82FD839C6C76DA392252CDCED4D22985B6EBEE7A0EAE11E7735E541FD6E06F4325F6536AD
+1
+ecdh_phase_two_x_only 459
+9551BF6059659644D9D2DE030724C324B3589FB3149D9627339083C3D2B5DEBFF293F1D89368BBE229DA52920B44E213
+20A07C3263EA8F278445599A9343727C9D2093FF7A1E79E0BED76523C4FE83783BCC4048F0E67931AEDC7F5A4D88EE7F
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+9551BF6059659644D9D2DE030724C324B3589FB3149D9627339083C3D2B5DEBFF293F1D89368BBE229DA52920B44E213
+1
+ecdh_phase_two_x_only 460
+FE7BD4351D69D8B3857E81470883AFC1F8888E5CC015F78DCFDD4366C39BECDC001BADB430F6E467788D3F5C556F070B
+33A4577946CF40E8FEF9D110C2575847F6B4F3FE853E5594A56BF4C025A5E0AC8F4D0D72FCC119B1142673AFC0D1076E
+0
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+FE7BD4351D69D8B3857E81470883AFC1F8888E5CC015F78DCFDD4366C39BECDC001BADB430F6E467788D3F5C556F070B
+1
+ecdh_phase_two_x_only 461
+CF98A8BC3DCC7AB15FE3213D42A1A61C3B47F86997AE2C1ACA7EB26B05EE4CD3587C558702492591CC32A97A6D402E90
+65734AF106671D2F425C49BE0F888CB75F4625096DCF8F1816DBA8C2F30589817CDA6CF45F0F81B86C620992A9FED5C1
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+68B0081597738337BF2B2D825A03BE0F883912E9659B71DAD7AACA1BAB24F1075801D7F377907A1F1ABE8746AAC9F688
+1
+ecdh_phase_two_x_only 462
+6B4B588BAEC57DF6DD1E73534FD20E21EACAD91FC0DFD078F8D6FC829691A9DA187E623B9AD3535E5FD429ABEC4BE820
+3227E5BB13AF2C7ABC008155B53D4797267A0401A8E321EA87713FA667D8FA652BBE35D9B7EA37BF45C613F0B916875A
+0
+9CECDC35F71E16B2471BC07BB9241C528C9CB7E25643F2182886CBAF3106B5779C1C793FA1F179649CD928BB02FFFEB0
+732B0B84DC87402748B871AAE1FD3DA5AF62121F1B6352029F08545B3CE5AB9DD896828BE42E9FD1E72F10F1FE9F6001
+1
+ecdh_phase_two_x_only 463
+4767397DA234694972ECDE4B8B4A9760423A96BE5BC8B381BE2F5943298C776D8A0605BC65142202DAC4DE070958D406
+C38B0F032114D663D0B836D3FAB7A1D8BFC01BEF1FB0E0A92AB73067C3D6776C75A770717F0FE90F8063F7B8E186435C
+0
+AACE95798CB3F39C2409BBA4C3EEF9B22BE37171E9CAA3900746A61CBE3CADB6118DA9638F55C5F91CB656B415364267
+B1038D93EC963605CC7CE560701EDF46FF29528B297312D69D404A83210CC9C5BB7211C78F7A86BACAFF181D501A40D7
+1
+ecdh_phase_two_x_only 464
+699A0C60DD688F60C99110D52377F40AB5785987B805FC94CEABF0D0BA1C45F90C8EB05D1F78E148F06A64C6F16C383E
+0CF9D27D5CBFE4FC6D0AACF013A290E07ACF21B32B545ECCABD2DCA10E174E7D2DD93B50C56867311CDDE6D906EA1C65
+0
+8BED28F6CD6FBC9D07F83B9E614F51696E620A2EBD8733118E96BB0BE04B255897BAF6F09EE23FE9E782E6C3EFE1F166
+EB91FEABAF94013135273BDE3B186A1A81099BCE84DE9342E371FB548003F467A3DD2AFD587DB9B1F8D9E926BDD98D78
+1
+ecdh_phase_two_x_only 465
+2A65276A417B1787308AB4801CB52969F572D982B64646F6A897A4FC41107EE212A5A93923C373FECD43CB5F704C48CF
+0B9BDE191D6E103CFF8108C61981FAB40172F87195B1205EBF2FD84BAE92F06E95A5B2FE923077A8AFFA3CE0343F8B96
+0
+846D912935E0480DBD34C3755BC9AA73D4BEBA86E480C93F52070673A39D2AC3FA07920B49DE4C50BA3BC84C7F89C48B
+EB67D6BDA60352002200C72D791FC461AC89656F855D741A9182B6934E953EB20E4567A049103194A344BEDA6E70014B
+1
+ecdh_phase_two_x_only 466
+D5839B52254CD1B7D4339AF3F4CCE9F93A0D7D331BEC8E2C2A78DF7AA0B26A25AB204814F0A2757ADD4CFD77CF5DCB6D
+949D1F244933B530919C671EB3897045F285B69701B3D6FCE0181DBCFB86A6727CBC7C9FF7E499DE6C9938C7AEDF5DB4
+0
+65F836838BF9D53E39CD353C358D959519E45DE30BE567982208CF8DCA862C7AF8949A473F65F7C9CA1AF3C7D5013732
+A003302CEA3D77D931D1256D396D928F657CF53E76AB31616EBFF92B227C73D97E6B7E6617710F984A21675BE1C823B2
+1
+ecdh_phase_two_x_only 467
+C05F909505763000738680ECB6CB0479DC3D2E1C78F75389E919E8FC44C3DC12C47023036ECFC36C002CC10634CFC638
+82FE618CF96BAAD45AC4EA048B5463C4B3BA6A4797A046116537A202574DC25CBC36865317A73DF368B085A36AA4AF6C
+0
+1B9D215C3E5A92CDC5ECEC87325D2212461AE45FA80A10852720BCA859D894C9D1019D5433536A0C104537190083107D
+D2429C74EFA0363E79374566F8102E80841E78E609BE119B4BCE0CF1A56F4E4722AB405EB682C608B404E1DD8F4229CD
+1
+ecdh_phase_two_x_only 468
+917760B52C95455EDA5C2B0087FFA610B878982F06CD2520425EFEC78C3567344EDF95A4E9B2275DB3A9AB7505FDEF13
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+0
+D95B0ED84189BFD456FE8D90646D6E678C56978C6DBA6E3F07CE818818CFA3F2B6DDD8679D4FBFDAA8ED64D98F0A1BF2
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0
+ecdh_phase_two_x_only 469
+437A76A5301ED5F15AA068EDF781274BD4FFBEA974BA9AB4B7DEB07D318347280D3B7B9DCF8C883D97993F261E5CD942
+E2D87C2CED89CEC78456B2F262D66EEB3B7E2501EFE154CD9BD22CD7D8D3F4B2B5AFADA9163EF147F9ACB2E494893E5F
+0
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52973
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0
+ecdsa_is_valid 470
+0000000000000000000000000000000000000000000000002799EA69BC7E62F585B33A6BD367E07A63C5E8ADB279A4F9
+1921337CAEB97DFDE66AA4917F0AD4424A3E31B97BD2A2959B0A16CE57DA2DD62B72908D8154506C8A2E85BC469929B7
+AFF33624FB5AB75475AE3D59BB42EC0759E7C100D7834D039026A4B59978C42D15DC981F8BDD3387C6D01406581A2DB6
+35735979A0B8F819D76D0A152CE0F8452AA7EBC68908F4B5A815CA016015EA23D9D0F92A7331178C55707F4E404C5EA3
+D9D177FE76249B13A92113E7D8B9C20878317C25A98AF5E1688BC2DD61FE873BE5006DA6FED6565CC2B2DB0DA08BAC28
+0
+1
+ecdsa_is_valid 471
+0000000000000000000000000000000000000000000000002799EA69BC7E62F585B33A6BD367E07A63C5E8ADB279A4FA
+B24CD9933BEB3BC71A66F6E4759FCF97A6D537F99CC00EFCE24DAC34739B759000EFC6E461497E97CC4D4E63F41BDA14
+3E4051D81B07208374A0C148F4A858FB297FFEBC89949D0AE0D86C5DAC32B8715F4B0764D3A57246CF4C3AF1F3BA2B75
+87909F69F96E0D1FFBE9ADBE96C1176CDE5735A2E5EF3FDF5950BFCCC6D7B357A5FE3A482F5D7A307FAF4F3A050C19C2
+C3ACB63866A3E9BE49EA545E9732877345BE381741E0D82AB575CE93E6E3D079A5B51F93461CA411EF3E5DE47A906D19
+0
+0
+ecdsa_sign_with_pool 472
+08300070733B76938C69B91A4DCF76C84F7EA61FAEC1EB9C76EAC25F204AD4A01C92ABCEE83FB4052CC343DDC01A0CD7
+A0E2F2361B5D410E6DECA61A737FDCE4483EA4CD23526E91335276C8FAF7514CE088A166D17D87DC52C5BE714552DDBA
+D7475DEF173BAA8DCB4EBEAB6234728BD4714F08D79D002F28C43E6249FFD38202523BC6CAF0378D8903F0FA463AEF5B
+54D6CA26A7C540BA24C18BA521B073DFF1BB605E58B95AABA30C4D8E9B664D811E75F9F7DEC355464072B0709F23B752
+0
+1
+ecdsa_sign_with_pool 473
+A4ADCE7F6ABDAF6D6BBA8B279F013C5077463DAE1C6061FD4EBBD5925B9863685C45983D24702FCB5CC5C2426C749A0B
+18DC114D5B5866BD3E1CCC067EFD548D3E8FA66753A55A750DD36769A6BD2AAB144BB15E625BAD6F2BE2F8809282068C
+71419A3CD6DE2569E862BD0EEC3386AB174F39028C71015F5686EC11752D114857A14390ECD88693D1F6C41F5F94D914
+67658751FBAA4FCBF1A479EE46F031AD76823DC81BC51F6E1DD99F145A990B45CB9760315E56937A87590A2FEB16B3CD
+0
+1
+ecdsa_sign_with_pool 474
+BFAAF94C9B04BE8DB727B43A132A6C1A07E559E8AAED97152A6B3C49ECD5FB60FC0A0E6F5AEFAE07B3D3F562C2B40F86
+94B3BA60A19B8E0FF6F1803B9C1F9B97F4EF8B6A87791A0E82D48BEA28048C9617416B72E5BC2FF2664CFFB66B1E3D3B
+F548B03952CA797FDD64AA5CBF659A7BC571904934A62520EDED5CAF09C1F909AA74EEC51BBFA1518F2AB02E59E6A08F
+E9FA2233541DCA441D4038B3145F360DCD1CE86AA6B64B9BE23045B8CDB55929B3E8BFAA9B1D773211B138AAB7042FC3
+0
+1
+ecdsa_sign_with_pool 475
+106AA2016C454EFAA019783A82ADF449053AD2370522ADE99353721287F4394D8987926C7DD8DDE41903FEC1726F8361
+1D9D6A63B56D9049EC9F769AADA1C76625664B08AC7F950AA49B00FEB9C1FE9C124F639EEF6C6B87403239DA84590F76
+EEBB3D16FE5C93F1C491B37BB9590DB01ECE9D14D0096EF8CB68FE2CA4056680323BD9FE8B69E183A45ED0871481C4C7
+3D26E62E7C2577C7200DC914110E69ADC32FCA61F300303DFA08D59F4A2C4AAAE957E4B9B3E813E7B877B68D25C18F4E
+0
+0
+ecdsa_sign_batch 476
+1
+EDF16EA2968599A13178424F108C97589CEBC524099C4A69990DED19883161C1D4FF70A3B063586432F73B6502D16B08
+7B40AC579AA71FD6C0506D4DA9A317B6A49078F4E3284B8BF593DAD1E66B5C568715D7AA2F84D12BBD96A6673EEF8A82
+8B477D9078044988AE2C1FB1248B062610AA3D0219EE4889872BA7A2B4E1A9583E4F7D7283E09CD2B20D3C36701DEE97
+0
+C5F86D5D727EEA9962A5720001600A8F28317E243CBA706FF2B59EAAF3833355D3715EF88E543D43F4CAD347DA7AA697
+1
+ecdsa_sign_batch 477
+5
+A91AE321E0C97E46659EFCE2BCA6C7672797B7240B03DCBCFE77A5EEFADEB51CAB4A707906AEC7C9DDE973FB87BFF6EA
+6953217BC67F004F36FC526072ECC801B095893DDA246876C39D5577411C86C38C9DFEBE9D9D18B113305B51EDBB0622
+AEBA74F7F512149AE60629F7D023AE3728275DB30302C08E7CD9B29CD919C4FB6A830E55CF3B9AD486D1D7B78441AFEC
+0
+C9970CA820B249CFEB82F53CC89D92FE58FA906B9702E5A7E45EA2932938454BD61D88CDEE42A611CE2EA5080111F558
+896B11193A5B87291474A1561C0FA62FDD91E07B5CA4E4D31B670220C3DDA5EB95FCF48945016111E9834B37A7C85C69
+F5E4313F6769C0C504BD02D1E448399EE91A751CDF14FA88BD6B14FAAC16016ACDA8CA54C244031982415B4D4B50F39B
+83F819C25D554660812EDD8CFDC226439D745CC4A6E08C602E3F13B7E169F2E66F3EEF76053527CEE6911835947B9214
+A7D3FDF90D6CF122BC43B36ED209F6B11B8A07FC52CF1E5D7DB31384670C3E76CF99EA7BBD5944D8F8FF3100346909C8
+1
+ecdsa_sign_batch 478
+16
+E2B3110C18B02CC0F3FB73C5CFA79786BBBD66EE4555D7166A78FCED58A74E26B706E90535CC56AAFF928130F22C0735
+CACD6E103B1A01EE07182639F502EF3E9F944BC4386C62CAD887391C4E81B0C83F512C3AB07BB258FBD83C3BD6FF7A77
+1B7D444EAE9CF562206FF966012E35F4E5BBCE189C3FEEB12DA8772C9226004888C45CDA2CB7D4704381E00C50A42C64
+0
+F06A9D40EFF530C74B065505565286772AC8F4920DB4C28A36CA3BEFB693C0AB3204F8934CEEA82189B213BA420E6937
+E5FD931178839342F231AD2B8653E51496A2B2C564BF9C59296C10A9AE306E4C12F381FDBEBDC69496F3E062E41D4390
+42D0285E55EEE857D0A1F6185D8A29CB79A0B2AA10FD6AAD36B5B5DA5F824499934EE10A28A2130CD2FE6691E48A7578
+368ADE751E381D5529BFA08C7B192F964C043CD4CE5EB5B8361CDC4F344AD1F3954E75BD45A633A9207B867129F73962
+525AFFEAC1AFC5B0F0037C1F1A4B3D0007A478215266B475E1431F9B23F06F49C1EDAF7AA716E70C9DC4B391678B730E
+3E701F0B2738751A2F13A72EBDB034D3962652FE8FD56B14798AF5C98F95A76937F4F80ACCD15F711182AE6A7066A22C
+54DD257B7D49611BE06A64D5BE8C4CBE0758B1C3700888F2D410097C87BE7C06D6D3E98AF314C31080753CDC3BA13043
+DDC3BD160BC153B56FD385C2DDA724E1D8FDD0F287BF2EC52FC1B675CDA57C905D17CADDF2BDF809D80360FD366B1EF0
+C319B346F2158C484C6D0C20401D1E106362FC73600B960FA3DF4D3167BE193F992EDEA5D25B105A760945B32EF3B26D
+8103E8CF98EF7F4E21B8A405DBC5009146E5200C7F97E6EA18CA67A58BB99F704986897347ECE3EE9FF35A595796CA1D
+A1BC4E9AB73C8CEDA80E03ED397591C8CC8FE9801CD1BBE92A198B764B0A388E4B1FE99303CF8F3CA4D558C93A22F567
+1DEEF1A8DFAE837E631F51BA3D9BACD5D95A7700F06725D245040BE501A3E81D0629E8228E6B8D309ECD7084EE98532A
+128314684DD257914289B007BA5BE6D58CE36A6D5AF942E2AB306576867B3E0977A89BD4CCD348B44157D149005D82DB
+E1C81463DF72AF4ED5D308E4E2C47E40D057C506C4952F7D6C99023D90559F6DB371E307B6F61F94211440A96EB5BE16
+7209299D6D29F1274732F79A97221604B1F4AD4003E87B337583806B692FC05857500688602159B9AF595080D0E4B7F4
+D19BD1CD0CBA75DFF7D37DC69B6790FA79AA4D63F4E21E959461303F582335D54CC29A1D4B6F1AB0739AAB5846BC0D6E
+1
+ecdsa_sign_batch 479
+37
+A4EAC6DC06F62D9A3D34892EA7FD58E027F4626E48C524D62E1244EC4405EDFED69D616F2284EDD13504FEE34FCE248B
+488367435897E83AE0C5542AA05F8BC418222733421FB5F43A0C2701608706DEE308021AC9BC746FDCE26DF1EB167858
+419C0B7764FF176E372940C660271BE5EDAD27E20F3536A7BB87B85AF9936CA74A2EDED96CC77451A1C04A04EBD8A020
+0
+F00E823DC0064B0F8F563C8DAB75A150FF98BE51E35BDBF3C522D36E82D102146CAA8AC7D98AF164E2ACDB6DC8BF4656
+FCB7646220261AF8465CB56B1A7E279F2DAA07F937946F3D0E00E16CF24653B1B01C5EE6F6250501901D468A0403D1E6
+43A957FBF1C3CA388B37C6BC893AF8D2CB41FF3C350A7F7CA9AD31F3BA2B72C3B98E5DCF8BDA0DADA69BBD4C18576819
+187C129E6A617CA9B2B4AE2DA4D7F6ABFF44787BE2237FF892509D5360D8663B2E62789B2780BFE816ED05AF60713178
+8FBC262E519DD4AB6AB8F28C1A15AA68F2D77CC917EF1EDB19FB2B5C1D45D9FB7D6F68E217AEAA67D6EE745CBEFF67FA
+E7CAD5C28363C62DBD7494DCC53A8A10DB694630BA678883DF53DC37852FD3635CCA81EC52F317812F337414EC4D5886
+3D8859A1FF3C2F0869326697BF1F6DE3026B2F61F8CB1C1418A11A72DA6A27F5E0C95BD410F61907E575F991DE6DBA62
+00E554D1E2BA25A8AE8A7D61EE08CAC6BCE86AE95A559D8D34475E163F11E5169F4E8789E4B12078834AC30B76CF66C1
+42AA1F15B8CE8F1EA8B8CA89563CDF07C56540BE9C5C2493B41A273333C6F417695FE9F8BCB48B1DAEF3C3FC1250D69B
+40C42EEB8C7C4124EB19C6A4053C286E8CB7F2B36B3464DDFE6BC5B658DD18C20F6D552C65DD36E176C8FB6BDFBFE398
+27F2ED84AD637B8EBCEEC060C5A3B00548A1ED04C3495041C92A69C76BD7293042291680B08C019D50BA1F7226FA0EED
+2073ED67F7BA0C376D1CD6DE11477470C0D380057B8FEA496B8E93AFE1EE9394EA8959F9C11E85E9F3D3D94A28FADEA0
+6FEBA1E20123182DA51DC43328CA2EAD9ECF9F0E9DFBB3AF76F6D509994E93957357E714A0A49FBDAB3E373C284620BA
+BD013762EC650E6C5A7CD827C4ABB391E681A6F0D02BAFDC098865D801FAEE91CE0296BE1066DFBE4361A6CEFF54F0BB
+6795E3B25F2D32598243FBAF8506F1C615932D3210723500135FB6EFD4F9D0F728BE9F30D1891105DCEE7129245C0433
+F03895E40AF79B941E13C46365C1AF09CA704D49C4E12157C012B23B9A55D5C78ABCAB14F451CD3DFA038AF9FDC0C644
+6659FF20C6D9EAC6B73E2E59539B0EAC972B8647079315C098972D944AD6D237D6087417FF54E509F8F6F26098ED2923
+2133F43F1349CC1E46767E03C6C8C6EBADFC68D2F1E9E37104F57950D2179846D12ED1EEEDA7F6CFAB2DC6ADCDE0A43D
+A4CC536A8C5D0B378FCDF09F89FE7E749E898D5C273E451C3AFF25E53994BF1174C6A24F88A9EA04FBF9ACA5A7FB0BF2
+E143AECEF55A53DFA6F25EE556966D4F4627CDF7228AED12F7FEF17C6C494DA95B3A96F2A739464915D6ED3601BBD3EA
+95CED97A6C77B18C72E8DE262B2EBA8BF5068C50251CA03D74A5A22AFC3425B83A336846AE1F984A505BB6AEDB7A2DCB
+D2D2BF9AE2309C27E4D6F6E675345CC3404250DC3CAA3BF06B6FB5738277424B23A3C1846D6C4F09857772A8EAABE013
+ACE2CDBEF17E8160A90F21D3C79961D3CD0F77F30B0C71341F5D422BDC0B871506321598670DB2E544C8D8B3CE54879F
+548DAAF83B87E2B2AB4663209CF730A41957999B7E79E42B2B4878B82E3908E25C24498F9F1BE5C38D913B2E4CB562DF
+9C58DBCF59085BEF4C97716A64C37B71A1B3F29EB339F0968EDCA4F7DD64EB7817289A388AF72794A435C2E937C6541A
+8AD9A0DD2F914BDE60E3E273C73122D9FDB2847A3EFEF48796435AA1EA0AC7E7638E229420B76958492FDA34846770F6
+2EDDB1FC4F7898595D45011E8DAFA3A974AD0C5B01FF646A335F7701BF2018ABD2382EFA459476F181824B437E851394
+AD9155105D8BCB4572971242EC4FB3E99DEBFD59086DC1E8B38B60863AAE2114C53FD67A4FFC5C42C97679CFEDAE4C18
+5B47AE0C69AA39C348921B6C324FC373F00BA5CDF769F62DCA9D6BC02539D7D2447812FE0C3A706CBF727BFB70938DB4
+FEF540676A0DA59453CA3C15A7A0D45DF5E9783BF861B75EA8BEC6066109BA4448406717F6DA60D060273B37A66D6946
+688F31EF941E291D0858BAD0B35683A933E9E54D21E9E34DCD0617DF5006D63888BAD306593A606E090DEECC4D40EECC
+361E8CA50D5AAEEDEE677FFAA3A9ECA899DF23AE280B14DB4B5291E37D66F774CC96AA1413631B4F2BBEC4BFDA21C3D5
+B61C964AC0F2798021C2F8DF40AF24F9F30B0B699105C29DE44F8429E18E0A8C1DD6F48D3109DF60CF9C7BC18A05401F
+472E6DA933D53DE45DB77783068D0923C4F1F92BBD9B423F4E794B3C333400815C5AAC45D7FADC268BD9069FA9D15370
+514D4A91BAD37B8ED49C80787FBFC21CBA7CA65845ACEAFE6F2BD844B342E116E1CD46E66629161A9189ADE79455FB06
+CB06C8461117339704651374458B955FEEEDE589897DF6C2EA101793946700C629745D98D6760A8162CDDB62324578EE
+37F7C815C2AE006FFA75BD294B2FFC46116931433183A872285B4A26A6AAB57717B02E8620E75F7C0D97569EDB914DED
+1
+ecdsa_sign_batch 480
+3
+699535AEBB41A53549110DF2B3A9129E07069F97370BC1DD09B9083D23D2C255974614103F6A534147EC490EAAC04D36
+ADCF040A045EBDACD18AC1851DEAE84CEA2251EB2C00F725A294A8BD8335E205E0BC4089207879650BE6B82228C5580C
+4CCA4C023ED6DB60A4FB1031D33658E5CED41B7725E235EB9A8FE90F51312EB31F4C4043A05CBF5B365B426D91502D13
+0
+6C148C6610D3AE819ABF84C2987049BD89169607AC9D60BA11548B32FE6F3EB56DF63BF60B749316EECDA01D6387DB1C
+F2B041061E54D3222E7C0F23A3B3BAF6F362A09851F6E988CEBEF3A39B7B8FB1AB6E9BBD1460195BCA91230497A1F520
+3179FA8837105E28368BA263218D2945231CDC1FC603E27EA572A1B601EF478FAB3B7E17359B3678B4982B5FBBCBFDCB
+0
+ecdsa_recover_public_key 481
+033E39A2525387598EBF7DCEE3DC15EDF1AF0DB2CF366FA2EB1E812218D0B2E5503146AD834BEDFAB68252329A1E15D4
+13D72FBCF8BE2DF7B52E236E2E7415C1324D383EEB077F1176BDFB868B0A63B52DCC6008052A12A6743C9FFB76FE6644
+1D9E2E7EC00A5E9C1507F3DF876AFCDCE2433A6F447728D80AB818C43505158FE10BDFEB897FB9AAA4EEA95044BFF766
+0
+68E650BF33A4828AFF5E891397C360D71A88DA98A74C39B79DCE0E5211F2EFD28EBB485DAA1BC983AC3437CAF65AD53E
+B62641D451F9C06D3361C805F15CCA1B236A06312248B8C6BDFC9F9A34D28403D38AF565693A8A675497E37492EB4A1E
+0
+1
+ecdsa_recover_public_key 482
+F018CF697BDA7C2D900F6CF0B4B479F3E8E018972BDCF4DA1CF09DBF7F35392DFBAFE6BAB550F5D95236CB05F6D6E337
+F17E859B7758914AA8680DD8D23D3F6892D14A089E6EF7F6E643B6F1199C5AC31E6AC3CF44E382A200F9CCB74E7886D8
+48DBAC2319E1EFA9D309D3D1C4AABE1EDB6827167D638CB8E857C8832A913FC6EA16D117EC2A90C6460E256C195171A2
+0
+64C8011827894A4F039D4086C52938A840C0AEDC4175819A330BFDC57C993F2655D95003FD96507FD83F5D07BCDC00F3
+572704CB75C2686BB86D2EAF4E93D79478F84267BDF86269179969653289BFD178BD081F2FA8FE7B0AEBC25062022D77
+0
+1
+ecdsa_recover_public_key 483
+9AA598F10AA956E60F76FD9C67FFFD85573410727DB7F5AF8FAEEF007906CD40421919DE3BEFF381D99A39AF2E65D9C6
+910437DEDA9E0367BF54F6B5E23A2D6B76E020B6051ABBD70A3D0E5DB84FA3B33618B8ED88E097187596CA12BCBFF2D6
+261C7EBE00D6EF8DF5D03ECCD049F1DFCE66E34FE6B39F83AA7D368072293E7AB68611F60984B42C45B788A1E9A83E8F
+0
+0C96112A219B740D9CE270F132D324AF6FA28D12D2295D1E8454C997837D2EF5204A251D6C1D66A317C9551437814811
+B4AE6ECBC657D4F69FA773D2D34B2BB635A9DA31209D1CA17E3ABAC1665078D55ECBDFD6857880C7E9948B0407B1B1BB
+0
+1
+ecdsa_recover_public_key 484
+F141BDCFDBF32001359B8D4FB1F30EEED43A869010A4046D7A67C0D2281AA17AB6DC82BA346EB07201F300A375E669A6
+9509CF22AA6C07EB4606F30E69ECE5871CA8DC855D0E07F7ACD41774BDF5ACF1E35281CA80D3F1C28EC74FF26243237C
+9B527A40759E72EA463D92BDF9C7F86A84870AD5B746F2EC798CB4241857B22F1AF8620EBAC74746A448E8ED8A71D152
+1
+F0F9FBE0755440DAB1B1C2BA9C5DBB2CF7AA815366BFE1594AFE7DB4F9CFD40153D97933374057E2BBB602C6DF0B2151
+9A139D0DA437230BDA7B798581CBF78AC231F29B86A7B4AD0EF262AAD70B689374C0DD62D66697E5464E3BBD5C6EB194
+0
+1
+ecdsa_recover_public_key 485
+6FD45CE0B34E3FC210FCFED531F3AA0EF32455828A5FBC9F1DD238928AE09FDA3A76178080EBA79423B87E67CAE71C28
+BF9A1F685AF3F5BD742CC9DC1A7D16B2AAA3F4FDD80647FDDF13A755E3ABE1DCBBDA2C503853D08114DC383ED96ED5D1
+C5624F0C07741B02628FF3DBC925A085010A415F3A978F3696650B5DA3BF047037498BC1310E8FEF81C341765DEE64B1
+1
+5AAEDDA363077BE93A0BA43F19D840C737463C83E1CD80F7B3DE77EF9C5CA05D028302AB2C04DD4FF01B49B69ACA2E41
+A792C296F8E585782C54A5B5E4C340DCD4744F0FBC56A437D786EAA78205EFEA58856661D675B700CC2099A33117971F
+0
+1
+ecdsa_recover_public_key 486
+F045B1360F0E90095E6FC0D35CB11B846D887771F55F72CC7C4741E24285EF7EA324B8D4F2BD9121EFB08DD0A1FA452B
+B876F692FA649AF151FA9337FB10DAC945FB861F3924C709AC7F6FE3E0C08AEE3E1E98C7E0DB1ECD38A0FF6F75F0262C
+B6E95FC32D643E08A5F8B6B47B4BB89AA08937BA1069205B9513ABF88DA5E1D95A8EEF26B423F0B46DBD8CAB50E0EB3F
+1
+2ECA8686DC24E5F26DB09932252A5C03BC40A862BB675E0F1D4A6EC169F65C4158D2EB500CD5C8BD13EC4C7A48EDA7BE
+66B7E24D86D61F41AEFA7EF4845E8C82118465E6504012C3F460D03B7B379FD8C8B98909470B284A90A7EC7231BCFE03
+0
+1
+ecdsa_recover_public_key 487
+75B875CAEA2FC5A40C0880DCD792940E8564D308F8DFBB8A2F73B88456EEAEFA05419453083E3524B6E8A9CC3DBFD81F
+295FBF401392D6B2B34C34849372D23C2C95EB6067541FB38F73303065064341BF2E2F77A88AAE5DB582869CCCDB6AD7
+71377D995897C7F5B297D22A88C7ED1CDA5BBB4244635D993323B1FF74473AD30CC561EFDA666348778C2594EF2CC9BE
+0
+7B475407E005B447190EB803A5CE6FF1E1143C4293A4A828E95E3CE7E1D2B2ED39C210C14BC9D40B6E27CC122EFF672D
+47390E9F44A8C607BD5E5B92EDCE210682FE59F056BC17C02F645D7A04AA6288AF59C77E9201A9562B8F19A9567345A6
+0
+1
+ecdsa_recover_public_key 488
+CCA4825EE47351D26E5865945F7FB4CAD51AC43CA81BE9D571EBC9503D6E75CE1F37A600A30CB0E84AA45C6EEC02B244
+FC6ED3F90E2B74621375F0309380AE548857C2A4AC116E678376B7EECD97895D58FE8609120C686EA6866E01AF5B4A92
+D3997A7297EF1BD92CFBD7A0614ADE88D232CB85CB3EA4E70907DE484EB136F9061F60C459A9CBA1FF60AFAF6AD0A213
+3
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0
+ecdsa_sign_recoverable 489
+AD4A90EE4CCDB86E4C104174FE6ED10C72E2D65216D50EDB9697500F11F72390FE860361A0B8612FE2AB59009FD32CE3
+BF56978A0A066CD4645102E6F2CEA7E84F396F2C6BCB9942D8351426F9760923A85862BA6EEABA309619A54B43DE32FE
+F5C4CD349CD48AD46A4061609AF62162B574BC2A50D7BA7DCC9102D269DA62B517807E20674D91951736330B194D2A9B
+1D76823C18E610C6B0F797CD37EE9EF4EE00231363C63A0FA884418D860842F401ABBC14C2F1CA0A6F6DE582F3676A70
+0
+ecdsa_sign_recoverable 490
+2326DE5B5041F690B0266CD56041DF043C614BFFBB76CD88FD7B63C06062DEFC2B12AB1D9A4CD7C8E89E7413418E93C5
+1CA8D89169F7145E070E8113FD992558C0960DE06D1C1ACED531BE816260D9303DBD6F8351F9DD4F57CF0A0A245E0452
+FD5DF9FF66A62E93CA020F6E184DEEF1DC557D214BCDC2BC7224FD6B9D77DAB0D8CC28A4671EB7708E3F5FC2FADD400F
+8F722F53124446C1ECE0D183256D6DB44B0223A58E15027221D215F68AE6B9DA7153F053F51E10863F212556BD3525E2
+0
+ecdsa_sign_recoverable 491
+D88F36D100758FB0FE5B10F8A7391E795FC443524449A35AF4081190D8640505B968829F87AA0D9CE57B5696573D897D
+2498D47FD72CA7C38FD385C5E9BB72B0FA6176E281F443E8FF91D6995A9C22FE5DF05A6074C8ECFEE53D37894C35FA10
+905011497A0842BE62DBE3EF00D91CC32D60B6C7338401C5D5A90BC38A2EBF6F703FCB2B6F80FE20ACB66435F43D3FC9
+DB33D8A511AA37B2405B349FD911A3B32DD44E8567139100D73F908AE53D1976E33FF2385A810446D5B4B2B4D5D3EF09
+0
+ecdh_phase_two_batch 492
+1
+9D7C3424867A86693FD2BE5A6CD8680B39156B5BBA48083131A67CA482A1F48F226D7CA6BED896D3269AA3C39551C963
+E7A83C546CE6C0D2CECCB621AF12B84CB98F086997298A21289860804F7251515141CDEBAD6F12B026A05E0824D40686
+38E3ABEE2C1916E0B71088E02C19E0CE642892E3A14F8FA822FDDB59F07748DDA15BAE201330C82E329C1A8134CE2631
+0
+38CF78698C47FBCE363B657312CE8DC20EA5F4E429B9DABA2E0C760DAEB87C1AF01887F00AD87AE6A0944556352E0602
+E768D5643FEFD507BB3147EB600D555F5C7D7CAFE5B2A60CE82CB66C96E379059C190CF3C45FF040DBD446A9F8072381
+0
+1
+ecdh_phase_two_batch 493
+7
+AD63078D47AF2316CA2F50DDF4C2209C298CAC37A02AD6F205AC2FD074D8A034C11D22104ED056A85B3F953D2443A73A
+BA32B141C7505A0332865702C6DC0A41B98863F15F4BC477B228BD1CAF175A5B9D5BC9FF113242ED0AA9A22B47499B1D
+B2666485330C7D999661968909E82C4BB3F0F00CA8377B3BA64FB7D30C45983F1A25A41A0469EC808CBFFCA08B67D0EE
+0
+0A616B305B5D69F575A94D430DB0F5955F27C871C0AD6F00A4DF20F827306E234B58470B4033DA6E7F15DB77A0CEBEE9
+9784E3CA353CA85A26931A7C70C09A17515B1F7BFEE15CF72799F8515C64D8AB8D104C20BD39445FAB1391832EFCB5A7
+0
+DFF3BF6681841C4E5A0213D4F438E4B06C1A867D8FCA6FAFEE9D734F9A80AB3458D54E9DC57941ABC780B3934A62CEB2
+7016C9C72D856E045C00DAA479F74DEFE85DD7B5966909CCAE02868ED57819A2B310C650B62BF501B1A75CE0F3CDBC58
+0
+59BA9368F25EEEB9EA026E720E45FD5A1BAAC096A7BF75615FE6A8D72B74DC3629E199B1D5E77C9FEFCC67CBE9DC9C34
+F1F8A347B134F1E6FB13281478097F3213F27DEF84A0E6F99739BDF2F842702C9396A05AFC15905747E2BDABBDF66253
+0
+62938B6F30A797B3A64D8D03F8B698DAF7D34925FAA93D5AD08664859CE0C830B8FE19746FD872AEB36A03827342098A
+04161D3D29E4081C8F4905ABA55D63C29410515348A8DE44833DF906FCEDCC35179F70CBE8D963C2BADBC1E807F01554
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+9E5B012636EA27C80F2C0DF3F302FA6B3227BD6B3B13FCF5FD3CF1798FC525581397BDFDB75EE91183A2C5129232F33C
+2995645B5A895BA645395D900277BB31ED9A9AA54FEE9EE0BE3EBC25F0458056C47F57C8A572B621B1FFFCE9E5FFF565
+0
+540CF2B7F082DB04CD422FCD40E1B6BC47776D1C017933994D2428BCD58C152033AC49DE3859DFCDF0C7EFA5EBE2F5C5
+94379F6864AEA3622DF66DF95E0BA6B73ACC852A545DCF13DB79A37EB353F34D6D9CF5635BE232524323917A2436EBAD
+0
+0FFF7F7D03DECE0A2B05C7CBA81154949FD71164E1B7AE2B1EB016074A47E961C50B07A629C08AE6826BD9DB6CC769A1
+CD220FFCF2771CE372ECAD4B3840339847D810BDADD0AA49C92FF692E8F88DCA70BD26F08A00DC11DFAFF4F57202E89B
+0
+F537A9822F8874F15192F84F6C07634836F817848C20A90CC53C4CC0B9A3A3009B372AE712EBFCA673A2DF6C12D9F4D9
+1A40C86EBAD412C95758F96A7970BD07C612F06909562BE3728F09DF5A7EC948F617588BF99950F2EEB226E0DD7BD0B7
+0
+FEFA8A31448999E6A4397B1AD93B77BF27163BD266D6E1AB860E76477A5395FCCC4F1E8078E1FE7F4095D55DF1E3DDEE
+17A4226F77842134C86D7282E808FAACC2E22295419CF3BBCF35E0D1F0B8BECCD66640A81400D99168F9723DB0B99A11
+0
+9C586F8913999B8F4DB55A10083A68245D73A5DBE04CD7D67BC0F384529450F914A3E852B6ECDF5C4011635B8E35A630
+0F41F4C4A9E6EB813A1B92542DB4EF0FAC603EDCD7C9C3B09C8F294F0FE68C123A27F5F8117FF4DDCBFA37356B1F3689
+0
+700A122BA62865B4409277B04FCB70C2525C5C998CC6EE4DFD272C04ADA4402E82A49B3D83065DCEBDD21BC45C22345C
+5E0D632422F43BB83ED0F487F4D304F16B5471623FDE81F2641D5FB15B6380902D8E794C5FC32C2158BC99D87FA819F8
+0
+EA6C08CF8513C0DDF99D269BE0D3A095280E7BFD1C436AFA3B4A9160CDABEFB4C9E60B74ECA6A0463EC78D248EBA2AEC
+4D2C262CE044CCE86EB385483945CE66A47ED07B32A96096BB4D43C53B831C0185274F061E243E441EC5E27868287BA0
+0
+6
+ecdh_phase_two_batch 494
+20
+C5CBDBFCECFAB7BE87EC1018B8C93F63A8D72F58139050C6AFDCA636B62391BCBF853DBB0BA7F1761BE8A53B4BB6C75C
+21765C8BC7D212995C566285CF590AEE781C8CDDF1ED3925B86CACF86C46FC4E958EAA9FC4E19D83A2BD3907610F793B
+BBDA2E3EC731F16C01B1499EEAC793529F993DEAB7F1362CE43CFB227CBA75B1496ED655D471B827CCDD20CD5A5A9F50
+0
+207C01E3B4D2642434A1530148F8223BB397C7D9861965A565E0035602FB234E014BBFED440184FE80E396F0FC13EB7F
+A15723CD875FDEF90C823A08A9687595D34182B6C85267B03E869F6B71F36BDE26E71B41C0E610F342B6FA7B0E992423
+0
+D6C43C5F17AC4B69226E4521497B25B13FC0FD3B72AE850B6E1BE9C7B4AF26F94EEA697E601682F299A45AF632011C22
+38EEA9B18E0661A1053E7621910C40C4E74145BED16AC7126E2257B9AC6B0423BA14D6168E720CDC5D45B0B3E3FDA7A1
+0
+26702F0A51DC7060AD54FCB147AF38984CDBB66DCA1C617634B02DF170BC4DC42B8F49EAC620E51AAABE37CC4EEB75ED
+73C2EB2007D531BCB1311122D736DAF51E1795D31C0A5FFEDD9B268C8273EDC557AC9B6FDE1F9FCA6C72E3133636143E
+0
+583402016C5CBDDCB47C2202C4A9007D715C888C14C92D0C471333F736FA5BEE8D38F33098FC1DFBEA075522BBC86418
+A534FF860E80B56A86FD4C38695C3A4AB601FBD917480FFC1E69474D171EA7D0D12183D983B4C7668E4D0AEAFD752A86
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+594FF30D23002784A0124BC97EED04BFEF41FE9909A33C78B0260B7F955CD7C3A687BDE785CDE3F312EB7FE2673E5959
+3722F33AAB8CE46E62D31680A5B67FAB314D97A27524454A0D4364398E849FC8675A9B219D46FED5724F61B710B9ABE6
+0
+98D7E499C2DD72B3C9A2013B12488A3468774FB0F2CDA4487C91BEDBE0B8633339F0EB074917C977B001DAAEE529FE8A
+01A21B66B45C0980639608485CCFC6E8FFA6993FA2C02967F67CE25B4421BF14CC28ADED5E76ECEF474CED050CEBDD72
+0
+B62EF0F97B1F80DC537E251B319019355116A0644CBD0370517AA0DD8C12642347E2A08FAF0BCCB9CE087FFF592592EF
+E51BAB3A5C93D37DF54FD31B96A139504AC5D2DD9A30C70EDCA090FF2C09A36B17A3D949FB634058F1C18E614C0FD152
+0
+3F320FB1418D3F0EE1223EE6D13D702E69042730B590315EB86E7F574D42F962D2610EE21700787B974C165606F8FB6F
+1832BF86FAA37F1209995EF8B66BF45FF431585E929237C7C2F300BA512F7D070941BDF69F79027F132A3AF186C6CC87
+0
+E22A9ABEA82EDE2FDE26C34F96CBC76F35517B96E185427A434A9CB6608F1C410BE7A6EE8CFDA48F5EE39A5EEA84BAD7
+FD18E4C2AA5CEBD5FCF6F39A17EFA6C8147F97C830F368D1BC8BB75488AAD7BBE85A5CD0A8D8FF356C016937A283DE9B
+0
+F46BBC1E4E661F46069FA3CBE148B894BDC3AD6479604544457295D8DE89390D6583F07A316E74F51EB89FB2F4D2C37C
+342336DC704B2D2E4B4F1E8FA0BD1A98335F69969371428DAC0A3CD031AE8F27EBA40DD1CF078D571BEE263A7358704C
+0
+EAE2286F9C4CCD014514E9FB6BCD52C324B66C2449A7415578683EF34CFC0DDE1B1963B09F27826AC37572B9B1A43824
+DB8422628C48CD29A463C2D76839213F78973CBD6EC7DA33E502212A01760F523C021E70348D5EFC38CE24BFD0AB4561
+0
+BD3A76F12B76B2DBBA7EDFB91E41915833FF902B6601702EF070D49F47193D0E6A125A1CC0A85238DFB301A9E5427B07
+9B6EBA95FCFAE7030A159255149238093408C18AFA25502E24B628270689A249E766292F59723C9F27939DA5C59AC080
+0
+A953FD9B7F9D3B03412970EEE3B5E6B0733B797CFFDA52DE65ED86D42F86AE64BF8528AFB2A9228B7F11D06560C80DA2
+12CD2E369C898912C8049BF6518E20DE1B6CD90A9DDDFF3E11794D08662EBF4B415350773D1D868966F968D6B0BF535C
+0
+9A73AB62D41199CEA49D4495FCC755F59025AA87448AD4115B200B46E024D8DB19DD4987211C46FDA24EC70A40FCC291
+A6999D35F18AE54B0DD413E9FEACC3F2AA29EECCB417F39A94D0CEC10ED9BEC4FCE690F771A3C6E95FF072CAC43C88F0
+0
+9120434E2244610AC0DD656E3A736793942148896E4A73C172AB1715CD10C82C781047F2FC2328937743CA1724881C2F
+47AA13B1A92D1BC5E204F3E306D05663E0B3F83B9607DE984927D4F90CC74D5DB4A113F2FE8D32095C139CE6BC59F029
+0
+98C1E521EB795E7DE096BDB56C34AD78E8546C343A3636A325FAE63B94003ED9FAE1FEDB9EB9E20AD355E47047BD6F39
+8EEF9B86EF8AA33E8DE02474CC485533DA399229C4CEB7FE13CE0E16CA6FC775C44D5E51B69F57093E9DADAD78A706BD
+0
+3824F8AEBD00D1D0A1D352D173EEDF5287A584AC1D67CB86C0E5668BE5A2B0037DB78ED05EBA56A13BD1B10D674679D2
+FDFCAA8E360AC5139987B50E28F63B7AB4028EAE5E43C7F91AB9D8B0E26CE2126B620EDDBDB37024CBBFD85DEEFE8F22
+0
+035E3D8F4E8CE310938B81154150F1834283E2CDD3311E8F0546631406114ABB95B39823DEA0795D34357E97BF40A959
+171213757367536CE25C8AD00F347395812EDF9AEF72A528288626F850BF174F8919DBA53E23D1029268E5EDF243DD68
+0
+7422E255CD13116AB06285C62FDD4D0D956E7F8014DC152B0EEE0C1D6FF3CEF8D406A09145DFE6F893022F06EBAF16D0
+F1CFEBA0F566975A9BB2A58CC5880AD061613233553C3FB568E72759CE203DB93604003D903D616E8A765FF643514DF9
+0
+A21665EBDF9E89C347B917FFA91CEB66A620B413B1793C8369DD7AC181826C91B6A5B7B79471179DA00427022A3E1941
+E19000E0F5A2CA1AEDAF27089A51AFA77C98EC0B89B764440347E9DC6B7B55201F4C08316DBA24B405A5611A1115691A
+0
+FF259947D2B1EDCA442D5396FC79E912B590122DD957D5F805023A9B2EFF341A03CDC30F5E3AF6D4E2A6B4AA549B23AC
+8B15F8740ABD68D68FE0436AA31C52D2E025D235B3B7101B0A320D009E33CE0F6D7328A64299F0291CACE8B2CF452FBF
+0
+F3B188FFCBB1E10021BBDAEBCCC18322EA70C36BDB5D8346E469C9E4FA352377D95CA655C8B181E0540ECBC9BC01DB6A
+11F37E2CF0F5FAE03AA9B8C95143AAE16004D6F5ED539E65FFD3E7E79DBC5F2B0A14AA27CCDEABEC513E3ADDB5C03A74
+0
+AD24999ADF665254B543E0EFF01B6B2E09FFC3724EE1E13E2BCDE9687BE86AED7DCFA12EA39742A928007524CD42337B
+9B3B168C6D542DB74E2100745A8AF9FF07997E92729E29CDCB8BF53158B53CE1296C318300BA692A794FA1451B7FECFA
+0
+7B132E68C82CFEAF71CD34345DBB4DB694C405495B6303AB06570B59AEF5A3794E5CDD2E041D18E8CA5173BE1C39FA12
+2786467BDC7718CF44EAF68A0C4C127F62DA34133EBD0E13B85AB7523009A69B26B791DBF4DBFF0902842F006A332A62
+0
+AF6C28CE00FDAFA5ECE4EECDFA87429F1E29531739159050CA14CE0E2F9A834AD65E2BD3AD57DE4DA7916BE4A8E304F8
+A7C52C43150AEB1DDAFE2889065A8C252F297F7444637415FE373B4778D26C538983C2CD36B71C0305D948DF5BD97AE7
+0
+92B76884550AA4DE46D5369ADAA58ACE88524D7435B9B011CF5B675425E48BAA3769C496992CDEE92EF00353AB23F9CC
+B2601774074FD9C40EF69F26E887A72F3D6085B49455C9A8FAC4DCDEC20F44D5F567946AE949713DDF40D43BDC2C122C
+0
+891EF587B080978B3B4946910AB336203D2A0E53F1C515EDF925FF1B4058E81CF307D81B19E77C5799487F0E9648B271
+B5CE60266AEB491C68738F5411AFEE64EE5428E29E60517EA4E709E440DB4097B2D56772F88B3D7550D6738239E3F056
+0
+4155D524365A0FD699B249134938773998E42DE8CBD7E4CD8AE4B0611CE3BD8F3BBD1FB0245DC40F739873919D21B999
+E3E36F19A951DBAD13F0489559888D9C6C62EA4937B728443DE1A9512D0732E7F2E08B1FA34E3C62E23EB7D9932F0016
+0
+7E0C92A10F0317C5C149D5953DFC97A0A6CCA876A4C6788563276397D35FD3B3A5534E21F43566F54E49A2C96CFC7490
+C4A2C870B18485839BFAFADA46BAA76E430B0B7878F486D4921670C29D0F88A67E53A22B51607158A365FD008865ED3E
+0
+5C2E1A07020275EA30CDB69D68AC4B47D8C6A5D66420272B90B476AFBEAFC6EE3F0A3FF2344E791B8087B98D9019845E
+81EC561EC8AB683A11FF245E1475554900DD1E500DB3FDFEEE61FC3686FC75F0792476E4F49C94A160068C8AC8E463B1
+0
+CADA590ACF875A05976F4A337029D5990863920BB48D6C814ED5A109AF04BADBE9C778567E4DDCB4F4B3BFADA545894C
+7750C027A207DB48DA405B9709AC6C572CD8334398F00C34015664CE6C1DCEB16F609FEB0E8C5C87A4298C29E01EC775
+0
+89003684533CCC31A10BE75AF3742C765412C1884C89DABDC55A3EF654C6596123553122A6E3BCF0B375ECE80E9AD39B
+96E559341C6D5DD19FFD620BD1D1659625A2ED210E24D86BCFAEB76DEEF8180DB9874498BB27DE8054DA984340F74991
+0
+BFBB90D6613511E55617905827876544B2B42CC818777F14716E9FD7A5B803AE3330DA746A5B15AF30247CD4A74F7EE3
+C0587412D7BA3C14B9B30311C3FB2D60AB997CFC9A10C2D95ECB91C067A54AB642BF8AF806534C047CC5FA379B9D48B9
+0
+9207C267B35655DBA034C83DDF3A1E67ADCC83FA6F833B30D87409664D3862904194C314D9D62162A5951C489F45215B
+E4A975EBF1D67DCABFAE022A2253F20C617B073202C243589F85F906D50AC7D3A5B45838171DDFF8E320F4C913678A96
+0
+FB11F9A82A83ED2C09B8051F628E24315114972CE12500F9C36DD1560CB0A9303293B13AAF461F09902E8516DDED1858
+F0F05AC096BDC12D2ADC4BD54AC9918A7D381A1DB25F90B02B7E87BB5DB470738E8C906012B47974538759F61CF5992D
+0
+26985EB3352E660AFADC8DA4E5AAFB2FC5862D21E96AAF3488FE5FE02E882E87006D9D8248EFBBC465D1FFC77F6AD0F1
+9ECF3687F1FFEFDB178E0977FE55DF142F0E49A7CDBBA0502228AFC198A483B4ADCA041ABF78A8EF3B582123027DF416
+0
+FDC166BF0C734A14551A9D6D77E176040999485D7CA4045E5592671D79209B9E4E1716F7FB6792FAD399739A51C5E223
+C905FAE85B8D99247C88C83519DCDBB4492ABABA8C63FAFB5094A24975EA33C10C8C2C9ADA377DABEC1B9F042D19652B
+0
+82277A2C0F411B705127ED76928F65FB4F56A4771444F11A65AB7A0F5BAFD6ABC3636E66F079B7C23F72890DB11B1EAE
+B195A39D0F28CA1F08F2C7FEF4FD3A7CCA23E9DBC8294313135A2AD306DD2DDB8D85B4E38DD215918DAB580A2A7A418D
+0
+19
+ecdh_phase_two_batch 495
+5
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+BDF67638111231EA516FBF4A3320D841213195DBD90CA8CC9E223B90086C6F977033F4FBEF85C5F51B44C51C0263BCBB
+E6D3957C6089C35958399B4A6DD080583267F5A1EDA7BE6B3CB8DD9917BFC831BE3E3002DA282EEDAF53A2D36B7C83DC
+0
+BDF67638111231EA516FBF4A3320D841213195DBD90CA8CC9E223B90086C6F977033F4FBEF85C5F51B44C51C0263BCBB
+E6D3957C6089C35958399B4A6DD080583267F5A1EDA7BE6B3CB8DD9917BFC831BE3E3002DA282EEDAF53A2D36B7C83DC
+0
+3A4FE904F2A9EFB8A87BDA524CEDECB0851EA15A48371DC03BA0E608241776988E90FEDAEC4EB7E6486DD7F19A538DFF
+E8F709353DA7469A8FA795A3D623632D7AB716609676C272CE94495E54972D7CB54132DCF81CB697D1DC2824FEDDF327
+0
+3A4FE904F2A9EFB8A87BDA524CEDECB0851EA15A48371DC03BA0E608241776988E90FEDAEC4EB7E6486DD7F19A538DFF
+E8F709353DA7469A8FA795A3D623632D7AB716609676C272CE94495E54972D7CB54132DCF81CB697D1DC2824FEDDF327
+0
+068A92959441B3D7A1B836EF6880A41075E0804D01267B0455658E7672A0A7182BF865E7E04AA4E87F11D80EAAA11EB3
+2143FA637904E528DDBCF33CF17EB5D8F576C9E53119E55C7B61A31951B14C827EBE182DEBAB89F3E7B90ED462F23CBB
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+2F9E8EFDE7D2C27EA7C181EE3DDC60C2C01675B513F53136D89595D80D8E336D0E2F920C9E1570811E6A416E8B3DD5C4
+0BABFDB62355835E8F64E0C8C522AD2325ACE525E6E6CE6FA77539BDB26EBA7D899464D247DC1472F5A4BEDF1823E73E
+0
+2F9E8EFDE7D2C27EA7C181EE3DDC60C2C01675B513F53136D89595D80D8E336D0E2F920C9E1570811E6A416E8B3DD5C4
+0BABFDB62355835E8F64E0C8C522AD2325ACE525E6E6CE6FA77539BDB26EBA7D899464D247DC1472F5A4BEDF1823E73E
+0
+32DDCF2B3769BDEBA10C71683FAF908BD3F221EB919651108BC4125E55AFD2B54EBDB40248B2033AECE3D6C240279D3F
+569168287493C2EB9A2A273E456020EE7A71820977492CEC5DF9C54BDF199EA024CAA35750D47DC68FC69258B83F822D
+0
+32DDCF2B3769BDEBA10C71683FAF908BD3F221EB919651108BC4125E55AFD2B54EBDB40248B2033AECE3D6C240279D3F
+569168287493C2EB9A2A273E456020EE7A71820977492CEC5DF9C54BDF199EA024CAA35750D47DC68FC69258B83F822D
+0
+4
+ecdh_phase_two_batch 496
+5
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+863CD42011F7B0B99C543FF80ADDFB0D806636EE9140788408C75EDA9EBE0DA668B3BF761465BE00307012C8BDA14859
+597153737195981510C058929305A443BCDFE8311133BD3E681A78649214B066DCE721B78FFBB861A6148C0C85E9AC72
+0
+A0E7E17D918F9D67C7A1F9AC1EE8015A3F96DFFB28E51C50EB80769F7FEE6B0A2F7C4C41F9866FF782B90B553CF4551C
+D3ECF8EB961E6A18C9BC0F6D7B8E69CE075EAEEF0C0ADE40E89DF67A81956A2D21D851F5666A15EDF8C8214A60DBFB6F
+0
+8CFA00F3888FE60C46A0B829A829F59F873AF701B69AC923213D11AA7220447CE37F067C516AAA09B489CD60D100F6C0
+F7875AB4825B4A47C75727C0E9C4A3045A5A06E4510282A92D9E42A7ACAA78786774585A6BE4BFC4BC5A1BDEF7846F91
+0
+202159B7392F3969C5C9711D813D5814B9107AD564880A03EF45E26C2637B9FBA6C2CAD41AA5AE0E8B2544DCBF08CD14
+E60C5DCA7425C9E2DA7DF55492169702D20C56F705A9F8A1F7D7EA390290A361C41902D6B3A377797C8204306DBE3B1F
+0
+74260F0F4C7BBE150E05F79926C0FFD0F33FFCE3FB7B8BED714B717FDCD0602FD3E9F807E6F364EAD7257B2C29FDAA94
+EEFD2AB9DA022075EA10F631CBDB3534E50436DC531B0E72810B287218617D4F82A8FC7B7552EA1A437541644349D4CE
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+113899055CE814B425D5571B55C48A895842513D53DABDC26D3647A4A0FFCD03913DB515EEF47B769FAEADCA28CC3BE4
+0F38F21E31CB8A30929443AFE2A77D40D66269F1BB9280728B04EF07533B14759E49CEB6F2CE6159C0C84F0AF85900F7
+0
+65329DDFE981FEE08D49284BED1A76F2C75D6D6E180AEEA9F9FD88D9B5FE1D01D828603A4A43FDFF9C126D65A9EC1B6D
+96815F4060949B809A98E4DB67E947EEFBA0F5AD26E4D61943E40643E67CACAB1318983984CCD8FC4F9AA1D38F862A58
+0
+74BAEE2663C14980C18F37A9B381A8C7D39B8A7B6E7E6C9A51D6AAA799360D98CB6139AE5E34E2005FF2CADFEF676BCF
+B2EB9E6582E068EC50793ECD3DBA49F87A33DC3E0CFE756B718BE94204D02350783DE4182458D7C9E5B5509D6840C42E
+0
+360A23CD8847218B977DEA3FE8966FDD46B7A12C981B2DD0E65993348CCA48FD0414DB55773CCB101911999F62C97FE6
+BB2B79B1401F552E0FF111B4A86CEA0CC36D28A7EB183BB16AB76257A881448F0DBF9241EC34FFCE3BCFF8B2F89A172F
+0
+4
+ecdh_phase_two_batch 497
+3
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52972
+D4B7A2E0ED4FC17466AA2BECF042CC0442799EFEC75B685A96178D44DD22E54465854DF8255975E606739384C1D13915
+6E17FCC821BCD5493C721F56DC731EB14B060B16281DCEEDAD5D92B56EE28A2C11BA6BCCB9967107A68E7DAE9FAD336F
+0
+D4B7A2E0ED4FC17466AA2BECF042CC0442799EFEC75B685A96178D44DD22E54465854DF8255975E606739384C1D13915
+91E80337DE432AB6C38DE0A9238CE14EB4F9F4E9D7E2311252A26D4A911D75D2EE45943246698EF8597182526052CC90
+0
+F0197DFA751BDDC71BCAA0BB0CBD1488569672C71292626DF165B303400C9C75E87A333EEC49C7EEA8956EB5D63A7BC8
+13C4D5DB4820E1D3AF9AEF65C4C78E150BEA738315543927F94F7BF019E1224CD7368B59DDE20727815FD2C3ED03B3DA
+0
+F0197DFA751BDDC71BCAA0BB0CBD1488569672C71292626DF165B303400C9C75E87A333EEC49C7EEA8956EB5D63A7BC8
+EC3B2A24B7DF1E2C5065109A3B3871EAF4158C7CEAABC6D806B0840FE61EDDB228C974A5221DF8D87EA02D3D12FC4C25
+0
+A6C461DA14DB76161D735544DD53E377F4A518C3D48B0483011B02ABF9321E662624B1D625CE543737D122A188B080BB
+52A5EBFC6227599B787F42C13640549BAA8D48421F38D6B33032D1C766C1A26E3A027977FFEB58BBCD1722215C3501B3
+0
+A6C461DA14DB76161D735544DD53E377F4A518C3D48B0483011B02ABF9321E662624B1D625CE543737D122A188B080BB
+AD5A14039DD8A6648780BD3EC9BFAB645572B7BDE0C7294CCFCD2E38993E5D90C5FD86870014A74432E8DDDFA3CAFE4C
+0
+3
+ecdh_phase_two_batch 498
+33
+8D21651738DD3453DC748E6BD395C1511AF0EF217747E2D1C94891E121823236630A8CAB8456996767ED8D8E172DE2C1
+B29FB83648AAA490869BBEF2B8F05C68CBD077E41BBE7A8FD7C9DF7DF924CBA59D7BE2EA61BCB8FBC0E5D564CEBA6209
+31AE26870D902AB653054B3EAB96E8A623C4C35A2EA4A1CC17412A32F595A80D6C5974DBBA447BF029FEBC62AAC396BD
+0
+4AD92CEF94090102EED96C5F66CC074753E8B3E17CF885FA583686F0452820D494B9874B75DE9356590ECC814DF0A1EF
+610B4B98678B6DFDC5BBEB861112062078483B7E7692AC3ABB51F810085CB3D6475B146CD952356FA700BC3AD2CC41A7
+0
+B68F968DA62E2B8E7AC980BA921B1C9F1456DF004EB0E917FB0A4EC69F998D9110102DF39FE4340C61EC3B8790A09789
+444C4226AA25156F7B85DA583226F4C5AEDFF09CE257F6775CCF73DA80DA8C5D9C0D47471B9D61A27C6FB845395DE817
+0
+FE84377ADE8426ACF1D6AF67A7FD705C408F70F7DE3686BC170DFE56C64ADBB990B6DC5B1489AD54591FB914F0F2336D
+B6EE6A284578F7A76A36FABF931EF5F13AB86C9B9089E5E7E3E86029E67984B64D3620A6E3BB8ED85EDFA777E33D924C
+0
+2AC489B4A2ADEDF17F4746A7275EC52FE01FA55E022E379260C62E5F5E384B13ECBAFA4DC95DB72658AFFA285847A07A
+3D582BC6098FF0AD9144E6240BD76DD31C9B57C56D18A22CA7DA67D3EDAB620E8420FE05F74CEAD52F090F0AB7BB0C4D
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+D296E7D1AEFCDC0CD4993272B7ADAE3BE11CB4A807E0EE4E4C7262AF298760AFA3816F6BAED512426B1836874D9A5EE0
+70BB2624FF4CBB60BFDD40D7476A89E497DB6598B2766FC7B3834691EB083812C0776C449F0D3B53235135EBC36915AE
+0
+634B43EC9051917715F6E2E00DF37D977AD3C5330AF3ECF2775319C9893CAD4351FA487D7C634FAAC7FBB80214F2E29A
+53ECAC9B1780435BE4ED8141A882EA027010ACF0FEF0C2EC5B009E836070B70A590F1DED9617689AE2EB09D7ACABE9BF
+0
+3411D303B61DD48DC1F0FEB579CDA178B80A55F46E05F4CCCC8DDA7C54394F30B76D0238445F327DB5E94F7DFDF6AE12
+8C98D20C85CF51FC7507323C5028CE74D4A55F9C279C111C8ED510EDD9ED37F81635B1C476AEDFD3B51B6D8A0C054E18
+0
+4BB6CA73A4923B2E10478AE84AA148C43DE497795664BCE7E9EB73C3787B41C1E8A97269A2F1C4AC388AAFF10EC6C668
+111C21170EDBB13A6E9C14866BE9A0CCFC132DD6671D4AE8B80E66EF8FDC8884ED22C89AEFF8E81EE02116216187ED18
+0
+741632F51B5041F14A2254EA27802598EC6FE2266BE2E57D799377FCD24E447CEBD8B74EE8831E0B0A054A0DBEEBE66F
+9250B5E03303595B993FD412ADE23903B139D94DE3EF612531706EEB7309B68891135BC791CEE3B2805012E72BACD928
+0
+0B2D3F079BE7AA16494938556A1DE64FCEBB2F16DDCF3D23EC5623251A3E70880E451D91090E5B9E9EAB450FA64FC054
+DEA5A57718C73CFBDBCC52EB6D8325A52555FED852B6422D8F085EC2FAF5C7A4C9C12461108B8E44D71C86E973C0F738
+0
+827A6BA404FBAAA2B9F575CF9D593F38749103F7715D806044F3789B3BF89846D2FD795EAD2C62732C0880D5CE0A6B2A
+E13AEE260FB31117575030518849E5644E993016BFD7408D9EA99F03B4A5B5792ABC97792B204DA352491C29B0195F51
+0
+58FFB7150105C85A6A7DDB3F156362B2B857112ADA9E8D3E631956DF7BED7A1404612DD1123EA9FB9883FAFABE587ED3
+E286151AD139A9F1B1AEC5A7B41916F58E215F2A1C87208FFD6F622E78CAF397D7C74A9E3DFC09C86EAA9A3F47ED393B
+0
+AB58881DED6358CD58A89B9F2F225109F72244EDCE9215A42A43AD9A9DF71DC1C1B4F2D322F898077DCE68585FF2FBCC
+532AAF79AD4E308CFE9B3EF75FBF36F6B353301B7D3363AB7223DA9421C806B508E5493AB68CAA7EAB3B29D97B69E214
+0
+BD19B3EED2C10DDA66EC079A544BBE053CA8BE6F8E116DFF6C9792AD28A6970A387F2300DDDCC9855DD37E843DF36E5F
+B8276042D3B31A2AA55C6938E0560287FFB27A847A42A46B1AD85AA9101BD7489CD2C0039CD02D5402ACC8A4628FD9FA
+0
+45B2F5AE1317C13C9748FE24A7272BE072D663EBAB7565A838F32944AF0A358967193338E73C6D8D5C8B179A3C516F8A
+5B0713B401406652DC1A435890D808F9D6AD1049C7C6BA3ED500153D5197B75FA77252EA660CB89D3929189E8109B99C
+0
+E9045309F2A160C1728EFE50B727D0B8BFFC0A1E10EFEBCC1BFDF97B0A21CFF9EB4C5FD026D43A9A7A96B5BDDCF6AF69
+24C5FD0F76E5B448B1B436588290C9699B7392E8CCB2E40D1FD08EA898855D301E7950CEE2142EAA1690255F1F018FC0
+0
+3CE3C6E290986BDD93FF2C328B114BD1E0CB16A0689F2CACA5ED24B3BF41E98D997E636DF14EBB89FF06CB7B719DF11E
+1157328F275008FFE0F1C700B42FC8096E7F8B9FC162B24866735E35DB2BD6883143B89BCCD388BC8907B43166F6500B
+0
+F80B2A51844C8D3FA59BE1B4D30A5AD9A523CC9F346F03A82C422C1D702001B9FCE7ACA786C0A986C742AB33A2A2E3F0
+8F049ACA3D0F1CE103379EF24BD92A86B463E7A643C8989FCFFDFC974CA1CFDDE3F29C4FF5861962C3D84BE1DEA0A24E
+0
+6DA4FF3BC68B32CC88D6946992FF18ED6F8551BB7A63C41E3DC6EDFC4B76E728767869AC75A11CA1E1940691872055C1
+6704FDDB74E6AF359E292A146B03E387747928CB98D635CC11CC21503D5F8EBA90F5B99ADCEBB12D98A644E0C5F12FDA
+0
+2ED4DC56D553E2787FAB57A5E6DF5727E49388E92525215182DD119937116863420097EC295905B69470C8353A935B2A
+C4C84F16B7D56F9398CDC5ADE0B66FA85776B8B45B71FC9E6915B8ACB6AC5074BDE609C7F845A7DBD67DFA15309B06D8
+0
+E0FF62480B37B7BC8C0BA07D75C447DCBCC76E397370318B8FA29DFAAE5CC77FBF84AC2869A5128E039FFAC986141638
+70577133016C359EE18977AEF005794765896343BFA7F90FFE298DC9EF06A8AB6C88814D3E7182068FF8CDDA73AE1ED0
+0
+809BB0925CB7333A73204346DBB5D2BEEC7718AE9AB0FD5D176FA4C1FDB00924CE03CC575BD7C148EDC769DEC136128D
+38738753B64C66C69161F22FCDB1196279996998110D7D1CF5C9BE61E5C9F1FD83B0A4F6A23609A69A18EACB58F274EF
+0
+14C101366C29A2994FF3F8EF15ADA6714F094DAC7DCF34380AFACCAB737E78F1A48749B885F4FECDF683F9472B31C255
+C22D4DFD3781D28215FA8C73726CAA903E6C24AFC1C0F321C48A06BD574326EA6781DF73792AE1163C1C195349481E0E
+0
+450C5221C916739E7A3719C2B74640E9484D654685CD24445F9CB3466C614AFF39241BA3634E2C1BA532093F3556DC6D
+C5E80443CD9BD6E52F2BB367D5E43CF06D1480E2EECC8D255ABCB56E2A10693D038E0B68B609B7115914F5262F4F7E32
+0
+BE410B8D43311EE96474EA4A7373BA11AAAC4846B71368AAD69138D529A7BF75A1F1DB2E0F8F1E62BD15E4B69F00EBF7
+24D4BFCB822C21EBD7D9A2E2C7085596B670F2812A7ECD8229DD59BF2AC20D5C6A76048AF8DF7930645C6A104BA081EB
+0
+58D957D47AF78FD84E608E545B4DE5A3BEC834BFB7FFE122EEDE1F5DB1A72AB0251DF1A2AA71D424F5DFEEB494DDFFE0
+B06C9DE1DD3CD6F477395D596102C16D342A2F9EC7C43E65187DEF2B7C61891A53FB457AF3098073614D2861B48C9D70
+0
+2953B7B14BE9E2B13F108CE3BC1633CBBD8C1DFAD5FCD2182AB32D3430834E683FC361EF05E1C2A00FBCAC7DB0001965
+23802E379B19CDA7F8EFDFBCBFF28195B402D8330025F1CC26F7D5F26D06C387FAA2FEA11CC05125C86D33B7448E88DC
+0
+34584D5C193EC62384266A1904F10C00F6E90904B9040B98326B2E5582C40A04A7421EF3453984119FBBBBA785B4DEFE
+31E392FA4BD2EC73BF9EB1A46127EB8D9D66CA061E5D8B2260348FD42B487EAB91469817BB402F9D4587737EA34FB04F
+0
+3EBA1E01A7405D10BD41C5F6FCF8BEFB300066F6643FCD230FE7B00FF744F85F96923C9BF1821F02AF231E2558C5D786
+AC8CAA9F5B140B4FD97B31981EE8361809479CADBB6DEBDFD5352704630BD696D6D78091CB82C5C5F4DC89D05B03556C
+0
+AAA6656D1A0D7795F3270E307BFE05B49FA9FC50482095F16E6A9A45991BF2331454AB02345A6E13559E11210BFFE80A
+36DE5AD86D16B3FE17D62065468DB1CA4895FF55A50A652E91EE0AC503AB4E608755D4D0FDAD1788B9D3CFCE1B88C0FE
+0
+3A87D0028269DEFF85432F396E5059FCCF18F642C8C2CF48C8BC6C655E7103CCD5739350A900ADC99E205FFD42946538
+0D0A52D9549511015E37D73879E9ABE92569C7D21A8017832A7DE2FB88575F9BF968AFB03FF4932C70C4D382D011F453
+0
+59F11F4A97B179D548543E0A5AED8FE5D8F98C4CB7FBAFA9DE9C4AB5D7C9C6CC4574979BD374A311A7A732126B67260F
+6CB2110385A32F5861FA017342F15207DCD0B567BC2875B343F86E5DADFCF7814AE2C7097E9E9AD192E24D3EB2289FB9
+0
+8296984D39A9606A489A8B3C51237025ACE6602403C69726F358F7953B73312DC9ED87AF1BC03FEDFFD3FD118E4F0112
+9C889BC5155EB5D4C13CD356758105A17E660AE7FFB601C9F2072036A68E4C80CC32E79CDF193106698BEA4A6A3C3618
+0
+1D14D4D616571D34027B2A1BE3F646220150980C502BFA6008EC48DDB88B302756F06FDD454F4930EF8D6035A95A8C75
+D5DB0473148106084B672DBC817AF6366C363F5CE1D53D2BFE2C2532AAE28D8374A42116F1FD24D37577FB7FEABBBDA5
+0
+5CE093FA76A0F5CBD8D98A41016EA4DB33800361157BA334D9A905203B51D4597C478A05134EE0B93933CC0234ADDE59
+C40A3F925664AEB05A85D7D30574F15A185D6AD38A4419903BF53503349D0F49A1B24E9E6D86FBA170E0EB8947A67A61
+0
+324B96DB04509A3C4AA21BF60F17388B78B243920BA76C8751532B2BFF1C41604A4022DF6562B614EBBC923D2E06A7D4
+7BA7A529F753CB8A78E0ED226D5D271429134357FC40A37BDFFD4701D8F619D16B99C35E9659C1556B161EC34AA2F2BA
+0
+57500BED5EB7F2F1FF34AB02A65DE14795BE8FA0B0672FB1BB3E69DAE8CC0D240644801BDEEA8C05A827091EDC30AFF6
+4084495C0FFAFAB534188160649DDB5F6AC1EA84AE809EC97450529971BF27963CE22904824597F3717D335AC194F072
+0
+9819217A80E60B382988303FCAD0F078BDDE6F4666CC210C69F40ACE58CE65D233EF4DFB478ADFEE0218D47CEB5BE56C
+57026FAB5D1696BAE93A6BC6C0FBDD4F0EDFCCB96FFBD80BE5A6CA0768A219081E55EA01908AB82211C80677065D61D8
+0
+F3750DDC28695F92D0D49CCBC4FEC32E369950ED226DA90399EDC4BE1D3A805742E2AFE9870C079A69CC357FE89E6FDC
+BC6CBCA8A75336CF2F01DDF92165C5B50E266B4E5E7BBE428CD84BB3FD615F68E320257AB3F6EE3C7BC5EE9FE0FDDDAE
+0
+90B0746DD979DCDEEF692580B25F37A4F77AE66AE58574B3354BAF2169F9744A1A82124BE28BDE7A77C301E404996526
+5BE8DC8DE1D377D5688265B5630C7176B725ABECE4133DEF87520279D089DC0972ABF21BB8D2F0EAF5640A831A9F7E7D
+0
+4F9C174CCCE1D31C2A84CAD1FDD668E8D6102781E837211347A73BD323A1D9332B43B7FEEC5AFCDF2B4E6F890C0CDF4C
+8F1FF659A019E77B8268933E94BED7A3D0562874DCC8E864262560DC71491200A83EB01300DEF113507B5697BC36D046
+0
+9A5EE61D12B9745AE861F819E4101A92F92209B4E1AC9A9FB72E04C8CB19B8188FD88BF10ACAF0B4210201FABEBBCBB5
+FECA7F3C583FAEA3AD1A392258CE4BA98AB78479EB607ED847495AA64A6F930A877A64EC121C98C3AE16F0A6A402AE2C
+0
+14A1315D67B4AA1B61902FF49A3FCD45E532B7ADB1810A4287872589FA623AE0ED65AB757C94FE1DCF31F4B5AE4320EE
+CC97D5F110F2B4EBB9B7D4C987E4858154BBA83E7E873ED61006BBD8A03B353AEEC3F0D0CFD8D07E70C476D879ECD796
+0
+0EB814904AED33838263DAE33C0D85896B8646C7991720390271FF11887C5718CD0003F923E343D99B2350B2C4D947AF
+9D846D23E7CC22A1A9834BCAE784554350072E0430802275BAC35B1836B1489B833D932CBCE759EF60E45887D91FEE2A
+0
+E21D60F47BE02F410049252756A8E741B5398C3671C8808F5B5F3DDC9D9E52A784218783768CF7C3C8222AE7B7BF6BA1
+D48E7A5E64AF7C1F6EF0E03EBAC4F802E90B10F36960306802003086685C1FB39B34B593603E0B8E416B68FEE72C564D
+0
+82815670D786F45665CE4C72B2C324C44BA5F40048AB4FB3691EBFDE5BD6B9C9401A4198F6808A19B155C0BE2C59AC00
+28AEEC90405F2E505DEAF441D864EA024BFBD9E9DC5488F3CB1D1E172093C730EDA15C1CB3D501E77D22381991EA867E
+0
+C5FBD4D33CC35CD6113B0E0A7ED1310749464D895B39DA2977CF256632B96EF51102673F1E3A2BDC92CF2248B4D998FE
+680C83018D9512DFC6E3FED135F1D1A973190D38239E4A4F31943F8BE4F6D8FAAFF5048EB4C3292C2BFAF197F6CCECEA
+0
+78EE90AFC2040487E34569B0AABE07CBAFB82E1060220170A253946714AD9E2EF67AC8DE182A7ADB7A74F544668D1AFE
+31A29A3AB9EFE72D06DB1F4822DD9386C015E92D332CC3202AD56EA60E11E3A859CF4F2FFADFC4F6296C0859264FB53C
+0
+C6BFBBD7BB90564F7F9890FEA84E9F5A5C7E96C5075B9C61B60A6354CB912DF959DA104FD86E5B31ADC1C164D517A720
+B4E5A4CF4EDFA2B4455612D5BD239C3F88CADF5A70E2AB555249989AA45266818396C52CE41EC9EFB360411F970F1A0E
+0
+C415A7AD34110C21723334E8F65E66E43EB4CE22D6E288E74A3BA77827D483EA099A1602DC4A8A11DD84EC398F8C1FD1
+EC2AAC0FFB61FC5C755984164F684DC4B9B60B6A775C06C4B5F1C2D7B1D9EF2F08991AA78FA9F6E7C0AEF7E7054C6086
+0
+27776655488BEC2215328A3182B66DAC66FDED46A12D333717A601BEBEBA7D1D27B63245C67FEC21CB38A4240461718C
+006AA20D14ED8D8AD3D4D399A9C2ACE0720B77681EAE8C5B22567D10A606D1798D8990456C005F47DD371151DCC933C5
+0
+A4C5BFB21F720CD93015976C68918AC087CBB2D221A6E50B7799AF2AC80D25ACBEB72E55B54F0D9F8D2C54B9B050E118
+52F356F392239532A3343CEEC09AB9113E6B82558344AAC129F6F829DDBE81EB0D293E88DD46493297E56008B442E5CF
+0
+04AEDC160FB918AA5D9A0026E013A17E8EDA11005C81837B46240ACF771F654604F925B8EC03CAD51250382DF47CBA87
+5ADA5A7CF79605BC8715F86E3F34EF4AEAA38F532038D1CC87B71AA1A2A7E1B634E6B18BC5D614AD33EDCC3D9097A45A
+0
+84EAD80FB94F7C6867566D6C4BF74C42A7557DC71489C76E4E7297CAF083D61DF5D42FB7EEC4EEA8BC97880C31F983A9
+452DEDDD039C518BD23BD70BF047E3A5F62117008D4AAC8603E346950ACF31914580E00DC0466654EB917B73D5CF5340
+0
+C940604E2BFFC7EDBE9B3B19A1CA61BDFB9A6D796A58B39EDFD4A2576EF9A48D543EAE6D3F945B6F82B935D46974D534
+9C693DDEDA377F6A5DC4DB520580617AA835B779C91D19F7538E469ACAACE35AF9FBB3B8146380F2C82A0B67CB1D3454
+0
+38D836D776A815CDF59D28D7B35D5479049760692CFEFDE909E54BA79168D195E986B37ACC63AFE5741FAE64B35D20DB
+3533614DDCC1A49E472247B35DF9BBB216C77B3D5E49E1C1E3E7C1403C1938F1FDB2D7D2CB9D51BA789B6B923900CBED
+0
+546F3F4435DC05519FA870D5BFFB4410391386C94ACD04A97736FABF3C6ECD14B60D9BE0FB56D69B49525A5A2FE5EBD4
+294B6A491C7922D4A2D68A21B0C974153A5F765541F5D13FBFEFB37C45D44F0287ED8B66561A05A6C7394C2D5BB4283C
+0
+5F8D73972D852EA83B6AD04DE923F0691C34DEFCC4F4DEDA84037BD812C915C97AF753F1EFC72AC4B79FF095D84B4E8F
+C027BDA09C50886CF2EB18B616B1B13B5579B1217293DA5D1F9E315820CB4675620C3B9701E538D692B261694ED4019D
+0
+4F1ADE71618BDC1EF20DFB0314EF23E5C4DEFD944CB9C51E9E2807480F7F7144BA7837690ACF6B4F365BB2AD2B76ED34
+851C20936E2E663D37236834240C9B2E3F5358E027254180EE4D87BFB2BBECD6254B6AE57E0240B6FC8ABEE5C27F57AC
+0
+87E37080AB521C341DB6EDDFA07960BA13D9F9A7CAEA021FFD8D96CD4517211AED1B5B13F633674C1381E38498FB31A7
+47DCF57DD6B6B7C8F7EF00BE47D6C85A56AAAC6EA7A1895287FA61B7A71203C396C5D075DD84ABF058F6BF84D8900973
+0
+34EE2B4E3C63740D7722AD2B66EE79FFFBA5C0B9BFBF93980CA8E4A11D6CE83688CC5848BECA80FD78855F098AC5D1C0
+C9FCBEF2603405993291836C1A0BD5463BBD1B863E4BA0F6F5A87820DFB807D9491849461D289721368FE3181A89B778
+0
+C4465319DA9714E8D473F5F005FB2980655FC1305A937015AEC46A9A807C95EE5C9EE4C697A1958194EFE9F42C369A9F
+C72AF1DA06A2AA0B74435AE37A596A11265FB5B8520D73771EF6DD959566F00F24530722081E30A6C7488168A5AC31A1
+0
+D2684216437AAB7A0103E8B4FCBCDEBE6935A737CB0FA9B793F3C0EAB01668396F256FD6C49FB632988B7756FED94C11
+8CBB0E8B1F75D2AAD254E09B88406336B85939C39EE531AC3A76A9FC14A005C20DA1DE8714D6D774D29D537BAE1AC5CA
+0
+FFFE554CE0A27ACDD7F119AFA5A600C2E437F170A6970D23D74385B11B23ED1B0ECBF307B741F5A906F37B8DC447F1F5
+BB13C85AB168E182E8937EE250EC617646193C7DBDF49CA0769B807F96D36C7F6AD7C5605388E03308EBA13FBEB4D865
+0
+32
+ecdsa_sign_stream_sha256 499
+D84E4B2960960138B3580C07957C2967E26B37500D9DE7690D9D3E991C76E00A331721B8A73F7D4E8968F4DD090513A3
+5BC015D83CA18B3DD249C9FC2FF2D7FCD0CE8637F8B673427E4B27D4FC673B67220CF2FC05216739DE94FC12C4707E09
+FA26ED8484637C43FC2B3875031D2F3164D051F5D7B9AEDAD41C683801A37F90569429E5396112520132C34F5E8B45B3
+0
+0D
+1
+ecdsa_verify_stream_sha256 500
+6A9D40DD5BFD6F5C26D1DE59D2F8B8A906DBD9A9CEFBCB11DDB67854EF7E6E1FC41C13C9326D554F9D5B78BAA3A7BF19
+F9A06A1D9CC53FE2312B60B568E2A66FA4BD493C671FFBFB28431F57A540B5E24697A7F87B7476461498C7289BA9670F
+0D
+1
+5BC015D83CA18B3DD249C9FC2FF2D7FCD0CE8637F8B673427E4B27D4FC673B67220CF2FC05216739DE94FC12C4707E09
+FA26ED8484637C43FC2B3875031D2F3164D051F5D7B9AEDAD41C683801A37F90569429E5396112520132C34F5E8B45B3
+0
+1
+ecdsa_verify_stream_sha256 501
+6A9D40DD5BFD6F5C26D1DE59D2F8B8A906DBD9A9CEFBCB11DDB67854EF7E6E1FC41C13C9326D554F9D5B78BAA3A7BF19
+F9A06A1D9CC53FE2312B60B568E2A66FA4BD493C671FFBFB28431F57A540B5E24697A7F87B7476461498C7289BA9670F
+0C
+1
+5BC015D83CA18B3DD249C9FC2FF2D7FCD0CE8637F8B673427E4B27D4FC673B67220CF2FC05216739DE94FC12C4707E09
+FA26ED8484637C43FC2B3875031D2F3164D051F5D7B9AEDAD41C683801A37F90569429E5396112520132C34F5E8B45B3
+0
+0
+ecdsa_sign_stream_sha256 502
+4F349548624C8EFF4FEC174262CAD10B159CBB7AE27DDDE506B8A6C92DFE9D73D5D63AFBBEFF7F11F1ADA9BB8730C602
+170D80E0CE602FE5EB601F6D3AB17611A7745B7F84535A8460F1048085F75C074008429CBFE1B21C447215624FEA6FA8
+CA2272EC17C5CDFBA7B73905413FB7B09EE55F540068A8A969355D0B0FB1216ACFFF765AA3A3826F10068F244CBE2F50
+0
+DE057CF04B3F8E52045E75155903279A5B27597DAC86054041F75AD487B697A27ECFFDB63F86A6E23C568948EA7C834FCDB7C0BC3A861F
+7
+ecdsa_verify_stream_sha256 503
+3070B7951E673F05A08B389BE761C9E4FAC8D1CF83AD580411FF163531F95F941D95074940B268373E07222A0F3C6589
+F9BB4740A6DCF1841970A8091E32853B15460D6AD58CAE6BB4BCD99B1394A422EE6F7CFF562CEE69605B082678134F41
+DE057CF04B3F8E52045E75155903279A5B27597DAC86054041F75AD487B697A27ECFFDB63F86A6E23C568948EA7C834FCDB7C0BC3A861F
+7
+170D80E0CE602FE5EB601F6D3AB17611A7745B7F84535A8460F1048085F75C074008429CBFE1B21C447215624FEA6FA8
+CA2272EC17C5CDFBA7B73905413FB7B09EE55F540068A8A969355D0B0FB1216ACFFF765AA3A3826F10068F244CBE2F50
+0
+1
+ecdsa_verify_stream_sha256 504
+3070B7951E673F05A08B389BE761C9E4FAC8D1CF83AD580411FF163531F95F941D95074940B268373E07222A0F3C6589
+F9BB4740A6DCF1841970A8091E32853B15460D6AD58CAE6BB4BCD99B1394A422EE6F7CFF562CEE69605B082678134F41
+DF057CF04B3F8E52045E75155903279A5B27597DAC86054041F75AD487B697A27ECFFDB63F86A6E23C568948EA7C834FCDB7C0BC3A861F
+7
+170D80E0CE602FE5EB601F6D3AB17611A7745B7F84535A8460F1048085F75C074008429CBFE1B21C447215624FEA6FA8
+CA2272EC17C5CDFBA7B73905413FB7B09EE55F540068A8A969355D0B0FB1216ACFFF765AA3A3826F10068F244CBE2F50
+0
+0
+ecdsa_sign_stream_sha256 505
+0560AEA1D023DCCEB2ED75E9E806A629C36ADFF9BD0608A46F1F48227CF878BCFD073CF3B1D47D7BF9D5204DDA914692
+4739EF609FC09926D4D0C1BC9A0A7836925A0D063EDD356DA55E56522582A590E959FE18A2836FFB4350467962DA3D4F
+B12A5D88A24C50D4F71D406D69D304BF653C8F8701C44FB924AA09094FB250BA9E0D15F9C4D6C78A92C3E6B5E6F3D0BE
+0
+1FB1523F3FB1867E23F0CD344873C3FC50286BF879B0A3411B3EE5EC66010AD08B3B26788C1F3EB32D5927CC7A693A500F5BA10682CBC6B960C47AAF244A1E18
+64
+ecdsa_verify_stream_sha256 506
+444B805DB15C14B076280DBD0AFE014AD6304F9681C78CE3F6AE78B8D8C0EF1671CD6ED859478B5EE46B4F5C7F1F23AC
+0AA5CD706335EC18B52478164F42A2C0C02D6233A2D3FA8A33D2C425950F31C343F4235CCE8546F625EDC2A3244E8F09
+1FB1523F3FB1867E23F0CD344873C3FC50286BF879B0A3411B3EE5EC66010AD08B3B26788C1F3EB32D5927CC7A693A500F5BA10682CBC6B960C47AAF244A1E18
+64
+4739EF609FC09926D4D0C1BC9A0A7836925A0D063EDD356DA55E56522582A590E959FE18A2836FFB4350467962DA3D4F
+B12A5D88A24C50D4F71D406D69D304BF653C8F8701C44FB924AA09094FB250BA9E0D15F9C4D6C78A92C3E6B5E6F3D0BE
+0
+1
+ecdsa_verify_stream_sha256 507
+444B805DB15C14B076280DBD0AFE014AD6304F9681C78CE3F6AE78B8D8C0EF1671CD6ED859478B5EE46B4F5C7F1F23AC
+0AA5CD706335EC18B52478164F42A2C0C02D6233A2D3FA8A33D2C425950F31C343F4235CCE8546F625EDC2A3244E8F09
+1EB1523F3FB1867E23F0CD344873C3FC50286BF879B0A3411B3EE5EC66010AD08B3B26788C1F3EB32D5927CC7A693A500F5BA10682CBC6B960C47AAF244A1E18
+64
+4739EF609FC09926D4D0C1BC9A0A7836925A0D063EDD356DA55E56522582A590E959FE18A2836FFB4350467962DA3D4F
+B12A5D88A24C50D4F71D406D69D304BF653C8F8701C44FB924AA09094FB250BA9E0D15F9C4D6C78A92C3E6B5E6F3D0BE
+0
+0
+ecdsa_sign_stream_sha256 508
+43EF96F9CE3A7A164AD2E4EAA98FD63146251B177E3AFE6C09BE9EEB265E0AE4BE61D004E13C21082DB3E1E795462984
+F0693C32E46EAEEF09A91EF8D66495594150857554EC250E49D59FB031D9C0674F2F6A332148C171E7897EA3CE5596A4
+8711E910E42A80DA868385C85B56BB929E40B149820BB24E8D2AA027D3258454855B5E6C7DEAE7F970605FB897EFC818
+0
+390B3909130A3CFD85C9084108ED4A1BCF16C4D3D59A8A644B700FA949AF104CE1F7B60C26F78C5CAF6B0A9009114667E997EC479980D792F2D095547518F62207
+64
+ecdsa_verify_stream_sha256 509
+C59D89086E02BA72057CEF2F6171C7DCF4312FF042D373251877AACB7D5037C0E81B479F918661B0E7B1D48267EFAB03
+4D5575D6EDAFE5A4D05D6BE21A3B5E213873FF63F2023D7711599CFFAC14C191CAEE8271098BC08EFCBE82E90D853DA9
+390B3909130A3CFD85C9084108ED4A1BCF16C4D3D59A8A644B700FA949AF104CE1F7B60C26F78C5CAF6B0A9009114667E997EC479980D792F2D095547518F62207
+64
+F0693C32E46EAEEF09A91EF8D66495594150857554EC250E49D59FB031D9C0674F2F6A332148C171E7897EA3CE5596A4
+8711E910E42A80DA868385C85B56BB929E40B149820BB24E8D2AA027D3258454855B5E6C7DEAE7F970605FB897EFC818
+0
+1
+ecdsa_verify_stream_sha256 510
+C59D89086E02BA72057CEF2F6171C7DCF4312FF042D373251877AACB7D5037C0E81B479F918661B0E7B1D48267EFAB03
+4D5575D6EDAFE5A4D05D6BE21A3B5E213873FF63F2023D7711599CFFAC14C191CAEE8271098BC08EFCBE82E90D853DA9
+380B3909130A3CFD85C9084108ED4A1BCF16C4D3D59A8A644B700FA949AF104CE1F7B60C26F78C5CAF6B0A9009114667E997EC479980D792F2D095547518F62207
+64
+F0693C32E46EAEEF09A91EF8D66495594150857554EC250E49D59FB031D9C0674F2F6A332148C171E7897EA3CE5596A4
+8711E910E42A80DA868385C85B56BB929E40B149820BB24E8D2AA027D3258454855B5E6C7DEAE7F970605FB897EFC818
+0
+0
+ecdsa_sign_stream_sha256 511
+9EB08955A195C76B8B067DE1C7D853920AEC69CE8F480DA2B449E9144B48C63631CADDC2AA8E6180585D5ED1912F583B
+320953A8EF29D559F8F169DE332D0FA8CB71E26905258061F24C2F29D6C352E9D539148E53560EB7EB44E923DC853092
+E82E20AEFBB6596880B870C0C0CA91F045620834C9682BCCC63F0C604E8E9A70882C42C2F5A5D22B84E2DD819AEEB648
+0
+9433D79FD1129C0D4CE6ECBF54AD50773E7EC1B84BC70AA447143727C56B3F1E2829E0BC063D43AF7D3D9C69FEB2B86F9E2BE0B442BDFCEFAD61E68E27525545BF3CCF9C7440D0320E2ECBA40EFA14612108CB431B30D44A7C16ECFFEE287CDF957D7A13CFB48778501EDFEB320247CA778487DCCB7327
+13
+ecdsa_verify_stream_sha256 512
+F408DD84D07739911E3B40CEBD8E655C1CD00FBE2A817DA015865A4FB74A6096FE1D03CD1613661699175E6B08E17248
+375531D09E9809C9DC1F6915E271EC9B0555D7725224208E57E08F4DE52CFA5A6803D029D1C79B03E98155E1E32868A0
+9433D79FD1129C0D4CE6ECBF54AD50773E7EC1B84BC70AA447143727C56B3F1E2829E0BC063D43AF7D3D9C69FEB2B86F9E2BE0B442BDFCEFAD61E68E27525545BF3CCF9C7440D0320E2ECBA40EFA14612108CB431B30D44A7C16ECFFEE287CDF957D7A13CFB48778501EDFEB320247CA778487DCCB7327
+13
+320953A8EF29D559F8F169DE332D0FA8CB71E26905258061F24C2F29D6C352E9D539148E53560EB7EB44E923DC853092
+E82E20AEFBB6596880B870C0C0CA91F045620834C9682BCCC63F0C604E8E9A70882C42C2F5A5D22B84E2DD819AEEB648
+0
+1
+ecdsa_verify_stream_sha256 513
+F408DD84D07739911E3B40CEBD8E655C1CD00FBE2A817DA015865A4FB74A6096FE1D03CD1613661699175E6B08E17248
+375531D09E9809C9DC1F6915E271EC9B0555D7725224208E57E08F4DE52CFA5A6803D029D1C79B03E98155E1E32868A0
+9533D79FD1129C0D4CE6ECBF54AD50773E7EC1B84BC70AA447143727C56B3F1E2829E0BC063D43AF7D3D9C69FEB2B86F9E2BE0B442BDFCEFAD61E68E27525545BF3CCF9C7440D0320E2ECBA40EFA14612108CB431B30D44A7C16ECFFEE287CDF957D7A13CFB48778501EDFEB320247CA778487DCCB7327
+13
+320953A8EF29D559F8F169DE332D0FA8CB71E26905258061F24C2F29D6C352E9D539148E53560EB7EB44E923DC853092
+E82E20AEFBB6596880B870C0C0CA91F045620834C9682BCCC63F0C604E8E9A70882C42C2F5A5D22B84E2DD819AEEB648
+0
+0
+ecdsa_sign_stream_sha256 514
+463A417121FCCEB7ABB6088E51E3F0E90FD9C009770C22ABC2CCF9FB035D3BB783325BEF6AE3C5FECF54227C09821E1D
+6487BF98991F50595A489D29AAA657E7A88E45D414AB6C6DD1EA888E86340C3F6E0F6BDC420FEF10389F93F25FBFB3D8
+5BCF1897DFDFAF5F4017FE341453F18A28C3BB6354EEEE31DEA3A0E31AAE1C7AA8DB57E06414A1A0B03A8A2D21799401
+0
+4B06D2E6B15A8A83E287CD31B0D5F2043CA428033AD145849CA9C591557C78E47374D4CC28ED49C1BF4D16EA9F0A2582FBB2F462B9E04D084C6245E96AED7515F20972C5DB510CBFD1B828B18F9130FB34D2E4A7B0BA8CFB370A4DB17EAAB0814C2A2741FA8809DF80863E372DF15B3E3AC610650E0B84204FB243DFBA1FA882692C86A2F951B27E92CDCA10A6469DBE85435DA915ECF6485020983AC4000288A26F18EEBE8F398A0F2713CB17A37099CBF2901613382D6749F6958AB14DDA8C25D51BCB74266D39
+1
+ecdsa_verify_stream_sha256 515
+842D1067E0A3CABCA66409B57EE2A39CEB3379DD22F10729AAA96BD78EA3F1C7775E5A6C490EB8B05E3B7354802B0D03
+A89573CD5D279C3281A82B83782D74849FF352626B296CD450BAE633C79290B8CC7353796B3ACD05C564CC2A6090685B
+4B06D2E6B15A8A83E287CD31B0D5F2043CA428033AD145849CA9C591557C78E47374D4CC28ED49C1BF4D16EA9F0A2582FBB2F462B9E04D084C6245E96AED7515F20972C5DB510CBFD1B828B18F9130FB34D2E4A7B0BA8CFB370A4DB17EAAB0814C2A2741FA8809DF80863E372DF15B3E3AC610650E0B84204FB243DFBA1FA882692C86A2F951B27E92CDCA10A6469DBE85435DA915ECF6485020983AC4000288A26F18EEBE8F398A0F2713CB17A37099CBF2901613382D6749F6958AB14DDA8C25D51BCB74266D39
+1
+6487BF98991F50595A489D29AAA657E7A88E45D414AB6C6DD1EA888E86340C3F6E0F6BDC420FEF10389F93F25FBFB3D8
+5BCF1897DFDFAF5F4017FE341453F18A28C3BB6354EEEE31DEA3A0E31AAE1C7AA8DB57E06414A1A0B03A8A2D21799401
+0
+1
+ecdsa_verify_stream_sha256 516
+842D1067E0A3CABCA66409B57EE2A39CEB3379DD22F10729AAA96BD78EA3F1C7775E5A6C490EB8B05E3B7354802B0D03
+A89573CD5D279C3281A82B83782D74849FF352626B296CD450BAE633C79290B8CC7353796B3ACD05C564CC2A6090685B
+4A06D2E6B15A8A83E287CD31B0D5F2043CA428033AD145849CA9C591557C78E47374D4CC28ED49C1BF4D16EA9F0A2582FBB2F462B9E04D084C6245E96AED7515F20972C5DB510CBFD1B828B18F9130FB34D2E4A7B0BA8CFB370A4DB17EAAB0814C2A2741FA8809DF80863E372DF15B3E3AC610650E0B84204FB243DFBA1FA882692C86A2F951B27E92CDCA10A6469DBE85435DA915ECF6485020983AC4000288A26F18EEBE8F398A0F2713CB17A37099CBF2901613382D6749F6958AB14DDA8C25D51BCB74266D39
+1
+6487BF98991F50595A489D29AAA657E7A88E45D414AB6C6DD1EA888E86340C3F6E0F6BDC420FEF10389F93F25FBFB3D8
+5BCF1897DFDFAF5F4017FE341453F18A28C3BB6354EEEE31DEA3A0E31AAE1C7AA8DB57E06414A1A0B03A8A2D21799401
+0
+0
+ecdsa_sign_stream_sha256 517
+7D7BA29CA117700510893F97B3506FA8B826D751C421D9EFFEA5A4E2595433A25C7B128B52D891C6FBD2802433C34304
+3D7004111FA8AD6E23774393C8F8FC522E09CF73BF133D9DC7C56BCA1226411949F491105175814678B1A65A871004C3
+7AE5804247018ECF14DCA83F8B03F31BA090DF41A3AC6D5F2DC3679189A30F15250F161A31FD48F3EB21B275E879BE61
+0
+A2D420538311DF153C08F872E03D46DD6D26D149A3612A435B4FAE747D195EB648D5E8B74134713845AC7B7F2A793051591F2F354B70FCC99F83CA895308E8CFB0500F4A027D59CCE0E265C27970DCC8F6A5257B787DEB2D0B1FF4EA83AD92BDFA32B1A7A6D4275D5123E025CBFCA5179946D6D3612A726C590AC8DAEB332A50FB453A275829784CD1F659745C052845E09767FBE16B52FF66557C8A898EE8C61F5D7956658E72111DF6DD28587B6703E282E9BCBA3780C15A9B884F5E5BA419A4856FEC41132986C1B54783E277FAA83FDC1E47EB75CB31A31B019A6A76EB5576B73DC2F4C7AC0465422F38C0DB0A30086707E1AC5B41353CA11132E19416C6CD499275413D08BB4AEB55003EA2078B450AF5DCBFEE3556E62EE0C7FC24022B183DD80C6B4C9A335F21F6CBC3B1674642CE22DA0F180C8A0FEEB6702CAFEC0C43D795CCC7E0850B4967290C3EB30934CF9DD9633809F6E1769B9F4472B87A9637D43EE45F12BCB24CBD275C41E0CDB89DB0FA4C5535484AC93CF5A49FDF9374961F9A494995ECCD1F48388E6E0FEA
+100
+ecdsa_verify_stream_sha256 518
+517AABDDA7B777FF2CCD25206B83D51CFCDAAE2C2C3EFC4B053014D57982BDA060C5DCA9793375069119C2750D4A6402
+3DC04E8D858C4D69E5910676E70FD6A454BE1C0CE05901681C24F0E9D6A786CD2ECAB7950D6493396DB49BC48E444FDD
+A2D420538311DF153C08F872E03D46DD6D26D149A3612A435B4FAE747D195EB648D5E8B74134713845AC7B7F2A793051591F2F354B70FCC99F83CA895308E8CFB0500F4A027D59CCE0E265C27970DCC8F6A5257B787DEB2D0B1FF4EA83AD92BDFA32B1A7A6D4275D5123E025CBFCA5179946D6D3612A726C590AC8DAEB332A50FB453A275829784CD1F659745C052845E09767FBE16B52FF66557C8A898EE8C61F5D7956658E72111DF6DD28587B6703E282E9BCBA3780C15A9B884F5E5BA419A4856FEC41132986C1B54783E277FAA83FDC1E47EB75CB31A31B019A6A76EB5576B73DC2F4C7AC0465422F38C0DB0A30086707E1AC5B41353CA11132E19416C6CD499275413D08BB4AEB55003EA2078B450AF5DCBFEE3556E62EE0C7FC24022B183DD80C6B4C9A335F21F6CBC3B1674642CE22DA0F180C8A0FEEB6702CAFEC0C43D795CCC7E0850B4967290C3EB30934CF9DD9633809F6E1769B9F4472B87A9637D43EE45F12BCB24CBD275C41E0CDB89DB0FA4C5535484AC93CF5A49FDF9374961F9A494995ECCD1F48388E6E0FEA
+100
+3D7004111FA8AD6E23774393C8F8FC522E09CF73BF133D9DC7C56BCA1226411949F491105175814678B1A65A871004C3
+7AE5804247018ECF14DCA83F8B03F31BA090DF41A3AC6D5F2DC3679189A30F15250F161A31FD48F3EB21B275E879BE61
+0
+1
+ecdsa_verify_stream_sha256 519
+517AABDDA7B777FF2CCD25206B83D51CFCDAAE2C2C3EFC4B053014D57982BDA060C5DCA9793375069119C2750D4A6402
+3DC04E8D858C4D69E5910676E70FD6A454BE1C0CE05901681C24F0E9D6A786CD2ECAB7950D6493396DB49BC48E444FDD
+A3D420538311DF153C08F872E03D46DD6D26D149A3612A435B4FAE747D195EB648D5E8B74134713845AC7B7F2A793051591F2F354B70FCC99F83CA895308E8CFB0500F4A027D59CCE0E265C27970DCC8F6A5257B787DEB2D0B1FF4EA83AD92BDFA32B1A7A6D4275D5123E025CBFCA5179946D6D3612A726C590AC8DAEB332A50FB453A275829784CD1F659745C052845E09767FBE16B52FF66557C8A898EE8C61F5D7956658E72111DF6DD28587B6703E282E9BCBA3780C15A9B884F5E5BA419A4856FEC41132986C1B54783E277FAA83FDC1E47EB75CB31A31B019A6A76EB5576B73DC2F4C7AC0465422F38C0DB0A30086707E1AC5B41353CA11132E19416C6CD499275413D08BB4AEB55003EA2078B450AF5DCBFEE3556E62EE0C7FC24022B183DD80C6B4C9A335F21F6CBC3B1674642CE22DA0F180C8A0FEEB6702CAFEC0C43D795CCC7E0850B4967290C3EB30934CF9DD9633809F6E1769B9F4472B87A9637D43EE45F12BCB24CBD275C41E0CDB89DB0FA4C5535484AC93CF5A49FDF9374961F9A494995ECCD1F48388E6E0FEA
+100
+3D7004111FA8AD6E23774393C8F8FC522E09CF73BF133D9DC7C56BCA1226411949F491105175814678B1A65A871004C3
+7AE5804247018ECF14DCA83F8B03F31BA090DF41A3AC6D5F2DC3679189A30F15250F161A31FD48F3EB21B275E879BE61
+0
+0
+ecdsa_sign_stream_sha256 520
+7269A0D7C19A232473FFA5502B0D35EC0F701D09C40444699F7913BAC354C0A7497054915A2EB8093AD7E0F0C0618989
+BEBCD860E7D4269CEC2E2D26446BBCC07EAD9A5B9DFE331D74FD5C4FA561D86646AEDF33092E448A66ABD6DDB93A2F47
+FE9698E8B224D71F98E61006050B888698A67679D97C007F0B119018A9A50DD2F44F6DE4FF9F7465F30B669A3F0F9BB1
+0
+EE07C5ABC07266A0D9D2217A9271B47EA7452EF956B6962F6E67399A1730872081FA837C5C2BFD781A1590981F194CE5F364A5FC158191A951EE5FE626B66F7694C114671FBC2720D3FB06F272E4B5E51D4C8A3AC4E2019A33A17B14D9FE985900F4694E8D4A194C883B3C72668816BC70C9645AF94324D5DB31A5CF13B52B29
+400
+ecdsa_verify_stream_sha256 521
+D8238E9EC888BEA4119592B91234F80309BA949DC6CB8EA2CEB8DBFD088E828092DA02F33D182DF22E8A8C23C5DB075E
+7AA99EEBED66F1BEE64D10C134FF40D3F7699D3105E8681F4208F2BBC13067DBAE4C2F7919239CFFDFD06C65E6AD9534
+EE07C5ABC07266A0D9D2217A9271B47EA7452EF956B6962F6E67399A1730872081FA837C5C2BFD781A1590981F194CE5F364A5FC158191A951EE5FE626B66F7694C114671FBC2720D3FB06F272E4B5E51D4C8A3AC4E2019A33A17B14D9FE985900F4694E8D4A194C883B3C72668816BC70C9645AF94324D5DB31A5CF13B52B29
+400
+BEBCD860E7D4269CEC2E2D26446BBCC07EAD9A5B9DFE331D74FD5C4FA561D86646AEDF33092E448A66ABD6DDB93A2F47
+FE9698E8B224D71F98E61006050B888698A67679D97C007F0B119018A9A50DD2F44F6DE4FF9F7465F30B669A3F0F9BB1
+0
+1
+ecdsa_verify_stream_sha256 522
+D8238E9EC888BEA4119592B91234F80309BA949DC6CB8EA2CEB8DBFD088E828092DA02F33D182DF22E8A8C23C5DB075E
+7AA99EEBED66F1BEE64D10C134FF40D3F7699D3105E8681F4208F2BBC13067DBAE4C2F7919239CFFDFD06C65E6AD9534
+EF07C5ABC07266A0D9D2217A9271B47EA7452EF956B6962F6E67399A1730872081FA837C5C2BFD781A1590981F194CE5F364A5FC158191A951EE5FE626B66F7694C114671FBC2720D3FB06F272E4B5E51D4C8A3AC4E2019A33A17B14D9FE985900F4694E8D4A194C883B3C72668816BC70C9645AF94324D5DB31A5CF13B52B29
+400
+BEBCD860E7D4269CEC2E2D26446BBCC07EAD9A5B9DFE331D74FD5C4FA561D86646AEDF33092E448A66ABD6DDB93A2F47
+FE9698E8B224D71F98E61006050B888698A67679D97C007F0B119018A9A50DD2F44F6DE4FF9F7465F30B669A3F0F9BB1
+0
+0
+ecdsa_is_valid_batch 523
+1
+A982039C7E378997517CBF15F468820EAA4BE2B8395D507DDDD8CA47937B862DA0E6D46E1FEBE1A75751EE6DF2BCAD7B
+28D1B14CFD6162A592AE5ECE0E8F09EF253077872B67572B9A5CD4ADE8DFA241D46F8F9A1AE05C30D1CA701BAEB33AE1
+19B27BA4DDD09D631F69D1EEA6B6FB3E20308F232A11E11516FFEA70B23FBECD422D6A3531FF82C1A17E79DDDEEB24FE
+20BE08ED1FF4DEFF6B7605AA0CDD01E2FBBB8E28E3CC8C7BDFDB73BE8EFCCE0D3429C755A7C899D45512A1BE9A48D89D
+9436AEBF00736E16CF4C66E541D98D88A44257BDF802DC686C5AB2875A537F4FB019BFE1425EF67F6A1110D02D9F7D81
+0
+1
+1
+ecdsa_is_valid_batch 524
+5
+B02CBDE01604FF6BA7D24431036AD453F9A79D2F495C6F845A94051865AE81FB1C850F383461177ECCD4C04360A20030
+B1813EC6F534F29FA95B8DC90A99D883D8ACDDC21E54D9D948E1658E0EAFD7F993CE29C9A225C360CC7E597A13347414
+A2E9C82E01663C74B9487CDD0CD281F16B1FF5ED7AC61DB821107030B3128F63092092BD04BD6053FF435174BAFC8F66
+9005B4FCEA5DB54B5D7ED8012EF4622D8F25773DC1F8FACA16DF2CAF2672BC2DE1E6989FA31CF87BB7CFEB3DDBEFD49F
+1CC70A0CBBBCBFD8783494BC4B41DD5870CCF3EC800EC442D567A5F9E08767A59680A9A68A35F5663365A4B6BCD49136
+0
+1
+13D8B1B18C26F573F829090657AC586083B09EE7ABBB880E34BBF462BFC8AB03FEE5361DA1511B87D10F096727BAE7CF
+C0A97B9127BA1B4442CF135090F5C1A5F3A5919588AAFD3C87117A9574D2F10036AAE5F2EBD6626115A5E42AB82FF4D5
+0C3EF300DE2DE4ECCAF060605523AE289D935EC3CC40198D54E28D66632D8A29291001A3672E845A5BDCCFE08AB4519D
+9B11642CC6EA7466BC73AAC79AAF6055F2B0BD9FC76B39B78B77366B29678C28BC472EDE184449CB1B9B8B9C938A02B7
+1ED7B2587B61F1121229D89725159FEDE1D1278A3473A024D40637ECBDBCE705076B9B41DF572F47DDE1AC28266B07C1
+0
+0
+59387C58C9624BA1E43073BB8C562256ED767523BA5C821945391AB9C164AEEDABD87A4460B6B0E3C3367F8773CE0123
+9CA411769D38F585A227B09686481AC41EB95226705EFA14D76090B962E3807454A1482574BA501D4FFF0075FBFF2C49
+9FB0961805AD65B943B0C6F61C19D075981385C3327785B7CE047BF1CACFFFF39961571ACE2FE53E447CE571CB5CF17F
+C46A3F9A70C4CCFD3C71937FF917D7DBCC22FB82F3750C3822EC03A7679CB58702B7CAC04C2D428488C08F8635DCEE54
+1E3EB12E55F6D0548994E25F0F57D503E30173F353BF751341EA8EA2998053AD429088ADB98F916394DDBCF32E57661B
+0
+1
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+6E892332DB67442C96913FA6D989ED7DEC3A7D0FD9C295828C5706F00332BB1255E4F42A8478D3711FBF6618C55FB41B
+4FE1E54BC1E5A024F0C8DD964D6C9225AE88D3FB6C91360EAEF84BE1F1483D0F657F84FD966EB597A8CFE43FF878A44B
+B65217027177FCBC32989E138D0B9B14F8E8A20D7F03035F630AE667180AFF0121073E31DC662C6EE311F3E44A07A28A
+283C59294A0417284AA87544B97F68D295FC86EA3EC5D1CD7C240C117D1F3360AE92545450627F0E068B0FA2806D985F
+0
+0
+95D84E456090B9CB895C73F4840A65EDEEC12D905F595C0578A7DBD482BFB50970FCB32B08E573DE683800EFD28E4678
+53D0BB829653133BD734FB6B823CEC3A41B767E6F4424C952102F499ACF94B2196B2487282C714F1F9AE6F31301A342C
+57D786901D82A458C1A5E8039AE10252C53D84181C1701D98C22714584B39D88B5C76588451787D40FC2F7DFB62DED16
+A3A38B7B358D0A7D4898C55A9BD90EA68300A6326BD3D746D707A16D450E9F27C60C7FEA2FECE83B501842F0F368CAB2
+582648D64629B67DF78B8F8F9E074B41AB9ECEC13C1C8FB2B814F973A068D426DBE1FFC72BD608567A5064BDD4327E69
+0
+1
+3
+ecdsa_is_valid_batch 525
+3
+73C3FFC568F04D245DC35FE4537A538013DCC561F8A9E8B13B0A4780D79B49C1D5677C5DB1BBF1369F4FCF0F2FD6BAFC
+B84F1D893A86B84728A0E57BE8F0B3F6E1B571FB9E4DB22F24587EA5F9942350DBC44C0707938DEFE0DE4BD4FECA6F1C
+95BFA6F24E4D60329D1BEB00A1DB935A574D387FDB57A3653892A783ECB2604A83EC301428981DF23523898730593BA4
+69CA27E600DF13EDDF510EC66B316CFD0AEABC3864CD116AB28743CD13E105F810752D1E209AC3C3BEF48D079995BE33
+90AA3BCD6B99548D0FC980C5E96A2E2E36AD514C410266544036C87C61B4DB8F7E46CB4CCDA965E8A9F6253B2F30D415
+0
+0
+2EBD331CD0739FC8A1D7C9AAD13F35831EE21B29ED99F87C7B2499AA7947F00AE02C2FCC503B43A6B8F1717009B221B2
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFC7634D81F4372DDF581A0DB248B0A77AECEC196ACCC52973
+B04CAABBBF8AF236F783DDBF85125A6D67DBA166C4DC98523B22B980E4477CA0E332D0818E9AB2846E3975D6F3FA646E
+2BCE0F9C3D717353A966375E5DA26B2BCCB8013D4D2D2A251DD77CB30B865006817A358B9BAAE85539818F3B5FA055E8
+EC35F5595096B05999ABE78A9DF7770E2CEB8F2D7F856EB6E6B91D90BEF58DC13F5CC85C9857AE7E881DA0768FD8C77D
+0
+0
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+85637EA9667631D446A7BD19100F1870DAA439CA9228321C1119026D465895FE9B654944EDC5E4BF688AA3BD7A62C924
+3D4125B2BC3F6E8CEBB94EB649E766857336ACA35696B184BDC1BC693B6A0A7B1B2CBE68C26E8FF05BE8221AFD4A36D2
+67265B925488152237146B1F5A893F6D69A0408C040BE96695A54B69D3E0C990533B78668E1F56433C028675916E51BD
+EA9BA20CC79871143B5DC15E1353FCAC76D168F60981751FB0DB73DEC1AE0309623CD4182B35F08D73B9290EB4F0980B
+0
+0
+0
+ecdsa_is_valid_batch 526
+20
+6F5CA33C60517D91EA7C9ED9AD567D55D60431A75085619EA2136491252305F2807ACB5C51796FBD083CCE6832F7C5FE
+BA68CF77C8E4F1029377E2FE6703396E839E332F9799DAF90A81E6EA314B0A3888289614C5553A0B8DFCAB18B6169C5E
+5F2E6986E07AD12CAB8C2AB977EC2FDBF3C375D30FE191BB0D601CDE30AA1793EF80EDFDEB404A1C62B74CB80BEC3BB7
+5F713FDBDCD85879EA29D7F47877740694444174E5A1E4241D69A4AD1B3C2D1F21F6881A2904F3272BF100B2203C0237
+5D6BCB4271A799143A56B873FEA18506558230DE5DD80C9C012F2A882F72B736A5D20C732BCA39A54FDAB4B676FEBBA6
+0
+1
+C7A7A0AD155F1B42B3D732C489EC3808013890642CC990B658B7E878D53CFF645F0DB3A71AD9E09B49500EC0241FEF11
+E88044573E736F2EC887E9FD82F1B62924DEADAEFF577DFE8BAA08C32924A29D513654B560EA0FE0C337A8656B2D7307
+797222ABCD7D64A7F836A6CA219211D2DB71A343DFF6924127C3F64C0BF8DDED899226EC1C2BB81C0605601139B38516
+A2B0B829BDD619EB5F159C3EA6D86E95A9610B45A4B1D12CD224CEAEF5886AF096581502365CED8B35509D3C00AD8B83
+EC4A10CC153CD3EF8AB0D018C58DD3918803CB461C6E9CC49CCC0F2493DF8D47676C86AEFE7CD51496E842D02384433A
+0
+1
+90F53717849C4498F4908B57989C9332B2CA77670090D389C1F144231A2BEBFE92A48F6A7FE32369135F2CD9F5EE852E
+52AE457F33A1BBA6222B31D93D879C7D87DE13CEAD44AE4CF962A0FD43859D5A6B05B193919D650949D2C2D52941195D
+F224D868026466DEA8551B1B33A5EACEF3FA0993A8CD0069BE185EB6DBE940B9D4410EDD64636B4E5F4862311BB22620
+86099D714EDD61D18A84260C44AE4D5B1E3778C248C0528946AA682FBA638A23C7869AC0EDC40D57D1E0DCFF7C888AA9
+E4E5AB12D86967D809B19DC7363B23DEC602B8407C6F9FCFED997DB41BD6F8760294F5DF131DC1A16B2A1A3FCB021576
+0
+1
+83DA289C1D02F4B75A388EC3D09D938D625B21759037DF5DD4DA11AC831B88B0BADCB746255A222D647FA487873FC227
+E40753A0BF16F73B18B52C9CC24E129AC0310911B47C0AD0C71CE15261AFD0A073FB2552114BAE35BDA7FAFB23834D13
+AB7CAF6974ED1893891FA69BF64E01A63F42A643EF5415D14340C8B2C66922250515C4EAA53FE9A05EC934630C498C8E
+A1A95D91AFC4645C11957306049E98E621929916A7AB4999B6BE43F0E9A9388044D891FD920BA50A725941009E52DC32
+F98535ADF1597F038F5A1F1D4E2EE2BE2EBD40DAD11E397D953DEFE2E3EE48C55645D5A1405E7E0BC984BC47740D0F1A
+0
+1
+32A59F74C9A5804F931633F4EB008CBFA3F4E40C07466E2CA6D54AEC8FF9E960040D2CEFD20FCE867A0FDF9ACB99E542
+708BC61234E2F2531624236350387ABEF0C8F2CE20CBB32AF4F9540DAFAAA471ADE7A1DF1F09955BFA89357DD9925C22
+D5DE9CAB306E2726595BDDD621E5A5FF9E705321DFE32FDB8C4CD89F51EB24C90B6D8B94CB5FDB00263457A19896C6D3
+67C621C82BFBDF6DF2721A08099BE5EF1FCD4A69CAE5EA4E3E8AD2BF6B62F5D0D7D718AD3541E650B3A67FD31C57A998
+20DEABCA63A2E6A5B80C6FF551DDCE6005F71A9C967D6E10A47BED35749E89E1BA90AE210A3348D9CD07F0C32EEFE3C2
+0
+1
+DE8EF3BE5484026B90EBA451C0C96053DD51CE4A2274DEECAFF61F522B241F1087054700DC90EF50613AECD98F650CFF
+3AA2A3395221F632F27747C7FB8A30CF6097FBFE214F13EA502808E0906AD53CD6CB987DD62A59DE53D85F1C02327051
+3324FD900E30B0E32E9A3E62EBAA0BCB886E400EE686DF29D8F791D4809798FAC22B1576084C0274D852982DAAFF1909
+7DA21634FC56D2C1E8556887FE05C82DDB58F4C8055F099BF4C1BE43371796482450F956CFC793C5DF7D4DDBDF7702D5
+DD6586C7F34E8C3BC1800170B71077782021FEC2CE86839F31814D3216D542C59F1A17F06E1230639C9E541933489190
+0
+1
+80DAC0A919E1FBDB244BFEC99075C71B6C23C8C339EEC5F596BC8B371737EE520B20D23614F3AB0EB91327FEE92C991C
+E11553AC6FD3D079B53A3A84DF9FD13A6905CF7E3CD7092A3D7C4140147A61A9EDD18A51830A9F9E2AD8423D47BEB2FA
+98D5B80ADBE60EA2292CCEBE688762CF7FFE0ADB118FD7C8F6F04C60281327295D1F5CC120AE788E78D00B0670907B8C
+38CC1E29F961A33B60F23A5DCC02C3C24856B60390C1CCC271AD7A4AEFFF92235A84FFF6BFCC77A6944A4EE74B88D7F0
+58AE56F7BBF319316239ECA5D83EEECC762B583D3864BCDF5883771E8287866746849EF2CCE4596AA23DBFBCFB4F1785
+0
+1
+A33E406819779DD5BECACD1CA4337A4EF04D1EE2F2E5E53DD055ED48364737FF4973150EB15C4A11D962CA35F70D7DB9
+02EA40B54763FD0A001D4993CC6EC84A98668BB7528C1DB107B658D562C5561C1A413151B8719ACA5FCA1D99589D3B10
+E42A120E6265D0DEC67B2212A829E26719983DD7A0B6A4D75CDD6DDAD5CF575B50809673A03B3AEA9E11C5F311982A1C
+A3F43D0931C151091D9BBB6801404086C4492C0F4F8594E2A677C8A2A54603FEAFF2A11F323ECDFACC665280EE2BAECE
+32273A5DA21B895806A066C1D1B94816DF8D9920D025723328D4FDA017AD8BCBAC6317F15A24CC1183A258F6C581D80F
+0
+1
+DCFB6540921432250B0A9774F266B2DE678794667A9DD4066EA4D49475566D3870D218F735A18CBF6BEDE9D406BB9A30
+5CD7AC59A1380E299DC0FCC59F8ACDDEFDCF1520C5A64F6E3B3F41A19943DF207FBCBD83C9B519B7BF1FD394D68CE253
+72D13193579E7F0C1FBABC1BCD6FE9DD9F3BF10D70F89ACBD000C49E8E91FDD6796BEA812EB4A769ADD19E31236D97F6
+13F5F3CCE5A08CF514BBA9DB124B93C482468922FF5367431DFCA9FD2484316C8B2428363AB054C4BE63A5A8516258F2
+72A92F0A2360197F250B5A6E6EF225B511210926A2549EC3316E25A431ADBB2A70C084732FAB9B5EB76F96897E207E7D
+0
+1
+4C2CE67AB3CD64E10624A06F9F0968A761088DA3A2CF44499BD336B4DE005216FB8A336EA1B1A3300252E082196C8CC3
+92F8CBA96B5B068D4EC3A99966DFF87A31433CF65C2A52D69E7D10F63FC2E3578E23E1B1843BE94D6BB2FE5E268949EE
+4BA44C90A000DD8C50225A851BA6C6F0CFE1E6D022CC4BD26474A9BDADF1D5867F2356E1D507F41B8BEDA3260437AACA
+1C259D9A914840603000384A2B2B4A7FEFAD4011F4EB5660B10885CF2E3F6FB758C6D7624DCBE1E11F1EDBF30BFB4F32
+7499094C59D4780FACFC72EFE96824135B3564F29251F16632C9DBE888320603F9A09DE5AFCB226F2D3A4ED739172FC0
+0
+1
+31FD7B3F695C54D334E3B5B57EFAE109AE227B0D72F8DDE7DF9BF364C356465986C8E17EEFE27198F38867B044AF9E72
+926F76A71301C56EB99CB28C8FC9ADADF15252642F5F0EBD0480ABA59D1159907FEAB43F721DC49CB805BBBC6098B304
+985F4670714D8F284CF2CF072E1638CAB72FD6822911B6FAE8FA20550AA7E83D3991E5834C2490C70D1100E92408F538
+1828E9E55F68C032386B8EA87302E8771FA2B191231C50C61976FF7FBFC328ABF965A2604FEF7DB29C0A2265BB40411E
+21ACA753AE5FF9DF1137316F96D7E57D9F1BD6E107EC95ACC3A5E6EE610F384E7F0F7C9A9E29771A0ACC0C6D95AB2325
+0
+1
+637D9F870D2ABB1EDCCA060EC4AF6FCD25AD0B954ECADC936EC8F421909254429A84CB565AED6481F529D595E7EE774E
+2688E8A30342E2146FB26A7DE4EDB6AFCEDAC78E16265C1ACE895E35864F9E5166D8DD4759FD1F2D51102D72C90E4793
+3F5935B4066C2DC4655FEC3714488D3321BE65FC184A7E899CAAECCBCEA71C491FBF1A4EF91905EF2D102F83C4F4CD84
+C074C938492CD455191D395242DD19211FA1E699CF745F62CF7548765784C4B4BEBBF0636A610354A98E745EAF07E413
+C90116044F9E751DBCBDD92F3F49C12CB6DF693184A6A4D6B7AA74D27742D8B77FC6BE2554FE5D6979CB9C7C7B344BD7
+0
+1
+C178300C39CB0C952EBA28952811FC390B367963B0F1C7A14FA71FCCC9C18035E67554DDDAAA75E5244927AA28D8999A
+11EE8268FFBDDB5FD173D0EADE5423D6FE419B5CC50F82003530DB183C1A55D308483338799A5278B3E6BDC75169DBC8
+2D04C1CA94FD00AF6DBA6F7DC507D3E49592A2175D97A4B26D3F9E032473E9F4894FE1D02E7F8DA5F538A9D7070A7BD3
+18E7293346A5C783975BA37B054993374C7FDB26FDD1F74D6F0FFF225E785B062EA2E045816700FD93D8193D7B0F9055
+2BFE8A7BB489DC427CA64AF8C1BAFDEA398C4002279E4E8AE95FE6E965CB67CF16B6E9DB667B48CEA0B2683BE9FB2F84
+0
+1
+9AB046E5E2E7BFE063B1E4F39375BF637F88271B7DCD8264B5FC1F4DDBE5A6E23159F40C008AEC162D6431116C4CC944
+41A2F58E148826F2E499A369E23FBE4211D3946BEABFFD9B8B0AF3F76D426B21B6CD823841E6CC82A9AA6156886800E0
+0A9BC9D23107EF50B7ABE6A6F58746C106F8D9830F9ED2FC72F2923CCD9C06C367222BF5CA66845F5C866FCB39BAE705
+D48DD98F18D8B89C4286963EF8F0E169C5CC6B10BC28B3B4C60626C3BD4956B3AF33F03C3CC54DBF5D2F828B622DC2E9
+35C76B949D38B2C44554C0309063290F91E3CED717278A44293D6BC550AEEA47053C4C38F16D21878A1348DEC7BABE32
+0
+1
+03723CA1171A4228494984D4950FE6C0ADFAD336159A3B84AE4141913946A12ADC50040785EAF43DBCD51100952DEA78
+B63EBF9F4C275D33C710AEF37D219ABE59C6682FB988C218E1D380A8A8136323C867DE3A122FC9608EE576F23632F74C
+93354CB9C3B67C4938C11A0F71E5DBD5D4DD301079AC5775C6F1C263ECA3A2CAAD9838AF4EC90812B5D28D46A0EAF33D
+2A6E1F626FEC1E543CFDA28C5C8821B3C3904F0360DBE79B179C9E20225C0235D825C9114A1F0AA0046A60EC4818EEDB
+3ECA9688452A585D96514ED6230AF9E87C724EA43C10030A9BBA6D50B4A12546A371ED0E350BE111906FB70E6BE1D8C9
+0
+0
+51F1EA3174EEE1F9716864781D236A0F8B60E2172285A02A63DABB3C5617D31D5DF9D85D33FC003370279D261FEDEFC2
+022B5FC9A5D52BCB6F3EFC5202AA1A3526A89ED3BD384C875B8BA6DF31BA059FFC94CA787FF51C953FBB052D127B01A3
+087535E4D79200C9D04ADA7442914E8FE1ADADA64D0DEB6A0E06B85B9A4D9D9710F9C115DE113BCBF4AAFC615670E224
+340BD75FA94A90C17AB37E8F144377E00DFCEC97578F60354702C310AEC5E67FDDD9B324D3822D90A04165A45FEBA80F
+7770872202701299FCD5A755EB43B2ABD0FC2E0B892D0A1ADDB6CF8753C4AA6DEDCF44122869A57F3C2AA2744E3DB8CB
+0
+1
+CB2FF896190AD3E6B2E50D7EFA20CADE64AB2ECC7D68673BFA7298D0D04C4C1C27935ABB45B663D89A544D7821269699
+2C64A530BDD28DB4FBD98C4B756401821D9495B64D523A9F1F11E193AB74BB6776E7AAAC21D9DAFE253B5A403DF30F66
+D9AE1E727F12071BCCA240522E3A7999984092214A5DA869777D0E78872E966C292D3F8614DA6F09647E68ED66DD386A
+D05DE23433C8DFE5DC32800366B2C435AAB11129986B94F57A01B1733450F3B30065DCCDAD6D3774905F9AF86243A7C5
+161AE19E57B87BFA82409D374B9C39E57A5BA3A0CA6764CFD12D17ED268BD73A0E74D2E993A9FC07A11BFFE73D37D8C7
+0
+1
+822EABADC2E2711067243BB8254CE99CEC595652600D0C1245D98159EC3A3652303911D1E6F2552EF5D18CA8E759B76D
+B2BD385C36B4DE6619528EB66A01EA36F9B2FD1081B72E29FF26C47701E788FB09CC638EB7AE8711FABD023084F911DD
+B64EFAD80145345599AF322DF8DDDFFA4E215FF0C50245CB85CAA00843F660169CC39C0503C586579F90152BB7515311
+DFCBE5BAAB89CB03442CEF715437CC98B88C489315484BA8FEBFEA1F812FAD27120CDF6C3412E868D747BCF271D5504A
+FF10CFF632EDB7DFD38BFD12F82D71FAE65DBDF62393C3610134DA44C78CB6D737759E6BBE2191B6ACD8BB52D1FA56DE
+0
+0
+ACA90B778C1E27EFA9307F667C1062EAC60B938506543DA2411BDC462AD6E1F2569D34877E1D68D306DFABD9A3D3445E
+088ABB1750ED2FD9210A688105051D28EE172B1EC0BBB3BAB857644B41139211E87D173DA768D690CC511B7BB73057A4
+07A5A543925AEDA60A6FF0F7F5F5C184E631BA72A7F8F4CB1AF98AB7FACEFC68B87610F566A92D24711AD53EE789ACFA
+6E1F7CC66650CEECBE7336E8C92A509E555FCC200835293EBC78B975F27E60FE604BFB2BDC3EA4B1CA445B6534A934D2
+CE5516389DB95E32C0F28E4A7E17763ADB892991F9E653C456C688610500DF252F543F7454E1C38ABDF7F76798FD9900
+0
+1
+B53364FF1F87D46327251E397D31E88A2DE9BDEF054BBE0CC6D5A6DA730D279A411DFAF2DC04B56918DB7810FD09D709
+9AE206D05577ADAEE6BAEBF3D3F8359DFE7DC80B0B5EA66A08E7E7BB794EC1DBA429FFAC86EFDD9E9A4E9DEAFB1B7200
+949FA92A3099AD62F574DCAFA357EFD7CDAB47504C94A8EE0AB6521BD5EACF62A020964DAF29D5510215CFA1FBCDF161
+A90538605C08941344697AA8AB97EF1FD7A65BC6336BFAB38C5DA8D3ED0A92D5541974E1FE3ED14D2816FE35204ACB44
+9CD96B46881122E5CA6D56771AACD1CE6A6A0E11F5653C85387F33B36F90225F7573F8A4D0B5105D6CA551E9934A874D
+0
+0
+17
+ecdsa_is_valid_batch 527
+33
+3678F0A01226C673865B57C5FAC0327391796F13932A2BD5082534C44742EA52919A7A79F6CAB6B16E5CB294B65555A2
+3EDD73B6DDEEAC9CDCFDC47243B0932C29149D583DAB87B2F52959B70C4918DFB81EDB58FF4F33A0F953F31862EC8C49
+92E33FE861DE5F585DF0B10C5A4C208BACC20A8FE0B22D0292057B9D6E2B9CE4106D8CAF89439A8E148FE734C00580D2
+053E791E6351238C248FE1B1FC9594B5B145F582F992F6F409FA5894E4223820FC9C3E35FD7143C7CD37C49444439ED4
+4043C9DABE02649B93EF1DC524AAC7B7AEBCC3FC61E9B869E416DB7B8BB2632CEC318AF0891B3F84DB70F4646B48B6F4
+0
+1
+4DF000C2C0ED0CF3845227C8B59F9B4E437496BE7AF23392A08B836BE40E0FBEA76D29EA06DD24F56C70AC247CC3F6E5
+F5A11AE98ABB2FB8348B8706138EB3780E80A37FC810529BAEBE90879BE15AA3B1B34351178A9F357CB15426982C674E
+C98A99F821148A248082EDE964694011645DF9C5303FD298DD90AA1C3D680E35C6472D5F99A235368E45F822842D38FC
+2926EDCB5248C8A307AC054B225C4E15D95FBFBB602C99E2F9236A801A855B15F4D416533028F7C2005D9EB67CFA3430
+BB5C0A16E2FD6DE713E25F8CC08AEED77B1B7EC54EEA27BBB95B6D6512501384C534676EED817C3550162BB200297A11
+0
+1
+41DA319CB50AA9D8BB55DBC826651D9762E1EF18FDC0BD7EAE7323AAEEFF91E3807FBB362380627B4F94DC1EBE1845AA
+DD2D983D3E4F375D80E846CFBA4438D8D7F788ED561AAD5227FD551464C8DC2C5C9F0CF47D1EB616C1299204B33DC43D
+3E262D1410A1903E39C3B05483910B6BBE7ADF2485D1134BC5E6FE22F481E337C8FA9018EB732DD0B324E321ED4F2BB7
+1F4F05C778AC823A199D823F8DBD2871C44413F128B5650A31BD61E806CFD2A16A199C4D358B7F6654FBAA2B71306D81
+CB5D8C1E6D84AB9C934537F8B8D029A680F92039042AE7BA4AC23962823911AF8457D45B9E0CA27D01742E8A93BD154F
+0
+1
+851BFD873BAC495F96D4ABE74FCAB917D7D197DEC2B62788F0B2D8FC348EA45AC58FFE7E3D2C72ADA892E0FA522E1BC7
+BF978EBD774F4EC7F030DC867A481E3DB849D8D745D1AB4A0078D832DD923F42D74F0C0F6FDBEEA47559742101DEB330
+35C208A6558393E97E6D2E5D1B0935DF79C50B96507863992C36B331DFC6AE054C9CFE82E38AA90889530AC47777ED2C
+6FDEA2430651DF83A4B300BADC9C78C8073BACC98C737EBBBC19FB153E4E17EAA3A9BE29020548FEE504F049D055ED85
+EB4478EAB3EBA9FD32E42C519E64F1AAD7FBAFC8B3BE951E70826E6662B04C303C6E9AAF4AD4BBFA14AA1E051C1AD654
+0
+1
+4FEBD744FEDD99B0EC6F70A97DF5F26AFE6A45E07ADD8228A7C278E40C44711053BB21ADE94D3EABFA28AE23B908D947
+A055AC862F1B73BD2C0E256298886D400183773E392F94ACE4862BDFDDD84DAA4838428FC6E918C5131C2D93577BA40F
+7FADF0F4EEAB8C040B30A3C527CC40CA34601AAED2C218C007DB30407FAB0A3EB55FFAF5841B8ED7C6CD7BFA9516E881
+F92A0C47942C73DACA3AB512E5A7CE4D3A835B4EFC506BBD9877ED3FEF61DA0D3D164D5EB36B657EC1C51B0808EACC0D
+C20FE9D68882702CBDE2BC5C1BE49564356D40F10BDFC39EB8FCEBC579447CB9BCF06CD1136C85DA0D25C907D2D7F046
+0
+1
+2E102F72AB7F233CA330ED462CED8995C60EF8D472389B93373700248A410AEAD1C257959D96285866877BBAF94416C3
+90D6FB43FAF6CAA23635681C0B0A0625DE8A329F72423A1DC55D525EA8DD8F1EE5076497838F7C304BC92EE5B1D2FFFE
+1C343ECE67E12EA62F17B869C3A780FAB10A9FC1642E7074630684EC330CFAE96D6B21C84CD88FBFA384E4AE6FBA62B4
+4959BAF0900F10C1CBF3CBD6F7DD8F8AED5052E0F74EE7654BE94BB1AD2E865DAD5F0462C004C7BB3D6C1D06173168CA
+42299FD70980B52A2EC6244C89923B6AE45319CF2B1B35906682A3FB18F1CB2E6DD71D321B63A6BB2BAA9E8B5436FF05
+0
+1
+EF58FC52D2A7767020B46545C118721B53F42BA4D3F42419B248235C30B9D583AD9340690A27544AA64DFB0EB00AD8F0
+18C984323E909A3C6CC9208489239EE28058ACD1F3C3AFF405283AE1584DF88A6810A6E221589768B8681B52466E4A0B
+2BDE6B88429AAF5A43075F04573CE16111877ED3148BB40617C88FD607DF7CA8C4A57EDDA127E27A78DD4384EA39DB2F
+AE5E5B94CF2B3C3E48A1D2889AEAE23E2271774E9826983A1D0141119AAB7E5CFB7C81B7282C877B8570A25D6B9EE8E4
+87895A603A6012EDC9EDA4009A54A30FFA50E5A8502E69E57BA987CD766814B46F9824FA9E9EF56D1DA2A200D9F1F544
+0
+1
+95FC61250C9BFE0EDDB9EDA7BBE3366E2BE437A385BF20CB487308DA8C5C7CFD5E90CFE27B13007DA964E90A5EFCE7E7
+29D156EEE7CCB5E1953AFAB5F37B989AC02CF706EC8566EC5A49EFC7B4EAF3FEB85013CA95C29E4E7E0F5B5C6B22C1D7
+2E515AF46C929BE0480FC4F5577B3E051E57CAF69800D39D35710236C2C263CC9602969B2694AA3B2E1EB304E8FCE87C
+0AB5FD43283C36AA558BA714B523EF77717ECB58A736C813486B7B6D2F6898933019028C98DD6C5D9C54A313A1B25139
+F24B2944D1DD0AB836D176E5666A242775323F98FF163D7B3F0B08F68DEFA5A864DFBF456EF3F2862C2DAFD43A67DE7E
+0
+1
+267F5767CFD01130879201B699EF71B367D9CD3AE05730963F4F3859F6A9AE20C8CF06509BB5C865F7E2C741753C4E31
+830C1275153E601F619662D5E92A04D21A9119EDAD3CCAA5388481B1C3D6B97BFFDFBCBB05252545197D08E56A37CF0C
+ED72E3521587CECCD40B02F481A555B6119259C072D1674219928D24B89D792C84C1F5C0A1FF7FF413944319379D41BD
+62D084E0975E6947BD3F5CB6F12359B683D398C5E5728B82C18EA622F1E9FD11F2DCDD5B4CCEE8BF3B5C534453AFC4D5
+496FE4E03F8B1679290D240B8E766BC8BAD7F1BE1669BEF15B07CA32AC6D300BD849E6755CD1AAC43552C18B898C2813
+0
+1
+7A86DFB76CAA31A5CD06BB7965FC7D4AA11311D06C29BFCEAB49064B6AF37D5129FCB782892D684136FF8AEA3FCDD98C
+044BFAD23EB568EE51FA3E0C26300B6D86EEBDC190AB824B96D5CDDBF4AABBB1C55AE589FC24FC04B0AED3BBF289FA2B
+7FC8DB99ABB0E4E269D2DECC97237A0433A7119E86129C51E54416381A9841D1A922D30C065319A6E90FE320E07FA300
+FABD27520BBEF1C26CE0220E4B67E029D5353F7F2730199692F9A9369368075DC4298F2079FB7ADD9041CE731F2BC71B
+E684351E7B16FE5C604A0BBFD2CB3DFB08E238C5B2F43F9ECA1D17096A726AFFDF17CB0E1086A037ED74AA965A7B75A1
+0
+1
+8A4BF58291CEED524BF06A40DD68D12AE2A7CD6E3D510370677025CA3033D5F9F93FFFB059F66F157313CAFB5B580FBE
+5D2DD9248E72DE069A149B8D76283D8BFECD453089C1D1EC09E9CBD415F595ECD67B57E9CDE77D8CA965D6622A39B398
+3F95A7B805F874B13D1A43AF21550E1C43A3187D2ABE87374A00D5F3BA610AC11AF7F78E4B50A63AA73A09DF36AA6ED8
+B008B9A2589AFE630EB2CC615F3C6DA6F4D1E8B53D0437675950BA7337F00D0B46FC1F0409D1CF3F130F1069483A4494
+D951AA27261692746979E514FB0A34DCC8AA8561047AD5976FFD3C3DE29F77AF7716CF8A14578F7FC7E3A7A893BAD3AF
+0
+1
+DE147C9EB8A356788047ED703338054A67DE0B178EA8CEC0A921E0B29985AFED9430B1018EAD7DF6653AD3EB6AD850F1
+29EA7102D09BF0C00A9132E9B8FC801FCE94413D5D6722A485448C29A36CDD02BC8CF23AEDEF5D25A9A9870B99BE9E72
+E0051FE36EFC26369D640CAA8C7D594D618F0DBC7FC437020F283E0F652D192F2CBB799706203C550E3AF8B2867CBC0F
+FC218436A861F7613851DC738334E9D2E60B8A23D0DA6686BF0667CA02D165259D65923F038E066C88828F7F3F96AAE8
+6012FD6C2117396E8421344CA212A113D1D3AFE47194D26999DE7962507736CA2B1C411AF521D194B6BBE56056BE34E5
+0
+1
+629BEED930CBD519A19621F39491D9211FFB1AAB76885DB61F118BF04868B0981A49A5C454960349543C3452A2E0E666
+C22FF023C79D0B3E083628E6CED60473EAE0A1A5B5EA6623B99EE1901C00177E5226E585983121881E8A954ACC8F5B89
+BE0DD9FEA78A8C5A8F2787C642283956ED69602CD6E0F8C56AFE8A0E24654108C340A3E47E403F2EB55F212808681AFE
+43E093161FC62BD27159F22994D38C036684D92F4FEFDED237290BD8E9C60EC8B8992DC78309C8B1353494EB463F801C
+C15D368AFB2C96159A0334684D4BA74415A5E558B7916EDAAD8200FD24113B3FC672A6DF61EFB02F770D8724139838D6
+0
+1
+221A7580C87AB9BCB7120C9E52AD7928F92FA2107315539D9EDD17504A928AFBE7D1919F79F98757419EFED412DA2A6A
+9DA2250647235F9AED031D61B188893C0442812063CB5168B08661085A510E71EA0BF69ACFD92CC2B98D4D572AD3009D
+0120C2ECFE74A3D65AD1484C2D5ACFA63B413702196B1C4C9F99BBD27611BD0AB6666D307B22A8432021BF155582AE62
+9E02E813F80B60298F593D08A8710F2DE4382EE8AF6E2C4A677F1BFC7E76C9CF97DA1512456157DE62E0100862CE5609
+DEEE8C02F8C3742D6CA3A33FD58A976E2755C4E418EFCF8C812D99A73C60485E25538C49A9D58737FB3CA865BF218E07
+0
+1
+4D2C3DE2DC0C5E5055A7774239C3CD393EFCA89899FC6A2B440D07CD34E51914188007F5E52FDD06A8BDD791AF38EEF0
+CE19230096DD4DFCFC5DAF7F801506921CE6EA1E0C443019223BF41618CB50390A7FA24D16B1C6CDAF1BC02947E04705
+418907136667784003B2B60CCB6EE5D9B6DEAF988EF76CBB8AAA0912212E339F8B44F6051E6A37784A7866A23FAF00DB
+25382F6E7B83559E22B2B3B7BB247F8AD5D94FE49B7AA5B4B10211CC7D0F53196BDDCF58677DB0841DA844D80A4439F7
+C7ACA43E135EFC8534116A186F90C05A5FC2469694117CA7BC24E0DE47D2962AA5B82708D715482389D490E8957FC90C
+0
+1
+5624461E7408CBEC6ADAB37F0900F70F397EDDC1D2E2FDD826D81430DD15CA1834A0A626B9FC235A2A24ACFDD67EEC13
+15BB5EA8631CFC5FC8D35C90C8B4B50D5C27D616E05E1D4B876C169013DC05C6ED4E8DF94242CF6D6A58385CCE535C7E
+B49738B6B84D03C6107020D7FB04E362AF3C8BD17A568E9B47BB1C92BDF4B3793B00693F956E939A0F88098CD5EB6C35
+BD0EB5775B05FF5D43C6FB98B4B5D351488B2407657CD439989DFBC9F8674A069B776D4CABE94252E1BF2889ECA24E59
+080ACC7A0E5845A929D82D17F215EBDB7C2C96976FBA17007B8F3B664C1D504BA01E2C3553E4FC75A4DCE3E519A54A83
+0
+1
+783B067508CEB797CA4B52AD5EDAED9563045BE55307DAE384C6AF1B3728663119B195C6575D78358B93E296783E7894
+65338459588A2305A875175272D4B9BAD9D6EED2E179815C63BB6D15BECD115FE1D6E00FDB41B658CBC7D219BA70D57C
+C19505174C3F26CEE6FF8DCE00F3D58193656766D79100FAF6C9B5EBF4599631D6CA8131AD331E9DB71FC9FB862A19D6
+E6EB35CDAFFB4C701137242497A236C64C6342D99BE5F1F5E41FA384A871806168372926EFD8C0B63DB239AA3759219D
+ECC5F4E671E92B828FF9044CDD03DC9355DA4CD986C35BBBB8010626C833A6C977AA4396A096DE6865ECEBA8427B80C0
+0
+1
+E8A9881C2498A2C41D293F1396E3A99316E62FD56B89AEEC8DDE9E680EB979A4045BFA1475799592F209AEE73082BDA3
+0BC1C40663045150F8DF11A7AC1F4B8056A67557AC207C4FB3D4B42BEDFB98CA01444D84888859C302E72C5BF09DD222
+B33A7DF7166B63B4D8D0C39752FA63F7BBF2BB2DF0663087EFC0A250BB6EE815ED4FFEA10CE84AAD7FEAD00D01F61665
+7867468A8A6EBC365AEB96250987E89BE510304E8D580D1C56BA107631E95D9CFD3A78EDA52A57C8A54475DF6804BF82
+766B4BFD6B28E3C547742D51C42FD8372F5F0858E5B7AF73F0CD99DD3E9D8330171804C117B332926F5E4255792EE1FE
+0
+1
+C291C58829BF1EF21782607423B6916CD1CD0D210EB27625CCE40C3D3F1897241322C8AEE521799782473F9BA834D5A2
+95765208C3B6C1C53B0FBC8C828AC0BE3FEB02F9040F0056BCB2C95B1301A3E5D88339DA9AE9DEB258CB61E1C4E11706
+0C861FB73E59DF76C076505155A8C67A0B7401563923FFAF802CC5D0097CAD0162D34FA818516D3384F76370B5D7F1C0
+49622C546190FE406622D2899A69CEE124C89755854BE1C83ED1B98D97DBF7D4E1303A43167F656185DB5FA1582A86A6
+35CD3E009162460404910EE6BDA8C81699B85B6E7F02C1595765B204C77524CEFE7AE3CF830694B9C5031A3C64D25EDC
+0
+1
+B2CE992440369F122C8A15C7EBACA0BFA43E0BDF85C315BA6DED5CD4C337BA3CCB418E60A8C0FDECB22427AF8B532576
+0A37FC05D56DB11D6DB5BAF23479121D8A2D50E87B4EC514262BDEAD64C4B2B14BF371DCEA3EC6972506AD738612EEEF
+6C941155492A6E05783D309C329DC9EBC2CB3B61D77DE8EEE9E69450CAC4F97FF4C23348EF37AC830F7EB2449D44DAA8
+304DD1F450862E1A7EF252FC149FA6EAC0F77948F877CF867EC67B2ACC8DF9F164B25A7FF726CE4B6B78E93FBA2256B0
+1617C039A8CCAA37E69EC9654C1DBC3116C1B5A074EA92DA91EE7ADF444CF173D7E47AAC56C7F2E811E6871074F94AAC
+0
+1
+CAFDDFF0A8918BC8DBE68711793495C659EDAF95877106D5379BC29B08008578E2DEA9139B7ABCF502C881E48A3CADBB
+E62635A186B2189BFAF446EDBC2B31CFD06EEC6A2C9270C66B394D24F2859EEE50566AAEB033AE1B9F9F1625691CB1C0
+ED1F050655D7570053D0500608325E7EFDE1377080938548D58E2B133DBEE95BFF898B01114D0CB285A39473C889174C
+26D773AEC4865ABD117BDCE019B4BDB67D1C6D5E7A7109A91EB228FEA482B8B9A185F00B076F1A92CD470C5857BE499C
+51B96612ADB235E2CB1C58ADBE502D76B6F38E485C461A18BECB6AF7124CDA5960DEE46A87EE6516A6C45AE94251DFD4
+0
+1
+C95502F3EF3C65454FF5C4FE584324575029EBC40B78E12D6441C1D44A65BC34BD5D7B0BDD8EC3B624F111457446C261
+CB056226D733571EBF4978425829829B67CC81DBBC55B1DEE25106A86E6C6B2A91023F0392A2B17677D0FD2A3118E1AB
+33EB4257053F6B1FBE8867E2AC656125AF5C3ABDBA603C8D384078AA133C343B81A335012F0983A48DAEA375F14DA9F4
+F7BD5BFCF18D774B9BEE7A641CA59A59C92D1B36114A0CEBBD14FBC42F133382C0C0760D98FF2BB73A75789897416510
+0BBDFBCC6F87B156D448C2913ED6ADD2CCC5C0CEA92BD210A70D2BB7B2F94C645C2ABBFC8EEC9D9AFC1238E322B55727
+0
+1
+936D246F9CD2A803EE533BBC763665C0AA442869EBBA87B0829BD34020CC5FB2C189E9801B0CEC38AEDC7AF6E7263074
+CB6449251CCDDBC6CF65D1D796CB1407C1B1880F81AF6F4685688FC9DDF39E68749CBAF2544A11B44E9D7A60FE54BC05
+39B68B557C8D3ADDE933DBF77B4E801269DBF02D954C6B7FFD76C15EE9C6475C33E0EF5CC62147A741F36EEA91986EDD
+3D933B356E85B45E9D8E69B447CA5A4BA07A34ABABD06AD83C9B4353675096B9002FB9ED4FF0FEF7D453A4A0652A2DA4
+09DB5FB0A2BB8AA2BC6C6DFEB2BF9579B6A59CFFD5BD0ABF665297964E7A2BEE0B549DA281682CFAFED3254CA1A240F6
+0
+1
+7B5B9DAE2A973C33A9B9696465D3E91DD916E0CC3D5F49980672EC2F6E841E65BDC4CB49709F5B57872536046436BF07
+EF988E656B72DED63888A63E949404CA55EFFB4CCBB481804DB1449B2FB873B28466DFBC4F3245C4D639DC9EDF12334B
+9CFA89B6A08730AB642664BABF198E4A6D8E24F50E9AB96C993A365B8CA931B9705CC26A14869641181AE4EED24B30E2
+4CB838A54BA12D7BBA7F5370C4F793650B454A06DA5D2B782D7BCF979E317E09CF126E5EDFF7370766ACF4896A848B5C
+A32E5C8FF71A6A834AF38A77074AA4715A235A4B42C47F7417941BA490286EB50291A901CB5371A2EB3403802332B218
+0
+1
+B86C6863FBEAE12BCCD94484DD28400AA330A2D0EBF815F8E20CE5396717B63BBBC4E7A39881822D9A137A2D835196A4
+B72C9AEDFC05E1C8E1975767156848F96F67A5F0456455C417F1817C7353236EC80FDE5E8E5E2E0368FCC6EE8F3B9CA9
+88C9A766053033353B64C8228EF626EDFCAB7842E1515FA137DD3E0833DE06B1198C32CF405E77ABF929D3791C8B69F3
+E41E3FB79E20FE680E2B5C3BADFE30ED709BDD53CB2CD6B3113AC8B2BFD580DB56DF8AF70FB4D186165B7395542E20C9
+FE60C7D88742880E548E53A1CE289AEFA1161A66744C1B8909D299C608CE537364C92A03A8254C6289C9919B5B970DB4
+0
+1
+735C7F95DA7A043A594FFE0446BC456A0BA80F60D46BED41949B1B3AA01DCC053F708FE1B0EEDE9DF1515035CFD5A29D
+FAE60FFC6AA01845200828C8B76B86A7FC532A36701A2C1D4EEC2484CC7016ADF8310A4B37BD348150180A0A7D9A3E0E
+6543834D0CF53BB2C1A287F7D88457DF5BBCA989F354C2FD10A4B0493212E3051755A50CC7CEB7AC6F7EE12A5FC556C3
+23291146A70FE4EC5D4FF9095DF22E10195461631547790AE3D61E5AC32DB27714D7D745E0C58267A5BA0808DF00AD00
+4344E42233F78925B0193EF2F7BBEA885FB5452F6AEBED5100D73580E0FFE7EAAF0D482BAAA3AD0D1EE91E3F21469A2C
+0
+1
+6D2006713A03A79C5E619EC8E890413D97A581049E8F65D2F06793E0CD19015CC6316FC2C78715B2E5BA6FEA1317FBCB
+03C7426B3800A0DB7F2F105C00D55411ACCE223E2DEE69455D5A0F4FFB45DAEF40FB9AC448A504B2A8873FE3299E84EB
+71DE441F37537C8421C9197CD3386FF9CF1E77CF74E5329D586223F2CA9CE4470400702AEDE29FD282A4EE89402BDCC0
+5E84BF065A74F1C1B1ACEA55C1D630BE1F1A1C2CFE51FB7A5DAF7EE9E30AB697F5863F6A4172CA70EE2813F19E333EC0
+56651CF9A4D25F0849639E22046643BD22F018B81EF1F3E15F8C0C1F66DBFFCFC88376CD2965EB7E7E12493B1EFB81B6
+0
+1
+B3A9E8BDDE3ED83999EEA0F8950B512F4DB8ED5F876B1E77B7F45580309353C91F499FCFC4DDAFAC7290FBD4974EA2D9
+A442358C8CE8751AC032C38F64C892D2ED86A826E0B7F991E8852B4073D037E9C3918A160750C68D8E1938B569B7A124
+DCC4CFAF9B3BF352FE36623263323F475CAE04B54BE4A920B4ADBD880377040EEA281196CA63C482E1FCF3E738ABD95E
+6377FF0A5909C2E77F31C8ED0C09C432D30F0ADCEB65538B7E05D14F19A62C2529DCC371A6D41487D2DA5FA8E34A8D43
+157746A97A63DC9438A077FA0A994D91BB793AD4069FCCE4EAE99953922CA9F96F13596C89864A04807282DB9C6AC0BE
+0
+1
+30DB468D98446BE7710BE37E9AF428B79F7DEA7968270071124FFDEE32340CC837BA358CE3019E56C888DE87C5C25AE2
+1ED92ADAC4BB36AB0D70D794B2D7CBB4BD026CC1EC7DAB994E263A577ED4FFA88B29C3C981B354D90A0E56E4DFA692CC
+0E27B6B35976DFE6851E1E8D8FB336AD0161E2B1F5EFFE3D1F2DFA32A9FF2B67E08E9BB42F282C90708A0F7FDE73B01C
+316095DFD7EE5C293BD2E1118C52AD549B26C153E9F44F4952ECC250F3819C5E438B2303862D89EA1F7E056DE10EF642
+1247296C75804E352549A8FE1804C56D5E6E54AE448B7F0BF182F20B8CBFEADFF655CB711C718FC4B82E7AD758BBC88D
+0
+1
+58DCF4883149994498520E2597B70428F40D7C8CA2BF589CB9E169C334EF519EA05A61291897D65C8FA87F85BD92DE92
+8F40A46E792A1CA6117B6626FDC21F8794F17DD085CBC7D9E782EF1A61852129400BB4D311DF3C077B59F87C9F82D846
+A3D3CCBF7D1B1AB534BBAEA752286A0B4EDD10EFDDB5ADBC3DF78B47014AC5F3A64C35849ACC0EE57E2205B4AE1F16C3
+185E558569859CFBEB4BC6C72A55617EDED15E9EDDBD8FCC4AD36CECD185AA930E841D51A48FCAD16C4EDD9BD23B9B00
+F19CB81BBB02BF0620D672AE29FC4E05E82025B9E8000A53AAC7054B0C0CE97082695172A787A940B90526A6842CAA83
+0
+1
+95FD3B6B090680D634E68A4643F85EA4D9D1648ED48D8029F0537FE5011A199F4B2BD3BC3C2C444F1BE863DFCECC3CD4
+C811FE9DF78C91C943B7C7E5F0057CB41E1B57AB27BFE01E63E7EA198EC860EB253E932FD3A68D2500766356D5880DEF
+2337AE54844B4F6B8620E5F561AF87E5E153E32042A5622B1BD9FDCAED1D6F1DF63A6BB65798A7A9D12430EC1E78C4AE
+CE42E5F6504CFB3F74EB38FDE75A9B17CCCB8138DDCF4667B8E9B47AFABC821F1E20DE5E53E4DF526858F476C7DB4AAB
+40E2A843092E56A074C67E98C0DE50507814A72B5991B6A0A5FA1F93ED712CAA208818AF6A286B71D923D719D2CF67CD
+0
+1
+843DDF2126DBEC9F3A62DB73FCF9200B23B6CBA250270C7B3FA64B54E0FF12354CA302F24AC71B323FFCC5C534C3FBED
+E564FCA154CB5C60E09E6DB442A065B662C6A172EDC4D88662E6BE1B77487498F463B9181137D09A4DDD59045B81817A
+580349E3127898BE920338D0FEBC260E59C40A4D86BF806E2DF238FAF3505D7E8BF539C915D2C7896BDFEC2AAB3C9B6E
+56FD5444436D73E56BB52A463DB9ACECBBBBC1CD47D5798F982345E339003DBE084DD996B97E9ED08349862C67DD966D
+5E48A9E565B4266F2D790F2A41535ACD2BBA68CEAAEE26DD7585F56218837DF649ED45B60F60FC5A6729DFBC9346435F
+0
+1
+FF73979476561F47085DC10D52221C52EEB7B0164EF3FDFC900A94BC1D40C9E786449D8BDB41C44528D9664D681D6E6F
+CB904C5401276F7A9DE12E8F8C9407A4CC8A2BCFEAAEBB9F74DC4D32BEC6CCA17C855BB157F3986D48C43FE2EC99A726
+BC8AEBC634DDF6306EC7FC4BF6279D6611CCA4E2E2AEB44942EA44D1C91C179F86C12898D793615EDC10065638640E39
+375795A498948E0A35D023FC5B94B68DA9B263BD6A13B96D1F34C4456860DF69F48F31BACB9EEEA96AAEEC059ADBA882
+CB4592AF59C52E441146AF176AE9882E786123B39343149FFE23632FA2F6EC8B29083E594983F3209A6363A0B8DF523B
+0
+1
+33
+eckeygen_batch 528
+1
+eckeygen_batch 529
+16
+eckeygen_batch 530
+17
+eckeygen_batch 531
+40
+ecdh_phase_two_with_key 532
+AD85B45AAB5431C7E42C11DA3993F6AA8B114C8965D51B4F1708D1DB9502C18F6252E3C4908C6F52202CE4C35ADEE0C1
+BE2940123199296AF3F88AD4E8576D7164EC5CA8F7DE1E9DABAE81411624FC83FD7C381B67B43D9257C9420E6CB56C72
+0
+E193BFA6FE3695C21159F9E1D61D33E8DDB119EA70F32E7656C8E558A0A9F16CE2D7DC8AFFCBB6909FE7BBF0DE0CD7BF
+C1C50A3EAB6E4067C5B090351552D07304DA195C04B52F65553E0ED5638A881E7506144B7261796311691D4A26DE38D8
+88288A14517A7790074E586BD714467ACB0E5BB6AE619B56157372AFE31DF946DE7BB3E05C90C1F4898355241E1B1F1E
+0
+1
+ecdh_phase_two_with_key 533
+9750811CBBC1EBA74A938656A99C54041195ABDFB9661D0E63E9D81F1BCEDAF5730F474A19D0FDF11967402D46DCBEF3
+2AB026F93FB0DC34FD41ABA260868FBD8086703A6F23C207D511A53861EB61FB1B7FAA5CE2EBFDF2AA5DBC28B23CB894
+0
+3687171D888D082C40487EDE030978CAD08733D3907D880F9AC160651D3B57C2018535BF4BF56CA8328C4187CB16E0B2
+FFEE1844678F6ADC47252CBFC47951F0ABC9AF718B4CC51C3564D4C3CDEE13DBFF332E4BD58CF9F95CA869F43339A7C4
+BB0CD69FB32090012370EC43D3F18470669D48A614043F2D988AFE25AD94939E5102714F7B6FC8BBAB83D2111B82034B
+0
+1
+ecdh_phase_two_with_key 534
+36AF9416C4D653B00A74F0201A93ECA7A639E0156A14D4AB593BF32DE7C4EDD3B82B81635EBD35F14520711DC62CC8C5
+C5000430F972F32256EC9F1CE6B61AE82ED608B8511B38F7B776AD81DAAADFCDDE1E1E0C596FD547E9DA4E7AD79C32D1
+0
+054336701BFA496C01EA53CAE526F0A9583FE27B89A027CECDEAD70FCF99FDDFFB17DBFF5350B6926A2B1C7F96234175
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0
+ecdh_phase_two_with_key 535
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+F76F019916FB5F6130E35C3E76CB2BAAC358B0A5E49FDD0C622984BE0C9C27BA9690796A8DFDE234DF32F06208F01C6F
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0
+ecdh_phase_two_with_key 536
+FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFF
+E5CC22F6BE97F925A7BE4141C905F58844F6AC2F5D7530688ABC0E6942B8EFF773DD23B05C5F9CDDD06BEB2C0C67563A
+0
+B867AA07BA807F906821F25076A2168C71167446EAB37FC89C369D330D51EF2F4FAA12C6B6DD44BE99F7C7EB4DD5B083
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0
+ecdsa_sign_with_key 537
+6C4C1DE4B503B56F6A903E886D7967836C45CEFB01F324871617FCEC3909AA7A8FA7FE272040604B30FEC926F9C7B835
+E2E9575CCFE3874C93A88CEDAD1897A5F9ABEE94933A845B07CD71C607A07DF14BB27B102D29ED0160A1F0A6609CC2C1
+F0B6892A91EBE01CFAC91E9454F89D792CF5899185B2BD7F9254947CD5331A9CB9102F8C901280A2CFC37395870B095E
+4A26B1D5704EE0BAFAFA257856636C37D264B4F67125599C2BA094D8A9787E4020CE307AC3EA9DAE9877B41BC6601898
+0
+1
+ecdsa_sign_with_key 538
+97009E910A24A20B1338A3CB25C6B46CA431B33ED33F2ECDA3EEA848433C68DF75C7C0AFFECCA3AAE818B13FA431F81E
+89F4BC3A602E9D6DDA24C1F7BDD5ED9BF34F3D22BD68B0D5B8BE29E1C5ED8FA7276BD0AF20A91D2BBBC9CAA1940C4C68
+B02998151277D10C424F69167F6FFD72F6D99A4FB477B3E0471E4DBB2BA1DACA0958442D9CF3600FB98445CFE3B329D5
+354A944F8A07C4B91CECDC9715227D346D0AB1E6B7EDDEFE46F0921F254E9592F39F1A780DCB1FF63B35B931DBD7F80E
+0
+1
+ecdsa_sign_with_key 539
+BED544188C2034136B16DAD4E163CCF69A49AA2C91E824494AC817A5F1F42185EE6C23F8DAB0B4009CB5661720959DA9
+C7A506B384BC80301F6552902310C58D047CF9AAE860359C120C959820D61E78967808F2BB22471DD0297AAA3DD13B74
+918851B5464357F15C93C44C0D30DD8D601DBDAF1EFFFF73FC05AC8EB6C240C56818DB53C568B4F82AE8BA049F006F18
+842227012E81E02DF8BA7A24804B0756E5E92B2250BB82F8AED69317AB5331F6B1929FB0F858A850ACF17AAB52835FA7
+0
+1
+ecdsa_is_valid_with_key 540
+2733B5E77908DE745F5A118CD033B7839143819956C681938101810BFF6BF1DE3F770FA846AAABB4C008B20BC8C8FEC0
+10B1F32A0D1919D6479170E508DFC227A314A9E0C24E34F3D989F9A898B22D61CA542717FDB1DA7F528C27CD76834573
+E87EC977E55744B626C998E81E0645B1D93B674B3B31C362EE12B6A725570466B964518CA221E349D2DEBE7F9409031B
+CB544EBD22014DE666A9D35741DC5C5CFE0F6A82F0430DEBCF3A2FC0C699EAADC584D6A3B52D2EAD72CAFEC328D5EC0D
+D215FBB35F84113D8CC4D86544D7940CEF6E1AEC68F199F8C018096179AE55FA24A1B1B4D5EC408CACFA8507D91ECBA0
+0
+1
+1
+ecdsa_is_valid_with_key 541
+6C3F5BB9C35022990C82BC88BDDD7F13B2FEB27694C1CDB7B79B842D37B2ED5375E8F7644D697337C82A87668810EB49
+7A40AAC096265EE29D7FC7AC3F4146D8B96A965776B4621C0243847524653F3DF2D7A8F13FCA495E9FBEACFBF9504251
+4EAB3005E5B82B3BCCBA4C4E4D48A12B8E43FF295FFC125757EE7894687534BEBB6766DF7D58C8AA7CC34FD7DF4856EF
+ED28D0E2B89B47D9D5DFADC18F57E915363139D976B75DB991942AA66CD6DACEE53DEAF9B8540337B7DC7C342561FF8F
+14C5358083E7E95E1DF5259E97D0CCF844B1FDAFD9AB10F3EE92E68A00D0FAB79717E31BAEB4B21E7005D4A1F9022FF0
+0
+1
+1
+ecdsa_is_valid_with_key 542
+B56797C4FB64865ED9CD9F46599DC6C99B16ED7CB6B3C68C495B317CA92D6918C85E77E9283676F1EE11774FED94BF3B
+409431FD5275CCAF92C682E8E27D431316121BE4643C85B4B7BF2D6F25CE1BC0EE4E6C140DFCA6EB16215C865BFA2F66
+9EEC73BF28F5516E59EB031F42A87DBF0047D36B25C212C4C05B068F925C2B7AAD7F963AA9F1AED65717620BE411AD49
+24BCCD75945C1F06127691C75F0DCA54B7E7932047AA06B4A84CA12DAE0CB35BBE4A6D0CB6588F84E4257A7EA9356A29
+D7E5911D8D660BB86F3F8F5E73E56AAE1CBEB378EE8A3160FDBA79C1F686572E610FF1EF9352C8E7541A43077F5EB6DB
+0
+1
+0
+ecdsa_is_valid_with_key 543
+3BD082BF9EB44D7C017AF203C311FFCC742C1D99DB1A17D5BFDF04C2D3E4E4AC026B582DFF2EE5A713EFE9421D116DE8
+D6CC0695D205C2130ABD407F264385094CD28A7359121D88C2E153DA01099874E61CA36ACDA51F7DD5C1B0F3C211E553
+5747127E871B4C1CC41A5183B20A928475EDCC343EE5F9C4FED4E711AA0DDED0483B6995EBFCACE93B0309A9E11448D6
+6A4191B48E873FBC034AC557F64900BAD9A02838F2DF73003C0697329F6D6E6D082F80DB422F6CFD248FBE86B672200D
+D07E2C58283F1A61711FA52B14EC83E012704534F94F053A5FFF0E175990DEBC44B4DFEE0C9F08EA5797888633C60069
+0
+0
+0
+ecdsa_is_valid_with_key 544
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+7A3144B39DA3CB8999BEF9ED0C282A4C066C65E0EF5B22C6FB66097C90C5CF85AE86AB4D52DD2A3438CF3078D695B794
+C10DD279E5AA6BAE6160B42BF013057C5D90A79D0A71EE46F2CB5E703FC9C8AEA30A1F02CA71C0EB34B8E0D18AB50832
+17C11B488C372AAF71B6EBE12DE937C591F5CCC0BE68C2BBF71E31F8975BA6AAAAE6C8511AF757C76F51393E12647BCC
+AE2E29EFEFA6EA24BCAACBEBB500AB2B6E3215C2658995F2235CD80D81B7AF3BFA5106743878A4E1A7CD3828EC80E526
+0
+1
+0
+ecdsa_is_valid_with_key 545
+C0D2DEED53F802B716507EB971673570054C641A2C4A10EFBC741AC03671FE57FACD6A4445A012CECCC7BF6211707579
+87527B2EFD870EDF74CDB8C3CEDA8BD07C24616B87F058879FE6600014F9D106D95E721C40A160EB390F088F6BA8FF22
+4610D15A35504971F1F4E597AB000C72945B0FDFBF6B6D0AFC3CDA5483EDBEC8D254A6D1AB456541D9983B60237526C0
+BB632ED5B42AA29894F62B2DD265C4162EC7F446959297CFC854A6BE78D8DD73225C947118E846321B60FDDAAC37DF99
+B2E79731B844C354354E24591AA1EEE1A580FA579026EE5DA17084265B9D0A40487D649DBCB4AB40C8558C370EF5360E
+0
+1
+0
+ecdsa_is_valid_with_key 546
+B6629D36AA9FFC885A28BCBFD329C908E6D707C72510ADE009BBFC5DA7271C1D3F75840D388BA266D25E40C6AF7EC4DA
+C3803AF6146227111FDA458CA506C57FD79751FBBBC6177F67300DE119C83ECC0F8EF17F63F3E002B7F52F903A92D4E2
+09B199F8353F91C84B689A7A183C7B164624358F57D1F8AF42ABB8F6E8C8F83DDFDAA9EAE1CAD3E92EDDE650978EC4EE
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0
+0
 exit
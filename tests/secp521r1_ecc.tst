@@ -5282,4 +5282,1134 @@ eccp_jacobian_point_equals 704
 000001514767C3A3CFD7D5ACB68893510694061E127120F71BBFFB60F5E5DDCECD2B561EF565610B08E337BE8A9EFD9BE9E369E08450CA7F4245B868FEAB88FB951262F2
 0
 0
+eccp_comb_precompute 705
+4
+1
+eccp_comb_point_multiply 706
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+0000011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650
+0
+eccp_comb_point_multiply 707
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+000000F4BB8CC7F86DB26700A7F3ECEEEED3F0B5C6B5107C4DA97740AB21A29906C42DBBB3E377DE9F251F6B93937FA99A3248F4EAFCBE95EDC0F4F71BE356D661F41B02
+0
+eccp_comb_point_multiply 708
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+000000E7C6D6958765C43FFBA375A04BD382E426670ABBB6A864BB97E85042E8D8C199D368118D66A10BD9BF3AAF46FEC052F89ECAC38F795D8D3DBF77416B89602E99AF
+0
+eccp_comb_point_multiply 709
+0000017ABCF27DA347DDD271F7FF8C0D566C32FC770EF8EA541CEAE726B822AEA5629B0C7E0E8EBC1F99E722961FDD63B2364A715F5278F10B820E75F555BE4ABE48AE8C
+00000179C60473C74F755166E370C3E31C2BA6AF9AAFAA5FD8B3DE2DECE5FA6141A3970E6B9FED6EBE2FD5F034CB2C3FAA82E21B79D08B186E38B85F2DC0F6C5F9E8BA91
+0000006C0F2D35FFB7E18320FCC9ECC3E550BB5797CE48838ADA6ACB94353CD54A5C9BC42FE81BE6276995339E5AA394B14969FF35541AA0BFDA1E57BC25B5C86625330C
+0
+eccp_comb_point_multiply 710
+000000C86F5DC54BFC1729F3A672FE716E5375EC10AE245E22B2ACD08908164375F6CDF280812A56690B5BEEC667A5293158554F4247CBFC555BD17B97559B80333B4BE4
+000001EDC511382E7B55D4750503E5A47414097699627F9398EB472455F41E50FE2CA32E5BAAACBC1529DF727B75888B5F27FE93751D6E440B9A58C5D28AB993D0C0AB05
+000000F803C4E3D1465C20C724AC17A6216213BDB385679D699A248E162F09DAD2373522EBE9049018F84B9AE46DDA1E22E22CD388B68F7AD9B29C31BD2E45EB5D2FFCEA
+0
+eccp_comb_point_multiply 711
+000001D323C351E21F89A2A211F210B2E72006BE29025031DD7AA4566F8BB6B56F560F2157533702FC001642629144C7969B5565F9FCA679AC16F8C8A3972B77D9B904A9
+0000018277B36EA7B55A754A9EC81099CB356B583966A0A5D9874D4FC3BF038177B8FADD201B0E5F6FE23C93EBFD2FE60BE4A5AA8514A85EC412B037983D52EDB4390183
+00000130C7DC8955CD96E845A50297E20F3E4905AC732C2805DD756C29E01FAD8A0AA02466F9CDE3F1239340A3A533FCC27CDE5AF1DBFC06E6A993C7DDBA490FD713BE39
+0
+eccp_comb_precompute 712
+4
+2
+eccp_comb_point_multiply 713
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+0000011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650
+0
+eccp_comb_point_multiply 714
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+000000F4BB8CC7F86DB26700A7F3ECEEEED3F0B5C6B5107C4DA97740AB21A29906C42DBBB3E377DE9F251F6B93937FA99A3248F4EAFCBE95EDC0F4F71BE356D661F41B02
+0
+eccp_comb_point_multiply 715
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+000000E7C6D6958765C43FFBA375A04BD382E426670ABBB6A864BB97E85042E8D8C199D368118D66A10BD9BF3AAF46FEC052F89ECAC38F795D8D3DBF77416B89602E99AF
+0
+eccp_comb_point_multiply 716
+0000017D54F53A4863B358FAEF82F85EB8C2299D8257B5EDE8F9A40A7DB0917A48675726E5C4A921245E7631BE09FC24C5B75D92302B40A8C7D864A06E0FD2D5AFDBB9F1
+000000AD02112AA094FE1B17C5F571BBAFD64FF0DFC483346E6D5D297F96D045CCBF53C60A6B253EA191C2C6F9F65EA23BBBD291F852CCB5646076F765B47F86062EFE6C
+000000377C4F59AABC4C18CBBABFFD8C8BE93B889117D686E616D89F14849A322F76DE69C61784DEB022F9B83559D5D24AE8317C13C448304351A4B54A1B0244FBDC3F61
+0
+eccp_comb_point_multiply 717
+000000078EA65AC3851D85FEEA4BBB9C073BE5046B3C942C2A54A2EE7E81912C1227EA9ADCCEE98BDF52B2D4E841C0E919EBEE2617FDBFE9559823AE449E8C142DDC0D3E
+000000EE9A8EB5716941D678186941B889B96000162D8BA39CF0831033E0438731AB8D314A37CEDCAAA7B98798895EC4D21A679ACB920711104A86DDFFCD294FEE0445C5
+0000013CD9049D5B7BC76F5B2CB2C6058BCC040F75A0F0017C3FF8DAA9E3C75F019EEE72CCD2F2BAB91E01782A0C4D3CC8513EDEFC06D24004317DC97211BA3BB9F0B087
+0
+eccp_comb_point_multiply 718
+000001A1CC2D5CD1ABE335854E93E9E805729915F4EC0C44EB9095E17CC9E88CB6C458B0816809A1411FD35D2F197A32A5FCA467A50C1FFA02ABB932DAC5C247F809920A
+0000014C2F04B13847071CD59202AD6756B32CA9D7BEFC78E156447DCD162AFF608850F65B1DA769445B044544D2FCC940629B448486DF1D1F74500C64214A9AD58DE98D
+0000012B3C4B4BE99D29AF622268E7DCAE0C50EED8CD9717E18274EAD9346F5753D3A7879A2DD0E735F0EA6C407F331EF7433BD8AA27D49F89736239C2FCB5918CFA43CC
+0
+eccp_comb_precompute 719
+5
+3
+eccp_comb_point_multiply 720
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+0000011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650
+0
+eccp_comb_point_multiply 721
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+000000F4BB8CC7F86DB26700A7F3ECEEEED3F0B5C6B5107C4DA97740AB21A29906C42DBBB3E377DE9F251F6B93937FA99A3248F4EAFCBE95EDC0F4F71BE356D661F41B02
+0
+eccp_comb_point_multiply 722
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+000000E7C6D6958765C43FFBA375A04BD382E426670ABBB6A864BB97E85042E8D8C199D368118D66A10BD9BF3AAF46FEC052F89ECAC38F795D8D3DBF77416B89602E99AF
+0
+eccp_comb_point_multiply 723
+0000011C53A04939DE9C2B1E52E38BC96388C45B9060FD1B64713C6689B62CE96841F1F6B1DB70E88C5BDBCE7EC6DEAFDC4B7DF51F6B2EC1E2158CD27BD42F23CAFFC849
+0000003D1BEE4DD979CFE59D333107111DE47C2B8C1B8139DEBA2E55D27B56EEE40108FB47DF65DCCD6DA7C3D4ACD8CD775658E0F4BF2962B9E6F19C906021AB114AFDED
+0000010610437CB1A11BBB863E40ECC365F2CF9765484386BF4608DFFFE3F2ED1455D6F5644E9F8F160642EC6D465EA3B6ABB0C448E3B08BFDB2B73086BD16648F55988D
+0
+eccp_comb_point_multiply 724
+00000101AD876404C731DDEA2A3B1CD76C167FE3057DBED2729C7B6FD90E47A6A9FFA585D11A64B498D698B4AF8277D60302119740833462BA62C6C3006C30843E84C120
+0000009FB6A7519D6C87EFBB828C14D33283E51F3A70573B17BDE5ABDE0F584745FDA08C3ADA0D18D1D04F28E9A2296A4A3911AA8A64E63B164377E786031FF33A945966
+00000016E62B5C33DC1B2D89C3431BBCF14B92C188482A8CA4A2F33EF98577B0502BE75574276F3F2460826164FE517BD58694893E00730F41D8EC557DD8F5492E4C9DF0
+0
+eccp_comb_point_multiply 725
+0000013E301494B34668ADCC8FDB62BF803AF2190B16FAA58CEE2135DC6D69AC6BBD003BFB60AE4A892B84B8F8B0B201AAF3FD07B8B7D2F4387295570EAEE36A606CBEA7
+000000EAD6E00C433D283795E1705A88B6EA1C426B19FEB6DF1BC710EA82A1802DAFB4ED168709099CE68A959556B4405923C77B5E37139BF27400EDD3BA9C42C3DAB5E3
+000001F5F70EF44C2C7BEECCBE4417AAAEFC9A527990E43FC932BD40E89E103C1FB38E73FE5A9E8E0C2CF75EEE53E15D6AB3FCE819CC5C2577003E6DBAAB17032DBEB3C0
+0
+eccp_comb_precompute 726
+6
+4
+eccp_comb_point_multiply 727
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+0000011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650
+0
+eccp_comb_point_multiply 728
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+000000F4BB8CC7F86DB26700A7F3ECEEEED3F0B5C6B5107C4DA97740AB21A29906C42DBBB3E377DE9F251F6B93937FA99A3248F4EAFCBE95EDC0F4F71BE356D661F41B02
+0
+eccp_comb_point_multiply 729
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+000000E7C6D6958765C43FFBA375A04BD382E426670ABBB6A864BB97E85042E8D8C199D368118D66A10BD9BF3AAF46FEC052F89ECAC38F795D8D3DBF77416B89602E99AF
+0
+eccp_comb_point_multiply 730
+000000FBEF7D4768702590868CC42970F9D9F9087F993EB6C1BC0DD50277B882316B18DC7CF04A7DE4F598A8B50469F4804E23082128C54D20BC719DDF5AB69FD344229C
+000001BBAB0AE4572753D3F0C9945249ABFA0DCD1032CC632B295F0C6CBD6BFE1E9F1916902AFCD6E673F07684EFC400EA59C4A053C876086A98D7BD011986CA2BF0B601
+0000005ABB00FADDC2E6C369C6000B40EE9755E292275415EAF57D774E9826D105D7C9F96EF5673309DD4C2AE2488BC4B27CB40F12EC6175FC76C360DE6D9A63EEB4CAD5
+0
+eccp_comb_point_multiply 731
+000000EFED5C9A0A4E69A5D4FB2EC4643C08325044FD4ECBD7B1911AB83ABC977BFF9CABBFB37B5B3561D75F28E038C9622D1315E9FAD6139F179BD914D7CF8431406329
+00000050CBE099E551A7E3C659C9EAA26F1DEA6CA4E287E0731A7A991ED4605660CBEDDBEDA1F3B6EB17430B6BB1335C0747EA972EC8CF89B2349ED7A2ECF051EE86B66F
+000000416EE02F094A18F7D59DD148290D341669D7940C0B877931720BCBBC517EE5DCEFCBEAEF0C897EF9CE0404626421C0EA928272573FD0BACA378DEA03E9139D0989
+0
+eccp_comb_point_multiply 732
+0000010FBCBDFE4B47E51D084C7DBB31187A876434DB9DEFFCAC44E4C1CB1737A921DCE6967069117107BA6D6149AE977CB85C380CA75EA46AED9BE5849E8C1B9FDBE387
+0000019E4CE3BDAA72BAE1E7204BE157FBC014119D576797A3EFF07C5AC6B3F3DA4038465619899B98A8769C63E0BD213474F79AD59D15C1A0272270397D936ED1DADA9F
+000000B75A4960D64C6B323596444FB3EF74C91E173A6E5748ACA5CD87B1454F77170BD5CFB14D10D441A8126456DBBD1C5BAEEB3475A637D24FA22005B14DDAFD8538E4
+0
+eccp_comb_precompute 733
+3
+4
+eccp_comb_point_multiply 734
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+0000011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650
+0
+eccp_comb_point_multiply 735
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+000000F4BB8CC7F86DB26700A7F3ECEEEED3F0B5C6B5107C4DA97740AB21A29906C42DBBB3E377DE9F251F6B93937FA99A3248F4EAFCBE95EDC0F4F71BE356D661F41B02
+0
+eccp_comb_point_multiply 736
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+000000E7C6D6958765C43FFBA375A04BD382E426670ABBB6A864BB97E85042E8D8C199D368118D66A10BD9BF3AAF46FEC052F89ECAC38F795D8D3DBF77416B89602E99AF
+0
+eccp_comb_point_multiply 737
+000000CDEE10D1437A04C9E38FE430838FE5E4B768C7CA82756346315DC06CFC1C885D96D5ABECC21C80791FEB49B08C0D23169EB1DF75FA25191D989FB6164FC8D0D686
+0000004776B11A1F65625B497F3EAA65B88F0F9DCC1A02B332786360C15139F2D0B8F46B92E4E74EF331102CD03A234A5AD46DB0B5FFB6D55C3586B9D51EBDE2AD0BCDFC
+000001870183041C78B2AEB01788966E2C88519D36F80138646B792C75DB3E27E95581C17929B6248CE318CBE5D37B84D6E2E47133B286008E317553AF51631DE430D7BC
+0
+eccp_comb_point_multiply 738
+000001B6B38605A3AD8C63AFB5FD65BC7F7E550ECFA38A826FD66825425DD6E1A2BA4C3D7671CDC6B595A1921165E4534F04AC0AACB1567525317DCF691D9F0138598055
+000000609E776C3A846C404CC1769C9CCBE4D14C96D1032EEB1D26748178A29625876596F492D74D1775310B2F38CEF5115FD7041379A685E681DD9A0592277CF1A83F97
+000000D49E963EE8F963362FD07B082EB355FBABA043ED0CE897FCF7C644B9F26E44EF5FF6A941041427406ACDE4148EEC9F59BB61DFB3F65DEBEA7F61A070A218284406
+0
+eccp_comb_point_multiply 739
+00000003C85DCB2BCCE4EAEEB1227868BC575BAFEB65D508F254BBCF7E48A731B1E627CBC4A2D4CE8DC6B6270876C772FDADEF7F825845F3DAE9761509305062D5D2601E
+000001C76541626B07D69D9AC9E7A211C23F7FBD8CA1C8E842984AC430951FF8E298E2249B2947C320868069A26C92294694DE5C9964647645D2FB7F8A6AD18294686E14
+000000C23EF6F09F25070315CD4833B57E32D1EF33EF41B96D662A0CDCCB691ED98576D2EF647A61DC97028B1E0BA6247975CD08F5A84FBD9C1F9BD115BE5D66816528D0
+0
+eccp_comb_attach_const_table 740
+4
+eccp_comb_point_multiply 741
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+0000011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650
+0
+eccp_comb_point_multiply 742
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+000000F4BB8CC7F86DB26700A7F3ECEEEED3F0B5C6B5107C4DA97740AB21A29906C42DBBB3E377DE9F251F6B93937FA99A3248F4EAFCBE95EDC0F4F71BE356D661F41B02
+0
+eccp_comb_point_multiply 743
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+000000E7C6D6958765C43FFBA375A04BD382E426670ABBB6A864BB97E85042E8D8C199D368118D66A10BD9BF3AAF46FEC052F89ECAC38F795D8D3DBF77416B89602E99AF
+0
+eccp_comb_point_multiply 744
+000001943DC0B2E5547383CC11994CADB273FAE7D8FE05C8666F160DC3D707B566A1BFA46420E8A0B748348DCBD4FF96FA8A7524BCBFFB6EE66BE4D67B7BA08381850A8E
+000000327D3ADBAC228424BA0E8971983AFE2183D07C0EE8B2355F4F610906FE5C486F14A717672BF7F1A6028B3DED2C8880CF5DD8EC84FD1788D27D98ABC94758335824
+0000018CBCD6189E5E623C88BB78D2164000266C0486D478960185C9888D8333A69A5422362A1E3366477CF46EFC945B9C35FBFD72FE380298168D78C6B1F13C7612CD53
+0
+eccp_comb_point_multiply 745
+0000018BA4E1EF4118079028C7E2DEB1FB6FABE4E3F12043554C7638D77268BF16B22606867C1BBA5FF473A6851DFD9AEEC4F278936AEE2B934489C4578EACB887DA4CD9
+00000110708B859A7C5B5EE0D9FDA42615D5EE4B88625B57DFFC30EDF23E22CEE210168FADAC78393269452557EC2D46034F47A7319C8E6CCB6FD6DEFE07926EA527D069
+000001484E61B9596454DF967DA01DBB03D77CE03C34452A4467CFDFB99482A55A458CF9DDE213F4A2F7E760EA66DB3F27A6E6FD13839DB3DA8D36F8C9A5E70DE865E30D
+0
+eccp_comb_attach_const_table 746
+6
+eccp_comb_point_multiply 747
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+0000011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650
+0
+eccp_comb_point_multiply 748
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+000000F4BB8CC7F86DB26700A7F3ECEEEED3F0B5C6B5107C4DA97740AB21A29906C42DBBB3E377DE9F251F6B93937FA99A3248F4EAFCBE95EDC0F4F71BE356D661F41B02
+0
+eccp_comb_point_multiply 749
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+000000E7C6D6958765C43FFBA375A04BD382E426670ABBB6A864BB97E85042E8D8C199D368118D66A10BD9BF3AAF46FEC052F89ECAC38F795D8D3DBF77416B89602E99AF
+0
+eccp_comb_point_multiply 750
+0000009B220C1B2F0FD73CD3E754522E3E636E56667B6068174FC70BBD8A721EBC58CD2722E9A28BD974450FF5510D697601443ADACC0E956457633F4A72A8B3658C28D0
+000000998504C149C9605A08CA9506C7F60573D787AB05AD56716BBF311063B11BD13BA40F6F54C39AD01909F3CDFB2F4D7925DD9F57866C4F85798E6BDA9530593C6BD8
+0000017CDD02EE6C6A9791106FDE1C41FEB67D9DEB2AA8F89B7235B5B587485A789BAC6F7304301CF9B1BF889968507B3C18BC8C2677109DE1F50980261E671CF828839B
+0
+eccp_comb_point_multiply 751
+0000007B044C096076C3645B07E50DC0FCCF3B0679E592BA938429C49DD7F53A27ACC556C0080411AC8E96B0059CF4C733FF9AD7A06854A1F7FDF4AFD3D146507B4B895C
+0000001D488E84CA950640234D0D050B6C81144D5CF95D2F13DAEE63CF9CBE48A81DAACD1045AA65FDF382B1202886ADE70AC99947B99EBFE0B4E29EA10C41F3749614DF
+00000017F83A80FD7BDCAC1D56B6C755A16FD11D312FC171750948720696270F9E2E56EB38FCA60E2F109783108ACD7B64394FB142C833CEF1DD99D1D0646824B0ACC0C4
+0
+eccp_comb_attach_const_table 752
+5
+eccp_comb_point_multiply 753
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+0000011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650
+0
+eccp_comb_point_multiply 754
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+000000F4BB8CC7F86DB26700A7F3ECEEEED3F0B5C6B5107C4DA97740AB21A29906C42DBBB3E377DE9F251F6B93937FA99A3248F4EAFCBE95EDC0F4F71BE356D661F41B02
+0
+eccp_comb_point_multiply 755
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+000000E7C6D6958765C43FFBA375A04BD382E426670ABBB6A864BB97E85042E8D8C199D368118D66A10BD9BF3AAF46FEC052F89ECAC38F795D8D3DBF77416B89602E99AF
+0
+eccp_comb_point_multiply 756
+0000006A5B075AE764990AC85380C10757A15511D6B7E2627BCA48254476C630D01F94CFB8860A5C0EC4DE47094A014668B222C4FDC77080E04E666D1F6EC71B12358E99
+0000014E0A1C3CE507D429FB0053272D3451BB121695DF4B8BFB95940B3D893EBF90E5BAFB9AD6CB2613355A8CA55961F4F79897900C3226F59CB7A1D8A0567DFE9F3B2E
+0000017B0BFE1DE49A1CAA6544ECEBCBA498C1361DC540983E5B9DD968D73D53B753B883E45DEFB7861CDB1176BB6B65AFFF43D4AF930385837C5A5503EED7F1E6C0DFA0
+0
+eccp_comb_point_multiply 757
+00000104FFA08B9F54AACA6E064275FD315D99D2DE6C7100C2F1E64093626D30B092BDFA59C3AFCCCB8D2752E22416B1C5A4A6EEC9CCCE51F7C537E008E9D3DDC62D1011
+000001C7FDF0573E434DABA53521DEE160D0D7124D8236A0088D0FB6C64B22F2CE43ECF330F1B26875F428AA9AA9421AE0A64DB7BBD2FF33EB5E839CBEE9121B11A2F284
+00000177A03BE32169E2510C89CACDD6BB6F4C3AB961B32D6DB4F9300EC6E2FAEC7DC79104693F97536CEB9AFBA318D247E994C09E2A7E3C71025F69ADF45A9D8FDADCC7
+0
+eccp_comb_table_file 758
+1
+5
+2
+eccp_comb_point_multiply 759
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+0000011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650
+0
+eccp_comb_point_multiply 760
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+000000F4BB8CC7F86DB26700A7F3ECEEEED3F0B5C6B5107C4DA97740AB21A29906C42DBBB3E377DE9F251F6B93937FA99A3248F4EAFCBE95EDC0F4F71BE356D661F41B02
+0
+eccp_comb_point_multiply 761
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+000000E7C6D6958765C43FFBA375A04BD382E426670ABBB6A864BB97E85042E8D8C199D368118D66A10BD9BF3AAF46FEC052F89ECAC38F795D8D3DBF77416B89602E99AF
+0
+eccp_comb_point_multiply 762
+000001E50EFBEE9CE1D956A784AD88B9A0BCF6DDF0E1EB8E01E4C3491EDA33D14ECF6B71A561559AC2812B250A1A0A8AB97931F90C5EA43FDEA1A7BDDF350CDAF5AFAF23
+000001E24372E68833BFE1AD8AFA2608E12DE27D4EAC439E17D3FD302F3C581FBADF6A15FA62506EF073E798B9838D434F4251FC1328EE73BEA4D07C581FBDB245BDC1AB
+000000F68258976CD5D50290682B0EBFC6C3845545BB7B44FDACB1566A9FC9C3308B9FFF3A54D46950180289C0214326B7DAF5A02BAA8F2A036EED08E4590056EB9E85F6
+0
+eccp_comb_point_multiply 763
+0000000B7FF7C78041D3A4A331545CB0BB1142F9071612EF10D75CA13B08FB645E9DC7B772F8658BB73F19272CA2C84626BCCDB30223F437C3CEF81083CB003509DEE493
+0000008DF1595B6812738D11C1B20EA7A61C1AA730558B04CEA45EB0B6DC28DCE76D8C3DEE63D14FABE5A3A1D47205196AB8DB0EC30A445E71C4AA4F917B61573F84FE00
+000001A20935FA6031DE56660362FE2FF789D09893B8B10924CC95DF73EC77C52D2B0792E19EF486663FFB5787E8B940730ECB1FC4EFB591752FBC1697322707488809D8
+0
+eccp_comb_table_file 764
+2
+6
+1
+eccp_comb_point_multiply 765
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+0000011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650
+0
+eccp_comb_point_multiply 766
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+000000F4BB8CC7F86DB26700A7F3ECEEEED3F0B5C6B5107C4DA97740AB21A29906C42DBBB3E377DE9F251F6B93937FA99A3248F4EAFCBE95EDC0F4F71BE356D661F41B02
+0
+eccp_comb_point_multiply 767
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+000000E7C6D6958765C43FFBA375A04BD382E426670ABBB6A864BB97E85042E8D8C199D368118D66A10BD9BF3AAF46FEC052F89ECAC38F795D8D3DBF77416B89602E99AF
+0
+eccp_comb_point_multiply 768
+000001C0DE4B37ACA24D2F3C340EF61C33A6ADB3392D4737DD99A1E060DAE1E4C894F7D2A5D0E244089FAFF1D810258A2A5B85B5BDE972E91CDDF90631E92AAA207ACC69
+000001579011178A854C48C6939E3846958D292D8AFAD02B96C4FF6CEC1452E362723B55A40E880E6DC4B6688596665E8BBBFA5C0E3E699983F040AF93A3D1C58656D539
+000001195C80FD6862A26A8E539E3F96FD3888E41AB2189EAB1C1737A40C01A3E27847728926710E27120C129F52A0402CCBE2264403D783393FA5CF16003636E83B57A4
+0
+eccp_comb_point_multiply 769
+00000076509A18BF409B5CF792AFAA34B47386C7CB3DA1091D83A86D9F04B77C0047905FC30BADEFD3019267E1A451E53A19830B555AEE98F17CB3A83E5D805388437409
+000001C124EA58CF0D6A7A0FC08933B4721F031072E6BF1BAE87BF9941957E43DF063B2CE7AF89503E5AAF2ECBB558A74AB29BA93855AF046FA31BD8DD390153C5D2FDA3
+0000003188852E864EF604DA21A33A83DCEB66422F4C20F305EDDAB662D5AA2F81E282C95EF5F0BB6AB1576E03D30C2253EF4597ED3991FF23BB97A48B6D098678A091D8
+0
+eccp_comb_table_file 770
+2
+5
+1
+eccp_comb_cr_point_multiply 771
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+0000011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650
+0
+eccp_comb_cr_point_multiply 772
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+000000F4BB8CC7F86DB26700A7F3ECEEEED3F0B5C6B5107C4DA97740AB21A29906C42DBBB3E377DE9F251F6B93937FA99A3248F4EAFCBE95EDC0F4F71BE356D661F41B02
+0
+eccp_comb_cr_point_multiply 773
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003
+000001A73D352443DE29195DD91D6A64B5959479B52A6E5B123D9AB9E5AD7A112D7A8DD1AD3F164A3A4832051DA6BD16B59FE21BAEB490862C32EA05A5919D2EDE37AD7D
+0000013E9B03B97DFA62DDD9979F86C6CAB814F2F1557FA82A9D0317D2F8AB1FA355CEEC2E2DD4CF8DC575B02D5ACED1DEC3C70CF105C9BC93A590425F588CA1EE86C0E5
+0
+eccp_comb_cr_point_multiply 774
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+000000E7C6D6958765C43FFBA375A04BD382E426670ABBB6A864BB97E85042E8D8C199D368118D66A10BD9BF3AAF46FEC052F89ECAC38F795D8D3DBF77416B89602E99AF
+0
+eccp_comb_cr_point_multiply 775
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386407
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+0000010B44733807924D98FF580C1311112C0F4A394AEF83B25688BF54DE5D66F93BD2444C1C882160DAE0946C6C805665CDB70B1503416A123F0B08E41CA9299E0BE4FD
+0
+eccp_comb_cr_point_multiply 776
+000000E7A0CE945EE6720C718F961A5D0B7FA0413D103F131362A475E579A799EF9D529A780B708817C9AC5F8E6771AF76BA5E9FC703A96EBE94ABF46B05F8AA191D110D
+000001187E29A04C13CFF63DF94AFCA147D0B0038D272DA8C8D05ABED8B6AA6F6B1843534DE26CB63934CB1E154E357DCF9EB5040BDACF539524F04019B40F7B6A1F71A5
+0000004AC849F74AC11765887C1DE8D9F6B52FEABE659D67E7279DC010CB3A64E981D7EDE4F25A7965605D99FF7035E80747073F240C9CFD910818AC54C457851B6DB662
+0
+eccp_comb_cr_point_multiply 777
+0000005D59BE346912CFB254C6F7E7CF8DDE3553047BF6A841A1F67EC2EAE2B69F9ACB927B279BDB1D21BBF922F3529300001BC696A2DD8535396B41DAE6E85B9FCE897E
+000000B6EA50774088492BFE46488983401E683DFB7425D03A3E4573BA339E15D42FAC875EB73573B33BFFE9AEB84873EC266E3D589CBA441D6D7CCAFA5F00617D8D5D92
+00000095774693D44697CC015F1B73682989EEA1B60721FA1AC2B2C9190A09E275C592E36431CDD8B866BA7189312F1112524482C73E81C13736ED8E118707D33579ACC0
+0
+eccp_comb_cr_point_multiply 778
+000001350620511D2C61EAAE1105A7AABA62EA6330EE12A7101BCB74682F9D5973A33355A0D4D9D77BCFE618C558605BC9D9BF64B87D35FF523756CB70FB5F4D83778254
+00000089F3BD4726BF17E8DCEF69B90523ECA89432A073CC95C21A45E718CC734A1EF71D09A1F345D2617503807641B71D0B5FFA8B59E23DE3C0F9BE9251A19A56B22A45
+00000196FBD30D30529453B776DEA3C31BC18FB1E9618FA67290D8D158ADE3A2E66E876527700C2B408866E3A49BFA94A33A05139856404997725C7888E4621189DDB2E7
+0
+eccp_comb_cr_point_multiply 779
+000001E188981695B2504E7E5AAE4838F5B841F2B10BE60972D6C43B98982155076BE849488AABD02C9FDF2DA09A3CCE508E54B81BA8D897128B47090148F28E9F2CDBB1
+00000005ED4AF680EEE10E1D60F8706DEA71D78FEF3F27635B7BC773E7192A421F3B767B4B508819630411DCEF7ADDF80F589FC2E6E768BCA1A2357987560748CFA1679F
+0000010732826A1E9C0F54E8DC3E71A378353ECF2672481BE4D5D84266FC889875604CAF46774FDCF4924591C2D582DCA667C4D92BEE84DF227858688064A9F7452E75F9
+0
+eccp_comb_cr_point_multiply 780
+0000013DEEF532611C7920A6FB499C89A1632E81E2EDEBC9A3BC98C2CE6A1DD4DE2FF1C802CC9C9087D7F947FE1BBB77D83E89E68BD298CC0B2F313B30C61CC163B6E23B
+000001E47DA587C610664910E4E189B63D62D92FAF798A84831C498E509E2D9080DC76B93D8B1C33FD72CC32DDB68A2BE10A9BB3C1D9BF1912A3977077E81D33DF45890A
+0000016826BE14889E6CBB55BA810AD2F13C7F84E35D3FEDDE7720B94E933BC534132B2FF36012F17192639008DADA8950626D62E64928F1C848A99567705E2E15613F5E
+0
+eccp_comb_table_file 781
+2
+3
+1
+eccp_comb_cr_point_multiply 782
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+0000011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650
+0
+eccp_comb_cr_point_multiply 783
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+000000F4BB8CC7F86DB26700A7F3ECEEEED3F0B5C6B5107C4DA97740AB21A29906C42DBBB3E377DE9F251F6B93937FA99A3248F4EAFCBE95EDC0F4F71BE356D661F41B02
+0
+eccp_comb_cr_point_multiply 784
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000003
+000001A73D352443DE29195DD91D6A64B5959479B52A6E5B123D9AB9E5AD7A112D7A8DD1AD3F164A3A4832051DA6BD16B59FE21BAEB490862C32EA05A5919D2EDE37AD7D
+0000013E9B03B97DFA62DDD9979F86C6CAB814F2F1557FA82A9D0317D2F8AB1FA355CEEC2E2DD4CF8DC575B02D5ACED1DEC3C70CF105C9BC93A590425F588CA1EE86C0E5
+0
+eccp_comb_cr_point_multiply 785
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+000000E7C6D6958765C43FFBA375A04BD382E426670ABBB6A864BB97E85042E8D8C199D368118D66A10BD9BF3AAF46FEC052F89ECAC38F795D8D3DBF77416B89602E99AF
+0
+eccp_comb_cr_point_multiply 786
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386407
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+0000010B44733807924D98FF580C1311112C0F4A394AEF83B25688BF54DE5D66F93BD2444C1C882160DAE0946C6C805665CDB70B1503416A123F0B08E41CA9299E0BE4FD
+0
+eccp_comb_cr_point_multiply 787
+0000010B20B6FA49AB8201846CBF8833635055F9A912D3321D046DF411F2963B441E3B7C2DE808F164DD7DFE1CE2EBB4E306C67246D33B954BCB23546E60EA8CCDA0463C
+0000004C47F530278E8BE3462F74094D277A462160D352333252C9DEC3FC27724828B5F8E95E6029A88CFB4B3D02A37F83957DFF783FA90E70609A8B4ACC5F0DCEB3F101
+0000007DCB70ADD09A4ECB17EA699F74A2C48B769B44C3017EBEF9B6234CB59102CAECE1B382000B184C35D5F8233B893279988870EC8E183FA3EE1361DBF0EC64A00E24
+0
+eccp_comb_cr_point_multiply 788
+000000EF28DB0A895F734F2901435C807ABA27B02E94D9B39D4C18E7D7C1DAD39EF7709B0B6299C613F21F3C690A8393ED61E0B85B4BF412E066C9C85DA88674910C36EA
+0000005D3FA3995C2A539613BCC415F348284E9906500582A4F1A90B058D72DBD259CA303B076AD6D1FB8F76D4E8E1F399BA6625CD616D0046A97128EC9BDCDC45B986F3
+000000DAA80DF11EE8D40C939764DC2FA0186E6252052ADA12C8DFE11A9F9AF788641DA6BF4DC5B0F888BC0E6B20AFB120F54B1E2CCA5911D3D14F2C2B2B0191DC4C4742
+0
+eccp_comb_cr_point_multiply 789
+000000AB3BCBE98FA74F640E5FAC536083DC0CC5F81060D22DA69F90DA954E7CB848FD9CB18751BE840DE1FC2E509F22A8242BB4646EC49AC4A7B23E57C2FF36A7B4DA5F
+000001DE3EFB4C73AEBFDB2C8952FD64C9098BA309D8E80D3262AF866186F497860E04BF3C0A42433F95F0AB1374CC0D084FA534ACE749DAEC51F7BD93E6B12054D326AE
+000000B0853AC24674CC13FCFF2C0FCBDCCA46E6B87245D4DB7DBC767E062E3541E9D67812099A4D15F575E5391190197BEF5545C948CFC501AC1328016A644F3BC5FBCB
+0
+eccp_comb_cr_point_multiply 790
+000001883F9C6EEEA13BF1587DE02491B3C2BF3A9E3C7D8BDD4E2D3650D9AE108045E210059474E924F0B6F91744797EAB391433A64D6C710555573A04F744B440E7551A
+00000167205E6A1A901A24B06485F58731BE3F1CFA57C47D2F72F93697029D8A3FFC170F359159F2DAD9D7BFB559F2292245943A3B9A163001A24D7F61A4BB8F622AAC6C
+00000094BB6A1A1B68ED53790D8C1A96F62D17D77EEBB340E4CC4D2BD92642CA82F6C0164745911699D3B947F02F97150817B6F71CBD3F2D57ED0B5CA8587FD1E9C67998
+0
+eccp_comb_cr_point_multiply 791
+00000013883A7B88533746501CF3B039B36D28DDF00BCF87A358A72712003A68DDBB18A139DC58A226F7A7669C614DF426EEC556D310817121C654B49C1C103CF2238C17
+00000093B09B58074BDB51F0E24BF5A09C7945D5978BAB1BBF7053F72C7A11F444548AF58F8FD0BA422955AC38FC2A1B64A8ADB359485735DA3B3A8EB72A4E2BCB4D7B67
+000001DC9B863B2F3A2EBBFBE01FF60CB9F18F27DAD5AA906738046BC6E75F79BC75E8227B0E28FBB0FEEA497B6E63CE4DFFED64645D81442459F51EC343C023B1CB7D31
+0
+eccp_comb_table_detach 829
+eccp_affine_point_pack 792
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+eccp_affine_point_pack 793
+000000B0815B8E2CDCAB244AB8D77EA9BB6B6ED2C863A616CC5494B5F6B302B86962D35A7FDB7E8CF4D433BB8E2152AF6F9F0CDFCCF033FD068084B279C9E673344EABD1
+0000000AEF4EDF9AE26281CAD6B04B7EAA7499C8F7EEBE22F61F9F8A375AA27A02E75E660D4AECB619F9CD539F6D689274C420CD90D171DFF5C2AD1DDB35B2EA5B2CEAFE
+0
+eccp_affine_point_pack 794
+000001EAB0646C9CADEDEC87E19D35E4048D74CA7BA55A0CC37746E55EA9748E5691A96BCE5BD3AD71A933FB1A384AD5B428A30D09ADAA5E3A8783EE10647746253FDE43
+0000018947B9FD310FDCFB72E6AE46E92078020293089FD2A670744F161DDFCA6AFFBE5075D7E6AB232B70D8CCE7379023B5E2D2A2342FE4ED62D6D98C1C73A83488DF9C
+0
+eccp_affine_point_pack 795
+0000006B0A79DEEAFF4A3973CF819A9C08FFDC20555FF7B16253B1139F4747C569BACC77D86E29B8BF4B1B432E92D31CC95F96E22AC93CBD7CC749CAA3143ADF73890E96
+0000017FE1F594AD3C327A9B7C3309CD98EE297FD726DC01B9F9F974A492CDAB89C23E2BDE4AC2FB0FB451B4A849F97AE02A7474B7A8B8B7E5532C18000200A78AC20707
+0
+eccp_affine_point_pack 796
+0000000FE2C0CEAC2F1D9A5D0669B61A615D0CF075AAA70E2E388289F3C14795AEB2EA67FEE9331B8153C11401F7EBE734F64EE9C0B654D5F8030055DF76777F7B5F176D
+000000EB19C6907C5FE5832C8404CBD0344F78D8C8801524C2F8A374EC9154D257F515A8E0480B6FB4EAE61B5E9B5052CC99723CB7BC9D0A6FA4CB9FDF7E94A4468FA2DD
+0
+eccp_comb_precompute 797
+4
+1
+eccp_comb_pack_table 798
+eccp_comb_point_multiply 799
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+0000011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650
+0
+eccp_comb_point_multiply 800
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+000000F4BB8CC7F86DB26700A7F3ECEEEED3F0B5C6B5107C4DA97740AB21A29906C42DBBB3E377DE9F251F6B93937FA99A3248F4EAFCBE95EDC0F4F71BE356D661F41B02
+0
+eccp_comb_point_multiply 801
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+000000E7C6D6958765C43FFBA375A04BD382E426670ABBB6A864BB97E85042E8D8C199D368118D66A10BD9BF3AAF46FEC052F89ECAC38F795D8D3DBF77416B89602E99AF
+0
+eccp_comb_point_multiply 802
+000001E8D91B95FB0C5271223D486444B4B13F7FF58673593E07ECC692113053D2CFCCB90C5C37736923C548C46F91F438BC6B07E2F188838DE2AA4536A6C0F6AD5D37E3
+00000016A7A540D804B3F124334FC7924481F82ADD8D1EDD6D077F87E32346BC49FB2BCE670F2CE45655D7448A7446027BF9E91581786E71AD91DB6128396D8BD6F502E9
+0000015FA13BD4FFBA0B6914064CEE1AEC87F67998D6748AA0552FEE737F182803D0B71816107FB2EA5B6F23008FF8BE568F9DDF83A7CF4C89358EA254BAF9C157742B47
+0
+eccp_comb_point_multiply 803
+000000DAFF8B0CE9C2A183A87DDF80EABABD5C1B3F8FB01F53E944800FCA56678CA29C6ACBE86C9D1BA231A3FBB33BEA45DF761252DEBDCAE9980984AF1F4899694814DC
+0000002AB7DA562341FB2EDE73C2D15E451B5FAC95BADDE25D0B029B266C8A4711B2E5C8AE6FE38504927DE432FE169638CC8C4DD9DD1682757B9351B7E16158351EDC82
+000000D174A0B0362F878A098C7BEE8F283F2F44BD76149058575CFF03A13A8685F7D4308C2F7762063AE756331D051FD7EA0410ACC0FC3A9C8F74B67C726BBC0AB7F044
+0
+eccp_comb_point_multiply 804
+0000000B139FA870243119578BC8E1E670C040B5DC869E9689DAF8EC39B26A1C68AEEF00EF3C85870B78804ECC7E760D50084EA94F1D38810C338A16C416DF16240472EE
+00000161A8281ECE7D091E18D163231615AFCD66EC560A79FD7D9CCAA01781AE1CEA0FD2C8826F85739FCEFE8069A9910ACAB48F6BBAE3E0E1C2E3511FE43B67980F8381
+000001223E7F27C34B3A5B072F06663FE006388CBD89252B1F8E72C04507291F80C5186CF25AA7B0D55FD96DF066AADFDE64EE080CD0FADFC2C92A99D5D49233594D3601
+0
+eccp_comb_precompute 805
+5
+3
+eccp_comb_pack_table 806
+eccp_comb_point_multiply 807
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+0000011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650
+0
+eccp_comb_point_multiply 808
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000433C219024277E7E682FCB288148C282747403279B1CCC06352C6E5505D769BE97B3B204DA6EF55507AA104A3A35C5AF41CF2FA364D60FD967F43E3933BA6D783D
+000000F4BB8CC7F86DB26700A7F3ECEEEED3F0B5C6B5107C4DA97740AB21A29906C42DBBB3E377DE9F251F6B93937FA99A3248F4EAFCBE95EDC0F4F71BE356D661F41B02
+0
+eccp_comb_point_multiply 809
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000000C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66
+000000E7C6D6958765C43FFBA375A04BD382E426670ABBB6A864BB97E85042E8D8C199D368118D66A10BD9BF3AAF46FEC052F89ECAC38F795D8D3DBF77416B89602E99AF
+0
+eccp_comb_point_multiply 810
+0000014CBA2885D5FA6FDFDAD3BCFCFBADC88858E697972800DE0573AF86CE48AACA2FB17A61927FC2358CDE7AE476584591B20470A5968E792D1F7CCD8832077E5553EC
+000001C9E43BB3199D5E74368257D661B6779861BC2A30A4F9A8B2828BF6DE796275DFC511C98183FB52241A73AD8889989C0BEA2A1772C78B2A2BEC51C6A0ADD72CBF7A
+00000121E2E7A6D49E978C0CCF11BA7F1C2F56E81B1EFBB1E595B8B43D56F3A695C4C1B25312367B118B3D94E26202B52355BE73545214B491D76D528C288650826E2C51
+0
+eccp_comb_point_multiply 811
+000000C79E784B5B527F137DDEA05D8CE8E50DC86457605E91BA9840EFB8C4950E90448F5BE440A9DBEA46B377184D9016FA9383FE3AA7362B33B37F3C32B0AC56C00EB7
+000001730DCCDB98D9CE8C9827DA61835697A844C9D32096AE1EBF229921E1AC056564636B07C18668F05C18ADACA70E8C455D810D3F9E25221B4D67FAE427425429A7FC
+00000176F18AB4AEBDE102CF4A8CF3C7FCAFDF6D4B6793DAD523CB2603544F81101A599750C932160FAAD8FDA7B3339B1B3FE1D068D08E45602449A5FC442E767E337C39
+0
+eccp_comb_point_multiply 812
+0000004566C7280EC0754B2773729F17698191DABAF9EBD1E2044B8D09F179DC7238E9CAD6BECF9DDE9B950CAF25779C0ED9055DF1C7DC9B38123E836B01691A33C2978A
+000001CC48508F8F7BEAC919E339073FED9F32C2241DFC1867115C0F65720D67EDC4D39F332F1C328A2F37B44AFF7B40CF660E9965FEA0E5AD8D3599F0EBDA6082DE40B6
+000001AE8E64689CC42EFDABA45610EA3F1E59094EDC5A8DB2C1CBF733014A7AB18EE4BA9E723471584A2ECB9D74EBE106021651EA3B09FB8246EB5C078D82760D55738C
+0
+eccp_batch_add 813
+5
+000000E9303C41BCF5CC249D5FE2AEDA490FCDEEDEEAA909EF6827E46C1D1742446941331504DB674D7277F7E9652FBFD232DD52F2DD31C9949FC2C19AC72A5A748FA7BD
+000001711091C07B542626044C0D4EB27A300805D889920B47213D0F9D6E1FE61E3C01E9E9E5595F581183D64B5AB881C4CE1BA56EEEE0034DEF2BCC1DB6E426E65B13EC
+0
+0000013241088E2635AE19CF6C42E1239451D3F879D11858E6C05FDC63BC942A41F6EF23B8475959213EDA0A964A8FD0A89A8FD0663163B8D3B37063A60E1FB68B0C1483
+0000012E7DE2F35F089871E3E2E5300F2E911280E86CBA035380A22796EBED3C18F7DDEE09E926CF60447FD6CAC83F053336594321798EFA6C0987500FDEA7377039B3B2
+0
+0000018964FBD0D7679DBEC2AE8C51081C282E6D6D5F189EC5794D158886EC523DA3E301FB3252344C4E283A50009754F0B09FA27F75A8716A77C7F4D3D0FBE336B7B37E
+000000F5128A7C39E20FC1B00BFCEDB3B44B8B604BAC53F2115A2FE4652F98F974244001C357063EF420B102E832EB0E8C55B095CD28DE987FBF28C5E8B91DAB058C2351
+0
+000001F46EE6EEFA16CE8CB562B8C6A54EC4C42926265B936A2A88604C2789EC6ECA5CDB7573C41E546230F4E521AE2E34FF3E1BF493505025DB6D3E96B7668EFBE358CE
+00000085C92062D0BBB142992FE5C52A5201F325C9C8011A9E4ABF7B0EB22B19E3FE3C41A7714C1269AE07DFAE70E0C8115847384E169C6C5BDFEC146FFA3D23ECB5982B
+0
+000001F46EE6EEFA16CE8CB562B8C6A54EC4C42926265B936A2A88604C2789EC6ECA5CDB7573C41E546230F4E521AE2E34FF3E1BF493505025DB6D3E96B7668EFBE358CE
+0000017A36DF9D2F444EBD66D01A3AD5ADFE0CDA3637FEE561B54084F14DD4E61C01C3BE588EB3ED9651F820518F1F37EEA7B8C7B1E96393A42013EB9005C2DC134A67D4
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0000006186A6995563DA9C83DE5B0DAAA4C013155F22FE2751F6CE1B89553ED23DEDD22E84B1C99EB83440878DE3E166DFEEA8BFECAF21068AAACAB9786683EEF3F17032
+00000045F91016E55CBF48585A8C11E0D0E0D2CB55BB4DC334909A5D735EF272E0635B8DD346ED47BD2E61078BDE841A3D2DFE14A14E8B7F4C3AA7BC2B2AF1B31CD375A5
+0
+0000006186A6995563DA9C83DE5B0DAAA4C013155F22FE2751F6CE1B89553ED23DEDD22E84B1C99EB83440878DE3E166DFEEA8BFECAF21068AAACAB9786683EEF3F17032
+00000045F91016E55CBF48585A8C11E0D0E0D2CB55BB4DC334909A5D735EF272E0635B8DD346ED47BD2E61078BDE841A3D2DFE14A14E8B7F4C3AA7BC2B2AF1B31CD375A5
+0
+0000002A6A6591D32FE6F6EC9613EC59D89713AE6B922BBA04E5E811E53BFBBBE0CDCE8B8A9B4009BA59C89767F83F40E8F6BB49B87C4BEE2C8F725A1E66B7BFE54DAAB9
+0000003AC8512F58F5B423053E4BF983CA0856E17B8B8A3145CA9C3F0663F96B281CB904A291819664438F448A1310D997FBBB8A6285B9F70CF10DFC2DBF3C348D801429
+0
+0000002A6A6591D32FE6F6EC9613EC59D89713AE6B922BBA04E5E811E53BFBBBE0CDCE8B8A9B4009BA59C89767F83F40E8F6BB49B87C4BEE2C8F725A1E66B7BFE54DAAB9
+0000003AC8512F58F5B423053E4BF983CA0856E17B8B8A3145CA9C3F0663F96B281CB904A291819664438F448A1310D997FBBB8A6285B9F70CF10DFC2DBF3C348D801429
+0
+000001D9F376BA7D891C8E95164C1EB659EEF2BABD01ED2D2A713C1E7F9B1ED348E837392EB7C61CE0038F499B1246BB5A4B67FA53FDB98BE0333CCD941B1009C613A90D
+00000008EC07DE5E4090350881C50FE9686F4DFEB7B2231199BC265D7F3894F9C7790B33D660AEA039D058E8097D01AEBA797FD6785445008D03CEB6428DEF88877F99B4
+0
+0000002D0C7D120CCC7851E22D7031EECDAD158250994E9107BEDB31D5562194015520E260749F4157666C1A3AAFFECAD396B82D88BC7C46FF9D8BFAE2598A6696CAE264
+00000021C0ACA2F1138596E230403F5FDFA9CD317CF0D12A1520A603BBE46C1B220CDBBBB1D6E4C226E9733A6684707FA89F75BC0D970F3B75E016688634991D12053643
+0
+0000013FD482FE169C14A54096E70ABF246FEAF5CBBB0E171FF7B3C7E271357D046D6A62266346536A83ED6C40185DFF50C3C930FEFF8F045C172C4CEB2F68B82B231702
+000001E2F57EB48DFEFFC1FB9AE7EFFF3BCA346BF0B3E430A9BFB984F3A2694F170F81E02C1542457980476BD48812521ADCE71B21168D9F98100B43CCDE8AD68A92C1D0
+0
+000001D90198DFA77882E1A63C58881EDE9A664202CA3F83E583CEE566A9767EC52351B220DD6897A1147A62E836D5A4DF1D1C1516A1334F369D81E548655B70FC4A0DDF
+000000F55B2433616A00969C11E34E52422B378F2BC0045B2BAC94837F9C1B6F002473A3FAF28BE1199D0F45BFBE0EC62EF7F4E65394C4FADF72BB3914C50579244BCCAD
+0
+eccp_batch_double 814
+5
+000001B4DA1B95CF8A20E0F7A3F4E9B39AF45BF13A92E66D9BA0896511E45EEDD25F730B7E493F611289A13A5254C9938930D1C79A7063CD868055AA5BC1FD6C985B597C
+000000829F8DEA9B37D7C3B6548C2D0C89C006797061CA725AC3DF1FF3B746D843518A3B447D7D31B53E726EEA108E1504CC617FAC92311F44EB4669F28BA397AFF3C86A
+0
+000000B689606E36DE7C3384232BAA25A81372A626B4C5C66A4973D96C7CB32976B3E28B780D7FE093AB9B04F9350D43E610FB4BEAF9488049FC2971DC23F65223F70930
+000001898F886B02E089D2E061CE2EB32775B61D57BA8D887DF3318DCA1C2AFC0D5F1BEE14639B261A0E7DFB6C6EA07C8621A00565A470954E7C4E8B0C0EDA1BC31C396E
+0
+000001A79160572F2B47D5E549F28ACDFC160A7F6EF3379790F6B98CEFAE77C00051D4DA6DEE1561513BF7184350190EFB49B5F65F1F7CEC95A2452D869BF6D052127E93
+000001E981B9552D117F911D1ECACF6A8143EB4D7F897746C45E452F703A4EF8A51F2DB042C2BE5FCDCA57661874736CA3B424D7A93B43B37B4C318D23BDBCEA2011E276
+0
+000000DC3318D83CBF6F07D583A1B90716012CA9FF13A42FBBB01FDF82031CF357AA055C30DDB6B2FD58595817A8A2D795A82B65A76892890259E73C17A659019F6D66AD
+000000F230EEC3DEA70829EB1255715FAE55A97587D57444FC5D0D0B90CDF7C5638AA0DDBF10B1C9290C8C703D286D8C1C2ECD0A35032DF2DA973E1109B5BFC3979892CE
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+000000E90F395E3F0E1E8739868F3B8E5B1C3BD78D7A97EFF355BFC74A25D50A19F8D5E3D4E113383A811418695F55BC20797781D0B3344203EC7AB7D483986DEF6EAC08
+000001FB096260367EB4AA6538D3F414302127F05C76DA563C0A63418EE4478E3212B59D3EC2B41CB6597206AADD7DAAB1C94038514C233BA0074A47A8A5133AE57EFFC1
+0
+0000010E36B4598EF3C3FC90A99C38C420771A3560C485CCF80F17CF2D3B3E4D059DE70BD7A59F2C8ABF3D239ED85A65EE2D7E6D4413885FA0AFD5589F3A14721CDD8F66
+0000017964C5CBE91BAF4CBF4825EED64752A4C834867E2350726C9FBE6774295A5D8BA94769585E4A5FDC6DA33C653415F656A85120E860537922F111369BD4FE957C85
+0
+0000014C4F4DE2F982839FC1F115643313D3B4E843E9B4F134E8E5488E2892B98427178D17B3BDB19C62CDE8AA0AD43AA959A18ECC927B1FDD7E7D478EDC04F5645201D4
+0000009CC8C6BA18BE37AB1090D83507EA614781ADA3AE416FC1239A42DEDF357915F4C9EC4678EDC89B4B0967AAC56973994DB288170E578F0B106CF1B6FA6DBE2C9B71
+0
+0000008BBD60B3597F51F52971E8348B69607A04FFEF6E05D45C0522E0A55098935D4C562F7CB9E9F55DD83291F9749D07E52CE12C9C49B9862549535045E096395F3B59
+0000019EED4580E4D1053ED87517F334D6A7E6BA3A43C18AE797FF05E22C946687D7C7EDBDB3DFBFB09C83A75469915626E513025706FD5EFED55A447FCA5B78D91E5776
+0
+eccp_batch_negate 815
+5
+000000C484D10D774BEB66A1D9F95BD4DB4932D90C45E7AEEB5BF515F1E70AC4882D99E19FBCD06F8338E858A954FAEF2844F6F1FC73EB5A31FBA15F70704A747A919D94
+0000018721683BC74DF9F6DC2E4DD3F12652DE6D0AE2B17E7F74F85898591108C4214B76FC4A360F7F527A344AD7B8A1E8BD60434135EECB1DA8736C70A9F3B2E4160F35
+0
+000000C484D10D774BEB66A1D9F95BD4DB4932D90C45E7AEEB5BF515F1E70AC4882D99E19FBCD06F8338E858A954FAEF2844F6F1FC73EB5A31FBA15F70704A747A919D94
+00000078DE97C438B2060923D1B22C0ED9AD2192F51D4E81808B07A767A6EEF73BDEB48903B5C9F080AD85CBB528475E17429FBCBECA1134E2578C938F560C4D1BE9F0CA
+0
+000001B8BB07F477F13D86264A78C1C1EF85E3512896B679CA0B8829CCA22AD6F673929EF980DABC6D9CCA7C00891A765BD96DC0EC5B227AE3CC02BDF3BEF396D9DA3BC3
+000001E29AE75F5EA9907ABD1EA03F2003ED23DFD5D2ADDAFE8DCF070DF86B6CAFE5664F8C9609152B19BF28892F7927229884733107CE92E6E1FECF8D4516425A2325C2
+0
+000001B8BB07F477F13D86264A78C1C1EF85E3512896B679CA0B8829CCA22AD6F673929EF980DABC6D9CCA7C00891A765BD96DC0EC5B227AE3CC02BDF3BEF396D9DA3BC3
+0000001D6518A0A1566F8542E15FC0DFFC12DC202A2D5225017230F8F2079493501A99B07369F6EAD4E640D776D086D8DD677B8CCEF8316D191E013072BAE9BDA5DCDA3D
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+000001DE9D15472B6603808FCB9A6E387F447800E2410A2D04AC9863EBBAF62AA781AA75DAA539461FFBAC2F8234218B23A59AE7536A85C431EB0FF3EE12CF0E00D69CBC
+0000012E6E4DABB68D8534D66C7A9A506C3ACD2CC9E3C08BA7DEB7EA6AE830425E4B3DB3163DFA11EB890D951585DDE1BB71993DE26B1D2D22E09ECA0D2D4A8A36C8F464
+0
+000001DE9D15472B6603808FCB9A6E387F447800E2410A2D04AC9863EBBAF62AA781AA75DAA539461FFBAC2F8234218B23A59AE7536A85C431EB0FF3EE12CF0E00D69CBC
+000000D191B25449727ACB29938565AF93C532D3361C3F74582148159517CFBDA1B4C24CE9C205EE1476F26AEA7A221E448E66C21D94E2D2DD1F6135F2D2B575C9370B9B
+0
+0000002E5D89B2F06B3E730CEDEE7187154523838B3164D4C53CC81ADE8A402166C2A52D88FC826C465A6B6BD614EF23B78A115FB85DCE513164F658C1EC0B8574D3EB11
+000000D792F74817F2BA141E7C961F8E9E743B3D313B4AE9126DDDD7EE1617BA7CCE466008F2270E9BFFA152606BC91DB34F6C68E2FF0C19958508F74CD6F21C7D537A05
+0
+0000002E5D89B2F06B3E730CEDEE7187154523838B3164D4C53CC81ADE8A402166C2A52D88FC826C465A6B6BD614EF23B78A115FB85DCE513164F658C1EC0B8574D3EB11
+000001286D08B7E80D45EBE18369E071618BC4C2CEC4B516ED92222811E9E8458331B99FF70DD8F164005EAD9F9436E24CB093971D00F3E66A7AF708B3290DE382AC85FA
+0
+eccp_batch_add 816
+8
+000000699F35BBC1CE4CF293F50B344785BC182723C3A64631880BF7CD36714E53ADFCA77812B18885CB69CE6070DE91740940AAE55A52E7514096329FCFFA04054F7614
+0000016533DD6BE5915F612DAC1987FEE2993C2E74BE2D18F497862E0C0E6DD4CF2446F1885153997D5FF948A190940B794D303D716F7225EF42D43C86EB58FBF98C3198
+0
+000001290BE2E0E8C4C2524682D1F80C19B5273B85661A9DB1747915B9A319090B74898755E86DA219C96F2AAB35BC168C4FF86FD17488CEC6AECD45E5BA5C039BE70735
+000001E92A28C3ACFE5CD5DBCAE9B4A69A8E70E91B252F8F97CDC3B4CBBA8E88606BBC9CF0D5D801CDC63109F721F2CD23EE750BB1230B2BA78C12FAC4A62063877961D8
+0
+000001ABFCF8A1A60097A2241C5C263F72C7480020CBFB8C273A7290348625E5F5B5D3E52C3259C2A983115D0FFE106563B1DD3B817195D061E049039A6C8FC9A739D26F
+00000075131B46D1120B7E2FDEA5E3CAFC2B83C8001C1E8004C2507E408B436B31843AAAF52F952E9D6CC8EB23A49141FAB82005EDD84C93DE1753CBA28E9E6FBD2814F9
+0
+00000161C1F29EFAD1098F9ABBEEEE2FF874C73DD2629626BC0AF4696D875886BF71E96908A31FAC375FD1BA7EA33626C81FA1D918E44C5ACDC26CE7E7B0918CCB16A888
+00000045305D89C150CC0726CB04814C0858EF5E68788D4CC57D6FB662A523DBB82D7C3BC9681C9829941BFB31C1F9856B3BD718E76704105D1C3E0CE1516B09C2D52822
+0
+00000161C1F29EFAD1098F9ABBEEEE2FF874C73DD2629626BC0AF4696D875886BF71E96908A31FAC375FD1BA7EA33626C81FA1D918E44C5ACDC26CE7E7B0918CCB16A888
+000001BACFA2763EAF33F8D934FB7EB3F7A710A1978772B33A8290499D5ADC2447D283C43697E367D66BE404CE3E067A94C428E71898FBEFA2E3C1F31EAE94F63D2AD7DD
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+000000E93480D587558F1C61C1B1A44366C3954FFE6F012E46AB9DB78C3C4607C92E54258CE9FFEE68CFF3581B7D16870EAE0E8DB1F5A258F97694533F352560B17E1E29
+000001EFCDEEC63B7EF6533EAD38DEABDC0BF413C23FD10C90F17095ACD6F81CCE30EF4DEE22D5BCA8FAB586DA5A4F4DF0157A6D46959600DFBB5E57FAF4D337D8DFB7F1
+0
+000000E93480D587558F1C61C1B1A44366C3954FFE6F012E46AB9DB78C3C4607C92E54258CE9FFEE68CFF3581B7D16870EAE0E8DB1F5A258F97694533F352560B17E1E29
+000001EFCDEEC63B7EF6533EAD38DEABDC0BF413C23FD10C90F17095ACD6F81CCE30EF4DEE22D5BCA8FAB586DA5A4F4DF0157A6D46959600DFBB5E57FAF4D337D8DFB7F1
+0
+000001F3630CEB4A2E8A6C84BAA6B6DECC5A26D1204C92BEF344B741FF798A94B744F0CA3A72A13EDED85FC89380C388896B69F8A7232D60BBB609A3409F2D4BF9F8DC7E
+000000E0485E37BE7A0E8F4424A56B734E3DABFE85A8E8D962D08A8E8D42152F752CBEE464BA66EC736C0A2AA20BA57E731DE4FDB13464FE0382B716695BA17E66269593
+0
+000001F3630CEB4A2E8A6C84BAA6B6DECC5A26D1204C92BEF344B741FF798A94B744F0CA3A72A13EDED85FC89380C388896B69F8A7232D60BBB609A3409F2D4BF9F8DC7E
+000000E0485E37BE7A0E8F4424A56B734E3DABFE85A8E8D962D08A8E8D42152F752CBEE464BA66EC736C0A2AA20BA57E731DE4FDB13464FE0382B716695BA17E66269593
+0
+000001E3EBC59B07603C0CB8EE7AF44E65C62C5EB25B80210CB5263F02D5FCDBDBF2AA3FEABDA0B161C1DC02966AAF38EA0A0D80FBB079C251951814BC5A7B8AA76BD550
+00000070689EB6C9B8A0624563E8EB04DDF46D9B9F0D4B74F15E5C6DF881E35209A953D44859C0137C0A42C8E1465366F6CB7823518B82EB8CE666EC0E79C8BCBF5C3FEB
+0
+000001694DEA7C1C9DAC9D51F14C6535127A64866D38D68161C00A936FF704DF09DA2840629C154B6B39E8D16E0FE55246246E7EF913516097C445544230918139394A52
+0000007DABB547B86A2A6EE0D9D21A9E45C5635463E691DCC4DBF6347299AECCFF4D7E4BE8D5EF8D2E713ECB7CE8D122AFD57CFDC1C09AF600806F7DFA56986772AAB2E3
+0
+000001CC02AD2736424814EAEFC4CA6E01576A3B78139C12913B7AF3811BD6E310ACE3333AA9DB4386D9109FA471FF902BC438E7D343881DE5B43C5B5E96D8E61837F06D
+0000007DFFFC3F6A8AC7D24D7B9214988484E8014145E1A1128E4B562250452E20A8BF33F242BB7C6CD1BBE9AD8579A3228D7952584F5610428A895ABA23D8C9B9E83A08
+0
+000000DEDAADDC0C0BC6A55F4ECBA86180BBBE6859C6747C86DE30C09A517369069DE3DB6829AD652879A19EAA40E86C866BF613B51F287A8226AEF608C6CFC058A53AAE
+00000035490887E1B89D76101B8D98AE1AE12561373F0F3DF9ADD269D5E77E33B44FDD536E0E37A45C6C646BE2858426AE4F9AF001649BE4F5BEEC9F5E95FE47187CB46B
+0
+000000EE0119C1B31FD2EFEB740A3AAFFC7E9FC3110CB2B9C49600C402547E329C19388D28F019E81588310523BFB1E8B9AA32C14B980EDFE0B60181E5C30A193C3C2C53
+000001F613C9632AE223BA994592AEF1A980C38D9EB4886746E4ADAF053250C709AF70C079DD9B2DC64A02E443B523794946AE26D695E62750A8524E223F10C7D66A8F1D
+0
+0000003EA9D9FDC27690E73A29B83BA4864256D58B97C728A3FC3BA66E992171C869EAF79F38FB629297008E82F3E222CEBCDC31388F68AB240C634A848BBB245DFEF145
+000001E7C27BFDD95BB0396ABF40ED6F66B358222182EF1EFD49C93BA1855BE29099E6DC52F43F7F81388C45468BEA7148084DF7FFFE44490710EAC0219E41232CC59923
+0
+000001129C684044FDBC55388BB7FF03051CC834F2A5121FB9A2930B51D96A59397D581047A280DF05E22DCDCC970705D94FBC1F20E37E51FFE8092FB0F4321EC38902F1
+00000052BDF02596A3EF7A986FC4B6C11BCF03B22434DCB29D1FF68C48F119A88E6A4B23371E753583A9AC5A95F45AAF87B11D3858DC60ECBD2004F17B969263501F75CD
+0
+00000066557BCB2090EEC1804FC5FD3CAAE354C02CC39AFE43645F0768B2D124EA660988CCE19C2C0AAE8AEB75573E50706CF80BCDF502151D3C542ED0E9AF7E4AE50A23
+00000038D1A911821F7CA07F59BA2706AD728F8F3982DE11F94777091AEECC9D3503219D25184DF9300F486A3A59F94A9282B87E1CDFB28184C337E507EE1CB834D05061
+0
+00000055B021976BC229912B08D73AE1F301A432FF3AE80E11CBEE771404AD1DA25E6950D038506B616AC3A5C01CA0DA4DEA60AE26592A67A259BDEB6BA7E7453A029D9F
+00000132993105A49E8D3FB40504429CB831C07BC5BDFFAD683A527022C29D067DA4C87341672AE466EE235C76BC5F5D49DB821E9A956339E6ECE06862DB52A5100ECA70
+0
+000000FBEAAE305747CDCBEBEBE0D7290418C902C90FE8880CD744E6E0BDDF9FE105E2C9DE3DBD7B2E6F63713505A1900AFC9D2D9EEBA2D3A695FAA448673B6647777FA4
+000001457DC0C6CF3668436F7015086CC0E952F5DA49A5A5E2C65AD40AB11611AFC60F5C7B290F71704E5125E467EECEFA53EE3B132F7667FC527A76820B7C6A4C69B3DA
+0
+000000FB1D3CAB9AD09473A6E104F158413509E2DEAA587B9589464B7A916770CA62FC5EA6ADBBFF4ECA5EED96C07D89C949C877DB8F5F0B50EE5229AE96DF1483046F64
+0000006F2DB272487E6675AE1264F98987812082A87FEBABCEA687DB65E5513B3DE4BF6DD08336A68DC88BBC586768CED294D118EF2B5E642B57EABEEF39B943FA9E7274
+0
+0000010ED08A239A8833A1DBC07D39EFB2DE5A82780B1B6646A6A54C8EE827FFB1270EA8F7305F244FAE957936742698296F24BCEDD3EBC86A77CF512F36700CA3BA8F15
+0000003B54834CBE6919A59692F8C217FA4877D4E7BF27268E6AF1349D28D47B5C11017346187797DF3E8382AB30B41EDE13564A969B179C4408BB7525D78C31348DAAE5
+0
+000001DD0AC120FE3679EE366BA32E2B665F3BFAC91FD33735B920B0DE41ED6A8037A2E5DAB439EC180F4A8E127F6FD8CA2642A950A5BBA0EEE29C445B7862256E08FE8C
+00000151317F9F9BD029B2A74A03C597DB6E5ED60C4518189FE821723391B6119F56DC3AF482AA976F896158B18FCB1DD6863C466F0B6564CCB1933E8123D0BAC3C02C9D
+0
+eccp_batch_double 817
+8
+000001ABFAD7D75E116181AE7A546D4B27E2C72F34AAE002816382277C1A6389D06F5FD6E4051C84F8E5111773403124E666103649ABCE227876B4747A1596326692817B
+000000B4BA6A58DBBF302EAFBBE44C674A06119F8D062CDF336716CD3861A80A40E6B97883F52E6982A422E913BDC548EEE5437E23734D0EF8A2FF2BAEB9D7C6F6BBA01F
+0
+000000B73042E8876D043B5AFED14079B67BF937654B6CBB8F531B392C930223C1CC941725C5B0EE29D06307F67FE6D9F2B4050A32F88AC4E7BC0EB62B83C0AE72214256
+00000019E5092E1FE682A0464EB4F01F8C2176C6BC76C1D27A8642A3BFB2D72F32922F309D092334DB4AD88E3044F81595E6F320E2232F6A22D2FEBA360C9C59D19012D5
+0
+000000A38AFBBC1232DBEF82B3254036AE35BD2EE32F059A0271475595D5A7725B0BE85C75C4ED03C8E35679C3145985787C3057E2CFC686605BB7BA3F15F0DEA190AD51
+000001B99C84B9EA7C963D35BDA35EA51809E926D69384000B6E9A5C5492155B76F36349FD283DF49D53E78825A1B0A5043C9C87C6A5C8BABD713BA776CDF76F6AC87499
+0
+0000000CB213E2A11F85A5319A850DF1894B2E638A2FFE06B6FF97171C232FD13022568276267BC586CF5AA0E23CD8DB88503E42C629FB7A8C79B63FAAAAEE6120E94554
+000001B9B74447911709DA38715CF8D819A104DED52C43E4549A3035CA27A7FDE9852E8254EFAF4BF8355F23039ADD67A2789B008C33EC94F3EF9436D2078467D0B69F94
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+00000146AF936583B8A792210D5EF58179B113D7CE800C9EF9AA1F0B6ECD3DF6D88AE2108688F3ABD46163D45305FDB9B804EBC97186870A84A1FD66A3F2F543CCA9846F
+00000099B34A208BFAE1906448B4CB557981C876704FBE11E65AE3BB48093A94C30F1D517F9F4BE8DD9ACD2F7F252B29BFE87EE56397C7E7D7AC4EED1289CE83B3CC9363
+0
+0000006A679C91B723CADFA5865FCE16E831E5551381F6B13B9181F66DC5CF42EB4DC44DD7BA02CE3008572CF0743ECE3A9DEB1697064DE67055AC22F6D667AA1C2E8D57
+000001CBD637280A2081B72922228D1027C2A4EAD9EEA2997C73E660BB8665482F0957D297AB6EB988CAF0F464CA903113AA14A37091E10C7959369989B232861489A26A
+0
+000000A2610CF42DC0FB0A996C39B3355E5905104C15DF5791AA35799ADDAC2324510058248042B7944F736AF03666E930199D7BAFBFC9BA7FCA3A0ED400F8B1134DEB57
+0000018DC87FE7C1DD108AF647ED94202463247823A650ED01BE4AFE7A3D98C26320AA8893E85C5CB418B0A3238A4D7F875A94BE0C409745D2DE3C629B77EFA21D4C5DB2
+0
+000001176979805DB41D30A852679DD289DD19EF17E1916E2CEEC8A2BA2B5DB4F46AB379FE4A6B2148B442D7C98012DAE2CA1D636D33E5AB0B75373599374B1FE60BA861
+000000DCB0B1B56F8ADF16CCB599E0F86DA4A76132CE7B72EBC5A16C3158CE06A6116036EA33B264576D6A8265DE61B63D0F72FD8E7BADC257540932FCE194C55CA9218B
+0
+000001AAFC73C56516192C9B21A10DA70A5B80535DB52BC1EF41602DB320472452FE5179A350167F1F387DEB101A6D0C674F28EE9C93E1D6E3A90A3BCC840D085777C4E9
+0000008D630661556F6AC450CE15F9A7EF5791F63F51DE2B44274E27A6547AA6343A70607F74D448DC5C8B35726B13C417F9B89ADB66FF431EA1BF82DA0ACA6E2452C2AF
+0
+00000033776A637049DE9D857770A44E7527660075A97B64C66D2480F6C3DDFF476CC51676635FB009AD7610DFE6689F2C288E3FD2D35B65DDE69FF3C79425A29A1C2131
+0000006F1468E8BC8D34CF336343963D6C3DE92DFEE389DD1296584FE498CC33A1B7070DEA2923D832113ECB47E02744CAA3B1A6B4B75244E5CEAAC43DA9A2B1F7063EF7
+0
+00000139A294228A40B18662515813971A57F50D1D39D9867E5E2692D2F1ECE8832F333B8252EE95A758A3120AB0A552BAF336A5FE3AB59466A952251AB9FC2C5B691E17
+000001390ADA198EB43376EDF0DF927D417663E7757723D08B8873CF51DC38EA92714A7032A767B0F1E3831F64DB19F0E7BFCE82A0D500AE360620B3341D474FF6A9DD2A
+0
+000001E5ECC15496B8F352D9A86740CCF8F89EAEC658340310990A2C6A4CCB48A1904B4F10311C94D3E1E3A70C704C385F6843E6234AF9A5FDD336C9114312852402A34D
+0000008779D8AF7B54295C21D1F7F75B4A1B461DD32EC3D1244A4EA453DBE705C2CEC3FB4B26C14858BE9FC7C8A132D9FAF1CBF9A175E60FFDF1BF94F94F9A138CE82138
+0
+00000097331C7347BA6260559DC955FAFED798FDF9A42E4BD0A044C222E41391FAB38CD7BBDC94A1E72695EC72C626CE3EDC2CB1B19D90C8D1FBA07D36B83538F02D88F6
+0000014A4A0992EF92133697DCC1D8A1B6C9F0C1270C5A8302CD1C983873C16341FDE06E9A3BD3DED94B19CAA5C834AFDE0D3E84B1C82E87EDCAF98EBE3EBF7B381EB828
+0
+0000015FD6C2D5BD7C419B3B08B144986B0E78B13AC423B10F31ED43B6E88C2CE8C55BE4CCA60424946E81BBAA7079E886C34F144CA6D6D41A2DC5EB6DE96423C38D7A54
+0000006306137D21A1B87DDE60A1C0F615EDCB1D6DB3AA09B442B9E744165DBE0429A1B9F789F5222EAB6742D976BDD26A861504E2A347506FE94129D7A3A17638EEBDF7
+0
+eccp_batch_negate 818
+8
+000000A93E093EA6E0C2F9E78559802DFC408D9F65A0AB9690F494054B9B93E911460A6C91415F215A0B0370D23524FC9901295B86678F7350EADE8D25ED1462BAE4E85B
+00000041E365D30DB9709A5EC4AD4D561474C6D850E9D59EBE14E0755E5A3276D8BEB1D8F31CC8CE9F7091B0AC83F929DC7FB7A20AD6FCA99E7D06FE2006B17E228EEE42
+0
+000000A93E093EA6E0C2F9E78559802DFC408D9F65A0AB9690F494054B9B93E911460A6C91415F215A0B0370D23524FC9901295B86678F7350EADE8D25ED1462BAE4E85B
+000001BE1C9A2CF2468F65A13B52B2A9EB8B3927AF162A6141EB1F8AA1A5CD8927414E270CE33731608F6E4F537C06D62380485DF52903566182F901DFF94E81DD7111BD
+0
+0000007DE0B9A05DF526EC9BC085F9DEAF858B2809A7194610BA0C58E5D670CBD62F87DB85DC7703AC353EAFF39C9A5F139DA563BF81689CF8CEDFEF9A3B22A663F50BC7
+000000BDEA73EF05FB0C62353BDD41FE04681F4E382605BC608D86B3928859579CE17702E2953A701C50135313B0887DA1E5681FEC3FB8D746B2D3B09C8543057643DADD
+0
+0000007DE0B9A05DF526EC9BC085F9DEAF858B2809A7194610BA0C58E5D670CBD62F87DB85DC7703AC353EAFF39C9A5F139DA563BF81689CF8CEDFEF9A3B22A663F50BC7
+00000142158C10FA04F39DCAC422BE01FB97E0B1C7D9FA439F72794C6D77A6A8631E88FD1D6AC58FE3AFECACEC4F77825E1A97E013C04728B94D2C4F637ABCFA89BC2522
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+000001B3A88DAEBFA2BD44FB859379BF1D6BAFE4C9600EA904D14E9E45562D4C746C277B6DBA86F32DF79D2D178CC6F00DB7C1145DADF148417F9BCD53590C31F42C8A0A
+00000024F997D56D76664072CFFD073E8240C648614883A2846F1BC8264E5095C293C57D1D2DA19BEDC4157636D2BC3D69CCEDBB8AD5F3C0A0DE56A3FCB5B15109617322
+0
+000001B3A88DAEBFA2BD44FB859379BF1D6BAFE4C9600EA904D14E9E45562D4C746C277B6DBA86F32DF79D2D178CC6F00DB7C1145DADF148417F9BCD53590C31F42C8A0A
+000001DB06682A928999BF8D3002F8C17DBF39B79EB77C5D7B90E437D9B1AF6A3D6C3A82E2D25E64123BEA89C92D43C296331244752A0C3F5F21A95C034A4EAEF69E8CDD
+0
+000001FAAE2F253497AE3C32A79D4F6A2CA782B00390C70B3D8456B61B1205B24C8E44182658AC9BF37746D173DEDCDE6974FAF970D7994BF3CAB02572C0A5BE6AD39BFA
+00000178F7A2C5ABE79A60A22AB1A2DBC8C44872212E5F31D13C9E8A15A1001F7C6184DD4B227BA60A8767B858FC8910E5049A76FC71A0C629A6CA7938655E75B84DFFB3
+0
+000001FAAE2F253497AE3C32A79D4F6A2CA782B00390C70B3D8456B61B1205B24C8E44182658AC9BF37746D173DEDCDE6974FAF970D7994BF3CAB02572C0A5BE6AD39BFA
+00000087085D3A5418659F5DD54E5D24373BB78DDED1A0CE2EC36175EA5EFFE0839E7B22B4DD8459F5789847A70376EF1AFB6589038E5F39D6593586C79AA18A47B2004C
+0
+000000517D5243D49D12A979803D51C7F3F2A9F02DB89689E1413D25D89A640AC51350793744AAA08756497821F9666343BB8EF40413BC383F4BE0F81A75CBC679BFB1C6
+000001D227D056422E9CFA8B50AA16CA394D86676273C6CDA996BB1C7B3BD748266A35545D5BD845C247671D832A296958831664E98BA2E283D32C4D301169224358C132
+0
+000000517D5243D49D12A979803D51C7F3F2A9F02DB89689E1413D25D89A640AC51350793744AAA08756497821F9666343BB8EF40413BC383F4BE0F81A75CBC679BFB1C6
+0000002DD82FA9BDD1630574AF55E935C6B279989D8C3932566944E384C428B7D995CAABA2A427BA3DB898E27CD5D696A77CE99B16745D1D7C2CD3B2CFEE96DDBCA73ECD
+0
+00000039CB61CCB97B487C0C68DB239131EADD32EFEF2FBDAA74921C5AFC6BFF92986BD704BA38076E89E35EC7A8C0B62ADDB32472086B4056D9A6BFDDDA611D66AD3548
+000000E150E67FF6A657477F65A6F28FDF99B84BB62915EF5564188E943C2848752E2AB9F05E351845D97F0665D647C9E2E0FDCEC6B0BA816E3420176BB27A18DDD422E8
+0
+00000039CB61CCB97B487C0C68DB239131EADD32EFEF2FBDAA74921C5AFC6BFF92986BD704BA38076E89E35EC7A8C0B62ADDB32472086B4056D9A6BFDDDA611D66AD3548
+0000011EAF19800959A8B8809A590D70206647B449D6EA10AA9BE7716BC3D7B78AD1D5460FA1CAE7BA2680F99A29B8361D1F0231394F457E91CBDFE8944D85E7222BDD17
+0
+0000007B44AD3CD3D883C3F3C2DE00638BB361C7174EC3D971FE95A949AA150D70593C551E7AEF89FF8093DB8ECEB3F86050576C95CDE968D2C3537B91D48665417E9A59
+000001AC2E3B9B3FDA86EEC295F05190856294C6D4C4D6B62CE03EEC45AF7A109C30A06A2F97B51A8580345B00CD5A667B029D9FA9A4029A326103AC02B8EA4A803D54F8
+0
+0000007B44AD3CD3D883C3F3C2DE00638BB361C7174EC3D971FE95A949AA150D70593C551E7AEF89FF8093DB8ECEB3F86050576C95CDE968D2C3537B91D48665417E9A59
+00000053D1C464C02579113D6A0FAE6F7A9D6B392B3B2949D31FC113BA5085EF63CF5F95D0684AE57A7FCBA4FF32A59984FD6260565BFD65CD9EFC53FD4715B57FC2AB07
+0
+eccp_fixed_point_multiply 819
+2
+1
+000000CF5770509D3B2AD429A81B371FFCB8D928970EEE4F7357D990C7E18A789FE61128836229CD41465DD8575E1620DD011D08A9870FEAC3638884C6D93BC966F450B7
+000001CC53B5B972D7C74BD554305E886F7734B939FACE890E642C60C8680271F2946366D65A255611F51394B32B2BCD601653FAAF1C5EFD17D8B26DA4F14B5AF26CB63F
+0
+0000019A2B99E2B279407A0F8FB15F7C35B12C9FEDB79CA7AD1563E71CB6C5DA6BAB7F86CDA1834B7A10D64C5E5BF90E5B240F903B91BA1E279BC2C6E57CA3F2B119FAD9
+000000EC008953C9E91BA134BF2AFB9E7A64E6A9C696DF536D9EDABB7A9DD025258C68BC6388D6422DF636858CA81B679C9C9EACB70CBA75ACBE136B33EE8804F25B4B86
+000000C363BE60F5D7B05DC7D33B3070805B6993589456F8F425AA85CAEEE5A3E494F027C6E177FC74AB578C3E2D776EA1A21446402ED50B71D1EF1AF1B4731F9E8CBA58
+0
+eccp_fixed_point_multiply 820
+4
+1
+000000E06C7FD7E941B1BF0B43A4A7BCC720EA5A95B8A28A62C8F7744034B39E8D59360E67BDCC34EFFBF1E145F18A6C051DB9896F8809BB05C17BF5AD697C7FD628691F
+00000046C456F3AA12B44CEE01C2E240321A3472BF12B247CEAD1CCCB1D580329D338C570845A2F983DC44A3DB9042146BC14144B26933EC4BD45937A9B31EEFAF32A938
+0
+0000006EC16459756661CEF71FCA1AE5C1ED138617F53D88837003E5463A9F1CAFCA3D5671ED2FFAD359E5467CE7C2DF5E14D86F1FA896E8620342674074EC2AEC52A4E8
+0000001A27FB80C7CB87E5226E3C25DDD74720B6F1B782C3AD53E91A594A3C3CDF248B7580B234EA26B16BD5508069AA6B5903C0E247E47072BA121B9CF10AE39A124528
+00000123C43DD3B2BA52AD37560F25B4C90C32251FA832AAE0917A4D64FFBA801A8BE1602C2F9FDEFFCB0F89AC1F15EE63D64321B106BEFFB46EE3093B94DB74BB44166F
+0
+eccp_fixed_point_multiply 821
+4
+2
+0000001FA247FF4F79A83BADCFCDC2AE3CFAB65D7880EE3C3796FEFED1EE2AF7304EC73BA9E0BFD189138B162D303FBFC58486A9D17866E63457E84C685E0481CE180DC0
+0000004F82F593D1799383C53E6CB22BA991C977C1DE6C9F3548805B6E0685D0E5F919C9F1BA2EAE52B6748645C9C7666EEAE93E61655C53F33A85D8E5FD95B5D9507349
+0
+000000680F2B8FB1406D41C1D88C1552D5E8328246A6867D4D673FE5BBCD6317FFB9C10C07911B75A1F85232C19485E9B5C1AA4607F8D8730142B35B4DA60507F22726B6
+000000FCCB519CF1036CC66EAD0D507189C3F77B0CD718829002FF11066125039E140A66B94A89E7E21FEA3075ECA2673BCE08C064708C3312FEB17F299365E95DB1645F
+000001C1A26D433D2D40E1D8788BD200E8700363E56D44AC53F9DC307B31573D9D9E2840D9BA8BB7C018A38B7A5FAFD97A70B962D04543CB8C75070072FC687E66550AE6
+0
+eccp_fixed_point_multiply 822
+5
+1
+000000AED02DBC8EC4220CA3D5E6C8879F134788B14E6676FF57D44502D0FEBB7B73E6CE0E4A5678CD306DD3CF71D243E47AF78D25384158618AAAB5EEA1F4B88699067E
+0000014231D9AED4EF689A54CC4996A28200AD8B475E00659E27CA8148CD82DC4EFE3BAE8F3ECF83B83530B4BB886A6049CC679B2037D79530B6FF12DFEB1947E69C1AA3
+0
+00000195A5F73762B2967142E612328E94475D4FD8F8CD544C58FA16EDEE0DFDE3E78B40F01548EF641A124BB2DA1F461399578B52EB2842A86D6EF4D6AEC78935F2C480
+00000054FE9FD9EA9CC1D4215F842518140F3DF353B6EE5135D4186001FE079E3EEDEF33FB6D64956070FFC42EB61DD638158DBD19D525282EAD57381BF881A7F3DD1EC1
+00000112357DB20DBBA2DD385E3F5B6AD80257D88D5F285022CAF0314F491FEF5947C84931064D6FFBF834AAF8451920EB1FE7217F832E72384362FD697366324079085C
+0
+eccp_fixed_point_multiply 823
+3
+4
+000001094D4200BB6FAC942ACEEDAE8F56051B9261B8FB57EA0C7E539FC41CA4BFD94ECC88ED4A3825392E116EF5A4D1E05887C6DDD6D839003FC9BC6BC86E58F7F9F518
+000001B08163231F729B1136DBF50B8014328574755B8C2D9C42779B5A2F342745A2F8601277FC2020F9BC179DA49DF41B4E582DDD3FA4EE0A3FBBDA97EB3D7BC7602B1B
+0
+000001A0F49610D46C2C6DF20540E9B18BA9A4BA1CE798DFDF85CFB8BF3DCBC334568DC1CD5C60600407D359C7051C2FE703AA68168DA86AB96D0C2064BD000D4715DCBD
+00000138F174E4102556C51C9ADE70AC71072A9B7010D326CF90CDE2F56ECCC676C7B0744330769B6A059CD2DA93E8B766F9E596BFCD9BBF7CE50564E48C2F92891A0A93
+00000129BDCFBA31E0DEA664DDA7D6BCD9A993FFD1D097A405341EDC13463C9627C4F66FB602FA37F70BBFB42BC42DC16269ADB7DB790ED1B99B410FA3E068DA7388F1CE
+0
+eccp_fixed_point_multiply 824
+6
+2
+000001E0633437A147D5656E3509093C3ACED2DF5654253511E24B8816AE36A4FBC7F888FAC930AE1873A63EE10B2184EFD9EB09C9F73A4B4947657E715227DCF914AECD
+000000CE7A30BA0916D14021B54FDC0CF10DC0C9B7C48636740C3EE459C0B054841E37C6607C96BD16A866999AC90E94CB708763689B1B2A676179601F3C5675DB186E9E
+0
+000000DD2FAA454D8197C9F4F608AA246CD18C0844FB3396ED0E46A076EE641616CA39A2012340BFDBA20B363B4F1CE8B1A1F03FA0921754E86CE89E88D57C15B07942D6
+000001F24B047F8D90E148F341B3820F441EAEF5F460A112E9CED1F5C5D950385660A963F752A71ABDB19AA4535B76CDAF1DC4D3AE354B2B1DAA89970ADB233CCB229375
+0000018AC8010A73860A55EF6002C3BB494C68C7087D1F220167E3DB4ABF81EB22043F10B5B14A0FAED149F916B5CD3EC1F5D859F827FF840F2184922ADF275468F2169A
+0
+eccp_affine_points_validate_batch 825
+1
+000000D7EE2F28E0F221B0918CFFA79E1CA76AC42CB0D33B85212EE84624CC000254D0D70C97DB876538B28D79DF1299325D93B3DBF9A85C2FBBDF6D807767DAF9CAD833
+000000035C3AF0485EEFE313E655E0573B7338F94E3786AFF9BE1D40ED6F5832671EDC9A49548E942C11AEB28ADF7B79015EDDC15519198B985BDE9409AACB7449E1BEAD
+0
+1
+1
+eccp_affine_points_validate_batch 826
+7
+00000008337732C718BFF51FC38F2922096F7BFBC9FD4A3A036E0EB1F8F5758E164A7C7E004B3E3C26C8181F2F37FCDC3DE00AF0721088A34D7FD5E5F0797F64A3D0609D
+000000617EC9E99ACA3B3A9BC6E9C46BBEE21E8E97C6E7057E109FD406C772396655E92C0669D7E50CD5EC6F70793463F911A39AF82583E0DA4AECBB73C5A7870C8AA528
+0
+1
+000000EFCF634C2F8206CD35D8C58ED0B43B885CCD05A72F91B26BD3EB91D7560A8B17F3980AF0EA1E306E0251601680FBE92035C894BD9F293F8A949583A3B208542E4B
+00000185BF2723DF9363C80887EF46F093BD1DD8CF277E16900ED73119AB0778332865E4B1F90AF98C24EE85FC60BB865135451A9C8A7F8C3E5FB9B2B69F099A0D943453
+0
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0
+0000035E2317BFF93C64E9602D1B90AC9FBC9F77E77F53882CBF64FB7EB23F28F2778114CAFE3F3E72F591BC676DFA6C85430BC64F4EEE1F5A20AA05687BAFB480FD966D
+000000F591C09749C50468ABED871D4827112A281A119A625E1DA0274756A223F4FF0196A7B355604BE39B99918E3AF942BB93EF351C2DECBE02C1A1107A73F809558367
+0
+0
+000000D074959D71CF2927DF34FD76CE10625F01EB9E613CD01EF15ECC6310A5EA3F0C9722C3F55D9AEF7955CAFBCC68A94E76DA8E5A8E754DA223C0A96B583183691D4B
+00000386482CBA1A4FACC8D544EF60D4F782B5E5A1E097896A39C2B2137FC9B72EF16F1F9676C9060E0C87E16BA1588B94AD2C213412A2710013ACBB40FBC26FE75B9392
+0
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0
+0
+000000558414A7C7DD6789478DEE2D1899303942174EACE699D1D260A6ECB1EFD303F6AF0CBA75A2B8BBB92B37AB7065A3219F6AB29AFEC20F860F01FB190EF50CD23098
+000001B06C1D7C2B9120F9AACAB5BA68DF993842794CE5CA443464EDB836A6F947D5D29DF4B130AFABEE7D48F227703D5F51D17BC98137E2BB6781F8D89D951A6D4B7BDA
+0
+1
+2
+eccp_affine_points_validate_batch 827
+20
+000000C199BF721E718FD8C7DA447EA2CC97F42BBC7DAEDC5AEA0C5D3AB3B223F58FEAE7895EBDD71067C63A418A370B24AB27F23DA96A30FEE422E9F079CA484B8F9252
+000000455E1D023454116C2702BC4EB08B848800386E509B4ADBD29B959166091ADE46E4A7F768B8FDA4847A2D0CBAA9E2800857361A4F46C7C8C032ACC7CDC0CFB36981
+0
+1
+000001A2EDFAD1ADBE2A8F2EE3D9736A3AF0247C6193EC82A2EF00ED028BCB729BCE0BDEE72114F17598D24E639F559E7B6F1CAE81320D65402FDFD70DE269FCD82A87BE
+000000E338F3C7CCF9CA6288314569381FC70D9D896CDA868E813C14F0C65A39F2828DC6DB10CAC2C2799F346440059B98DC402EBF4E41C2D2B83207FD04A745815ED785
+0
+1
+000001E82D2567B2DE6F07C00F70C0A0E742B13BFDBD6704CF1B0779D779C22CE47E79481622D70F40181F01519F949F238B50A85CCA66AA1420CCCF620B2B63FE425639
+000000FE43140A39BED20658DAF659B6F7E5BCF87CAF05357BD41B6B08858ADD3A2160B9A2DFC833CDA9F044C2213297B42FB28606FB239C846F396CE1332ABF407A9DBB
+0
+1
+000001039D160D1D9FE688B52746D3BDDE337D6499FB40CDCB4A368CC85813DF3FCE950560D3D12BC35E324548DF1674C825363C3CC2A78636C7685DE9CE15E23E59F337
+000001776269FA10F6E0B2E66E18A13453383CF279DACBE0E6DA6F642B835A69152E60B8BAF1F0289A4349A4D6F493782854B904FB2E6642A842B02D38EC285D2C6CF209
+0
+1
+0000009291CD1A871C75063F86E6C595D91F51E2C0FE5CD7C3A60B7A9E4861B93AE241348F80DA45002E0384E19A58785E313208B03923DED9940D85F6EAE27522C58AFD
+000001EE91D7A90D5A6D41EE86AD33D1B90BC30B99F682FDED93A5A8AFC695BEF83DF4575C823C262270F377178B6EE5400387694A398D3CAAB9B6EF328FFB5C4A420E3C
+0
+1
+000001DEEA328D5BD8729A993E108FC3E9764B411A7E2BEDE0E575570F140EBCEDD92C98652FC8AB59FFABF8654B813FCA6F74E3912017BF3D6C5B3A6F678FC8DD8F449E
+0000013372750606BA15058564F969A58BA3223F963D631D408B6C1E3FDA46BD53B21504F62A967D43FF34C951139B30B855AC9262038AC8273E8C259BA62FBBBA1609A1
+0
+1
+000000C04F9E22903C13197A9CEB9BF502EE64966E6A063BC06AE268552D7462BD98D754C6A5B01178CA9C42ED5C09812D71D0C663A966DC8134DD58A2F1467D555241B0
+00000015CA609B3AE264C0AC4E261D9250D4DF55CAEDAAC79ABAAB2BC5DA18570DBAE7D60468C28922178CD0E0980D6F015DD786EE52957C3879A83D6BD7CEA451391D8F
+0
+1
+0000003847652DBEA9D5D722BD638592BD406151406ED094E406C37AE2006D8AD422F6B4FABBF5561DB5A2936FCA30B5164605BE5DDD2DC58DFF5C648080927C971092A5
+0000000348FFA25CEA0B4C97731D6EC5B24B52D4672AA20B943667675A34A05BFBA85FD358FF24027DCE60B7CD4CFF3FE3AB742CC95E834853D296F4755CB09495D83FA2
+0
+1
+00000049D267AFD509B1319F95054D1800C3CB195DE48A33F82C349A53B91EFEB94F6228535B6CC3F270248B549B0C800C65A088DDFB0A62864F1EDA0EC5CC0434CDE6BE
+00000062AE21E3B510E2661AD9867569B5CBE2FD23A9E2BDBB9674B32C3712655AECCED0048C6AD6058E1F21E29AFCE1A81BB5F081C4AA67B7A2E37ACC213CB6224FE6F5
+0
+1
+00000006F7F0372F98C98B026E98419F2A8BC939F5466F4614AA6252EF08F11DF92F4C65412E1127AC9A4BC042FDBDF87BC87616C18074C39DE3EE1085D19E0332871AAF
+0000013E6A185F145C32D70EC799FEB10E34420B00F88EFF069EF5AE72A9B73EC982AFCAAFE10E7B477BF041CA65C977EB62C1554F62277198140908F2575832A125E3E3
+0
+1
+000000BFEB57F4F4F022785A36FDB96EC17D3642FB9048478EFBB3B9FCC6D8C22AC9D556683D803D9014DD484EA21E6B935FCAA04073868B2E7CBD5B1A807AE4077121A4
+000001DE44407F041B92598767C1391EF24E9107B99E3E7A5ABA8DB85310B0400B7E7D63A1EC3D2573097F6D3FD4335C7D7F2ABB1AAE16B7C65D5E3F4FB540AA61056844
+0
+1
+000001B98387E6683C98973C842645E62FE5535222C9AC602C6DB07D834F40205FAF7DE0AB7473A09B75AA3FAC5BE89F3ACAEB18078CED4739A47BFA73849C09978F5AFE
+0000003FC741D44BBF3EC1BFAA9149713BF23EFF6A151545B0C8DA339DC415E6B4F28A890013DB1CF6101B8DBE59DDAC6F625A085D9948AFF8B59C331D6194AA4167544C
+0
+1
+00000002F134C66BFD916EC5C077FC4311865D7A4EA954DAAB4A15A8077C3EA7B2A567A18A8D14D340EEA458B425A58A961EEEFB4D5B93D5C89CFD74B139CA45155D6D21
+000000DFD79AA401B8C367D50030F33880F235FDD7E2255DF100878FF1C49EB35EAD570B3079B31B4635B93A1638F348D8A59858E03E592E85835AB72ECDCFAC0EAB985D
+0
+1
+0000014B1C75A084B489B5199303F17A47C9F368A4A22A0ED01CD0916C7D452B79E3A6F2C15A71D26457AF13C7C715C5C32EC010E65D4B02C6D506DE4DF396043E677AAD
+000000EBEDDF7F189305E939562EFD40729610DEA76A650EA2B7CC27274642FDB7B0C1F57A645E0C73A5D91D14216D82A6AD98CC33CDD4C46B907BBBF7E8C17CE702E002
+0
+1
+0000013818C6E80526ABE20342B7399E451138CCFB25674E852950A9E03804EC8C3E42E8C2231013E2414235180BA204D8D69E258C24EE56AA5BAC8E42155F83C7702008
+00000037FACA8975F89D19C18BB1E1FF9E1E7CB23C126AA8F950F2A9CADAE0545FE40E7E54ADD38522BCD7CA8F595A7CB3612B890A4E3FA4EC4183FA446A9CC0308405D4
+0
+1
+00000112B11038BFF914AFAD738565E0BF49BC32DE5730603DA3DD1C8D92C97F3435C7A64AD6792FAF8F1B0EE3B67F5B360EC1FD14C0E3AB0064F9C1846ACCF74730FB72
+000001A646A146C7D0F3396A84A9827C0B8C29F821BFE289F64CEAE79F69EB4DF2BDF356DD5FB7C3802E48A348CABF1295977C12DC4736771B70D99AAF836269C6F81544
+0
+0
+0000012CC0BE97F5A9F6F25053B7D03A4CB680143DFDB1D34E8CEC41CC660984AB6F93EF6522F89475C3D8C3846A837FA71A6017C77234B53030EFF67C738C1B135B9097
+0000015299B97D643251251828DBAFD8551FFCA51CBB80A58A232E1865939FB81D354D5A39995F0C8B95AD0E4A7658A82F47C5AC0C32C227F61E558852A937DF9D0367C6
+0
+1
+0000030A79A7B79D765D8D3AD2C2ED29B05E5796B7872038FB2820507EFE39BC5D8E052FAD20F8D9998D6BB55E876FFA50313D442B9454CB63BF1B703AEA83B9FD96AC34
+00000014675D571E682D2790EFE4BFF19A489E6FC8FE9A02F374B77725F70113E1089E852C7027A6C3A9AC31EE1667F22B0544DE1D39ED1C176E223822B855F33BA3FD86
+0
+0
+000001CEA19CB7E0F91422FAB358760F9FE32C758F39EA1ED88FCD7FF714C7AE6DF2A06CF3A7FEA3C4BC458F06E45C714FC10F31B3E81AEC3986352CA2BB3C550EB625A0
+000000780C22DDF76DAB6DE817CDCA4A948B5F6323D815EB20313FE6615C5127DA98B2D713651C7211F67B91E5794C0B9726FCBE285DB8A8A0725D5325C3C59AE91B4863
+0
+1
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0
+17
+eccp_affine_points_validate_batch 828
+40
+00000079D311B456AF7C4ACD0E3495B9633B8251C13079DAB6DAAE0A46734989F73448C51619733D9DD6CCC4DAEF4F95CC17207E5640D476DED3BB81EA8AC294C52D4FA4
+000001AC233B17B6DD2FE3D208A0C27FACBE6412435CA74D240B559BC274A0870999CDCDF3FA3E82A4DBED81C6A26529B35C3D45BB1F0E0D99EA4E7C6D62121EC0A1A213
+0
+1
+00000159FC220FAC3599532EB071738F08E0FCB25FDF452E2AB39065582B844525FB2527830E11430BCEA2E5F9D7342BF9C06C3853221B4C5E58EB0752771266AE1176BE
+000001E460B0C44CD6839211EA9CD5106ADA027582A3F271EBD8A9C9AE7D875043B639B400AB1E219CB07AD79AD5E4C64034FB2D08FE630CBB4E5025FBDD4760EC997F59
+0
+1
+000000624E5BBDD5B462256EB7D3F875DC7B3430429D06B170AD2A28C6F179E0AAD1801C3DFDA64DDE0CA888B4634D7374AC98DE5B0D2A6793EDA1F13BD8099E0BB00762
+000001C6714D65AAE79C1FE41462BD3E0CC857FD3D3BF22B78F370D733B93F685A9022DC8AAD9BED6BE21224B89686F8BEC90FD7B0E400D6ABD80827835D933BFDB5EACF
+0
+1
+00000009C6639F1823AEC9DE1E52403E80668C6ABA22ACBF3D132D4F2A980ABBCD5D0409A55D70EEF2FB8E0A57D5E1B4467CAFDDEA2AC6F20F3ED28B5769EA8E026AADEA
+0000002BEE5617EBE6EFB947C3BB74B69BB9D41D68679162A40A73CE4CFA8D770AB9BEEE09C10E318ED432D9C321443B8F7E7441BE152DAC1977E79077682B95BEE6EF49
+0
+1
+000000F2B06A1B607AF38A04415ECE563EF768B04CDA4FF1A2FA215FA99B4474A7D084D0E46107D635EB31AF26D60A21675F4B692C98670A11452FF2A564D2E40D176B4A
+00000132E302A5F170B85D278326976DCCCAB64FB52021DB4D8F3547CD55356A79861D22385DF84FD60F0106F652AE6F6BB295FB64A92DFFE8CD56A513CFF38017D1D9CB
+0
+1
+0000017D4B9ABCB33870B3358DA88BAE555088C4A447EFDF524E186E636BA6A69938F57CC8399B1E57B082E7D90C6EB38B92668DDE89C56BC22CB6BD4C1A40D8CB21ADB9
+00000136399976821B03010E772082697ED578B8C367AAC0956221DD70B468EB23472218F9B17FFB8A8CDE463DCD437C674103265BE0F0EAA75D006C50D20A37381737AC
+0
+1
+00000017764805118BDA9F6BED390594935C275656D2A7542132F68A3C539C5DF763301A954DE5382A83376D5BDF5363F05D0D34DEFB248BDD2A9E2E61A009E9963D1C22
+0000014E280E1E6B9AEB89F83EF6A93246934F950D55E5A76AF080995319AC6419158E0A08D4193762DD50A3A1ADFBAA1A08154C8DEA4826BF1BF5EB54200B4463020197
+0
+1
+000000A23B46475D485E4A2FB220B2274AAE37B194C8DC1C211B05E2EAD4682379D06AB13F53A7BBC94AEB60CF8B948202C6B7F41ADE19D9F943D3654C3D37EB319B128B
+00000097996D5E9918EF751E393AD4E80B111E01092805216787AEDC307F2D008848405AB453C814B4EF6D039BE1852D95430CAD0116EC8369809787199916FE929ACC9A
+0
+1
+0000002B531A4B40B311078F1DF805B3DC861084C90332D39059F3B0BB7BD02598B2FB189EB63D55C0CA876C50FAF9C1CB579567D75CBCC97EF804F3C2FB9CFD4376186B
+000000CB5A7E9E8CF2257009A2B4549A2CB48D1E69CD1572FFF796D4916E73DCCE23D6DCA99A8F74BEAA332E02A7CE3D6E4AE6EFB57910F45486B46F46CBCFD9CF153EBB
+0
+1
+000001544C69549CC1AB519138A512580B4458DD401C3ABEFD37F7A90E696804A93B0186A8D91B5C853AC82E2CE9CC9D0552604B08C8003EB8351EDE36D37C3DC1237A92
+000001C036CB5FE923E3F7FDEC1465871C8696B00FD4E313F1211BC802B4C3BF1A635E79F21D26ED188AB33E636DE10EA89AC92830B7E770761C29BE42A23D32B70F831F
+0
+1
+0000012091990249D7B817F1984B9FBBFD5603232985851F337096D9493F84CE9164B984BCBDE927D7EF073E84EC92868FF71AC3CF46DD8D2F255CF6C23ABCCD5FE3DEE6
+0000002224857EFAA23AE5E7FE66C028BFA53585297FC6338C9823D40BAAC33266EFBCE553F3BBE1EB718A63416CECBF7FA6E1AAFECD4204554184B16524EFF07C11245F
+0
+1
+00000180F7A3A7021C6F7B4987C769A030077081E15CF833E2FF39A1F053AB9AF3D44AE3FB045A94019425D4A44140FFECC55E74F2958CE8C20CDE22C75F67C726145793
+00000199013073E5B40CC191E05EB5804DDAC4BB81A0073E3DC95109C8973552BAA035FBF03865E2E9E963576C0BC00BAFA224428ACBA1969E78029CB49C0E96448D7664
+0
+1
+000000F6AD05C739CC150846DAAD6FF987A936150AD221BE83DF023B8C85ABDF16DE7038EA6216217C718C5F84E5B0402B5DCDB6EBA3352CA58FCF32AB6578CABC2C5819
+000001E5E6BD3F5F70AC93B283EBEA89BB5678243BF94495584C432C8700BA954A4B06FCF27F442232A5CC43469B36860A30D1823B81019E6F3B74EC48984833AE607823
+0
+1
+0000003DE307156181D9327146E0C9484E6DA22D25947D390B8A445055B6A861D1B622B8F7677FF9F86A8DF26CA00505B9CCB9BD44A2786B6A8E1943B41C58FA85F1B521
+000001018D72EB4CB021B53A929BE158101D4A7742FDBB02125FF297E377FE9A95F9CE8FC1B2317A1BBB31B6C65591726C26248E39972950CC5DED13BB2A90CE6C65A648
+0
+1
+000000312884B4322D875627EE927985635EBECFEB778A249A4B9AC332CF05F0C296BEAE80E8E18CC22BBC04738A01BDFC93784F3FC750462C43ACCE992DD608623E06FD
+0000012F3975F7C66328CD0E473D7DC07EECB1BE6451C676BF14A99EB0B606891E1EB5FB69C6C31A9C57CB4AC5FB50C97A65F8A3973DBDB9D0937649393DF293B9B2693C
+0
+1
+00000098A6D9DC04A8CD404AE54787FF2F4A2CCC1444DE307E5D01ACEF0C84FBA8EFBD1D0C3EC55C1A458548706174E2E6E4F34D1999B7E1CC752D4489CF58CC8E8236C1
+000001C8FD944814509F83AA5BB1FE0F60F691B753B0B50C1E8AB1B14E56F8425EB8EC673A42E96E50014038919632FCBA853F60DD0D419BB70E31F5CD8F6308FBED5480
+0
+1
+000001BB77D48DB95BD396DD7DEB7BFE78341837904CE899900F4F732A5A34C44BA2A0DA9E21BA4A48895E131683DA7C83B815AB8B94FA81D101230DAE86C1D6A8DE9369
+0000019664EEE06BBA6637ADE3E7CE17E6C0C8A5CB6A69AD1C1F224013204529EE545D718DD3541964269CB6A07903D8D1AEB4C98BBB3629277DA6023857DEBB1C059ED1
+0
+1
+00000118F99EE34887FF1051C2D2E64041F55FDAB89151DCAB56535CEA2B02301DD283FF5D3231D1C7A2E826BAAF9971D9281BC20281305BEC0F997BEA94A61553191671
+000000A351516FBE7CE006720E797F8A5EA782D01EC11BDB67A88D58C6B9B09CCB53DB33100950F54A5794275DE6EC82155D207F806F86D09DBC401AD7870B92673D407C
+0
+1
+000001B01CE0D7EB270EF038C8FF19B9E137A6970D9324F2F284E43EA2E1F093DE8CBDFB3924CB7CC7DF8BD0E6E29DCAE2ADA34C911B3672BFD274B4F16F81C9D92E7FA8
+00000015D14F84C60B1D806614709BAB0A96B6B31B2EE4BA8153A7561DAC6159C6483BC50ADCD0153CE3BEFFE4F0C1CFBEEA2674DC7F121E86C847DEC75DBE81D49AD13A
+0
+1
+000001817EFC8ADDCB0E26813185ABFCA969F26529AC6AE920C2BD298D932F32B5DFC02434D8C99A2AF9C8A57DDE299C8FD52C9F1688F600C6BD4CA6BC7C16ACBBE8E2E1
+000001580FB70C1B52AD1F64F56F0ADE9C5DB95ABEA8E73AE79462379E77CBED40FBA554DC9AE3B88DAFE05F5699579679741691155DECDD6741A6772BF82FDCB0C97B10
+0
+1
+000001555E4828A6538077879334CE1C9D2D5A313D1571D41F6984271AD2E5002276F1B59F086A26E8CAA1797348C2FD55B713965CE847DAA67D30D38CBE739BD0245FAD
+00000110B190D34DEEA9DA550DFAA6FB16D3F2DB656F008AED0944C7E0F51471975DC6E012638565AA896ED4A1D7A7818F62508841FEF19924C237D189A385A34E219FED
+0
+1
+000000271C775BDE418456B4809F87D8CF8F3073082ECA1187A2B664CD4C3901337B286FFDEC9F4A6F0052FE1D90D1F8F75DDF00B9CE200B6080B26E05F20D50FCA8351D
+0000000FDD7B022C1AD98CC08EDE8AB00EFE4865E3638905B16DBF165D816C554A2AE57218AE6120685117D7AEA6F4327316E1A93D4C557C922B05F56F50D18DCDB97BC4
+0
+1
+0000001C36E3EB839503DE0F7A3489AA892B13BE51E831C3814D60CE9F75E8F84921EE091C1A7FE28D56EC2C740A4FEE4DBEBAA0B5C60881ADEDA5581DB06F6FBDD243BB
+0000019F27A7CB3E0195950EB24DC6F14690E2653EE82A3019BABB8EAB14E990F35C586CAF3344B0C8A2305F51FC34A2D510963E73F5AD151B8DAAD08B72DB14DF4335C9
+0
+1
+0000005F9591B5C698FD30C2825AE98D52C20E64E90C1B62BEA6339CFFC2A0E867452569AF32A2F7924F335910D284DCF6C3BCC8A66C384CC5E01E8366540623D0258B68
+000001CF64652A931CD657AA76261915E29065FBA1879C6FDA5A8F8E16D2E375FD27275A6F705AF0629B34C75E708C27B8B19E64610ADCE5EA86DFBDC727FAB5F518C3BB
+0
+1
+00000013D56E5916551FD5BF742562BDAB91D3F9120EEF066AC9EA0D2C25AE38E7B72775CB50805EBFD522CB3A54495AAA35D133F1E01707EDB3434F5A4564798B05BAD1
+0000014FF61ACC6BCD52F383852575AFB3ACE471D17715BD7CF71425626E17C3A7141C9C36779BC4CA1C24E446AFE5703F8B054079378DCE0E832CB5C2892C8DA2105613
+0
+1
+000000C0997AC0E8ACBE4FA0DCF6952AEBB05A96546DCFF13CCF651F0B95D1D12C01310973D021AB8B5E8B6D081EABC358C27A1724B600E82FEAF426D7AEFA0DBEC8D0C9
+0000012F17D534D8EF641447356E4F4B7311B167ACC137DD3A78F28B24D7B161D0E55C293D3B1443AC8DF463F47595C211163B83C303DF4B6A5917672D70C7B764A34574
+0
+1
+0000017979B0DD1B2DAE3494A92DEA167F70F04B76DA98E93FECDD9A19FC1145B7B91C84A2896CB85A18CB5956A6F0B46C5913142C7383D3089282CDCD61530A7FAFE74D
+00000186B270364C83E6A7FB716E90B8D39C780378D4A2D7AAE06973347A899DA4205A98AF0DD240ECE2A5832898EE7BB76AF625CFA7E135C56E4D27ECCAC06BCA3B2A20
+0
+1
+000000757D00E725083D5147D916C77B24101A5203D1F529FD5BC1D99FDB3E6154152D0F330C8719D704BB1C42D63E1F5F05A3EDE5FB019A9EE5CC18B25E18AF47F16822
+00000061B04A920407031F779CD4574784E72757A56127ED856F59DDE88377873410170413FBEA85C349151A5D9C0FBDD2B1AFB7FBCBDAA5A27789CBDEE7BA80B52CA314
+0
+1
+00000067CE762A3357F39EE68F404914D749FE6187B7A2FEB69126075C8F6BD5D962900A34C157C8872ADA5F2210670FF961E68C0073032B41B42681DCF49AAF62099167
+000000DF8A7EC5C735DC68DFA3C6BDCD6D4E5B56BF931449A8368A408535F1C6D39F9ACE7886317AD7BB667F9943368669D62C3D74D13833F6FB9FCB53BC8A7CE1E248AC
+0
+1
+0000003DE9A297C2E58F9AA2A2C08179992945056C6A73847F0A3669756DE928BCA35E6883E3849849BFAF816FA77A8B73120DB81AF23BD081755E00B5851E0F4EF4856C
+000000B63F38A1EBC6F8C247D3331F60EC287270FE4BC0E82B7F8795CADEE9DC8A36A3DF27437C588A6F50221D282F6B2A433EF28CE67BA269E9EE4EBC3C2E36ABFC6071
+0
+1
+000001E260435555AB68B672D5AB3C5FBA7AD7AFB5B49EE269EB2B8C93A010E0138E9F7CC85909B7DBA529B0FCDB55FEA754BAD8CDE3F686BA68DBAD795EA6F85EF39A65
+0000013DA451A67C63BE2AE5E27180032E88AD941F3D70DF03EE06D59FDBEE4791A073CD8B740D13E05C91140840EAB67C0661B8792D5097C0E874A7BB0C7672274AD1E8
+0
+1
+00000177EEC634A00B4414CDA4B4F555B495DC06788581ED1EC7A1F2AC543B24AAA9AD9F29215F2D72E4F951B06BCF9741F82AE3788B5B7DACBD5E0C856E906481A7EFF3
+00000197A48A69DA3D406668B6018297D11FC1F7A915DDEA04B54DEA5146CA96F63DAA2A43842C098A82D3B3798DA1D5A54DAE92878EFE96384E42E08FA48B63D4936FDA
+0
+1
+00000101F34B1EE00E1F675078147630E4AB570962086B656D58B93FB057EA20E9905B06C576D394594B57960C88776E47F57187B99BDC95EE19F2B3F7BE1B2C2ED651E1
+000000654DCD597899B9238CC87314B4FD08354468EEFE4E784F01AC136686AA699C7F89315EAA220BE24B239C21DA07F1306A5799250F6AAE68F237EF3A35A6E1053A7E
+0
+1
+000000B5CE054767023F5AC5F64A26EFD3ED3358C465482A48B7D0EDD2CAFC82B69C3EBE437DF8E76599F7E196588B9FE36F4CD75DD9BE83A0DF5AE85CEA530E5FF36155
+00000093779FBC8BDE99A50F1895001E3B8F85E7E4BD86A40D2A6EFBEE47FC29A6730FFB4F9AC3E46B6D68D9F9290B3768C7CD0CC986CB8B5BD7AC9C3D4905501A68B165
+0
+1
+0000002205F0C9BA642CF7CE0AF05D9218D36A3C5125963EA2716F2A043A00A91959DDDC5CC142A6A3692FDE2D85ADBE9712A9988C5BC23D1F19BADB30FD10B340F8C7AA
+000001C7041F43CCFB4C35FDAD7CDCFF823D050731C24EAFB077A36B34B192056189DE7E5A036B0C60DB49F3D688A4F18674223B6709243AC5B1270477E53BB593ECC2BD
+0
+1
+0000003D49BA81E1A484FD492CC248533ECA7B09DCE3810131796264176EE46BE2B77A984D15364366BF74E316846B941D59B2B548E16E51435F10C76CDCD73B827409A0
+000001C08B52B4CF70D78D5C20641A05EB5471DE12FC830FF7CEC7723944EF901A6401E4CA37868F77836D6A219A23959EDE81107E1145FAAC3077331ED1426E1D065171
+0
+1
+00000007CCD3D6B3A0813DCDB93355368FBDC1DE475C3CFB03CA50F324E49AF0453B7B8C5E5D0F005D94B2DF39C524380306EB874558525EA6BD2ACAB83E45BA9D06E920
+0000018B1C4F0B4C2285AAE511080839615D70DE464CCF82D29275668792863316D9BC79F5FFB1AE30EBDAB9553F435F13A1E49980FC86C10714847AF74FBFFF606628CE
+0
+1
+000000D1F18FEFAAF659067007D2FA6490656007C8844F2F25A3D5F9729B7036C0E9E6BDA47537BFA18896356723CFB61EB753BF425D5FF00CE1F2525033F723927522C6
+0000003D683233FC1646AB523B11BE2D8E462EE90188BC7624A525695FAC4FB3B7B427D4C81BA7F27209DB83D59605F8B167C01DD6898E1B4411B2834F296E9AE0E1A3C0
+0
+1
+00000123B4E909F9B3CCE36672E73DEBC69646640869AAB3FFE96B24FB982F1A45CD807F977A9EA9CE21A09B14387897AB4E933B621DF002D90EDD63F4697E7E008CC917
+0000010D428E96A2726DEA98C3EE8DD8BD390D1C175E5A6EB99A78491BC04FE9FD85B6FFEC63BB3D0BAF5F222583537962539D0AFC378260FF0BFD4038548E236BA4415E
+0
+1
+000001C69BA04C435E008D4E134A9F2223373D5AEE50C37DB5D1136AADFD236CD21C8C2C3320E6DC31AC5A0966A310A7E7B9ADDD7B5284AEA41328C966EC499819C0B88A
+000001DB1D0C698D166BAE7356BA824691FAA244F749D986C15B54E4FCAE6B12947B1C8919F620578BD99624FCF6FD59B64FF6522A8A2D934C62BCDA06DEAAB9F42DDA67
+0
+1
+40
 exit
@@ -3455,4 +3455,1577 @@ ecdh_phase_two 457
 0000001E278A3E40CC4DBECBF6708ECEA26032EDB3E23BD7C4202BDD6AA531B65CF3ECDD83367238A1A55CB171234EA367B67933B40E9D9DE5AE90465C083EFB444B37DE
 000001B1C00A9B068B61F58755AD512E49F5787FA0BFFA7CED31DBA2EB9CCA90E809758ACD345BF19F49DA008889DD81C2AA9EE6CF3F06F5B9623A8E91983E45A9AC1615
 0
+ecdh_phase_two_x_only 458
+00000005EEE2E037CDBF2FA19CBCFB97940849125E86059124311329B4F4214D55CB0776892F4BD3A9DBD573ED898B18445F53771B0579F4C1564FD7A8EEDCAB7A9CFC9A
+000000F87344B7EA1CF139C2447B4645C40E945B72B96CA5579859598220107BE11F44EBF795C498ECF4C6F2A4079BBEFB936DE08DD479CFEB081A106123A416CEAECF06
+0
+000000CA0EA4543F97ACF23E4F41AAAAE7FC6583A7149CC8C0D064742F6D649AE7A0CC4434AD0297C501A0B95EF25ED55CFBD6644ED7E4A84F588A241EB11C2B4D6B8603
+0000012E1BB980BF66AB71A32FC625BD160434D78B99D4B8FE237B607D9AF046911A631A6202B4D8016E161D3E9F06584C1F0C6B5D3BC9512BCC9CBB4497F82DE4B89F50
+1
+ecdh_phase_two_x_only 459
+0000003669CFDBCE793E519DD12DCD90D028C3887B07A0732F14BD037211BE8F3EA9543479D67985063BCB47B735151E7310E85858718D15A6093BB66045FAF1CD0B6D37
+0000007505D818291F680828A73F6B385EE8E0FB6CC0ECD454929A38C8E6A98B6690E0BBAE1C6E287EAB6E8DB503D1087306C2876D53C5AD54A443AE772D82E0DC6400C4
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+0000003669CFDBCE793E519DD12DCD90D028C3887B07A0732F14BD037211BE8F3EA9543479D67985063BCB47B735151E7310E85858718D15A6093BB66045FAF1CD0B6D37
+1
+ecdh_phase_two_x_only 460
+000001C4D7AC9096BD75D8D065C5D1D77E5A3CC557C32541A92827008FA3C65AE10AD7BDE308DB7F9D9230DF25C93764A2A618069BD907436B20F37226383AE342BB754E
+000001A764F6B1D17DEC94BC84C2542C64B2E5953A64707E0DEB1D9CEFC723E86D409DF7E5187B6F0DF18121524270D987909AC25120D42A7EF5866A535792432E1F3413
+0
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+000001C4D7AC9096BD75D8D065C5D1D77E5A3CC557C32541A92827008FA3C65AE10AD7BDE308DB7F9D9230DF25C93764A2A618069BD907436B20F37226383AE342BB754E
+1
+ecdh_phase_two_x_only 461
+000001892E90D52CDA7E9727D759F082F6528C117BDABAB56975658DFD22B4D2012602BA715A60A776C5AE237B8A9623DC4BED077AB799D5BB66E406ECEEC3485AC75077
+000001BE107CF23B7C278782F0304DF763527BB0157D2A69769812355ABCE9785F7558CFBD946AC7A79B12C7A3F20C7BF7402557C58A8D326B2BE1862826BCCB0B16B512
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000001516E2D6C2F79516864F48C7551E10F3FDC55A32BB9C21E174A165E5D028D01CDD2EFECC03E961233962C5D5943202B74A85BE878F819923A3D9169D3E9B0DAC1C2
+1
+ecdh_phase_two_x_only 462
+000000CE2B86C18FEA37EF2CEED7B0DE8FF327566E84323D0FBCA87056EED83BAEF9FD0E284D6D9DD3D7C2533F5501D5A36E6328C03C2C96805A9ECBE5F7E7EEBF7CFCDA
+0000004E81A00DDD462677F60033910293A83F4B9F11EC0DC1A1F341AC1C1F36A9A6728AACE4A08FC576AA373A988DD379A1EAC6C85048CE35F87F221E5C34A251302E13
+0
+0000017E2C57046D5480E571BA78F17618AAEA50CEDBBC9ABF8981167AC8E0031BCCC8391460CF8E299EE4F4BE85C0C71E3A204F95B9E482E0854BC3C8C989E2345FF84D
+000000AF90E1D0A8A1243186652447E852B235312AA81D6BA0C0E8923571F005128D233531BDA4CBF181196AACE798C4F3F58AB882AAFE49720ED58088F2F37F2C0E265F
+1
+ecdh_phase_two_x_only 463
+0000002D8184C6F73F2DA61A73097016A76CE7104FCBA82C724EFB3FAB4206F0868610EB221D508968A9417DC56CB4204A053AECF79B840669EBCD000871CE20C78A9910
+000001822F21C44B32C0C793C853AD5585C2383B1367C0E29013BD99702C5FDA1AE287D6D9D387A0870008E4659435219CECE4E5625DD1E021492831EEABA9EBCED09105
+0
+00000052771EED9282AC5EFBC5E7F2A14B3C33E4106E553E9F8E344F2B349BC697543B75EF332175AEC17D2AE8B6BD36640EEB81E5CFB530B0F2D7B7871C6A63BB813591
+000000145BE9850B612946E9270914DDB6401AAF4190BDF5F391DF235ABDAB97CA505D1EB07472E9B3D8A162AE25650882A1997C8B7BCC188D12238104211AC20F50E6CA
+1
+ecdh_phase_two_x_only 464
+0000002DD4C51D22F397906F11072595A1D133344230ACA1B02AB3810C1F5C45441C6CCFE72BA0524608955C3F4B6893EA98F6BD3F13A82E2D27754548C821CFFE14A4BB
+000000D5B1CEA1D79A8B4E8B63647EFC7CF17B56EFA720CC0F6AF1A7057AEDD185C94C8079E7A92C9FC15596F557DBDC169F4D1F56B4C3D880EF411250E911F76844E629
+0
+00000064622F056AE9180FE0B3ED2C9284309E4BF62449CB483E95435F0D33656D024141E6EEDD5B31FD3E48AF5D4587A979E4EE948E25A92194B5C376607719BC0B228E
+00000010AF8074272605210F92DA147524AB082E65BCA0626A3976A92DEC54F8BE0B76FED43C93A71740BC5FE7CD62746C8FA78B8A5640F1C2B87BC46A115CD3284C99F3
+1
+ecdh_phase_two_x_only 465
+0000014F21DCE32E81C57ADEB7283B149E929F2AB4686718B9978A7477350455AEE971BF73C0971F7D1DAA3B8DA8CFD5CDD49DD0456F47235DACF4640CD73C5D4D80D694
+00000086211A3ACF7AEE5D5128E1AC34F6BDC60C2D08432744D3BFBFA99CAF50CEAE928F36F5B3E62CA9C08F90570A33264ABA99B0F07DF383E68D731F3E00D5F324C0C3
+0
+000000BEDBD07B290C5FC683F38B4BC5322A8E50584FD223C85F101B4731E9F47D7DC50AEA9CCAA599F1806F604F94A5690EF2D5D670A875272E87854356CDB81952A189
+000001C5D161046251DC62B7F4B3B776F0E8F6207389A1F63F0F2B44EAC17AC0DCA02E1D1B9BAD617B65E42E07BD76E197656D33889781CC98249EBD2EAE0FCAE9E76C96
+1
+ecdh_phase_two_x_only 466
+000000316CD57ED9D1FAE8F1E50FD5A5582E1465BB3C907EAEEE6DD7722F89D5A7C7BA71D32A21C20B507C60E234222883A02FC3E8C38C96B0422093397884CB29C781E3
+000000808AE6EF0989A10E850D113BF8EFC0E8126E171CDB11220DD19780F8121A5518AEACF0F298269E959826AB1601FFB018E2776B2DA9FE74EE99F182DE86F320702E
+0
+000001CAEA85765349645FD6FDEC399F0E225B12DDDA1915AA0352CE982068EB5FFEB9C1CB37E4D603355D442B49070DC3F89CFDFD42E188656EE644A9F760BBC71CCBF4
+000000F61F0B8F914A78E5F22BEE206ED33BAA5EB26BFE9D42C750F1744B387C9CFA362A08B8868A4DF3245055DC96C2858389F805C271F879DAE82D0B0405EA12DCFD36
+1
+ecdh_phase_two_x_only 467
+0000014C425C006C7160AC1AC9C264C123A4CB18089546E19DDBD10F5D8A0E67EEEE3945F68FD529C661723791138C31D26865B008690137A60C4C904188128FB5DC3829
+00000192ECAB08E4FAFA44EF2981CC386F483132820F36E5871FE1B0ABDF94FF5308CEF25A4258685B0B47141030C2790D8D72C14F7E3AC16EE0A5E94D65F014D2122E4A
+0
+0000007A6E824DFCA5CC7513F0295A774538EE11C921C9AADF2587035A44B831D9E32F49F4A1342C24F5F49AF0F6BC2A6992129C0B179A4221408FA1BC38D4227CB5DF7D
+0000005AEA47A64A494F33C2544DDF47FF3AA96743A73356F1FAE2742C627F1A3F691D1B540D4CC81932925C0FD9F780BF922E6CDB1FB509A657EBF19CA4CED56B5C2B5A
+1
+ecdh_phase_two_x_only 468
+0000018CE77639642E812C741F0D6FD24679DB65F40C56FAE90BD57917A104BE771D259E18EB649643428565C0548B2C38DDEF283C64EDA7985A187D0CAFB5573E7DFD6F
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+0
+000001D969F7E6891493F0F263EF9FBDC28490E65D377E43423CF82E4714D8E641C5D49E488B76AFB80FC14D67AE4FBC39B4A635D550B26D8890B24897EDEA5AAB4243B7
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0
+ecdh_phase_two_x_only 469
+000001B81FF15C331063B2CF418B6BEFB869ABB1CC589C65F352CD551954220317D34AEDA24010B9CBBF833A084F202EC82551E38124FF0B302418A3F03E5803FD75C13A
+0000010AA040D7C4B81EEE89934BACFA070200C4EC4062B14001C4F02BBD57B8B39BB9E54C7FC3A97F50BA4BCC6126D5B3C10471189B68C4B66907EEBDE6F087A392E8EE
+0
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386409
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0
+ecdsa_is_valid 470
+000000000000000000000000000000000000000000000000000000000000000000000004E078FA23C64B801BCC722371525892187E4F44C71A6FA997B0916916E89106D4
+0000004AF03219303E4165BCD801E64EC3CEE50571E141E3F6799EE18B305A2CAD204629BB1C8186C81C48533F056F5A859DFC8AB60F3438F5E6AE7DECD3C22E1924AC6E
+000001EC25CDF61B3022A54CC258975E73F3E6C765C596ADF2BD8650809BB6B4C66E019E8B38FC46BD9F0BB93ABA0850BA0B18B14212F0A8354C1E186636AE01358E0499
+000001429C713B7C1968FA61EAD45E105EE1E05659E6490879C2560137BD29BC0C8B80782AAEA82740815EF2018722FBD05C5912CDF719A0D1ED8805DD273C77B3E8AB6A
+000001BBA6E85A979CA1D9BA023C4922178596DABE4F27B72D85775ED50993A718C84BEF958FAF93F02674BB19FC6965A1912CDD72E878CBC1C09D640970F9AC3537B666
+0
+1
+ecdsa_is_valid 471
+000000000000000000000000000000000000000000000000000000000000000000000004E078FA23C64B801BCC722371525892187E4F44C71A6FA997B0916916E89106D5
+000000D6BC7D94FA5BB6EF90E2D2AF78983FCAA9F45FE9CD005C6B44B2DC4BFF971B8E3B3594BEE2DE477AFC88DA2BC79C59E88CFE38321D714006EE1929CC8870F581C9
+000001F652CF0FB874F31D5D0D25F3952B748A248BA23BF00BEB75C85D93D29CEAAA8DB75EB47FEB336D01DECBA7F4E2BCB6B873387E460C43B70E5692575827D7B649F5
+0000002BEC18B2680A4C6FD398F9D95B70CC5A58E1933698F30F3D17C175244219826A69FC869CCD520708A090C07F6AB5D79FB0E3FE976E2B308218CBAC57220D52CDE0
+00000162672059B7022DDB6C8A948649E435F18881D31B313718617CA064E7DB613D748EF4EC8E91251280EF55E1D697E02442C0367D9822BE1CBEC9E3D496175809F288
+0
+0
+ecdsa_sign_with_pool 472
+00000029A0A84B93241847B784A7B03347EE0B4365D62343EC57F609707AAA12B9E9141E60E9216A2C5052132D157BCBB8CDEFBB06CCC5133C04EFE0BD013D760110915A
+000001666A2E579BA9ED2D32D419AD3BF9D7AAEDBB11765F3C37B5087EEFE5519316412E1BD7069F63E6C2FC2BAFF347A6DDB42DA795B52B90562B6867E5629A6D7025EC
+000000F5215256E1FA2B80FD20BA4C5B3F753D2D28F32CC5676D5883364C675231CC698ED18A8543146D81540E1D4606F914257C380C35EC1E7BF5028E63896F9AAB5C76
+0000005866201A36845A6B8D6BE9EAA9789E6469F8C7550DE617F2DE1C389D1F6E2AB5E9051FB9A52DE802B6B2C0B03F10D4FB72360DD4A93B7F7EE0864F5BBA7BE60F2E
+0
+1
+ecdsa_sign_with_pool 473
+000001D3309EFC88F7C57FB3B2188148B12D523C8306AA76B88C3297DF68C5232257F33E52924C1A51145B5AAB16DFC2011D1B9DF1D02DD6D755C748DC8C6ABA8370FAF9
+00000059993903E893DA33D36C8FF1E403750661EAF7B01EF5F55992F61ACD4DCFB26D3FB43E3F8AD946399A5F541005680A092D82AF8F60B1619BE1E77ADD00BF209016
+000000F5C0C049BFD369D382F6E7D63A0F7FFE56C01FFE4B234DAA963BA33482CABC1FED2C0E6BB9E1A5542B662DECF69E04FBD234F5AF30B7E9E53634135E293F457014
+000001B55719DA15BF56EFF3A20DB62A9B7B275DEB87C435C906838D4CC99AFCA2309731A0D1396B021E6D32241B910C9FF8E9352EECB3339EE806AC87D1A40039F24D83
+0
+1
+ecdsa_sign_with_pool 474
+0000018E6CE2892B7C4C8C1064F83FC24EB3E51F0226FCDBBEBD13C0819D0D424417A88EF2ECC71D6458FAFA5735A6ACDA461563F196FF6B4B86A3AC50469ECDEA5DA136
+0000017F295FDAB938477D0B04D2718AE91F29ED25A8E0784C34C946BC54A9ED155634793B55D2C26103904315AB0FE0DBDEEE5C7F18E7F7D5DF0DAAC135333A1B6E3036
+000000056576CECC8CB46D8EE85E27C04BAE30876AFC3D34F88FDD39A2838E614E0B4579A9AE25F61C5248C6FE846CB56386A49C8310D7BB8683503078350E7AFEE3B05D
+0000019084F8587C2B904BC7690918F3F1DDE65E7A288D23549D12E873F59B3F99E4E1465D3310206CA247315F96B3CF529B70BBE4622665D1AC617630E0507DB49D16A1
+0
+1
+ecdsa_sign_with_pool 475
+00000134E54383BB8869C5692764A950100F5F768D70E442D22EB49B254FE05DB6B8B60756D4EDF09E270210FA51E52EC811AD31E2F4057DB1063491366FCD3CDC4620AB
+000001707679656275360C7D2B37F7E62DF482DB0728CC8D5379955C994CED6FBB70F8B00F04E7D7B9F5A49E8E3415A08F372E0B72C6386515ED9DE5622AEBD426CEBB1E
+0000000F155023A29A16D3DFB14A3B5972CBBDBA217C2214DAABFF53CF6A8CBB841EC8FCEB1ADFD879FF426B497563EA4D4907790A4E1C338915274EAEECD2EF09C3C349
+0000000A2521753BC816BA61391984F749338E7C150615527352F79EEE95BE46B7086589BE0A933BCC27F483C40895454164660615B0863D8D2DF490252E73445F41B87A
+0
+0
+ecdsa_sign_batch 476
+1
+000001A75F423A495329C080DD93EBFB2E25A5FDD2DF4139EC1A81EFB147CB4341C924451A4DD721D49E0CDD1583D5A60DCC91FA8AF931546BACED60000F54C6CAD86518
+0000003145DF40A3D6499B95F6B9A0A205798DAEB4F5E97964AD97868B78D9FBCFD8E8BCD4918B1B2766E12F45214AF8AADA03083BAE9A91E54410B031CA0C761DFDE699
+000000E470E0C58E7CD9F56743CA9612241B7C48FFD8B57C55007FC84652872D1643FEC1D0A506C39C77A27D7A8B57A93842218FBA5F53B8A97CC9E21B29F74961339998
+0
+0000006C25685D010092C0AEF14D497D05873B7FE8D27E1709983F661C74DD18A46B8F554E3F78334131C10F61877B09146630A88B48A9B8BA0B0596DDAF9FCA26F3E855
+1
+ecdsa_sign_batch 477
+5
+000001776FB0EA5F25C5A7AC79D8E33D3014BEA0F5FE79F6F04DA8AD414C553F4F7AA81BFADE58C85C4CC8605181524A593CF078486C2F247B6D21360422431BF55BB507
+000001CC2FD96B2F8657E5823946D5972BE41210632D2F7D1394FE278763EBB07A231022BC357449C4B48C77EF9507352081D639A27C9CE3A123A83EC559789379C4B1A7
+00000194A5FC36E35A692A5DF3A6199E206BE61671EAED8B94FA22158C804ECD885DCAC4B87F47F758D6E2E515F03E76506D636225F4B92298521FD45C9FA5A57109D4E3
+0
+00000018230C72829BBC39390132687A2BD8EC332E29706B7A847B802355851CD0C95607393E9A3EBD86BCF778B16514F112360C6AAF3B030B90ADDF22D81AD1A2B1CEA0
+00000177E973E49CB329F93A2B6DC70971D7CC2F9E1FE9CF636A85B6AB9F8B77BB633CE205E315EFFCC1724F2F6E703047F3351CFAAC5F5D4A25D61D69D19959BC9FF83E
+000001A8913DAE94F27F376F248071EF4D1E89FF3DFE0BDB37AC3598ED90A3BFBEFD2D28EE0A3CE431691B9E742EC403ADBAEC4DBCA42B4D1A05253B6FA6DDC3F531517E
+000000E60FBB896D2BC5374233E23B6BEE15A2D1874CB2D5313B6C2A22DA243566DB78189199524DD13919081FCA39C6444110DA76A1DDC47D34C120B5E93FA99B2EE2A2
+000001F01186AE8409CEC9A82751F897239D22D6EF355B3A23C5ABD74EBF4DB8391CE7DA1E8741030A91B382B3433B177A441A88802F9CDE1577F8C742C99C8C1D76023F
+1
+ecdsa_sign_batch 478
+16
+00000063B39774DF43D84FF122DD2307D5BD6BDE20F3BA6AFEFB601B8601925417B63C6E200AD2AB0C51F8A0D69AADF9A79212A63234808BC970F7502497FCAE32112CB6
+0000001B39B4DD17A2DFB1AE053D195C458A0D99867B8D9E5C70B5A5277A3DCFC7F8A9CBD5C9C35175630F5E347E4A00E051698514E68439D1B4BB03D11A37AD90F80485
+0000019B0F92CF840830FF45E22AADA2F1E4DF4F382335258364057C215AD71759E36626086B81E166AA108F4503BB6208E640E377A3224CE768ED13012EF94085970091
+0
+00000070A9732FE458AAA0912441E11690D12D8B6ECD12EF4799DD95CBD9A67B8E25C38BC9F8F6A511F0BFC7E185EA3BD9DABF4E54CFF15EB3FDEE8610DD8692716C5C59
+000000180E760A12388EDA6102ADD8962BDA19E24B2E78962BF5FE7281AB07C4447E0BBEBB928178C8A005951614B40E1CA37964FC0664AB02384D9D605A4FC42A4978B9
+00000127D447D86AFF60AE1EEE0F846E2695BB6277C22947D1DD7D2E0927201F6240E8AACC4E6D77D79848F319FA563C520BF6BC11637933A311A70E1FA0B186973F01C4
+000001319D29A1570AE7C784145B32EB3E3EF913E07A0A1E200C4E083CA3C23CE48CC27B2DA5316154B942538FCD93DCB43FA2E70D97DB7D2B6B73CF2FD555AB202AC8CC
+000001916D4A85D3EDDD4A047719F80E7D89465A4C11EB983E730DAF7E186932B8DA87A552C4A45484993E40AD2B4FE89919EFE0AD36BF2D62B8102A7F836858180F5471
+000000D77F45BE8B5E2E3423A19E34B21AB2294B2DFD75CAC8073448A1C4DFCB22027B924AB4544D977D3020B5EA5AA87B1650AEB327DF81497C7CA5E28894647BFAF426
+000000EAFF998ED202E2BCE1DA2D901B0970D1186F164DCB7DF51F540840A070FCD54F1728F8F358FB0F2B78B70D7F6CD69F0D43E66E9ACEB602396EBF36AC1CC40F68CB
+000000FBB38C9F1DBD92945D743C3C0C27A0E48D1BAEBF1533FAD7A8D0411ED95AFB25968FA61AEDAD8860CE2C4787053C5679D6BE0C9CCB480561377865E010DCF18470
+00000158000BA1C79C9042F34DDEFDE60AC371F5BE5AA6BD21DE63051FF937D04B0A31ACA97637650D0619C5E8BF612D74C6DF1BCE83A662D11C32C66134E19716C15A42
+0000007F63CEF1B51B2DBC6F4BD6F2EFE56E44358F074B3E32D97203EE65479D5282EA4E5CAE0155B11B73412E5104468AD6349E5F5CE127363495497085A5F8298E90C9
+00000064E3DC2FE6B2C3C24DAEE3676989F035D8B2ABCC45CA1B82F4265478FBE2ACAE2A45F59328DC667062965DBFD5A19EE27DF94E5029B8B2DBC444550D8A808EE70B
+000001E9B11DA9DC600719633F71AE9E622868814CAC0156B7C82BD4AA97AEAEF3FF3C883022C5791A01C11B9E3B1C96EDF036F92B8D38BC6FBA91A2C814F15DFAA2FD91
+000000B221B046E4730398C0D17E0039684ED6A3246FDEA8C9330DFBF04796E1C82E3C9689B2B1666BDE48121254FC9713FE8D5039505427BD9283ACCC62C50CF119C0A1
+000000743CEF6012EC97B1BA1F2647F9440DC247A6F810045A43BE5B9F93F7DC0E274AFDE86069B5591D120B61988A679E3F96348CA7A15AB6FDB94EC317BB274295F45F
+000001200F1376A97BA1E25F5BAB58BE41FE77D1CDA8D9F07C580561098586359857438463C640298B3319BD6D71339D6EAE91DF83289A664A11A0179C641D8F0AA19FFA
+000000265D20A607108AC7613BADBA5B2389F9053FEB2B8D319CB03D9E4E98118E0CD4F1CBE09E53CED07C914A44542A2615F4F6469B1D522EDCDD494C691505B9330DFD
+1
+ecdsa_sign_batch 479
+37
+0000014D70AFC9931996C4BEC00CC74966787F7FD1FD82C1B299A4BCFC87C7C2B4224CAE54A59288E477DDA50BA322B022675F3D337DC8B75CE629B4B98A4D5CCEF72870
+0000012239EB248849EAC7B5D0297E55A3E4E8ED36C0AFD163AD87FF8FB9122E6584D44056350DF536571350FF8845C202ABD1C47A2C11D959D8932A9D20097B979CFB3D
+0000013234C7CF80A70C52B473E9E99545A56921AAFC53D824F89CE5422C13B431A41C208EF021036FF13F383A6DE5F8EFA6C79AC21F0C9D84F1D55F709978609F81B1D4
+0
+000000B3EAD9269CD0100997AF480907F81219CEADDC4BD6EDEA483BCAAE836331E2D044F2F9DC4C4DD85C261DC7F1E007A54287F99F78D9AB50407881637D9E3C6EC4EE
+000001AE5B9DA93326E1C29115B196FF83EEFF4ABFEE21D9CBD31DAEA85FDA8C3B3E19B459C0CDC582DC0DBC15FBCDBB2A2CB9BEDE55567EB6E4A00187481291943652C7
+00000191AC7047FB0C566D13B7816ECD17011DC8B5559929466BFB9E27353FBBBFF7654701D353268A6620127B7AD768679364A1EFB2782309BAD795D3CF42801FA1F8B0
+0000010F051507D7917C9F684B530B0885DEA0D01FB92D9B1AF42AD9F9F069D2F9539AA643855642B0F595CF17C5B804FE95C383400B4EDD981D1882F69DDE771D13625A
+0000016AB5B081D5BCADA89B60427E888B6BEB4B1CA74F0C7B0F4EF4A8ADBF5E297B09234FC04B3BDFC390D8883E0D6A896B99B5D1F9955ACCCF88C1680C05C7C57A8B45
+0000015080B4E62310A0190E1DF641C881C861F5658BE5486A20F06B8DF18932A74015546B05B79A03C558B7A6886D916E05782BBBDCB700E83A013A5E3FCEBE05A175C1
+0000002079BB551795A45071EDC98360423124BCC41CB923748A78D3EBFA0E0A8E57B69CDF32ACACCEDDBE373FC028A2D162273832BBD17A18A3B391D330A461A1CC1582
+00000075D15E8166E0319FB0955976D350702FAC821CB745796330929C2DEB98399F52A2A032920509EF4F256160F3A85C26DAFADEF42F7D3D299E5FDC3789637143C69F
+00000194BDA1B05F0468E4BDBCD3A0606F528CFD473124A2F954C6E4A406CFCCC6A58F0DBAC94414E6EE2707D2C1A51A44EE1B426F6DD97632FB1C152453140F9E38A81A
+000000C4CAA1B4C528CFF195396B72A94920DB89838BECC3405B82177949FD27B524C1869FDE786F2D60040A329AEE3C5FF7545812E66681D090D8585B37E742D3659CFA
+00000185B5FC3566765389703A406D4D468D91F080BABE3660575C8A0B163DD61C49E76821EBEBFFAFBC3D9848428E331E13C11117CD51968507DF5DCE90EDA6893FF1C0
+0000016705463D0277CAF7B5C5F59815C21A76FAD0320F4AEB4A4955C3946E9D1A302AD71CE03FE1909118E685D21F8C1103E150B669B36D6712E04BBD94CC9252199E61
+0000001A71E36F0957D4D2458E3862998A3516B5E8A8CA5AACAEBE0AEA8DE02627F0A2FD55EA501A7F6449CD65A59C080A793818260C53CBFE6969CDEB3913F79B844FBE
+000000A2843250A9869AD007DB4FED7C42E56F1AD5A631FE379FB88264136BA3BEB5872FE77ABF34FD65A4BE304011CB08D43052EBB656C9463AEA6619D26E6AED2A4BC4
+00000157491648AEDF92B8AD4140D9E64105959CC38FA2A3F9740A105FD97B7D4545E6822499D6B7E95CFAF657676C8016049632A8B881194921ACC753A69012785587B6
+0000006EFB9FD689AEA47A214A3269CA6B4573CF6623BFEE4345B7F93E1E466186B5B7E704A0307B1521D3F4B91F40DA5083BC42F02D96A3A55BEA11FB65BBAA535E14C3
+00000099B6A88A61D93A6B8A643409D85AFAE7AC7C6D2DD385461AFEEF4461EA750B0F76D8312D32EE0A3FC013F90D4B37F041E2DC4FD4F1170D172C0CC5410A81D86EE8
+000001ED879B92DF417C0D41C62A264528C0668703DAA0EB59395DFA7B71AF30F34B553967868C6560C8EECA4B965A9C0D19ACE64BFBBF4881DFE0FCACCDEC08AAF912A1
+0000019F076D33FD80AE8E6594137E903F5EED9489030F6296898CCF1F0B074E51031E59EBF76BADDE79FA6FC7AB2ECC25ACE888C9353F366F4C998CB957B95C7586C457
+000000B031B130046491475B4CE05524BD25BF92FEB9ED341F17D1F5C639998E62933617D2F78881B1B367CC522FB1F6CC7213809D2A43CFD250FB69ADC0DAAA223BB137
+00000190FA788962A676300D9068DC5A032612FEBB0C54E60AB3793FAFF9DDE20CB0C5A443645B34994435815E51C63E051190C48FDE48A033A3447B010E9797E2AAA193
+0000010716F61FEF5041B988971BF805685F461CA919DC600979DB778DBDA4C5334466DB7022C04DC7C727A6CA9B1E63E462A2E7E38AB04075CC4BE6372604B79D69E606
+000000335ACC4A3298C6F7BB9F7374C7F3DD890A92D14284B7BB0338E3BC05E38571F443A52C8B3BD366545941C3A7B442DE8A25473E70C3FC18118683EE81E0D3FA5A5A
+00000189A6D19BF44772A396078CC724C54E25B1D9911FFE576FFB5AE6FB5EDCE0D949F49B8FEB16223A50067420FC56F6706D7D3FB68288828CA0B5AA6FAB172E4DC405
+0000010E21DD49FA751398BB51A7F204768646801636AF50C310F98BC14EE1A430B831D81B87B2BBE65C86A568C0D5A3FA198B463BE5590ECBEB412E90793036132299AA
+000001EA17797A29E172B7B7A98589BF1F734460EE006205B39C486315550E791351FE1EDBCED1A95BA9E4CFF90ED9B7D34A6EACDD6CCA41A820FE6912FF8CFAC97E0B6F
+000001EE9757A99A4593B042382D7CFAF4EAACD0578E55D7B89E27B7FC5FC6A969625E95D34F7ECCB93CB32A2853031C5D01CC65BF4374194795352A3D3A1E4565C32F1D
+0000018659D5C6222643916BDF37EB5CFC80F7EC99FE59163811B2067BB444ECF956B106BC770EEE98A6B078ED3B4DA572305502AE905F217325C3BB112AF32223494093
+0000010BABAD40D8F81FEF3545A95D5BE2FAB3E73E0204C81B58B9E886A90AA0CD669735C11CC63CB4B6E5DB3ADEBDC4BF271C1B75B8D6F98504A0C06630DECDD7BF8BED
+000000A490EACAC54E722A151F77CB5EC94FBD9E670E3BE28457B3C14B5BD4174480F79DDD45D4AE50BC3D864BBA7DD17FCC4587138DEA6927B8345FCDDF4CD68F6D4BFE
+0000010C68A2EC465A4706DC246F1DF03AFECDEBFDF4AF912E027CE60901C03E8C2109BD64026C138A307841D412E2CD974946A014D6EC8F44624ACDE73D3CB73E9A6213
+000000A3B73F2054F872F0B5E1AC0F5F8E62452A02E32D6495FA33B125F7820BB08F764DA810E865234D1C69A20C96E9B2A1404B2A5020066000B234897F56106D8E1C73
+0000012AB1E2106557A313EB3E12B0C9AEEADD6B89BE9CA605A4AAB449D871B72F790623A8290D2ABE0D092B52EEF5E7228C3DD78284B2DEDF34BB1E9867CD5FDDCAFF2B
+00000072EC96404A133FB611FA28A8EEA19ED635C8F8ACF4AD36310742B47167ACB076795F01AC0C799D3FFC1DA93A225C5AEFDB78E4A45A09F3689382B305A89C3E66B3
+0000010DA8D92FE54BB6C39DBF01A57AF0A68CB12EA6FAF42C867A882B1594D839D47E32B9FB406345778A56E2B35FAEE39C6AA9A991E4DE1D60DCD991FCFB6DDD03AC9D
+000001EB872EDE156A60E0FA40F4AC4BF4762182F0D9A7D27F4AAE9834409032B02AC6A279BB9C64A06FE78C8ECE991133C189460D2344D8A561D3A207ED036597E54844
+000001FD9B78B98BE464134D2A930E4E67FF4B5D1480DCC4E87B3A34D9FAE88E009BF59D7E19B52FB7DE1C18796F8B523979471BDCC8D7405114CB446A8724CCBC669775
+1
+ecdsa_sign_batch 480
+3
+0000012407F23198537514579B746D1215A0D33BBAAC7F149CC30B691CC3D652A012D4903D6FCA10E44C125D31FCEA2130ACF78BE82275EF9DC282A92A7ED284566B4FA9
+0000006EF8C3C956E25D7773E3BBF27481D42D5850463B00A91C017F85388CC4A5394E5D0777172EA1BB3B2198C4A096DB8F6F8B03678C83A1C9C207183FA597427F7C51
+0000019A5A6C1E5A3ABA7D3AC2C3C2DC8E1901BC95186BA641A4217B72A84374054A068691429DFA3FEB382EAD1595A34C75785871FC5992419F5FA6A90D714AD21C48EB
+0
+00000186111FC0898971A8B1B6CFFCD4F782483C3877970CB2FAECB802BD575FE7EDB5076C6B1E567C1F05AF48662166B6FAAF1E0577AD665E7B53C7AD7150E7D69D3C76
+0000002AE5F1E2187D07346A3DF50E2999E1EBBC990FD8442ABB5938FA084AF889653015AB64264D52D67B9547413611FFF7B40871AD153B1907F90B4DD178A855449818
+0000013119CAD844D314F74D805975D59493CD97EFE7E19686274E5E85F127793973343C22A3D367FAF0AAA7FBD8E0E3082E81764C0AF07304509D1C96501FEF933511C9
+0
+ecdsa_recover_public_key 481
+000000885642372F97C7B1608B6F5F14886BE9B4BB9B8C97741C91C71300055ECE3F8FAB123C98033A8DD35F4D63A0E205632FCF5EAC0C6FEFC21A0A96BEACABD2AF9FF5
+0000001E4E50FF53478D9ED227718B93EC74CF466A33427D10B9FC770976B0AE59061D051082D6798DB08A37F113D169DC845EBF4FD0DA5933ADFD2714FFBA5C0CA7840E
+000000BF19A8CF13908CDB782229FC91E3F44B16024101AD567DAAF585CB206DAB9294EF91A7464183B2C52466B67107ED74DB9DF807B207336541AD37F28D7C17B2A2F2
+0
+000000492725AEC4950F8A81C6690D623D3507BCFA01569A6A962FAD9DD0D2B54D396775EACD380DA8EC0AEE9C275C9BE6517DBAEE9928885EE80E5F805D3CEF7AFF5E01
+0000006B0CB58DE155DEBB336A8154C229F3EA23B74C24C95627A95C61FF5419F889D9DD13FB669920390E9D6087690B5236EF3F278FE7DC162F1FDE337B19E3F440D2F8
+0
+1
+ecdsa_recover_public_key 482
+0000008DD191381FAC8345902CAF3318BCCEBFA795951FBDC13BFFAB111BB93BE915F096C18E8DE2CE434832FE2BD9B780838258EBA841F763D2E618740AAE1963825D4A
+0000003D3D643BEEB3C3F5A4BB94D7D3C4F20BD1875FC9FC01FD60DECE993C7DFD6CE94AEB1D051D8533ABAE0B52998FEF6D15840E78406DC925EBFCA902EC62802EE8A7
+0000002149E2B3575DD2EB7B4F49506D46B716C0694F9E83AF4175B4D374FFC72A4E7CFDBEC56766EB140E01F560E9AE19AD8517E8F09195F96B6CA18FFD8A103FDD7F3E
+0
+00000127711CD2B5A840351BAB607FD6D245A7A40A84E4B55A4CC07A80C3E577E45C9C61F927546B83B21FDEDD7A4CD74E029455DF020B744A75B723D4AA2733DE96CAA7
+0000001892EAF28FE31116FA91DE5FC21F30F1AC385D14124F64A1D6FE0A58916F6625D3ED38D46338087F849F22707FC65043661BEB740B960460E4395ACD72941FB480
+0
+1
+ecdsa_recover_public_key 483
+00000172A4D65700BAAA16A7A0B5AF5830B3E731C60637B68C9E929DBC91778A8827EDDD0D65A5F860FF7DBEC491BB09FB6E306074AD4F7FA08933B8000FD2DC68DDE4A3
+00000046EB206248F7DCA901134396FD828A5720041E5B4BB4B190971A62E26A1E545473C208F7857BDD75EE3798DE8F98030CADCEBFFA70991FD09ABEDD3512F8CD0CC7
+0000017EE4710C8767645AE7D2471B2E12FDC3B90E6B826781010F181F73E9E197B5257F9BC8EB11639DB2F1723503406F189CD20A1E298021E2A2140793A8D099352714
+1
+00000102532E0E4E5E5DD9F140C88BA725B912D77F87B4E6BECEC69DD152AA54E0DF1A25A3A4ACA179371E0A036BF05A4E321028CFEDC4B5A465835F93D6B1C2A85D8AB9
+0000011D04AF409C9B5B8AFD908C1524ACE880DBD912CFE6C917E7CDEDD6A531D8846B181989724C45340EA0EDBD188677000915504C475006BF491ED4133384A0BC5DAD
+0
+1
+ecdsa_recover_public_key 484
+000000C17212A9D80E2AF540303C259C7E179305A711135290B58ED000A6B079D10DC78B63F2EA331DA2B89AC05C023AF3B7456E12DC63C0E7A4660EFCD06BD34F44FD10
+000000D19BF9864BCC73206911DBB4C62DAAFE18342671FD87BC3054CB172EE547FE5BC2DD95F0DE0D6ABB5C477C87EE2CAFE33BF1A85FD6AC9A60549CB132306127F8FE
+0000003A6B8B82E720845D435E82B38F770C715057BB61B9A3F759E6001EF333F5421B78B031D93C8A1733AF5D9CFA33A30FF9A7661AAC4F9ADCADE21D085D21A793A704
+0
+00000112F2EE5E967A37F2739BD59CCDFEB27930044987048BE0A33B1AE31F7BE1B9835E7616F234CD969DDBDCAA324B48A4924F5C9EEEEA1E8568B111BDE15BED5E32E1
+000000127F181DC64C96D5CA1148A4238641C5530E986B059E11CC56FCDDA9801EABA9797B4476F0C47B7859F77632AC90F03D4779E983FD62719CCD0EB8B96955824B2B
+0
+1
+ecdsa_recover_public_key 485
+0000009614DFB4555DFDE3C193074B414B6EE5DAD5EE29CEC851C3182FF7645D19668247004BACBEB54EB57EFFB965DE9EC786F14D7ACA3F86042C8725B9DCC38AEE8D56
+000000B4768C62B02ABE0EE9DCFE8D9BE8D9021FC9074DB58B9C22C854DC2187600B49917FCC4234C2B77E86D867B289A81BCF76BAFF6123E1C4E876FBE31A39B66FFE5D
+00000039C2291CE2FC3900A9FFF31D04AAA5329297FBC9BF6AEB96A42ABF55ED6B93AFCCA7B91A4C704C8A4B1B1E0E809D568111C86FD9566D4B66CBA634052C17CEFB6B
+1
+00000022214DA7E6CB28AC331A09674B5913EB2C9E952385BF2CA483809B4BA96B0B443D809931B29CB47D1AE0285E4A8CC014CA1178E5B4F0364992D6C6CEF358B9CF32
+000001D6E2552F612FAA25DD1D29B2A4263585D1DF73CE4CB90AA64C8B07F799FD489CA4FCE6BAA6B2C26E86F1BAE9FB517D81DAFCAFA42B05C0B3E8CA134C6B76727AF3
+0
+1
+ecdsa_recover_public_key 486
+0000017AD9B9FF8E162FE70D1E531061D57B9E2364254A076BD5780268FC636EBDED1328E6786BFEF01AF578F71ECEA90BF5D14086580722EF6044E112F241F3D9DE273A
+00000036D2F3803491FE5CC2C7B4F3F6700E22528FD209C5BB7861DE9BD565B10B923F8D4FEBAC0B03EC1E5FD3B79A034EA624FC2DDF12ABD21C14D12B584A24B53D6C1C
+0000003990E4C9093E414B501146A045C9F2593B6AFA28474DFCB6DF9288BA8C3E7DFB778C155CFDD1BF4BA2B730FE6614013AEF195BFBB683C872FB68D0239FF959A4BD
+1
+0000004386F31F7D8FAB4C591E66E152970DEE4ED69EC6165A5F1FB4CAF50B3CFBD7A11CECEB077CE77BC45AF45F20AE16D47517706DDE838C85490077D8C77513A41E55
+000000A093EE3F9DCCD4E1E5287FCA90FB1B325E12F9E7856151B033BD57530759A9EC3709BDCE0E566727FDCF9EA5CCD00F79D5B28917452FE4CAAC5E396B17C8AB538F
+0
+1
+ecdsa_recover_public_key 487
+000001B488A723CC56BD9855BAE70E2C45B5A0AD6CCC841278C29D7A55E72C1155A15EF82D2E4384BC92B69739D1ECA509668DA99AA66AE2300F860C0A56B8C4E9BDFE57
+00000089F5F684F9B1AA1946BE32D895898C6FCA08A85285E80D3BEEA5824DD59C22BE1DD15EF5BD822E06210211744C6531403D5D88E0F03F16FFB83AFEF723711F847E
+0000002F5C7E3A032E9A11CFAB5CC8D8A67353E5A4605E2CAB0E67C7BC85761EBFA2A3E64FF53AF4780C83C74D3630B12D8801C1469E48CE87162E1722A85A866E358661
+0
+0000009C8BBF0601791992A15DBCADDF700B80715B942DE5E87910F2119B6CF35066D1BBF822E59670E616C6CCFA599A8A77DAE0D191BF66597E513049D5FED1DF57A7A8
+000000277CE9DB5C14D01E0FCAA4471703DB86DA277A0BE310BD43FACCD3D3C0BC630054C95168FF3DA73E6267C13508F584D5F63104D16D39329DFD5C8D7ADB6824C0CF
+0
+1
+ecdsa_recover_public_key 488
+000001FE5CC6B2BC585AF1B5A226844521A0146363A54C1C5E77466325FEBF0A4E4F65283FBD5974846CE8CDB7F31620C166EECEA57AE7E24D9020B78F8DB2DFCDA658A1
+000001DFD6DC6EACF744049910A28427D86D77E9300DD1D7594390340848D79490D5F06F95BDFB1E71AB00E1F8EF0A657A976452BA163C3578DC5FD75E90B3D09312D960
+0000017A2BBF25DC2A2868B8582D48E1E0453CE74279137BB4A9BC773C1A1F3A85DD3C14CBAB556D1465BF97278C947A296E1F7D6BB6BE5CAD785B2130959245E25E2DE3
+3
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0
+ecdsa_sign_recoverable 489
+000000CE29160FC8333846C799644928DCC4E72BA10335C4F24B005D490555357EFE347ADB7A61CEE679FE7FB6357E498386943D5C38A11634960F0D4BD17D5FDB07CB73
+000001A4D0B6139FC37E9E177AC6B56340CCF16D91CB52B531412542201E314BBBC62869284DA34E9E19B3146A291FF30A24F5B2FDE0EC5043D7124F0EB6B822A31AE07A
+00000134C52F2DF9C7743CA1555B7C61A6BF693EDE7E7514A4967CC2798046A744BFA155A711D7607ECB35E5C2AAA47AF68A2CAA48A86236E9E353B949DC3F1165A31702
+0000012E7E94D52205046D3F62E02226244611FDB5AB9B22F787C32396B4C92C0AE21D6D529097F0B65F7FB4949FE7EF5E985FC00092D42FA1D369CD5AA82D74894B8C74
+0
+ecdsa_sign_recoverable 490
+000000458F72C348559BE15BBA9C2DB5B912361B508D2E14B206AD7E20B078E76E60B49F5F8044FF3E9EE1485CE56B4596BB1FAB5E4BC3F921D788ED74BBEF4B2ABAFEFE
+00000023D629E916DACBEC311E3DFF272074A80D8447BEEE0B5AA9A43EFD7A8E1B43292E798B4AE2637B38F563C4FCF8D0C99A051FBF87CD97FB243CA2B2D27AE9033F89
+000001D60D858AB352FCB4EF9BDF231457323E011AF315E21CB9E6D32DFFE9ECCA124244B4CCDF0185E0590452DA138C5F3F0ED4218110DBD7D28C05AEB2E4D556E8A9FE
+0000008F9AB40DEA69D805CFFC92630F008546DCC69162099BF6184BB3181CA7EF0C898B764B894CBF1DDAF7D76A3E189A953F9478E699E4257A01E8849552C4E23FC368
+0
+ecdsa_sign_recoverable 491
+0000019F25FB792EC3CBD5E75D9D78C52EF2237E0D8CC2575405FBE4BCFAC27DFC98248E84D73350E006F975AC93BF562DC3DE7FC766BB2D8571E77E5A76F329695F32B2
+00000043A70ED725A8A33A2A1CA209FE2EC59D12F9E1884D81118A42AD1321D7211F36506F5E241E9F12D11B72AA4DEAED0BFD320595621E131414DBDA66DF52B43FA3BC
+000000182C894E47A57D52382B861B4D00E0D43D3DB2C5938DBEE0B23E2CB298E57B7ECEC81B21935DE2DEDAE08B17723463888478B23265A9490669ED620785DE7A4090
+0000002787C1B794839C21DC518B9E0834C6ABD415FF6CF56649EE76A50FAB5ADE63EC26D6FF9BC04D02422A65C47FC94189C03B36821084183CD8B030BF1C3B8F17061A
+0
+ecdh_phase_two_batch 492
+1
+0000014A9367C7CF0DD8466377F7E67305C8D0AD494F586A1F26128BC4A1F265433456E2BA743C1B4069DCAE57422643FA6AEDC6BEC925CC23FE7115B3A1405E976C623A
+0000017AD66C1DD458F02CDBE6EC11DD0121ED3B769742E83DAE0E3789F3D1DD062FAD415E3D0C4F67ACBC94F047E55474344F01B9E35A77224DF3A11872EE7E4BEB29BA
+0000005ED8BF682E3E145B422467810BD5E634476668BF20FAB49AA199B97348A5A5442DB099639D5347C54228063CA7ACFB7147699355E6B38A7D025225EEC2D04CA467
+0
+00000161899BAD261AF65F33D74D02DFF8D57A5E2A694BAD1ADAC971285E9850C46CDD5CE486EAB982DF02B534EB4539098DD3F6A7254377089A4229616BEEF4FA09C1F7
+000000D1D2309211DAD7468516503E8EF7C64479781EE08DA1BA05FAD18AFBE1B1AB662191A79936049908E78DD3239CFE6C17D4AF20B0A9135623AAC93CF3AA7683FB33
+0
+1
+ecdh_phase_two_batch 493
+7
+000001698C8A0FB5FB0A5FDA67A05E71E8BF45AF92F216895A216AF038217A908101F6E1381EB22D2195A5BBA58B91F073359412E27901D381C7615A2132C8F81C3B266F
+000000DA5733F650D1CBF9703BA2F56B9D46D3CCFD4F380C3A5FAEABA5FEC9E1B2B8793E1FA4511F1ED38592833BB55F6C18F799DF221DBF6C244DE53E6E2CAE324105A7
+0000003CCCEC3381A615E8A1B77C18A4C63430DCC37B7FB4CB351171EF45FEF5CFAD0039C33A8EC4A0A08C01E522566E59F344F94102823DA6E379578894FA1FB2509DFA
+0
+0000008C87B2D3793F4AEFCD0AD447A381B0FC790B9FF4D064399E913D2DFF90BC1488DE0500EC97281EE50B62C0728DD84B6150B5429B9403DFF6CD43D246F851FB1B24
+000001F6AF76DEC3D690E82E04FC49F4670C091458C488E81CE7CBF3E346BD225C54EF9CAF4258ACBE5F846337D9269DC53559D1450DF6B9B510E9F5DD9373CEB66FA7F6
+0
+0000006F9159C1A73EDEA9E35F2699ED3222FC71213441A23E7CAC04AB4FE3C304B8F2915ED803AC55A33F5D82CA1F562C47197E02D4F90E8EC4427177E1DC0F41688C78
+00000028928FB3789A3D33161766439E6809D16B16CB5E6A2D8267FBA3D33E02C24508E952C704BC7B036236310DF9D1A7C48613299D5DFBADEDF5CFF1F75553D8A858EC
+0
+000001E51E2468E5F44CC6BBF91EFF09244A3BE3E969F37EF10818E4D5C1D7A689A89F403D26B0B8CDBA4B9863F586B0CFD072C93A38A14D607AA521DD7541297099F460
+00000029F869F76DAD99A537875862B7A0B910400AD122298163A0F87A75B540A3803217399B2574C738306B4A1826A3F5349983DCC1F78C27ACFE224295BA122341C119
+0
+0000006F5ABB1B6410DD4761D2337F77B6A9F0B7D9A535214EFCBF707BF60CD5A900C78573D568B0805816336759DA726BB069B6D34AC7334F97B676D60056F1F5C589B1
+000001A2B2C577F4DD4CCFFD5302D14F2CB9A28AD5C378BD383BBEE20136308DCFDA01E2EB55E62F5FB1D6E4BDB91158F40336F3E51994D798EE301E0A1728E6E5DC0014
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0000006C714A5EA56A5C4E5F0857AA15D19B559522204EDE060457BEAAF9192018CC3075C1769CD356D7A332472EAE66EB3F641EF4965C9A726BD89101D5D48228365E43
+000001063B267090D4608CFD16A02AB804703F38A15D3FF4A17A6294CF2930C53C9508053279B9AC1F0CAD54D6A637A79FBF0BC09A22F14FD1A528B3F71AA8FBAEADED38
+0
+0000003E469DE9571E56BC73EAA4E0E911A94DCF48CB682F1680AE3745EECF4CB02D4D2D6862F5CEEC0DE0CECC94A5B31EE4E6EE56B206620388C17F7F0304923D729467
+000000727686AF5FA0B1213402939BA73A9606E222D4862E6E69BC18B89C7859A855B483404347500899A236F71DD24CDB2D2B56E58132AA6B8D14603DF1DB86B0F2A39A
+0
+000001F8A7D104EFB449EB16F83123890C480ECE3CE33E75AC2E04064846BD8FF026016A0EA3B4FEFD19BA1627B88D570938AF40DDCC574BA0667BE39BFD457BFF81FF6F
+0000014ECB512C58D9AC27066DE069BD6A9432ED9388F0A57F89D8186988540F93F7197A1771ADFA9927B15589EAAF99B75B14DEF3B6C6DCF6AEE96F3DB9A9889D385C14
+0
+000001B8FCA2F2C9A64F14297B0DA23B8A25FB47216D95D0D3E67AC3219166ADA006BC5E9D1F395B36694DC69F39265EF51A208E27FDCE38E2A0013F21132FA9E3A9DA14
+000001F71D85359FA30A1CA36D7331F254E7B89C1CE46083BAA1488F9D0D3FA54F1B2E75CE89D41E3E0DB6F65DB1F06184C002A877E263075194CCF4042BB326CD7909F6
+0
+0000006E7EA0C10E198FF5DAB5EAD8DDCA77C189823E2461B204768B48E3635855EFCFE9F31BF38A3A5D2130F44A98A1779B14FE0CC516DD2F4A9E20ECB2BF5DA4FF96E1
+0000003F1AEF50CC11A50F31807706D581741D59C81F72EF757614BCF7AF743315CFF416B0410EE4F037F5CBF264520186D62E1EA737991B15C4223D88FFCCFB3C57E084
+0
+000001ECBCE2B494473827204EDB9DB6E1852A8982F31EAF871F75C99A465AD846C9F8F6A8EFD7BC58FAFE645086EF569D84CB0315B1E472220142224188FC9978F5BF64
+000001D790743FDD388728DDD88D7490BF91060DE346AF438D66F03865116D8E744DB0D35BE77153D2B7E8A517692C17FE456EFAB64A835E464D1CB329F4A845F21C5E54
+0
+0000001D3D8B973720DCA5976B5F77D3D7F9781A7960D673A116DD1ABFB47462003F3D5091D730E7C225628430C3E17A64D9CB9669FD35D656B3989C567678782A5A8098
+0000001C0AD620405DFAFBDD245339056505D5F33E62EE9588BD28291A3BC2C77568D1059F55B4F629BB930169BC882AD119AC46D213C526584C50E473DD2D2664A81585
+0
+0000019F98290191778B11B4B9AC2042FED3EE2EE5AAE808248828DD21071066F05E3CFA23595988F3D618F35C86E90A4BD793FD8551832AB53FBEDED3B3E3886B64AFA6
+000001D02739DD26BF3DFB5C2712C9D6AD121DF49583AD0D5C3A5AC2AE3318A6395ED44C39159AC3CA029C555F467B95A3A845704F16164CC7850B982BEC075EAB3144F1
+0
+6
+ecdh_phase_two_batch 494
+20
+0000018038F8432EC76ED075C27EEC2EA68530AE81B79C0F9145E8ABD36DB7D20285A0FA4BB27B29DFE33B8990B94FE5EEA79D097451E28555086934825DA15BFDF1E38B
+00000072D8093C54C6C39BB92465112FDC77AB8A7F51A685EBB96B14DC7BEEAE806DE3C9A4F668B2B6297C21808F35CBCA7ECF84CDBC3DBFB8286A2E3CE34FAD5333D670
+000001B9540D1DB3871C079B5EA5B0704FC5B657D2B8ED35E9A93275C1A6341C2DCD8B98337DB6962A906B19B2C7DCE26C8A2C1555E4BF1B59E69BB4EB099AEED3881084
+0
+00000165C82B0B5F863CA4CBE572A0ABC517EDDA2AC69774F316B6E950D6C269748305D1FDF66877AD2B28F7E2E0E7E264C29ECA7512EED6FA0E93ACA8AC1D250AE86A71
+0000008CBC596BA126A6D05349C1DF8C44857D564E97EEF25F31FAF03B96863DE86EF4A1E1AFBCDB8588B9818012E00343A453BDCBB7ACC8C43BFADAB7A80337914B460C
+0
+00000119AD1477CB6628FBC22A728C2AE910D41C93E0032DA28308DD5F6813E33605A899C27B975E743AF4A1349F2921420DCE2B934FFDFE6AF1A0C05CDD8A234BCC9795
+0000003F2B21BFBBBAEFEA1AD892CC64021503B09F7C6C828A6E7346369B8694C31666D2A51ADBF49820E10F3F438A6F64E9F9A6246386DB4D903302CD1FBE6225BE6D26
+0
+00000126391C5C5FF391C7284717555849C2FA3F4B002705FA75B0A46A7D0EEFEA1263FC7D19A65E7D57533CF30359B4A607B26D515D318AD8AF6B5B1CD80CC9A988A41D
+000000187871A33B23FDC03BBDEC567037C0D875D43F02498BF92F25E341D2F0C2AA1F916E4186AF53E5E9381966F4128EEBEE320FDCADDC1C6C7C11C95E639721DE4034
+0
+00000063881DC1F9741777E54C15CFA8A4A30592FBA0D01F574FF650E8CA1C3CC0169EC2D3D468008B8D902FD2787941D6574B9E032B9F0746D991105DEC5FF9BFCA2C97
+000001142B2EB72AED2627F0622CE55B4BB60E0FFA86814C6467FA6392C6826B20C265A82F43604BC57115D8D6C08FFE86CC211694FAFC6941167794D3601E7B80ECF8E0
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0000012FB3207E96939AD07707CDC82C13D9A69B85B0E855A1CC8664DC88C5104F1C74463FBB12ABE6985A5046371FE3EC27CF91F1236F9777B7A2997AFBF356EB89EE89
+0000010B9B503F7B5949816228B3424AA3565E6576CEB0D1457DD211474C7DC43723E48B7D639EFF033EF466373176B0434DDB4B8745DAE0FC64BCE8EF4B9116FE99B3AE
+0
+000000EFE009B06A910DBB65C2EB5FC8BAFC8545627225C1812EB55503B08A9D502970884AD1D1BB4AA897C0783B7B7570BD32BCD7CC7088BD340B876CB09CB4F21797E7
+000000CE95A3DF9DA8F790DB71EC6E6C62C04C6020C2F4B4578B3B89EE257907475AACDCB8F14142C466EBC68E38F5A010DF429BDE81AF08912ABB099E4ACDF29A792381
+0
+000000F7B9F8A2D258CFD58154103798B91A48ABD68FDF541115F831BC0B259041341F42CB4E2AE9C7F1A04413E3A1B6C7492F5757B608612BB4D61EC10780F40E006425
+000000F77BB26038BF41C6DD25B49D33F2ABE99931C83A710CFDA253B173331DE1FA7B8C40341F830344CC5CF878622CE990CCE6F4105DCEE4DA4CA35BFDFE9E6F683927
+0
+00000155804C21416B0A0FDF006C4786A0EB9348EC5D486D4C9E75CD2D3D34100EC86C6A2435F60EF3A89CE3F314D3B7A7DA4C8141B47035BF0BE28FE45DDCB692AFE942
+000001C776504501776AFDB9A605E767FB015D16F5E26AD71E70C4C1F14D6E2E68F2CEE128D17CDAC147217E14B9A04F36346467D7FD95CED0A64F71C253327E775F41C5
+0
+000000DB1E6DD39D4ECB611924F4BAE5F91F035A25B2E920F9D22C8BE79D9DA01DB1021F787CEA2BA7EB900B086E7299835928D04B93EAD0E61EACBDFD07BC3FBED14A4C
+000001E9A021E785114D4D07030423344A076AA65FE9B1B3B4D58DB502C76373158211DD7F31798DB5D6418A0CC91C5EE6000F54508A845D2DF5AC8CE678D981D306CCFB
+0
+0000012BC50470E410F8595D83523DAD624BE97A4686E6BE7319465CA0F222A5C545EC954A9D26E58874D43DEC0E8C093D6B45D8CE124BCF41F0F58F4A60AE6AE6124180
+000000E674BA92E54E2C415B2BA17E676A45362AE40A49587747E691FA5A34D2C64485EE60E1245EF77E228E291D58E1C5EB799EA6B8F9E01540CA861DA9ADA151642DC5
+0
+0000000006B63ACC21ABBCC0D275B609B385707075F5C3A13244DD1D8977924C057F9D9675670A94827902421BF71CD101B8ABF6EB0339E976F1C0D036CFB49D71776EC3
+0000000B7BDF234AB3CB2D1FB7FBD7D02E084B0EA69C18F293D1D97936268C9334551D8AEA22E022B3148D6B6D3C6D62652F99E55ACDE8DA26739DA8630D7304DED111AF
+0
+00000106A3DACF14A07704D3DA51102195CC4ABB9FDF335188DAE4C966A5A5D94E8ED010AA807EDA6CC33D6F1C6318233E9A2A1C4F2EF7FF523DF0B26D7901675EADC062
+00000136C13E757A080926A2877EFC6855CA0926CB90725C62B9678103E5E6D267005C45D5C22AE373B7DC0673A4FFAA435B62C6BA13A66D45FC1B4B7B76DF9A0CB4F346
+0
+000001C849FB78C088829686F7664E4C07A0DD10F7092F6982D3E5B274A26C2C97EF1B646384EAB7B1B2734F272DA891BAF4A1BE4D37F3074EDB3B9A48BDB7717D6FBE0C
+0000009D7219D2BEA61008731B90B6A27B4D580ADA58524B9D7B57305D36D78DB1B22A3578471E469FCDF97BA924BCC42E26BEA1EBC4B6ABFF15EE0A9EDDCCA71980BC70
+0
+0000015FB93F22C8B9F5143A18F320975761E26B7D9A9D4F19A8FCFC6510CCA2F742654B29450B35CDB222D70E3AC1AEE0EDE305C4C9348071163E51F788C86B851789F7
+0000015242A2601233E09AFD2C5839A7A0630391740F43C4D17296571A6F9101B0BDB6786E4B5ECEB9A802F75197C6D177B264F319EEC15F5DC1A0B410FFAC3BDCD0D386
+0
+000001356109DDD553338BC819A5B1D48C6A9706B323B56D988104E3E1C6D866765AF949E37CE6242B09AF4F9EBBF862AB9A2FDC86ABE83F4B8329EB8E8BF81507A3788D
+0000004F6E9882177FFC34E99009C427274EB6C3CDD7DBDEC128D245C45CF66C239008117901B944E58B02EBCA283EB39C9429444C58F5E887D02577F8D9CDF3EFB9BF58
+0
+00000040119EEF047624B7BE89676BB2CB8B3A2F49681CACB453620D82563A3DAA072A7A5EB5AF290E7546D2E355A4E9FF660B98DED10D438CB3C7A68E4CBC0AE33DE8DC
+0000011172AD7107AD727AC2978F9EBB24BABDE305E2568091771929F87CD5B4B5B491E38498F70BBF3217344A9740A23509597C3F99A5C3731E9DD4E38F776470B41073
+0
+0000016A0B21E5417825F62521F1D2C3B88EF67575D09AF1A71B6C0ED1026A8D44B01AEFC34CF63A941F006679256407AE36FC7A22C0FBB61020A2BB29351300DB607497
+000000900D90B96AF832FB005AA0D84B8AC0096A9968AFA64B7BA67D956921590C950FF3CDB8F1CC5717E977F4821CE28BB3BAFFAAB67EAB542661975C9A044E15BDC4C9
+0
+000000AAA5831471287D6BD90AB2DD0C15844168B54CC966F24530018051C1FF7E77579EBE97B53ECB3D94EDCC08F9C2A55DA3EF294DF31E7FF364F2239DC23C7D730618
+0000013F9A3BAA3419812088F5F20085F14DA3973A048C8FCB65E662FEB2BF93104943CC41E324F347CDDBE42EAC2B811A45A00E5B1DD35A8C7A44500BF6709BE5C82E05
+0
+000001DD315FF7DA70528D6D7B6308542DB21E0A842F7FF2B3279D4653F4E9BC177532E6633CABA45E17CD1BB398042BCE36ECC9AD7E627A5A39E0C3338B3166E45AA0AE
+0000018A1B9D4900A91E6089BA47C70C8CBF4298E9EDEC814E22BE3B2D57DE15D867039E40E5FBE885D8649E59735DF79ACB79EDEEF50B1BD5717D43B51724109661F582
+0
+000001607F5FE3AE84C0924BCB8D6BAE079808A05BD6138C0D1F7EBFA294023E7493AC511514314E5FB147518FBDB36E5AD5816990BBE71078C6CBFAF6BAF2EA2DA48F36
+000001F3015A37A371712A19CCB5B4C5AE046EB9ABAE2151B41A5778750DE39690F207C7EC8B1D92BD30A9A319BA7695065C199FD0ED3BBE57730C4DD3B18A83BF317B42
+0
+00000110148CB9030AE3859AADA7574D119ED9321C2132B079635872EEC0A5C15AEEE67A88DCC095D9587D880CD10B46B2142D3C93CEFC51DD62D67FFAEC6DFE630ACAB9
+0000009ED5B587A93C7D68CC5C4B0B35596316AA7AA13AF7745BBD8BA3649DB20B385277FF621D4D62CFBFCC66190BF2DA25C4850DA074774F230F350B2AE56CA36B5287
+0
+000001B597B3E1662B92A88391DFC08234BE3B38E5743168E101AA535E6DA95155AA9442EED747B6E6F1E9859180FB46AB316D3B067B86DE91709F407445E8FBE1A85138
+000000AE321E9B9ED08953E325804757D5F66034B450F97193E8806A8F7CEEC3A10AEFDAFE3BAD32DADCB7A96D83F92A040C849493ABDBE3A011328E9CDCA808DAB7FDCF
+0
+0000004B504D6E2B273A17BFA7EA50843027476A630D8E615AA07E69EDCC7D338C85833D74104FEB37E3A836216E005B9520DC79A8EFB0E76CA8FFF7772A846E8B21CC85
+00000014C8AFA82039357D2EC5F7A179D888E67B33E3017ACB1BC65DA57E76B3CC88B000D8E984B5BE8519AED3CCAD18E8A8FF1E525463D8905A0132EC41E20093C74860
+0
+00000176EEEC851399B223D97680D49FFB0361C51ADAA8F51232F6366F6C241ADE2A05FC5CD970DDFF64A523239AB978662A384BF0DA846485ADBEA49638F378602E5156
+000000BE206526EF35D37EDD4C4CF404C6A4FFF51D2D7F1FA0B960A0905AA6D2103B8FBACBFD4E5E066D8DB6BEEADB21FF1D61261C83E4E1899B847CAF9FFDB40F46B059
+0
+00000142B19988EAD68E42679D0ACA0AB5519637F59FA447040BFA6FB51B9B0798C81BBA0790B64219C20B933BB437CD464036529B05FE5A9495C36A6DA6A403ABF3381A
+000001794E50EFDC8F270ADB735D91C488BBF3234F497B6448C22C42985DA3EC8FB17BE76BB239E49ADE830B619D0F6142AFD486467EFBFE8358DB048C06ADEDF3D8AE7C
+0
+000000B7353C879C4B31A62229D72C2EC05D426749B319D1BE301A493CFC4ED43DF86CB8B339C0A1CD735A9A67D20D8B49B66C3533D0535314645D0698E1D8E2B8780BCE
+000001BB50CA0948EF6503B45394FBD1CB1A625F314ADCB2771921C59FC1E224F0F6BA0958E3BD51266574FC18F1A772291E1621FEF48F523192F2E24EB391CEECC09026
+0
+00000106B231A98B334E9950A5075A032A4A0CD86AA87E2DFF000D2F79E911077B71088771624FEAE0092D63E25767DF21313DBCFBE1930CFEB3712AB1CB53DFEAE10BF3
+000000B6067B3C3AD4C7D1548CBE40E6C4C87CD13DC73C260F0ADB86A98721313F8E62E20B846F659BA4F516258A98BB6C7B244B9A7DF85A223BCDBED13B2765B78D9B78
+0
+000000C07927A84504E2CC3F8823D81D6EE5303B2DB65EBD9E77E33D8859BED99A95AB88CD57C5DC47A0EAF9BF3BEF7CE822646D94D42DA82B6C9542A9057BECF9BED645
+0000002ACFD9BDD49299AE438148C7AFEB35C176D9CA8D2201A0EC259621087D2F27DE332D77E23FAE484F495BDCA54ED6C8FF29826559042DFB87D7CE10CBAC1DF7908C
+0
+000001D3276F4FDF50DE809F66B2F01E93FF3F6B124A521DE3A5472DED789CE2870368939469D2D1400357B5D2B6998875612AD2CC1BAE99F4D7F90516E49DBA0E19A38F
+0000006FE0E24D894172FB857BE991F5247BEE856317A4C67FDA851A39768DD0BF7ADC872485246E9803BB8194CE06BEF934D56E9AB8F797FA4A61D7E3A1D3BE78F957D4
+0
+000000B145D2F75EB8476B624EA1676C372FD26BE42B057BE7CA53057AAAEF0003C14424AA67E3C37A88561BD195356558272ADC112C1CF3E5AF4DE599C9611CD37F99DB
+000001F809FB3AFD08FBA95D2CA55FEAAE56FFCE54E1190880D016AA0191FFB1EDF48A544167F1536DEF9319760807C08C83EAF04F9E755FD4125708557ADD7F4BDE614B
+0
+000001050BE7B98FCA0039E512B5DDEFCA50CA3DE29C4A0B5120840852939009B4BB0BE3FC38BDE325F13BC47E57721258AB5E386C3C45E65706A9D7583477A6F5FEEFCD
+000000ABA7F449FA80E5B6C688C191568517998BB550B6B541465C2F838603DDE3A784A237B95C5F1A416F0288044A692645530EC957DC9C23D2F25413D858D5E171B5DF
+0
+000001D7782E9294F27836E96238F33A77A85A7863AF202884B0A06A43BB0F42C08E0C7E928F66E5A74F94B5749870CBF93A885B6C08A261525364A07B1879F97E94F68A
+00000057380F261D873C9EF107F7B35494AA9F58B7572103965C12FD6FB343281D3CE420640429E7C63EE4B00DCDE25EA5BE6F90F494CBEC0257D7471B3B172913A8090F
+0
+00000157BAB50F2B4105B8F264B24F10842FCF863410BA261862C226C770798C4D24227FAB5909607FA5F872CAB9FCC678FB8FDA802175D45BDBC9297C5988DDCE0C9840
+000000056F10E6119D62DB48ED51CC821F812FA16BC0456A6EC3F562C6091CA1E3820BCE837DD180B53D3E8E8828E4023733BA8C68FCB7E64D807760568B14AF9B6FB1A4
+0
+00000155829E7FAC08BE4D16C7284FC6499A7A4781EE316D344BD2B4374FE5DAC73D593AFFDD34B118C5C57C12D2F7ACC069B17A885417E3976B6B4C547593BD04CAC578
+00000199D93DF13D00370636772FA954D1EC665ACD9E054C436D43E54F6CC739B62407E9F14B8FAD0BB95E78B5580264968493CB090D6BAB12A2FAD3D590F8F683A56F83
+0
+0000009C7C321615B05D06DE2F2829F64723F515EC976E17BDF3318546D08CDB10CE577712A4298C239B106EB1CBA51A6FEB873E6266EA72B7D1D4B1F994ACFCC40B4D6E
+00000104E0A333037723A388BF18BB6C9E28F03DD4D2600258E9385C3FAB0344CD445A1428EA4B4EA83D324EDF1C61B7FE0F56A86F4FF0E3E18075CC963A9EBCCB71F26C
+0
+000001C54566E045EB4EC626C762A565F70DC5A6CA7CEEB17D82010BC5FD8D88E68CFDE7EAB1F43D836E875EDA1FA5AEC52FF6F60568C048A6F5596B1C544087C787CD93
+000001BBDCCD69DB9CCC3F593510421214F32887DD88F1D52779283D8A441A6E703FDAAF0F18B2E127027AD43130CC81A7BE58EE8078673C70111A2EC1BD8F14DBD6F58E
+0
+00000120B8B52A6BFD210029AFA066E13E1B085847CD90FEC65095AC94B5AD7CCE3CC1FFA6C79CC6B01340A33E25AFCD54896474462156848C0F4D288BC7E4C942093ED6
+000001D04695407B707C7BE5501304D2E18CEF80525946915E97DD231AE237358717391DF004EC15DAD782A64CECD4F531B01FCC3F32211EC60D158237AD0A393F385F2C
+0
+000001C32B69B3035F06463E4ABB0EA57B9AF82FE3B71D8A7855815ED2A609DD3D37382075C079B51B7DE0006A8A17FEA14FCFECF7576154CD4610B43110A5943E1F88DA
+00000139CDE141C3A7D315F64FE769B0C8ACD965F215A5BB2E1DA6FDDB4ABC03B604FECD6A56BF1AA53923DA1B92E8DCA4A827FC3B7032361469B4D60824C55C296D6583
+0
+19
+ecdh_phase_two_batch 495
+5
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001
+000000075B9A5AC431FDC10EA090562C632D4AFE564BECDA72A1FB8E286DA052A8C5B1B7CC84D8E420ED29618264A7EC9305FAE20743FB397AE4D4C9CBF723A25A48D0B3
+0000001C2FFE0BCF64E1996FB1AF17E8BCF3BE339B9DDF4BD815D2D85771FC1D3FF6735FE4DD3859E200EF36D27C7B77B0B342607C5239B4CFFDDB49AA11AB4967FCCAAC
+0
+000000075B9A5AC431FDC10EA090562C632D4AFE564BECDA72A1FB8E286DA052A8C5B1B7CC84D8E420ED29618264A7EC9305FAE20743FB397AE4D4C9CBF723A25A48D0B3
+0000001C2FFE0BCF64E1996FB1AF17E8BCF3BE339B9DDF4BD815D2D85771FC1D3FF6735FE4DD3859E200EF36D27C7B77B0B342607C5239B4CFFDDB49AA11AB4967FCCAAC
+0
+000001B3A0130464F9E975372AA167396A1A802335A16C9DA4A95092C72C1658F9AD51DD54609E4A3AD9E1F9E1396039D5F727CDE416624DFCA15F715333A8A7645B93F3
+000000115189D5FAA3069840D4FDEC575AF8F996BC412747059328383D58137DA8EE2ECA5EC30230A16C68CC2C25B5AC85F173E1D172A654160F551107BA187086DB0A12
+0
+000001B3A0130464F9E975372AA167396A1A802335A16C9DA4A95092C72C1658F9AD51DD54609E4A3AD9E1F9E1396039D5F727CDE416624DFCA15F715333A8A7645B93F3
+000000115189D5FAA3069840D4FDEC575AF8F996BC412747059328383D58137DA8EE2ECA5EC30230A16C68CC2C25B5AC85F173E1D172A654160F551107BA187086DB0A12
+0
+0000010FBEDD8E9B796A7F1E70D7DCE7EE759E381B94537F0464DED74D48223D5693E70BA4FBCF22D3FB2B8391B2A465670ECECE761F7995587B2616294387045AE02265
+0000000A280F8534713E53C3E990536BF93D84FC94A952D7E15E5F9E0B101A3D3421DD7135886E9B211B4C6880E2DA162AB232CC9D016B0B93052AEF0054B230533C5DF9
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+000001B7A6ECAC9F1DB44AF4003A2314107E81067A5D66CE455E2220CC9F61D20B092E284C574B0E2CA0DC1ADE914A33076860EEE0838CC193CD7AF9197EF772CE1E9DFC
+000000DF30B05B29B60CAA72DC9F82976AC8090A73B2B837EB2F44145FAE02BA4789D5A603A6F658D92F1C7AA1EC2948F3C0F534B41731A4084ACD6CA23871187E748D0D
+0
+000001B7A6ECAC9F1DB44AF4003A2314107E81067A5D66CE455E2220CC9F61D20B092E284C574B0E2CA0DC1ADE914A33076860EEE0838CC193CD7AF9197EF772CE1E9DFC
+000000DF30B05B29B60CAA72DC9F82976AC8090A73B2B837EB2F44145FAE02BA4789D5A603A6F658D92F1C7AA1EC2948F3C0F534B41731A4084ACD6CA23871187E748D0D
+0
+00000177172548F0FBE3FBD016ECD20A89826231A4A205AE03E53B9A9A3837E0BFD9393A5DD67BB64E234725DF88974C4073C5376736A08257AF97A9996477A69DEE7051
+000000FC17CB3E869CC4036B9DCA72CC8CD8D11081A31DFCFBE1DAB00864604511B375B514543EF8919C4B3D908D3ED9DB9D2380E23C3DA227506D310DD53BD1BED89358
+0
+00000177172548F0FBE3FBD016ECD20A89826231A4A205AE03E53B9A9A3837E0BFD9393A5DD67BB64E234725DF88974C4073C5376736A08257AF97A9996477A69DEE7051
+000000FC17CB3E869CC4036B9DCA72CC8CD8D11081A31DFCFBE1DAB00864604511B375B514543EF8919C4B3D908D3ED9DB9D2380E23C3DA227506D310DD53BD1BED89358
+0
+4
+ecdh_phase_two_batch 496
+5
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000002
+000000F239306FEA9E7BB71AA1FE3EBE8C4A0E039EA84114DCAEF7F7F74C4E93F7C37770CD8C5A357FFB80DAAD83C07AA338E3E8223FBEFE0C40FF08A1E89A64F7CAD268
+000001A14763906CF9C6DFAAB005EB54387C5F51A4D449D77AB354D7640F9F9B4199678CA11207DAE7A4B950F9B004397A83DB2D4BD3B16C5889CE0131F8678AE20078B5
+0
+0000013BBD3E82E3C5104E88AADD28B5799F972F90D70D0BDC46E3D5F9C8EE263530E80D5D988435F8C56EDC0CDCE132C084FCB71A4B0DE92C05B260145AF300AC0D4686
+000001ABAB29FBA93C845778483C8A64015EC9AD6C2082A76DD8407D381982B0D78BAB0D518000CA023DC8782B92259647667FE6BA2EFE596F500676B5A19E738514EA63
+0
+0000000C7A1AF5B333BD3D5D5A63A14B625B7BC919398E7648FB2086AB71A56EB2BAA4A05A3F31E676159F79C059C4AF4BD284CBACABB2FB7390CA7CD933F8E507D80F88
+000001CE533FCA3D56EA992E9F50B1100F26AA670CF834F9B271A0F3909FADD47F53B92B9E1660DA0A772DF01F05877EE16A8F7AFC4C5731D5A15913BEC5943239623127
+0
+000000D5910BC2D69DB35E61B4C8E6E492513916C21648277B2BF212CB5E29571B714D916EBCDEB4AC9BC6ECB707CD596CCF369AB8671B4B5EE40DCFA64CDF1F0DFAF618
+0000004A1AD7BE23C83ADFD7E5701FB1A6B456FA6BF4218020BF392C0A034396CDE14F1D428B0B9B585833D3ED380EE6D90ABF5530AB61D5D1B8C78B7221578774D1C593
+0
+000000C15277CFB58A6FC56C125E6662FE78A707B1844ABA0FE447418939058D7C75101702525F8A3204796A0D79667AF56300E276E753A239F66C21F5197A2AB2082BAF
+000001D8F19C57B456E9C3E9C03EE6919A308A1107414325F3B524E15BD87951C8B63DB9B1F8070F8E324E6482731D7C5BB176C24AD97A962C725B8E9432924294E4EC28
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+000000CEA4E501EE77FD292663D6785FD659EFC9656EBC0C202284869FDFCB58A9C766E73C6A37B5DC17A6D4DD3860DAEE08206F23AB3AC0B538D33F07F9C486828C6E2E
+0000010A7035E5767868FDEDF644B2D468FC667569D7793A95DEA2659A5A0F3EC2FA88B504F31A6FA04C8261CD557A04CBEFAFBD6492F35D9E6E0DC29CCA5911D570EF51
+0
+0000004DD9C36F12AB964CFEC8DC664F7A50E441B313F654A5B30581B5E4137495D4731502019D99E423E46E975268BF20FAB0DB214A221831DCD7A819762F1E67D17F76
+000001C7B9860577CF5093A2BBA5FE966B84F099BE7E9E407A7AD4FE2307A2CE3319C5871CE45F6A3832C795A2B4DD68EE3AB3839E7453A75BB92034152F6310464E9079
+0
+000001F56A8EF13ACDB445CB4729045BBACC0C01C2E9C10DA1F62A28FA8CD954258521C41471E443B660F1857D867C582FC2D10D1B5C6C1D4CC3D8D1DB1F3AD784DCD02E
+00000171DDE3D6EC7B7DFD0A4B44C3522132D90D68774FBE117AE97CD6E13CBDED414A2B415F0B3E45DB4411635ED717B202D3BEE75940EF3B2B72CE4B330C1E4B12D73C
+0
+0000014F4FFD84CC41AD711CF27A4DB4A2784685C1BA2DD65C05E4521B08C0B8591B39632ED9BF0D90E6F0A903FD4D495B84B866E061B78FDB22B8A1E798368E76E7932D
+00000067035ED7E45D959ED1F600D602D0DEAA3CFC8C277E98525DE5165C4887408302C2B778805BBFF0D7822D679192ECC5A891126B79144A2971FB622ED873C3D7C95B
+0
+4
+ecdh_phase_two_batch 497
+3
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386408
+0000004B2D751332492A2BA23EB9C11A3B39B16ED7CB387D562C6F05C6CBCB2C0910138BDA371276D17BA0EAB23E4CC53FA8E3D3EC17B1C8CBBE3970A418CC8FD72DB136
+000001A7414E078589FC44D6C127B0468E72BF64896143784DB9F6AC7BC8886B8C4BB39B9D764F4AB8BECDAEB29F81F88740BE42429E3D90A566AB674732DA10EF77D9EC
+0
+0000004B2D751332492A2BA23EB9C11A3B39B16ED7CB387D562C6F05C6CBCB2C0910138BDA371276D17BA0EAB23E4CC53FA8E3D3EC17B1C8CBBE3970A418CC8FD72DB136
+00000058BEB1F87A7603BB293ED84FB9718D409B769EBC87B24609538437779473B44C646289B0B5474132514D607E0778BF41BDBD61C26F5A995498B8CD25EF10882613
+0
+00000024571E7B822B17928AAF106135ACF3B3A59FBB42E48A2FF16A3B1CE0B68FAFCEDE5F32D093BF18CD6885584E4E17E88877636CFB3F3DD23929FDD0FDD63C388EE3
+000000E8724E8D39B11025D664D7A59D94276768CBF7E84799CAD6FD30C1EC641F4D4A940B87B252F106563BA49FE98C80BB44A5612E7ACF5D78447F7219A83252EB9DBF
+0
+00000024571E7B822B17928AAF106135ACF3B3A59FBB42E48A2FF16A3B1CE0B68FAFCEDE5F32D093BF18CD6885584E4E17E88877636CFB3F3DD23929FDD0FDD63C388EE3
+000001178DB172C64EEFDA299B285A626BD89897340817B866352902CF3E139BE0B2B56BF4784DAD0EF9A9C45B6016737F44BB5A9ED18530A287BB808DE657CDAD146240
+0
+000000FF6004E2B48851FCBEDC7E1D9950931BD410C6DF1EA5DA24596D927BF264D5C4FBCDBF18CE45CC1B20364384BA301807BD172BA5EAB32B830B2AF4ED879C035431
+000000FE485FA3301276A5E2E719CA065C80B67B6BE59EB7C7D4B3C1D8155200FBE1DF20712590F2B8660F8C82BEB0F22492BA039BC9988A7E2EC5D0F3FEAB7290A6561C
+0
+000000FF6004E2B48851FCBEDC7E1D9950931BD410C6DF1EA5DA24596D927BF264D5C4FBCDBF18CE45CC1B20364384BA301807BD172BA5EAB32B830B2AF4ED879C035431
+00000101B7A05CCFED895A1D18E635F9A37F4984941A6148382B4C3E27EAADFF041E20DF8EDA6F0D4799F0737D414F0DDB6D45FC6436677581D13A2F0C01548D6F59A9E3
+0
+3
+ecdh_phase_two_batch 498
+33
+0000003A635AC09953629A3171D28980C3B92A8CA111FE39DB6BA4478B8B3B48211AB78897A4764CB4E3E7CC1A512D79966687176770DA7F7E2F729F89059BDE6FE9474D
+000000608AB54FBD63233DE126BC854C0892F724A83A4ACB35CF19595252C168132CB70D77CDD65C5D2B04CC8DC1090B2275417DC6DFDAB204B833FCE0A81E208C20EBAF
+000001A6C647ED152537F3109DD1F9196BB812300F37E4302789F3960CB5D5BE084BD601E18275506797B7C71D610AD47A36384CD65CAD10F496E2C9503FC2820FE5AFE4
+0
+000000F0CB2D7A4B607AA25313C7DEA4D482F1F79A60979B9D0FB5EC182CEEDB177991E28AEED34E9D1A18E86C44165283823FFC6B0684E81F415BC5E1E281407865FFE8
+00000190B46722A463A587CD9D7BE575375BD8AE387DD0C0CCCCAACB0FC3E969B920540736BDEBDF5B0AEA5008BA0096C5C6112CB0871576AA7167CE4666EC43F52E347E
+0
+0000017E6E6704EDD353FF1ECFC73AB0ECBA79B1BD34EF04004822953E083FEF6C70FEE852F6D1C2A00737C11B39E7C3A5D6EC9BE4EF8FF850072F93411A68FD962420C8
+0000008E81A80E11B48E20BAAE09433862FCBD5F4581BD853692EFFFF16012703EF5834C329859EF3D7ADFBC026A301274070BDF0CF523EC44CAA4527364F3E05697B9B7
+0
+000000B1E7E70DA0126CBE7B61E852DB1FE19AB5F71E287AA48FF41EBF1E7167623EF68FA67F3FFF624F5F1CC649B10A19ED6201DD65ABB212187CBA208245FEB3FC934D
+0000007F32914A3FE99E4ADDCF08C5E5A2C358B878906E4E5AA2D2B74FE1D59BAFCBD73B8A521D8DA8470BAA92286CF049B56052006BBC45151938E29935AF6B17A295D9
+0
+000000D9188776DDD8D79007200E53E218C547F8174906E319956C150A84958144A583D4788A75F3B5BBBAB67013EEE0DFE83BECD573D979DF054C8A501FCCC98B2BFC6D
+000000EA6536767E20FB4C9201833EC1E5C6372E6F02A4F37E9928DCEC698BD724131AD09E25817342422A5972D09F3013E85F3D3D4D71EC3605966A6CC67F3D8AC80BC1
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+00000132D68CFC1789744460037C6C9CF9FF40AE398C79F7AE467B36173669828AB153BDDA88DCE2BF674B92DD4FE9BFF7DB8FDA1C7E261A73CBB7F9A314DF5EA7FBB8DA
+00000073DC60EA76849400F0E1DEA906E5B5A6A8635120798D61196A70D778A9E2CD347DD5AE0BAA1F4AE8D4BB1DE413A2CFF9D3F3E68C1233B276D1DEF2F2786B4B88BE
+0
+000001686D907AAB4533275D0CF1993B7FF6EEBECF559404614AC58CACE4969F4EBFF45B7EA9B1854095059E9D82FE233EAE0505E9E89AACC13B5ED5AEA3F531836A02B7
+000000B817BF2F1BB55974261EB112660973663AAF8734315484B387625BF113D5B02836985CC27D740ED70674214B81E0D9F97C0813AFEC4C0D88434B6C5068F22667A3
+0
+000000FFC47DBA0BCEE5071647BD462C624920A830040AE3E2C7C39D4DE111E3EA8DE8BD2CE32FB0E4A35BEC20DDC808EAE42A47CA558194BE9B890B5399BCF65F0DAF97
+0000011091FB4D82A487C21F096EC443B194814DE5D92F94E502D7F879A7780FC118A859C5A2D917391CF6E5B9FBAEE93DDC5E249640D378F594AC5930297AABFA623605
+0
+0000008A3BBD01EC37053BF400893FF34FF95C70B73452ACE02A64D46B217694838770F5723702A074EE05546DA1E5635A26E45FBC4FC4E1B2C5ED6BB63F55BE84699369
+0000017A36912CA25019B77F98E20945B6ED8A0637C536821D849586D7FD2BA4E7F307B6A8D2C57CC4E7AC1C8F844B09DB5BD8D96D291743561A5CEF010DA9E3976A65F8
+0
+0000016F80563EB2381C4FFE7A3E9C4F2470144CD7F724D7F6698FCB794239BD5CACAFF9BAEA4F7E7E04397E212A45ED6DF362E710F8CB543D95E5A313678ADA6BA2F90A
+000001181D70DA6511B77E58FB19A4087C252DDEFBAD7827523D596F952D6417CD3BDC04902C86025146E2E4A07FD003C4C1B2088F19E69FB7E13A771ABED29711B5D358
+0
+0000016100ED67258E213DB433F84D799129F16A1E100B459109EC6AE41452BBF641C2A0A21222698CE42296D28EE9B6766F6513B7A9D161BB12DF88B280BE1BC27DEC29
+000001A541871DCB7C868BA4E2E431A8233A63A0BBF81CE875313D14325BFE81038CFC461D112623FD9F72D9AB04E2D8A7E4A897B285084792A67114695D0D3AB0F8C6BD
+0
+000000FBC140A0EB1B407962B9D0929C3A6DAA543473C563F6E25CA2CC4C20FAAA4157CDF14A54C3B13CBA1C1C167C74CAC91824193ABA4D587D78353C3E46B71A55C444
+000001663195E9074C4B71B8458234A3DEEC9FC1F17303B981586C1FA2FA1B66DD6D487D544246A33F37CF9DB7D7DFB82DFE7A109C3C646B231A663EE828F58CCAC99DAE
+0
+0000007E26F1902AFF0245350D58ADC71AF31371850DE25A03BDE7DA8CAD15991BF53648480336879BA3CA1466AA4407FCD09D9FA24C34FF37420C0BDA2909FC5DDBC2A8
+0000004BF21708E8ADB0BAA68BD628EF25F346750D7BACB6D64BD488C855E9F74CD242FF38D20DA58226D636271B349392D52A9B3FEAFE8046850F904E71B6A719303450
+0
+000000094D848FB743B8984B41F3AA5B04C7F393635E3A2456B5750C043932FFEE57CD5BA1A5DA582897D183D70C664A8C8D91DFF2954EDCA2E890149F4686D5237013D1
+000001D79B8B098BC5C6013BAC521A9ECF9D25E5E0195C2729EC4F7678741EB313CFBD7F8B919756F0189501E64DEF05085BF8AA1CBD43519C96B45AB0380E1224549F24
+0
+0000007CA520997117F3CAC58FE92960CD46136ED00415FCAB07ABB81F78FADCE6AFBCACE4EFEBD1D83AE7B61F40FE901ABE34B85DFAD58B5316BE0AC3C59A628C5FE06E
+00000134F22B4B4CC3E6A09B7F22B7A269CFAC136753A09FC53F88DDEBC1F9D4DF1C0DF17C29F9B4C63713530B7AD41130F4D77505298AD5C6E19E793A086B9439E608F7
+0
+00000136596ADB4A584601CEF0F9871A1A4F76C1F2D81CEA647A16BD3B85C3D3B09C35F401E7B653C92B68608631D2FA472276E133E4DB5B13CA67F0217D76E43B9A992D
+000000ACB09B355D6F290ECC278F2ACDDEEE63F8F538F41B9A2BE1F90F15B144F66FC27FD14F9F0627A3CD1861DDC0A5CBC40D543326CC031A7A695A1335BCD3D4C57BA8
+0
+000000A9B986794F16DA49FAB27CF37BCAF6D8AF4477615B6792BFB67BC4E1A9282CA1CD6203A5C4A7A489703B2D38DE03715E76E6CCE98D7C2F73FC4947AAE14745C5BC
+00000122F4BDBC9A6D8B9CB49AA81C1AB1E37B136F7EA3683707D981D708D039FEDB5574827899B5D1E848989E7630DBB465A5CEA577DA582DD15608A10A540A1D8A1BFA
+0
+000001C61830A858F35CA42D3D5E4B8DCFEB94F93A63C34EB8AD41AE7B6E3AB801D892CD015334B33CADBDA43400FD8C9B045E01F74C0D9B1B921B99D1B47D71D1B505CE
+000000765C1C0CCD50A771D57B620D44DB75BF73CEC797F3ED3363B74D60753B4CA40C19C90D110A10E533BF8EFBD7BC20F6B9FADDCBE332DBDEF6FD87518EC8A3E9F02F
+0
+000001A3E7F3F0D09EE00EED7FDFC6412847AC6C00B235E7FDFF23FE63FC2D77438ED2A926EA8105FF3D921BBCDA7C2A95134680180C69212B0C361B78736513443F5F93
+0000012B96B73432C28944D133C0F23A9854D80717A374B13A14377E5DC860834C0B857654DAAC40F03C218A42314413336B652D945DBAA262D581B6FE181E34417CF0E4
+0
+000001BC4B06309A6FA394FC13F1A0461773F7BB025206902DA764A096F467CCC510313AB6DA509C411F3526C090EA7F80AD131EC14B2DA651B01E70C8633DE89ED74014
+0000019875464759DA965AA5F9047931F2762BC6B00CFEF81304CD91F7523CA9C58496B7F879431E91F5B9F690CA2FB4B55DFC7CE854C412DC48A0BDD4D369ABFF96081A
+0
+0000006AAC29891EDA0C55550DDB7DA37693614EE8EF1D123492E449437B371777AF231B250D1F5CFEA5075F77EB10F90FA45BE89F70861AA3BADC7C17AA393DBAC5025B
+000000D59887D4A62D4CF6F61476A93644C218FAEEF140E2D7FC7CE77A68CFBFBB6CF36CE12F354A9CB7ACE5C234449283E45642CAB6472EA4F7C4A7D345CC49E96433A4
+0
+0000005CD85FF3A982A173FEF87778F8AB785F7B69A0A57C86D249DD18A76A2F93097027F98426F7B2ECB8B2C6BC82ECAF0C4DA8A3AFEF2D8E84BBE2663697632132FCD5
+000000ED584A2E60989B452ECD1286E2B4BD7BE5E84210C9ED5AD9198CB69F8F26385FBE16C1FF5B8DD93C8B41535A359C27ABC8CDC9BCB43FAFACA5EA1C24943C385D92
+0
+0000013CB848C59082AF17249EB5624DCB43829B8A8F976B56E5A9D0DD155E86E57468FC8D0DDEB667828958E6D4A97AB5E521D2632C01FC15C339B046C58E9B025FB86E
+0000004B2DC49ADD3E90FDD8D9714074837D8FBAB9E33999B72D7A78659982DC563C977D5EA7E73CDC1D754C8746FCE46D0FFBA307ACC0DC3C7974B1CB20A10BA52E6283
+0
+000000ED48363339D9035E932D9E29A6884DEBFB59D9BE314DA9C6B82511D9D0A8C36EAEED755662D20728E60C4CC3A3FE4ED64D85D4555EB1F2C416ACABE8FE00E671C0
+0000002A81842685FC15EDEF8C62F3968A1CB0DCB40CE85F9E5686C974FF1E41C29805230BF9D70B7032CA5840C559C44F7535FB2019AFE307AEC8A712BED147E7A937A9
+0
+0000012CEE7FF1FB01CA3E9D46ACC43552AA2615F7B0D2B4EE2FA9130354799E83E818FC907C2F53353375D505E52B0E7E69220DEF0ED14863F1AC06C9DC55E2A3657F79
+0000012DFEDE65EDA67933A483C06051AA712F056059CCBA353CA731613D825B612565F6A553F2F3A9A33B87C581C69AC9B6455E155D6483949C83DB793EAD73FF323298
+0
+000001DAF01223707F24592FECEE20A3CE5E8E6D283F6EE8F56F7C5C6A6274A80301379AF0511F23DDAAAE441862084E73B97A456D70411A5F7933944D80B2000EE64F41
+0000011A6E7C461F59A8852433E7882D8BB29F1DF7805143B4BE53C01B59D438D4A73EE253B7C2E6659D8776D3C20F56D2425A0291FF24C223697F47F53B0E4C5967F1A5
+0
+000001857E555C507C3A56DB0C3C88CE8BCDEBB8C0A1D1DE252DBC08EC737F80516B5FC32C59BCBA2AFEE983BB29F822A5D3CF9BCC0796EB421CA1F3B859231A2695E06E
+000000757C5273AD1327414B6C8BED77B8F4C6D0BA2E36D86542B165B9984168EEBA3A8EE6021AD3B61F40B2F518FAA9C464E18C2F70E5D45A426A94D4C4513B893F5BB2
+0
+000000593DEA88C8E9F46747E7976B93E58AB61C66A7D8FFF3A312AB3881C20FBE70B1D08AB2F96275DD663A1C48CF2D162E3F41127A67A5AF2725A3A7F047664654547C
+00000129134F6766251FD9042C1DFCA7CF713F77F0966EB5B0ABA0C3B8BBE6A638EFBCE923FEFFD936E0BE9C2CB756FDE089278EEB7265EA11D9446D95166B696EB478C9
+0
+00000074D9EEBC4CA45ED91D6E797F2C771C1BC143D11A890B744AC92A4C91CA58EA994B23E91924C82BE7AB6BC14C4C213281C31C93818BE72E7B2C0073AA0B9B560F62
+000000B881AB57627D17AA292B66D366BD8AAB9D4AC3302DE47070920EBC794F66CC39AA6DAEC321E52CBE8C44B61CBE3B7AD4835F252BF926A8EA62674E89B53E879E18
+0
+00000072F30988FAA9D1F699CC0AA179CACC4206BC49A8DDB7A8A3101004005DCE51D43B8620B18195BC801186F446C85079A70EB85663BD06F76BD1AC245197FCA50CA0
+000001520FD0B6FB4204D3AFE557F2CB11E58187200D46D6207BD27417ABAC0C47706635B38912338F65CF4DDA101B074817CCB108DAF810B8FD87904E0A81CC02D23945
+0
+00000066DEEE155DA028BAE18730B8E89878F46D8833CB5D66A8879DDF9177CFF8908FCDF94A89822066EFFEB5A1355E8698147A983EDF3E3D7C06C036F5D68CF75BFD9F
+000000ACDF73CA15EE7DB914580EE5231DF278FD00B65A7C03B369197D0232A14D9230D71ABDDC66E97766F1C454E885DD650B792164AF4538D72330C4A06DF661F6F4FB
+0
+0000007D9A045D6A8BE582D6B9F1386B2F8492D92C46578D40CFFC48A89068759FF46251E60EC5E5E83829130788F114D3F67A73EF82F09948DAAB12163573BCEF102F41
+000001E83BAC7256D779F4D79EF3FB2DF7CB6A2AEECE377684C2610C0CACF62D1375818D07C423FFA385184F20CCF0D57C4DCC02323614BFCFF59209E6F4AB8354D59E8D
+0
+00000192252E7E92E076179A57476CC540EB1073BC1F42A075E3D78CABA3B84748ED819CEE05957E572A4A4D1F56AD0D41810CC984D695E57D034BBD9973B31A99C53051
+00000046463FC51DC2E1796FEA88B00C9242B5D76F0EB2BADF6218C01043BB5AA1F627FB08A90D7D5F5DC1A4E515FB7196476288DFD860CEF1CD6F8C4187959BB2372280
+0
+000001EEF4FBC6D052793162648A51E507BF0BB8D00269D34DA96CF7AA5BED80192AAB9B1814087AC92E2A02C2C5F523B3F874DB5CA3BFABE38052408A17D9D2840C972A
+0000012BF1926CC1F00E12C8023B5A8692F893428B386ABD5FF75A59C78B59CB75B5126B46BBDC618E5523A3E42596BAC7115C8249798DEB20BC9F65C5C5942307484E71
+0
+0000015A82160B709BFC7672FBCD38D658B644B742CE9BD350AF5FDE08F1BB0319AFACB3B54EE94E063C3F92FD94CE332EF3A7C6C4B764168A892E1D7E3997C792C33D0F
+0000001C85A5D293EA2A818FF94539DF2009C76D9957F9BAB805C031AD339EB41F37E54F259E7B82E22A859AE5BF61BEDE3B5AB21A3D0926DC0A295DF0D4407F9C221EB4
+0
+0000007666109A4251CB1E42B1E3E5CD8CAC51A7D3B3C96A9B59A9B9ECC3E7141D0F96738E515FF88BF0A328E5B7250B27DB2E7D81B740B7FD9B40CC2D84956E44D4A414
+0000016C0A70BE07CB42783EF1E5DCB1895E208A59DA499177D667C769CA043A98A8A370769C8F38EE2D11B559B3AB0B2F377AB714665AC6D4828FCD0C1511F7416C6592
+0
+0000016CEBF8BB6BF04C5C9E8C966B96BDFE3D90789093BC273F877159A06DA5ACA300E0D185909086D60444544122B4C32F5E4C970F02D203814C6B8B2E04F7FB863DCF
+00000152CBC71BCAEA7225330D14050540939C0A1C8B3B0D5529A6327EC5B5EC612F2A9597F1F0470B1DF318A41ABA74004F3CEA8B414425585047F4F26D7759BBE54688
+0
+000001AA13B0CBD2545DB4354D0676303880277D94F2C21F49393DB4C461E912B92E362101DA13F68B790981A93E28AB2A843FB1BFB0E5B013819950A6A18766F68E73E4
+000001A31321D20C8E592AF93DC8BA84E8567560073B7FB25CAB0F216586FC9BAA23D814DAE790674106D15876A88D47348DF25C1C6729D380084DC015494DA2EBB0FB0D
+0
+0000004ED28C2A3FD549753DF78EE56FF3E7C8EAD8D969BFD7857EE3C6085531B172504669BC0679375BD0A4E26E27EF0856CC946C0D63E49D3F0CA7AACF42472429F7F7
+000001BF8BB4A7D0F259C3E5B493FE07E0ADDE65541D7D8045587EEF37C5B85BADFCB7CB4A368B0B856EF3D6461B83E0020C0A3479AD97B084C244C8726D1D43FCD3C3D2
+0
+00000164BC74AB30CBAFB7F88F50D88C9270E763A2793CB985E1188EF2EA8459D07627A0A340C0509A64292DB81232719A0A3FD95B968FC3424E965112B0168D23C89AC1
+00000089847D9C1DAA2689ADA36493E131F64488C4586ADFF4D8D3F5C6AEC3B245C57E559BBD280A8ADA0748A10E01070450BED944437A1E9BBAA8CC26EDAE09D4482CFE
+0
+0000007E01A2E7D2B25A6662C9305F5F84C0CC4E8E149413FFCA9653C0171160D12349B8474C233DD0E0DE11F59BD95EE2448CC2233B7A341EC7F0A3A48274840238F602
+000001C7E60809FE9FEB51D16FF89FBCD5F2596BA8359DDBB004B359C55E77CABC9F39235FCE4BEEE417B423A126D6782599ED1D0A3120CB0CDAC4D4666C5E1EDC5F30D0
+0
+0000004654D2055575F6D730C7000096F9D9007B311653C8A699E8817B7AD3A2311B63CE973BE3DE5ABA2454A24FAC37E0E87E73A80FE1DE7C3F9629A3C9AED299B38398
+0000017D2DCDEA5D52B42B7E0A9F38FAD06A89AE68190C26E59495CA1FC112F13EA2C55D1BAC5813F1010325EE0D3A9459F26FAFD45442240063FD73D87DC2A9532DF1C0
+0
+00000045868B8C06E9ABB2A07976CFD37BB8F3BFE8AFF012055A2EC4C91EBB1089E5CEA75C7FD0554818E537C48C4B1D9014C8C1A3DAE202F92AD253E052C89643A1F169
+00000047D7552D6D47B114212E6374CF2082FB76EDC8FD7A2C56416F5F84386F7E192B2304D4D6F7277E3804ECF8DDBD6AB07CA5E1C091E0B9DF057CEC0CC939FC44C676
+0
+0000016565DE0F0F83DF144F289F17A4A9D08B6EB490385BA5A3B3AF31E8F0D5DA95A4A34C2736DEA7B043250C7096A4A23B5A8F2131C14637C3A851329013FBA74B0E44
+000000E700907AD643B038E2B1EF32437B7B12E515554D7EB9ECBEC7103B4234560DFCA04379B9C00D1365B5A75FD54FC9E65E890B889BE9D88615AE689BC7635C4F6E12
+0
+000001FD6E3AD670E4481AF6446A0E9E71853DAD40B1396EC23DE7FF7D51A986B542080B9B7A54D64996D2DEF0C8F245ADF31EC9ED46F82FAB5770C2A4ABAB43462E5997
+0000011EF88F6495F9A37B62D98DB6D8F3C61609C25187150CEBCEAC7BF1B699D6B8F0372F4C206587459C6F338CB45C56B722E8F0FD24A6D27332EDE45710B1B588E230
+0
+0000007445C9291B4BE39809C204F1F82A99AB20FCABBCEC828CD193307A127A352C3A014C92BCA4F89E14448E977BBB8882A2B32BF78814DF4ABA465047BBEF697F5A59
+00000056CD9EEEB80F0986DFF1275EA96F18BF449A361640C6BBF7CF018415D21FAEFA25209E28F0AB716C20CCF9932D3C4D00CEF60E7707016B1D17BCEEB0709C90D9E4
+0
+000001B3282D86EBDE36D683E0B1C9474C83C98C94F3E7053C581BCDE8A0D3F053413E9683314A82BF10FB545F6AA7F85CFE80F839801F13472ECC2C85AAF94F82120D55
+000001788F1A93AF62281A4DCFCB2CF060925180CA850C46B9927E1197153E0CC407F18E902C578379223FB759638EDF3DDA022CA34ED77B7B05ED4806125AAE8ED4C39C
+0
+000000B383DEFD6B2D628197E4CEC14915315365A737C587EAEADDF50B3160AC0F1660BB3B374A63435D506233D0E3494E340DED502833AD4EC68E27932CFF80D76EE6F8
+0000005F61143E1AAEE5A0397AB29F30E06E5B32EE67650C27A1ED9397DA72FA645367A50258A2932A48F1C4DE1BF58B2731F8134C70BAF1084392BAE1F173A2B3D98DC4
+0
+000001C9329CF38C1FAF15D2E88A0890E6BEE25173CFD1CD134247361A68E087CA175E09D5CC2B7D7A6D6E6EF8CAA83F74508EAE65190287BD74E92F6D93E5E929DD22E8
+000001E4BF7181F67DE59A7F5F7BA06D0BC00525189863A9312183DD2B1B691FEAF41A03E39445A995C5C82CE08B80E6370FC3AD5185B110ADBFFC1C88647C1C153A447C
+0
+00000155C81A812B54D15DECA670E5C3CC994471EA5CE8FBECBD9CA83E3A3620FB28CF5F926987735201BE18C06ECDC2F95F4E08EE71B8012343E2BF964626EA51947383
+000000EE5D1246565A41327055B8D5C54F412F95A61B4CEE8DCC037D0BFAAD1420E9EF8E6906DFE5B910FAFB4F0D71B4F58A53141E1AC3F5A12E7C2E0FA0948E53B479BF
+0
+0000007FC7B9D3EADB87C70B435AB7DA181B35AC244021843F44ECFC590A9D0310B5BD37C61A4F40D5A0189F466C802529AE0FD26DB1EB25F3BA68FC5881958BA9F1538A
+000000F908714E30E460AC7D5212C4A0BFD7F16035352CA0629C54C48072A4C01F620CCBF0BFF91D937EEEB363E677DF5AD551E4FDD50E5BBBE6A19A90DF8DF848F87A82
+0
+0000014613D745D54EAD27FB8C51166830677134CF1A28A42AD894D3D1749E92AA65383451C4ADF4A9E22754A833E299BB43386D242346B343F269CEFAEAEA4A81D48536
+0000016E2A87E77D7D8B4D98E34D23E9C89CADC0D66A6D1641CEBAA22318C224E222155F74C48A2F9C1F230EAB32C3C98E49230634CE3F176F87EE2A56A4A903CA3C0B09
+0
+0000004DCCCF78CA22FFA2CDDFCB4FD174AF482305B4571DBCF17DD7319CB899B55ECEF208BB5CD2D360BEA0C485F5E59187F38C8841984340B8802CDB45760F3693B6FF
+000000B49B63737625AEFFA540FDC8665ECD5E5E0FBCC24CE5FEB096853FDC8D07520A1D28C95991998D11C117269044C91445A5BAEAF9B196DD60F2530131A8939D96BE
+0
+00000196AEB2D1514CC3A1823E5BCCDD2BA5FCCEF7D57091B9C68167FEF2EB79A4C6089E1EA6E739F32EE599DF9D5AE6AD9FE565E05FE6FF5834329CEC3D8BA36CB8E576
+00000116211FA24087F796345BB1FC9B19DF304C1BA5FE269CA461DEAF401D620FFCD1373ED8306A306BA4745E4CC0C2EB019DD8EB8D6048AEBA990884D77BA9DAE14FBC
+0
+000000C0B81913EE4968C587479CDA0828E3C7FBCF64A9B168364B7FBC4E33B9FB37CFEEE8A7179DB24E80E6FB954433F257AA744DA3AD50942BCF32EEB44092E616828B
+0000010C628A11031F60BA7C503485D160A4F794C8E3ADC55E139FBCA41E4D14E3AE67ECE9F4F8439C466AD916322CF8F8A5CA1D6724DE3F8A4D0F1879FF6B9DFBF8A95B
+0
+0000014FE7236744182FEF4BA50F900433CAD3533C08AF034F2F9EE89546D6729401A0614163B877C8E4E30B6678C66B74F6ADC9236652F74BEA54AC20E3905177668864
+000000B6F41712C50A554BC678A89FD9CE4758EE4BD3DA11385684855E2CD3463390AC70748875FEBC76B4248260BAEBB23DD1C0EDC009BD762C62D890DE90274B7BD6A4
+0
+000001CB45C5C943AB0EF786FBE2904059C0C9F059837942BFEA0B5CBB63FAD91B8107BF631D81663EFC42EE2F4DB6C4BB443837673579FEB67376DC2DAD85953CC00BF1
+00000161FC6AA8E1B01C204BCAADB6B9E23B7B32E24AB0195D1821175635B9432693C4D19E7B451901A296E818DDC3B0EE123D300A4BAC437DD7603B52A0B5EF35E619A9
+0
+0000006ABADE2CE18730D125559D3567C120E3079622122BE0773F812610181D8FE4597E59D320A2146A5D0C9038E51706F7962FA222EF28BA6EE8EA6B82C68887645890
+000000AB4B52DA578F438C624DCF1BB384BBCE48F4CE1FEFE364F057E301C6499A0EBB17396D460FA3A6A8BB12E45CF9C526E00839103FA801B6F13B4D9CC752DE83D69A
+0
+000001289BBB7210E0F303DB9D0C8E3BC303EEEB284815DDA6946285A59DE7F5D94704108C47ADF4168DBB04604A611F80504813557F0296551BCCEA8287AC4CC4A5323D
+0000005B8CDFA190E24027BE1857D32B45AC97D0702FC7F37567A20C84B148D1346860CAF7B4EEC7EDA94CD7DD6953D7A69BF3367E99B8F41BFBA0410F68AFDD9EB267EB
+0
+00000109C56E34310750F445DA98106C9F9103F2032BC5748A03C06431CE477EF9844B2CD234DBC4AAEAD7129B35871AA586A9F50D87B5581A6662F17FAB9E5FFE5B71E6
+00000185E7C6CA9986E83D342148A6145DD17634B67C69B23ED776156F7449D9B5A76D102E2B878F4A76C17A1A4193E086BB26F10863529DFD78FCC99804FFA00BB54264
+0
+000001BF5CC9942FB5FEBAA1DED7B33F3936B67E80D51147F70F5C462183A0BDEF0D0659ABBAE69FD911B08B4D04922517DD6796CE17A2A9C47B03E32B2FB08A738093F6
+0000009F982DEA4B4432177F185DCB6E41C9940A1412A2425AE57F2F574C31D45E1741CEFF58D87933038F31530C00E6859DD58A68D7959151EB3C6208832C4262492902
+0
+00000022B81F494124D6F7A5696EE85AFF26CB9D0DF8CC69F50F982144132CD2CB5B7738EA8C8DCF7696A97247EB768B570BE7CC2F97D3A538FEA5395C320A46C11C0BC3
+000001934CE3522E267F2EB2CEAE9A7539DCE5CBFDCA5B57185F46FC67A710C843846FA4F97F5A3B7552293DE6198975D2D850AB1D9AEFE03AEF0D690AB705A501266C2F
+0
+000000FFBF7EAF9573FA9CC1CC8062E752975396C721F4DEB40F1AAFC9EB0BEC03FFCDB28E05FD624E918AC4244D2F983AB5D939B78F4AFB01972C4F4DB07B8E933CE89D
+000000E9ABA88027CD2EAD68D51048B6EC017A57619985AA8EA7DC8ECA5A0AC2BC5A7B712D92E1CC1488FC1763342E9887F02102A1704543BCB9C7754C0FC779306722B9
+0
+0000018880721BBA24696AC6129CFC21E3670951DA8365F34D173FD2757A60EA35DEBBF7A4694DA4DBFF0AD2AD8793D3C34BC036DB745E815BF6FFD1048C794F1A12F17F
+00000147AF65836E7EE8CFCDBCB2DD3852DC258B48410F1437F26F0A98FA0E52F7D19E8B59BD8D7797E1847E3D3BC90A3F3F920CF12D04CA9BE053FFF2CEB10DA699C62D
+0
+000001264B3CB6EA70F253361C830D5B735CD52399F67632A93D4DD261DBC777A3FA92491C6BB32BAB89BF0C3607D8CF9888BC591D27AB0EF7836C3E67789449AEDF474F
+0000009247020E319734F891E30FB1142A0FC34DD082D50D1E7326AA0D76C4EE34EB33E84E918FA78ACB45CEF1F6534116F5C1C79D9B1AA8DF55FD02AFD456C4A8849BE2
+0
+32
+ecdsa_sign_stream_sha256 499
+000001D0361BA6B236235CD613BBFFA3AD2DC7AF1F90BE1559AF5769DF8E4B5D9C38573A83FC7C27C831CD86D7D6518158AC7820BA7B6CAE76E595203CEAAD4853B59E37
+000000E9D9DC1F26BC108B97AAC0BA56E286E72A34B8ECA88D3CEB80C64FC6280C67248BDDBBA766849C86596919C3DBB57789653BB2F1CCFB77FF73DC7EDA9CA01441D1
+000001197EA27028E71DA79DA9F0094178AFA02E59707F859A6CDC1787B391921651357DD669E1F294CA502C6A23830CC041D31FB95519FE06DC14EA2BE07391B204D74A
+0
+BB
+1
+ecdsa_verify_stream_sha256 500
+000000586314AFCBB9B2A1158A3023D4DC866D4A77BA7456A4A908DFA07E730A57BED5148616E10992DCBACD6A868F81244304CC800BE15E72347362FEBA4AC6F092D0D6
+000000D9FD7B084D1A077D86837F7521BC514BDB2705D1A3CC56501D67D3A1F89A4A7B61CDA61D6E8BB84830AAD51FFC853088763D35DF3E758173027DC1EFCA179DCD60
+BB
+1
+000000E9D9DC1F26BC108B97AAC0BA56E286E72A34B8ECA88D3CEB80C64FC6280C67248BDDBBA766849C86596919C3DBB57789653BB2F1CCFB77FF73DC7EDA9CA01441D1
+000001197EA27028E71DA79DA9F0094178AFA02E59707F859A6CDC1787B391921651357DD669E1F294CA502C6A23830CC041D31FB95519FE06DC14EA2BE07391B204D74A
+0
+1
+ecdsa_verify_stream_sha256 501
+000000586314AFCBB9B2A1158A3023D4DC866D4A77BA7456A4A908DFA07E730A57BED5148616E10992DCBACD6A868F81244304CC800BE15E72347362FEBA4AC6F092D0D6
+000000D9FD7B084D1A077D86837F7521BC514BDB2705D1A3CC56501D67D3A1F89A4A7B61CDA61D6E8BB84830AAD51FFC853088763D35DF3E758173027DC1EFCA179DCD60
+BA
+1
+000000E9D9DC1F26BC108B97AAC0BA56E286E72A34B8ECA88D3CEB80C64FC6280C67248BDDBBA766849C86596919C3DBB57789653BB2F1CCFB77FF73DC7EDA9CA01441D1
+000001197EA27028E71DA79DA9F0094178AFA02E59707F859A6CDC1787B391921651357DD669E1F294CA502C6A23830CC041D31FB95519FE06DC14EA2BE07391B204D74A
+0
+0
+ecdsa_sign_stream_sha256 502
+0000000CFDEB48CD33CEDDD9654C329BDF07E51572BBC459FEFF9A09AE33117ED65959140A2B6B74906CFA348201EF8F1B7DC48B75787552EB0D750040A9E1205896FCAB
+000001AF051965E4C11607A5F89802370DB33991BF768D2537150FA029299CA7CA6764CF0CE1B922B5728A8A35F0C8EEC2D7FFB5EDC4345E5137D61B07CB63007F677F4C
+000000B115074CFBF64497E814943FF1EECDB2AD530354A2E88DE224DDE2F7F7356BFB6D4D0D380E6338A8C390376C076E87593641F962B22D59A97374AE4CE2B200DF7F
+0
+9713210C7AAEE1FE8D8FC2FC50E542F902D5B4FDB8FE2B5EDA16BE2A1EE65FE12D566547C0836321EB011A7F371F50BB9D7C7FB0C59543
+7
+ecdsa_verify_stream_sha256 503
+000000B13A58C5B61B07F78BC6BA5EC4BA49AA939057017596FD310D54C4ACD12D5D6C249F5663347FFAD0ADEC41F357F0A1773DA1A0921EE48AA723148832689468CB98
+0000009E742BC3FA4B37216910F3CF3EAFC0B35F71DF3976594A11FBF14287BD9566C21707C814DA4F2B06673D1010B9F75CAF9B4AC1AB91028B1C314107AC16106077B4
+9713210C7AAEE1FE8D8FC2FC50E542F902D5B4FDB8FE2B5EDA16BE2A1EE65FE12D566547C0836321EB011A7F371F50BB9D7C7FB0C59543
+7
+000001AF051965E4C11607A5F89802370DB33991BF768D2537150FA029299CA7CA6764CF0CE1B922B5728A8A35F0C8EEC2D7FFB5EDC4345E5137D61B07CB63007F677F4C
+000000B115074CFBF64497E814943FF1EECDB2AD530354A2E88DE224DDE2F7F7356BFB6D4D0D380E6338A8C390376C076E87593641F962B22D59A97374AE4CE2B200DF7F
+0
+1
+ecdsa_verify_stream_sha256 504
+000000B13A58C5B61B07F78BC6BA5EC4BA49AA939057017596FD310D54C4ACD12D5D6C249F5663347FFAD0ADEC41F357F0A1773DA1A0921EE48AA723148832689468CB98
+0000009E742BC3FA4B37216910F3CF3EAFC0B35F71DF3976594A11FBF14287BD9566C21707C814DA4F2B06673D1010B9F75CAF9B4AC1AB91028B1C314107AC16106077B4
+9613210C7AAEE1FE8D8FC2FC50E542F902D5B4FDB8FE2B5EDA16BE2A1EE65FE12D566547C0836321EB011A7F371F50BB9D7C7FB0C59543
+7
+000001AF051965E4C11607A5F89802370DB33991BF768D2537150FA029299CA7CA6764CF0CE1B922B5728A8A35F0C8EEC2D7FFB5EDC4345E5137D61B07CB63007F677F4C
+000000B115074CFBF64497E814943FF1EECDB2AD530354A2E88DE224DDE2F7F7356BFB6D4D0D380E6338A8C390376C076E87593641F962B22D59A97374AE4CE2B200DF7F
+0
+0
+ecdsa_sign_stream_sha256 505
+0000010738259A62C0A00795BC7BEC73772C28E5297774C4E62E282CF0BC128499A7069C604C9A2A37D10BD3ACC8DB477DA8666A35963E3C95E7C70FA8DE4712EC2C5EEA
+000001291E2353BFE15675147F59056796C706E19DB5FAC6E0FBBF2DC94E44D5FDF836A88F4C01CCB331B885219D351D712C85D482808741A86075B6DAEB89F3125D96F2
+000000A61CFC5E74930F4F96060022C19C2B6AA414DE9D9CDB972A902E507ABC48A0A16DF6669D5E45B99C602F2D1D1FCA29D9DCBDF6674011C4625E466E6812E954C9B8
+0
+0918EEAF76F649714C3FDC3CF28B3157B49DF617FC2B2888F814B610A6E29C32204294CCD94F1F13F1F5DF40CE102D54D4BDC02A9EF28F8E1DC183F5F331DFF2
+64
+ecdsa_verify_stream_sha256 506
+000000B33AEE06DA56CBBD1AAA2AA25A34AFFEA5089F40D491F51A7CEBAFFE92571C46D0EECB9C5E553C756EBD8E94561B5B915F090E36743E17FF9B5E3A84BF40208859
+000000E7E3A737F911FE5ECB9A6AED4AA0CCBF4413FBB8B36AEC9A4D8309F5E11303BDCDFAB64376E1B251BC3CE4A1ACD8AA7B4A912245A202EB4DBB86E6163BC11D656D
+0918EEAF76F649714C3FDC3CF28B3157B49DF617FC2B2888F814B610A6E29C32204294CCD94F1F13F1F5DF40CE102D54D4BDC02A9EF28F8E1DC183F5F331DFF2
+64
+000001291E2353BFE15675147F59056796C706E19DB5FAC6E0FBBF2DC94E44D5FDF836A88F4C01CCB331B885219D351D712C85D482808741A86075B6DAEB89F3125D96F2
+000000A61CFC5E74930F4F96060022C19C2B6AA414DE9D9CDB972A902E507ABC48A0A16DF6669D5E45B99C602F2D1D1FCA29D9DCBDF6674011C4625E466E6812E954C9B8
+0
+1
+ecdsa_verify_stream_sha256 507
+000000B33AEE06DA56CBBD1AAA2AA25A34AFFEA5089F40D491F51A7CEBAFFE92571C46D0EECB9C5E553C756EBD8E94561B5B915F090E36743E17FF9B5E3A84BF40208859
+000000E7E3A737F911FE5ECB9A6AED4AA0CCBF4413FBB8B36AEC9A4D8309F5E11303BDCDFAB64376E1B251BC3CE4A1ACD8AA7B4A912245A202EB4DBB86E6163BC11D656D
+0818EEAF76F649714C3FDC3CF28B3157B49DF617FC2B2888F814B610A6E29C32204294CCD94F1F13F1F5DF40CE102D54D4BDC02A9EF28F8E1DC183F5F331DFF2
+64
+000001291E2353BFE15675147F59056796C706E19DB5FAC6E0FBBF2DC94E44D5FDF836A88F4C01CCB331B885219D351D712C85D482808741A86075B6DAEB89F3125D96F2
+000000A61CFC5E74930F4F96060022C19C2B6AA414DE9D9CDB972A902E507ABC48A0A16DF6669D5E45B99C602F2D1D1FCA29D9DCBDF6674011C4625E466E6812E954C9B8
+0
+0
+ecdsa_sign_stream_sha256 508
+0000002F16929C1B5DC3BBC9A73209DC113E3E6A68DDE07CD06FFDCA1439FF39A8BE05E4AC3E208C2A0C7CF799D5F303D47F8C21C052268B76B4023E8320BB51586F6B08
+000001AC511DEA8E39203DE0D6463F2974A245C402572DDB129D7D19A67D47299D49BE06858530FFE8129FAC64FC2ADDAD5282E8F38C193071B590F3777567A55810DB07
+000001AF94F8874025F656590192BC6A092F4457394158ABC6D3B917448127ECFAE89F615EB043B543C2148E959A13FCD3640CAE6541D00B7A39F47659B48569240269DB
+0
+EEB405D13D4BB634BC7D5E605CFF3EFDE186333203B1962FE36C235C4F79DF36BBE04CD2DA10F07161CA00B9303EAE9421F84C8C2C7D1EEDB6B60EE90B4AA2BC33
+64
+ecdsa_verify_stream_sha256 509
+000001ABF8716D9A0BC8E1D342F01339951F452A1DE4FA10B09E9B8B785DD400C0650FB67A23F036CC3E50D7C8C74A2A355F883F251519B828C9E75885FD97741CDD75DE
+000001A396526E5C05712A9EF70F440A576CCFF3A0A7BF336481B11BEBA35EE4D44ED988507284219011A511D485444B649A7395A09CA162249DB82932D17A3BF6E7733C
+EEB405D13D4BB634BC7D5E605CFF3EFDE186333203B1962FE36C235C4F79DF36BBE04CD2DA10F07161CA00B9303EAE9421F84C8C2C7D1EEDB6B60EE90B4AA2BC33
+64
+000001AC511DEA8E39203DE0D6463F2974A245C402572DDB129D7D19A67D47299D49BE06858530FFE8129FAC64FC2ADDAD5282E8F38C193071B590F3777567A55810DB07
+000001AF94F8874025F656590192BC6A092F4457394158ABC6D3B917448127ECFAE89F615EB043B543C2148E959A13FCD3640CAE6541D00B7A39F47659B48569240269DB
+0
+1
+ecdsa_verify_stream_sha256 510
+000001ABF8716D9A0BC8E1D342F01339951F452A1DE4FA10B09E9B8B785DD400C0650FB67A23F036CC3E50D7C8C74A2A355F883F251519B828C9E75885FD97741CDD75DE
+000001A396526E5C05712A9EF70F440A576CCFF3A0A7BF336481B11BEBA35EE4D44ED988507284219011A511D485444B649A7395A09CA162249DB82932D17A3BF6E7733C
+EFB405D13D4BB634BC7D5E605CFF3EFDE186333203B1962FE36C235C4F79DF36BBE04CD2DA10F07161CA00B9303EAE9421F84C8C2C7D1EEDB6B60EE90B4AA2BC33
+64
+000001AC511DEA8E39203DE0D6463F2974A245C402572DDB129D7D19A67D47299D49BE06858530FFE8129FAC64FC2ADDAD5282E8F38C193071B590F3777567A55810DB07
+000001AF94F8874025F656590192BC6A092F4457394158ABC6D3B917448127ECFAE89F615EB043B543C2148E959A13FCD3640CAE6541D00B7A39F47659B48569240269DB
+0
+0
+ecdsa_sign_stream_sha256 511
+000001EA62888230D3B5BA9830DCE4879C63018CDF794452B9AB4E5A91E95DB852F541A1685127D34C2DC40F6F6CEF385352F5E6BC860E33F959DEF31D028FFF40FD8E69
+0000017BD15D30327785388E24F81F1C9645BEB267FC0638BD88E450C43C9244E27FD292C032E248A00B785B725C5CA25BE737736BB141325D654D8216E5976EFE01F260
+0000010F2E2EF701BC5DEEA91A2A9EB5211B5FD36510F820BA47A8879A6FE0D88CAEFFB1F182D295A99CFC90718CC555601A984F2856A68117A63DA5C7DC7F4704961E2B
+0
+583346BF4E272A558836159C8874C567F0574404565A6A1914F037BEC8798B34DD77CF2EAEE8FB68ABBF8269422787C4FB753308044EA7C076752DAAFB3CB0D6FF3BBB32842C6A158041842A3548473DEA5937FC74D20674B15F0BAC6242B5237F2A4C58BB128B92DA1C5B295D67A2E8533AEA3967DFB2
+13
+ecdsa_verify_stream_sha256 512
+000000DA81B732674B1F4FCFAD1D11B5FD0B03290F8AECFBC3D7054DE0DD677D44FB68A71BAFA6D0CF1EB1BC5609BE608B76807BA9965C5BF27B28B459D5139056BA66A3
+000000E5A522566739362526DAA5C41553C642D4399FEB5E9961A5DDEC8EA772995165A6A6090332A38D33E684A3F7ADDD82E23B5BB478ED4B7A09184FC3409A5C627D1C
+583346BF4E272A558836159C8874C567F0574404565A6A1914F037BEC8798B34DD77CF2EAEE8FB68ABBF8269422787C4FB753308044EA7C076752DAAFB3CB0D6FF3BBB32842C6A158041842A3548473DEA5937FC74D20674B15F0BAC6242B5237F2A4C58BB128B92DA1C5B295D67A2E8533AEA3967DFB2
+13
+0000017BD15D30327785388E24F81F1C9645BEB267FC0638BD88E450C43C9244E27FD292C032E248A00B785B725C5CA25BE737736BB141325D654D8216E5976EFE01F260
+0000010F2E2EF701BC5DEEA91A2A9EB5211B5FD36510F820BA47A8879A6FE0D88CAEFFB1F182D295A99CFC90718CC555601A984F2856A68117A63DA5C7DC7F4704961E2B
+0
+1
+ecdsa_verify_stream_sha256 513
+000000DA81B732674B1F4FCFAD1D11B5FD0B03290F8AECFBC3D7054DE0DD677D44FB68A71BAFA6D0CF1EB1BC5609BE608B76807BA9965C5BF27B28B459D5139056BA66A3
+000000E5A522566739362526DAA5C41553C642D4399FEB5E9961A5DDEC8EA772995165A6A6090332A38D33E684A3F7ADDD82E23B5BB478ED4B7A09184FC3409A5C627D1C
+593346BF4E272A558836159C8874C567F0574404565A6A1914F037BEC8798B34DD77CF2EAEE8FB68ABBF8269422787C4FB753308044EA7C076752DAAFB3CB0D6FF3BBB32842C6A158041842A3548473DEA5937FC74D20674B15F0BAC6242B5237F2A4C58BB128B92DA1C5B295D67A2E8533AEA3967DFB2
+13
+0000017BD15D30327785388E24F81F1C9645BEB267FC0638BD88E450C43C9244E27FD292C032E248A00B785B725C5CA25BE737736BB141325D654D8216E5976EFE01F260
+0000010F2E2EF701BC5DEEA91A2A9EB5211B5FD36510F820BA47A8879A6FE0D88CAEFFB1F182D295A99CFC90718CC555601A984F2856A68117A63DA5C7DC7F4704961E2B
+0
+0
+ecdsa_sign_stream_sha256 514
+0000013E41DAFBE30347BB1383F851F6691556ED5E807154AD2DDFDE6F5408EC52F882A1A6EB0F7DF6C3269533EA4E371E6479616D279BC37EAD493AD725C5A10AA46903
+00000170A6C1CE38B028260B9164717E091CC55065D65494015ABF41D09DFFE6806E19D4DC820EBD025EA8470BAAD916BC5727D6CE284CF0789A45702136702BCD137EBD
+000000A774281AB122C5D450CACE33865B0D2CEAB2544BBBE3BA411184F8D13BBF8FFC236A040BB06EDB1B7508D964EFCD826C13CB47F85AB0BF8AF93B68825BF22D515A
+0
+9FB04D1775E1E9A3666D5D74A63DB9CF71543C72B7DF2772C182C99B392413E4E4FDF26455279321484912865BD4B1E9AC1BCC17823DE24037749803108157FF61EAFEC0C02FE80C29BABF40F5635802E66D865BDB3E6E6DE4697ED46CC82C93606C4DE3DEC61428869086BB431D78E6353E82629D0E2A59E31EC8820CE894AB62895AFA6B44B0DFE9B3C416C7650904AF98D9CFAB56F24A37A9EEE23CEBF811C78AF0C1BE54978BA7EBE8A6D4392656DCB25AA2B48C82721615DEB4AD5791821D7EDB6547969622
+1
+ecdsa_verify_stream_sha256 515
+000000EA55612146E5CD5373575B931C7AC514AE641E30FFF8B70FCBB2F4DF70D3D27B3326AAEED472BFB9E6EA9269DC3107D11FD90A12F85C65A0EAD82765A7C3269858
+00000180EF24428DC4BD1657E6323DD4A5540731A4F48A4FA52955F9572C41AED9126165083A185C8B826061E046285BF9FD5A6FF317ABC24D63601FEDC392E447EF78F1
+9FB04D1775E1E9A3666D5D74A63DB9CF71543C72B7DF2772C182C99B392413E4E4FDF26455279321484912865BD4B1E9AC1BCC17823DE24037749803108157FF61EAFEC0C02FE80C29BABF40F5635802E66D865BDB3E6E6DE4697ED46CC82C93606C4DE3DEC61428869086BB431D78E6353E82629D0E2A59E31EC8820CE894AB62895AFA6B44B0DFE9B3C416C7650904AF98D9CFAB56F24A37A9EEE23CEBF811C78AF0C1BE54978BA7EBE8A6D4392656DCB25AA2B48C82721615DEB4AD5791821D7EDB6547969622
+1
+00000170A6C1CE38B028260B9164717E091CC55065D65494015ABF41D09DFFE6806E19D4DC820EBD025EA8470BAAD916BC5727D6CE284CF0789A45702136702BCD137EBD
+000000A774281AB122C5D450CACE33865B0D2CEAB2544BBBE3BA411184F8D13BBF8FFC236A040BB06EDB1B7508D964EFCD826C13CB47F85AB0BF8AF93B68825BF22D515A
+0
+1
+ecdsa_verify_stream_sha256 516
+000000EA55612146E5CD5373575B931C7AC514AE641E30FFF8B70FCBB2F4DF70D3D27B3326AAEED472BFB9E6EA9269DC3107D11FD90A12F85C65A0EAD82765A7C3269858
+00000180EF24428DC4BD1657E6323DD4A5540731A4F48A4FA52955F9572C41AED9126165083A185C8B826061E046285BF9FD5A6FF317ABC24D63601FEDC392E447EF78F1
+9EB04D1775E1E9A3666D5D74A63DB9CF71543C72B7DF2772C182C99B392413E4E4FDF26455279321484912865BD4B1E9AC1BCC17823DE24037749803108157FF61EAFEC0C02FE80C29BABF40F5635802E66D865BDB3E6E6DE4697ED46CC82C93606C4DE3DEC61428869086BB431D78E6353E82629D0E2A59E31EC8820CE894AB62895AFA6B44B0DFE9B3C416C7650904AF98D9CFAB56F24A37A9EEE23CEBF811C78AF0C1BE54978BA7EBE8A6D4392656DCB25AA2B48C82721615DEB4AD5791821D7EDB6547969622
+1
+00000170A6C1CE38B028260B9164717E091CC55065D65494015ABF41D09DFFE6806E19D4DC820EBD025EA8470BAAD916BC5727D6CE284CF0789A45702136702BCD137EBD
+000000A774281AB122C5D450CACE33865B0D2CEAB2544BBBE3BA411184F8D13BBF8FFC236A040BB06EDB1B7508D964EFCD826C13CB47F85AB0BF8AF93B68825BF22D515A
+0
+0
+ecdsa_sign_stream_sha256 517
+0000000FCE6C5BB973F1106550EF5AE324F7AC239D3D41862143E32131386976368D00B11870776474C2A40E34E73385C2F14A2766926463CD0C97DBD602F23A34CE53E9
+000000FFA528553D2B632B10D9F8B9F331E51975ECBC3F713C1FEF96441ACFE04A2E0F090A0C539104BE64291FC89474D653C194643903AEF1FDA5068CA826F3FFB553F1
+0000011452D4FE11DAF4F18A0489FB92FEC763C23D2F28C789FC75E37BE6BEFD2CF5204EB93C6B435AF11FDF95E35AA2E21DB53C24EFF27ED80B0020ECC1D673C439C588
+0
+14C20E760ECE16F1D58ABE0AD58FC8AE0820FCC22EB08DCE18F41C44F3303AB9FD3BA5439FCB4886BE6AA4FDAEAC1300CCE818C03C58A6B1483E11B5F00F96F29FD30A6DAB32A0BBE87773BA4CB516E90E57B3032D3DE40F3BB8AB35FA2E736EFF03F74AA71AFE0BF3E9522BD4136D4D324AB6B20EAD4401692D00FB4833CAB85A658E9232336C76D1D51A62445A92C8C6AAB65DB130728D59E5C2B4C76B19E7EB95F286A1F6B6CB263F74B2CE7BDB4C388737ED2E5EAA50C89DA54C684BBF632B90C5924F56E76076EE1F763813E79CD28B73E7DE1E5EDDA46882D436881628BE57FCE0296BD9F9A9E9DF8A8B4B5B2A615477E97EC4FA0CDA39F23193AD4C2C280B77A641BF0925B8B99BB74FA2D4CA26C494B39AC66A8A19F064B50E7632B3D2C44D6AA9B82343ACEB7F163B68340AAD0F0316249DE81F04197150EDE4AA0AE2198F9AD285AB455EB60A83C63348BA298E6F032801434C00FC537B673EC4A17F6F5A7690F8C646D90F0C5BC5FC9D0F87C04113486B4C7D532794445C9DA9E1D0505442DE66CF0BDCB622ED062C89
+100
+ecdsa_verify_stream_sha256 518
+00000114C25D8B56C1127ADD995D1049B4387363FE458809A069E454E09D6DA7FC9F97D7B7023502648867CCDEB77C76D8F8FAA1E8988ADEDDBE3DD4F2903277C658485E
+0000016FCA4854E3DE18C5D22D10C54B2FCD09E8C2E5E5A63F8DA0CA08C24CB584F06161092A920001BD752E060F8D1F41ACB315B8329BB984D7B86B33923542213048E0
+14C20E760ECE16F1D58ABE0AD58FC8AE0820FCC22EB08DCE18F41C44F3303AB9FD3BA5439FCB4886BE6AA4FDAEAC1300CCE818C03C58A6B1483E11B5F00F96F29FD30A6DAB32A0BBE87773BA4CB516E90E57B3032D3DE40F3BB8AB35FA2E736EFF03F74AA71AFE0BF3E9522BD4136D4D324AB6B20EAD4401692D00FB4833CAB85A658E9232336C76D1D51A62445A92C8C6AAB65DB130728D59E5C2B4C76B19E7EB95F286A1F6B6CB263F74B2CE7BDB4C388737ED2E5EAA50C89DA54C684BBF632B90C5924F56E76076EE1F763813E79CD28B73E7DE1E5EDDA46882D436881628BE57FCE0296BD9F9A9E9DF8A8B4B5B2A615477E97EC4FA0CDA39F23193AD4C2C280B77A641BF0925B8B99BB74FA2D4CA26C494B39AC66A8A19F064B50E7632B3D2C44D6AA9B82343ACEB7F163B68340AAD0F0316249DE81F04197150EDE4AA0AE2198F9AD285AB455EB60A83C63348BA298E6F032801434C00FC537B673EC4A17F6F5A7690F8C646D90F0C5BC5FC9D0F87C04113486B4C7D532794445C9DA9E1D0505442DE66CF0BDCB622ED062C89
+100
+000000FFA528553D2B632B10D9F8B9F331E51975ECBC3F713C1FEF96441ACFE04A2E0F090A0C539104BE64291FC89474D653C194643903AEF1FDA5068CA826F3FFB553F1
+0000011452D4FE11DAF4F18A0489FB92FEC763C23D2F28C789FC75E37BE6BEFD2CF5204EB93C6B435AF11FDF95E35AA2E21DB53C24EFF27ED80B0020ECC1D673C439C588
+0
+1
+ecdsa_verify_stream_sha256 519
+00000114C25D8B56C1127ADD995D1049B4387363FE458809A069E454E09D6DA7FC9F97D7B7023502648867CCDEB77C76D8F8FAA1E8988ADEDDBE3DD4F2903277C658485E
+0000016FCA4854E3DE18C5D22D10C54B2FCD09E8C2E5E5A63F8DA0CA08C24CB584F06161092A920001BD752E060F8D1F41ACB315B8329BB984D7B86B33923542213048E0
+15C20E760ECE16F1D58ABE0AD58FC8AE0820FCC22EB08DCE18F41C44F3303AB9FD3BA5439FCB4886BE6AA4FDAEAC1300CCE818C03C58A6B1483E11B5F00F96F29FD30A6DAB32A0BBE87773BA4CB516E90E57B3032D3DE40F3BB8AB35FA2E736EFF03F74AA71AFE0BF3E9522BD4136D4D324AB6B20EAD4401692D00FB4833CAB85A658E9232336C76D1D51A62445A92C8C6AAB65DB130728D59E5C2B4C76B19E7EB95F286A1F6B6CB263F74B2CE7BDB4C388737ED2E5EAA50C89DA54C684BBF632B90C5924F56E76076EE1F763813E79CD28B73E7DE1E5EDDA46882D436881628BE57FCE0296BD9F9A9E9DF8A8B4B5B2A615477E97EC4FA0CDA39F23193AD4C2C280B77A641BF0925B8B99BB74FA2D4CA26C494B39AC66A8A19F064B50E7632B3D2C44D6AA9B82343ACEB7F163B68340AAD0F0316249DE81F04197150EDE4AA0AE2198F9AD285AB455EB60A83C63348BA298E6F032801434C00FC537B673EC4A17F6F5A7690F8C646D90F0C5BC5FC9D0F87C04113486B4C7D532794445C9DA9E1D0505442DE66CF0BDCB622ED062C89
+100
+000000FFA528553D2B632B10D9F8B9F331E51975ECBC3F713C1FEF96441ACFE04A2E0F090A0C539104BE64291FC89474D653C194643903AEF1FDA5068CA826F3FFB553F1
+0000011452D4FE11DAF4F18A0489FB92FEC763C23D2F28C789FC75E37BE6BEFD2CF5204EB93C6B435AF11FDF95E35AA2E21DB53C24EFF27ED80B0020ECC1D673C439C588
+0
+0
+ecdsa_sign_stream_sha256 520
+000001B18BEC9C81923DFA5AE0872CEB522B006A8784B55198228640FA980CA0D5B247C84112B641F37BCBC7DFC1F1C587FF696782835CB6CABEA9993A27BAFCAC82CEA7
+0000014F44763585DA45B01D9958B911D0ECE66D0B11E8B8E88AF28E97E832A2775F2DF49DE0A4A8C67129907503BCB189C4A05DB3EC748F5E71B6CE29C816784A561BE6
+000001C81D9D0B1B2647F78F43FD0BF1B2AA21F7237AB87D0D0274D5C96098655C1DED9C461E623D4CA51EB9F711E1F9F21A3889C8EC01E3CF56435C6E0B7459E219DFC9
+0
+0390C96E0C5B7C772153CC31176B75666ED621B3DB728276B5D4FBB2E1759609B687A8635887049B4BB91E5D2AAA55B3EE6849C5FAE1B9E252FA055BF39E3837D2CB858814A5D4C5147FBC937DF34634AE5E1FAEADDBC8B7F6F2EE952673A3D480C1A43FF94A416AB3FB80037D54C2AB9CF2F66C47C6E928BCAD9D2383B3EAA9
+400
+ecdsa_verify_stream_sha256 521
+00000073BE9FEAC418808C6A5B3EF88C90F897FFF3C4D4230E9E8B494DEA4F1DBEE7A65275EB657D798C241282FE091E66EA8DC2A1687B2D7285B274A5D48B642E92BDF4
+000001240819D2A598D0D0875CB31CFE27CEF153E6BE0BC8B8B856FC0384CFE588A3744ADBC21413E32BE5F3DAC7C680DC3786D9F8B5C6168CA8E337310F3EAECA43E6A5
+0390C96E0C5B7C772153CC31176B75666ED621B3DB728276B5D4FBB2E1759609B687A8635887049B4BB91E5D2AAA55B3EE6849C5FAE1B9E252FA055BF39E3837D2CB858814A5D4C5147FBC937DF34634AE5E1FAEADDBC8B7F6F2EE952673A3D480C1A43FF94A416AB3FB80037D54C2AB9CF2F66C47C6E928BCAD9D2383B3EAA9
+400
+0000014F44763585DA45B01D9958B911D0ECE66D0B11E8B8E88AF28E97E832A2775F2DF49DE0A4A8C67129907503BCB189C4A05DB3EC748F5E71B6CE29C816784A561BE6
+000001C81D9D0B1B2647F78F43FD0BF1B2AA21F7237AB87D0D0274D5C96098655C1DED9C461E623D4CA51EB9F711E1F9F21A3889C8EC01E3CF56435C6E0B7459E219DFC9
+0
+1
+ecdsa_verify_stream_sha256 522
+00000073BE9FEAC418808C6A5B3EF88C90F897FFF3C4D4230E9E8B494DEA4F1DBEE7A65275EB657D798C241282FE091E66EA8DC2A1687B2D7285B274A5D48B642E92BDF4
+000001240819D2A598D0D0875CB31CFE27CEF153E6BE0BC8B8B856FC0384CFE588A3744ADBC21413E32BE5F3DAC7C680DC3786D9F8B5C6168CA8E337310F3EAECA43E6A5
+0290C96E0C5B7C772153CC31176B75666ED621B3DB728276B5D4FBB2E1759609B687A8635887049B4BB91E5D2AAA55B3EE6849C5FAE1B9E252FA055BF39E3837D2CB858814A5D4C5147FBC937DF34634AE5E1FAEADDBC8B7F6F2EE952673A3D480C1A43FF94A416AB3FB80037D54C2AB9CF2F66C47C6E928BCAD9D2383B3EAA9
+400
+0000014F44763585DA45B01D9958B911D0ECE66D0B11E8B8E88AF28E97E832A2775F2DF49DE0A4A8C67129907503BCB189C4A05DB3EC748F5E71B6CE29C816784A561BE6
+000001C81D9D0B1B2647F78F43FD0BF1B2AA21F7237AB87D0D0274D5C96098655C1DED9C461E623D4CA51EB9F711E1F9F21A3889C8EC01E3CF56435C6E0B7459E219DFC9
+0
+0
+ecdsa_is_valid_batch 523
+1
+000000A18F8F33E3A125D20E731505A3ADF6B1F3FD29040039C895612295F312085291CBCD26923A254D096F628DA1A86341A35C393151DBD04F9997949683EF4D080739
+0000001C76BE1B7DD86015FC275881151A91F1C2FC96DA5A87D44EE543C5874CC2B9EACFFCB25EF31B5FEBF00270C05A7E6F70073CE142EFB0DA69D763023ABE20AFCEBF
+0000011158F5ADFA2A495FCEDBF61C358961468EA9689FDC3AB76364B7128910E85E02A5E4CE0DB543AE1BF86885789FE6D2DE7961488A80859D134E7F061E5653CF5C50
+00000150A2D4215ACE05B380E116162F15BFFD72ED215BBA992D663C0628646C9850E6604937F3E85759A72F6386B0DA5F6655CE1BB27A01FE93406D5F3116758D8C9F40
+000000736068571590400A101D61F3B69F379483FF41D831B188C42B25A44BDE22491AC89DEA43AB49D16E8623058CD6E4E2FE296C04A9ECED10EC7432B8D59BB9DD2F9D
+0
+1
+1
+ecdsa_is_valid_batch 524
+5
+000001D8E55F90D3AB4EDC5DD64F40C03980140BA5ED86AE82C41A0596B29D4BDD63154A4536296505564AE283A4AB565317EC694F37AF5D6E315EE61309C1BDC2050E4F
+0000000F09B3960B551C070EED94E0B473E3188A31A18F6B18B7224AEE09A3975886BD5289E987E19B95D7B3D1151E490B46CE1BDFDFB68E62785FF7D6C85D2D823D9112
+000001B522DDF559ED4708530AD8D6132A553F808A37E707E5B373CFD82ED8B2955EFA79374368B96854D2AA4361C9B5AABD3E1ADE827C3ED8A11287A5058F24EFB1E37E
+00000133A3346D392D62AB74670987A88F12438E36028144D18332259A24814FA74AAA04ED3B481CD214F9E47D712D80833BCD7AD9AA2D5ACC721ADAA17CA9D5768367C2
+00000195999D5C00429DA2B346E8172084080DABDBF5963852A08F22C6695D65AEBDF8A38F38D9A02864A3B06398B54E432CDBA6CCE12C351C48D4B83963D9AC4F1EBAF6
+0
+1
+00000169A49D50AD328273F71311278CEDAE1A01E2EA4915F9CB762B9225CF23A28E4F8350FDB7744E0EB72CE0550B935D9A8F01BF0B014A90EB6A2739A742B8DE7F6D09
+0000015187C856777168A5E306B7053DE5293078A0C1DB09049492A684ED12E8DE223487FAB695A4D46AB86D4BE145CAF17B591DBAD0EE9E44542D23D3C6187DD566CA1B
+0000009FD4D578310AE22AD002C0CD51E3CCD97FBD35EA45F2FDC0DF3E4366B1BA2AFFC3F2207E0C9B632D3498EB99E384348EC599099CF0FE71DD3B01B7FF9B3060A829
+000001127FD968A75F18ACBA14BE60F0AB3DC0C3DEB879E5B1669D340D89858E05C48F32AB3F3BB9B906FC55B5FA4D610B030D60DA51F185676BE1844768398A08571B9C
+0000003584A1CA446A5AF9E25D9F5128623E5FE4A9EEAC932114F96A3222E9844E3AB697DDCE872C314A879A437AD44BCCACB6A5F4CD5C2912BFBEFDF698CDF8EF2A2AC3
+0
+0
+00000016B9535BD47CCA8F7E56A5FB38C12F27F3485ECEE73E875C14D1C6EF9259180399CAC1E4FAB06174D1290169D854267EB90064B3CE3038F0CF8E972514C8DE2BA6
+00000086BF0E3AF831CB2EBA266750DD3D822A6E418648EF2585B5B43F7AEDC37C80D7E215AA1A44FFAC8B362E051747379441746DA883B7CDE24F4740EB9728E3716902
+000000E10076A0C634D7F438D757A3174FACD7BADFEAF68E0236B94C512569356E16EB0635160D1FE78F3B4A5BE4E8A8333E94F7615F3220F524C8BE363A123EE671E019
+000000F474C9855C874CAF99FC22E8CE32AB71B712C28F79B5247B474CE0700988845EC61BD31FEDF0010E425AF050DF7A64D4ABD46D4C959E22F05CC98D664B2C96D225
+000000DF9D81D1DA25704B7CA8C695E9CE0CA4AC621E8142122440B8CB61C6FD51374550DDE28DE92004265A2E30E52D98B3F81AC0B00228749A8FF95EDC2F1F01B671E3
+0
+1
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000003926ED0065B875F78CEA181C77953C886AF4F01BDC0A362E37F5EC3A28A2319C0D4B03B5A37304F338BDF31C4463621B107C18831388AA303E6E689E0C5720D6C5
+00000054C4A5AF583B2F4AFD93434AAD89E9BB278D1E7EA1885931975146E103FCD3F79FE565A8B8B5D624E2F69ED2458168559C35838A3F004BA29A9288F41F1370C739
+000001C2CD92A7EE53BFAAE2F36ECF369FFE0F4C98A9F0104237F7CD32BC1E0CE97923FAD5A92CD0531B852322BCA21A9BA306D253F6F6A35493EFC412983B15490CB835
+0000001610C820E6081F9F9D639CECA2533827C399A7A5D031123DF7650AA0887E3B4981E02E931FBE8BC1A3F40F7ADC6357ACDA4C569E3A432C1A4E5E97A6E7F6DF7AE0
+0
+0
+000000F384A3E8AC387C57F772029729715C916E4F67B5DEC42B8E800F232BAB3400EED1BBD075623DA998709DD62AFE3EDB3F0AD42EA32CF0B86F770AC3CBD5C7A55D0F
+00000141040FE05C51AE1783610E25B97BA6928C0750CF577783F7314239DE0F8B23BE669468DC30FC223FE5DD2C3B22522939B6784484BEB7A6C1EA18014A84410AF34A
+000000ACB339BF96CAEBCD726AEAFA1C2B7109D2AE37FF3925A8A769E3E82B641BF7F8B68136A512B7E3729CDBA7667192D06765A59E414E05A362758F2A7641752E6D4E
+00000138903A42C490FF18446CB3EF617A29F0B7EB8D544E42594253C1CD570546508C808DC41F9E5D71AE8A599495DB5CB87A8980F5B55A85273BBBFC9AA32F4C0C3897
+00000178A92E774F2085E0BBAE111F8AF6BE1FECD0E98AA5FD50BCE6DA006D7CE20E6849C485222832ECDD1D7C5B1788392BB08F2AA1EE59BBEFAEB8F3A0963D6CF4E8DC
+0
+1
+3
+ecdsa_is_valid_batch 525
+3
+000000B286FF947AC05897CDA7649721356FA6782109FB999248858B14F4F22091721CAA262804BABE247F5238C6A35AA14A26EEF77D7BEFF12386A59CA5B5F4771755A6
+0000014A3402350C8A4874244252062E5A04B4057713A9707E485943449D13D08F8F601BCC75DE92417C589FC31CCBDFDCECFBCFB179C508A80BCE2518E1DF0AAFEC19D9
+00000110ED83E35DAC34BE1D0CD2AEAECFA3D3ED8F369CE697AC0F1C49C4ED57DE6D794BD428C25D62EC727F9644410710B65784C325AD1AC3C659E4E97123091482FEB1
+00000103458891DF8CF2859BD6106AE8CFDCA73E5634CCDC86F73DF0E52911BEF75C4EF11E348E4DBC1377D4B27951FC23CD741C196FF5995C7A30BE3D1D514C6975C922
+000001C186D3288D4BF7CF08251EA039DC5FC492DEA57C5ACFF91A21319AD10974A8150AAF97A13FF04CE42504D0DEC81825CEDDEBAD93821B6EF6FD7D87BE2296CA17C4
+0
+0
+000001B78304C15A1CFDD36BA34B27DB3595D81206AB5B13D005043C1CCDAFD11CD64EB798DD7D361D76AFBA4400E1875C74B159F9CC0E24DC338480A4E28830E2D41D25
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFA51868783BF2F966B7FCC0148F709A5D03BB5C9B8899C47AEBB6FB71E91386409
+000000476B659477162DE6C75A6958AD957C2E6119F458AC59B949214356631CC9EDEFF92026D09F3088B5A2CCC55E7174EA50D0D11FF6BC40F1632884EE0708D9E0418C
+000001A3832FFAC59B2E36C1482167E94191FDB252E233FB9CCC5021776A107CF4679E5771A13F917022AD6B26773E1B59E3DF57A9C700676CDAD5910539C139330E5DA4
+000000806EBC247B593B6838FF8A1E7F271BCA0B16EDFD0BC28F2CFB3382C93207CF9D26F5AA44370A6139AAAD04FB5A2934586D1000648411B5924F5D22039BB1A41CAF
+0
+0
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000000196A9B9A57F893C90427E48C57B39A9977A0ED89BC227F6C297C7B5FFBF4404F724FC7E4CC87430B791CC339EDB022EA2274C22480FD849EAC40F7D76705AE2454
+0000019C282862F3CAB0DDA8B0DF8C6AF9F0040C57FB397A30A9B1596A23756681A90267A90D478BADE8DFA1D0AEEED7098D4B2BB8F7CFEA934CB30F19E1ADDA9A917D7A
+000001480B8402D477306A36AD61BA6C0AB46925334231ED56D0101FA15BA33DC015818F853B0480DE947D45279D060511C18EA6CA8C0302426D120C8739547D550E6B0E
+000001B60514F1547856C0F52A08CB6AC0F6834EDD5BD1AC6D6FE968976A09B46001890154B620509C5B01C6B9368B863B2FF85D016FD40A14FE779E0892292805012CC3
+0
+0
+0
+ecdsa_is_valid_batch 526
+20
+000000D04917671CFB0D1186EECEA538DCAD0EB418A13120CF8E3927276726B1031AF9C6C3F898F99BF3D469CB891FA7714B37DC75F1C5DD07145A482E596196ED17114B
+000001439D2302AC58128C7D01112203B70EF37616D41ABC1E73BCAB9C6A1522B3DD44A27FCAA4D5F03DEA637DF0C6DA109F2C22AD7131C606E01EB249C4DF561811DFFE
+0000002E4C5FB465DC1364E02BF86562741012054F3A89968FDEFD26B259920BA514BD504CC6A121FBF881060537E1B2F46A31549E78177AE86FEFBF865AB9992B1FB372
+000001D8AC8D8B40859EC43424725DF2E7C33BFFDF026ADD72F8BD3120FD8F3104F5C8B6C7C4D292CD5FBCA29367A7BA8A07F5DCEEE677FD71B3A6CEBA4E004609B00561
+00000110EBFC85F00BED0B58B3B0EE916777D260A049EEA2C899F66E58E67878A6AAFEFCF87A7B34CDD85B55E58030534ACEC8FD55BB1ADDEC04D5596411BB80AE52DC2F
+0
+1
+000001235C2FD141605C1F275F8C21A7F4D29236D18086F3EEF323B7500090B1BF6CE3342416A4CA23D4EC6389335CFC1B70951BBA551D2C7F783A25B36CE8B2789EDCEA
+000001F1696429E8E7D9E26CD2D25DE688A55A89CF155EAB1AC7A7E6A0A2DDC7543FACC2AB2871631E3B1C25304A767BD33BEF0B7070ABFCEC86D0FF4CE251CE24D299F8
+000000E01E3D3D0A87FE940A675A1C70907C6D83A4C31C3A029FCAF9C11D529988C5738A34DE9ED581E38DDE62BCEEFDD0EC6C1925253A46CF25441D952F09994202BD15
+0000017C11A84BA97357FD883C90CA8A0BCCD470BAD06C43C793DB7F5C81E98F4E9E45BA870737F2FEB2195017794FF1FB0260F681484C1F025C1DE8D5A3AE67FD083DF0
+0000004D3BCB45134E2C1F7F65904BE96F2366D522A87334C90207B0CD6CF2DB674EBAD6276569119A6D7B2D90B9E35488DF698A220D286DA449FD9BB0C859CF50AD4DB4
+0
+1
+0000013E187243CD9ADE9C0656D6119B3592B24C6711AA97B8045DC54112CA4491AF5226FA4A5A734247A921D948D5E38D2AD8F3B12B8C9FA81E3E7A98127B62B3B2736A
+0000012543C500977F9FFD09112DEB2943CAA50DE54A892E1CE64DEC19C6EA10CDD1195DE23FB7F6F23857F153C12C1D86FCCB3BFBD67F94447BB8948D691FE30860CCEA
+0000017798F507F42F375A4DCF1C4B05225F1E725B17692CA2F6D325BE952B9BE785E4F609D0ABA9F494B99F19AE8D5705190743E3891D49050BC54E8AAA35E12D91B848
+000001E6B75CC4288D3991307AA00FC140DF9A9BBCC8EE58971362A8AD7CC280EEFE090D3283480DD28CE0322A12BF72988E228FBFC72AC24284E71D05C156161B6A85C4
+00000056F5C1C4400ACD768AEC60E788F65B14E8F47EE0718D26B81940515E90FF8DF219A036637435BD72DFE33DC49E17D707AA22D77D2B73C616BE64F323FEA52D6027
+0
+1
+00000131297B11AE5EA842A2AC6B26E9B60AF0A0B58CF1674BC51478F99B1B9CFFB035F202DBA6A1F8C7E1498C642A82925807209D187A8DFD90FB4EA0D5B5E635406294
+000001D841D21F472A7499043722AE35FDE52F425CF3249AEE2403A7609F480DE83997BB83629FF666CB86CE8DD3A49468DE884C6EE53DC680202EA8B1F6EBFB51855A40
+00000120E1CD765452E8B4EA714B426A26AF8F176492B26227EC7C19AE0445635FE4C7EB405BF58F003437449A1D6412D21C4CD6CA7A3AC0AC85CA3A0CD17261AE74771D
+00000186695687992619440986E8F73C244E5BA4FB39171D9291FDE56D18546D9B42F747F99C0E0ACCBE6ED24A864298D45DBAF4C1161B7A5B99AC251AF714074527302B
+000001C5F0E1358E823F345E7D2DAECF9FC5FCD2737FDB648AE2E976F9683E06C17575A5D374E462D49512AADA65D3D9772E2C5389D52F3FD051046E27F4847AF39C7D28
+0
+1
+0000002E6AA4BF8F5A522DF482F4B7A2DA4D74AD7074D74DCF5DD76E4CCA443677532E8E5AE9CB843143D6746269D5C1A8F80087A33F93C8EBD428979BFFE3372026F968
+0000013D57C24E4EA970872AD8385A99018ECE0F0BB5AABA4DD160F8F087E4AF6E480DE7756B94B5F99A218E26110CD96CCE482CF04BE7DDCD24F160B7402757A3E67644
+0000012B4DDF8F764B6E79452BD115E3632FA14AEB850615A467BED3434869542B27BE771D5CF7CFEDC7836D2CCD3E87CD9CC3391610FCF201AD18A11EC9C5B5F71AEC83
+00000144420AA86F1D261A014F639E5707981175BB7827F247778871841ADE8683EC49418DF4442A38421957668613691F94645B86D5984D76CB9F76BED9699205FC9A59
+0000004FF7EE7E9194E4B4100B6873A6CF0D357C743F58C95B3A37FC00F68199EA9DC8620E4EA0B42C7F19591DA470C3DA3447C0995B7C608EFF0D510C2E275B777A7AD7
+0
+1
+000001DDE9C6CF1BE969AD3D121FB532918B9A5118E1914F7C62C69954BF6BADD85C8B0CE2B2AD589A54CBD478373A46D5DC74F2D1D8E50822B03DE20D021E3E3C372A13
+000001F18BB4C16C2A3B01F931FEAACB2A35649148798EB220ADDBE0CD2815E24795CF7D499DCA38AEDF24C2F25CBA57E0BCFB7E6399421330AFF91B7984C7506362851F
+000001F98DB5EA15EDB575C2F40A77DDB51A36D2FA386156AC6BA8A5E50235442C66665202EA470574BD87AFEF5B6BF650F0782D604766C2BA21B2C700E3777340F888EB
+000001F72D3998764E23133D11E585E979E94B81DE86F387519CC4C8419A5BB1300559313CE6ACFE3065AC28302C134E24DA2776608666D23F99F315F3B21A9EEA30DEDA
+0000011B616C05F8D3FEE846367D41A1EBFBC2740ADE0789BCF29421E9173ED4A851B35C5415861EDCAA21342D9808E5E88E8225FA04BA10210DE9D5A6EAB4E72AC97381
+0
+1
+00000113A3B7ECBFA350600A4E3D4075C721505D6B34942D4706B9FE86B5BABF251769453DB6350F28A25908BB0B71D4343D0B2BA09E8B2EF05AA0DD71A9C3C477B543D4
+000001D95D5A84CD206810ED91A532717D50122175FDEBDF21E1249B78FA4C4586ADDF5F3FE1BDBAA19ED6172DFFDE6172DD7DF3D789C23E28BFB27AA71A765A8B61EC15
+0000018B5868A35C95A0EE613303E33E133A87B3BBAA18B4F37873B247E92521BE3B0A4FC5B9178F1408FDE59EBFB92D65B451C0A0EAF89DA0F263F23D8CCAFA9B4E2C07
+0000016181A4DD329AD9F834EDFB578356DD90790C5E7C0D0B9CD46F9623AA6F2B16EDFA4B09025A444801354DF1399A9D1E609C6CB52B4920D795B7617AFF6BBE6E53E2
+000000512AC7AA767A3A1EC1B830CD4D58E70844462CD1BE01B1786C41E087B6854D2A52C539E149702B97651E188D2A5088DF327A50764AAB6A96EF3C8A61522ED48C98
+0
+1
+00000097756F3B92F20A832A02D7BE75CF1F802417561DCC35F6E6CE5B1D7C306E84C43A23F7506FF8B44EFBAE020A475384D0EFFB8E239E2E7F8CFA09097B8DBDF42D2D
+000000501086C087CECEDC8E3B6546C20379F5E89B4CAEB1F2B70F3A1D4F3679C6866B47779D94589681B8A095FA83D7E00F9D3142FCB945DA32DC732DC4C0FE1A5F0E26
+000000181C99F197C2B188A5EEDF045377FAD9169978283526D82C389826FB6C2848FCE5715E2F42D545496C75634A43BB160F8754BD1F94FE626FFAE8EA877CC2C71706
+000001BDA13B9AFEC32A89DCC82FB9E9145667A98B9EE23C90300892800880DFE89BE3E3A9D7729852472A2D59482FD7FE0F2A650F6EC2F1EB08E49BC30F764F1ACB6C20
+0000003565B93B3C6EDB24D1A37C0E895919B5D73934F1629F55D77503EE2393DE28A39523DB752F34360B7958AEEDB403EF5D09CBFE7533CE49E60E3746DBBDE6C65A17
+0
+1
+000000A8A6CA7E6DFEAA3C703AC079920A80A8867A424E9A1468BDBD7E2E40084CB4065FB8A36C447023397AF2ADA45D3FCD0E3E8524600F94BAE126E74FE6B4281F6FDC
+000000073430D24E0B24F0F9F9D8F1B372A9071770F31BEE4E8A1481C4890C1BAB08335FDA5693D13C960DEADC3ACC64F01D2FD220C2C2E4B7A24CAE8FCDF472481AA351
+0000015C24AE64FE583CC3A569F434C74E1C3526D325CD7B5144BDF18C4983E885FF1CF028BC425F717AD5770015343D6BE98F9DC50CFA4AB58C7123B16BD3FB952F82F8
+000001A1C14B3110D7C3B810CBA80253D653DDB92BD57FD977D22D8F0D8E28B095356D338E7A3AAD4F20AB2CAFB31CD25BB07775F4DFBF219951EE3B380C7E14B26BBD97
+000001A389DA4FC5B1ED1EE582E3CCBA0371C92B886BA63E37FCA8F31082DEA910738F877C6EDAD39823227F60C0C4FB34FE7040454450035C116709AA08DEAEC9BD6984
+0
+1
+000000E114752DB07128B06BED59A166149E024EA3A50F52A1A5216A24CA9AD46AA8AFC2C075B74961F007649810CE4C75723A0693752589E5F1B25DF117A6295C20B48D
+000000DFBC85DC747C6EB3806E5BA62074CC8CBBD52A77E30FEE4EF9A11889E85DA99FF0FD9B30D617858BF4024A67A4A7B2018DA4CE55EAC52CFE0B302F3BFCDC739CDF
+0000019A097F67FA3B38A18F4111885594B4FFAE2813304CEC57709F81A0739FEFC8695D03BBC3168A4CFD581BA24C49199EEDC1F7EAAB7E5793F13BDC5E9200A4E365E2
+000001A5325C5948C409E0540BB54534C71BAD3398E492889C087F4853D64A87AA85587C658C5244E3506EB29FCF3948E8E25287095BDD282AFAB7DBBE25A76BE346751F
+000000EB73B8198C22F5EFCAB3C33B928F75B140E3406122D16ED29538C1A68E78BF221EB620AA047174841FF970AF33BAA2F3490DCB03D9B8FF1707ADD29E56A49CB755
+0
+1
+000001B56FB0A9681083C6C22DC00E4B37EB8DC769E780A4CC093177953E3CAAF27A28945328D892AD2CBACDBE45D136A3EE186CC1B9E7783971D915F07A03F77A5C5E7C
+000000DC489FD4FE08CA0867FFD5D5687DA0EA8FB8202855DF771C4643159E1B6195D4708784525169C29CA8F306F28E6DB097FD7F1D11F0D309CD7906C3EE2EA8E7AF96
+0000009C61BB850F586FDD0AB0E03EE8A5C3F5DDB25558C003375A647547BD232D5CEF07F87341A11BB66797053288767AED2E646B0881C1358818E93F499FF9906B09F8
+000000C8D4A0A0A0382672E90FEFD4C386F2812695AE0DCF7385C388079425E7956485BB8CABFDBB3CB4C5D2105533448EC1D147C88242DDA49794F1D8CF47D070FF576A
+0000001B2F484FF5E1142A6AEBE632FDCFA93B4CA8C9B5A703434E155F381ADD2303F137EBE112410938677041854524C60872BA501FC87CA3E32CD76916A024CC5956A5
+0
+1
+000001E7CF588CA4C91DB90ECAB4B90D7478DDD00BEE716E5632CF6E3EA5F00327BB435353C28A4A0F7460F876570FA601BDA612C6CEC0D643CD1115D5BE7E1158A1F336
+000001B3E8D11A4163341A6D79966C8343650F2D2170E6F31B75E85120A57BA7B064BE1D83EC31CCEED32D5331436EB97A918CD1B1BCD22B8DC4D621B699C004DFEA94BC
+00000067591B8DAEAA51D1414B8BCE9F8CBF642FE235AB9A59E653B86973122C059F6A86365AEA58CFAA72481DDA8B332CAD7FE875F4E3AEFB064E9904E44673A32BA437
+000001276AC18EFC498ED9B2BA4B02D080BBEA7ECB2C8797409657DC90B62BBDD3E22B1DABFA31A81832F699297386148B784AD1E5D4FB7635E0CBCDAA813F7336CC92A7
+000000FCDB6EF8ADDC143541005DC0C6DA2B666B3DB63F36BAFC2969F1B8D339CD323AE58734A72139FC143DAB6C221DFF47AE3EF5F291D1EF6782452C2B88D59F294B3F
+0
+1
+000001887974DC0B67FE0DDA365406706E00FECE1864B5B525584FAE17CAB76601D271880CE511AD94738F9EC30CD709853B365FF2FEE8B2716848B50590190B348B9B62
+0000010D94B38127E0964A4D409A2964C0D55C272D827661413BA7FB74348278762AFB2C9EB82428A0D44040E130ABC456DC08870F7D8BF17FC4269BD1EBCEEAE458ED76
+0000002D266B5946C80A24007F1E09F2B3667E852CE5A8839A33CD26925B9D55DC89A9EA1CA888F74087F614F704274D32C73B50DB2948A368EA83B7E67EE098B1230ADA
+000001F1647F6E17EFFC5B129BBF6C4C08B5A2A74A3FF173C1D0C6F00F3504A0D8A3F1A73D0A024334C86763974345E027E5C377F0C8A5C2AC39963367B7EFE6CDA119B9
+000001F00366AB9DB2D74E236DCBE899BE97462B8C7BCC20C7C0424F8A19ECCA49C9E1640528ACC902178293A92EDF7033E75BA4346D172A24B7FB7A6103D9931786F4E8
+0
+1
+000001EBD8479D8C261F673B1C1FD37244AF0ECC63D7BC759D1C7FA5585E2512D59FB9A376FBD7B674430FE09E279E0EB06F6B2EAAEC5814D77392891CFF8264A1FB1092
+0000001F6AE46B9AA472AA3B4495A61449A3F796FB38DE0D9CFB8D22935ABEFBFDE7310D982956814977D1CADCC12D266FA27B2A7A121B5CB8522756EB553CE583A1958B
+000000FFB193E05938602243BDE91A86387F58EB6241CBF4022215A2A05ECC3F6946F426934A05294C8ACA118D57636A3FF241C508E827C43847DA434728E2F55D5A59CD
+000001F77423AC6FFD301183F3CAA427558451BC70235FC7D3ACEE7D2AC3DB0030B3562EBB30E17E392B1974996FFF3DD9A006F75E03B08D66E43FE78FE7241359C96C0E
+0000001812202FD6946324C78771934BA92047922FABB1760B824A481D1039A31D4EA450D30CA17627A4FE3090485C73C221B1A792BED188CC334F170F699BC483777AD5
+0
+1
+00000094A1A89875D7B8BF73214368BA46F5609A1BDA83E851002EFF84ECD30B478F3D1D9DED0507F4E77ACD32298DFD6863C81D1761D4504BBDBAAA6BD58CC958CF934D
+00000189D1D8C63A3623977E548C43D697F6A1A9BF7E8A144A3A48BED9ED9A00001E971952CABCD0712B92038E105E0EBACEC8A616CA2C565287DF5DFC3F35B848657437
+0000018FE394B73823264851F752BD3A2BF09277CAAD8AB072A1FD5509FA6BD730130F5EC43FF2EE00AF78FBEC61E7574FE8561B9D425B5DFD1590AA79F7881C3BAF92E8
+00000156015D7A5CB4FD9D34B67675087CDE35C4A8F879A2B68D698C850941B6A75E75B02CCC211E5EA1E7B104637D5238ECAC0D6ECBAEB3463AAC9DB7F7AAEF923C39D6
+000001BCC5A333AF1D00D8426FE2E62C58BDB73919B875F6BB43D9FE32E3A3E5F805A6E8BD05F30858258D488147990C5E7A90982E6E7A98CF71A47876A58011959EA17B
+0
+0
+0000009B2C220D80E8C11315AA35716930E6283BFEC0E4715FBE30A2257E20822813B89ECDEEFF8B0F8C8991C73B4F71E5B3ACEACF2A7C6B94FC58EF796FCAF307FEDE67
+00000136EC8EDBD8018CC327722519E7831AE038FABAF1269C42229134B1E8091A736B484B1545A965DD63C4489ADF6AF77570CDF501A4D2EEA772A8329E2D7244B87004
+0000003AB20D95E4A0813E7D1F389F1360C0D0A22BCD5DF83717F099FBCE9BBABCC9CE0B78D7FA635C76A0F719FE9AE108F23F84C98504DD688C4A7538CDDE0045758EA8
+000001E03EBF2F847C953A19B0040399B82A2B165378DBAA012E98B18AF4843DB6E2DC07B4E417AC7B5227931A3E9F7D42A1C9A57C9724F6A8DDC2A966EB23BAAD73B070
+0000006ADD88D6D3C046CD3293F56757A99DA3B35602BED4D11DFBC14347548FC4F0D115C3E07806E67EA1CDCD2D669221E486F6BCA31B7868D8BE0EEE824B4363E06BE8
+0
+1
+00000044C19FA0929FC5884ADFBC1CD89C904F4DD120ADAB8269FC0B85D9F0336AAC36CF43D71A191AF2A91628E2CC7C552B057509D8A0CCA80CB30C3F9CF05DA477B640
+00000119A8489F2309AF7401D1392BB3EF173D30F674529B2E5AD397956DB8C970C14FECB43C73CB8E0765DF918789151823396F0D91D9889E20DC481AE6DBE4C0FA0443
+0000010BDAF3D1B067DEB7A3B2309E3256FA7A1E0BD69423A4A7C88A57EB509A0A251E02B85EC81202A16FF374CFDDA376D8F119DBD9FC99DD908E925564F32FC7DA7452
+000000EDADF0C08DBDBF24385191575312B244E1601C926B43B1F7F27E9B5BE55B890BD41AAA120456B5FD0EBA76E02F2B5F2F32652A144B2A889979B7486AD18A65D594
+000000AB6D07EAE1EEE82102E86A9EEC7AE4186E919E0618BE03B5689924ADAEF29FAB05BAEEF9F9C5752EC721F15CF9E6BC0392AE32438D405818908EEB36804F3A9D17
+0
+1
+000001AC90FFC51160AF9BE596A8ED18FC0BFF1A3AB853AA1B0432BDBE9AF5BA593F20F2C56F98B4114047E3F7E0A2F95E260865A8433EE91BFF820934B47CB537745F7B
+000000CE3DC65B336AAE334A161F29B28504A722CDC75EC979821A1FC001DAD1AC78EF4FD14E8310D7B283450E0A0B0E121672E1F387311F052E14A2AC564C4EE0A15E78
+00000079BA11342F197A9FA73325B97C9768209DC31BF31D6A1E41B5CD937B6FB3718350CF45250870683A4B93AB866EC5CC286B36D1AB7ACC6F489EAA815AF19B964843
+000001B78B607F51B85C02D29A667D4476B06F3E5C66064ABD3F7B9B4620EDBFF97DF2625934B601A7009D377A2DA49BB0EFE44AB182A8CB064384E3134AA491CEBA535B
+0000004C2C6852AD30E668B18886690120D63CABCD949C692410375F4D3147A4AB3FDD201E9374649E532B06B10573C442DCE431167133CF1D0529246BE9969210B91960
+0
+0
+000001F634A1DB8327C063CD7390389E708A1D0A21542BC378880F6025E0F22FE259A5ACAE5A0337FF573F5733493E164E370622996520819D3282C58B376C83C7B03C5F
+00000010DB273AE7C7C05D0392559A312F6DB9369C5A8F179BA2399055E5BAF725635D14737027A148A037F296B4069F4017B03330343530A82949E6EBC83B1888CD96C1
+00000131B19D505B47584CF513503CDA8EA9A13F179677B52ED003EA3F88AD8587E78BD200B11C3227187C72E7569FA62871764B6214EE14773A51242324B7FB8BE87D7B
+0000004127C4C037F4FDBA167C58042E009F108A495DA94442B414A2799E9BCAE709E121CC17C2F84C38349176491814B3DEFC668A63A2372C3F810F82C326518612DCCF
+00000147C425C7CC5DE0CE158ABAFBC5151F576EA615A7041B7C0CD2CF7E0C957844D5DB6431CBD1567E366A2F9FA6D31197B068C4838C9E4F39EA151337273E14D774D3
+0
+1
+000000B1D88273729D991297910F156246894D002066D5441770928455BB4C7DA259F898D09D9366C75DC29173228CECA36A260A9307BC35C211E1B3979BDDF029683D2C
+000001596CC7007BC67902C680E27B1BEFD4F0DE0770C0662509A03B552D4EA364344323FC90AD93958005A9D06E857AF31D115C2306F01BB44AA79FB990C2A95FFB8EA5
+00000011B6D9800E4ED6839A8DD1717EF752051B1B650C2C036993A250D7E354B44FCD4189EE5732A5098922A1D6418819A71D1A80B8E4BC999A79D83CE32627CCA714D3
+000000E208B47EE6F616216FAEE66BEBA32B4D928F9EA50547B42D18D3E56CC6CD1220043716B15AB6D6FE9D34150479F9A7E48E2A5D51A863E32D5B9CD9D209B1004707
+000001DADAD75CEF25DB1F0E5CF15C5C34C71D711E9FB65AC9C6FFECAEB358DF409C0DB0F83AA2C2EBF63A194AF4584AF1355D740AC3E1075C1B3CF1B2F02AF47677E1C1
+0
+0
+17
+ecdsa_is_valid_batch 527
+33
+0000000DA8A1D61EBED0E11581A9499B1666F6DCA17C804BAE76A1710C2160B02801AE01D823E2051515A35E3F20F559698F73A0CEDAC19B8124236155EFFED5DC767EF9
+000001177A2439BC41BD5A1027D442B37A6C6B99655E602F3F976B059E87D742C6E2C75D5C511939A9637F8780BF5B1704F24D13D2714872485577A591890F4F5EC2E999
+000001CE11B61F871E3F67D90C6D739F7530396A9EAEED8B2DEB53BB438129A29B1E89183ED7071A41A4FEB838639152256DDAD99FA1B08AA9E228A039BEE239C0EE7A3A
+000001DB03F6C15EE4B403352F10F247A8DBF33DD7DA802C6767E5599BA5F15F63CA9CC53691A410932CBA29F759CA3044D3411A272477A23004F7CE2E3BB50B6A5473FC
+000000F824D5990FDB0740917461F973643B696143639C4031061C96231D95FF2DDE1186EF56EF96C66CA896D8575544B7D09ADE22D480AFCCAE321DE983E7EF3A3C9B17
+0
+1
+000000A9D9D898BE23ED4307BB04F9044BC3DF59EB7F7D978650B5BEA4828F0D5B643709C7E97EF915017575DE5758FF1A4182B24A6EFC230D73C54F17474F3D85FB9C88
+000001703AC2415C7B92EFA03C24C225A27AF12F7316851C92072B41B97C21E74694FB7E2B58066F860158CC12CBF54B9437010D9220E265A7015619EA37A4784A6D40FC
+000001BEE83119B9C03563A5D25E8FE8E257ED592AE3EF2FFF4E9B78091FB41B054084C73F7A3FAF8B3EB225F14590CDFC6C9089E83B59D91E2EB6A6C7385B7284F0E1B6
+0000002DEB543723829D65A5A6DFAA26932FE687581198DB2F04A1EFC2691D492E9921B1FE7F77659633888BDECB11D3090D7E52E4C72A71141F8182A98D739A155FEE02
+0000001C212647B8F81C706540B55EE870A7BE5BFDEED237CFA18EF5D76003683F6C4BE202E272F60688278A90AD9A6300E71A1CA327C96AB9E58B09FFED658FBE98943D
+0
+1
+0000016B25E0FDCC601FBBB283E5184E991DB6D3E40FABE5F25707E90B5F287B973067C3C1F4259539A13ED34FCD4F7B5E0E5AEBF8C00FBC67CB728ABECD3F0D51C2CA25
+000000F365AF21F23212C5440EA09F8F2E15B88356B7C6E3D21D968892FAFBE9756476082FECACDC6F1C72288349A91BBDB218FDCE605CF391C23B52BF49042E505D9935
+000001436CCC4F6490C847C83774A2CFFA32FC456A6121BB3A83ABC2E1834011D974ACFD812D072682E8241B15BCB955FC829253AF5138C6AC57FEB37BC24666D4C64225
+0000001FEAA9D123D7C7E0D59E56E5B5C1688ECE487B0C97454CBB16177DBDC79E8AF6295A9FF89FA54C306D9705E61FB020438A4855DDE1ABBA6C874DD540DF666894F1
+00000051E845CD9113574C820B143D5CB9030662A3C3D1040B483A56733DDE93580694CE7A1A4A8B46B6B9A29D11652F5C3237D9A116CCE7026242ECE0047767CF5BC478
+0
+1
+00000074D106BE38777778D4797571899CEB2253D1FFFBA562587B68788BA2B08EB9080BE175A077B8639876724F92DED7A1DD7D0DBF145D12947ADF0936A56229B43314
+000001D7C3EFCFDF24FA551E5AF309441FC048C7E08BC716E471A2BC5B87A068E74B77CB98BF8685EADE437CFE06888A36D540096E0BD8E423E7952ACB679BCB18C94406
+0000006BB5FD37DC368029933AA52899D5A7117E4B786A61F31EF5412F278AF74D4644CFCFA8F3F807C13AAAFF47FA742282039D9EA985DCA571054D4CE4998D22294B89
+000000B653F6AF7FE1FD51B396B095B0EDD8D3C6482ED4278FE649E7FD77B11577D7C181740A9B356ACCF4EC82F271A7116AC9F222EB0BBB069523CA5F4DEF9AA9F6D3AF
+0000018ABEE34AB6FD2A84735BC4799AD2B28468286518BAE2D5DAFA8638D3C0EFF01C858376FABE7926F41C53D8B1BF8EB327656713B4DB0E687DF41F35C036012452A2
+0
+1
+0000017B4D34E4C097C734C6301DB011229740E12929EEEA7E39DCEA7189D17C38762C4F6677DDA5D32CC4AB68DD36C2F88125AB5C9C18ACB1D4B790AE3C37EAA0478B53
+0000001C949590E4C8DA4CC47783E59CB72103ABB984B868C4AB43EAC4B1DB789960DDD3179928F3D73EC20390884434283D5107B3F11A7AB53EB1D93E07DD3A1F62D396
+0000004A7FA08F1A65E61BDECBAA3165FFA29BC50B6404448CF5A145EB88BBE57EF64B59E05410A76BA1656D972C6E3E3D062D7A070A16237D856FCC42EE9FCC7A2F266B
+0000004F10832AFE64183EEDAFA33E78477550A39192AB96E49F080E7BF5D31E35FFD1E977DCBFECDC58C5A6AF4570C37341C87F252571150E750EF902B93CF649C8799E
+000000973BD35FBB7DAE8EEC38862EC93E60E53149B5EBDB013C6A63599AAF71AD046742704EDDF39C91F39A05F62407D713077196AEDEA6C3CBE8B12FBEB5DBD06314C3
+0
+1
+0000008164F7BF295F0F6498535433CA6A6A53F4D18FF80582BD5550E115B831B14780831516EB2D2C416C12883B5664CA9C18AA3261DD774AB61DB3DCDE6FC8B2870B43
+0000006866EAB855488BD828A2782A5D14F4D54792133C32979EF250AE5F34F11FB8E0E7FB7B9579E8688828DC6C63AEFDB71E12780D284E0779C03A8B71AE94CEC8C67A
+0000002742FA3D6BE003FA9019674ECC2B7F53620E9B4F62BBCF63222FECB3A76A51FF2D8717DE3D59759CF61CFB153CBEFF9C18DCEE3559EB68C87340A04C7B4DFD5B1A
+000000CE647E579EE6F1C89557EED1F801311FC0A5A2E6FFBCB18D56C6A206E76CDEBDA301F75DCBAA4921C92649311AC11CF9EF29CDA5ED2DA791BEFE424DCCACDABBB1
+000000A0234B03868C7AA6C6CD8D8EA0D16A0A653123A0F3FAD5878EC90F81974502A83BD30E210866B767325B989933CA319A48EC02EB3F02E400AC0D2476EE822D064D
+0
+1
+00000063A1BACAEEC590EF096FDE39D57A032A87D0251015B0A6C1ED2BD82B5A3796843741FF283CA78C005F45DB5D778DE6DFD306AC89449A8324A2B5C662B8C38B63C8
+0000002207DB0A3BBB29335F72890ECDF137495296577627DAF80B4DE12BD04B3F644130CC823106D9B2379D453342760FEAEAF970DCC82EE77FF590A48E87864E4E0267
+000000A91BEAF3EC7D64ED5AE4A29E41DBD03367AFAD8D8E2835AB8D652C0EBE8750DC2B62872DE51E224F0C37BFBB160AE62BDF9A26BE78AF36A1F5904D7875ACD38E74
+000000716EC192AEA295F9652E40701D5FC0CB3B3C9DF1DD5031BB81EC8280AA3DA0420612F080410198EDB63E307A7D6972A1DADAAE3978F6324C15DD8F5371DB4BC44E
+000001759C9224357B3086D26D11518246FA92D1441F9313CC1DBF14059807B386A292244315C8885EE44EA4A1D462615016D63347972787D6CFF7C6F95688F71DF2BCF7
+0
+1
+0000009A74572E10C6ED8E0AEE0C67685F99EE756A8EBC358022E12E829D88F90BD20A3C32D1D8BDEDDF34CCDC245B625C87BC81DE8A0920C0E2FAE6EECEF4990249085D
+000001C5EE5170FFE21B949BFEDEA0CE349495A5EF3EED5D327032E2A8ABC8565727320BA373E9715F3101D8914553DC4465DE2D588C988FE9B4B9B46F947418BEE83FEC
+000001CDEAFB59F053A0893FC5530EA3B06CCDE4114C2592FC6C91A20A4D96CD90D78865F1EC5F6CC17D093346BD9435B7C8DEEC39A6286B2A812211A90EB09880ADB982
+0000014AAAB61C37DA09DEBB9A97B8AB9C7839D94780A16B9309F921AAF42483B9137FAE0C6BFAB334D3B616C04301E48B469E3B3198CFB0246C5196DDCC4518A394C4B6
+000001BB6CE5A885536074DA22C98DFCEB83D1B196B3990EE047B5DBB651EDED233E3F49F4F32E3BE493905455C6FD6129819B66DE686B02FDF0757493D015292C28CF3C
+0
+1
+00000014E2F9DFD10B8AEFC7EEC2BA029D00BFF73C222AC19CF9C4E0873BF1C05F5276F78AEC2D3FCA41E4D4DB3B40A4E6C842077375395B79C515FF37699EC628A5EFD2
+000001C9390E9C1B06F9C6F15BE59C4B107EEEC2056BD9F1166F6194428CB765A23A18DE5C325949906CE0DCCA03218505D477563CC9668FF46AA1E8DC7CBAFCE4B821EE
+00000156619E2977258D1A6652BA3AF65A93100F1E32FBF958BC34FA20EBB24B5046F5EB1118AEF230BBF67AA3FD805BC52C49F579AA3450FC6A51DD3E0A5469151ABD0E
+000001FBD4AB034322B4AE2689E98B7214A9A8511366BF6466E4A8F32411FABBBB9819273FD25356E9435A2C8A3BDF880E1FC966D92647F43C59857494A956691186F262
+0000004A68CE8A82063563ABDD27A687BF6AD726C34A6FEB1A66CCB7E2717759E95A7A6499E8BBF5EA3153A834A6ED68C356D95DAE7682505F24B5FD15AD4D174AABA7A9
+0
+1
+000000B85328675FAC57FC0AF54E2D2639FEB6B21CB2F540CDB5A7B632C0EEA7E25AE5906447E8D25152A34EBB0ED4C793513D1ABAFC49836B3CB1FEA1DF01971D5F7457
+000000DE344C4669D765E3923B3867816EEC6836B48DBF1C36F7DEB43AE344258C077A75B45DF441AF36BB1E64A31B64973CCE6FF943B295D55DF6826E461752EBDA3344
+0000017EEFB7C93E29B7CE05E87E0AD69C80C0B0B466347D1B788691F4E3DEAE7109F1520B5A80C3F2516A465E80AB74408F14FAC7ADF54C987671BFB5A7041C6AD5E554
+0000016639E5A345F15A119956BC050F251558FDCC17933BF37586BF3F5190FE7BEEC04D9C5DCFAE53F3E11529B7C7E97C615C3AF082EDE1F900DF187D707F1856A2A09F
+00000139696F07603E63944618CCB26FD6B9D59DD0A0025566D7657FA710FD28E4743902A636233F227EA40EC2CA7BEDD4B4E73C499B5119EF5C1DAC6CC136AE346BD547
+0
+1
+0000003DD05E4570DF8DA8FA1E9BF629F86346FB1FD936E048B755D863370166BACA60374EE382767C55EF545C8253C1BAEE53E8A8DF33275F3C1F57F3567883DA540745
+000001EB347130373A213F89769BE9E976843D3D86F323633DBFEBE9FB3C8C120B09671D0671E347C9835FD5EB13FFF9EBF8A20587E47B839F7A919708E7A5415BF267B2
+000000CEC28564B01E1D453CF152040F606C411067E7FECD1F725680F8F6F13301088099893C7E94583BC1DFA3F2C34F476D159CDAD95EE727414323A0017B70DA6B6280
+000001AFC6002F4C5270BEAA1AFDF793CD1DBBE79ED531586284B1B889D6C5CD8834AB5369E0076F3D4D31D5C6A854392F1C1B28C60D49BB28ACB39A4C6E0160FAFEE1FC
+0000018F4B4F650FD56E8F30832E4AC02637D8C68FD51F27420F722A37299B3DAC58121E3A20B7CA946BD70D41287A2DE9435E880CC5ED36F5EFCE3D7A5CB1ED86186996
+0
+1
+0000002F6AFEB1A3EEC2354DAB0480B82A727E7D1F39C6CC7015E43775BFBEA68A096827B877BCCC9894083FE800636A01F0E4961224B7E351F48D8FB17F218EE5B0597B
+0000017BF5E189769C18935986FDAB2E79ACFA5E5FE9C20EA0B19CB3203FA367069AEAAFB0FB7622AAC1414219BF45DD9B27ECE96983389E6158D55B510F24A36DE54C27
+000000668978923559BBE76747CB154D7AD1749746211E6976C60A490C65E8B33C043B79CC09FF3728745E6F745ABC148F6206CC5D1C06448A9C238F673936160D3D0301
+0000007EB2AEE6DEFACF3EAD0E02CF8DE7799E64C8596C00112F0B9D617B363C9E1F97E95374CEBAD3C325529108CD7772851EA3F2AA50643A75A39C9D612C0A70934C8D
+0000015D18386B2056B00896FD688BDAC7892D48F880EC08B57184D73744C68B8DA30F3EE07B8DFC0C7FBCBE8840FA404AC3131AF8BF77C0E2B84644A4C01A50A6266672
+0
+1
+000000283A3A33BF99B7FEA1B15696FEFC56D0D29FB0F821A5B869600062A9FED43C5E4F5CDA6A784940591910E75395FB3FA47A909EEC47B92B496413111D7D412EDB1C
+0000013FF486D10BF0478A9F3E38208B04603447417F574F32C5929FD595BF830A2F68429927E387EB36754F27BA56E5B541BB5E31C3362D68EDEFCBB92D48ADE22D1165
+0000015136B550B649A3EFEB6EE1E5247553FC81FC303222B25B783B2AA95EA9B1DDACECD7B749475DE40547219ABF65EF6C925A96D18CE541FFFF3388E6F6FB4884CBDB
+0000002BA6F9F4257B150F51DC22D575945F30EB4CEB306C16996ECC9581D2944E2A7D42BB46C43E0883A01B923C5733EA4031B3728E016A51CF62AF04B3DDC16828C23D
+0000002A064300C0E9D54BCDBCAF9B9B57CF785078CB5EC3C2FF8B9D35C5C131F5BD302E7EEC86E81E619D01A36EEFA9855372C2CC462D5C49ABF0B1E2A6E253B1386ED9
+0
+1
+0000019F9A3215F69A69490E8EC6BBF421D45ED2F082D33485B3904282BF1AC7E9D99FF3CEE3DB77F56301522B4CD5644BF6F11475A054FF1DEB57C913FB47E855EA8E6A
+00000164754A6B30C07C24DF1FB3365212093CF569E2DD987C7DA18288B4C5E1C9ED3B46CF5AD9B4C139BEA31465163B9870E4EE50F25B60F97816E3295B7ECC5B555A9F
+000001E2802F2C159E464FAB0A685BEAA0556A5E9DB88AE0BE6F224CDDB60F23564633BFC5F5AF47D75D582FEB4B2731EE943A6DF593F7744E030E9B21F6BCE97A0BE3D1
+0000006DC7C812FF155C2770E26E5C676A68F03AB01E38F14BE45C9C1A09906C22E773FFC381C8970066A34DD9D64DDA84C01F283B75E121B2BFFC538927F7BD4C3BBF3D
+0000016A18A9490E7CB58D40C179C558FF07472A050C223BAFEF917FBC208FCABFD529A8E8F56100D32843C791191312AD964446FC19B85BCACC653B7E930D7EC69B25D8
+0
+1
+000001E424E977D677B39F4B2A91604A7281852810EE3A794FBB22CEE66080A542A5BBD418702F2FCF5108987D4EF2001F66D9E2AD0274B97DAB72324649234D0388C90A
+000000C2596E188A8DFE057275072E5B70C1AC07B059E3466E01F6ABA1FDDEDA446C0B3F5029BF3A1002A15E6C1E6B49FB098C3A603095CD7B3D70DD55D2575934EAE440
+000000EE68B7259F90ED093AF0EA76B0A6502AE6968AD0FC05B917116AAECDC8FD15C4792EAA56552377F47A4E690FD7B0C4E6E61D22D0598F60051842E80C8124368217
+000000DFA0B9A6B57C7A6A67E7E58DF8BC54D9D20FD04768DEE125F64791933036C85C4720ED3ECBBA17D1B9B5C98AB161EC11E9FBE7DD984006BDD5D3FD0DEA5FFDF9FA
+00000186132B74EFBCC00E7E236E75354DDC28DD8CE0E65DFC1DDCB624BDE87F40BD599D653C82AB400C399859A65C65FA63919D0EE68881ADA89FB3E24E5207B26B3643
+0
+1
+0000016636E5D7BAFE5D2757EA85D7CF5889DCF007A9FE40BA217579516AE2FECD061DF68922CE1C0B5E8698B20A8C6B6F07FB1D1317CBEC91A242B0200F9810C4AE58AD
+000000DD214491923E1199A720C87818051533D889D9D4BB43BDA8853DCF1D0A4B0E427ED8788DC1922FBFFA65184B5EDBD9AC477E46B5CF0BE544ED3FFE87BB7C0EF6E0
+000001CDAB57813E1B4D4582C7CEFF75100C1CB0D44D2119D77E391CB4EA576080592FA29A4B695EA3DE44A43CA4145208EC9E575DF7B450E89F1AF4B0C709998ECE2EFE
+0000013972202251C1B0573E6A9E08AE84AA9526658AD6D9FF27D65EB12AE2388595B623C3CB63C7D85F9A7EC5E7682537B5A265DD3234633B4A9BBABF2351EB4D262701
+0000002A9DCCE87727E1BA65AABE238477F632DCA2D50FA1EBA5D5511266F9A85E2D5912868BEBF8E31EA96C76B614BE04305C24DD21587C1DCFBDBF169B880C31574C82
+0
+1
+0000002C30405A61416E21A83973B21FC1B29455BB884053E4DC676CBA2C7CC223999AF2FD48ECD0BEA0A993D94B48AF21E07E9CB22553D6A1587995AAB154BC10693181
+0000009938D80400C51C07F798DD776B50C6C29BABC6B9099CDB45299E03A2B5012E6FF3CA5D71DF87F8D3834ADF244F56E04DBF63BA4537F1EFA0F014E8CCD2D6D8BA03
+000001E261ECC9B8B8BB7439D1037BE95865EF43ECB0A8EB257338F8A43176AED7391483807F73EA871BEC8238BDB1D6549DC2674C65B15FB19ED0649CFBEDC32B0A62D6
+000001CD5FCBC8F7D8B76241CE7177676DAEC2E306FACB57916A7647E6275E55D93F635A196E94D4CBEE3102522EF3B00AC075DFA0BD928BD42EF2BE712528FDA2CAB0C2
+0000013716B829617EBB73A25673C29B8797154D8A643C54C57788CFBC26D651FAF1CAF444F2A56D158DB65569CD56E8D7E67851FCD00150388D1CD2D53560AB9DD9ADC7
+0
+1
+0000019CA0440A8CB06D62E29BEE4F359B489FDCCDFEF9857DB7644189C06E327463F8D7F82DDBAEBC5A989C931F42F8465C2B14791BD3A10C3D1C8A3E3D54DA60E78E71
+00000079BAC342A6A329D1ADB37FBF84A29C0059F3FCDEFBB44A54F75EA3A71CB1EA638361992D15EB3D93802BE4889C9A96BB4F80EF2E1BE02714820D902B5D562AAC52
+000001DFA6D097B7629AF963B26E635583158BD437EF2F6E0D662166CEC1BFB6F17DD878769AA3B4D56F396C16A322B2193D8CC91743F539FF76D28C7CAE0491B2E463B5
+00000075157DC97ECBF5EF4C92414E6FB765B0960F5FC01B0C94772E2449C2D00A2B19BE1F10D8B519958FC1D824149D2029BA252CFECE26A9E0729CA716B1A9AA1CC63C
+0000015F22ED7E4AB9A440441DAF8149E8939A7E45D6907F4CD6C3716D6947622381B26C9748FC4C0FC3076356D3F54B5EF16CFDF673E8475CDA01E0D1DB7CDBC3F466D6
+0
+1
+0000010A401A9BBD833EE1E961A1EE8B2CC2ACC5727B5145691911E7276F4414A8247B09C1E4B91C97592083A99FCF363C5403D9B23773ADA0555E566362E498C1FBC11E
+00000150A48248AD564FD9E8C9E7AF893121A10BE22E0F8C8EAC35BEE3B0B3B599D8DF4CD5BEE3B91C76C4B4E56F13E7340DED9B07DF5B30B410D9801E93389B516B4182
+00000136EEB14567C65F97B0EC912ED2294C8DE52603CBCE773116813F944031E647CD9F2CF09C93BEEC462E4F6BA1FC2558CC5A335C6EF2C6579AFD4E6CA87685130A74
+0000010381B5D25F14A3ED40055387289545068E8654EEE16F58675C1EA300EF2AE751C33F27C7828C229A3E02EFF4D7BB442E066915321EC8B94189B6399B29EAA5C588
+000001F11AF2C3450B9BAF37C7B200FFA7C873803FC32C4C414573C093B3A7425FEFFB3C3C0D8105B00BA4993C1241361559E5366655FB108DEB8036E6E472583F8B5288
+0
+1
+0000001CAE9B6C7AE2AE20C0D8408AC4C2115069EF97BF785FA8EE8FD9378319BF4B010A46F24D22FC7329B66C2ACBE85132FCE50458F8EB30E06FAD8D894E2B1632F80D
+000000FFDEFE4DD636DEC415B5528D6B29979663F4A13B8844685BE5C47BBFC5C5FD958CB0EED6CCE5506C36EAAB2064EA19D3EF8636F78A5D34C9991B9B71BBC21CCC85
+000001DEC82245E05C536E7257FB2A5ECF6F990B7A847796E116F4A9DD0121755F6AA3125CBC848C979D4B8BCB770A4D5025345AB115BB3EDA8BCBE8DB2E1B090EB5E5AF
+000000CB78703DE81D97D4CDC0A10BBEF8334DB631D599AC522490E2F0BBAE174C3760DF30E93A6F7D7675F4475A3FC1D9C2964583C9333F8990B4049115FACC17BA558A
+000001CBD2F3B593B6481633A193320930C57C1D6207763AA6C9335254EF84433330ACBFBF55BD1983BCCE3489BE4338254858A4EB8820C8196D3C0A0545437DAC215AA5
+0
+1
+00000036483FDBFD91888B5B0E98EA705CC56D8A3B44F3EC0B9DDF447ED061F4959BAE507D16680A0414DA6354C51CCF8294286AEC51526265552CCA1EE5991FF197739B
+000001E45F9515942A1CD6741B00B9C096F1B5BF5B065B6EA9987D2F16D1871045161EF7FA7E58E87815C69283B1453C23640743DF10A699ADC4B831F09F0BA3CF61B0F5
+00000174F36307ACDE3AB475303767AFB81022E20F80FBFAFA895E25A6226D28C8D0000A69C47B0B1A44A6977AC361517A52A193F8E6884AAD693AA88A7B02BBC1D3C456
+000001D58791643DB78E6A7658536B1254740214D623992A8506066F25536978FA80BE010F8F1975ED169D91E2AA606F694B5DE737E03DBF5AE49DA7E5204C944B5F3FBD
+000001A3FD381E9EDED144E292E450EBFC8E68C65EF4A65292884BB6371858410BFF64AE13CE32B7EC2B2F75CBD1DF8860776151CEE87B61632D5C2C395222AFCEC39D12
+0
+1
+000000228B0D52B3B0538D2F30171946A29BBF549DADBF47090A3B2B72FE9E98F93D7465DC5B26C8C22FDB1EC75B382E7BCA55FC45E1013838860392A3BF02C23F2EFB63
+00000008ECB2B0053ED62C02071874DD5E0DAB69CD6D33B6D7EF273AFFED671B6BF943835EC201B9329ABC9E10A8C4114BEEFED5E9D8A38932E1ED8BDC8079F023DE3D6E
+00000071E772408F1D25232DB1C5C0D2F168C970BE0973DE83470A013449BDA884B22355CC352D2CE7EC9B1F2DFD8F3E15B961DCB5BA545BD3D10308E4FB381C503DBFE7
+0000008251C354FC63F1C0C2E70F0313705B8439395B8A685B0D83E82E87092C745E353D02508309024958DAE582F22ABB947284DC6A62E566DC0C2AA0279604E84E51C9
+0000001BA168433583C45F623E3941450D9289CE540FBD2CC2E229FDED6762DEC3F3208605B8D8DAE9EA6B21B43B9E841C5130A89D0792CEEFD23C09FB457B6030E9B412
+0
+1
+0000015965E8288146154A026421D9AE420880171FFD0D962B3F575CDC435BD87764B9802A7505A6F3162A9D4EBA34959CB16944DD61CCE724446E59DAE10E569EB02E5C
+000001EB1E104B6E109D1B9B643B7B104AFF947F4D9E0F5309AFEBBE3F2FCF414FAC973A79CC693D9775454009A2A1E4E9243F1722C1FCF5A64CA5B5F6BE096BB9AD7A9E
+0000018A627DCAD59C78C6E85C7C526F28F363153D7086EEBFF1D5C8F50E89A20F5DFC6EE423120F0160F19300793704920947512B5B951ED8FF7FF4B1FEC2F29C905145
+00000167D9B850E0BA03970FE699D8405CD7F26B83405BDBF0EAE0593002488E4D908B8E5C6D8314A3FD38D1B37FA61C2F895339B7DB801A4D95E2460EFB7EABCC029E76
+0000014A29FA68E2BE56F59EFA2052EB7263BB63639294295C94EB42BDFFD827208F2976B8393BCE45B0E11CB80BF26BB933D19D1B2ED19629B49CC62EF44CA291823A4C
+0
+1
+0000001F3694182E4A50ADA30BEBED9892F1FC7C026BF29A3B72C2770DFF2DD53AFBFC68676F24AF8428BE9113F0E9D6C5E3CA86C17A1BA46F65A8BDD1C2668658625202
+0000012345BFB9173720A8064867DCAFEA8A7DD1E5A4B561B43E547BCB9CEF4CA0D670487FD7E51890670B2DD75BDBA39E79020AE5C910612E453822B41C243615899245
+0000005F1378A88C8B61898656B2343BB31A730596CC38F354DD49918D53869CDE473E8479D035820CEDBC1304E6A2700B8CB5243229D12EA120E0C0C20F92FA3F9DA95A
+000000C94457316B1D6A8039FF4D70696619745D072D9A0BDC52111F71A6CA36F9112B200F4FC9D663691A8B8B01A3EBE47E521DC9440CAF4B90C1CE36C2809C7A25BBCB
+0000006D8CE00D9E0002521971B0A4629B4C99A426C3DC4F6B9CBC3131FEE8FE12388BAD319EA9185DAD82F47AA80F5DDCAAA815503285AFCECA1E5148D3DA9A74F91655
+0
+1
+00000126AF3A726A51E164716A28CEE9DED9FECCEEFAE1D436FD1EAC6C8C8D5C585E50EACC55FAFC78B56A7FFA8B5F79D2026EE36EE3CB2D4CA23A5B7B276EB04181095D
+00000073AC121F8BF6218F78F9C2FB507B00FAE74A7FE5F0B89D96EE74FC11AA112E504F1137408C56C47C1E3CCB15D709F887FFCCDD358EC930F29705B93412A43E3679
+000001F84BF02EAF6541CDF3B45B09DA5D2518A80DCA186803DA6AC8682BEE70DD88FFDECB10A8C7BA600C5AE883C9BFCC0BFA5FE2B10C8A6040EBC872FCD23E9371AF83
+000001B1DAA8453CE6E74BC3B6DA94C31393C657FA665757EA78CE4E12B1A938B0EC4278C722D9250F6D2C82276411C8E73635E053C95A9A9F3BA62449A32E1B062C8C29
+000000352BF009C3C015038C16D56ABC2C851AF1757D7996F1C2D01D88A31D7335626FA3916BFC2913914CCF378460493B26CB8703DF58D27ADAD3F7A0ECA69181A2969A
+0
+1
+0000006C041F95C7A6D481F5166DEC9CB9BDB40740E69CEF286DDD18489304C2F847AD0F810F8EA69203FE90AE61A258167D823FB213B17B1A71C89978FC247BDAEB75BC
+000001279EFF9ADB31D0E50488F9B23E44A60BAEBAF7EE3291EF66D3AFFD208C1A7EFA0DED74B63C653C8F290E11ABB56E061C014901A8C7CFD1F439B70F530A50A29112
+000000A626BDFDFF78396AFC66E6AF9ABE976946A21E8276F1282FA86046F5F7688F894A907E154F1713054B8737D57D0992D9FCE6BAE9220D1077732620C9E358130DDD
+0000006CDE6833C8D2F38BDAD570B2349B8A2D0634D3385A6E57D22F4BD6C0060687308F650988CA2DA7BFBDE0C596AD21C50BFACDD2944D1D6D8B9E58922C1EE2C5E2D0
+000000E2129FE39E8AAD7DC5AD09A4C5B4F39E756F13FA4BB863A72BA3C3E600F3E2977A0010AB976836FCC8A6E205D803113BC9BB95EC3BF1CCEF3E8120C275088B0CA2
+0
+1
+0000013EC3C6262B232341663869A96FB4C9EFD5B541D7294ECE015F0F3A91B5259D5588076FDF511EAFD1C312543B46B4BF441EE9A23FA9732AA2BD4A87CEBC51229F03
+0000015281C811C31BAE8AD0D90C7A7A80F4A752F6DC77A3BB600E6C419BD97CC27CA6269411B36E8039D705D55FA6CB77BC3B14DE8FEC5DEA68B49B14504D883D3A63AE
+0000010DFAEDB44A77B32CEA61DEE23113B63122BF440EB64CEF8E591805995F960F93E46FDE223CFABC187F19E9BF8190FDB619CCC7AFC409FDD01D89B5E15B2EFA8298
+00000128D5FF162DF838F11C89A30A0EB097FB45AC9371BB41477F9BA911D0FB33E3068060D7C52A9C3BD77FE50F082BEC7D9A524266F0CBC5ED3AC6729DD0B5D34E7690
+00000072DEAB06656723FFD428F495570F427AB3DAE0BED6DD175A7E3004874E4C3809F0E4C190B3C3EEA487FC1902CFE0DBD5363CEBDAC0B225ED5017FECA4B841E27F2
+0
+1
+0000016EC7B55EE0589CC39F5F9F7F53E6FC94D33F32544DA5A327D62AC9BB20628EF75213BDF58A8FB1FFB99DB82EE338DC3E437103F75425B34AEBF207947D3B80C08D
+00000002B5C82EFC3F71B3B57E2CBE8F578EBCE8A2AE65C7AF90BD486ADB8A98B15F8F19FA399F42A9E9C2AA7B609F1049B21FB06A9F5ACBFB296CE31F80652EE3AB245D
+00000176C7FDF54D0A04E7D5E9C2505009A99B89DDF6B1CA29DB8E0AA5A090326D0AFCFAC4D8455EC9335A46288618E13C89494D759C8D73B77DA950E477926CEE747574
+000000240436B86D2A1197A2F214EBA2E10CD4C7C99D35F6102F4950F502F82FE41742C0C76C9A4672909044AF0D973C6828C3C8FED86090A1CF6430FF1D56084B035593
+000000A3668C894BA77A95F8C0156BBAAF5DEDA0A0EFC99D87E272C993774B1D054008E4356653B5B20C1A6628861106E93D9376A841A4EFC7AEF96B6686CD572EABC124
+0
+1
+0000005036859B063221E3966D815E553382AB3FBA083B1595753F48E76E8CD31E020D558307E0155EA04FCEF310C613B9C70619E7989D9923A5E673681D574743158580
+000001D083C042C617FDF635B71AD9AB67850F33DBA78FFFDF8C88A08ED67F83D2D9700924424417F1478C2243A621FD5AE9991E36B01AAB409D88B62ADF8224D554EDB8
+000000874FCD991EF3C71E29EC13502F3147C3E694FFE96CF3392942CFA8CB0784BC795BEA557BDDADA966303747560AFA9320A7FD255F98D9D6DB5D3E53316CC2D2A79D
+0000018A3CBCEA45F4A5C74337FCF46023B7861C8324A887E239B8D1FD61F2CB789033A1FDE06C156E86F0C295C00E6CA51C030B09B250A88700F28687B90B4F0A7D0CFF
+000000B6D445236D8E4270B0AC9EDF8F01099BABC2E6CD41BE436942150A4EEC307119D0026A161DF250EECB1506F156944BFA579504D5E7BCF554D02A7B593B6720FB1C
+0
+1
+0000001A606F1C8C7E28B49FD92D93085435CA831DDDD75459B84398D870735C5212C65B6510609A5F7E140CA6365B751346EB8DAC2A4C32CD530A45927AA1E141E8C7C5
+000001338C0C8C96010A146569D0F7142AB16389611B54B8C32AB13C312F4F93FF0A6A0BF918111182DD4CE9F05A9DBF4E0ADD6FDE6512661C95DAA79B0E5CCE85675E2E
+000000670C24AD8BEE67DFCA17EE40F650002371F5A29BAB70ECD8E07A42737A469B8EFA8EDB2AAD6918841FFC381806612E30F12AE50DF515FD19069A5A2961042D003F
+0000016DB18980BABB551D2F245738F28266C02B417E5701BC576A3C009396EDC56BA67C4B283E58AF35A318321E61E9BD993F18E385E8C0F405917972EB79D9D98E3D78
+0000017F1D6D64000AB115A5CF4AD65DDB41F552B65A2DD4AFAAA2A5DA758BA27CE13DC6E170BF105229641AB6E7238D391FD3BBC5BEE117127CC3447E3E750AB807BC30
+0
+1
+000000C71B16BE66DB37D2012904AF2E13A389724B22666BE44082702EED2BAD29E922515AEDB36FB98DB52F429F97B4B685FDE0DBAD1FEA0E65E80A02F55148BF6134C4
+000000F8F74D0AF19D20E7B3814A74B6552736FF5D5C3B3759F48D15114DDCCB2F2BBF5AA8A8765686762EA3380BFA175AF2F8296C0AF80781FFFD0908931FF2153F3C3C
+00000039D3093F2C5EA3A3A594490C761BA1E2573E857E97F55A316161D563D5BA265D101399BFC6341A55602A0A84DD81936038415397426D26EB706BB822B24C1E1A41
+000001F17E88C8006C539446859C28A1632660F913DF1279A07D666EA82E7BEE4E995518B570638A8A79171F216C4808FADFF6B110FBD5F29497BFC03878EE9842EAA3D3
+0000002A86359488B66B3A1C9714B95BBF513633B56AC95A8917508A85B0F13F83D58DD395C744E55476B08EEE438799443D970F2D2E0A7F7E5E36D37AC4D15FB28091B9
+0
+1
+000001939EC2725BDB1C4EB8F6F272E9BE81AFDEC5CB66E3C51E91B66C1EDC93C849FFDACAC6BFE26CA947B5122BF359284095EFFFC332791B90EDB5A54AE68FB2595542
+0000012D8F57B2880FDEB60A0489B0FE02351CC6593AF2D8B3E88B1C72DC8AB4CC7627E59212B5BD9F321C9B57D8E686161D6CFAB18CDAF15777DC4039F6807CCD1FF64A
+000001A5394A12EF0E9C63A7FBC3BDF6E95DC16E9B6D6AAD27AB54F5408CABAAF45510F3A745AE18DA6AA95DBF46945FD0303C6806359592B09808D22F1BF900BDBA2B82
+000000C96FF2A65CD6721A4DB294E64686FF67C76F01B0EC3D33371EF625349E62D3FC10BF02920FF0AB32D12CA1358FB2D9251B1FD87B719FEB6E39B1AE577BE593B646
+0000010D3D05904E1651F232F0B847E5CE560229637EF9CB13CC6243E98DD11BCA3A50A7402F8BC798C7F98B3DA745881225497BBAA7F2B2A702F2BC3F432E81C2615C84
+0
+1
+000001BC37DB1CC8D67C1D586835A826A9F1EE032FD6BF61D658933B3B3D521A4CA8A740C144A069B8DF1CA161F2ACD91B24BD75574445EEBA39703CB0B1D5D452A1ED21
+000001F17AF78B0177AB7D08BF83FD07ED75C3AA383860EE535AEC27E05F771F437A7FD411B97E041020F6F7257EA32AADA887D1C1186C28054B358543548481A174CF09
+000000640DE69C809E15E5BB6633D0BDBDF74FCCEDF6E99A5A31821AA1D695914C67C00E8DFA4CD34D35C98EFD24B518DDBE999D4AE99078613BB21E29D7A6C0DCB7D23B
+000000F389DFAFBB1C3FE6959B2BCF4B17974345F0D5CB99C04C9D0E1AE390A9DE5A201E23CAA319A2B0C3479019B5327B126267AA5960159EBDB3741BD12AAC8D80CB6C
+000001F9ED6ACE2D3044DE67EA744CCF278FAEBF94769AA9B7BD841D1DDF757DB7C55D2A962356EB6B7D3F9B74E2CFE70E994AA59001650E386AD3753EE2F85A9550FA7C
+0
+1
+33
+eckeygen_batch 528
+1
+eckeygen_batch 529
+16
+eckeygen_batch 530
+17
+eckeygen_batch 531
+40
+ecdh_phase_two_with_key 532
+000000A308F770FF18DE9FB8FDFBCA440915C7564227F6175BCEDD94D6363A3B733837AC4F5EE3F814004A135A294EC743F44D262D0A198C7B785B9D4F658F45A5FF434A
+000001720818F36FEC2B151E2E53846F298996CFC1F1AB1FC5D61F1154D0B5288FA8A48547E86958ABC6ED22BC67FC79F7F42BA3196493FFD6B46485CB685F2E50874D3F
+0
+0000018069FEEED3DA59ED9B3867625BECADCF2E4D0E2DAA6B5855CAE32A0E271B3ED0802660001A97C3967BF1C9A984C4586587A786CBA305F5C6AAA627C62C61BA36E8
+000001ACD247DC0573C8AE88D06935DB80CBA39B257837886AF040A38892DA716932F4245D758A5EFF96A9E899EFC010783433D2E47A3B19D10CF9A2AFC99DC9051A5EF5
+000001C462C5443077A1E29742A2A221A3445FB272CFC2B80DAF7C72FE30334CDE2BDF3AF16AAEBA411492F3AD67F462E6D9296FE1CA8CA3BFF9EC264BE71122585C06DA
+0
+1
+ecdh_phase_two_with_key 533
+0000007AA85AC7577ECF526AD77C7CA26972B46EFFE55F4C06EF2C5A43B879ACC405F9AF7DC93A01A1C9AD742248EBB808D151F323F80DA9BE3EDBBB5E32C07F383DC6F8
+000001D1D386E11FA126E1DC5F7AC377602D359ECC9D6E51785121E9203AB991502D1735FDA7ACF947AA6D95FD7B47B13AB926887733D6FEBC18E73BFE5F35569CB1D576
+0
+000001FFB05F218A91118055C29124935735BB89AA109B0C892B6C2A162E23ACA73D84571E122139C4FFBFF5363C5169746104885073BDB7B12F1AB7175086A61E6615CE
+0000004CDA81095697ACC7F26E3CDC5280F605008D848B8D0EC87E7EEBA6C957345D8BCFFCDF78469DA1A39888C65C01FB0858DC74B7A0C8EE557251CFA06D1B2CBE31D2
+0000010F2409D759B6C422ED46823D9342242EA0715F801B97AD517CA0A1B51C89F5C08C3DDCA895DE155007D312894F919D940F0E4F7F71E68472F0668621740F6C0518
+0
+1
+ecdh_phase_two_with_key 534
+00000107739F102E206C2BB6906F81A418F75C919CEE9BC9F6EBB91C1E67241E9F9E48D24CF768759F1C7554D32E000A3610BFE9BCCAF662BF8CA21E7D5FC3AB0495C955
+000001AF0C4343FD95D50D070A8DB0A2A653BFD67D4B6BC3C90A284C27349B26BC58FD214F996FFFC17F027710E9C97C7510CA82969CC1D38090363D758C927629BB02E0
+0
+000001B4AE2B813E9C2541DE3FB13C00FEDAB174842A3A066FB958AB518A1D51488C6FD67C3F6DFE82D4F5C5834EBA813862C80B810A74B9750CB75F418D27FC136F8E04
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0
+ecdh_phase_two_with_key 535
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+000001BA9788B52757E2977AFCC091EC32D4A2ADE59B49CE4B7141019BEB812CBC6478F142B295019B0F1752D0020E05E62A0AB0DC3BF1F38272C541D9EBCF509BACB62C
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0
+ecdh_phase_two_with_key 536
+000001FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF
+000001BA7DE36DB1E7C68029FA8A4987CC28F6A4C615F85159D447ED8BCBDCCEDCFCFDB3E68796930BDC1CED363793387306325BB7834E36D8C980F6B2DE6EAF33DD17E0
+0
+00000141CF5C612C7E088466B2372112A3B11FBECA5178B0180CADBC9F20DC224B557B017336E2ADB1CABAB3EE00CBB776D6F0EDFA1BE6476410BAAB09020F9B13562726
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0
+ecdsa_sign_with_key 537
+0000002AE9858648D220ED070D8B31777449E85874403A653C6EF9B3EC17167C87934245C1F582826A71BB3B8D8A22E8461A872C48CD9F65A15E8D59025CE92E5B057A12
+0000000C7942146B931BCE42B0BBDF7E3772BF8C0948FD854F19FCF4EC6FC0E03AF0513B5CD7D7AB2EB0D1583DF7446C293C1E354ABC232A75AF7FE452D4EE6B61EF0EDC
+000000C9A397630FB22695398B4D991DCE6FF5CCA8034821F96A9CCBC526F1C458D1404E2B085FB97D7F0B51A09376E0BC8171C6858D2D237344433D1763C8D52B03F561
+000001FB0D18BE0EA15BAF7C38D9E11F87CE154E02298CE189C57F6A42F76BDFB756A988953293819F3295C07245F67A49498332BFAED0552BA544887037AB6AFADB130E
+0
+1
+ecdsa_sign_with_key 538
+00000157468E705A3D069EDAF3116471C1E73056C9BAA292FEE4059828958657FA1922CB29479C7496C3EC31D76500127C491F108A5BFC2272C70F268B65AEC7FFAFA884
+0000000D8ED1D1C01986FE59861C6538883C979C73C0830AAC3634AE66D780CD0BC08A813F74FF2B2FEBDF357178270F67038A22FECAAEACBBE9D57D2150353DB89536F6
+000000100592AA9498952B307EC28C697B7F010CB4B34E2F10E25AAC6068466489AFD840FF046D25B254418A5C9AAE200164719EEA39F0886A9E55E5121F2C2D3A3634BB
+000001A8F37D67460CAB27DB5C44565D14347EEC272294BF82DD4D0D762B1D7D3588BBDC9C7C58A9F2B17F421CDA784863129F8D167F70D04FAF7798F0501F6CD4890A47
+0
+1
+ecdsa_sign_with_key 539
+000001DEB66F1F7DECF56D17E1719B37BCA6BE57B06039683E9A17BB234D3433C8175D8B085E25FC39DABF44F2D5133CC8D54C6141158309F94D7C3DC2DA22DA3889FAB8
+000001EB1DD4C4B6866D085756464E8A4160BBE775B41515465562BABE19756ACD0688B8823675B07E3A182DDA235B3DACDDC07CF6C776D98EA890F63193E3C8518994AC
+000001F41BD0FB070E05FCB12D8BC564F22C66B2D64ADE7550679DAB06162FD920D9348E4025BF08369A7727C44E25DE6E5B634152D5AC29B446A372B0D06880642116D2
+000001160500577A18ABD830D439A09B5811A61B38CA56804F8AF5FA32A56C4519E693054E1B218C7A30D76FA35688F0313EC1A7DD1CCA4ADD2815C51BADE88EBD92210A
+0
+1
+ecdsa_is_valid_with_key 540
+000000D1EC8486FDFDF7C69A09C21E92556331E1DAFFB901BF03C4048FCF07CED7A582E84B0B5F1CAC38B360BD1D7D54DD4E270C87186F64F1E2FA4BD4380224FE67BC8A
+000001A2B207983DA141AA56285D1A37AB5935C44A9EAC507A41FB4F2B630FE61FC9BE0E9C4CBE4826DBA3D9FB4114B903CBAB23CB9C54E2589DBA199DD61873B1AC3D4E
+000001A02F2B860DDF2C94221427E89F2A250A5DBF9DB37923B7C995FF8A70235C604A5E472A53962836132D84BDA9C3429F78DACACE0BF01815CF10A073EADBF5019FC1
+000001CAF786E14FBC3C2828685542E2AB79E80625492456985E65198DBE2C4B34B7D7EA894B354EBAA676E6A3BEA8628AF8D798FF4F5634AB5AF3EEA09D8D7C4CBF8BA8
+000000D4E68469743E8E7F61FD0F626ED34B0690B84045266DF897F3E40EA623174B26CAF3C7F90B7A19B5D35C2A53793004701D6B84265F7D6BE86649C0F6F7FFBA1010
+0
+1
+1
+ecdsa_is_valid_with_key 541
+0000013188EF2D9372EB4EA6F7EBD9FDFA85C3E125B2D15DAF56E6B9383E0EB93847CBF9F67A51CD8ED529F2C381CC0A514ED14AEEB405A2435CD1246641482C09572FAD
+0000000E990B93FB597A4EA6CCB500C6E869847553CBA0D61B540F7DFDB44CA6C4C3665D4DCB75D5A77F271CAA4EAF596C5B317261A8DD8DCE450FE3BD9BB38649F57AAB
+0000019E74514B41F742897EE5F89333BD46476BAC4E4BAE41C09EF94FFEDBF99BCB563B3D8FAB25D952D72189D5AA4CB63267AD3E489BF422E1D77EDD482AC1F476B4B1
+000001E140388CEE1A458494A92EC264DD01D98F1CDB95D555328332CE03F147770630A017E5BDDE44426FB57A110DF82C517CA932BDF16185BDDABF9516E290D0AF2977
+0000016CF603DCECCD09A5725C67C0F36C3BB0D4E31C1AFF2A23EF6653EEE6248AC573155BAE7377D4F88A97ED98403E35AE4FB1985497703BE220CBD3421E77BAB3268B
+0
+1
+1
+ecdsa_is_valid_with_key 542
+00000103CD5E5AB5E2593D957D8DF1CCFE03F988BC0D9DF3663AFE0943A7FF73883B60FC7EEA3B36C4F2680E44BE517C03F7794E9AB68D35BD51484CE1C60015221E1074
+0000018B723FBCB4348022B7D78D9BCBF3DF67245651429F44C28F51C955171ACB4618E65762CAFC3AD8FA819325113AC1DFD3415CEC47F5AC3BB7A196EAF25F1F8D68A6
+000000973C669F2E4E58C91DD0B0E285E64E51F3EDE25A5578A4E04D8F8721500B21423FFBC3E1833AE64FB54D82464617C41B0EA033969F44839581BB98D9CF4CC55D0D
+0000013ADC96F3BC2D3D21EDA319930BE72BEF17FBC008AF668878A7ACB91319CAE92DC6ABDEBD97F1FC1E181209078F529E328CADBACB37C34F0ACDE8513D385506349E
+0000000673C7304FB09ABAFB6514F3071FA107B0E43AE7A1AD18862B2EF6951BC5233D44EB352454623E791C554D17E2D0047D809DE9FAAE346BACF1713C0E09B00A75C9
+0
+1
+0
+ecdsa_is_valid_with_key 543
+000000A513B5CC33B35075761D3123E08D946DE9635ADFFDC9B44AE6B24D42CD15B9AFCC1DB7355CA12EA96A09A972B570E535945751FC06BDD9BF9B272CDC4C98401078
+000000730F04E94A9EF55ADF6B6FE45889D8FBFF42B6CFAD0A86D6295D450D7BAA36F953B19EF8BC0E3058A6BAE26D0FA6E0EB3342C127FB18B47F1AB9C5CA1432E6C172
+000000476F76F51B60CA5AF61FE880C1E6330E4655CE2C98EA25C979520099FE668F6A4040A429A42EB1D686E2C50C13D042B4DF8A2E306671E947EBB11542F069DF05BA
+000001802D028BCAD2FAE238E992DD122377A4918BD1C67780312689F0C820DC4079CFC92AEA62D900650639ACDB44EC0C83F5DB986490939CF259E5E742AD5C09FA4C38
+0000002A746AFCB0CBEE38B1D2649C05F587A0AF06CA08529A3C7A98A9D32123A3279F72E6B41A101B878CB3132A62634E8D519D8E0F4E7B4B8A4DD6229D2DBE52E15436
+0
+0
+0
+ecdsa_is_valid_with_key 544
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+000001EB81B9C9B7C85B904287AF8C8335909ABE29187B904434C23A923E78173B494B31414F07FAE97A469ADC18B7E6FB4BA350573F0049F6F94B31719DA42CDF730389
+0000005E4E3FE881D6BD73698734C0291BFF0753AA1D8A123B977F767CBC123142AC891FD312E861FE502C020C467634D03E812C3451B8185E35BB9E98F7BA16C4D37064
+00000143973DF3937B15830E94A16AC3A884F1CAE93ABA57A4DC0F018D96F77419832B00286F9231CBC155F96C5EA32873E836160E83724CA33CA738C32C2448F85E3B23
+000001959912D1E5C9D28BA57366BFEADE39F4E79E54B5C8AB3124BDE042914D4DD0D200CE836DE86975A177AFA7D77979BEEC2CA716CF844893C84099221B8E747BDE37
+0
+1
+0
+ecdsa_is_valid_with_key 545
+00000105F23265976A03AE655DDA7A217EC72B263602F0B9DE5CDD89F6EA6E68D0034C91D80813AB0A0E06B751E85896E1FE55DE705F4FA51C638B00E59E5E9D0B17A6FA
+0000002D1CF53923031C39F44B2930A9217F9ADF170606479AEF5370AEDEC1FA06DAE5EC1534D72899BAC10B6B94C5CF28ED8511B8E7D24F0A4A7C4D65BEB60C580AEE1E
+000000FF326AC77C1B3688B3351375D6388B150EF65F3CCC8E0EC0C1AE004E1FE330BD391B496A4FF1D90B78081530CA4B9239B7C70DC9B97712E3E8D0E9980DF9062368
+000001BB544A4AAD3146D99706EF56303F4214C881A5BCCED64D5996CE4B02C583CB38C90EA1B2D0E69FB4C7DABD41B54FEDB0CB1599DFEA573FDDCCB96A8047AF58AAB2
+000001CA131A55E00E2DE5D29FD677FD4364DE1D16C61EF2D702D8B51D9E179477B3156BA45DAAE7962A195CF33BCDC01216550D69BFCA1850BAE915B41E2E79F1617685
+0
+1
+0
+ecdsa_is_valid_with_key 546
+00000062838ADE0EC3B1ADF36A1ABE449B2FC17EF45599E3EE47ECC39F4271D9E8E61A8AC45627D9CD9621BEE23DB54FAC5D86C9CC6D79482AD8850A4E7F98A721573B5A
+000000B157C77B142B6E68233CC8F49F6E945D93B8B96EF7466D7F3990A2A959D23EC655CB6ACEE76ABE57A70304642C69F41DC7F3F0E481B0DD7E0045969A92575B008C
+000000D0C500C8B0091A231038F3B22DF9F914A99D6AB031987630A276AEBDF02FBA4EB06CB7473EFF358D62DD158459D3115B3E33A7AD465ED87F717D1739A53EA378B4
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000
+1
+0
+0
 exit
@@ -0,0 +1,35 @@
+secp256r1
+thread_stress 1
+10
+2
+thread_stress 2
+32
+1
+thread_pool 3
+0
+6
+thread_pool 4
+1
+8
+thread_pool 5
+4
+40
+thread_pool 6
+16
+64
+verify_queue 7
+1
+10
+4
+200
+verify_queue 8
+8
+16
+8
+200
+verify_queue 9
+32
+8
+64
+1000
+exit
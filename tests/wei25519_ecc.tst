@@ -0,0 +1,61 @@
+custom
+wei25519
+FF
+7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED
+FD
+1000000000000000000000000000000014DEF9DEA2F79CD65812631A5CF5D3ED
+2AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA984914A144
+7B425ED097B425ED097B425ED097B425ED097B425ED097B4260B5E9C7710C864
+8
+2AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAD245A
+20AE19A1B8A086B4E01EDD2C7748D14C923D4D7E6D7C61B229E9C5A27ECED3D9
+eccp_affine_points_validate_batch 1
+7
+2AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAD245A
+20AE19A1B8A086B4E01EDD2C7748D14C923D4D7E6D7C61B229E9C5A27ECED3D9
+0
+1
+66B52149F27BAAF989BC15A5956F5C7126E7581A84060C46A27056F73A818B9F
+4D0060DD552B6DF51DEDC9B33DDDFD36E7D7A7C5515FFADB27A4E73125FEB8F8
+0
+0
+12BAA2957AA35A27D3A78853E5C10EF3F582AB1CAD4B5E492E97846AB10126CC
+2027FD8CE76A477EF1C79423B0148326FAD9EE95CFA1AF1E0537A2BEE50E71A0
+0
+1
+2AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAD2451
+0000000000000000000000000000000000000000000000000000000000000000
+0
+0
+2A32220B871BE4434B9A3682EB66F9888C75603722A8FF1C07E70715D7D8A6C3
+00BEC3E00151C05048DD958AD40CA6BCE7311270A83AA7003DA8E7477E419E00
+0
+0
+5F3B9A9876325528A721A7DFCE30EC1336908074CA902A617D8411F11DFFABB2
+65FBCED64B40A53C795A9955B0218255AAE1FBEFBD4F3639D579E188BD16CF9F
+0
+0
+0DEEB16644C983CB9101E0DD97AAD42D0684E0C8C920F4FD574ED986BD36DA84
+04446269F5E6367F73E860222697A5D798C18E9921FC0191574B8D576D4CEE1A
+0
+1
+3
+ecdh_phase_two_with_key 2
+5A44AB44F96FE97365E12E6A17C9B326C33709E3EF3CA884B6989668F7C8122A
+659B11188A52EFC72AC39A7B7EF2665EBE2A7A05C65BA7A4842428CB670C1F76
+0
+0AC5A7AB39F2A8A76EC30D101C0072E59E8C85898B5F46AFB24B5692BFB63D9F
+0000000000000000000000000000000000000000000000000000000000000000
+0000000000000000000000000000000000000000000000000000000000000000
+1
+0
+ecdh_phase_two_with_key 3
+5D38EAA9B46C43AC71890038B7AE12976CB2B5A2E4E595C1C5ADFEBE07E16CD9
+38DB693A21ED66E739A2C9EE8210A4EC782066608A8058733FB8BDB7C7CB2F5D
+0
+0CFE1490DF312A0775DC203B55E8DC409BF05D6111AC0C76E06CED8C5AD02342
+3B557126AA0CC3DC4456A3D34FE95F1DECEF446B0276195345657D627CCEC407
+29EB1E10FCA042D51AA4F127B77FEEFBDAEF12DCC546C30B609F3304E7184BFF
+0
+1
+exit